@@ -1,132 +1,122 @@
+// Generated from web/editrss.htm (cc98467d21b99e9d) - do not edit
 #include <Arduino.h>
 static const uint8_t editrsshtm[] = {
-0x1F, 0x8B, 0x08, 0x00, 0xD0, 0x6D, 0xF8, 0x69, 0x02, 0xFF, 0xAD, 0x5A, 0x69, 0x6F, 0xDB, 0x38, 0x1A, 0xFE, 0xBE, 0xC0, 0xFE,
-0x07, 0x56, 0xE8, 0x40, 0x32, 0xC6, 0x92, 0x93, 0xB6, 0xD9, 0x69, 0x13, 0xDB, 0x33, 0xCD, 0xB5, 0x93, 0x4E, 0xD3, 0x76, 0x27,
-0x69, 0x77, 0x8B, 0xA2, 0x40, 0x69, 0x89, 0xB6, 0xD8, 0x50, 0xC7, 0x92, 0x94, 0x1D, 0x6F, 0xEA, 0xFF, 0xBE, 0x2F, 0x49, 0x59,
-0x96, 0x64, 0xDA, 0x4E, 0x33, 0x35, 0x10, 0x44, 0x07, 0xF9, 0xDE, 0xD7, 0x43, 0xBB, 0xFF, 0xE8, 0xF4, 0xED, 0xC9, 0xF5, 0xC7,
-0x77, 0x67, 0x28, 0x96, 0x09, 0x1B, 0xFE, 0xFD, 0x6F, 0x7D, 0xF5, 0x1F, 0x31, 0x9C, 0x4E, 0x06, 0x0E, 0x49, 0x1D, 0xFD, 0x84,
-0xE0, 0x08, 0xFE, 0x23, 0xF8, 0xF4, 0x13, 0x22, 0x31, 0x0A, 0x63, 0xCC, 0x05, 0x91, 0x03, 0xE7, 0xFD, 0xF5, 0xB9, 0xFF, 0xDC,
-0x69, 0xBC, 0x4B, 0x71, 0x42, 0x06, 0xCE, 0x94, 0x92, 0x59, 0x9E, 0x71, 0xE9, 0xA0, 0x30, 0x4B, 0x25, 0x49, 0x61, 0x6D, 0x21,
-0x08, 0xF7, 0x45, 0x88, 0x19, 0x1E, 0x31, 0x32, 0x48, 0xB3, 0x2E, 0xA2, 0x29, 0x95, 0x14, 0x33, 0xFD, 0x90, 0x0C, 0xF6, 0xBB,
-0x28, 0xC1, 0xB7, 0x34, 0x29, 0x92, 0xDA, 0x03, 0x58, 0xD2, 0x78, 0x30, 0xA3, 0x91, 0x8C, 0x07, 0x11, 0x99, 0xD2, 0x90, 0xF8,
-0xFA, 0xA6, 0xE2, 0x2E, 0xA9, 0x64, 0x64, 0x78, 0x4A, 0x72, 0xCC, 0x65, 0xC1, 0x89, 0x40, 0xC7, 0x19, 0xE6, 0x11, 0xFA, 0x86,
-0xFE, 0xBC, 0xBA, 0x42, 0xE7, 0x84, 0x44, 0x02, 0x9D, 0x45, 0x54, 0x66, 0xBC, 0xDF, 0x33, 0x4B, 0xCB, 0x7D, 0x8C, 0xA6, 0x37,
-0x28, 0xE6, 0x64, 0x3C, 0x70, 0x62, 0x29, 0x73, 0x71, 0xD8, 0xEB, 0x85, 0x51, 0x1A, 0x7C, 0x15, 0x11, 0x61, 0x74, 0xCA, 0x83,
-0x94, 0xC8, 0x5E, 0x9A, 0x27, 0xBD, 0x51, 0x96, 0x49, 0x21, 0x39, 0xCE, 0x7F, 0x3B, 0x08, 0x9E, 0x06, 0xCF, 0x7B, 0x11, 0x15,
-0xB2, 0x17, 0x0A, 0xB1, 0x7A, 0x11, 0x80, 0xB8, 0x01, 0x3C, 0x71, 0x10, 0x27, 0x6C, 0xE0, 0x08, 0x39, 0x67, 0x44, 0xC4, 0x84,
-0xC8, 0x4A, 0x46, 0xFD, 0xA8, 0xBC, 0x51, 0x9F, 0x60, 0x0C, 0x72, 0xF9, 0x34, 0x1D, 0x67, 0xE8, 0x0E, 0x94, 0x37, 0x1A, 0x1D,
-0xFE, 0xE3, 0xE0, 0xA7, 0xA3, 0x45, 0xB9, 0xA3, 0x57, 0xDF, 0xD2, 0x17, 0x21, 0xA7, 0xB9, 0xAC, 0x11, 0xF0, 0xBC, 0x0E, 0x1A,
-0x0C, 0xD1, 0xDD, 0xEA, 0x09, 0xD8, 0x5B, 0x48, 0x24, 0x63, 0x92, 0x90, 0x4B, 0x2C, 0xC3, 0x98, 0x70, 0x34, 0x00, 0xB3, 0xA5,
-0x51, 0x36, 0x0B, 0x12, 0xF5, 0xE0, 0x92, 0x44, 0x14, 0x7B, 0xAE, 0x97, 0x83, 0xCA, 0x84, 0x0B, 0x3F, 0xCC, 0x58, 0xA6, 0x1C,
-0xA3, 0x76, 0x1C, 0xA2, 0x08, 0xF3, 0x9B, 0x8E, 0xDB, 0x39, 0x6A, 0x13, 0xC4, 0x79, 0xCE, 0xE6, 0xD7, 0x6A, 0x0D, 0x90, 0x2B,
-0x99, 0xA2, 0x28, 0x0B, 0x8B, 0x04, 0x9C, 0x1B, 0x2C, 0x2F, 0xCE, 0x18, 0xD1, 0xF7, 0x10, 0x1C, 0x2F, 0xA5, 0xE4, 0x74, 0x54,
-0x48, 0xE2, 0xB9, 0x11, 0x96, 0xD8, 0x1F, 0x09, 0x5F, 0x0B, 0xE5, 0x76, 0x1B, 0xC2, 0x19, 0x99, 0xC0, 0x5B, 0xBF, 0x22, 0x57,
-0xF1, 0x76, 0xD1, 0x21, 0x72, 0x19, 0x9D, 0xC4, 0x12, 0x84, 0x40, 0x8B, 0x9A, 0x1C, 0x2B, 0x09, 0xBC, 0xBA, 0x78, 0x0D, 0x62,
-0x38, 0x8A, 0xCE, 0xA6, 0x20, 0xC0, 0x6B, 0xF0, 0x0D, 0x49, 0x09, 0xF7, 0x5C, 0x08, 0xD5, 0x74, 0xA2, 0x98, 0xAE, 0xB6, 0xD7,
-0x77, 0x2F, 0x3A, 0x15, 0x31, 0x30, 0xF5, 0xD2, 0xBA, 0xFD, 0x5E, 0x19, 0xF2, 0xFD, 0x51, 0x16, 0xCD, 0x51, 0xC8, 0xB0, 0x10,
-0x03, 0x67, 0x34, 0xF1, 0xD5, 0xAD, 0x2F, 0x09, 0x87, 0xB0, 0xE5, 0x73, 0x94, 0xCF, 0xFD, 0x67, 0x95, 0x6B, 0x23, 0x3A, 0x45,
-0xDA, 0x57, 0x03, 0xC7, 0x78, 0x51, 0x05, 0xAF, 0xF7, 0x62, 0xEF, 0xA7, 0x2E, 0x3A, 0xD8, 0xDB, 0xCB, 0x6F, 0x41, 0x9B, 0x04,
-0xF3, 0x09, 0x4D, 0x0F, 0xF7, 0x10, 0x2E, 0x64, 0x76, 0x84, 0x72, 0x90, 0x96, 0xA6, 0x13, 0xB8, 0xDF, 0x87, 0xF7, 0x47, 0x4E,
-0xCD, 0xAD, 0x9A, 0x5A, 0xC9, 0x36, 0x54, 0x51, 0x2C, 0x62, 0x0C, 0x0E, 0xF4, 0x45, 0x52, 0x5F, 0x65, 0x5B, 0xE9, 0x2B, 0xC9,
-0xC1, 0xE7, 0x20, 0x6C, 0xCE, 0x69, 0xA2, 0xC4, 0x94, 0xE4, 0x56, 0xFA, 0xB3, 0x98, 0x4A, 0x82, 0x22, 0x7F, 0xCC, 0xC8, 0x2D,
-0xFA, 0x5A, 0x08, 0x49, 0xC7, 0x73, 0xBF, 0xCC, 0x4D, 0x7F, 0x44, 0xE4, 0x8C, 0x90, 0x14, 0x61, 0x30, 0x7C, 0xEA, 0xC3, 0xC2,
-0x04, 0xC2, 0x02, 0x5E, 0x00, 0x1D, 0xD0, 0xF1, 0x69, 0x9B, 0xA7, 0xE6, 0x1B, 0x1F, 0x2C, 0xD9, 0x26, 0x23, 0x7F, 0xCF, 0x19,
-0xAA, 0xDC, 0x5A, 0xA5, 0x1A, 0x58, 0xF0, 0xC0, 0xB6, 0x0B, 0x02, 0x42, 0x66, 0x69, 0x65, 0x51, 0x99, 0x22, 0xF8, 0xF3, 0xB5,
-0xBF, 0xF5, 0x95, 0x48, 0xD0, 0x78, 0x06, 0x66, 0x66, 0x91, 0x83, 0xB2, 0x34, 0x64, 0x34, 0xBC, 0x19, 0x38, 0x59, 0x4E, 0xD2,
-0xCB, 0x2C, 0xC2, 0xCC, 0xEB, 0x38, 0xC3, 0x9F, 0xD1, 0xCB, 0x28, 0xD2, 0x4C, 0xFA, 0x3D, 0x43, 0xAD, 0x6D, 0x11, 0xC8, 0xCC,
-0xE9, 0x2E, 0x2B, 0x69, 0xBF, 0xE6, 0x4A, 0x6E, 0x8B, 0x90, 0x05, 0x5B, 0xAE, 0x65, 0x10, 0x47, 0xFE, 0x84, 0x67, 0x45, 0x8E,
-0x56, 0x97, 0x60, 0xC3, 0x42, 0xC4, 0x0E, 0xA2, 0xD1, 0xC0, 0x51, 0xF9, 0xAB, 0x82, 0xCD, 0x46, 0xA7, 0xAC, 0x2E, 0xEB, 0xB4,
-0xB4, 0x85, 0x8D, 0x5B, 0x4A, 0x2B, 0xEB, 0xEB, 0x04, 0x92, 0x25, 0x2A, 0x83, 0xEA, 0x75, 0x86, 0x55, 0x6C, 0x20, 0x45, 0x5F,
-0x04, 0x41, 0xD0, 0xEF, 0x31, 0x6A, 0x13, 0xB5, 0x57, 0xB0, 0x87, 0xA8, 0x3F, 0x86, 0x92, 0xB5, 0xCD, 0xB9, 0xB5, 0xF5, 0x65,
-0xC8, 0x4C, 0x70, 0xEE, 0x3F, 0xD9, 0xA8, 0xA5, 0xDD, 0xAD, 0xA2, 0x08, 0x43, 0x22, 0x04, 0x52, 0x04, 0x94, 0xE6, 0x33, 0x7F,
-0xBF, 0xE6, 0x55, 0x81, 0xA7, 0xE4, 0x3A, 0xBB, 0x22, 0x7C, 0x0A, 0x79, 0xDA, 0x31, 0xE6, 0x54, 0xCF, 0x8E, 0x65, 0xBA, 0x89,
-0x8F, 0xFA, 0x5C, 0xC1, 0x12, 0x74, 0xA2, 0xB3, 0x5A, 0x6C, 0x90, 0xC6, 0x1E, 0x17, 0xD5, 0x6B, 0x5C, 0x56, 0xFB, 0x9E, 0xB3,
-0x26, 0x30, 0x81, 0x8C, 0x80, 0x2A, 0x34, 0x77, 0x86, 0x27, 0x2C, 0x13, 0xA4, 0xDF, 0xC3, 0x56, 0xA3, 0xAF, 0x5B, 0xB8, 0xB2,
-0xDA, 0x52, 0x8B, 0x2B, 0x89, 0x65, 0x21, 0x2A, 0x0E, 0xE3, 0x8C, 0x27, 0xBE, 0xF2, 0x32, 0x4A, 0xA4, 0xFF, 0x04, 0xF2, 0x30,
-0xCD, 0x52, 0x52, 0x0F, 0x01, 0x67, 0x68, 0x75, 0x5C, 0xEB, 0x59, 0xFD, 0x7E, 0x79, 0x5D, 0xAB, 0x3F, 0xCB, 0x84, 0x54, 0xB9,
-0x82, 0xC6, 0x50, 0x07, 0x56, 0x41, 0xAA, 0xF3, 0xC7, 0x41, 0x12, 0x8F, 0xA0, 0x15, 0x90, 0xDB, 0x81, 0xA3, 0x7C, 0x81, 0x39,
-0xC5, 0x3E, 0xF4, 0x63, 0xC2, 0x18, 0x89, 0x46, 0xF3, 0xDA, 0xCA, 0xD7, 0xEA, 0x61, 0xB9, 0x20, 0xA6, 0x51, 0x44, 0xD2, 0x81,
-0x23, 0x79, 0x41, 0x36, 0x15, 0x29, 0xCD, 0xD2, 0x87, 0xC6, 0xC2, 0xB2, 0x09, 0xAA, 0xDF, 0x94, 0xEA, 0x11, 0xC8, 0xE7, 0xB2,
-0x3A, 0xAE, 0xFA, 0x1C, 0x82, 0xEA, 0x78, 0x84, 0xCA, 0xEB, 0x67, 0xAA, 0x48, 0x56, 0x35, 0x12, 0x95, 0x45, 0x72, 0x5B, 0xB9,
-0x33, 0x6C, 0xCA, 0x1A, 0xB6, 0x2B, 0x8C, 0xCD, 0x62, 0x53, 0x1C, 0x37, 0x86, 0x71, 0xBC, 0xDF, 0x5C, 0xAE, 0xE7, 0x04, 0x34,
-0x16, 0xFE, 0x41, 0xCB, 0x90, 0xC6, 0x3C, 0x43, 0xA8, 0x44, 0x3D, 0x5D, 0xF7, 0x4C, 0x39, 0x8A, 0xF7, 0x77, 0xE4, 0x87, 0x9C,
-0xE7, 0x60, 0x00, 0x73, 0x53, 0x0F, 0x3E, 0x3F, 0x54, 0xD1, 0xE6, 0xA0, 0x65, 0xA3, 0x84, 0xD1, 0x22, 0xA1, 0x95, 0x18, 0x75,
-0x3F, 0x0D, 0x1C, 0x1D, 0x98, 0x2A, 0x5A, 0x36, 0x06, 0xF9, 0xD6, 0xF8, 0x6C, 0xE8, 0xA7, 0xAA, 0xE0, 0x46, 0x63, 0xA8, 0x90,
-0xAD, 0xB4, 0x3E, 0x87, 0x9B, 0x6D, 0x59, 0xD9, 0xA7, 0x69, 0x5E, 0xC8, 0x52, 0x41, 0x13, 0x30, 0xC6, 0x64, 0x30, 0x6C, 0xC8,
-0x0B, 0x15, 0x71, 0x0E, 0x9A, 0x62, 0x56, 0x10, 0x1D, 0x78, 0xDB, 0x08, 0xD5, 0x85, 0x1C, 0xD9, 0xCB, 0x53, 0xB3, 0xC0, 0x2A,
-0xB3, 0x20, 0x10, 0xD6, 0x08, 0xFA, 0x06, 0xC6, 0xCF, 0x66, 0xD6, 0x31, 0xE3, 0x2B, 0xE5, 0x22, 0xA4, 0xDE, 0x42, 0x29, 0x55,
-0x4F, 0x76, 0xD1, 0xAD, 0x2B, 0xA4, 0xF2, 0xB4, 0x49, 0x54, 0x45, 0x1D, 0xCF, 0xD8, 0x2A, 0x2C, 0x0C, 0x5F, 0x4E, 0xFE, 0x5B,
-0x50, 0xAE, 0xAA, 0x38, 0xC3, 0x21, 0x89, 0xA1, 0x8D, 0x11, 0x90, 0x8B, 0x04, 0x93, 0x00, 0x1D, 0x1F, 0x9F, 0xA0, 0x37, 0x64,
-0x26, 0xB6, 0x2A, 0xBF, 0xC1, 0x73, 0x3F, 0xCA, 0x38, 0xEF, 0x39, 0xB3, 0xDA, 0x46, 0xB5, 0xED, 0xF7, 0x7F, 0xBE, 0x7E, 0x80,
-0x65, 0x8A, 0x36, 0xC5, 0x35, 0xC3, 0x68, 0x9E, 0x76, 0xBB, 0x2C, 0xC7, 0x6D, 0xE8, 0x6F, 0x0F, 0xB5, 0x4A, 0xBF, 0xA7, 0xB8,
-0xFE, 0xA5, 0x24, 0x30, 0xBD, 0xD0, 0x79, 0x60, 0xEA, 0xB6, 0xFA, 0xC6, 0xA6, 0x14, 0x1E, 0x9E, 0xE0, 0x34, 0x24, 0x6C, 0x57,
-0x6B, 0xBA, 0x0F, 0xB3, 0x72, 0xAC, 0x6B, 0x75, 0x52, 0x15, 0xDE, 0x6A, 0x3C, 0xD2, 0xED, 0x71, 0xCB, 0x74, 0xB4, 0x71, 0x44,
-0xB8, 0x47, 0xA7, 0xA9, 0x41, 0x10, 0x24, 0x78, 0xF8, 0x10, 0xBC, 0xF4, 0xB5, 0x0E, 0x97, 0x46, 0x45, 0x1A, 0x31, 0xA2, 0x51,
-0xD3, 0x57, 0x68, 0x95, 0x14, 0x0A, 0xF9, 0x84, 0x53, 0x09, 0x7D, 0x08, 0xC6, 0xDD, 0xA7, 0xCF, 0x9F, 0xF9, 0xE7, 0x7F, 0xCC,
-0xB3, 0x33, 0x28, 0x3D, 0x27, 0xFF, 0x64, 0xF3, 0xE9, 0xEC, 0xF6, 0xC5, 0xEF, 0x5F, 0xF7, 0x5E, 0xBC, 0x0A, 0x3F, 0xA6, 0x4F,
-0xD3, 0xE9, 0x2F, 0x33, 0xFA, 0xEE, 0x03, 0xFB, 0xDF, 0x2F, 0x1F, 0x3F, 0xCE, 0x5E, 0xF1, 0x7F, 0x7F, 0x08, 0xFF, 0xF3, 0x47,
-0xEF, 0x38, 0x49, 0x3F, 0x9C, 0xDE, 0x5E, 0xFE, 0x7C, 0xFA, 0x44, 0x84, 0xFF, 0x1A, 0x5D, 0x5C, 0xDF, 0x5E, 0x80, 0xED, 0x78,
-0x26, 0x44, 0xC6, 0x29, 0xF4, 0x94, 0x81, 0x83, 0xA1, 0xE9, 0xCE, 0x93, 0x0C, 0xDA, 0xF2, 0xB0, 0x36, 0xEC, 0xDB, 0x81, 0x15,
-0x23, 0xD2, 0x0C, 0x5F, 0x00, 0x77, 0x3E, 0x7D, 0x3E, 0x5A, 0x7F, 0xA1, 0xFB, 0xC0, 0x05, 0x40, 0x23, 0xE5, 0xD8, 0xA3, 0x65,
-0x1B, 0x5E, 0x01, 0xA6, 0xE5, 0x64, 0x08, 0xFB, 0x2B, 0x98, 0x34, 0x21, 0x4B, 0x84, 0x74, 0x3C, 0xBF, 0x88, 0x3C, 0x77, 0xB9,
-0xC6, 0x82, 0xB7, 0x14, 0x8C, 0xBE, 0xD0, 0x89, 0xB6, 0x63, 0xBF, 0x2A, 0x3C, 0x96, 0xFD, 0x90, 0x98, 0xF7, 0xDA, 0x0E, 0xE9,
-0x69, 0xD9, 0xAD, 0x67, 0x84, 0x9D, 0xFB, 0xAB, 0xDA, 0x6E, 0xA1, 0xB0, 0x9A, 0x81, 0xB6, 0x51, 0x58, 0xAD, 0xD2, 0x24, 0x56,
-0x44, 0xAA, 0x1D, 0xEB, 0x88, 0xEE, 0xF4, 0xED, 0xE5, 0x89, 0xE9, 0xF9, 0x6A, 0x48, 0x26, 0x11, 0x60, 0xBB, 0x35, 0x10, 0xAC,
-0x3E, 0x6B, 0x4E, 0x02, 0x41, 0x52, 0x32, 0x43, 0xAB, 0xF8, 0x33, 0x98, 0x62, 0xAB, 0x79, 0xF4, 0x12, 0xB7, 0x53, 0xD7, 0x4F,
-0x07, 0x01, 0x70, 0xD6, 0x38, 0xC7, 0x6B, 0x82, 0xC9, 0x86, 0x0E, 0xBD, 0x1E, 0x52, 0x12, 0x96, 0x61, 0x34, 0xE6, 0x59, 0x02,
-0xBC, 0x61, 0xFA, 0xAE, 0x41, 0x5A, 0x31, 0x4F, 0x43, 0x34, 0x2E, 0xD2, 0x50, 0x52, 0x48, 0xFB, 0x1A, 0xD5, 0xB6, 0x32, 0x12,
-0x70, 0xDC, 0xDD, 0x7A, 0x26, 0x1B, 0x5B, 0x73, 0x22, 0x72, 0xB8, 0x50, 0x0A, 0xE2, 0x19, 0xA6, 0x2A, 0xF6, 0x00, 0x0E, 0x7B,
-0x2E, 0x17, 0x02, 0x12, 0x2B, 0x4B, 0xDD, 0xB6, 0xF8, 0xEA, 0x43, 0xC7, 0xC8, 0x7B, 0xB4, 0xDC, 0x19, 0x64, 0x37, 0x1D, 0x40,
-0xD2, 0x30, 0xA2, 0x6B, 0x13, 0x9D, 0x71, 0x9E, 0x81, 0xA5, 0xDF, 0x00, 0x2C, 0xCC, 0xF8, 0x0D, 0x22, 0xEA, 0xD6, 0x4A, 0x64,
-0x99, 0x21, 0x86, 0x6D, 0x45, 0x4D, 0x31, 0xF5, 0xDA, 0xEB, 0x17, 0x28, 0x54, 0x28, 0x1D, 0x79, 0x9A, 0x5C, 0x67, 0x93, 0x3A,
-0x19, 0x54, 0x04, 0x62, 0xF8, 0x6B, 0x31, 0x8C, 0x32, 0x15, 0x16, 0x3A, 0x04, 0x77, 0x1B, 0x02, 0x1B, 0xC4, 0x51, 0x81, 0x12,
-0xD0, 0x14, 0x42, 0xE5, 0xF7, 0xEB, 0xCB, 0xD7, 0x20, 0xDB, 0x97, 0x5D, 0x18, 0x2C, 0x52, 0x58, 0x82, 0x37, 0x87, 0xF1, 0x73,
-0x4C, 0x61, 0x24, 0x46, 0x32, 0xD3, 0x4E, 0xA9, 0xBB, 0xB0, 0x7D, 0xC0, 0x64, 0xA0, 0xD9, 0x17, 0x8B, 0x34, 0x9C, 0xC0, 0xB2,
-0xB4, 0x6D, 0x85, 0xE6, 0x2D, 0x27, 0x90, 0x3F, 0xDC, 0x12, 0x4A, 0xF5, 0x40, 0xAA, 0x02, 0xA4, 0xB1, 0xBA, 0x6D, 0x40, 0xE5,
-0x50, 0x03, 0x17, 0x19, 0x49, 0x27, 0x32, 0x46, 0x83, 0xC1, 0x00, 0xED, 0x59, 0xED, 0xFC, 0x30, 0x3B, 0xAD, 0x61, 0x55, 0x67,
-0xF8, 0x26, 0x2B, 0x4D, 0x83, 0xA7, 0x60, 0x30, 0x75, 0xB0, 0x17, 0x68, 0x78, 0x0E, 0xE0, 0xE6, 0xD1, 0x5F, 0xB2, 0x8B, 0x55,
-0x42, 0xD7, 0x3D, 0x5A, 0x5F, 0x25, 0x02, 0x98, 0x00, 0xCE, 0x30, 0xC4, 0xBB, 0xD6, 0xBE, 0x6B, 0x6A, 0x97, 0xAD, 0x20, 0xAC,
-0x12, 0x06, 0x14, 0xAD, 0x15, 0xA5, 0x90, 0x13, 0x2C, 0x49, 0x99, 0xFA, 0x9E, 0xCB, 0xA8, 0x35, 0xD4, 0x19, 0x0D, 0xB4, 0x71,
-0x54, 0xBD, 0x55, 0xB2, 0xB4, 0x4D, 0xF4, 0xDD, 0x47, 0x2B, 0x6E, 0xA3, 0x58, 0xD4, 0xD8, 0x34, 0x9C, 0xB2, 0x61, 0x50, 0xA8,
-0x4D, 0x31, 0xAB, 0x23, 0x44, 0xED, 0x19, 0x40, 0x69, 0x29, 0x24, 0x1A, 0xB9, 0xEF, 0x90, 0x5D, 0x1E, 0xB7, 0xB4, 0x37, 0x3F,
-0xBE, 0x53, 0x74, 0x03, 0xD5, 0x86, 0x16, 0x3B, 0xC7, 0x52, 0x91, 0x60, 0x56, 0x9D, 0x99, 0xD4, 0xCE, 0x32, 0x1A, 0x34, 0xC1,
-0x42, 0x23, 0x96, 0x85, 0x37, 0x15, 0x6D, 0x68, 0x51, 0x40, 0x5A, 0xEF, 0xDD, 0x38, 0xDD, 0x6D, 0x99, 0xFC, 0x6A, 0x3A, 0xA8,
-0xB1, 0xC8, 0x9C, 0xD2, 0x54, 0x57, 0xEA, 0xA8, 0x0C, 0xC1, 0x20, 0x0A, 0x73, 0x94, 0xBE, 0xDF, 0x6A, 0x8E, 0xFB, 0x8C, 0x5D,
-0x59, 0x21, 0x19, 0x4D, 0x49, 0x7D, 0xD6, 0xB3, 0x1C, 0x50, 0x3D, 0xBE, 0xD3, 0xE1, 0xB7, 0xE8, 0x98, 0x03, 0xB1, 0x1D, 0xF3,
-0xDE, 0x77, 0x33, 0x37, 0xA5, 0xAA, 0xC6, 0x19, 0x66, 0x2E, 0x22, 0xCD, 0xF0, 0x57, 0x63, 0x7D, 0xBA, 0x7B, 0xD2, 0xDC, 0x60,
-0xD9, 0x2F, 0xDB, 0xAA, 0x2A, 0xCE, 0x41, 0xCF, 0xE8, 0x24, 0xA6, 0x2C, 0xF2, 0x18, 0x5D, 0xAB, 0xEF, 0xBB, 0xEB, 0xD7, 0xCA,
-0x4E, 0x5A, 0x54, 0x88, 0x6F, 0x7F, 0xDF, 0x5A, 0xC7, 0xCC, 0xEB, 0xA1, 0xED, 0x75, 0xD9, 0x59, 0x35, 0xEC, 0x06, 0x5A, 0x64,
-0xFD, 0xED, 0xEE, 0x86, 0xAE, 0xE1, 0xBB, 0xDB, 0x31, 0x99, 0x76, 0xAD, 0x4E, 0x65, 0x20, 0xA1, 0x2B, 0x20, 0xEF, 0x5A, 0x6C,
-0x50, 0x8D, 0x63, 0x81, 0x46, 0xB1, 0xB0, 0x5E, 0xD7, 0x9E, 0x4F, 0x5A, 0xD0, 0xCF, 0x3A, 0x4D, 0x2C, 0xBB, 0x96, 0x43, 0x98,
-0x7D, 0x13, 0xBC, 0xB5, 0xF5, 0xE5, 0x6A, 0xF4, 0xAA, 0x76, 0xE9, 0x47, 0x6B, 0xDD, 0x94, 0x30, 0xE8, 0xF8, 0x76, 0xE3, 0xA8,
-0x12, 0xFC, 0x43, 0x6D, 0xA3, 0x08, 0x02, 0x78, 0xDD, 0x68, 0x9E, 0xAD, 0x64, 0xD5, 0xD9, 0x01, 0x10, 0x84, 0x8E, 0x49, 0xA4,
-0xD7, 0xB9, 0x9F, 0xCA, 0xFE, 0xFE, 0xEE, 0xFE, 0xD0, 0x18, 0xEE, 0x02, 0x11, 0x67, 0xB3, 0x7B, 0xB4, 0xD0, 0x15, 0x56, 0xB2,
-0xC5, 0xDD, 0xA3, 0xB6, 0x9F, 0xBF, 0x7D, 0x43, 0x8F, 0x9A, 0x5E, 0xB4, 0x06, 0x24, 0x66, 0x84, 0x4B, 0xCF, 0x79, 0xC7, 0x08,
-0x06, 0xA7, 0x8C, 0x29, 0x54, 0x43, 0x0A, 0x99, 0x9B, 0x41, 0x17, 0x1E, 0x53, 0xC2, 0xA0, 0x49, 0x39, 0x9D, 0xEF, 0xE8, 0x84,
-0xCD, 0x07, 0x25, 0x20, 0x20, 0x33, 0x7D, 0x84, 0x31, 0xB0, 0xF1, 0x57, 0x62, 0x1F, 0xB6, 0x83, 0xB4, 0x6B, 0x0D, 0xC8, 0xC3,
-0x56, 0x54, 0xB6, 0x98, 0x1F, 0xD9, 0xB9, 0xD3, 0x48, 0x65, 0x6B, 0xAE, 0xBE, 0xF6, 0xBB, 0x80, 0x26, 0xD9, 0xF6, 0x58, 0x5B,
-0x39, 0x9D, 0xC3, 0xD1, 0x96, 0x0C, 0x2E, 0x13, 0x21, 0xBA, 0xFD, 0x6C, 0xA6, 0x72, 0xA5, 0xDA, 0xBD, 0x23, 0xDC, 0xB4, 0xFD,
-0xBC, 0x10, 0xB1, 0x57, 0x6E, 0xED, 0xEC, 0xB2, 0xE1, 0xA6, 0x39, 0xCB, 0x1E, 0x4B, 0x31, 0x8D, 0xC8, 0x3D, 0x62, 0xA9, 0x56,
-0x7C, 0xCB, 0xA1, 0xC3, 0x12, 0x52, 0x60, 0xBF, 0x31, 0xE5, 0x89, 0xF7, 0xE5, 0x25, 0x27, 0x68, 0x9E, 0x15, 0x48, 0x14, 0xE5,
-0xC5, 0x0C, 0xA7, 0x52, 0x4D, 0x98, 0x86, 0x0C, 0x72, 0x4C, 0x5B, 0x6C, 0xD4, 0x94, 0x85, 0xF3, 0xEB, 0x97, 0xCE, 0x66, 0x03,
-0x06, 0x22, 0x87, 0x36, 0x40, 0x0C, 0xF7, 0x2E, 0xDA, 0xB7, 0xC7, 0xD8, 0x66, 0xCD, 0x17, 0x1B, 0x34, 0x6C, 0xE1, 0x92, 0xE6,
-0x49, 0x7D, 0x5B, 0x1A, 0x13, 0x20, 0xAA, 0x53, 0xED, 0x00, 0x7A, 0xC7, 0x72, 0x1D, 0x89, 0xC0, 0xB6, 0x20, 0xA2, 0x42, 0x4D,
-0x8E, 0x2A, 0xB4, 0xD5, 0x11, 0xB3, 0x65, 0x45, 0xA3, 0x16, 0x5D, 0xE1, 0x29, 0xA0, 0x81, 0x20, 0x08, 0xDA, 0x85, 0x68, 0x05,
-0x26, 0xCD, 0xA4, 0x66, 0x7A, 0x56, 0x04, 0xDC, 0xCD, 0x71, 0x7B, 0x0B, 0x62, 0xEE, 0x84, 0x55, 0x30, 0xAD, 0x8C, 0x4A, 0xCC,
-0x78, 0x0C, 0x97, 0x9E, 0xBD, 0x93, 0x7E, 0x7A, 0x75, 0xF5, 0xF6, 0x4D, 0x00, 0x80, 0x12, 0x84, 0x82, 0xC1, 0xCF, 0x8C, 0xE0,
-0x5D, 0x94, 0x16, 0x8C, 0x75, 0xD1, 0x93, 0xCE, 0xE7, 0xAE, 0x7D, 0xDB, 0x9D, 0x6E, 0xF8, 0x87, 0xC8, 0x55, 0xDF, 0x4B, 0x52,
-0x98, 0x8F, 0xC0, 0xD0, 0x3D, 0x0D, 0xD6, 0xDA, 0xA5, 0x4E, 0x7D, 0x3A, 0xD6, 0x59, 0xB1, 0x3C, 0x68, 0x80, 0xF2, 0x7A, 0x8A,
-0x25, 0x2E, 0x45, 0x3D, 0x2F, 0x6F, 0xAD, 0x95, 0x76, 0xB9, 0xB6, 0x6C, 0xE5, 0x50, 0x9F, 0x01, 0xE6, 0x00, 0xA2, 0x52, 0xAA,
-0x76, 0x51, 0x13, 0x30, 0x7E, 0x2F, 0xDA, 0xEC, 0x15, 0xB9, 0xC2, 0x4A, 0x40, 0xED, 0xCE, 0xAE, 0x72, 0x42, 0x64, 0x9C, 0x45,
-0xA0, 0xF2, 0xBB, 0xB7, 0x57, 0xD7, 0xEE, 0x06, 0xBB, 0xA8, 0x23, 0xE9, 0xC3, 0x4A, 0xCE, 0xF5, 0x35, 0x0B, 0xBB, 0x68, 0x2A,
-0xD3, 0x1A, 0x60, 0x76, 0x83, 0x0C, 0xAA, 0x4B, 0x98, 0x18, 0xF1, 0xDC, 0x2B, 0xF3, 0xF5, 0xD4, 0x18, 0x3C, 0x35, 0xD7, 0xC1,
-0xA3, 0xF1, 0x9E, 0x8C, 0xC9, 0x1A, 0xC6, 0x73, 0xBB, 0xAE, 0x1E, 0x65, 0xCB, 0x2F, 0xB4, 0xAC, 0xF8, 0x60, 0x73, 0xB9, 0x6A,
-0xF3, 0x5D, 0x61, 0x4B, 0xC5, 0x14, 0x15, 0x79, 0x84, 0xD5, 0xB0, 0xAC, 0x0E, 0x61, 0x0D, 0x98, 0xDA, 0x21, 0xC5, 0x0C, 0xF3,
-0x14, 0x82, 0xCD, 0x2E, 0xC5, 0x77, 0x63, 0xEE, 0xBA, 0x64, 0x0D, 0xC0, 0x1F, 0xA0, 0x96, 0xA0, 0x4A, 0xA6, 0x1F, 0x26, 0xEC,
-0x02, 0x1A, 0x63, 0x8A, 0x95, 0xE5, 0x2D, 0x32, 0xB5, 0xAA, 0xC2, 0x18, 0x83, 0x65, 0x8F, 0xEC, 0xCB, 0xDA, 0xA5, 0xA1, 0xFA,
-0x6E, 0xD0, 0xBD, 0x67, 0xAD, 0x5B, 0x55, 0xB9, 0x95, 0x21, 0x12, 0x70, 0x32, 0x9E, 0x90, 0xAE, 0x06, 0x30, 0x27, 0xAA, 0x96,
-0xAC, 0x99, 0xAE, 0x56, 0x6C, 0xEA, 0x22, 0x94, 0x3B, 0x77, 0x54, 0xA6, 0x12, 0x43, 0x7E, 0x69, 0x7D, 0x2B, 0xF8, 0xF8, 0xAE,
-0xE2, 0xB7, 0x68, 0x0F, 0xE2, 0x30, 0x3B, 0x5D, 0xD3, 0x84, 0x00, 0x10, 0x58, 0xFE, 0xE4, 0xE3, 0x3E, 0xF5, 0x0E, 0x2D, 0xBA,
-0xEA, 0x8B, 0xB5, 0xBD, 0x56, 0x2F, 0x5B, 0xFB, 0xB9, 0x83, 0xCA, 0x3A, 0xF3, 0xBB, 0x07, 0xF5, 0x23, 0xA0, 0xFF, 0x03, 0x82,
-0x09, 0xFA, 0x2E, 0x14, 0x24, 0x00, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xA5, 0x59, 0x6D, 0x73, 0xDB, 0x36, 0x12, 0xFE, 0xAE, 0x5F, 0x81,
+0x70, 0xD2, 0xA1, 0x34, 0x15, 0x29, 0x3B, 0x89, 0xDB, 0xC4, 0xB6, 0xD4, 0x8B, 0xDF, 0xAE, 0x4E, 0xE3, 0x24, 0x57, 0x3B, 0xB9,
+0xCB, 0x64, 0x32, 0x63, 0x88, 0x84, 0x24, 0xC4, 0x20, 0xC0, 0x03, 0x41, 0xC9, 0xAA, 0xA3, 0xFF, 0x7E, 0xBB, 0x00, 0x5F, 0x25,
+0xC5, 0x4E, 0x7A, 0x1F, 0x3C, 0x22, 0xF1, 0xB2, 0xBB, 0xD8, 0x7D, 0x76, 0xF7, 0x01, 0x7D, 0xF8, 0xE8, 0xE4, 0xED, 0xF1, 0xD5,
+0xC7, 0x77, 0xA7, 0x64, 0x66, 0x12, 0x31, 0xEA, 0x1C, 0xE2, 0x0F, 0x11, 0x54, 0x4E, 0x87, 0x1E, 0x93, 0x1E, 0x0E, 0x30, 0x1A,
+0xC3, 0x4F, 0xC2, 0x0C, 0x25, 0xD1, 0x8C, 0xEA, 0x8C, 0x99, 0xA1, 0xF7, 0xFE, 0xEA, 0x2C, 0x78, 0xEE, 0x95, 0xC3, 0x92, 0x26,
+0x6C, 0xE8, 0xCD, 0x39, 0x5B, 0xA4, 0x4A, 0x1B, 0x8F, 0x44, 0x4A, 0x1A, 0x26, 0x61, 0x59, 0x9E, 0x31, 0x1D, 0x64, 0x11, 0x15,
+0x74, 0x2C, 0xD8, 0x50, 0xAA, 0x3E, 0xE1, 0x92, 0x1B, 0x4E, 0x85, 0x1D, 0x64, 0xC3, 0xDD, 0x3E, 0x49, 0xE8, 0x2D, 0x4F, 0xF2,
+0xA4, 0x31, 0x00, 0x4B, 0x5A, 0x03, 0x0B, 0x1E, 0x9B, 0xD9, 0x30, 0x66, 0x73, 0x1E, 0xB1, 0xC0, 0xBE, 0xA0, 0x62, 0xC3, 0x8D,
+0x60, 0xA3, 0x13, 0x96, 0x52, 0x6D, 0x72, 0xCD, 0x32, 0x72, 0xA4, 0xA8, 0x8E, 0xC9, 0x57, 0xF2, 0xE7, 0xE5, 0x25, 0x39, 0x63,
+0x2C, 0xCE, 0xC8, 0x69, 0xCC, 0x8D, 0xD2, 0x87, 0x03, 0xB7, 0xB4, 0x73, 0x28, 0xB8, 0xBC, 0x21, 0x33, 0xCD, 0x26, 0x43, 0x6F,
+0x66, 0x4C, 0x9A, 0xED, 0x0F, 0x06, 0x51, 0x2C, 0xC3, 0x2F, 0x59, 0xCC, 0x04, 0x9F, 0xEB, 0x50, 0x32, 0x33, 0x90, 0x69, 0x32,
+0x18, 0x2B, 0x65, 0x32, 0xA3, 0x69, 0xFA, 0x8F, 0xBD, 0xF0, 0x69, 0xF8, 0x7C, 0x10, 0xF3, 0xCC, 0x0C, 0xA2, 0x2C, 0xAB, 0x27,
+0x42, 0x30, 0x32, 0x84, 0x11, 0x8F, 0x68, 0x26, 0x86, 0x5E, 0x66, 0x96, 0x82, 0x65, 0x33, 0xC6, 0x0C, 0x5A, 0x66, 0xDF, 0x46,
+0x9D, 0x70, 0x02, 0x46, 0x04, 0x5C, 0x4E, 0x14, 0xB9, 0x83, 0x43, 0x3A, 0xCB, 0xF7, 0x7F, 0xD9, 0xFB, 0xE9, 0x60, 0xD5, 0x39,
+0x1C, 0x14, 0x8B, 0x0E, 0xB3, 0x48, 0xF3, 0xD4, 0x8C, 0x3A, 0xDD, 0x6E, 0x8F, 0x0C, 0x47, 0xE4, 0xAE, 0x03, 0xBE, 0xCB, 0x0C,
+0x31, 0x33, 0x96, 0xB0, 0x0B, 0x6A, 0xA2, 0x19, 0xD3, 0x64, 0x08, 0x2E, 0x90, 0xB1, 0x5A, 0x84, 0x09, 0x0E, 0x5C, 0xB0, 0x98,
+0xD3, 0xAE, 0xDF, 0x4D, 0xE1, 0x20, 0x4C, 0x67, 0x41, 0xA4, 0x84, 0x42, 0x27, 0xE3, 0x8E, 0x7D, 0x12, 0x53, 0x7D, 0xD3, 0xF3,
+0x7B, 0x07, 0x85, 0x1C, 0x9A, 0xA6, 0x62, 0x79, 0x85, 0x53, 0x20, 0xA5, 0x50, 0x41, 0x62, 0x15, 0xE5, 0x09, 0xC4, 0x27, 0x2C,
+0x1F, 0x4E, 0x05, 0xB3, 0xEF, 0x10, 0xDA, 0x97, 0xC6, 0x68, 0x3E, 0xCE, 0x0D, 0xEB, 0xFA, 0x31, 0x35, 0x34, 0x18, 0x67, 0x81,
+0xB5, 0xC5, 0xEF, 0xB7, 0x6C, 0x72, 0xA6, 0x80, 0xD7, 0x7F, 0x23, 0x3E, 0xAA, 0xF4, 0xC9, 0x3E, 0xF1, 0x05, 0x9F, 0xCE, 0x0C,
+0xE8, 0x26, 0xAB, 0x83, 0x4E, 0xAD, 0xB8, 0x0B, 0xC6, 0xB4, 0xB6, 0xD2, 0x38, 0x3E, 0x9D, 0x83, 0xBA, 0xD7, 0xE0, 0x56, 0x26,
+0x99, 0xEE, 0xFA, 0x00, 0x2B, 0x39, 0x45, 0x15, 0xF5, 0x2E, 0xD8, 0xB4, 0xEA, 0xE1, 0x56, 0x70, 0x55, 0xE1, 0xA2, 0xC3, 0x41,
+0x01, 0xC5, 0xB1, 0x8A, 0x97, 0x24, 0x12, 0x34, 0xCB, 0x86, 0xDE, 0x78, 0x1A, 0xE0, 0x6B, 0x60, 0x98, 0x06, 0x5C, 0xE9, 0x25,
+0x49, 0x97, 0xC1, 0x33, 0x8C, 0x42, 0xCC, 0xE7, 0xC4, 0x3A, 0x79, 0xE8, 0x39, 0xCF, 0x23, 0xB0, 0xBA, 0x2F, 0x76, 0x7E, 0xEA,
+0x93, 0xBD, 0x9D, 0x9D, 0xF4, 0x16, 0xCC, 0x4C, 0xA8, 0x9E, 0x72, 0xB9, 0xBF, 0x43, 0x68, 0x6E, 0xD4, 0x01, 0x49, 0xC1, 0x30,
+0x2E, 0xA7, 0xF0, 0xBE, 0x0B, 0xF3, 0x07, 0xA5, 0x90, 0x42, 0x51, 0x84, 0xE8, 0xCA, 0x66, 0x14, 0xE2, 0x10, 0x64, 0xC9, 0x96,
+0xC9, 0x00, 0xAD, 0x83, 0x68, 0x81, 0x45, 0xA9, 0xE6, 0x09, 0xDA, 0x62, 0xD8, 0xAD, 0x09, 0x16, 0x33, 0x6E, 0x18, 0x89, 0x83,
+0x89, 0x60, 0xB7, 0xE4, 0x4B, 0x9E, 0x19, 0x3E, 0x59, 0x06, 0x45, 0x86, 0x04, 0x63, 0x66, 0x16, 0x8C, 0x49, 0x42, 0xC1, 0x77,
+0x32, 0x80, 0x85, 0x09, 0x04, 0x14, 0x26, 0x40, 0x0E, 0x1C, 0xE4, 0xA9, 0xCD, 0xBF, 0xBD, 0x52, 0x4B, 0x32, 0x0E, 0x76, 0xBC,
+0x11, 0xA2, 0xBA, 0x06, 0x39, 0x38, 0x65, 0x0F, 0x5D, 0x92, 0x1B, 0xA3, 0x64, 0xE5, 0x14, 0x23, 0x09, 0xFC, 0x05, 0x36, 0x20,
+0xF6, 0x29, 0x4B, 0xC8, 0x64, 0x01, 0x9E, 0x12, 0xB1, 0x47, 0x94, 0x8C, 0x04, 0x8F, 0x6E, 0x86, 0x9E, 0x4A, 0x99, 0xBC, 0x50,
+0x31, 0x15, 0xDD, 0x9E, 0x37, 0xFA, 0x99, 0xBC, 0x8C, 0x63, 0x2B, 0xF3, 0x70, 0xE0, 0xA4, 0xA1, 0xC7, 0xE1, 0x8C, 0x5B, 0x4E,
+0x6A, 0x03, 0x90, 0xA2, 0x31, 0x9D, 0xC3, 0x5C, 0x94, 0x53, 0x02, 0xE2, 0x19, 0x4C, 0xB5, 0xCA, 0x53, 0x52, 0x3F, 0xC2, 0xB1,
+0xF3, 0x6C, 0xE6, 0x11, 0x1E, 0x0F, 0x3D, 0x4C, 0x08, 0x0C, 0xBA, 0x67, 0x73, 0x71, 0x73, 0x9B, 0x3D, 0xBF, 0x73, 0x5A, 0xE1,
+0x03, 0xFB, 0x9C, 0x00, 0x1A, 0xE3, 0x22, 0xAE, 0xAF, 0x15, 0xC5, 0x18, 0x11, 0x14, 0x95, 0x85, 0x61, 0x78, 0x38, 0x10, 0x1C,
+0xED, 0xCC, 0xC5, 0xB7, 0xAD, 0x9D, 0x40, 0xD6, 0x36, 0xFC, 0xD9, 0x98, 0x2E, 0x82, 0x32, 0xA5, 0x69, 0xF0, 0xC4, 0xFB, 0xA6,
+0x17, 0xB3, 0x3C, 0x8A, 0x58, 0x96, 0x11, 0x5C, 0x8B, 0x86, 0x2E, 0x82, 0xDD, 0x86, 0x13, 0x33, 0x3A, 0x67, 0x57, 0xEA, 0x92,
+0xE9, 0x39, 0x20, 0xB9, 0xE7, 0x0E, 0x8A, 0x63, 0x47, 0x06, 0xAB, 0xE7, 0x25, 0x3C, 0x91, 0x63, 0x0B, 0xEF, 0xAC, 0xD3, 0x70,
+0x2C, 0x2D, 0xEA, 0xD0, 0xC0, 0xDB, 0xD0, 0xC6, 0x00, 0x1B, 0x90, 0x52, 0x4B, 0x6F, 0x74, 0x2C, 0x54, 0xC6, 0x0E, 0x07, 0xB4,
+0x7D, 0xB4, 0x52, 0xC1, 0xA5, 0xA1, 0x26, 0xCF, 0xAA, 0xFD, 0x13, 0xA5, 0x93, 0x00, 0xFD, 0x45, 0x12, 0x13, 0x3C, 0x01, 0xBC,
+0x49, 0x25, 0x59, 0xD3, 0x99, 0xDE, 0xA8, 0x94, 0xB2, 0xF5, 0xA7, 0xE1, 0x96, 0x04, 0x31, 0x41, 0x26, 0x80, 0xE6, 0x3A, 0x6E,
+0x16, 0x27, 0x1E, 0x31, 0x74, 0x0C, 0xA5, 0x88, 0xDD, 0x0E, 0x3D, 0x74, 0x02, 0xD5, 0x9C, 0x06, 0x50, 0xDB, 0x99, 0x10, 0x2C,
+0x1E, 0x2F, 0x1B, 0x2B, 0x5F, 0xE3, 0x60, 0xB1, 0x60, 0xC6, 0xE3, 0x98, 0xC9, 0xA1, 0x67, 0x74, 0xCE, 0xBC, 0x2D, 0x9A, 0x02,
+0xA8, 0x67, 0x42, 0x4D, 0x49, 0xF3, 0xA5, 0xB0, 0x99, 0x01, 0x5C, 0x8B, 0x24, 0xAE, 0x4B, 0x28, 0x81, 0x24, 0x3E, 0x20, 0xC5,
+0xF3, 0x33, 0xCC, 0xE5, 0x2A, 0x95, 0x49, 0x91, 0xCB, 0x5B, 0xD5, 0x14, 0x39, 0xB7, 0x75, 0xCE, 0xE5, 0xAE, 0x4D, 0xB7, 0xDD,
+0xF6, 0x8C, 0x6D, 0x1E, 0x64, 0x92, 0x05, 0x7B, 0x6B, 0xCE, 0x70, 0x47, 0x1C, 0x41, 0xD6, 0x0C, 0x6C, 0x4A, 0xBA, 0xD4, 0x99,
+0xED, 0xD6, 0x38, 0x32, 0xCB, 0x14, 0x0C, 0x77, 0x2F, 0xCD, 0x38, 0x07, 0x11, 0x06, 0xD6, 0x23, 0x65, 0x81, 0x85, 0xFE, 0x92,
+0xF0, 0x4A, 0x63, 0xD3, 0xAD, 0x43, 0xCF, 0x62, 0x00, 0x43, 0x77, 0x4F, 0x4E, 0x3A, 0x43, 0x31, 0x29, 0xF1, 0x00, 0x08, 0x84,
+0xCA, 0xD2, 0x33, 0x78, 0xC1, 0x41, 0x2E, 0xD3, 0xDC, 0x14, 0x06, 0xB9, 0x78, 0xB8, 0xD3, 0x40, 0x2F, 0x31, 0xE7, 0x18, 0x50,
+0x8F, 0xCC, 0xA9, 0xC8, 0x99, 0x8D, 0xEB, 0x9A, 0xF4, 0xB1, 0xCB, 0x1B, 0x6B, 0x10, 0x01, 0xE9, 0x4E, 0xF2, 0x1B, 0xE8, 0xF9,
+0x6D, 0xF0, 0x09, 0xE7, 0x10, 0xF4, 0x03, 0xC1, 0x59, 0xC8, 0x4D, 0x1C, 0x59, 0xD3, 0x8E, 0x88, 0x6C, 0xEF, 0xC3, 0xB8, 0x68,
+0x25, 0x6A, 0xF7, 0x3A, 0xD1, 0x9A, 0xFD, 0x37, 0xE7, 0x1A, 0x33, 0x5F, 0xD0, 0x88, 0xCD, 0xA0, 0x74, 0x31, 0x50, 0xCD, 0xC2,
+0x69, 0x48, 0x8E, 0x8E, 0x8E, 0xC9, 0x1B, 0xB6, 0xC8, 0xBC, 0xED, 0xEE, 0xD8, 0x6E, 0xF0, 0x7B, 0x2D, 0xB6, 0xDA, 0x8B, 0xA5,
+0xF4, 0xFD, 0x9F, 0xAF, 0xB7, 0x5B, 0x9B, 0xAF, 0x6F, 0xDA, 0x30, 0xD6, 0x8A, 0xDD, 0x6E, 0x6B, 0x49, 0x32, 0xA0, 0x4E, 0x35,
+0x2C, 0x1D, 0xA0, 0x9C, 0x7B, 0xE2, 0xE8, 0xCA, 0x95, 0xF7, 0x30, 0x8C, 0xD6, 0xCA, 0xC5, 0xB7, 0xE0, 0x34, 0x3A, 0xA6, 0x32,
+0x62, 0xA2, 0x81, 0xA0, 0xEF, 0x91, 0x5B, 0xB4, 0xB0, 0xB5, 0x42, 0x87, 0xB1, 0xC5, 0x66, 0x61, 0xCB, 0xDA, 0xF6, 0x5E, 0xB1,
+0xF5, 0xC7, 0xB5, 0x70, 0x92, 0xE9, 0xE8, 0xEF, 0x50, 0xAF, 0x2F, 0x4D, 0xE6, 0x35, 0xCE, 0x65, 0x2C, 0x98, 0x25, 0x60, 0x5F,
+0xA0, 0xFA, 0x71, 0xC8, 0xE9, 0xA9, 0xE6, 0x06, 0x8A, 0x0F, 0x34, 0xE7, 0xA7, 0xCF, 0x9F, 0x05, 0x67, 0x7F, 0x2C, 0xD5, 0x29,
+0xE0, 0xFE, 0xF8, 0x9F, 0x62, 0x39, 0x5F, 0xDC, 0xBE, 0xF8, 0xFD, 0xCB, 0xCE, 0x8B, 0x57, 0xD1, 0x47, 0xF9, 0x54, 0xCE, 0x7F,
+0x5D, 0xF0, 0x77, 0x1F, 0xC4, 0x5F, 0xBF, 0x7E, 0xFC, 0xB8, 0x78, 0xA5, 0xFF, 0xFD, 0x21, 0xFA, 0xCF, 0x1F, 0x83, 0xA3, 0x44,
+0x7E, 0x38, 0xB9, 0xBD, 0xF8, 0xF9, 0xE4, 0x49, 0x16, 0xFD, 0x6B, 0x7C, 0x7E, 0x75, 0x7B, 0x0E, 0xAE, 0xD0, 0x2A, 0xCB, 0x94,
+0xE6, 0x50, 0x51, 0x86, 0x1E, 0x85, 0x3A, 0xBA, 0x4C, 0x14, 0x54, 0xDA, 0x51, 0x83, 0x8A, 0x94, 0x0F, 0x82, 0x19, 0xD7, 0x8B,
+0x80, 0x5E, 0x7D, 0xFA, 0x7C, 0x50, 0xBD, 0xDB, 0x0A, 0x71, 0x0E, 0x0C, 0x0C, 0x7D, 0x5F, 0x92, 0xB1, 0xB2, 0xFF, 0xC1, 0xDA,
+0x8A, 0x82, 0x4D, 0x59, 0xC9, 0xBE, 0x8E, 0x96, 0xE7, 0x71, 0xD7, 0x2F, 0xD7, 0xD4, 0x14, 0x0E, 0xC9, 0xF5, 0xB9, 0x85, 0xE4,
+0x03, 0xDB, 0x30, 0x6D, 0xEA, 0x6D, 0x80, 0xDC, 0xEF, 0xDA, 0x05, 0xF8, 0xAD, 0x37, 0xD9, 0xDA, 0xFE, 0xE0, 0xB6, 0xAA, 0x68,
+0xD4, 0x1B, 0xEB, 0x86, 0x74, 0xDF, 0xC6, 0x7A, 0x15, 0xEE, 0xAC, 0x96, 0x6D, 0x12, 0xC2, 0x93, 0xB7, 0x17, 0xC7, 0xAE, 0x5A,
+0x63, 0xC3, 0x67, 0x31, 0x50, 0xC3, 0x92, 0x1F, 0x6F, 0x78, 0x17, 0x14, 0x4A, 0xB6, 0x20, 0x35, 0x42, 0x1C, 0xA5, 0xB9, 0xF7,
+0xD0, 0x76, 0x89, 0xDF, 0x03, 0x23, 0x04, 0xC8, 0xB7, 0x44, 0xAA, 0x6B, 0x19, 0x27, 0x10, 0xD7, 0x6C, 0x29, 0x23, 0x32, 0xC9,
+0x65, 0x64, 0x38, 0x24, 0x49, 0x63, 0x1E, 0x94, 0x1B, 0x20, 0x75, 0x25, 0x45, 0x87, 0x3B, 0x47, 0x0A, 0x0F, 0xA8, 0x9F, 0x2E,
+0x28, 0xC7, 0xF0, 0x02, 0xBF, 0xED, 0xFA, 0x3A, 0xCB, 0x00, 0x99, 0x4A, 0xE2, 0x11, 0xF9, 0x84, 0x74, 0x1F, 0x95, 0x0B, 0x43,
+0x75, 0xD3, 0x03, 0x12, 0x0D, 0x04, 0xC2, 0x1A, 0x7C, 0xAA, 0xB5, 0x82, 0xA3, 0xBE, 0x01, 0x06, 0xA8, 0xF4, 0x0D, 0x61, 0xF8,
+0x8A, 0x7B, 0x4A, 0x38, 0x39, 0xA1, 0xD5, 0x66, 0x14, 0x69, 0x6D, 0x24, 0x11, 0xF2, 0x68, 0xD2, 0xB5, 0x1B, 0x7A, 0x85, 0x39,
+0x0A, 0x52, 0x82, 0x39, 0x81, 0x56, 0xAE, 0x33, 0xA6, 0x62, 0x4A, 0xFB, 0xE0, 0x40, 0xB7, 0xDE, 0xC9, 0x47, 0x4F, 0x87, 0x5C,
+0x82, 0xAF, 0x7F, 0xBF, 0xBA, 0x78, 0x0D, 0xCA, 0xAE, 0x1F, 0x22, 0x64, 0x31, 0x52, 0x18, 0xDD, 0xE6, 0x13, 0x67, 0x94, 0x43,
+0xDF, 0x27, 0x46, 0x59, 0x2F, 0x15, 0x79, 0x30, 0xD1, 0x2A, 0x21, 0xEB, 0xD7, 0x32, 0xC7, 0xD3, 0xAE, 0x0F, 0x3A, 0x9A, 0xC1,
+0xA8, 0x84, 0x53, 0xC0, 0x13, 0x20, 0x48, 0xD7, 0xAE, 0xEF, 0x54, 0x2E, 0x6F, 0xCD, 0xC0, 0xF9, 0xD0, 0x89, 0x8E, 0xEF, 0x09,
+0x26, 0xA7, 0x66, 0x46, 0x86, 0xC3, 0x21, 0xD9, 0xE9, 0x15, 0x58, 0xF8, 0xF1, 0xA3, 0x6C, 0x70, 0x4B, 0x6F, 0xF4, 0x46, 0x15,
+0xD6, 0xD3, 0x39, 0x9C, 0x09, 0x2F, 0xAB, 0xA1, 0xA5, 0xC3, 0x40, 0xA1, 0x1E, 0x6D, 0x9A, 0xBE, 0x55, 0xAD, 0xEF, 0x17, 0xA1,
+0x0B, 0xA1, 0xBE, 0x9F, 0x52, 0x40, 0x82, 0x35, 0xBA, 0xEF, 0x72, 0xAA, 0x75, 0xB9, 0x03, 0xFB, 0x1A, 0x49, 0x12, 0x69, 0x46,
+0x0D, 0x2B, 0x20, 0xDA, 0x85, 0x4B, 0x14, 0x82, 0x40, 0xF0, 0xD0, 0x1E, 0x01, 0x73, 0x1A, 0x85, 0xAF, 0x1F, 0xE4, 0x87, 0xAF,
+0x13, 0xBE, 0x95, 0xD9, 0xF2, 0x53, 0xAB, 0xF7, 0xD4, 0x97, 0x55, 0xEB, 0x17, 0xE0, 0x6A, 0x12, 0x70, 0xB6, 0xCE, 0xD7, 0x8A,
+0x3B, 0xC4, 0xFA, 0x9A, 0xC7, 0x77, 0xB8, 0x3D, 0xC4, 0x4A, 0xB5, 0xAA, 0x4A, 0x7E, 0x42, 0x45, 0x75, 0x35, 0x68, 0xF0, 0xF8,
+0xD6, 0x56, 0x38, 0xC7, 0x58, 0xA8, 0xE8, 0xA6, 0x12, 0x01, 0x55, 0x0B, 0x24, 0xD8, 0xBD, 0x5B, 0x5B, 0x24, 0xB6, 0x26, 0x77,
+0xC5, 0xA8, 0x9E, 0xF0, 0x36, 0x46, 0xA0, 0x25, 0x43, 0x2F, 0xB3, 0xEF, 0xDF, 0xDB, 0x39, 0x55, 0x6E, 0x04, 0x97, 0xAC, 0xD9,
+0x41, 0xB7, 0xDC, 0x8C, 0x1E, 0xDF, 0xD9, 0xF8, 0xAD, 0x7A, 0xEE, 0xE2, 0xF5, 0x83, 0x5D, 0xB4, 0xD4, 0xE1, 0xB2, 0xA7, 0xA1,
+0x00, 0xDA, 0x1E, 0x33, 0xAE, 0x9D, 0x36, 0x34, 0x9C, 0xB4, 0xDA, 0xB4, 0x3B, 0xFD, 0x75, 0x23, 0x63, 0xE1, 0x7A, 0x0C, 0xB9,
+0x71, 0x3C, 0xE3, 0x22, 0xEE, 0x0A, 0x5E, 0x14, 0xAC, 0x46, 0xE6, 0xD4, 0x66, 0x5B, 0x91, 0x10, 0xE4, 0x60, 0xB7, 0xCC, 0x20,
+0x37, 0x32, 0x2A, 0x46, 0x1E, 0xAE, 0x8E, 0x96, 0xDE, 0xFA, 0x3D, 0x07, 0x99, 0x2B, 0xBC, 0x57, 0x00, 0x0C, 0x2B, 0xA2, 0x0B,
+0x70, 0xAA, 0xFA, 0x52, 0x68, 0x99, 0x23, 0x4C, 0x5B, 0xF8, 0x7F, 0xB2, 0x8A, 0x3E, 0x5B, 0x30, 0x1C, 0x74, 0xCA, 0x2E, 0xB4,
+0x7D, 0x0D, 0xCC, 0x42, 0x8D, 0xAC, 0x7A, 0x4E, 0xB5, 0xC8, 0x0E, 0x61, 0xA9, 0x63, 0x02, 0xEA, 0xEB, 0xDF, 0xB6, 0x16, 0x33,
+0x18, 0x68, 0x62, 0x69, 0xF0, 0xBD, 0x52, 0x90, 0x28, 0xC3, 0x7E, 0xA8, 0x58, 0xCC, 0x60, 0x3D, 0xDA, 0x62, 0x55, 0xB0, 0x5B,
+0x26, 0x7F, 0xAB, 0xFF, 0x84, 0xD9, 0x4C, 0x2D, 0xD6, 0x4A, 0x58, 0xCD, 0x95, 0x0A, 0xEF, 0x3F, 0x5A, 0xF7, 0xD6, 0xD7, 0xAF,
+0xE4, 0x51, 0xDB, 0x39, 0xB8, 0x94, 0x0A, 0xA6, 0x4D, 0xD7, 0x7B, 0x27, 0x18, 0x85, 0x83, 0x4F, 0x38, 0x64, 0x10, 0x07, 0x24,
+0x29, 0x28, 0x7A, 0x13, 0xCE, 0x04, 0x14, 0x17, 0xAF, 0xD7, 0xAC, 0x44, 0x05, 0x43, 0x60, 0x0B, 0x4B, 0xBA, 0x87, 0x20, 0x01,
+0xF5, 0xEC, 0x93, 0x35, 0x6D, 0x7D, 0x8C, 0xC3, 0x3E, 0x69, 0xEB, 0xEB, 0xAC, 0xAA, 0xAE, 0x1F, 0x23, 0x54, 0x52, 0xFC, 0xB4,
+0x77, 0x0E, 0x25, 0x68, 0xFD, 0xE8, 0x45, 0x1F, 0xC3, 0x55, 0x25, 0x7C, 0x8A, 0x28, 0xC6, 0xB7, 0x9F, 0x5D, 0xF7, 0x45, 0xF5,
+0x8D, 0x78, 0xB9, 0x3A, 0x98, 0xC2, 0xC5, 0xBF, 0x5B, 0x4C, 0xF6, 0xB6, 0x94, 0xFC, 0x4D, 0x4F, 0xC2, 0xCD, 0x84, 0xAD, 0x79,
+0xB2, 0x91, 0x28, 0x45, 0x21, 0x75, 0x0E, 0x05, 0xCB, 0x27, 0x5C, 0x27, 0xDD, 0xEB, 0x97, 0x9A, 0x91, 0xA5, 0xCA, 0x49, 0x96,
+0x17, 0x0F, 0x0B, 0x2A, 0x0D, 0xF6, 0x24, 0xB7, 0x93, 0x78, 0xAE, 0xB2, 0xB4, 0x70, 0xB9, 0xF2, 0x7E, 0xBB, 0xEE, 0x55, 0xE7,
+0x08, 0xB3, 0x14, 0x92, 0x92, 0x39, 0xF9, 0x7D, 0xB2, 0x6B, 0x3D, 0xBC, 0xD6, 0x9C, 0x56, 0xEB, 0xBC, 0xA0, 0x7D, 0xED, 0xAF,
+0x4A, 0x3B, 0x26, 0xFE, 0x03, 0x04, 0xE8, 0xC8, 0x58, 0x6A, 0x00, 0x2B, 0x43, 0x60, 0xB7, 0xD8, 0x6B, 0x30, 0x72, 0x78, 0x39,
+0x76, 0x83, 0x2D, 0x08, 0x03, 0xD1, 0x86, 0x26, 0x0E, 0x17, 0x08, 0xC0, 0x6F, 0xCD, 0x9E, 0x5C, 0x6F, 0x70, 0x25, 0x21, 0x06,
+0xB1, 0xEE, 0xB2, 0x8F, 0x52, 0x9B, 0x04, 0x05, 0x2A, 0xEB, 0xB8, 0x20, 0x47, 0x47, 0xF0, 0xD8, 0xED, 0x7C, 0x7A, 0x75, 0xF9,
+0xF6, 0x4D, 0x08, 0x24, 0x09, 0x44, 0x42, 0xD7, 0x70, 0x4D, 0xB5, 0x4F, 0x64, 0x2E, 0x44, 0x9F, 0x3C, 0xE9, 0x7D, 0xEE, 0x77,
+0xEE, 0x6C, 0x39, 0xDB, 0x27, 0x3E, 0x7E, 0x88, 0xE3, 0x50, 0xA1, 0xE1, 0xA8, 0x03, 0x4B, 0x66, 0xC8, 0xAA, 0x53, 0x91, 0x3D,
+0xBC, 0xC0, 0x9C, 0xC0, 0x65, 0xA3, 0x10, 0x7E, 0x56, 0xBC, 0xDA, 0x98, 0x16, 0xCF, 0x45, 0xA9, 0x82, 0xDC, 0x02, 0x8A, 0x00,
+0xE4, 0x03, 0x6D, 0xE9, 0x93, 0x16, 0x37, 0xBA, 0x9F, 0x45, 0x0D, 0xF2, 0x14, 0x49, 0x05, 0x6C, 0xBD, 0xEB, 0x24, 0xCC, 0xCC,
+0x54, 0x0C, 0x56, 0xBD, 0x7B, 0x7B, 0x79, 0xE5, 0xF7, 0x3B, 0x78, 0xD3, 0xDD, 0xAF, 0xAC, 0xB0, 0x45, 0x10, 0x21, 0xD1, 0xE2,
+0x59, 0x77, 0x1D, 0x4C, 0x4B, 0xE7, 0xAE, 0xAE, 0x7F, 0xE9, 0x3E, 0xE1, 0x4C, 0xE0, 0xA4, 0x4B, 0x1B, 0x3A, 0xCB, 0x5A, 0xCC,
+0x8C, 0x6D, 0x30, 0x15, 0xBF, 0xEF, 0xDB, 0x0E, 0x55, 0x7C, 0xF4, 0xF1, 0x7B, 0x0D, 0x58, 0x37, 0x25, 0xD6, 0xDC, 0x07, 0xC5,
+0x91, 0x3C, 0x85, 0xDB, 0x17, 0xBC, 0xE3, 0x65, 0xD2, 0x31, 0x89, 0x07, 0xE4, 0x2F, 0xA8, 0x96, 0x10, 0x06, 0xDF, 0xA1, 0x6B,
+0x83, 0xD3, 0x35, 0x55, 0xB5, 0x18, 0x62, 0x48, 0xD6, 0x34, 0xA3, 0x92, 0xFF, 0x4B, 0x3B, 0x54, 0x16, 0x49, 0xD1, 0x2F, 0x77,
+0xEB, 0x98, 0x9C, 0x50, 0x38, 0xF7, 0x76, 0x50, 0x56, 0x1F, 0xB5, 0x7C, 0x97, 0x1D, 0x75, 0x5E, 0xD4, 0x86, 0x27, 0xE0, 0x3F,
+0x3A, 0x65, 0x7D, 0xDB, 0xF2, 0x8F, 0x11, 0xB1, 0xF6, 0x64, 0x35, 0x8A, 0x9B, 0x42, 0x8B, 0xC5, 0x9B, 0x28, 0x2F, 0x18, 0xD0,
+0xF5, 0xDA, 0xF7, 0xAD, 0xC7, 0x77, 0x95, 0xD4, 0x15, 0xB4, 0x48, 0xA8, 0xDA, 0x57, 0x3C, 0x61, 0xD0, 0x6F, 0xCB, 0x0F, 0xE9,
+0xE4, 0x3B, 0xD2, 0x85, 0xAC, 0xFA, 0xF8, 0x01, 0x69, 0xC7, 0x06, 0xA1, 0xF9, 0xA1, 0x19, 0x11, 0x66, 0x3F, 0x38, 0xDB, 0xFF,
+0x89, 0xFC, 0x0F, 0x04, 0x90, 0xBC, 0x06, 0x24, 0x19, 0x00, 0x00
 };
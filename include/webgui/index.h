@@ -1,877 +1,816 @@
+// Generated from web/index.htm (6cacff5780c30596) - do not edit
 #include <Arduino.h>
 static const uint8_t indexhtm[] = {
-0x1F, 0x8B, 0x08, 0x00, 0xD0, 0x6D, 0xF8, 0x69, 0x02, 0xFF, 0xED, 0x7D, 0xEB, 0x76, 0xDB, 0x46, 0xD2, 0xE0, 0xFF, 0x3D, 0x67,
-0xDF, 0xA1, 0x8D, 0x78, 0x42, 0x72, 0x42, 0x82, 0xA4, 0x64, 0xF9, 0x22, 0x99, 0xF2, 0xD8, 0xB2, 0x9D, 0x78, 0xE2, 0xDB, 0x67,
-0x29, 0xF1, 0x97, 0xD8, 0xFE, 0xC6, 0x20, 0x01, 0x8A, 0xB0, 0x40, 0x80, 0x01, 0x40, 0x5D, 0xE2, 0xD1, 0x39, 0xFB, 0x2C, 0xFB,
-0x68, 0xFB, 0x24, 0x5B, 0xD5, 0x17, 0xA0, 0x6F, 0x00, 0x41, 0x49, 0x76, 0xEC, 0x4C, 0x72, 0x66, 0x2C, 0x02, 0xE8, 0xAE, 0xEE,
-0xAE, 0xAE, 0xAE, 0xAE, 0xEE, 0xBA, 0xDD, 0xBD, 0xF6, 0xF0, 0xC5, 0xDE, 0xC1, 0x2F, 0x2F, 0x1F, 0x91, 0x59, 0x3E, 0x8F, 0x76,
-0xFF, 0xF7, 0xFF, 0xBA, 0x8B, 0x7F, 0x49, 0xE4, 0xC5, 0x87, 0x23, 0x27, 0x88, 0x1D, 0xFA, 0x26, 0xF0, 0x7C, 0xF8, 0x4B, 0xC8,
-0xDD, 0x28, 0x8C, 0x8F, 0xC8, 0x2C, 0x0D, 0xA6, 0x23, 0x67, 0x96, 0xE7, 0x8B, 0x6C, 0xBB, 0xDF, 0x9F, 0xF8, 0xB1, 0xFB, 0x21,
-0xF3, 0x83, 0x28, 0x3C, 0x4E, 0xDD, 0x38, 0xC8, 0xFB, 0xF1, 0x62, 0xDE, 0x1F, 0x27, 0x49, 0x9E, 0xE5, 0xA9, 0xB7, 0xF8, 0xC7,
-0x96, 0xBB, 0xE9, 0xDE, 0xEE, 0xFB, 0x61, 0x96, 0xF7, 0x27, 0x59, 0x56, 0x7E, 0x70, 0xE7, 0x61, 0xEC, 0xC2, 0x1B, 0x87, 0xA4,
-0x41, 0x34, 0x72, 0xB2, 0xFC, 0x2C, 0x0A, 0xB2, 0x59, 0x10, 0xE4, 0x0E, 0x09, 0xE3, 0x3C, 0x38, 0x4C, 0xC3, 0xFC, 0x0C, 0x5E,
-0xCF, 0xBC, 0xCD, 0xDB, 0x37, 0x7A, 0xD9, 0xAB, 0x27, 0xD1, 0x8D, 0xA3, 0xD3, 0x27, 0x4F, 0x1F, 0x1F, 0xFF, 0x72, 0xE3, 0xD6,
-0x3F, 0x87, 0x37, 0x27, 0xE9, 0x9D, 0x5F, 0x4F, 0x1E, 0x0C, 0x6E, 0x1D, 0xBF, 0xBC, 0xF1, 0xCF, 0xDB, 0xDF, 0x3D, 0xFD, 0xE1,
-0xD6, 0x6F, 0x3F, 0xFE, 0x57, 0xBC, 0xFC, 0xED, 0x68, 0xF9, 0xE4, 0xFE, 0xF1, 0xF3, 0xD7, 0x4F, 0x7F, 0x0F, 0x9E, 0xDF, 0xCE,
-0x1F, 0x6D, 0xFD, 0xF2, 0x60, 0xF9, 0xE1, 0xD7, 0xDF, 0xFE, 0xF9, 0xF4, 0x81, 0x43, 0x26, 0x69, 0x92, 0x65, 0x49, 0x1A, 0x1E,
-0x86, 0xF1, 0xC8, 0xF1, 0xE2, 0x24, 0x3E, 0x9B, 0x27, 0xCB, 0xCC, 0x91, 0x46, 0x65, 0x74, 0x63, 0x9D, 0x61, 0xF6, 0xC2, 0x49,
-0x12, 0x67, 0xFF, 0x18, 0xBA, 0xC3, 0xA1, 0xBB, 0xD9, 0x9F, 0x26, 0x71, 0xAE, 0x7F, 0x2B, 0xC6, 0xCB, 0x9A, 0xCC, 0x26, 0x69,
-0xB8, 0xC8, 0x49, 0x96, 0x4E, 0xCA, 0x26, 0xBC, 0x0F, 0xDE, 0xA9, 0x7B, 0x98, 0x24, 0x87, 0x51, 0xE0, 0x2D, 0xC2, 0xCC, 0x9D,
-0x24, 0x73, 0xFA, 0xAE, 0x1F, 0x85, 0xE3, 0xAC, 0xFF, 0xE1, 0xB7, 0x65, 0x90, 0x9E, 0xF5, 0x37, 0xDD, 0x5B, 0xEE, 0x90, 0x3F,
-0x50, 0x98, 0x1F, 0x00, 0xE4, 0xDD, 0x3E, 0x83, 0x57, 0x0D, 0x1B, 0xBA, 0xFF, 0x01, 0x20, 0x46, 0xC9, 0xD2, 0x9F, 0x46, 0x5E,
-0x1A, 0x68, 0xC0, 0xCB, 0xCE, 0x6E, 0xF6, 0xF2, 0xB3, 0x45, 0xE0, 0xE1, 0x94, 0xF7, 0x6F, 0xB8, 0x03, 0x77, 0xA3, 0xFC, 0x26,
-0x7D, 0xAA, 0x68, 0x79, 0x1E, 0xE4, 0x1E, 0x99, 0xCC, 0xBC, 0x34, 0x0B, 0xF2, 0x91, 0xF3, 0xD3, 0xC1, 0xE3, 0xDE, 0x6D, 0x47,
-0xFA, 0x12, 0x7B, 0xF3, 0x60, 0xE4, 0x1C, 0x87, 0xC1, 0xC9, 0x22, 0x49, 0x01, 0xC3, 0x80, 0x97, 0x3C, 0x88, 0xA1, 0xE4, 0x32,
-0x0B, 0xD2, 0x5E, 0x36, 0xF1, 0x22, 0x6F, 0x1C, 0x05, 0xA3, 0x38, 0xE9, 0x02, 0x0D, 0x84, 0x79, 0xE8, 0x45, 0xF4, 0x65, 0x30,
-0x1A, 0x76, 0xC9, 0xDC, 0x3B, 0x0D, 0xE7, 0xCB, 0xB9, 0xF4, 0x02, 0x8A, 0x28, 0x2F, 0x4E, 0x42, 0x3F, 0x9F, 0x8D, 0xFC, 0xE0,
-0x38, 0x9C, 0x04, 0x3D, 0xFA, 0x60, 0xB6, 0xED, 0x2D, 0x16, 0x51, 0xD0, 0x9B, 0x27, 0xE3, 0x10, 0xFE, 0x9C, 0x04, 0xE3, 0x1E,
-0xBC, 0xE8, 0x4D, 0xBC, 0x05, 0xB6, 0x2B, 0xF5, 0xE7, 0x2C, 0xC8, 0x1A, 0xD6, 0xCD, 0x72, 0x2F, 0x5F, 0x66, 0xBD, 0xB1, 0x07,
-0xFD, 0x47, 0xDA, 0x91, 0x80, 0xF8, 0xC1, 0xD4, 0x5B, 0x46, 0xB9, 0x41, 0x63, 0x0C, 0x4E, 0x9E, 0x2C, 0x27, 0x33, 0x4A, 0x1A,
-0x82, 0xD2, 0xA6, 0xDE, 0x31, 0x3E, 0xBA, 0x8B, 0xF8, 0xD0, 0xA8, 0x53, 0x55, 0x8E, 0xE0, 0x8C, 0xC0, 0xE7, 0xB9, 0x77, 0x18,
-0xF4, 0xCB, 0x8A, 0x79, 0x98, 0x47, 0xC1, 0xEE, 0xC3, 0x60, 0xE1, 0xA5, 0xF9, 0x32, 0x0D, 0x32, 0xF2, 0x20, 0xF1, 0x52, 0xFF,
-0x6E, 0x9F, 0xBD, 0x97, 0x88, 0x84, 0xFE, 0x26, 0xA4, 0xDD, 0xEE, 0x90, 0xD1, 0x2E, 0xF9, 0xC8, 0x9E, 0x08, 0x8E, 0x21, 0xCB,
-0x49, 0x3E, 0x0B, 0xE6, 0xC1, 0x33, 0x2F, 0x9F, 0xCC, 0x82, 0x94, 0x8C, 0x00, 0xBF, 0xB1, 0x9F, 0x9C, 0xB8, 0x73, 0x7C, 0xF1,
-0x2C, 0xF0, 0x43, 0xAF, 0xDD, 0x6A, 0x2F, 0xA0, 0x47, 0x41, 0x9A, 0xF5, 0x26, 0x49, 0x94, 0xE0, 0x0C, 0x62, 0x8D, 0x6D, 0xE2,
-0x7B, 0xE9, 0x51, 0xA7, 0xD5, 0xD9, 0x51, 0xC1, 0xE1, 0xB8, 0xCF, 0x0E, 0xB0, 0x04, 0x00, 0xE3, 0x0D, 0x12, 0x3F, 0x99, 0x2C,
-0xE7, 0x80, 0x2E, 0x57, 0xFC, 0x78, 0x14, 0x05, 0xF4, 0x19, 0x28, 0xE8, 0x7E, 0x9E, 0xA7, 0xE1, 0x78, 0x99, 0x07, 0xED, 0x96,
-0xEF, 0xE5, 0x5E, 0x6F, 0x9C, 0xF5, 0x68, 0x97, 0x5A, 0x5D, 0xA5, 0x6B, 0xAC, 0x47, 0x30, 0xC8, 0x7B, 0xA4, 0x85, 0x2D, 0xB7,
-0xC8, 0x36, 0x69, 0x45, 0xE1, 0xE1, 0x2C, 0x87, 0x2E, 0x90, 0xF3, 0xA2, 0x17, 0x65, 0xFB, 0xED, 0xB2, 0x6B, 0x0A, 0x20, 0xCF,
-0xF7, 0x1F, 0x1D, 0x43, 0xE3, 0x4F, 0x81, 0x5B, 0x05, 0x71, 0x90, 0xB6, 0x5B, 0x40, 0xCB, 0xF1, 0x21, 0x36, 0x58, 0x56, 0x16,
-0x75, 0xCF, 0x3B, 0x1C, 0x8C, 0xB4, 0x04, 0xEE, 0xF6, 0x39, 0xAB, 0xBC, 0x4B, 0x89, 0x81, 0x62, 0x77, 0x3B, 0x85, 0xF5, 0x43,
-0x3E, 0xF6, 0xB0, 0xFB, 0xE3, 0xC4, 0x3F, 0xEB, 0x21, 0x77, 0xE8, 0x65, 0xE1, 0xEF, 0x80, 0xA8, 0x81, 0x7B, 0xFB, 0xD6, 0x56,
-0x1A, 0xCC, 0x77, 0xCE, 0xB1, 0xA4, 0x3B, 0xCE, 0x63, 0x51, 0x30, 0x8F, 0xEB, 0xCB, 0xF5, 0x92, 0x65, 0x0E, 0xE4, 0x11, 0xF4,
-0xB2, 0x00, 0xB0, 0x0B, 0xC3, 0x3E, 0x23, 0x1F, 0xA5, 0x0A, 0xC3, 0xB2, 0xF0, 0x34, 0x49, 0xE7, 0x3D, 0x24, 0xCA, 0x34, 0x89,
-0xBA, 0xFC, 0x31, 0x0B, 0xA2, 0x60, 0x92, 0x2B, 0x35, 0x8E, 0xBD, 0xB4, 0x6D, 0xE9, 0x63, 0x47, 0x40, 0x89, 0x12, 0x2F, 0x0F,
-0xE3, 0x43, 0xF8, 0x92, 0xE4, 0x40, 0x0E, 0x1F, 0x17, 0x49, 0x06, 0x2B, 0x34, 0x89, 0xB7, 0xA7, 0xE1, 0x69, 0xE0, 0xEF, 0x8C,
-0x93, 0x3C, 0x4F, 0xE6, 0xDB, 0x83, 0x9D, 0x28, 0x98, 0xE6, 0xF0, 0x87, 0xAE, 0xBF, 0xED, 0xE1, 0x60, 0xF0, 0xB7, 0x9D, 0xB1,
-0x37, 0x39, 0x3A, 0x4C, 0x93, 0x65, 0xEC, 0x33, 0x32, 0xD9, 0x56, 0x9B, 0x1A, 0x1F, 0x76, 0x76, 0x7E, 0xEF, 0x01, 0x6D, 0x05,
-0xA7, 0x50, 0x7E, 0x73, 0x50, 0xD1, 0xA0, 0xCB, 0xFE, 0x42, 0xC1, 0x18, 0x9B, 0x67, 0xF0, 0x81, 0x07, 0xB4, 0xEF, 0x0C, 0xFE,
-0xD6, 0x25, 0x5B, 0x83, 0xC1, 0xE2, 0xB4, 0xB3, 0x33, 0xF7, 0x52, 0x60, 0xF0, 0xDB, 0x03, 0xE2, 0x2D, 0xF3, 0x64, 0x67, 0x01,
-0xF3, 0x09, 0x10, 0x00, 0xEA, 0xE2, 0x14, 0x3A, 0x98, 0xFA, 0x50, 0x3D, 0x4F, 0x16, 0xDB, 0xC3, 0xC5, 0x29, 0xC9, 0x92, 0x28,
-0xF4, 0xE5, 0x41, 0xD3, 0xAF, 0xB4, 0x7F, 0x9D, 0x9D, 0x3C, 0x38, 0xCD, 0x7B, 0x1E, 0x90, 0x50, 0xBC, 0x3D, 0x01, 0x72, 0x08,
-0x52, 0xDE, 0xA7, 0x30, 0xA6, 0x28, 0x4F, 0x93, 0x13, 0xE8, 0xC0, 0x2C, 0xCC, 0x01, 0xFB, 0x0B, 0x6F, 0x12, 0x6C, 0xC7, 0xC9,
-0x09, 0xB0, 0x47, 0xDE, 0x3A, 0x6D, 0xA2, 0xB7, 0x05, 0x4D, 0x1A, 0x95, 0x80, 0xBD, 0x05, 0x11, 0xF9, 0x08, 0x9B, 0xE1, 0x22,
-0xF2, 0xCE, 0xB6, 0xF9, 0x97, 0x71, 0x94, 0x4C, 0x8E, 0x44, 0xE5, 0x14, 0xE9, 0x76, 0xFB, 0x36, 0xD4, 0xA6, 0x53, 0x70, 0x12,
-0xD0, 0xE7, 0x18, 0x26, 0xCD, 0x8B, 0x4C, 0x80, 0xFA, 0xE4, 0x1A, 0x9F, 0xC4, 0x44, 0x5B, 0x9B, 0x64, 0x38, 0xA4, 0xA8, 0x92,
-0x48, 0x85, 0x76, 0x52, 0x10, 0x0A, 0x2C, 0x8B, 0xC9, 0x51, 0x8F, 0xF7, 0x5B, 0xEE, 0x11, 0x20, 0x9C, 0x57, 0x9A, 0x2C, 0x33,
-0x98, 0xF9, 0x5E, 0xEE, 0x8D, 0x33, 0xF2, 0x31, 0x39, 0x0E, 0x52, 0x98, 0xB9, 0x93, 0xED, 0x59, 0xE8, 0xFB, 0x41, 0x6C, 0x29,
-0xE2, 0xC6, 0xDE, 0x31, 0x2F, 0xCC, 0x91, 0xCE, 0x48, 0x87, 0xB1, 0x4F, 0x18, 0x69, 0x1C, 0x54, 0xD5, 0xA2, 0xEC, 0xF0, 0xA3,
-0x46, 0x43, 0x87, 0xA9, 0x77, 0xD6, 0x83, 0xDE, 0x74, 0xF8, 0x0C, 0x33, 0x08, 0x06, 0xCD, 0x7D, 0x33, 0xD8, 0xBA, 0x75, 0xC7,
-0xBF, 0x51, 0xD0, 0x04, 0x60, 0x98, 0x0C, 0x6F, 0x17, 0x93, 0x64, 0x6D, 0xCB, 0xF5, 0x26, 0x79, 0x78, 0x1C, 0x40, 0x47, 0x2B,
-0x29, 0xB8, 0x58, 0x7D, 0x94, 0x8C, 0x2D, 0xB0, 0xE0, 0xDF, 0x1E, 0xDF, 0x11, 0x60, 0xCD, 0x94, 0x8D, 0xEF, 0x34, 0x85, 0xC9,
-0x91, 0x94, 0x7A, 0x7E, 0xB8, 0xCC, 0x80, 0xB2, 0x87, 0x5B, 0xD8, 0xF3, 0x2D, 0x7B, 0xCF, 0xE9, 0x9C, 0xA5, 0xC8, 0xB2, 0xB6,
-0xB7, 0x71, 0x8B, 0x3A, 0x0A, 0x61, 0x15, 0x03, 0xA1, 0x23, 0x80, 0x65, 0x1C, 0xE3, 0x2E, 0xD7, 0x83, 0x9D, 0x7C, 0x72, 0x54,
-0x37, 0xA6, 0x12, 0xA3, 0xAB, 0x5A, 0x98, 0x27, 0xBF, 0xB3, 0xDF, 0x6B, 0x03, 0xFD, 0xC7, 0x1C, 0x37, 0x10, 0xD2, 0x9E, 0x21,
-0xC1, 0x6C, 0x13, 0x9C, 0xB3, 0x0E, 0xEC, 0x06, 0xA4, 0xFF, 0x77, 0x12, 0xBE, 0xD8, 0x27, 0x59, 0x1E, 0x4E, 0x8E, 0xCE, 0x08,
-0xFD, 0x4A, 0x80, 0xC1, 0x90, 0xBF, 0xF7, 0x19, 0xD3, 0xFD, 0x06, 0xB7, 0x18, 0x7F, 0x19, 0x05, 0x07, 0xDE, 0xB8, 0x82, 0x0F,
-0x6E, 0xB3, 0x5A, 0x66, 0x5F, 0xA0, 0x8F, 0x31, 0xAC, 0xD7, 0x14, 0xA6, 0xE2, 0x5A, 0x38, 0x47, 0x09, 0xC4, 0x8B, 0xF3, 0x1D,
-0x9D, 0x25, 0x01, 0x48, 0xC6, 0x05, 0xA4, 0x32, 0x32, 0x77, 0x50, 0x8B, 0x2A, 0x7C, 0x43, 0xAA, 0x71, 0x5E, 0xD5, 0x5D, 0x1F,
-0xD1, 0x95, 0x56, 0xF6, 0x51, 0x05, 0x7E, 0x78, 0x05, 0x9D, 0x38, 0xC7, 0x5D, 0x49, 0xEC, 0x46, 0x77, 0x91, 0xE3, 0x12, 0xFA,
-0x34, 0x72, 0x38, 0x35, 0xF2, 0xF5, 0xB7, 0x7D, 0x13, 0xB9, 0x24, 0x97, 0x1F, 0xFC, 0xF0, 0x58, 0x94, 0x52, 0x19, 0x6D, 0x2D,
-0x9F, 0x1D, 0x90, 0xAD, 0x02, 0x04, 0x00, 0x41, 0x52, 0x21, 0xA1, 0x0F, 0x02, 0x0B, 0xFC, 0x80, 0xED, 0x1C, 0xB9, 0x79, 0x26,
-0xBE, 0xE2, 0xF7, 0x30, 0x88, 0x7C, 0x78, 0x5F, 0xBC, 0x41, 0x89, 0x27, 0x38, 0x0C, 0x62, 0xBF, 0xE8, 0xA1, 0xD8, 0x63, 0x40,
-0x06, 0xF2, 0x70, 0x29, 0x5A, 0x38, 0x33, 0xF4, 0xAC, 0x37, 0x63, 0x3C, 0xE9, 0x06, 0x36, 0x2F, 0x46, 0x85, 0x5C, 0xF8, 0xB6,
-0xD4, 0x1D, 0xDE, 0x00, 0x8E, 0x0C, 0xFB, 0x14, 0xA7, 0x07, 0x8E, 0x68, 0x46, 0x30, 0x47, 0xA4, 0x42, 0x67, 0xF7, 0x95, 0x17,
-0x46, 0xC4, 0x14, 0x9D, 0xA0, 0xA2, 0x1D, 0x52, 0x3E, 0x8D, 0xAA, 0x40, 0x1D, 0x2C, 0xC7, 0x01, 0xB9, 0x9F, 0xA6, 0xE1, 0xB1,
-0x17, 0xAD, 0x06, 0x34, 0x5E, 0x66, 0x55, 0x80, 0x1E, 0x2C, 0xB3, 0xA6, 0x5D, 0x9A, 0x44, 0x5E, 0x96, 0x41, 0xFD, 0x34, 0x59,
-0x80, 0xB4, 0x16, 0x3B, 0x06, 0x2E, 0x61, 0x19, 0x27, 0x11, 0x08, 0x55, 0x3B, 0x88, 0x21, 0xC4, 0x18, 0xDB, 0x72, 0x06, 0x1A,
-0xA6, 0x00, 0x1C, 0x88, 0x5E, 0x79, 0x12, 0x0B, 0x88, 0x28, 0x9C, 0x08, 0xA8, 0x80, 0xDD, 0xC3, 0x43, 0x14, 0x76, 0x99, 0xF8,
-0xC9, 0x0A, 0x3A, 0x74, 0x14, 0x20, 0xBC, 0x2D, 0x1F, 0xF0, 0xE7, 0x42, 0x6A, 0xA3, 0xA5, 0xE5, 0x4E, 0x79, 0x69, 0xE8, 0xF5,
-0x82, 0xD3, 0x85, 0x07, 0xDB, 0x3E, 0x52, 0x08, 0xE0, 0x07, 0x86, 0xF9, 0xED, 0x37, 0x77, 0x6E, 0xDD, 0xBA, 0xB9, 0x73, 0xB7,
-0xCF, 0x00, 0xEA, 0xFD, 0x59, 0x46, 0xFA, 0xE8, 0x7A, 0xD8, 0x1A, 0x51, 0x9E, 0x7A, 0x40, 0x3F, 0x1C, 0x3E, 0xDD, 0xB6, 0xA2,
-0xC0, 0x1F, 0x9F, 0x29, 0xDD, 0xD2, 0xC0, 0x52, 0x39, 0x7B, 0xF7, 0xAE, 0x67, 0xC0, 0x86, 0xFD, 0x7D, 0x2E, 0x64, 0xEE, 0x6F,
-0x1C, 0x92, 0xC4, 0x93, 0x08, 0xB8, 0x12, 0x1C, 0xA9, 0xA0, 0xD3, 0x51, 0xB0, 0x87, 0x3B, 0xE3, 0x4F, 0x0B, 0x18, 0x62, 0x90,
-0xB5, 0x3B, 0xCE, 0x2E, 0x7D, 0x26, 0x40, 0xEA, 0x84, 0xBF, 0xBC, 0xDB, 0xF7, 0xE0, 0x74, 0x04, 0xA0, 0x2F, 0xD0, 0x5C, 0xFF,
-0x28, 0x38, 0xCB, 0x5C, 0x38, 0x88, 0x3B, 0xBB, 0x8F, 0xFC, 0x30, 0x27, 0xF7, 0x5F, 0x3E, 0x21, 0x3F, 0xC2, 0xAB, 0x4B, 0xC1,
-0x04, 0x8E, 0x9B, 0xA7, 0x99, 0x0C, 0xF6, 0xD5, 0xFE, 0x3E, 0x79, 0x1C, 0x04, 0xFE, 0xA5, 0xE0, 0x5A, 0x50, 0x03, 0xE7, 0xD7,
-0xF4, 0x75, 0x38, 0x0D, 0x29, 0x5E, 0xF0, 0x81, 0xBC, 0x0E, 0x1F, 0x87, 0x64, 0x9F, 0xF3, 0x80, 0xAB, 0x6D, 0xED, 0x55, 0x00,
-0x67, 0xB0, 0x34, 0xDF, 0x3F, 0x03, 0x99, 0x7D, 0x8E, 0x2D, 0xF2, 0x17, 0x84, 0xBD, 0xA9, 0x68, 0xEC, 0x6E, 0x7F, 0x19, 0xA9,
-0x8B, 0x47, 0x5B, 0x4E, 0x50, 0x87, 0xF2, 0x22, 0x78, 0x25, 0xBD, 0x94, 0x56, 0xD8, 0x7C, 0xDC, 0xDB, 0xE4, 0x24, 0x9F, 0xF8,
-0xC1, 0x3E, 0x15, 0xB4, 0x92, 0x54, 0x63, 0x37, 0x4C, 0x72, 0xE2, 0x35, 0x4A, 0xF1, 0x0A, 0x56, 0x34, 0x2E, 0x61, 0xF2, 0x0C,
-0x6A, 0x42, 0x43, 0xF8, 0xAA, 0x72, 0x25, 0x23, 0x87, 0xC7, 0x3D, 0x62, 0x41, 0x4E, 0x7A, 0x20, 0x4F, 0x3B, 0x04, 0x44, 0x3D,
-0x58, 0x4B, 0xF4, 0x95, 0xB1, 0x64, 0xC3, 0x78, 0xB1, 0xCC, 0xF9, 0xAA, 0x44, 0x91, 0x21, 0x71, 0x64, 0x30, 0x54, 0x9A, 0x73,
-0xF8, 0x71, 0x76, 0x8C, 0x3D, 0xC0, 0xAE, 0x97, 0x83, 0x40, 0xD6, 0xE7, 0x80, 0x50, 0x1C, 0x2D, 0xE1, 0x3B, 0xB4, 0x84, 0xDC,
-0x7D, 0x92, 0xCC, 0xE1, 0xB8, 0x9A, 0xC3, 0x8B, 0x64, 0x3A, 0x35, 0xDA, 0x53, 0xC6, 0x87, 0x1C, 0xC2, 0x7E, 0x34, 0xF1, 0x7B,
-0xD3, 0x28, 0x38, 0x25, 0x94, 0x71, 0xD3, 0xE9, 0x84, 0x13, 0x23, 0x65, 0xDF, 0xE4, 0x03, 0x08, 0x17, 0xE1, 0xF4, 0x4C, 0xC8,
-0x48, 0xFC, 0xB5, 0x83, 0x0B, 0x49, 0xEA, 0xD3, 0xEE, 0xDD, 0x70, 0x7E, 0xC8, 0x2E, 0x34, 0xFA, 0x61, 0x0A, 0x6F, 0x5C, 0x10,
-0x6E, 0x16, 0xC5, 0xD8, 0xE6, 0x41, 0x6F, 0x03, 0x7A, 0x1B, 0xC1, 0xA1, 0xDB, 0xD9, 0x25, 0x58, 0xC3, 0x86, 0xD4, 0x4B, 0xA3,
-0x07, 0xD9, 0x79, 0x81, 0x9E, 0xE1, 0x97, 0x81, 0x1E, 0xDA, 0x27, 0x05, 0x3D, 0x39, 0xBC, 0xA9, 0x43, 0x0F, 0xD6, 0xF8, 0x24,
-0xE8, 0x81, 0x4D, 0xAA, 0xC0, 0xCE, 0xC6, 0x97, 0x81, 0x1D, 0xEC, 0x92, 0x82, 0x1C, 0xD8, 0x63, 0xEB, 0x70, 0x03, 0xE5, 0xAD,
-0xCB, 0xD1, 0xE0, 0x0D, 0xEC, 0x79, 0x15, 0x63, 0x88, 0xD3, 0x7D, 0x60, 0x7E, 0x93, 0xD9, 0x83, 0xE4, 0xB4, 0x62, 0x63, 0x6F,
-0xC4, 0x2C, 0xD8, 0x78, 0x32, 0x0A, 0xEA, 0x39, 0x60, 0xDF, 0xD9, 0xDD, 0xCF, 0x3D, 0xDC, 0xCB, 0xAD, 0x7D, 0x65, 0x93, 0x88,
-0xCD, 0x4B, 0x35, 0xF8, 0xA4, 0xA2, 0xF8, 0xE4, 0x10, 0x68, 0x7F, 0x12, 0xCC, 0x92, 0x08, 0x84, 0xC6, 0x91, 0x73, 0x00, 0x1F,
-0xF0, 0x16, 0x84, 0x64, 0x0C, 0x26, 0x9D, 0x5F, 0x47, 0xE9, 0x05, 0x3F, 0x5F, 0x92, 0xE2, 0xF6, 0xCF, 0xB9, 0x10, 0x2E, 0xF6,
-0xBC, 0x08, 0x66, 0xF6, 0xF0, 0x4A, 0x90, 0x31, 0x61, 0xB0, 0x38, 0x1E, 0x9C, 0xDD, 0x17, 0x71, 0x04, 0x72, 0xED, 0x0C, 0xCE,
-0xBD, 0x59, 0x90, 0xE2, 0x05, 0x60, 0x46, 0x78, 0x11, 0xE2, 0xE5, 0x95, 0x1C, 0x56, 0xEB, 0x05, 0x92, 0xD9, 0xCE, 0xA1, 0xB7,
-0x60, 0x17, 0x06, 0x06, 0xB9, 0x4A, 0x35, 0xB0, 0xE4, 0xF6, 0x70, 0xC7, 0x22, 0x4A, 0x94, 0xD8, 0xD7, 0xBA, 0x58, 0x3D, 0x03,
-0xFB, 0x12, 0xE2, 0x09, 0xC8, 0x0F, 0xB0, 0x61, 0xC2, 0xA1, 0x73, 0x1C, 0x79, 0x31, 0x93, 0x27, 0x00, 0x4E, 0x31, 0x2A, 0x47,
-0x6F, 0x90, 0xAC, 0x98, 0x29, 0x55, 0x8C, 0xA7, 0xF7, 0x31, 0xC6, 0xC0, 0x0C, 0x41, 0xD2, 0x1C, 0x6C, 0x2F, 0x9B, 0xA5, 0x70,
-0x22, 0xB6, 0x48, 0x89, 0xA5, 0x9C, 0x48, 0x07, 0x8D, 0xBB, 0xFD, 0xE3, 0x30, 0xA2, 0xCB, 0x90, 0x71, 0x0A, 0xE5, 0x95, 0xB6,
-0xD8, 0x8B, 0x45, 0xAE, 0x49, 0x92, 0x4C, 0x6A, 0xA8, 0x92, 0x03, 0x4D, 0xC1, 0xB7, 0x5A, 0xA8, 0x06, 0x4C, 0xE7, 0x88, 0x1A,
-0xD6, 0x01, 0x99, 0xF6, 0xA4, 0xDB, 0x1A, 0xFB, 0x7C, 0xD7, 0x53, 0xA0, 0x0A, 0x58, 0xA6, 0x40, 0x58, 0x4C, 0x59, 0x40, 0xC4,
-0xF7, 0xAC, 0x96, 0xD7, 0x9A, 0x5D, 0x54, 0x09, 0x65, 0xEE, 0x9D, 0x46, 0x41, 0x7C, 0x98, 0xCF, 0x80, 0xA5, 0xDE, 0x30, 0x26,
-0x5F, 0x21, 0xA3, 0x47, 0x94, 0x25, 0x02, 0xC7, 0x9D, 0x7B, 0x40, 0x2E, 0x70, 0x56, 0x00, 0x21, 0xD4, 0x2F, 0xBA, 0x41, 0xE2,
-0xE5, 0x7C, 0x1C, 0xA4, 0x19, 0x12, 0x98, 0x42, 0x5A, 0xD6, 0xA5, 0xEE, 0x5C, 0x84, 0xFD, 0xB1, 0x55, 0xFE, 0x24, 0x86, 0x2D,
-0x20, 0xF4, 0x0F, 0x92, 0xA3, 0x20, 0xB6, 0xAE, 0x73, 0xDB, 0x89, 0x8C, 0x77, 0xC1, 0x8B, 0x02, 0x90, 0xDB, 0xE8, 0xBF, 0xFC,
-0xA0, 0x5C, 0xC3, 0xFC, 0x19, 0x6B, 0x61, 0xC2, 0x10, 0xAD, 0x62, 0x4C, 0x60, 0x76, 0x7C, 0x48, 0x4E, 0xE7, 0x51, 0x9C, 0x31,
-0x35, 0xC8, 0x76, 0xBF, 0x7F, 0x72, 0x72, 0xE2, 0x9E, 0x6C, 0xBA, 0x49, 0x7A, 0xD8, 0xDF, 0x18, 0x0C, 0x06, 0x7D, 0x28, 0xE1,
-0x70, 0xBD, 0x01, 0xE2, 0x97, 0xB0, 0x83, 0x24, 0xFB, 0x3D, 0x0D, 0xA3, 0x08, 0xA8, 0x77, 0x99, 0xE2, 0x85, 0xC1, 0x1E, 0x9E,
-0xAD, 0x4B, 0xF2, 0x0D, 0xC9, 0x38, 0x84, 0xE3, 0x0B, 0x3C, 0xCE, 0xE9, 0xDA, 0xED, 0xE5, 0x70, 0xDE, 0x88, 0xE1, 0x8C, 0xD3,
-0xC3, 0x5A, 0x44, 0x5A, 0x31, 0xBD, 0x01, 0x61, 0x5B, 0x0C, 0x6A, 0x3D, 0x80, 0xFC, 0x40, 0xAE, 0x22, 0x03, 0x32, 0xBC, 0x09,
-0xFF, 0x13, 0x9D, 0x87, 0xED, 0x49, 0x3E, 0xB0, 0x8C, 0x9C, 0xD7, 0x5E, 0x1A, 0xE3, 0x79, 0xDA, 0xB2, 0xD4, 0x16, 0x5E, 0x3E,
-0x23, 0x80, 0xE7, 0x67, 0xB7, 0xDD, 0x3B, 0xB7, 0x37, 0xC8, 0xD0, 0xDD, 0xBA, 0x79, 0xD3, 0x1B, 0xBA, 0xC3, 0x4D, 0x42, 0xFF,
-0x41, 0xD8, 0x83, 0xDE, 0xD0, 0xBD, 0x73, 0x93, 0x0C, 0x9E, 0xBA, 0xC3, 0x9B, 0x5B, 0x64, 0xB8, 0xE9, 0x6E, 0x6C, 0x6E, 0x4E,
-0x7A, 0xEE, 0x8D, 0xAD, 0x5B, 0xEE, 0xAD, 0x5B, 0xB7, 0xDD, 0xC1, 0x9D, 0x21, 0x94, 0xBD, 0x75, 0xF3, 0x16, 0x00, 0x60, 0x3F,
-0x66, 0x50, 0xE6, 0xD6, 0x70, 0x73, 0xE2, 0xDE, 0xBE, 0x7D, 0x07, 0xFB, 0xE6, 0xDE, 0xD8, 0xBC, 0xDD, 0x73, 0xEF, 0xDC, 0x81,
-0x02, 0x3D, 0x5A, 0xE0, 0xA9, 0xD4, 0xD8, 0xEF, 0xCF, 0x6E, 0x93, 0xAD, 0x89, 0xBB, 0xB5, 0xB9, 0x05, 0x45, 0xDD, 0x3B, 0x5B,
-0x37, 0xDC, 0x1B, 0x37, 0x37, 0x5C, 0x28, 0x7B, 0x67, 0x2B, 0xEA, 0xB9, 0xF0, 0x76, 0xD3, 0xDD, 0x1A, 0xDC, 0xF2, 0xDC, 0xAD,
-0xAD, 0x0D, 0xFC, 0x3F, 0xED, 0xD1, 0x10, 0xC0, 0x0C, 0xA1, 0x43, 0xB7, 0xE0, 0xDF, 0x2D, 0x2C, 0x79, 0xDF, 0xBD, 0x33, 0xD8,
-0xC2, 0xFF, 0xB3, 0xCF, 0x04, 0x40, 0xFE, 0x3E, 0x77, 0x07, 0x83, 0x0D, 0x02, 0x83, 0x81, 0x67, 0x7C, 0x87, 0xFF, 0x6E, 0xF0,
-0xBF, 0xF8, 0x3C, 0xE8, 0x6D, 0xFC, 0xEE, 0xF4, 0x0D, 0x56, 0x00, 0x33, 0x68, 0x61, 0x5D, 0x06, 0xE2, 0x7E, 0x49, 0x96, 0x64,
-0x0E, 0xD2, 0x02, 0x61, 0xB4, 0xE3, 0x11, 0x4A, 0xA4, 0xE4, 0x39, 0x9D, 0x3D, 0x2F, 0xA2, 0x32, 0x23, 0x2E, 0x0D, 0x76, 0xF8,
-0x87, 0x63, 0x2B, 0x3D, 0x72, 0xE5, 0x48, 0xC4, 0xF0, 0x2F, 0x59, 0xC2, 0x82, 0xD6, 0xEF, 0x05, 0x50, 0xBE, 0x70, 0xC9, 0x33,
-0x2F, 0xF6, 0x0E, 0x03, 0x72, 0x96, 0x2C, 0x53, 0x5A, 0x05, 0x0F, 0x6E, 0x04, 0xCE, 0x30, 0xFA, 0x39, 0x4E, 0x21, 0x71, 0x7A,
-0xBB, 0xE8, 0xEC, 0xCE, 0x82, 0x34, 0xC0, 0xE3, 0x89, 0xBB, 0x2E, 0x7F, 0x6B, 0xBA, 0xE7, 0xE6, 0xD3, 0xE8, 0x93, 0x08, 0x20,
-0x07, 0xD3, 0xA7, 0xCE, 0xEE, 0x4F, 0x70, 0x74, 0x4F, 0xD9, 0xE5, 0x15, 0x59, 0x57, 0x1E, 0x41, 0x00, 0x0D, 0x44, 0x92, 0xA5,
-0xD4, 0x84, 0x22, 0x9E, 0xA8, 0x08, 0x5B, 0x29, 0xAB, 0x54, 0xDD, 0xDB, 0x3C, 0x05, 0x41, 0x53, 0xDA, 0x18, 0x04, 0xFE, 0x72,
-0x5C, 0xAF, 0x2B, 0xB1, 0xB5, 0x12, 0x5F, 0x28, 0x88, 0x97, 0x2D, 0x38, 0xBB, 0xEC, 0x2F, 0x19, 0x9F, 0x11, 0x7C, 0x5B, 0xB1,
-0x2D, 0xF0, 0x0B, 0x7B, 0xDA, 0x41, 0xB5, 0xBE, 0xD2, 0x0E, 0x2B, 0x46, 0xD5, 0xAF, 0xF4, 0x97, 0x95, 0x5C, 0xAA, 0x86, 0xFD,
-0x30, 0x4C, 0xA1, 0x0A, 0x20, 0xF3, 0xD3, 0x8E, 0x5D, 0x6B, 0x46, 0x46, 0x40, 0xF1, 0xA9, 0x19, 0x16, 0x74, 0x48, 0x56, 0x54,
-0x18, 0xBC, 0x32, 0x59, 0x50, 0x82, 0xE1, 0x27, 0x12, 0x67, 0xF7, 0x7E, 0x0C, 0x67, 0x89, 0xB2, 0x61, 0xF6, 0x79, 0x55, 0xB5,
-0x30, 0x1E, 0x23, 0xF9, 0x39, 0xBB, 0x4F, 0xD8, 0x8F, 0xA6, 0xF5, 0xE0, 0x18, 0xC3, 0x2B, 0xBE, 0xE0, 0xBF, 0x2A, 0x6A, 0xD6,
-0xCE, 0xE0, 0xBA, 0x0B, 0x1E, 0x8E, 0x37, 0xF7, 0xF3, 0x49, 0x72, 0x25, 0xCB, 0x9D, 0xC3, 0x62, 0x97, 0x8F, 0xFB, 0x20, 0x26,
-0x91, 0xFB, 0x07, 0x7B, 0x2F, 0x40, 0xC0, 0xA8, 0xB9, 0xB2, 0xF8, 0xA4, 0x02, 0xB5, 0xE8, 0x50, 0x35, 0xE3, 0x60, 0x22, 0x10,
-0x72, 0x8E, 0xA2, 0xAB, 0xC4, 0x03, 0xDE, 0xB1, 0x00, 0x7E, 0x9D, 0x91, 0xE3, 0x20, 0x85, 0xC3, 0xA2, 0x5D, 0xDE, 0x31, 0xC5,
-0xEA, 0xCF, 0x2B, 0x37, 0xB3, 0xBE, 0xB1, 0xE1, 0x71, 0x2B, 0x09, 0xE9, 0x4D, 0x43, 0xA9, 0x19, 0xA8, 0x3B, 0x43, 0x15, 0x8F,
-0xBF, 0xFB, 0x33, 0xAD, 0x7C, 0x59, 0xF9, 0x59, 0x46, 0x14, 0xC3, 0xB6, 0x34, 0x0D, 0x4F, 0x93, 0xF8, 0x90, 0x1D, 0x46, 0x6B,
-0xD9, 0x0D, 0x94, 0xB6, 0x70, 0x19, 0x20, 0x58, 0x72, 0x55, 0xAC, 0xA6, 0x68, 0xC1, 0x94, 0xC1, 0x91, 0x72, 0xC5, 0xC9, 0x69,
-0xA5, 0x18, 0x5E, 0xC2, 0xB9, 0x5A, 0x09, 0x9C, 0x77, 0xE0, 0x2A, 0x04, 0xF0, 0x2A, 0x0C, 0xE3, 0x7C, 0xFC, 0x10, 0x66, 0x79,
-0x92, 0x9E, 0x7D, 0x32, 0x1C, 0x4B, 0x6D, 0xA0, 0x79, 0x04, 0x5E, 0xB3, 0xA2, 0x20, 0x0E, 0x08, 0xA7, 0x94, 0x1A, 0xC2, 0x48,
-0x8B, 0x45, 0x57, 0x85, 0xEC, 0xB5, 0x59, 0x44, 0x43, 0x26, 0xA1, 0xEE, 0x18, 0x96, 0xCE, 0x36, 0xDA, 0x30, 0x2A, 0x78, 0x71,
-0xD5, 0x52, 0x5F, 0x6F, 0xB1, 0x5B, 0x8E, 0xC9, 0xC5, 0x8C, 0x49, 0xE7, 0x64, 0x7D, 0x16, 0x9B, 0x1D, 0x94, 0xCD, 0xC6, 0x08,
-0xE1, 0x90, 0x2A, 0x78, 0x40, 0x05, 0xF7, 0xAA, 0xE4, 0x0C, 0x55, 0xBC, 0x01, 0xC9, 0xD5, 0x0B, 0xD1, 0x22, 0x03, 0x48, 0xED,
-0x06, 0x59, 0x9C, 0xF6, 0x06, 0x56, 0x36, 0xCF, 0x8B, 0xA7, 0x28, 0xC3, 0x11, 0xFA, 0x6F, 0x6F, 0x78, 0x3A, 0xB4, 0xB1, 0xFB,
-0x69, 0x8A, 0xD7, 0x20, 0x7C, 0x1E, 0xF3, 0x70, 0x1E, 0x64, 0xCF, 0xBC, 0x85, 0xA3, 0x1A, 0xB3, 0x89, 0x2F, 0xF4, 0x20, 0x37,
-0xC7, 0xCF, 0xD4, 0xB0, 0x69, 0xE4, 0xE0, 0x82, 0x3F, 0xC0, 0x2F, 0x04, 0x2B, 0x99, 0x68, 0x81, 0xE5, 0x96, 0x9C, 0x8C, 0x9C,
-0xC3, 0x00, 0x8E, 0x73, 0x13, 0x7E, 0x75, 0x74, 0xB7, 0xCF, 0xDA, 0xBC, 0x30, 0x2E, 0x6A, 0xC6, 0x5B, 0xB2, 0x4E, 0x10, 0x7E,
-0x60, 0x23, 0x1A, 0x23, 0x43, 0x52, 0xB6, 0xD2, 0x8C, 0x78, 0x79, 0x79, 0x5E, 0xB0, 0x0E, 0x90, 0x89, 0xCD, 0x96, 0xD1, 0xE4,
-0x5E, 0x7A, 0x88, 0x76, 0x76, 0xFF, 0xA2, 0xFC, 0xC4, 0xD9, 0x95, 0x6B, 0xD1, 0x73, 0x05, 0x39, 0xF0, 0x16, 0x00, 0xDC, 0xAC,
-0xA9, 0xB6, 0x76, 0x18, 0xE6, 0xB3, 0xE5, 0x98, 0x5A, 0x04, 0x1E, 0x7A, 0x7E, 0x30, 0xE9, 0x2D, 0x8F, 0xFA, 0x7E, 0x71, 0xD0,
-0xE9, 0xD1, 0xAB, 0xDE, 0xFE, 0x37, 0x00, 0xBD, 0x87, 0x7D, 0xEF, 0x79, 0xB0, 0xB8, 0x7A, 0xB4, 0xEF, 0x8E, 0xD1, 0x05, 0x71,
-0xA4, 0x41, 0xB6, 0xA1, 0x37, 0x3B, 0x5D, 0xC2, 0xD1, 0x38, 0x8C, 0xB3, 0x3C, 0x5D, 0x52, 0x11, 0x2C, 0x73, 0xAF, 0xEE, 0xA4,
-0x23, 0xF4, 0xEC, 0xF7, 0x29, 0x64, 0xA6, 0xE8, 0xCB, 0x1C, 0x5D, 0xD3, 0x4D, 0xEF, 0x7A, 0xB6, 0xEC, 0x4A, 0xE1, 0xF5, 0x44,
-0x17, 0x69, 0x2D, 0xC3, 0xF2, 0xBC, 0xEF, 0xFB, 0x07, 0xC9, 0x3E, 0xEF, 0x82, 0x79, 0xCB, 0xB5, 0x48, 0xC3, 0xB9, 0x65, 0xB7,
-0xD6, 0xB9, 0x1A, 0x40, 0xC1, 0xB3, 0x66, 0x01, 0xA7, 0x6A, 0xFB, 0xB6, 0xB4, 0xBD, 0xE7, 0xC1, 0x21, 0x29, 0x0B, 0xA2, 0x4B,
-0x36, 0x2D, 0xC0, 0x58, 0x5B, 0x5E, 0x6F, 0x6A, 0x24, 0xA3, 0x11, 0x0D, 0xD9, 0xA5, 0x16, 0x37, 0xF6, 0x8E, 0x89, 0xB0, 0x06,
-0xB2, 0x5D, 0xCB, 0x6D, 0x0C, 0x34, 0x33, 0xA8, 0x31, 0x6C, 0xB4, 0x3B, 0x6C, 0xC2, 0x41, 0x96, 0x3E, 0xA0, 0xD5, 0xD8, 0x1D,
-0x0A, 0x80, 0x88, 0xE8, 0xAE, 0xA4, 0x6F, 0x6B, 0xA1, 0xD4, 0x18, 0x57, 0x24, 0xB2, 0x1A, 0x28, 0x13, 0xC2, 0xFE, 0xC5, 0x99,
-0x40, 0x95, 0x6C, 0x26, 0x55, 0xA6, 0xD6, 0x47, 0xCC, 0x22, 0xA8, 0xE8, 0x02, 0x52, 0x31, 0x76, 0xDF, 0x54, 0x75, 0xAB, 0x2F,
-0xF9, 0x2A, 0xF9, 0x86, 0x57, 0x81, 0x9E, 0xDB, 0x96, 0xB3, 0x32, 0x45, 0xC5, 0xB8, 0xF8, 0xDD, 0x10, 0x17, 0x0C, 0xB2, 0xA2,
-0xDD, 0x83, 0xE2, 0x13, 0xDB, 0xB4, 0x50, 0x8F, 0x0E, 0x4B, 0x0B, 0xB6, 0xF6, 0x17, 0xAC, 0x40, 0xA5, 0xF8, 0x67, 0x2A, 0x43,
-0xAF, 0x18, 0x4D, 0xEA, 0x9A, 0x5C, 0x07, 0x41, 0x92, 0xBD, 0x8C, 0x46, 0xB3, 0x26, 0xBE, 0xAA, 0x31, 0xA4, 0x40, 0xD1, 0x50,
-0xC4, 0x4D, 0x0D, 0xC4, 0x2A, 0xFB, 0xA3, 0x91, 0xE4, 0xF9, 0xC7, 0x5E, 0x3C, 0x09, 0xFC, 0x75, 0x90, 0x24, 0xEA, 0x5C, 0x0E,
-0x49, 0x0A, 0x14, 0x3B, 0x92, 0xEE, 0xF3, 0x22, 0x4D, 0x91, 0xC4, 0x95, 0xEA, 0x55, 0xC2, 0x82, 0x64, 0x0B, 0x67, 0x65, 0xCD,
-0x1B, 0x95, 0xA7, 0x44, 0x09, 0xC0, 0xC2, 0x8B, 0x03, 0x32, 0x85, 0x6D, 0x8A, 0x09, 0xFA, 0x96, 0x05, 0x49, 0x07, 0x54, 0x8C,
-0x1B, 0xCB, 0x47, 0x16, 0x83, 0x10, 0x79, 0xF5, 0xDA, 0x25, 0x3B, 0x79, 0x93, 0xB1, 0xC9, 0x73, 0x2B, 0x44, 0x66, 0x6A, 0x56,
-0x13, 0x07, 0x68, 0xF1, 0xFF, 0xA0, 0xF8, 0x6D, 0x17, 0x8C, 0x2D, 0xCA, 0xD7, 0xF8, 0x10, 0x06, 0x35, 0x47, 0x67, 0x85, 0x21,
-0x3D, 0x83, 0xC0, 0xE9, 0x63, 0x6B, 0xAB, 0x50, 0xAF, 0x6E, 0x0D, 0x54, 0x91, 0x96, 0x97, 0xA7, 0x5B, 0x82, 0xD4, 0xAE, 0xA5,
-0x15, 0xBB, 0x70, 0xF2, 0x34, 0x39, 0x01, 0x21, 0x3E, 0x3E, 0xA4, 0x67, 0xE7, 0x12, 0x02, 0x39, 0xC1, 0xDB, 0xEC, 0x59, 0x10,
-0x2D, 0xF0, 0x08, 0x8D, 0x96, 0xD1, 0x20, 0xC1, 0xA4, 0x71, 0x2F, 0x8C, 0xDD, 0x0A, 0x89, 0xD8, 0x22, 0x22, 0x35, 0xC6, 0xE7,
-0x2C, 0x2D, 0x8A, 0x9C, 0xF5, 0x06, 0x24, 0x59, 0x78, 0x93, 0x30, 0x3F, 0xEB, 0x0D, 0x07, 0xAB, 0x06, 0xB2, 0x38, 0xB3, 0x43,
-0xD4, 0x2C, 0xA2, 0x98, 0x26, 0x41, 0xD7, 0x19, 0x8F, 0x83, 0xFC, 0x24, 0x08, 0x62, 0x8B, 0x86, 0xC1, 0x0E, 0xB2, 0xE2, 0x82,
-0xB9, 0x86, 0x2A, 0x64, 0x1B, 0x5A, 0x9F, 0x99, 0xDE, 0x8A, 0x1B, 0x55, 0xA0, 0xE0, 0x87, 0x70, 0x48, 0x04, 0x76, 0xC4, 0x0F,
-0xAD, 0xB8, 0xD8, 0x03, 0x02, 0xCC, 0x22, 0x9B, 0xA4, 0xD0, 0xAB, 0x6A, 0x72, 0xA9, 0x3E, 0x95, 0x54, 0x4C, 0xF4, 0x44, 0xD8,
-0x27, 0xC1, 0x01, 0xE8, 0x24, 0xCC, 0x27, 0x33, 0x54, 0xA0, 0x0C, 0x9C, 0xEA, 0x81, 0x30, 0x7A, 0x34, 0x07, 0x42, 0xDF, 0x0B,
-0xBE, 0x43, 0x5F, 0x8D, 0xF1, 0x68, 0x4F, 0x39, 0xBE, 0x18, 0x0F, 0x5F, 0x7E, 0xAC, 0x21, 0x67, 0xED, 0xEE, 0x57, 0x7D, 0xA9,
-0x22, 0xAF, 0xFF, 0x48, 0xE2, 0x09, 0xA8, 0x39, 0xEF, 0xEB, 0xC0, 0x03, 0xB2, 0x49, 0x39, 0x05, 0x71, 0x6D, 0x15, 0x39, 0x61,
-0x6F, 0xF1, 0x6C, 0xC1, 0xEF, 0xCD, 0xFB, 0xE2, 0xE8, 0xF1, 0x95, 0x91, 0x94, 0x3A, 0xCA, 0xCF, 0x4F, 0x57, 0xE2, 0x96, 0x05,
-0xB6, 0x0B, 0x38, 0x5C, 0x06, 0x59, 0xA3, 0xDB, 0x94, 0x8B, 0xD0, 0x64, 0x53, 0xAA, 0xFC, 0x44, 0x74, 0xB9, 0x82, 0x32, 0x2F,
-0x44, 0x9B, 0x0C, 0x61, 0xBB, 0x4F, 0xE2, 0x49, 0xB4, 0x84, 0xFD, 0x1A, 0x29, 0x30, 0x0D, 0xE8, 0x8D, 0x19, 0x7A, 0xF8, 0xAC,
-0xB8, 0x99, 0x6B, 0x46, 0x93, 0x57, 0x40, 0x95, 0x97, 0xA1, 0x4B, 0x4E, 0x12, 0x4D, 0xA8, 0x72, 0xC5, 0xDA, 0xFA, 0x44, 0x34,
-0x8B, 0x5C, 0x61, 0x9F, 0xE1, 0xF9, 0x59, 0x76, 0xF8, 0x19, 0xA9, 0x77, 0xE3, 0x2B, 0xA6, 0xDE, 0x4C, 0x43, 0x1A, 0xE3, 0xAD,
-0x42, 0x01, 0x39, 0x07, 0xC1, 0xC8, 0x3B, 0x5C, 0x4D, 0xB6, 0xEA, 0x50, 0xB3, 0x39, 0x9A, 0xF1, 0x50, 0xF3, 0x75, 0xEA, 0xF5,
-0x54, 0x5E, 0xE8, 0xED, 0x3E, 0x64, 0x73, 0x91, 0x15, 0x2D, 0x7C, 0xEB, 0xCD, 0x17, 0x3B, 0xC5, 0xBD, 0x31, 0xF3, 0x30, 0x94,
-0x9A, 0xAD, 0x5D, 0x0D, 0x5F, 0xE2, 0x5A, 0xD1, 0xF1, 0xF9, 0x85, 0xAF, 0x97, 0x97, 0xDC, 0x64, 0xE6, 0x2F, 0x56, 0xDF, 0x74,
-0xB1, 0x14, 0x18, 0x63, 0x2B, 0xC5, 0xB0, 0x39, 0x6A, 0x87, 0x53, 0xE2, 0x1D, 0x7B, 0x21, 0x75, 0xEF, 0xED, 0x7C, 0x95, 0xFC,
-0x5E, 0x19, 0xE6, 0x17, 0x4E, 0xC0, 0x2F, 0x52, 0x38, 0x52, 0xC3, 0x09, 0xFE, 0x2F, 0x6E, 0xDF, 0x94, 0x80, 0x0B, 0x8C, 0x71,
-0x56, 0xCF, 0x59, 0x6F, 0xC2, 0x5E, 0x0B, 0x3A, 0xBE, 0x7A, 0x8E, 0xBF, 0x11, 0xFB, 0x5D, 0xB2, 0x99, 0xC2, 0x3F, 0x37, 0xF2,
-0x19, 0x09, 0xF2, 0x89, 0x4B, 0x62, 0xA8, 0x80, 0x77, 0xB1, 0xA2, 0x0F, 0x78, 0xA3, 0xFF, 0x95, 0xF2, 0xFC, 0x92, 0x0E, 0xBF,
-0xEC, 0xF5, 0xF2, 0xD4, 0xCB, 0xF2, 0xFD, 0xA0, 0xC2, 0x5C, 0xF1, 0xAF, 0xF5, 0x62, 0x59, 0x2F, 0x05, 0xC6, 0xD4, 0xF5, 0x02,
-0xF5, 0x51, 0xAC, 0x87, 0xCE, 0x09, 0xF5, 0xDA, 0x95, 0x2D, 0x99, 0xFB, 0xBE, 0x9F, 0x31, 0xF8, 0x70, 0x84, 0x48, 0x52, 0x54,
-0xAC, 0x8B, 0x36, 0x70, 0xB5, 0xE0, 0xD5, 0xC9, 0x5E, 0x61, 0xF0, 0x4D, 0x50, 0x17, 0xF0, 0x95, 0x2E, 0x9A, 0x92, 0x18, 0xBF,
-0xEC, 0x45, 0x83, 0x6E, 0x24, 0x4F, 0x85, 0x12, 0xF5, 0xAF, 0x85, 0xD3, 0x70, 0xE1, 0x28, 0x58, 0x53, 0x17, 0x8F, 0xB8, 0xBB,
-0xB9, 0xF2, 0xA5, 0x53, 0xEC, 0x36, 0xB8, 0x48, 0x8A, 0x45, 0x93, 0x4C, 0xE9, 0x33, 0x57, 0x10, 0x12, 0x34, 0xB3, 0x13, 0x5D,
-0xF9, 0x4A, 0x57, 0x8E, 0x4A, 0x91, 0x5F, 0xF6, 0xEA, 0x79, 0xBC, 0x8C, 0x22, 0xCE, 0xAF, 0xFE, 0x3A, 0x66, 0x54, 0x2D, 0x1E,
-0x39, 0x58, 0x85, 0xB4, 0x86, 0x64, 0xDC, 0xED, 0xBE, 0xF6, 0xC2, 0x9C, 0x5A, 0x52, 0x69, 0xDC, 0x1F, 0x37, 0x05, 0xE1, 0x7D,
-0xD6, 0x60, 0x25, 0x85, 0xAA, 0x69, 0x7F, 0x18, 0x4F, 0x93, 0xDE, 0x24, 0x4C, 0x27, 0x51, 0x40, 0x60, 0xA0, 0x43, 0x8B, 0x66,
-0x2E, 0x49, 0xA2, 0x3C, 0x5C, 0x94, 0x1F, 0x8A, 0x7B, 0xAD, 0x91, 0x43, 0xF5, 0x27, 0x4E, 0x75, 0x6B, 0x44, 0x98, 0xAB, 0x60,
-0xE7, 0x33, 0xDA, 0x7B, 0x6D, 0xFF, 0x2A, 0x36, 0x54, 0x6D, 0x24, 0xA8, 0x16, 0x48, 0x58, 0xA9, 0x71, 0x00, 0xF5, 0x02, 0x42,
-0x03, 0xD4, 0x08, 0xCD, 0x8D, 0x58, 0xCC, 0x85, 0xFC, 0x1A, 0x33, 0x85, 0x0E, 0x1A, 0x70, 0xB8, 0xE4, 0x11, 0xBD, 0xB2, 0x82,
-0x37, 0x21, 0x6B, 0x73, 0xBC, 0xCC, 0xCE, 0xC4, 0x9D, 0x43, 0x46, 0xE0, 0x88, 0x76, 0x96, 0x2C, 0xC9, 0x89, 0x17, 0x73, 0xF1,
-0x93, 0x99, 0x60, 0x53, 0xA3, 0x8D, 0x89, 0x86, 0x5B, 0x6A, 0xB9, 0x26, 0x5A, 0x71, 0x6B, 0x47, 0xCA, 0x69, 0x1B, 0x98, 0x5B,
-0x96, 0xA4, 0xDB, 0x8B, 0x24, 0xA4, 0x4E, 0xFB, 0xD4, 0xEA, 0xE6, 0xEB, 0xE3, 0x30, 0xCA, 0xAA, 0xFD, 0xF2, 0x19, 0xCC, 0xE7,
-0xBD, 0xF1, 0xFB, 0x13, 0x71, 0x17, 0x76, 0xEB, 0x57, 0xB0, 0x96, 0x67, 0xFC, 0xEA, 0x8D, 0x3A, 0x88, 0xEC, 0xEF, 0x7F, 0x85,
-0xAC, 0x45, 0xC8, 0x16, 0x82, 0x31, 0xF0, 0xCB, 0x44, 0x31, 0x20, 0xF4, 0x93, 0x40, 0x64, 0x90, 0x69, 0x10, 0xF8, 0x57, 0xC6,
-0x6F, 0x7E, 0xCA, 0x02, 0xE0, 0x1E, 0x16, 0x56, 0x03, 0x4B, 0x66, 0x46, 0xA6, 0x69, 0xF0, 0xDB, 0x92, 0x19, 0x90, 0x16, 0x30,
-0x85, 0x46, 0xE0, 0x3F, 0x8C, 0xA5, 0x7C, 0x91, 0x97, 0xA2, 0xFF, 0xA9, 0x0A, 0xD5, 0xC7, 0x61, 0x3A, 0x3F, 0xF1, 0x52, 0xB4,
-0x7E, 0x59, 0xE6, 0x09, 0xBA, 0xF7, 0x4D, 0xC8, 0x94, 0xBF, 0x23, 0x4B, 0x16, 0xDA, 0x03, 0x36, 0xC2, 0x6A, 0x4A, 0xA0, 0xC1,
-0x27, 0x96, 0x5F, 0xA7, 0x9E, 0xB5, 0x18, 0xFC, 0xD7, 0xA5, 0xC0, 0xDF, 0xF8, 0x13, 0xD0, 0xDB, 0x43, 0x2F, 0x8C, 0xF0, 0xB0,
-0x86, 0x7F, 0x48, 0x31, 0xE3, 0x05, 0xE9, 0x55, 0xD3, 0xDB, 0x52, 0x84, 0x9B, 0x59, 0x71, 0xAB, 0xDE, 0xEC, 0xB0, 0xF8, 0x24,
-0x06, 0xFA, 0x85, 0x8F, 0x05, 0xA5, 0x33, 0xEF, 0xBB, 0x79, 0xE8, 0xC7, 0xB8, 0xF5, 0xA0, 0x98, 0xB8, 0x40, 0x63, 0x21, 0xD8,
-0x27, 0xF0, 0x88, 0x7A, 0x11, 0x66, 0xF4, 0x45, 0x50, 0x38, 0x43, 0xF7, 0x5F, 0x76, 0x2A, 0x9F, 0x8B, 0xCC, 0xF7, 0xA3, 0x20,
-0x58, 0x38, 0xBB, 0x2F, 0x8E, 0x83, 0x94, 0x11, 0x52, 0x86, 0x2F, 0xA8, 0x13, 0x2D, 0x69, 0x33, 0x63, 0xA7, 0xCC, 0x83, 0x8F,
-0x9D, 0xAF, 0x92, 0x6F, 0xB2, 0xD1, 0xFD, 0x71, 0xD6, 0x29, 0x14, 0x99, 0xE8, 0xF8, 0x20, 0xC2, 0x10, 0xAD, 0x25, 0xF7, 0x5F,
-0xC0, 0x2D, 0x67, 0x2D, 0xE7, 0x9C, 0x66, 0xDE, 0xC5, 0x38, 0x84, 0x7D, 0xDC, 0x3B, 0x9D, 0x5D, 0x8A, 0x4E, 0xB6, 0x91, 0x92,
-0x59, 0xB2, 0x4C, 0x57, 0xF2, 0x36, 0xC9, 0xFB, 0x47, 0x82, 0xD3, 0xD0, 0xEB, 0x67, 0x85, 0xEF, 0x4F, 0x43, 0xC2, 0xBB, 0x4A,
-0x34, 0x3C, 0x42, 0xBF, 0x51, 0x86, 0x04, 0x8C, 0x86, 0x77, 0x21, 0x14, 0x20, 0x8C, 0xCF, 0x83, 0x80, 0x9A, 0x2F, 0x7F, 0x1E,
-0x35, 0x37, 0x06, 0x16, 0xE6, 0x3C, 0x6C, 0x9F, 0xF1, 0x92, 0x64, 0x3A, 0x25, 0x7C, 0xB9, 0x10, 0x7F, 0x49, 0xAD, 0x67, 0x4B,
-0x9E, 0xF6, 0x55, 0xEA, 0xB8, 0xCB, 0x31, 0xFE, 0xA1, 0x87, 0x91, 0xFA, 0x3D, 0x73, 0xA8, 0xED, 0x99, 0xEB, 0xF8, 0xB5, 0x35,
-0xB4, 0x2C, 0x57, 0xDD, 0x17, 0x9A, 0x99, 0x93, 0x2B, 0xCE, 0x0E, 0x17, 0xB5, 0x80, 0xFE, 0x03, 0xA5, 0xDA, 0x46, 0x6B, 0x81,
-0x4C, 0x4F, 0x7A, 0xE8, 0x83, 0xA3, 0xEE, 0xEC, 0x85, 0xDF, 0xD3, 0x2E, 0xBF, 0x61, 0xCC, 0x4A, 0x0F, 0xA6, 0xDA, 0xBD, 0xFC,
-0x0F, 0xDC, 0xAF, 0x4B, 0x5F, 0xAD, 0xCF, 0xBE, 0x67, 0x57, 0x86, 0x04, 0x2C, 0x3A, 0x45, 0xD0, 0x67, 0x95, 0xB4, 0x9F, 0xB1,
-0x88, 0xF7, 0x64, 0x0B, 0x83, 0x96, 0xA4, 0x61, 0x90, 0xD5, 0xC8, 0x46, 0xA5, 0x24, 0x20, 0x80, 0x20, 0x8C, 0x3D, 0xE1, 0x9D,
-0x59, 0xEC, 0x04, 0x78, 0x7D, 0xCB, 0xA3, 0x09, 0x32, 0x2A, 0x5C, 0x21, 0x5C, 0xAC, 0xA6, 0x46, 0x69, 0x71, 0xE6, 0x18, 0xEC,
-0x06, 0xDD, 0x8E, 0xD7, 0xB9, 0x39, 0xFC, 0x12, 0x48, 0xB8, 0x70, 0x9F, 0x13, 0x14, 0x3C, 0x29, 0x1C, 0xE1, 0xBE, 0x50, 0x02,
-0x2E, 0x1D, 0xFE, 0xBE, 0x1C, 0xFA, 0x15, 0x7D, 0xBA, 0x0C, 0xF9, 0x0A, 0xC4, 0xAF, 0xA2, 0xDE, 0x92, 0x70, 0x9B, 0x73, 0xFF,
-0x35, 0x78, 0xBF, 0xE2, 0x1B, 0xB5, 0x92, 0xF7, 0x2B, 0x3E, 0x5C, 0xAB, 0x7D, 0x89, 0x34, 0x4F, 0xC7, 0x22, 0x72, 0xBE, 0x73,
-0x99, 0x65, 0xF8, 0xE5, 0x9D, 0x01, 0x2D, 0xF7, 0xEB, 0xE8, 0xB4, 0x89, 0x69, 0x2F, 0x8A, 0x75, 0x46, 0x93, 0x60, 0x90, 0x0C,
-0xCE, 0x7E, 0xC9, 0x6A, 0x09, 0xF7, 0xB3, 0x5E, 0xA4, 0xF3, 0x6B, 0xF4, 0xFB, 0x24, 0xF7, 0xE0, 0x24, 0x42, 0x57, 0x57, 0x90,
-0x11, 0x81, 0x43, 0xC0, 0xE9, 0x34, 0x3C, 0x5C, 0xE2, 0x2D, 0xC8, 0x9C, 0x3A, 0x71, 0xB7, 0x93, 0x94, 0x9C, 0x78, 0x47, 0xF0,
-0x6B, 0x9A, 0x26, 0x73, 0x49, 0x10, 0xEC, 0xB8, 0xE4, 0x09, 0xD3, 0xB4, 0x0B, 0xD2, 0xC6, 0x4B, 0xF7, 0x82, 0x4B, 0xB3, 0x03,
-0x70, 0x98, 0x71, 0x3F, 0xB6, 0x2E, 0xF1, 0xD4, 0x06, 0xB9, 0x69, 0x0B, 0x35, 0x0A, 0x2B, 0x54, 0xF7, 0xE1, 0x9C, 0x46, 0x4F,
-0xCF, 0x83, 0xE8, 0xAC, 0xEE, 0xA6, 0xFC, 0x42, 0xF7, 0xE4, 0xCD, 0x6E, 0x89, 0x5E, 0x05, 0xBF, 0x2D, 0x43, 0x0C, 0x82, 0xE5,
-0xC5, 0xD4, 0xA3, 0xDB, 0xC3, 0xA5, 0x40, 0x0E, 0x0E, 0x5E, 0x6E, 0x6C, 0x6C, 0xF2, 0xE9, 0xA4, 0x71, 0x2E, 0xA8, 0xD7, 0xE0,
-0x57, 0x75, 0x4B, 0x54, 0x90, 0xE8, 0x1F, 0xEA, 0x6A, 0x02, 0xE7, 0xD7, 0xB3, 0xFB, 0x48, 0x4F, 0x8E, 0x95, 0x73, 0xD4, 0x84,
-0xD3, 0xB3, 0x0B, 0xCD, 0x17, 0xDA, 0x92, 0x2F, 0xB5, 0xF5, 0xB2, 0x37, 0x74, 0x7E, 0xD8, 0xDA, 0x87, 0x7F, 0x26, 0xC1, 0x6B,
-0x18, 0x12, 0x5E, 0x53, 0xA0, 0x72, 0xED, 0x28, 0x90, 0xD7, 0xCA, 0xF8, 0x8C, 0x33, 0x03, 0x28, 0xB7, 0xBD, 0x62, 0xDB, 0x95,
-0x8E, 0xBA, 0x2A, 0x54, 0xCB, 0x79, 0x17, 0x59, 0x03, 0x46, 0xA2, 0x25, 0x27, 0xF4, 0x4F, 0x0D, 0xB1, 0xA8, 0xF1, 0x9B, 0x6E,
-0x02, 0x9E, 0x86, 0xE8, 0x80, 0xB9, 0x44, 0x25, 0x5F, 0x45, 0xCC, 0xA7, 0x8A, 0xBA, 0x9B, 0x03, 0xA8, 0xBC, 0xC5, 0x2B, 0x67,
-0xEB, 0xD6, 0xBE, 0x89, 0xB5, 0x87, 0x83, 0x8B, 0x56, 0xBF, 0x43, 0xAB, 0x5F, 0xB8, 0xF5, 0xE1, 0x6D, 0xAC, 0xBF, 0xD9, 0xB4,
-0xF9, 0xDA, 0x4B, 0x83, 0xBF, 0xAE, 0x47, 0x1B, 0x5C, 0x2C, 0x00, 0x7A, 0x1F, 0x47, 0xB0, 0x49, 0xED, 0xE2, 0xBF, 0xCC, 0x05,
-0x94, 0x5F, 0x2A, 0xC0, 0x54, 0x7C, 0xEB, 0x07, 0x87, 0x3B, 0x5F, 0xD9, 0x8D, 0xA8, 0x18, 0xD0, 0x5F, 0x77, 0xEB, 0x9F, 0x85,
-0x78, 0x7E, 0x48, 0x30, 0xEC, 0xC5, 0x7E, 0x00, 0xB3, 0x44, 0x43, 0x6E, 0x90, 0x19, 0xBC, 0xA0, 0xA1, 0x84, 0xA9, 0xE2, 0x9D,
-0x65, 0x8A, 0xF8, 0xDA, 0x08, 0x88, 0x0E, 0xEA, 0x8F, 0xD9, 0x81, 0xCB, 0xFD, 0x76, 0x83, 0x75, 0x87, 0xA1, 0x15, 0x7B, 0x34,
-0xAE, 0x08, 0xAB, 0x57, 0xB5, 0x05, 0x4B, 0xB1, 0xA0, 0x0B, 0x18, 0x95, 0xC1, 0xC5, 0x36, 0x37, 0x2A, 0x44, 0xB9, 0x8A, 0x08,
-0x77, 0xC5, 0x34, 0x5B, 0x22, 0x46, 0x53, 0x2E, 0xC2, 0xB3, 0xCF, 0xAD, 0x8E, 0x2E, 0x56, 0x39, 0xD9, 0x2C, 0x36, 0x40, 0xD9,
-0x64, 0x1C, 0x9C, 0xA8, 0xD4, 0x45, 0x4D, 0xC9, 0x28, 0x89, 0x91, 0x76, 0x14, 0xE4, 0x50, 0x2E, 0xEB, 0x0A, 0x67, 0x89, 0x2E,
-0x99, 0x9D, 0x2D, 0x66, 0x20, 0x0A, 0x92, 0x24, 0x8E, 0xCE, 0x3A, 0xEE, 0x5F, 0x2A, 0xE1, 0x66, 0xEB, 0xF9, 0xE0, 0x57, 0x65,
-0x35, 0xB7, 0x81, 0xC0, 0x7A, 0x3F, 0xFD, 0xD8, 0xA1, 0x7E, 0x20, 0xE4, 0xF7, 0x24, 0x0E, 0xAE, 0x48, 0xD1, 0x4B, 0x63, 0xE5,
-0xB1, 0xF4, 0x76, 0xCC, 0x32, 0xB8, 0x68, 0x40, 0x98, 0x06, 0x4F, 0xE8, 0x7D, 0x09, 0x27, 0xF4, 0xAF, 0x4E, 0x88, 0xFF, 0xF5,
-0xCB, 0xE2, 0x1F, 0x07, 0xBF, 0x5E, 0x96, 0x7B, 0xE0, 0x88, 0x9A, 0x07, 0x26, 0xAC, 0xE5, 0x1D, 0x2F, 0x5F, 0xEC, 0x3F, 0xF9,
-0x6F, 0x69, 0xC2, 0xB3, 0x9C, 0xAA, 0x2F, 0x2C, 0x9C, 0xE4, 0xA7, 0x1F, 0xAF, 0x92, 0x81, 0x04, 0xA7, 0x70, 0xCC, 0xD5, 0x5B,
-0xAF, 0x8E, 0x52, 0xC6, 0xFE, 0xBB, 0x48, 0xAC, 0x32, 0x11, 0x7D, 0x0A, 0xDA, 0xE8, 0x61, 0x1B, 0x6B, 0x46, 0x2A, 0xE3, 0x0D,
-0x07, 0xD1, 0xC2, 0xBD, 0xDC, 0x39, 0xEE, 0x79, 0xB2, 0x4F, 0x0D, 0xE8, 0xFE, 0x72, 0x90, 0x68, 0xC2, 0xFD, 0x62, 0x8E, 0x2D,
-0x6A, 0xD8, 0xBD, 0xBF, 0x5C, 0xB0, 0xB0, 0xAD, 0x92, 0xF1, 0x71, 0x9F, 0xE0, 0xA5, 0x4F, 0x9D, 0x6D, 0xE0, 0x95, 0x3B, 0x67,
-0x1F, 0x2C, 0x53, 0xDC, 0xC2, 0xA6, 0x53, 0x9A, 0x86, 0x61, 0x96, 0xA4, 0xE1, 0xEF, 0x78, 0x2D, 0x19, 0x49, 0x96, 0x91, 0x18,
-0x61, 0x16, 0xAD, 0x28, 0xA7, 0x2C, 0x93, 0xD2, 0x57, 0xE7, 0x3B, 0x21, 0xA3, 0xFD, 0x0B, 0xB6, 0x6A, 0x7E, 0xEC, 0x65, 0xF9,
-0xAB, 0x60, 0x0A, 0x34, 0x31, 0xFB, 0x6B, 0x39, 0xAD, 0x61, 0x5F, 0x26, 0xA1, 0x0D, 0x43, 0x71, 0xA4, 0x81, 0x27, 0x82, 0xD9,
-0x63, 0xBC, 0xFA, 0x94, 0x7D, 0xC2, 0x98, 0x9C, 0xC1, 0x95, 0x2D, 0x1A, 0xD1, 0x0C, 0xBF, 0x0D, 0x0D, 0x8E, 0x83, 0xF4, 0x8C,
-0xDC, 0x19, 0x10, 0x28, 0x42, 0xAF, 0x34, 0x6F, 0x6C, 0xD1, 0x9F, 0x5F, 0xE1, 0x5A, 0x31, 0x71, 0xFA, 0x67, 0xB2, 0xDB, 0xFD,
-0x6A, 0x85, 0xE6, 0xBD, 0x64, 0x3E, 0xCF, 0x9E, 0x4C, 0x0A, 0x9F, 0x3A, 0x7A, 0x9B, 0x0E, 0xC3, 0x86, 0xFD, 0xC2, 0x0F, 0x27,
-0x5E, 0x0E, 0x92, 0x0C, 0x37, 0xD1, 0xB8, 0x5A, 0x6B, 0xC9, 0xC2, 0xB5, 0xEE, 0x64, 0x46, 0xB5, 0x02, 0xF3, 0xF9, 0x32, 0xC6,
-0xF6, 0xB0, 0x25, 0x6A, 0xE5, 0x8E, 0x9A, 0x07, 0xB2, 0x48, 0x93, 0x63, 0xCC, 0xC1, 0x9A, 0x7D, 0x6D, 0x42, 0x74, 0x89, 0xD6,
-0x3F, 0xF4, 0x36, 0xFC, 0x55, 0x96, 0x61, 0x96, 0xC2, 0x8B, 0x5E, 0x7F, 0x73, 0xB5, 0xF4, 0xC6, 0x6A, 0xDE, 0x5F, 0x6F, 0x9A,
-0x95, 0xB2, 0x6E, 0xB0, 0xE8, 0xD7, 0x7C, 0xE6, 0xE9, 0xC6, 0x0F, 0xE7, 0xE2, 0xAC, 0xF0, 0xA1, 0xC8, 0x98, 0x13, 0x05, 0x32,
-0xBE, 0xDA, 0x7B, 0xEC, 0xCF, 0xA7, 0xCE, 0xE2, 0xAA, 0xAC, 0x03, 0x3C, 0xE3, 0x25, 0x0B, 0xB2, 0x65, 0xF4, 0x17, 0x79, 0x34,
-0xCD, 0x00, 0xC6, 0xE3, 0x3F, 0xB2, 0x11, 0xD0, 0xD8, 0x7F, 0x63, 0x16, 0x66, 0x11, 0x16, 0xF6, 0x94, 0xE6, 0x4D, 0x89, 0xCF,
-0x48, 0x42, 0x23, 0x8B, 0x69, 0x9E, 0x24, 0x95, 0x2E, 0x1B, 0xEB, 0x2A, 0xA1, 0xE4, 0xCB, 0x7D, 0x19, 0xE1, 0xCD, 0xB3, 0x5F,
-0xAC, 0xB5, 0x84, 0x29, 0x61, 0x80, 0x94, 0x47, 0x4F, 0x20, 0xD6, 0x44, 0x99, 0xC5, 0x39, 0x01, 0xF6, 0xAD, 0x64, 0x11, 0x30,
-0x0F, 0x97, 0x42, 0xDC, 0x23, 0x58, 0x16, 0x75, 0x97, 0x55, 0x74, 0xFC, 0x1F, 0x2D, 0x81, 0x00, 0x12, 0x5F, 0xA6, 0x21, 0xC8,
-0xCC, 0x39, 0xF0, 0x4A, 0xFE, 0x2B, 0xCC, 0x02, 0xC5, 0xE7, 0x88, 0xAD, 0x97, 0xAB, 0x77, 0x76, 0x2E, 0xE1, 0x73, 0xCF, 0x25,
-0x9D, 0x62, 0xBF, 0x42, 0xE9, 0x43, 0xC6, 0xE7, 0x17, 0x2C, 0xA9, 0x3F, 0x4F, 0x51, 0x1B, 0xF7, 0x62, 0x3A, 0xCD, 0x82, 0xFC,
-0x4A, 0x14, 0x98, 0x97, 0x31, 0x2C, 0xBA, 0x5A, 0x2D, 0x66, 0x2C, 0x0F, 0x6D, 0x97, 0xFD, 0x25, 0xE5, 0xFD, 0x03, 0x19, 0x9F,
-0xAD, 0x52, 0x5E, 0x7E, 0x46, 0x2B, 0x06, 0xCE, 0xF8, 0xB9, 0x1F, 0x9E, 0xEC, 0xE0, 0x5B, 0xD8, 0xAD, 0x96, 0x3D, 0x9F, 0x2E,
-0x53, 0xCA, 0xD8, 0x81, 0x41, 0x27, 0xDC, 0xF3, 0x17, 0x3F, 0x50, 0xCB, 0x06, 0xEA, 0xEB, 0x07, 0x32, 0x6F, 0xC7, 0x25, 0x0F,
-0x13, 0x28, 0x1B, 0x27, 0x39, 0x6C, 0x08, 0x53, 0xE4, 0xD3, 0xC6, 0x45, 0x61, 0xB5, 0x45, 0xC2, 0xFA, 0xF6, 0x08, 0xF2, 0x66,
-0x10, 0xDB, 0x88, 0x6A, 0x7D, 0x45, 0xEF, 0x55, 0x2B, 0x2C, 0x25, 0xB2, 0xC7, 0xB4, 0x61, 0xFB, 0xC9, 0x32, 0x9D, 0x04, 0x7F,
-0x32, 0xA2, 0xF7, 0xCB, 0x81, 0xB1, 0xEC, 0xE8, 0x54, 0xAA, 0xCD, 0xE8, 0x9B, 0x2F, 0x8F, 0xDC, 0x99, 0x0B, 0x84, 0x08, 0xA6,
-0x2B, 0xFA, 0x49, 0x6F, 0x33, 0x69, 0xE7, 0xB1, 0x0B, 0x29, 0x4B, 0xDB, 0xE7, 0x12, 0x96, 0x31, 0x86, 0x96, 0xE0, 0x7E, 0xA9,
-0x45, 0x12, 0x37, 0x8A, 0x36, 0x90, 0x83, 0xD0, 0xEF, 0x8F, 0xCA, 0x40, 0xAE, 0x48, 0x01, 0x17, 0x85, 0xF4, 0x40, 0xFB, 0x3D,
-0x35, 0xA3, 0x0C, 0x31, 0xA8, 0x25, 0x4A, 0xFE, 0x01, 0xA6, 0x32, 0xFF, 0x54, 0xD4, 0xEF, 0x9B, 0xB4, 0xF5, 0xC7, 0xD3, 0xBE,
-0x22, 0xD8, 0xD4, 0x8B, 0xD7, 0x15, 0x16, 0xD8, 0x57, 0x92, 0xFF, 0xE1, 0x92, 0x49, 0x1E, 0x34, 0xA1, 0x69, 0x3B, 0x83, 0x61,
-0x04, 0x42, 0x74, 0xDA, 0x91, 0x56, 0xD2, 0x36, 0x5B, 0x49, 0x4D, 0xF2, 0x58, 0x51, 0xD1, 0x84, 0x56, 0xDD, 0x8E, 0x82, 0x69,
-0xBE, 0x53, 0x6F, 0x15, 0xA8, 0x25, 0x58, 0x9A, 0x9E, 0x20, 0x89, 0x6A, 0x66, 0x82, 0xD4, 0x3E, 0x70, 0x2D, 0xEB, 0x46, 0xC6,
-0x34, 0xEF, 0xE7, 0x79, 0xC3, 0xDB, 0x32, 0x23, 0x09, 0x09, 0x26, 0xCB, 0x8C, 0x79, 0x82, 0x44, 0x9A, 0x73, 0x7B, 0x92, 0xB8,
-0xCB, 0x23, 0xF3, 0x26, 0x5D, 0xCA, 0xAF, 0x1C, 0xA7, 0x41, 0x94, 0x1C, 0x26, 0x3C, 0xC5, 0x32, 0xCD, 0xAA, 0xAC, 0xA4, 0x58,
-0xB4, 0xAE, 0x8E, 0x62, 0x9C, 0xA7, 0x3D, 0x96, 0x7F, 0x73, 0xFB, 0x06, 0x73, 0x3A, 0x42, 0xB1, 0x7B, 0x8D, 0xC1, 0xA6, 0xFE,
-0xE1, 0x25, 0x47, 0x8B, 0xA3, 0xF4, 0xF9, 0xF2, 0xA6, 0x66, 0xA6, 0xA8, 0x67, 0xA8, 0x1D, 0x30, 0xB4, 0xA9, 0x0F, 0xD8, 0xC2,
-0x24, 0x3E, 0xE9, 0xB0, 0xF3, 0x69, 0x74, 0x89, 0x61, 0x43, 0x6D, 0xF7, 0x30, 0x39, 0x86, 0x89, 0xED, 0xD7, 0x0E, 0x14, 0xCA,
-0xE9, 0x03, 0xC5, 0x24, 0x8E, 0x9F, 0x72, 0x60, 0xE3, 0xFC, 0x12, 0xE3, 0x52, 0x32, 0xE8, 0xD4, 0x8E, 0x6C, 0x9C, 0xEB, 0x03,
-0x7B, 0xC0, 0xEB, 0x5E, 0xFD, 0xE8, 0x2C, 0x6F, 0x80, 0x89, 0xAA, 0x0B, 0x1D, 0x3D, 0xEE, 0xC8, 0xA0, 0x26, 0x4B, 0x6E, 0xC1,
-0x2E, 0xD8, 0x09, 0x48, 0xEC, 0xEF, 0xDF, 0x4E, 0x92, 0xC5, 0xD9, 0x0E, 0xD9, 0x18, 0x6C, 0xDC, 0x24, 0xDF, 0xA3, 0x6A, 0x8C,
-0xEC, 0x27, 0xD3, 0x1C, 0x7D, 0x5D, 0x5D, 0x72, 0x80, 0x8A, 0xFA, 0x93, 0x24, 0x3D, 0xC2, 0xED, 0x2A, 0x82, 0x53, 0x50, 0x9C,
-0xC1, 0xCE, 0x46, 0xD3, 0x6B, 0x9A, 0xA8, 0xC3, 0xBB, 0x5B, 0x34, 0x46, 0xC5, 0x4D, 0x0D, 0xB3, 0xF4, 0x20, 0x06, 0x79, 0x9D,
-0xAC, 0x3F, 0x3E, 0xEB, 0xC5, 0x93, 0x5E, 0xE6, 0xF5, 0x6F, 0xB8, 0x03, 0x0B, 0x5E, 0xF7, 0x78, 0x5D, 0xB2, 0xC7, 0x2A, 0x13,
-0x98, 0xC2, 0x34, 0x1C, 0x2F, 0x69, 0x92, 0xDC, 0xE7, 0x49, 0x8C, 0xAF, 0x83, 0x74, 0x12, 0x7A, 0x51, 0x6F, 0x7F, 0x06, 0x5D,
-0xBB, 0x1F, 0x85, 0x47, 0x01, 0x01, 0x58, 0x2C, 0x5F, 0x11, 0xA6, 0x68, 0x9C, 0x14, 0x45, 0x68, 0xDA, 0x55, 0xAA, 0x8C, 0xE6,
-0xBD, 0xEF, 0xC2, 0xE6, 0x8D, 0xB1, 0xA4, 0xF1, 0x7A, 0x0D, 0x53, 0x6E, 0x30, 0xFD, 0x4B, 0x18, 0x93, 0xA3, 0x30, 0x47, 0xED,
-0x25, 0xA0, 0x27, 0x98, 0x63, 0x02, 0x3C, 0x7A, 0x12, 0xEB, 0xE2, 0x60, 0x17, 0x69, 0x32, 0x0B, 0xC7, 0xC0, 0xBF, 0x7D, 0x77,
-0xBD, 0xBD, 0x65, 0x1A, 0x25, 0xF4, 0x1E, 0xAF, 0x37, 0x4D, 0x12, 0x43, 0x7E, 0x52, 0xA7, 0x03, 0xBF, 0x83, 0x64, 0x13, 0x9B,
-0x52, 0x96, 0x9C, 0xAB, 0x07, 0xDD, 0x5B, 0x45, 0xAE, 0x2F, 0xF6, 0xBB, 0x3E, 0x57, 0x4F, 0xB6, 0x1C, 0xCF, 0x43, 0x34, 0xED,
-0x41, 0x8D, 0xEC, 0x7E, 0x90, 0x63, 0x67, 0xB2, 0xB5, 0x32, 0xF3, 0x88, 0xA7, 0x69, 0x18, 0x44, 0x3E, 0x88, 0xCD, 0xFC, 0x15,
-0xBC, 0x00, 0xEC, 0xD0, 0x07, 0x19, 0x05, 0xCA, 0xC6, 0x9A, 0xF8, 0x80, 0xFE, 0xD2, 0x1E, 0x1E, 0x97, 0xC3, 0xCB, 0x34, 0x99,
-0x2F, 0xF2, 0x67, 0xF8, 0x05, 0xE7, 0x7D, 0x1C, 0x02, 0xF5, 0x9C, 0x8E, 0x1C, 0x94, 0xE1, 0xA8, 0x45, 0xFC, 0x2C, 0xF4, 0xFD,
-0x20, 0x16, 0x39, 0x68, 0x78, 0x53, 0x3A, 0xCC, 0x9E, 0x0F, 0xF3, 0x9A, 0x1C, 0x12, 0xF9, 0x81, 0x53, 0x70, 0x20, 0xA5, 0x95,
-0x37, 0xEB, 0x89, 0xBC, 0x21, 0xBB, 0x15, 0x92, 0x00, 0x2D, 0x84, 0x67, 0x7E, 0x63, 0xAA, 0x66, 0x5B, 0x6A, 0x21, 0x2A, 0x26,
-0x3A, 0xBB, 0x78, 0x9A, 0x40, 0xE2, 0x7A, 0x88, 0xB6, 0x0D, 0xB3, 0x2D, 0xB5, 0x0E, 0x9F, 0x36, 0x35, 0x23, 0x4F, 0x39, 0x5D,
-0x3D, 0x38, 0xF1, 0x64, 0x41, 0x29, 0xA2, 0x02, 0x6F, 0x9A, 0x87, 0x45, 0x0B, 0x6A, 0x32, 0xE7, 0x3D, 0x5A, 0x74, 0xD7, 0x32,
-0x71, 0xC6, 0xB4, 0x19, 0xE3, 0xC1, 0xCB, 0x8D, 0x86, 0x39, 0x3B, 0x77, 0x85, 0xD8, 0x1B, 0xCA, 0xB6, 0x39, 0xC2, 0xCE, 0x9C,
-0xA0, 0x00, 0xB3, 0x7D, 0x45, 0x69, 0x3B, 0x65, 0x4F, 0x53, 0x0E, 0xFF, 0x07, 0x10, 0x4D, 0x1B, 0x66, 0x65, 0xB5, 0xCB, 0xA0,
-0x77, 0x41, 0xEA, 0x8A, 0x0B, 0x21, 0x0A, 0x53, 0x3E, 0x65, 0xE1, 0xEF, 0xC1, 0xF6, 0xD0, 0xDD, 0x4A, 0x83, 0x39, 0x74, 0x01,
-0xFA, 0x8E, 0x25, 0x1A, 0x74, 0xE5, 0x19, 0xB5, 0x5B, 0xBD, 0x44, 0x67, 0xEA, 0x57, 0x93, 0x6D, 0x9A, 0xAC, 0x1C, 0x62, 0x05,
-0x09, 0xE9, 0x59, 0xFD, 0x2A, 0x48, 0x69, 0x77, 0x0F, 0x3D, 0x4B, 0x2A, 0x12, 0x72, 0x35, 0x69, 0xA2, 0x60, 0x2A, 0x3C, 0x5D,
-0xD8, 0x1E, 0x7A, 0x2E, 0xA4, 0x73, 0x66, 0x84, 0x7D, 0xDF, 0xF7, 0x57, 0xD2, 0xA5, 0xFC, 0x54, 0xFE, 0x6E, 0xCA, 0x38, 0x84,
-0xD3, 0xC3, 0xC3, 0x25, 0x4D, 0xFA, 0x17, 0xFF, 0x69, 0xD8, 0x47, 0xE1, 0xEC, 0x24, 0x46, 0xF6, 0xF5, 0x31, 0x11, 0x7A, 0xB6,
-0xD7, 0x27, 0xC8, 0xB1, 0xF2, 0x16, 0x96, 0x9D, 0x06, 0x65, 0x07, 0xE1, 0x83, 0x52, 0x65, 0xA6, 0x2F, 0x2F, 0xC9, 0x7A, 0xD8,
-0xC5, 0x25, 0xBE, 0x66, 0x3C, 0xEF, 0xEC, 0x6E, 0xAE, 0x30, 0x3E, 0xB7, 0x2C, 0xDB, 0x3F, 0xE5, 0x22, 0x2D, 0xDD, 0x12, 0xAF,
-0x68, 0xA1, 0x66, 0x93, 0x34, 0x5C, 0x08, 0xB4, 0xC1, 0xA8, 0xB2, 0x9C, 0x78, 0x0B, 0x0C, 0x96, 0x90, 0x07, 0x64, 0x44, 0x3E,
-0x0A, 0x48, 0x3C, 0x50, 0xD7, 0x3E, 0x57, 0x07, 0x6D, 0x13, 0x9A, 0x0E, 0xAC, 0x5B, 0xF1, 0x19, 0x8E, 0x01, 0x15, 0x25, 0x30,
-0x3D, 0xF0, 0x36, 0x71, 0x1C, 0xFD, 0xFD, 0xDE, 0xAB, 0x7D, 0xDB, 0xEB, 0xA7, 0xF0, 0x6F, 0xBE, 0xF4, 0xA1, 0xCA, 0xC0, 0xF8,
-0x94, 0xC4, 0x87, 0xC6, 0x37, 0x11, 0x66, 0x9E, 0x65, 0xED, 0x55, 0x20, 0xAA, 0x9F, 0x5E, 0xFC, 0xB8, 0x4D, 0x90, 0xAD, 0x14,
-0x9F, 0xE5, 0xBB, 0x44, 0x19, 0x22, 0x06, 0x41, 0x35, 0x3A, 0x8D, 0x2F, 0x9F, 0xF8, 0xC6, 0x2B, 0xCC, 0xCC, 0x4E, 0x5F, 0x63,
-0x0A, 0x5F, 0xE5, 0x4B, 0x91, 0xAD, 0xDC, 0xAC, 0xE3, 0x19, 0xCD, 0x3D, 0xC5, 0x62, 0xE5, 0x2B, 0x38, 0xB6, 0x18, 0x1D, 0x80,
-0x77, 0x5A, 0xFB, 0xF0, 0x46, 0x03, 0x85, 0x6F, 0x0C, 0x48, 0x4F, 0x7C, 0x1C, 0xB9, 0x3A, 0x35, 0x45, 0x96, 0x63, 0x1D, 0x60,
-0x05, 0xAA, 0xA8, 0x41, 0x1D, 0x70, 0x6D, 0x8A, 0x79, 0xD2, 0xEF, 0x0F, 0x46, 0x78, 0xBE, 0xED, 0x92, 0xE1, 0x08, 0xC3, 0xAD,
-0x76, 0xC9, 0xC6, 0x08, 0x4E, 0x4B, 0xA2, 0x30, 0x10, 0xD3, 0x8F, 0xC1, 0x99, 0x02, 0x99, 0x5B, 0x6F, 0xED, 0xD7, 0x93, 0x94,
-0x5A, 0xCA, 0x06, 0x60, 0x2F, 0xCD, 0x54, 0x74, 0xFE, 0x6E, 0x74, 0x55, 0x98, 0x26, 0x1B, 0x1F, 0x80, 0xB3, 0x84, 0xFE, 0x73,
-0x2F, 0xC7, 0x9E, 0x1F, 0x24, 0x47, 0x41, 0x6C, 0xFB, 0xFE, 0xCA, 0x3F, 0x5C, 0xF5, 0x9D, 0xE7, 0xB0, 0xB0, 0x15, 0x29, 0xEF,
-0xE7, 0xE4, 0x39, 0x10, 0xC1, 0x9B, 0x7E, 0x0E, 0xD2, 0x4C, 0x1F, 0x17, 0x26, 0x54, 0x7B, 0x5C, 0xF3, 0xBD, 0x70, 0x11, 0xDC,
-0x26, 0x6F, 0xDE, 0x49, 0xD8, 0x60, 0x2C, 0x41, 0x79, 0xF9, 0x21, 0x43, 0xCC, 0xB2, 0x03, 0xC2, 0x36, 0xF9, 0x78, 0x5E, 0x7C,
-0xF0, 0xCA, 0x34, 0xC8, 0x4A, 0x05, 0xAE, 0x58, 0xCD, 0x0C, 0x28, 0x2F, 0xA5, 0x4E, 0x21, 0x24, 0xF6, 0xED, 0x7C, 0x47, 0x1C,
-0x92, 0x18, 0xCF, 0x80, 0x49, 0xC4, 0xFB, 0xD8, 0x4C, 0xE6, 0x19, 0xB8, 0xDA, 0xB6, 0x89, 0x9F, 0x4C, 0x96, 0xF8, 0xC9, 0x85,
-0x43, 0xE1, 0x23, 0x56, 0xEA, 0xC1, 0xD9, 0x13, 0xBF, 0x4D, 0x39, 0x7E, 0xC6, 0xBB, 0xE8, 0x74, 0xCA, 0x41, 0xD2, 0xD4, 0xB6,
-0x8C, 0xE2, 0x2B, 0xEB, 0x96, 0x85, 0xAC, 0x35, 0x29, 0xFF, 0x69, 0x50, 0x19, 0xAF, 0x2B, 0x3A, 0xC6, 0x12, 0x2E, 0x92, 0x93,
-0xD7, 0xC0, 0xC8, 0xA7, 0x91, 0x52, 0xB4, 0x12, 0x4C, 0x1D, 0x0C, 0xA5, 0xA0, 0x06, 0xA1, 0xE0, 0x18, 0x0D, 0x7B, 0x63, 0x96,
-0xAF, 0x07, 0xB8, 0xA2, 0x5F, 0x5A, 0x69, 0x09, 0x96, 0xBE, 0x2E, 0x2B, 0xC1, 0xA8, 0x05, 0x25, 0x08, 0x3A, 0x93, 0xAE, 0x84,
-0xA0, 0x16, 0x94, 0x20, 0x94, 0xE9, 0x08, 0x6B, 0x6A, 0x4B, 0x59, 0x0F, 0xCB, 0x9A, 0x52, 0x6C, 0xA6, 0x9A, 0xAA, 0x72, 0x04,
-0x27, 0x89, 0xBE, 0x8A, 0x30, 0x42, 0x75, 0xC4, 0x55, 0xC6, 0x1A, 0xD2, 0x6A, 0x3E, 0x8A, 0xFD, 0x55, 0xF5, 0x30, 0x40, 0x8F,
-0x54, 0x0B, 0x4E, 0xF9, 0x2C, 0x6D, 0x71, 0x5D, 0x3D, 0xBC, 0x36, 0x90, 0x66, 0x07, 0x73, 0x7F, 0xAF, 0xAC, 0x44, 0x4B, 0x19,
-0x58, 0x65, 0x97, 0xCC, 0x75, 0x2B, 0x96, 0xDD, 0x42, 0x97, 0x35, 0x68, 0x9A, 0xF7, 0x33, 0xCC, 0xAC, 0xBE, 0xB2, 0xC9, 0xB2,
-0xA8, 0x3C, 0x8F, 0x2C, 0x2D, 0x7B, 0xDD, 0x24, 0xB2, 0x12, 0x6A, 0x1D, 0xDC, 0xFA, 0x57, 0x30, 0x08, 0x5E, 0x4F, 0x94, 0x54,
-0xEB, 0xAF, 0x24, 0xBC, 0xA2, 0x8C, 0x8E, 0x59, 0xCE, 0x39, 0x9B, 0x21, 0x58, 0x24, 0x6E, 0x37, 0xC6, 0x2B, 0xA5, 0xA1, 0x5F,
-0x3D, 0x04, 0x39, 0x67, 0x7D, 0x09, 0x49, 0xF8, 0x24, 0xD7, 0xD4, 0x2F, 0xDC, 0x96, 0xA5, 0x19, 0x96, 0x5D, 0x63, 0xEB, 0x59,
-0xB3, 0xE4, 0x42, 0xAB, 0xB6, 0xFA, 0xEB, 0x8A, 0x26, 0x7F, 0x95, 0x71, 0xC6, 0xBD, 0x14, 0xEA, 0x30, 0x25, 0x1C, 0x19, 0x94,
-0x56, 0xD0, 0x2D, 0xAA, 0xBE, 0x1D, 0xEA, 0x38, 0xA5, 0xB7, 0xB4, 0xA2, 0x9A, 0xE4, 0x72, 0xD5, 0xA9, 0x10, 0xFC, 0x2A, 0xEB,
-0x2A, 0xBA, 0xE6, 0x8E, 0xBE, 0x6D, 0xAE, 0x98, 0x4A, 0xD9, 0x6A, 0xA9, 0x63, 0x15, 0x10, 0x2A, 0xAB, 0x4A, 0x5A, 0xBE, 0x8E,
-0x21, 0x08, 0x28, 0xA9, 0xCD, 0xEB, 0x98, 0x84, 0x35, 0x15, 0xBA, 0x44, 0x97, 0x7A, 0xBE, 0xF2, 0x3A, 0xB2, 0x34, 0x72, 0x9B,
-0x9B, 0x70, 0xF6, 0x0A, 0x91, 0x64, 0x25, 0x98, 0xE2, 0x40, 0x63, 0x8E, 0x4E, 0x8D, 0x57, 0xD3, 0x60, 0x78, 0x5A, 0x80, 0x9B,
-0x8E, 0x21, 0x22, 0x35, 0x05, 0x68, 0x0F, 0x39, 0x62, 0xEC, 0x22, 0xAB, 0xB1, 0xD5, 0xD2, 0x4A, 0xB6, 0x74, 0x18, 0xAB, 0x31,
-0xD5, 0x52, 0x0B, 0xB6, 0x3A, 0xBA, 0x00, 0x56, 0x59, 0x51, 0x16, 0xB0, 0x5A, 0x1D, 0xD7, 0xF3, 0xFD, 0x47, 0x98, 0xAF, 0x17,
-0x07, 0x15, 0xC0, 0x78, 0xDA, 0xAD, 0xA3, 0xE0, 0xCC, 0x4F, 0x4E, 0xE2, 0x56, 0x97, 0x4C, 0x97, 0x31, 0x25, 0x8D, 0x76, 0xD0,
-0x21, 0x1F, 0xD1, 0x2C, 0xA4, 0x1D, 0xB8, 0xF0, 0x95, 0x8C, 0x46, 0x23, 0xD2, 0xA2, 0xCE, 0x3A, 0xAD, 0x0E, 0x09, 0x5C, 0x9E,
-0xF1, 0xF7, 0x21, 0xF3, 0x23, 0x6C, 0x77, 0x76, 0xC8, 0x79, 0x47, 0x13, 0x04, 0x0B, 0xD6, 0xF9, 0x28, 0x4D, 0xF1, 0x32, 0xE1,
-0x65, 0x44, 0x8D, 0xCB, 0xE9, 0x7D, 0x0C, 0xF1, 0x98, 0xDC, 0xCC, 0x22, 0xC6, 0x27, 0x53, 0x9A, 0xFE, 0x51, 0x04, 0x78, 0x46,
-0x63, 0xBA, 0x29, 0xAD, 0x49, 0x92, 0xB8, 0x6B, 0x73, 0x3C, 0x42, 0x03, 0xAF, 0x32, 0x1C, 0xF4, 0x8E, 0xDC, 0xAA, 0x2A, 0x29,
-0x34, 0x69, 0x5A, 0xD4, 0xB8, 0x5C, 0xBB, 0xF9, 0xEF, 0x75, 0x6D, 0x31, 0xAF, 0x26, 0x66, 0x5A, 0x40, 0x6F, 0x61, 0x35, 0xCF,
-0x2A, 0x40, 0x3A, 0xB5, 0x11, 0x43, 0xBB, 0x84, 0xB7, 0xCE, 0x1E, 0xF3, 0xEE, 0x13, 0xE5, 0xDE, 0x3A, 0x84, 0xDF, 0x82, 0x40,
-0x07, 0x51, 0xEB, 0xF1, 0xD3, 0x8F, 0xF4, 0x9B, 0xD6, 0x03, 0x71, 0xC2, 0xA9, 0xEB, 0x87, 0xEC, 0x17, 0x6A, 0x6D, 0x53, 0x14,
-0x30, 0xDA, 0x94, 0xBC, 0x46, 0xA1, 0xF4, 0xC3, 0xC2, 0x34, 0xE8, 0x01, 0x1E, 0x01, 0xDF, 0x3A, 0x5A, 0x5F, 0x9E, 0xDD, 0xFF,
-0xEF, 0x7F, 0x3D, 0xF8, 0x69, 0xFF, 0x5F, 0xF7, 0x0F, 0xF6, 0x5E, 0xEC, 0x8F, 0x86, 0x03, 0xE5, 0x63, 0x76, 0x96, 0x41, 0x1F,
-0x47, 0xCE, 0xFE, 0x19, 0x90, 0xDF, 0x9C, 0xD0, 0xFE, 0x3A, 0x7A, 0x89, 0xE7, 0x54, 0x15, 0x52, 0xB6, 0x43, 0x68, 0x43, 0x8E,
-0x5C, 0x8A, 0x79, 0x7B, 0xBD, 0x0A, 0x16, 0x49, 0xA9, 0x9E, 0xF2, 0x16, 0xA1, 0x2B, 0x79, 0x81, 0x61, 0x3A, 0xA0, 0xAC, 0xC6,
-0x17, 0x2C, 0x0D, 0x28, 0x96, 0xB2, 0x7E, 0x84, 0x76, 0xDF, 0x68, 0x3D, 0x22, 0x37, 0x80, 0x16, 0x82, 0x85, 0xF8, 0xFB, 0xCC,
-0x5B, 0xC8, 0x47, 0x1A, 0x67, 0x0C, 0x9B, 0x62, 0x1A, 0x25, 0x89, 0x03, 0x47, 0xA1, 0x30, 0x1E, 0x63, 0x20, 0xDC, 0x6D, 0x07,
-0xF8, 0x73, 0x3E, 0xA3, 0xBF, 0x9D, 0x2E, 0xFC, 0xE4, 0x6F, 0x9F, 0x27, 0xA9, 0x78, 0x5B, 0x1E, 0xBF, 0x1C, 0xBC, 0x99, 0x4C,
-0xBD, 0x48, 0xA9, 0xFF, 0x3A, 0xC8, 0x72, 0xA3, 0xFA, 0x23, 0x4F, 0xBC, 0x94, 0x6B, 0x53, 0x33, 0x19, 0xA5, 0xF2, 0xFD, 0x38,
-0x0F, 0x7B, 0x7B, 0x68, 0x6E, 0x75, 0x12, 0x66, 0x81, 0x0C, 0xA1, 0x7C, 0x29, 0x41, 0xF0, 0x43, 0xA4, 0xBF, 0x49, 0x7E, 0xC1,
-0x0E, 0xCC, 0x3C, 0xD4, 0xC4, 0x65, 0x73, 0x40, 0x76, 0x0F, 0x2D, 0x3B, 0x2E, 0x08, 0xE6, 0xC3, 0x72, 0x1C, 0x82, 0xC0, 0xAB,
-0xD4, 0x96, 0xF0, 0x25, 0x55, 0x97, 0x70, 0x2B, 0xD5, 0x9F, 0x07, 0x79, 0x9A, 0x2C, 0x92, 0x28, 0xCC, 0xBD, 0xF8, 0xC2, 0x40,
-0xE2, 0x84, 0x9A, 0xB7, 0xC5, 0x17, 0x9E, 0xCB, 0x45, 0x38, 0x99, 0x78, 0x7E, 0x18, 0x45, 0x17, 0x45, 0x03, 0xB0, 0x14, 0x90,
-0xED, 0x42, 0xEF, 0xC2, 0x3D, 0x38, 0x01, 0x02, 0x46, 0x72, 0x5C, 0x7F, 0x2E, 0xF4, 0x5D, 0x44, 0xEC, 0x00, 0xDC, 0x1B, 0xA2,
-0x58, 0x00, 0x4F, 0xF1, 0x3A, 0x37, 0x6B, 0x47, 0xF4, 0x6A, 0xAB, 0x53, 0xAE, 0x04, 0xB6, 0x56, 0xE6, 0x74, 0x79, 0xE8, 0x2B,
-0xE6, 0x0D, 0x2B, 0xFD, 0x6E, 0x47, 0x2D, 0x0C, 0xAC, 0xE5, 0x09, 0xEB, 0x1E, 0xD4, 0x29, 0x76, 0xAD, 0xDF, 0x96, 0x41, 0x7A,
-0x26, 0x62, 0xD4, 0xB6, 0x5B, 0xDF, 0x58, 0x4E, 0x9F, 0x9C, 0x29, 0xBD, 0xE1, 0xD7, 0xC1, 0x7C, 0x8C, 0xCE, 0xBB, 0x56, 0xC7,
-0x6C, 0xE1, 0x05, 0x1F, 0xEC, 0xE5, 0x9A, 0x10, 0x28, 0xE3, 0x6D, 0x88, 0x56, 0x70, 0x63, 0x2C, 0x47, 0x21, 0x61, 0x83, 0x48,
-0x83, 0x73, 0x51, 0x05, 0xBF, 0xC7, 0x94, 0x0B, 0xD0, 0x0B, 0x44, 0xD1, 0x3D, 0xFC, 0xD7, 0xE5, 0xFD, 0x26, 0xDB, 0xC4, 0xE1,
-0x45, 0x9D, 0xA2, 0xFF, 0xE7, 0x5A, 0x13, 0x62, 0x18, 0x7A, 0x1B, 0xE2, 0x7D, 0x65, 0x23, 0xA2, 0xE7, 0xD8, 0x8A, 0x28, 0x6C,
-0x34, 0x73, 0x6E, 0xCC, 0xFA, 0x22, 0x59, 0x2C, 0x91, 0x1B, 0xA2, 0xD6, 0x2E, 0x63, 0xA8, 0x6A, 0xB3, 0x1B, 0x75, 0xCB, 0xAC,
-0xF3, 0xFB, 0xFC, 0x51, 0xA5, 0xE8, 0x51, 0xD4, 0xDC, 0x91, 0x87, 0x75, 0x8D, 0xBD, 0xEE, 0x90, 0x34, 0x00, 0x6E, 0x1C, 0xEF,
-0x94, 0xF7, 0x36, 0xF8, 0xDA, 0xA5, 0xDA, 0xF2, 0x1F, 0x0E, 0x9E, 0x3D, 0x05, 0xC0, 0x4E, 0xD9, 0x65, 0xDC, 0x81, 0x31, 0x92,
-0x00, 0x0D, 0x79, 0x0B, 0x9F, 0x06, 0x3B, 0xEC, 0xD7, 0x5D, 0xB2, 0x71, 0x83, 0xFD, 0xFC, 0xEE, 0x3B, 0x05, 0x4B, 0x05, 0x29,
-0xE0, 0xB8, 0xA4, 0x3E, 0x52, 0x1B, 0x86, 0x80, 0x77, 0x93, 0x9E, 0x21, 0xE8, 0xB5, 0xC4, 0x8E, 0x82, 0x5F, 0xB4, 0x00, 0xA4,
-0x34, 0x00, 0x35, 0x11, 0xB6, 0xF9, 0x55, 0x45, 0xFC, 0x3E, 0xDD, 0xCC, 0xDB, 0x58, 0xB4, 0xE3, 0x2E, 0x3C, 0x9F, 0x9E, 0xFC,
-0xDB, 0x1B, 0x5D, 0xE2, 0x0C, 0x9C, 0x0E, 0xF9, 0x8E, 0x38, 0xDB, 0x83, 0x81, 0x23, 0x01, 0xE1, 0x63, 0xF5, 0x16, 0x8B, 0x20,
-0xF6, 0xF7, 0x66, 0x61, 0xE4, 0xB7, 0x19, 0xDC, 0x4E, 0xF3, 0x39, 0x62, 0x87, 0x10, 0x3C, 0x8E, 0x5C, 0xE9, 0x14, 0x15, 0x88,
-0x9E, 0x87, 0x31, 0xDE, 0xE3, 0xF5, 0x6E, 0x02, 0xAA, 0xE9, 0xEF, 0xBB, 0x23, 0x32, 0xDC, 0xE0, 0x0F, 0x1A, 0xB2, 0x71, 0x5E,
-0x69, 0x99, 0xBF, 0x91, 0xE1, 0x16, 0x15, 0x17, 0x07, 0xE4, 0xDF, 0xFF, 0xE6, 0xEF, 0x76, 0xA1, 0x1E, 0xF9, 0xF6, 0xDB, 0x02,
-0xC8, 0x56, 0x47, 0xA9, 0x7B, 0x99, 0xA9, 0x2A, 0x74, 0x15, 0x93, 0x7C, 0xE9, 0x45, 0x3F, 0xF3, 0x19, 0x63, 0xCD, 0x62, 0x2F,
-0xA0, 0xBF, 0x1D, 0x58, 0x11, 0xC3, 0xE1, 0x1D, 0x58, 0x08, 0xF8, 0x56, 0xA9, 0xAB, 0x4D, 0xB4, 0x04, 0xC4, 0x56, 0x4C, 0x9D,
-0xF1, 0xB6, 0xD2, 0x24, 0x0E, 0xB8, 0xA3, 0xAA, 0xA2, 0xEE, 0xE1, 0xCE, 0x02, 0x72, 0x5E, 0x9B, 0x0B, 0x4E, 0x1D, 0xCD, 0x66,
-0x68, 0x9B, 0xBC, 0xBF, 0xFE, 0x51, 0x02, 0x72, 0xCE, 0x55, 0x5B, 0xD7, 0x3F, 0x3E, 0xF3, 0xF2, 0x99, 0xEB, 0x8D, 0x33, 0xB9,
-0x89, 0x0E, 0x1B, 0x0E, 0x40, 0x6D, 0xB5, 0xA0, 0x6A, 0x2B, 0x6B, 0x9D, 0xBF, 0x57, 0x3A, 0xD9, 0x80, 0xA2, 0x24, 0xF6, 0xB2,
-0x92, 0xB8, 0x8A, 0xA3, 0x0A, 0xD2, 0x57, 0xD6, 0x36, 0x08, 0x6B, 0x96, 0xEE, 0xAF, 0x22, 0xAD, 0x96, 0x6C, 0x02, 0x60, 0xF0,
-0xE8, 0x79, 0xDC, 0x1C, 0x00, 0x53, 0xDC, 0xB7, 0x2C, 0x34, 0x1A, 0x32, 0x4E, 0x10, 0x72, 0x36, 0x10, 0x6A, 0x64, 0x49, 0x08,
-0x16, 0x02, 0x3C, 0x54, 0x53, 0x55, 0x8B, 0x61, 0xA9, 0xD5, 0xD1, 0xA7, 0xBC, 0x20, 0x0B, 0xFC, 0x4D, 0x6D, 0xAA, 0x46, 0x24,
-0x74, 0xF3, 0x84, 0x2F, 0x75, 0x75, 0x99, 0xB7, 0x06, 0x1A, 0x80, 0x70, 0xDA, 0x16, 0x28, 0xEA, 0x14, 0xC8, 0xC2, 0xB3, 0x17,
-0xCE, 0x4A, 0xC7, 0xE4, 0xF7, 0xB6, 0x11, 0xE1, 0xC2, 0xFB, 0xA2, 0x46, 0x24, 0xE6, 0xAC, 0x53, 0xCC, 0x5E, 0xE5, 0x88, 0xAA,
-0x29, 0x4B, 0x9C, 0x60, 0x2B, 0x08, 0xCB, 0xE7, 0x1A, 0xE1, 0xD5, 0xD4, 0xA1, 0xEB, 0x90, 0xAB, 0xE8, 0x63, 0x8B, 0x62, 0x73,
-0xC4, 0xD0, 0x49, 0xBE, 0x43, 0xFE, 0x53, 0xC1, 0x7E, 0x2E, 0x83, 0xD3, 0xD0, 0xF8, 0xA2, 0xF2, 0x0B, 0x58, 0xEC, 0xA1, 0x58,
-0xE2, 0x99, 0xBA, 0x74, 0xD5, 0x21, 0xEB, 0x4B, 0xB8, 0x1A, 0xB5, 0x55, 0x6B, 0x75, 0x47, 0xFD, 0xAC, 0x21, 0x5C, 0xFB, 0x2A,
-0xEF, 0xF4, 0xCA, 0xAD, 0xF5, 0xCA, 0x72, 0xF4, 0x96, 0x5A, 0x2B, 0x25, 0xED, 0x49, 0xDA, 0x55, 0x99, 0x29, 0x61, 0xF2, 0x3B,
-0x11, 0x38, 0x64, 0xB7, 0xC3, 0xEC, 0x7E, 0x14, 0x25, 0x27, 0x81, 0xBC, 0x81, 0x09, 0x55, 0x92, 0x5B, 0xDE, 0x7F, 0xBB, 0x70,
-0x6A, 0xF1, 0xA8, 0x11, 0xDF, 0x88, 0x5C, 0x2B, 0xEA, 0xEC, 0x18, 0x35, 0xF4, 0x4B, 0x25, 0xA5, 0x5E, 0xD9, 0x18, 0xEE, 0x49,
-0x42, 0xC9, 0xED, 0x0A, 0x6A, 0x72, 0x59, 0xE4, 0x94, 0xBB, 0x5B, 0x9D, 0x6A, 0xB8, 0x05, 0xC2, 0x9B, 0x00, 0x2E, 0x6E, 0xA5,
-0x0C, 0xC8, 0xC5, 0x44, 0x7A, 0xD9, 0x59, 0x3C, 0x29, 0x11, 0x33, 0x0D, 0xF2, 0xC9, 0x8C, 0x7B, 0xB6, 0x2A, 0x2B, 0x24, 0x4F,
-0xCF, 0x4C, 0x09, 0x07, 0xCE, 0xB3, 0x0B, 0xF8, 0x41, 0x37, 0xB0, 0x13, 0x9A, 0x97, 0x0C, 0xAB, 0xB7, 0x5B, 0x7D, 0xF4, 0x53,
-0x44, 0xCD, 0x9D, 0x42, 0xB4, 0x54, 0x00, 0x13, 0x55, 0xDC, 0xE4, 0x48, 0x5B, 0x0A, 0x9A, 0x48, 0x26, 0x31, 0x28, 0x52, 0x8E,
-0x48, 0xE8, 0x08, 0x8B, 0x16, 0x0B, 0x78, 0xD8, 0x5C, 0x5B, 0x6E, 0x2E, 0x45, 0xD7, 0x87, 0xB4, 0x1C, 0x4B, 0x49, 0xCB, 0x64,
-0xE2, 0xA1, 0x2F, 0xDC, 0x47, 0xB9, 0xAC, 0xD2, 0x76, 0x25, 0x23, 0xD1, 0x61, 0xEA, 0x1C, 0x84, 0x5E, 0xED, 0x8C, 0xCC, 0xEE,
-0x4A, 0x02, 0x3C, 0x67, 0x35, 0x5E, 0xEE, 0xF1, 0xC2, 0xCD, 0xAE, 0x6C, 0x77, 0xE4, 0x2B, 0x5B, 0xAC, 0x59, 0x25, 0xAC, 0x5E,
-0x54, 0xA0, 0xD1, 0x04, 0x12, 0x09, 0xA2, 0x55, 0x06, 0x81, 0xD3, 0x20, 0x0A, 0x18, 0x71, 0x52, 0xBA, 0x34, 0x76, 0x1C, 0xB3,
-0x93, 0x76, 0x99, 0x40, 0x14, 0xA3, 0x45, 0x80, 0x61, 0x3E, 0xF2, 0x80, 0x6A, 0xD0, 0x18, 0x90, 0x8C, 0x76, 0x3F, 0x89, 0x1C,
-0x8D, 0xB0, 0xDD, 0x65, 0x1A, 0xAD, 0x92, 0xA5, 0x69, 0x39, 0xBC, 0x86, 0x92, 0x0A, 0xAE, 0x18, 0x0B, 0xA7, 0x98, 0x46, 0x0B,
-0x4B, 0x52, 0xA6, 0x5C, 0x7C, 0x6D, 0xA1, 0xFA, 0xBC, 0x37, 0x63, 0x50, 0x3E, 0xCD, 0x22, 0x93, 0x14, 0xF4, 0x8D, 0xD7, 0x99,
-0x32, 0xB4, 0x4B, 0x2C, 0x35, 0x0D, 0x6D, 0xC8, 0x80, 0x5F, 0x05, 0x78, 0x63, 0xF5, 0x80, 0xE9, 0xA2, 0xDA, 0xD8, 0xB9, 0x2E,
-0x35, 0x58, 0xEE, 0x12, 0x60, 0xFB, 0xF0, 0x0F, 0xCC, 0x83, 0xBE, 0x0E, 0x79, 0x66, 0xC1, 0xA7, 0xDA, 0x72, 0x94, 0x06, 0xA6,
-0xAD, 0x17, 0x2F, 0x02, 0x92, 0xF2, 0xCF, 0x1E, 0x9D, 0xC2, 0x57, 0x64, 0x2E, 0x12, 0x00, 0x37, 0x4B, 0x60, 0x4B, 0x11, 0xD4,
-0x49, 0x29, 0x04, 0xE1, 0x50, 0xA1, 0x18, 0x7F, 0xA8, 0x27, 0x4C, 0x05, 0x90, 0x74, 0xCE, 0x2C, 0x48, 0x3E, 0x28, 0xB8, 0xC4,
-0x1B, 0xD7, 0x75, 0xA5, 0x76, 0xCA, 0xBB, 0x0A, 0x4A, 0x6D, 0xCB, 0x38, 0x9B, 0x85, 0xD3, 0xBC, 0xFD, 0x91, 0xD8, 0x46, 0x5C,
-0x12, 0x1C, 0x11, 0xE0, 0x68, 0xAD, 0x0C, 0x4D, 0xE2, 0xDB, 0x83, 0xAE, 0x7A, 0x11, 0x5A, 0x96, 0xAD, 0x98, 0x63, 0xAC, 0x2B,
-0x75, 0xD2, 0x4A, 0x90, 0xE3, 0x28, 0x19, 0x43, 0x51, 0x0C, 0xB7, 0xF7, 0x00, 0x7E, 0xB6, 0x65, 0xB2, 0x7A, 0xF3, 0xCF, 0xFD,
-0x17, 0xCF, 0x5D, 0x76, 0xAD, 0x1C, 0x4E, 0xCF, 0xDA, 0x08, 0x0F, 0x63, 0xEE, 0x45, 0x51, 0x97, 0x6C, 0x74, 0x4A, 0x6B, 0x0E,
-0xFC, 0xEF, 0x23, 0xB5, 0x3A, 0x83, 0x73, 0x04, 0xF4, 0x25, 0x0A, 0x99, 0xE1, 0x5E, 0x9F, 0xD2, 0xB1, 0x4C, 0x8C, 0x32, 0x9B,
-0x10, 0x3D, 0xC0, 0x6B, 0x6C, 0x74, 0x67, 0xE4, 0xBD, 0x78, 0xCC, 0x1F, 0x15, 0x6A, 0x14, 0x65, 0xF8, 0x6A, 0x6D, 0xB7, 0xA6,
-0x61, 0x14, 0xB4, 0xBA, 0xB4, 0xF7, 0x20, 0x59, 0xDA, 0x17, 0x4F, 0xE3, 0xB5, 0xB7, 0x5C, 0x44, 0x89, 0xE7, 0x03, 0x38, 0x65,
-0x51, 0xCD, 0x83, 0x7C, 0x96, 0xF8, 0x30, 0xA2, 0x97, 0x2F, 0xF6, 0x0F, 0x5A, 0xCA, 0x60, 0xD1, 0xCC, 0x71, 0xBB, 0xE8, 0x94,
-0xB4, 0xEC, 0xD4, 0x66, 0x57, 0xAC, 0x5A, 0xD6, 0x89, 0x31, 0xEC, 0xF1, 0x01, 0x48, 0xC8, 0xCE, 0x63, 0x2F, 0x8C, 0x58, 0x46,
-0x4C, 0x5C, 0x1E, 0x04, 0xA7, 0x98, 0xF0, 0x31, 0xE1, 0x4B, 0x96, 0xE8, 0xD2, 0xE9, 0xB2, 0xEB, 0x6E, 0x55, 0x6C, 0xAC, 0x5E,
-0xFF, 0x62, 0xA9, 0xB6, 0x03, 0xA8, 0x23, 0x37, 0x5F, 0xD9, 0x38, 0x43, 0x86, 0xD2, 0xFC, 0x36, 0x71, 0xC8, 0x77, 0x04, 0x20,
-0xB8, 0xDC, 0x9F, 0xDD, 0xE8, 0x44, 0xD1, 0x5E, 0x35, 0xDB, 0x30, 0xB7, 0xDD, 0x69, 0x18, 0xFB, 0x28, 0xAC, 0xF9, 0x32, 0x13,
-0x58, 0xB9, 0xF9, 0xDA, 0x56, 0x3B, 0x1B, 0x3F, 0xDF, 0x78, 0x00, 0x6A, 0xDD, 0xBA, 0xC6, 0x5B, 0x04, 0x24, 0xE1, 0x9D, 0x7A,
-0x69, 0xA0, 0x82, 0xA9, 0x37, 0xEF, 0x13, 0x9D, 0x7C, 0xDA, 0x23, 0x26, 0xA5, 0x29, 0xD8, 0x47, 0x1F, 0x4F, 0x5D, 0x11, 0xEF,
-0x74, 0x99, 0xA1, 0x9A, 0xCA, 0x85, 0x75, 0xB6, 0xBA, 0xBE, 0xC0, 0x61, 0x53, 0xF7, 0xFF, 0xF1, 0x72, 0x07, 0x33, 0x0B, 0x86,
-0x2F, 0xFC, 0x58, 0xE6, 0xA1, 0x67, 0x2B, 0x6E, 0xD7, 0x94, 0xF0, 0x26, 0x89, 0x1F, 0x00, 0x1F, 0xFD, 0xC2, 0x45, 0x0F, 0x9C,
-0xF6, 0xC6, 0xB2, 0x07, 0xDE, 0xD9, 0x91, 0x36, 0x2E, 0xA4, 0x92, 0x28, 0xE1, 0x55, 0xC7, 0xB9, 0xB0, 0x50, 0x52, 0x49, 0x46,
-0x68, 0x2D, 0x58, 0xBD, 0xEC, 0x66, 0x5E, 0xEC, 0x47, 0x81, 0x54, 0x83, 0x9F, 0xC1, 0x0C, 0x2A, 0x67, 0xEB, 0x46, 0x3A, 0xAC,
-0x18, 0x84, 0xC4, 0xD0, 0xA1, 0x11, 0x0B, 0x72, 0x2F, 0x3C, 0xBE, 0xD8, 0x97, 0xB7, 0x76, 0xE9, 0x7D, 0x8D, 0x96, 0xB6, 0xEC,
-0xA8, 0x7A, 0xAB, 0x05, 0xE6, 0x69, 0x05, 0x15, 0xF5, 0xC5, 0x3A, 0xA4, 0x76, 0xA8, 0xAB, 0xCB, 0xA0, 0x32, 0xB0, 0x28, 0xA5,
-0xC8, 0x85, 0x72, 0xA9, 0xA7, 0x5E, 0x5E, 0x14, 0x82, 0x0D, 0xDA, 0x5E, 0x86, 0x92, 0x11, 0x2F, 0x93, 0xC4, 0x15, 0x3D, 0x7A,
-0xF1, 0x23, 0x14, 0xC2, 0x49, 0xA9, 0x18, 0x9F, 0x30, 0x26, 0x52, 0x17, 0xE1, 0x53, 0x6E, 0xFE, 0xBE, 0x4D, 0xEE, 0x8E, 0x77,
-0x91, 0x6E, 0xCA, 0xFE, 0x22, 0xE1, 0xDC, 0xED, 0xC3, 0xDB, 0x1D, 0xCD, 0x70, 0x00, 0x8F, 0xBE, 0xF2, 0xEC, 0xC3, 0xA6, 0x4F,
-0x5D, 0xDD, 0x1F, 0x08, 0xE5, 0xF9, 0x83, 0xE4, 0xB4, 0xBD, 0x4A, 0xA8, 0x65, 0x04, 0xB2, 0x27, 0x59, 0x1A, 0x5D, 0x5C, 0xAC,
-0xF5, 0x83, 0xE8, 0xDE, 0x74, 0x54, 0x2B, 0xDD, 0x16, 0xD2, 0x64, 0xB9, 0x8B, 0x54, 0xC8, 0x33, 0x6F, 0xDE, 0xED, 0xAC, 0xB1,
-0xCF, 0x68, 0xA3, 0xA2, 0x1A, 0x6B, 0xBC, 0xBC, 0xD8, 0xFF, 0x99, 0xA1, 0xA2, 0x4D, 0x83, 0x9F, 0x74, 0x71, 0x5F, 0x4B, 0x52,
-0x9E, 0x76, 0xDB, 0x58, 0x03, 0x20, 0xFB, 0x60, 0x02, 0x0C, 0x5C, 0xC8, 0x58, 0xDA, 0xC5, 0xE7, 0xB6, 0x41, 0xC4, 0xBC, 0x94,
-0x8D, 0xD3, 0xF3, 0xAD, 0x49, 0xD9, 0xF8, 0x93, 0x23, 0xCD, 0xA2, 0x97, 0x1B, 0xFE, 0x2E, 0xA9, 0x2D, 0xB6, 0xB4, 0x8B, 0xDB,
-0x18, 0x3F, 0x36, 0x28, 0xDA, 0x63, 0x1E, 0x8A, 0x41, 0xD6, 0x6E, 0x39, 0xAD, 0x4E, 0xCD, 0xF6, 0xDE, 0x7A, 0x98, 0x2C, 0x31,
-0x05, 0xCA, 0x6F, 0xCB, 0x04, 0xF3, 0xAC, 0xB6, 0x9D, 0x0E, 0x8D, 0x34, 0x40, 0x43, 0x6B, 0xF0, 0x0B, 0x86, 0x90, 0x05, 0x1B,
-0x12, 0xD6, 0x0B, 0x7D, 0xC9, 0x82, 0x82, 0x5B, 0x31, 0x64, 0x6E, 0xCB, 0xDC, 0x9A, 0xCC, 0x81, 0xD1, 0x3D, 0x6C, 0xC5, 0x18,
-0xB8, 0x38, 0x9F, 0x1D, 0xBF, 0x0A, 0x0E, 0x83, 0x53, 0x40, 0x6E, 0xFF, 0x7F, 0xDE, 0xFC, 0x4F, 0xF7, 0x6D, 0xF6, 0xEE, 0xBB,
-0xF6, 0xDB, 0xEC, 0xEF, 0xF0, 0xE3, 0xEF, 0xFC, 0xB1, 0xF3, 0xF7, 0xEB, 0x7D, 0x75, 0x47, 0x15, 0x95, 0x5C, 0x54, 0xB0, 0x0B,
-0x44, 0xD4, 0x8D, 0x5D, 0x99, 0xDE, 0x2B, 0xEA, 0xBF, 0x59, 0xD7, 0x32, 0xA5, 0x7C, 0x42, 0x79, 0x17, 0x0B, 0x28, 0x0D, 0xC9,
-0xF4, 0xA5, 0x62, 0x78, 0x62, 0x32, 0x67, 0x16, 0xD1, 0x47, 0xE2, 0xCE, 0xAA, 0xA5, 0x8A, 0x95, 0x33, 0xC3, 0x2A, 0x45, 0x7B,
-0x0B, 0xB1, 0x46, 0x2B, 0x57, 0x84, 0xC5, 0xE8, 0x45, 0x53, 0xB8, 0x31, 0x48, 0x54, 0xA4, 0x2D, 0xD6, 0xAA, 0xEE, 0x07, 0x81,
-0x5B, 0x00, 0xE2, 0x52, 0xBA, 0xF5, 0x02, 0x06, 0xF1, 0xD1, 0x72, 0x32, 0xB5, 0xD4, 0xE4, 0xDC, 0x72, 0x45, 0x51, 0x28, 0xC8,
-0x7B, 0xA2, 0x0E, 0xF7, 0xBC, 0x19, 0x8E, 0x0B, 0xAE, 0xD8, 0x00, 0xBD, 0x85, 0xF9, 0xD1, 0xA5, 0x30, 0xAB, 0x1A, 0x31, 0x35,
-0x40, 0xAA, 0xE4, 0x2C, 0xD1, 0x1C, 0x9F, 0x6A, 0xA5, 0x2A, 0x54, 0x16, 0xA5, 0x2E, 0x89, 0xC5, 0x83, 0x5F, 0x4D, 0xF4, 0xA5,
-0xC5, 0xBA, 0x6E, 0xBF, 0xB9, 0xDF, 0xFB, 0xD5, 0xEB, 0xFD, 0xFE, 0xEE, 0xE3, 0x66, 0xF7, 0xBC, 0xD3, 0x7E, 0xF3, 0x5D, 0xEF,
-0xDD, 0xBD, 0xF6, 0xBD, 0xED, 0x37, 0x83, 0xDE, 0x9D, 0x77, 0xFF, 0x1E, 0xC2, 0x9F, 0x1B, 0xEF, 0x3A, 0xF0, 0x8C, 0x2F, 0xB6,
-0xDE, 0xD1, 0xB7, 0x9D, 0x7B, 0xFA, 0x33, 0xBC, 0x51, 0xA0, 0x60, 0x81, 0xEE, 0xB3, 0xF6, 0xE0, 0xDE, 0x9B, 0xA1, 0x80, 0xB2,
-0xF1, 0xAE, 0xF3, 0xD6, 0x45, 0xB8, 0x43, 0x00, 0xF8, 0xEF, 0x2D, 0x78, 0x80, 0x97, 0x37, 0xDF, 0xC1, 0x9B, 0xB7, 0x7D, 0xA5,
-0x39, 0xF8, 0xB3, 0xC1, 0x5A, 0xED, 0xDC, 0xBB, 0x0A, 0x18, 0x9D, 0x7B, 0x12, 0x87, 0x62, 0x83, 0x17, 0x92, 0x4A, 0x41, 0x3B,
-0xC2, 0x14, 0x95, 0xE1, 0xB7, 0xDC, 0x43, 0xB4, 0x09, 0x41, 0x37, 0x13, 0x7D, 0xBE, 0x28, 0x61, 0xB0, 0x6A, 0x62, 0x73, 0xD1,
-0xCE, 0x04, 0x58, 0x22, 0x2D, 0x39, 0x22, 0x2D, 0xDB, 0x31, 0x4A, 0xE9, 0x8D, 0xA8, 0x94, 0xA4, 0x72, 0x4C, 0x6E, 0x7B, 0xD6,
-0x74, 0x43, 0xFD, 0x81, 0xDB, 0x78, 0xD5, 0x52, 0xC1, 0xBD, 0x6B, 0xBD, 0x0E, 0x9F, 0x43, 0xC4, 0x1F, 0xA2, 0xB3, 0x78, 0xEA,
-0xBD, 0xFB, 0x38, 0xE8, 0xDE, 0x1C, 0x9E, 0x4B, 0xDF, 0x9B, 0x63, 0x15, 0x5B, 0x5F, 0x81, 0xD7, 0xD2, 0x57, 0xE7, 0x93, 0x63,
-0x57, 0x69, 0xAA, 0x0E, 0xC7, 0x8A, 0x75, 0x9D, 0x81, 0x69, 0x2E, 0x48, 0x2F, 0xC7, 0xEC, 0xEE, 0xE5, 0x19, 0xCA, 0x47, 0x74,
-0x9D, 0x02, 0x8E, 0xE5, 0x03, 0x0D, 0xDF, 0x87, 0xDA, 0xBF, 0x75, 0xC9, 0x64, 0xDC, 0xD1, 0xCE, 0x3A, 0xD8, 0xF5, 0xDF, 0xF8,
-0xB8, 0xC8, 0x2E, 0xD9, 0xD0, 0x6E, 0x1F, 0xAE, 0xBB, 0xDE, 0x07, 0xEF, 0xB4, 0xFD, 0x51, 0xD5, 0x21, 0x2F, 0xD3, 0x68, 0x9B,
-0xB4, 0xFA, 0xDC, 0x15, 0x6E, 0x11, 0x4E, 0x8E, 0x82, 0xF4, 0xDE, 0x6F, 0xA3, 0x16, 0x9E, 0xFF, 0x63, 0x3C, 0x95, 0xFD, 0xF4,
-0xEA, 0xC9, 0x5E, 0x32, 0x07, 0x61, 0x0F, 0x0F, 0x4A, 0xBF, 0x75, 0xBA, 0x6A, 0xF5, 0xE2, 0xCE, 0xE4, 0xFB, 0x47, 0xDA, 0x95,
-0x09, 0x1C, 0x56, 0x96, 0x93, 0x09, 0x75, 0xAC, 0x28, 0x28, 0xA8, 0x8D, 0xE7, 0x1D, 0xAD, 0x5B, 0xD2, 0xF0, 0x59, 0x1F, 0xF0,
-0xDE, 0x0E, 0xCB, 0xB9, 0x0B, 0xEF, 0x0C, 0x6F, 0x26, 0x5C, 0xF1, 0xDE, 0x65, 0x62, 0x49, 0x3B, 0xC3, 0x71, 0x67, 0xEE, 0xD1,
-0x98, 0xF9, 0x16, 0x5E, 0xA3, 0x9A, 0xF3, 0x1D, 0x03, 0xE6, 0xB8, 0x2D, 0x2A, 0xEA, 0x1F, 0xCF, 0xB5, 0x8E, 0x52, 0x89, 0x41,
-0xEE, 0xE6, 0xE9, 0x2C, 0xED, 0xD2, 0xEE, 0x2C, 0x33, 0x2E, 0x2E, 0x56, 0x74, 0x3A, 0x89, 0x02, 0x97, 0x7E, 0x6F, 0xBF, 0xE7,
-0xDE, 0x29, 0x4C, 0x10, 0x06, 0x52, 0xC0, 0xEB, 0x95, 0x6D, 0x72, 0xFD, 0x23, 0x03, 0x73, 0x4E, 0x7A, 0xF0, 0x9B, 0x16, 0x3D,
-0x7F, 0x6F, 0xED, 0xEC, 0x9B, 0x77, 0x46, 0x37, 0xE5, 0xC7, 0x73, 0x45, 0x09, 0x6F, 0x6C, 0x05, 0x16, 0x10, 0xE7, 0x86, 0x04,
-0xB2, 0x53, 0x4F, 0x6E, 0x07, 0xD3, 0xA7, 0x9F, 0x8F, 0xE2, 0x64, 0x83, 0x4B, 0x29, 0x4C, 0xCC, 0x7E, 0x9E, 0x2C, 0x5E, 0x62,
-0xF8, 0xAA, 0xFE, 0x3E, 0xF5, 0xAD, 0xEA, 0x57, 0x12, 0x22, 0xBC, 0x6F, 0xDD, 0xA3, 0xF9, 0xF1, 0x46, 0x68, 0x85, 0xD5, 0xF5,
-0xA3, 0xF4, 0xDB, 0xB9, 0x77, 0xFA, 0x8A, 0x6E, 0x6C, 0xD9, 0x68, 0x38, 0xF8, 0x76, 0x0A, 0x22, 0x6F, 0x86, 0x31, 0xB8, 0x46,
-0x8F, 0x71, 0x61, 0x7E, 0xCB, 0x85, 0xE7, 0x1F, 0x60, 0xD8, 0xFC, 0x0D, 0x2C, 0xE3, 0x7F, 0x1D, 0x05, 0x67, 0x94, 0xDA, 0xCB,
-0x23, 0x08, 0xF5, 0x33, 0xFC, 0x8C, 0x74, 0x3E, 0xA7, 0xE8, 0xFF, 0xC2, 0xC9, 0xFB, 0xA7, 0xEF, 0xC9, 0xD7, 0x44, 0xE1, 0xD7,
-0xDB, 0xE5, 0x70, 0xA5, 0xC1, 0x5D, 0x6F, 0xB7, 0xDE, 0x54, 0xC5, 0x84, 0x7B, 0xD7, 0xEA, 0xB8, 0xFC, 0x77, 0x79, 0xB6, 0xEC,
-0x48, 0x10, 0x4B, 0x75, 0x72, 0xE1, 0xF6, 0x07, 0x35, 0xCE, 0x16, 0x81, 0x87, 0xBA, 0xB3, 0x92, 0xCC, 0x63, 0xEA, 0x50, 0xD4,
-0x12, 0xD3, 0x53, 0x92, 0x0B, 0x0F, 0x6A, 0x67, 0x2C, 0xBC, 0xB6, 0xE4, 0xC9, 0x11, 0x60, 0x8C, 0x0C, 0xB2, 0x39, 0x28, 0xFD,
-0x3C, 0x99, 0x19, 0xA5, 0x32, 0x81, 0x78, 0xA1, 0xA4, 0x4C, 0x19, 0x3B, 0xC1, 0x6B, 0x7E, 0xB0, 0xAC, 0x98, 0x79, 0x02, 0xC2,
-0xD7, 0xA5, 0xCC, 0x57, 0x7A, 0xB8, 0x86, 0x87, 0xB3, 0x08, 0x1D, 0xDD, 0x56, 0xB4, 0xC5, 0xA1, 0xB4, 0xCA, 0x28, 0x47, 0x21,
-0x0D, 0xE0, 0xC5, 0x62, 0x1C, 0xA9, 0xE9, 0x47, 0xA9, 0xE3, 0xDC, 0xF6, 0xCD, 0xC5, 0xA9, 0xB3, 0xDB, 0xE2, 0x17, 0x61, 0x86,
-0xB4, 0x69, 0x45, 0xB1, 0xEA, 0xF2, 0xF7, 0x65, 0xA1, 0x79, 0xCF, 0xEA, 0x75, 0xFC, 0xD9, 0xB0, 0x1D, 0xA7, 0x57, 0x8B, 0x6A,
-0xC5, 0x89, 0xF5, 0x6A, 0x30, 0x0D, 0x80, 0xAE, 0x0A, 0xD9, 0x00, 0xEA, 0x8F, 0x42, 0x34, 0x6E, 0x2B, 0x57, 0x80, 0xEA, 0x02,
-0xD1, 0x78, 0x8C, 0x35, 0x7D, 0x67, 0x44, 0x28, 0xA6, 0xAE, 0x2E, 0x6E, 0xB7, 0xE5, 0xCB, 0x29, 0x8B, 0xC7, 0x8C, 0x22, 0xD3,
-0xDA, 0x8E, 0x82, 0x1D, 0x4D, 0x04, 0xAD, 0x3A, 0x8B, 0x52, 0x4E, 0xAB, 0x42, 0xD1, 0x0F, 0xE8, 0x3A, 0xA8, 0xDA, 0x0B, 0x03,
-0x0B, 0x3C, 0x3C, 0x84, 0x74, 0xEA, 0x4F, 0x1D, 0xD6, 0x7A, 0xA5, 0x78, 0xDD, 0x69, 0x22, 0x4F, 0x73, 0x18, 0x9C, 0x1B, 0xE2,
-0xDD, 0xA8, 0x85, 0x91, 0x5B, 0x08, 0xDF, 0x32, 0x2B, 0xD3, 0x04, 0x8E, 0x1B, 0x30, 0x29, 0x4C, 0x1C, 0xB2, 0xD5, 0xC9, 0xF8,
-0x2D, 0xBA, 0x68, 0xA2, 0x19, 0xDC, 0x71, 0xB4, 0x4C, 0x0B, 0xB0, 0xDC, 0xD0, 0x29, 0x59, 0xC2, 0x78, 0x64, 0x0E, 0xFE, 0x14,
-0x06, 0xF7, 0x18, 0x3B, 0xD0, 0x25, 0x5B, 0x83, 0x81, 0xD9, 0x82, 0xCA, 0x1D, 0x9B, 0xF7, 0x5E, 0xAB, 0x57, 0x39, 0x82, 0x95,
-0xF0, 0xEB, 0x47, 0xA1, 0x32, 0xC8, 0x55, 0x83, 0xD1, 0xEE, 0xB1, 0x2A, 0x1B, 0xB3, 0x5F, 0x94, 0xD5, 0x60, 0x1F, 0x58, 0xC7,
-0x45, 0x26, 0x16, 0xAB, 0x35, 0x98, 0x5B, 0x3B, 0xF4, 0x7A, 0xC4, 0x94, 0xCC, 0x6C, 0x15, 0x52, 0x54, 0x8F, 0x7E, 0x4B, 0x43,
-0x2C, 0xB9, 0x1A, 0x36, 0x15, 0xA8, 0x52, 0x79, 0xB9, 0xE6, 0x8A, 0x38, 0x22, 0x78, 0x88, 0x76, 0x59, 0x30, 0x3D, 0xED, 0xC6,
-0x87, 0x9A, 0x3A, 0xD8, 0x2A, 0x80, 0xD0, 0x49, 0x63, 0x8F, 0x58, 0x94, 0x98, 0xF6, 0x10, 0x01, 0x16, 0x5D, 0xA6, 0x02, 0xB8,
-0xA8, 0xA2, 0x2A, 0x07, 0xB5, 0x21, 0x6B, 0x80, 0x6D, 0xEA, 0x44, 0x53, 0x32, 0xB4, 0xFB, 0x99, 0x58, 0x86, 0x25, 0x77, 0xAE,
-0x7E, 0x2C, 0xAA, 0x4A, 0x45, 0xE6, 0xE9, 0x2B, 0xBB, 0xDC, 0x60, 0xAA, 0xAA, 0x31, 0xA3, 0x4D, 0x93, 0xA5, 0x49, 0x29, 0xA0,
-0x40, 0x5D, 0x53, 0x4C, 0xB8, 0xA5, 0xC5, 0x84, 0xBB, 0x4A, 0x66, 0xC0, 0x2A, 0xE3, 0x1A, 0xD4, 0x81, 0x62, 0xA4, 0xFB, 0xA0,
-0x28, 0xBB, 0x47, 0x3F, 0x98, 0x3C, 0xA3, 0x8C, 0x17, 0x60, 0x83, 0x16, 0x85, 0x93, 0xA3, 0x02, 0xD8, 0x5E, 0x19, 0x35, 0xC0,
-0x80, 0xA3, 0x47, 0x02, 0x58, 0x09, 0xEC, 0xE7, 0xA2, 0x82, 0xBD, 0x4F, 0x8A, 0xA7, 0x7D, 0xB3, 0xAE, 0xF1, 0x2A, 0x26, 0xC2,
-0x4C, 0x85, 0xA8, 0xE9, 0x0B, 0xCB, 0x10, 0xD7, 0xEA, 0x56, 0xE9, 0x5D, 0x6D, 0x50, 0x9B, 0xF2, 0xBE, 0xE2, 0x02, 0xDB, 0x00,
-0x22, 0x7C, 0xF4, 0x6B, 0xE9, 0x8F, 0x93, 0x1F, 0xA3, 0x7D, 0x25, 0x13, 0x38, 0x86, 0xB3, 0xDC, 0x43, 0x77, 0xCE, 0x40, 0xF1,
-0xF7, 0xEF, 0xEC, 0x9C, 0x5B, 0x5B, 0xFA, 0xB5, 0x79, 0x33, 0x72, 0x86, 0x42, 0xA3, 0x95, 0x5F, 0xB1, 0x09, 0xB6, 0xE7, 0x5B,
-0xBE, 0x00, 0x8C, 0x8A, 0x2B, 0x55, 0xC6, 0x12, 0xEC, 0x37, 0xA9, 0xC0, 0x21, 0xCC, 0x4E, 0x17, 0xD5, 0x57, 0xA2, 0xF8, 0xE0,
-0x57, 0xDB, 0x88, 0xE9, 0xAD, 0xE3, 0x9A, 0x63, 0x16, 0x59, 0x5D, 0xF5, 0x51, 0xB3, 0xB0, 0x01, 0xF6, 0x71, 0xF3, 0x6F, 0xE6,
-0xC8, 0xCB, 0x6B, 0x4F, 0x7D, 0xEC, 0xE6, 0x6D, 0x67, 0x0D, 0x06, 0x2A, 0xC6, 0xA1, 0xE1, 0x40, 0xDC, 0xF0, 0x1A, 0x40, 0xCA,
-0x18, 0x02, 0x4D, 0x90, 0x41, 0xBD, 0xBF, 0x2D, 0x55, 0xD9, 0x30, 0xAE, 0xE1, 0x38, 0x60, 0xA4, 0xC5, 0x40, 0xCA, 0x12, 0x30,
-0x90, 0x85, 0x97, 0x66, 0xC1, 0x93, 0x38, 0xAF, 0x06, 0xD0, 0xA1, 0x38, 0x88, 0xCE, 0x1E, 0x88, 0x20, 0x52, 0xD4, 0x8B, 0xBC,
-0x92, 0x63, 0x16, 0x36, 0xD4, 0x35, 0x2B, 0x56, 0xDF, 0x4B, 0x09, 0x77, 0x60, 0xE7, 0x4C, 0x79, 0xC2, 0x26, 0xCA, 0xB8, 0x2C,
-0xD1, 0x9A, 0x2A, 0x6C, 0xC6, 0x79, 0x79, 0xE3, 0x66, 0xB8, 0x66, 0x47, 0xD1, 0x20, 0x7C, 0xF2, 0xBE, 0x96, 0x68, 0x69, 0xD6,
-0x59, 0xF6, 0x13, 0xAD, 0x1F, 0xD1, 0x83, 0x9C, 0x06, 0x5C, 0x7C, 0x12, 0xC3, 0xC1, 0x30, 0x9E, 0x04, 0x06, 0x5B, 0x33, 0x4C,
-0xDD, 0x2D, 0xA3, 0x41, 0xDE, 0xDB, 0x12, 0x47, 0x9F, 0xB6, 0x6D, 0x44, 0x95, 0x56, 0xF0, 0xE8, 0x14, 0xB6, 0xD5, 0x31, 0x4D,
-0xE1, 0x2E, 0x7D, 0x1E, 0xBA, 0xFA, 0x13, 0x11, 0xB1, 0xDC, 0x66, 0x31, 0x3B, 0x02, 0x1D, 0x89, 0x96, 0x8B, 0x38, 0xA3, 0x0C,
-0xB7, 0x9B, 0x1C, 0x27, 0x49, 0x0E, 0xA7, 0x6E, 0x6F, 0xE1, 0xD2, 0xAF, 0xED, 0x4A, 0x2F, 0x17, 0x2D, 0xBE, 0x6E, 0xAB, 0xA3,
-0x5E, 0xC3, 0x29, 0x97, 0x70, 0x46, 0x63, 0x2E, 0xE5, 0x68, 0x9D, 0x5A, 0x72, 0xA8, 0x6C, 0x59, 0x0D, 0x09, 0x6A, 0x8D, 0x1C,
-0x21, 0x28, 0x40, 0x9B, 0x7B, 0x11, 0x92, 0x80, 0x3A, 0x6A, 0x36, 0x74, 0x0F, 0xB3, 0x2A, 0x6A, 0x99, 0xBB, 0xCC, 0x3A, 0x2E,
-0x62, 0x56, 0x30, 0x88, 0x97, 0xFD, 0x3C, 0x65, 0x5E, 0x38, 0xD8, 0xAD, 0xF3, 0xED, 0xEB, 0x1F, 0x19, 0x6C, 0xEA, 0x45, 0xA7,
-0x19, 0x3A, 0xE0, 0xA0, 0x0F, 0xA1, 0x30, 0xB4, 0xB5, 0xC7, 0x4D, 0x83, 0xB9, 0x71, 0x0F, 0xC5, 0xC7, 0x61, 0x5B, 0xF1, 0x65,
-0x83, 0x17, 0x2E, 0x0D, 0xAD, 0x3B, 0x12, 0xED, 0x48, 0x10, 0xFB, 0x7D, 0x42, 0x37, 0x08, 0x24, 0x18, 0x0F, 0x5D, 0x5E, 0xD0,
-0x1E, 0xA7, 0x88, 0xC1, 0xCB, 0x92, 0xDE, 0xD2, 0xCA, 0xDC, 0x64, 0x19, 0x5E, 0xA1, 0xCD, 0xB2, 0xDA, 0x21, 0xFA, 0x0E, 0x8E,
-0x64, 0x4F, 0x30, 0x2E, 0xAA, 0x6C, 0xC8, 0x58, 0x2E, 0x2A, 0xB4, 0xDE, 0xA2, 0x9F, 0x55, 0x5B, 0x4A, 0xD6, 0xAF, 0x51, 0xD1,
-0x33, 0xDD, 0x14, 0x46, 0x85, 0x8C, 0x97, 0xD5, 0xBD, 0xA1, 0x42, 0xC4, 0xD0, 0xFF, 0x57, 0x01, 0x4D, 0xB3, 0xC1, 0xB3, 0xF4,
-0xB2, 0xF2, 0x7C, 0x20, 0x34, 0x2B, 0x86, 0x48, 0xFF, 0xCD, 0x50, 0xC1, 0x5D, 0x99, 0x2C, 0xE7, 0x88, 0xA2, 0xB3, 0x6F, 0x94,
-0x56, 0xDF, 0xA1, 0xA1, 0x37, 0xAD, 0x5A, 0x73, 0x48, 0x80, 0x6E, 0xBC, 0x40, 0x1F, 0x7D, 0x8C, 0x62, 0x00, 0xFC, 0xC6, 0xF7,
-0x61, 0x78, 0xC0, 0x76, 0x88, 0x47, 0x5B, 0xA6, 0x9D, 0xA9, 0x6B, 0xD1, 0x5D, 0x2C, 0xB3, 0x59, 0x9B, 0xB5, 0xD2, 0xB1, 0x59,
-0x88, 0x00, 0xFC, 0x67, 0x5E, 0x48, 0x03, 0xBC, 0x90, 0xC9, 0x2C, 0x4D, 0xE2, 0x24, 0x4A, 0x0E, 0x43, 0x38, 0x48, 0x93, 0x24,
-0xF5, 0x83, 0xD4, 0x38, 0x9D, 0x95, 0x90, 0xB3, 0x04, 0xD8, 0x47, 0xDB, 0xEB, 0x12, 0xA6, 0x5E, 0xF1, 0x28, 0xCA, 0x5D, 0x8C,
-0x85, 0x0A, 0x1B, 0x01, 0xAC, 0x5A, 0x2F, 0x0D, 0xDA, 0x63, 0xFA, 0xB2, 0x23, 0x23, 0xDF, 0x5C, 0xA9, 0xB3, 0xD0, 0x0F, 0x24,
-0xC2, 0x62, 0x16, 0x53, 0xB8, 0xD2, 0x32, 0x55, 0x49, 0xAA, 0x6E, 0x99, 0x56, 0xE6, 0x2E, 0x5C, 0x99, 0x1A, 0x31, 0xF8, 0xBA,
-0xDD, 0x6A, 0x0D, 0xFE, 0xAE, 0xB9, 0x4F, 0xFD, 0x19, 0xD8, 0xBB, 0x15, 0x8D, 0x36, 0x5D, 0x8B, 0xAD, 0xDC, 0xBA, 0x6C, 0xDE,
-0x1A, 0x0D, 0xB9, 0x96, 0xD9, 0x5B, 0x9B, 0xBD, 0x22, 0x86, 0x5F, 0x46, 0x19, 0x6A, 0xCE, 0xF4, 0x75, 0x07, 0xCE, 0xF5, 0x5C,
-0x37, 0x35, 0xBE, 0x7D, 0x11, 0x5E, 0x5C, 0x70, 0x63, 0xA9, 0x07, 0x85, 0x20, 0x2A, 0xDE, 0x81, 0x94, 0x09, 0x8B, 0x9D, 0x06,
-0xCE, 0xA7, 0x41, 0x6D, 0x0A, 0x7E, 0x65, 0xE1, 0x1F, 0x05, 0x4D, 0x5B, 0xD9, 0x47, 0xD5, 0x0C, 0x68, 0x0B, 0xB9, 0x6A, 0x29,
-0x37, 0x59, 0xCC, 0x05, 0xFE, 0x4C, 0x71, 0xFD, 0xE1, 0x8B, 0x67, 0xDC, 0x6A, 0xF9, 0x69, 0xE2, 0xF9, 0x81, 0xEF, 0x54, 0x2C,
-0x53, 0xC9, 0xBE, 0xD3, 0xE2, 0x85, 0x27, 0x7D, 0xBD, 0xBF, 0x08, 0x7F, 0x0C, 0xCE, 0x2A, 0x3E, 0x1A, 0xB8, 0x96, 0xBE, 0x89,
-0xA0, 0xA0, 0xF6, 0xAF, 0x72, 0xD8, 0xD0, 0x8A, 0x86, 0xAD, 0x4E, 0x4B, 0x6F, 0x5A, 0x7D, 0xAE, 0x2A, 0x01, 0x4A, 0x6B, 0xF5,
-0x8B, 0xDB, 0xFC, 0xD6, 0xBB, 0xC2, 0x60, 0x3C, 0x4B, 0x27, 0x56, 0x02, 0x44, 0x15, 0x00, 0x5B, 0x7D, 0x4F, 0xE6, 0xDE, 0xA1,
-0x3A, 0x17, 0xF0, 0xCD, 0xA5, 0xF5, 0x50, 0x49, 0x60, 0xB3, 0xD1, 0x66, 0x1D, 0xA3, 0xE2, 0xF4, 0x4F, 0x8B, 0xC3, 0x14, 0x50,
-0xFB, 0x3C, 0xC9, 0xD1, 0x9D, 0xC7, 0xAA, 0x54, 0x74, 0xA8, 0xA1, 0xD8, 0x1B, 0x9A, 0xB9, 0x81, 0x7A, 0x7C, 0xA0, 0x4A, 0xFB,
-0x9D, 0xD3, 0x71, 0x93, 0x58, 0x3A, 0x51, 0x59, 0x95, 0x99, 0x25, 0x13, 0x14, 0x14, 0x20, 0x93, 0x2B, 0x8A, 0x07, 0xE2, 0xA0,
-0xD4, 0x9C, 0xF9, 0x03, 0x65, 0x53, 0x6F, 0xAB, 0xB9, 0x17, 0x87, 0xD4, 0x1F, 0x97, 0x2A, 0x7C, 0x79, 0xEB, 0x19, 0x69, 0x3F,
-0xF3, 0x8E, 0x02, 0x72, 0x18, 0x25, 0x63, 0x2F, 0x8A, 0xCE, 0x88, 0x47, 0x15, 0xDF, 0x21, 0x5A, 0x9A, 0xA2, 0x44, 0x12, 0xC6,
-0xE8, 0x40, 0xC8, 0xEF, 0x3D, 0xD2, 0x8C, 0x47, 0x33, 0x38, 0x01, 0xC1, 0x22, 0x39, 0x71, 0xD3, 0x60, 0x9E, 0x1C, 0x07, 0x08,
-0xFC, 0x09, 0x95, 0x2F, 0x08, 0xF5, 0x2E, 0x7A, 0x4E, 0xDD, 0xA1, 0x68, 0xB8, 0x76, 0x9D, 0x17, 0x88, 0xE1, 0xBD, 0x11, 0xE5,
-0xDE, 0xB9, 0xD9, 0x82, 0xFA, 0x45, 0xD1, 0xE2, 0x5D, 0x32, 0xBC, 0xCC, 0x12, 0x29, 0x46, 0xCC, 0xBB, 0x87, 0x9D, 0x13, 0x3C,
-0x4B, 0x74, 0x90, 0xB7, 0xE3, 0x87, 0xA9, 0x6D, 0xE3, 0xA2, 0x5F, 0xC9, 0x77, 0xF8, 0x99, 0xDC, 0x65, 0xC1, 0x2A, 0xE4, 0x57,
-0xBB, 0xA3, 0x4A, 0xCF, 0x60, 0xCB, 0xAE, 0xC6, 0xE9, 0x8E, 0x35, 0x6C, 0xD6, 0xD3, 0x07, 0xFE, 0x66, 0xF0, 0x6E, 0xA7, 0x8E,
-0xDD, 0xC8, 0xE5, 0x59, 0x7F, 0xBA, 0x18, 0x61, 0xD9, 0xD4, 0x9C, 0x99, 0x48, 0x2B, 0x31, 0x63, 0x73, 0x7D, 0x14, 0xCB, 0xF8,
-0xA2, 0xE6, 0xE1, 0x9C, 0xBF, 0x36, 0xF0, 0x77, 0xCC, 0x41, 0x88, 0x3A, 0xA1, 0x6B, 0x90, 0xEE, 0xB6, 0xB2, 0xC7, 0x12, 0x33,
-0x40, 0x90, 0x40, 0xB1, 0x2C, 0xB3, 0xE8, 0x22, 0x86, 0xA1, 0xBF, 0x50, 0x6C, 0x75, 0xAC, 0x17, 0xD1, 0x72, 0x2C, 0xE3, 0x06,
-0x2E, 0x91, 0x3E, 0x88, 0x3A, 0x79, 0xF0, 0x34, 0x38, 0xF4, 0x26, 0x67, 0xA2, 0x9A, 0x52, 0x00, 0xCD, 0x93, 0x2C, 0x1F, 0x1A,
-0xFA, 0x60, 0xBD, 0xA7, 0x03, 0xA3, 0x40, 0x50, 0x20, 0x66, 0xE3, 0xD9, 0x66, 0x46, 0x14, 0xC2, 0xF1, 0xEA, 0xFC, 0x7D, 0x95,
-0xEB, 0x55, 0xAD, 0x87, 0x6A, 0xC9, 0x2F, 0x2F, 0x3A, 0x51, 0x22, 0xBA, 0xF4, 0x8A, 0x59, 0xAA, 0x20, 0x64, 0x9E, 0x11, 0xE1,
-0xE0, 0x6C, 0x11, 0x30, 0x63, 0x53, 0x56, 0x83, 0xE5, 0x40, 0xC8, 0x70, 0x33, 0x6F, 0x3B, 0x7C, 0xF3, 0xE9, 0x61, 0x21, 0x47,
-0x6F, 0x45, 0x01, 0x40, 0x95, 0x11, 0x9A, 0x97, 0xA1, 0x63, 0x8D, 0xC0, 0x80, 0x5F, 0x9E, 0xC4, 0xD3, 0xA4, 0xC1, 0xE4, 0x4A,
-0x64, 0xA1, 0x45, 0xD2, 0x86, 0xCA, 0x02, 0x4E, 0xF1, 0x09, 0x57, 0xB7, 0xA2, 0xB6, 0x90, 0xF5, 0xBA, 0x34, 0x98, 0xAD, 0xE2,
-0xCB, 0xD1, 0x32, 0xF2, 0x1E, 0x49, 0x41, 0xE5, 0x56, 0x87, 0x93, 0x33, 0x53, 0x1F, 0x95, 0x71, 0xB3, 0x15, 0x5B, 0x25, 0xBD,
-0xE7, 0xDF, 0x41, 0xCB, 0x7D, 0x6F, 0xB7, 0xB5, 0x96, 0x67, 0xA0, 0x6A, 0xE9, 0xE3, 0x88, 0xA6, 0xF8, 0x32, 0x63, 0xD6, 0x43,
-0x0E, 0x35, 0x14, 0x5A, 0x8F, 0x08, 0xD5, 0x8D, 0xFB, 0xC2, 0x84, 0x78, 0x62, 0xE7, 0x16, 0x35, 0x6E, 0x96, 0xF2, 0x72, 0x97,
-0x3B, 0xD1, 0x80, 0x2A, 0xD6, 0xC6, 0x16, 0xC2, 0x27, 0xEB, 0xA0, 0x4C, 0xB6, 0x6D, 0x37, 0xA3, 0xB4, 0xCB, 0xDC, 0x5F, 0xEF,
-0x3E, 0x10, 0x1A, 0xB9, 0x77, 0xAF, 0x24, 0xC3, 0x7A, 0x1F, 0x75, 0x21, 0x8C, 0x5D, 0xD8, 0x3F, 0x7D, 0x11, 0x62, 0xA6, 0x4A,
-0x13, 0xF9, 0xA5, 0x23, 0x62, 0x03, 0x7C, 0x6A, 0x56, 0x75, 0xC2, 0xE4, 0x8D, 0x3F, 0xE9, 0x8B, 0xAA, 0x61, 0xC4, 0x29, 0x25,
-0x94, 0xAD, 0xCE, 0x9E, 0x28, 0xFC, 0x38, 0xA5, 0x71, 0xF4, 0xB1, 0x01, 0xF9, 0x59, 0x1C, 0x2D, 0xAF, 0x8D, 0xC8, 0xE6, 0xCD,
-0x2A, 0xAA, 0x31, 0x02, 0xFA, 0xDB, 0xAE, 0x44, 0x6D, 0xE6, 0x69, 0x97, 0x08, 0x41, 0xA5, 0x39, 0x1B, 0x0E, 0x56, 0x07, 0x8F,
-0x72, 0x1E, 0x7A, 0x29, 0xF0, 0x1D, 0x90, 0xD6, 0xF2, 0x80, 0xB4, 0xD9, 0x1E, 0xD5, 0x71, 0x2E, 0x11, 0xCF, 0x49, 0x46, 0x1F,
-0x48, 0xA1, 0x0F, 0x03, 0x31, 0x43, 0xEA, 0x1B, 0x81, 0xC2, 0xBB, 0x64, 0x73, 0xA3, 0x16, 0x83, 0x72, 0xCA, 0x83, 0xCF, 0x8F,
-0xC1, 0x61, 0x03, 0x0C, 0xDA, 0x72, 0x29, 0x5E, 0x1D, 0x02, 0xF7, 0x8F, 0x27, 0x1A, 0x02, 0xD9, 0x9B, 0x75, 0x10, 0x28, 0xE7,
-0x84, 0xA8, 0xBE, 0x98, 0x6F, 0xC0, 0xAC, 0x80, 0x7D, 0xC4, 0xB8, 0xE3, 0x2E, 0x23, 0x9F, 0x3A, 0x81, 0x51, 0x8F, 0x6F, 0x58,
-0xE1, 0x34, 0x19, 0xAD, 0x2C, 0x2C, 0xAD, 0xE0, 0xEB, 0xB6, 0x53, 0x4D, 0xD9, 0x9E, 0x72, 0x9D, 0x63, 0x6C, 0xAA, 0xA3, 0x5A,
-0xC6, 0x67, 0x88, 0x12, 0xEB, 0x70, 0xAB, 0x32, 0x92, 0x6B, 0xF3, 0x5D, 0x62, 0x2D, 0x36, 0x56, 0xF8, 0x81, 0xD3, 0x30, 0xAF,
-0x07, 0xDE, 0xA1, 0x60, 0x64, 0xB9, 0x77, 0xF8, 0x2F, 0x2D, 0xD0, 0x88, 0x5A, 0xF6, 0x55, 0x10, 0x3D, 0xA7, 0x3E, 0x78, 0x23,
-0x1E, 0xBE, 0x97, 0xA9, 0xCF, 0xA3, 0xE4, 0x90, 0x1A, 0x09, 0xBB, 0x18, 0x59, 0x40, 0x8F, 0x92, 0x55, 0x8F, 0xC5, 0xA2, 0x0F,
-0xC6, 0x45, 0x12, 0x1C, 0xDE, 0xFE, 0xB9, 0x84, 0x96, 0x97, 0x6C, 0x82, 0xA8, 0xAC, 0xCC, 0x4A, 0x63, 0x7C, 0x7D, 0xAC, 0xDF,
-0xA5, 0x0A, 0x4A, 0xC2, 0xE5, 0x0C, 0x24, 0x85, 0x20, 0x53, 0x61, 0x68, 0x22, 0xEA, 0xDD, 0xF1, 0xEE, 0x2B, 0x5E, 0x98, 0x0E,
-0x63, 0x1B, 0xBD, 0x50, 0xDF, 0xC6, 0xD7, 0x3F, 0xAA, 0xA3, 0x3B, 0x7F, 0x1B, 0xBF, 0x8D, 0xDF, 0x77, 0x4B, 0xD9, 0x81, 0xD3,
-0x88, 0xEF, 0xD4, 0x5C, 0x3F, 0xD5, 0x6E, 0x74, 0xA3, 0x4A, 0x21, 0x67, 0xC7, 0x0C, 0xA9, 0x80, 0x8E, 0xB2, 0x8F, 0x4F, 0xF8,
-0xF7, 0xFD, 0x20, 0xB8, 0xDC, 0x9E, 0xBE, 0x8E, 0xA0, 0x63, 0x69, 0x79, 0xC5, 0x86, 0xBB, 0x4E, 0xFC, 0x8D, 0x4A, 0x0C, 0x75,
-0x69, 0x4C, 0x0E, 0x23, 0x24, 0x07, 0x8D, 0xC8, 0x61, 0x06, 0xE4, 0xF8, 0xF4, 0xF1, 0x38, 0x6C, 0x42, 0x5A, 0xE3, 0x18, 0x1C,
-0xDC, 0xB6, 0x9E, 0x87, 0xDD, 0xA0, 0xA1, 0x36, 0x44, 0x73, 0x57, 0x19, 0x5F, 0x83, 0x12, 0x3B, 0x5E, 0xF9, 0xA3, 0x9A, 0xE4,
-0x0F, 0x08, 0xB0, 0x51, 0x1C, 0x25, 0x28, 0xCF, 0x11, 0xED, 0x37, 0x0E, 0xB5, 0x51, 0x45, 0x81, 0x20, 0x1B, 0x3D, 0x58, 0x66,
-0xE8, 0x37, 0x81, 0x77, 0x24, 0x6D, 0xEA, 0x7F, 0x7E, 0x41, 0xA1, 0xEF, 0xBD, 0x35, 0xBF, 0x2D, 0x6C, 0x13, 0xFD, 0x0C, 0xC0,
-0x67, 0xFD, 0xEB, 0x1F, 0x29, 0x74, 0x66, 0xDE, 0xDF, 0x7C, 0x56, 0x4C, 0x47, 0x7C, 0xED, 0x24, 0x65, 0x3A, 0xE1, 0x0F, 0xAA,
-0xBF, 0x53, 0xD1, 0x60, 0x60, 0x99, 0x2C, 0xDB, 0xF6, 0x78, 0x59, 0xA9, 0xB5, 0xEC, 0x32, 0x65, 0xD6, 0x51, 0x12, 0x33, 0x76,
-0xAF, 0xC8, 0xE1, 0x02, 0x07, 0xF7, 0xD3, 0xD4, 0x3B, 0x73, 0xC3, 0x8C, 0xFE, 0x6D, 0xF3, 0x0A, 0x6C, 0x1D, 0x76, 0x30, 0x9E,
-0x9B, 0xF2, 0x46, 0x88, 0x01, 0x78, 0xB8, 0xDD, 0xA8, 0xC1, 0x18, 0x1B, 0xAF, 0x52, 0x55, 0xBD, 0xFC, 0xB1, 0xA1, 0x4F, 0x2D,
-0x3E, 0x7C, 0xB7, 0x42, 0xEE, 0xBA, 0x1C, 0xFE, 0xCF, 0x0D, 0x1B, 0x6A, 0x2D, 0xF2, 0x81, 0xBC, 0x62, 0x92, 0xDA, 0xC3, 0x14,
-0xBB, 0x10, 0xA1, 0xC4, 0x88, 0x37, 0x22, 0xD4, 0x25, 0x1D, 0x28, 0x8F, 0x8E, 0x87, 0x9F, 0xA7, 0x54, 0xBD, 0xCB, 0x2A, 0xDA,
-0xAA, 0x1F, 0x59, 0xFD, 0xB8, 0xAC, 0x54, 0x75, 0xDE, 0x24, 0x92, 0x42, 0x69, 0x91, 0x66, 0xBA, 0x48, 0x2E, 0x33, 0x16, 0xC5,
-0xC0, 0x12, 0x67, 0xC3, 0xEE, 0xD5, 0x28, 0x7C, 0xB5, 0xE8, 0x55, 0x6B, 0x41, 0xBB, 0xDA, 0xAA, 0x17, 0x50, 0x55, 0xAB, 0x70,
-0x5E, 0xA9, 0x53, 0xE5, 0x33, 0x4C, 0x2D, 0x43, 0x45, 0xD5, 0x9D, 0xAA, 0x32, 0x36, 0x9F, 0xE2, 0x0B, 0x04, 0xB3, 0x30, 0xA6,
-0xCA, 0x08, 0x69, 0x41, 0x2C, 0x61, 0xC2, 0x44, 0xEF, 0xBA, 0x46, 0xFD, 0xAE, 0x3E, 0xB9, 0x5D, 0x7D, 0x3E, 0x15, 0x05, 0x5D,
-0x55, 0xB8, 0x8C, 0xDA, 0x80, 0x19, 0xB6, 0xE5, 0x22, 0x41, 0x32, 0x2C, 0x5E, 0x57, 0xA3, 0xC5, 0xA9, 0x47, 0xB3, 0xCE, 0xC2,
-0x6A, 0xFB, 0x66, 0x6C, 0x39, 0x07, 0xB3, 0x80, 0x40, 0x59, 0x82, 0x64, 0x51, 0x86, 0xD5, 0x21, 0x67, 0xC9, 0x92, 0xF0, 0x2C,
-0xA6, 0xF0, 0x42, 0x1C, 0x01, 0xC6, 0x78, 0x67, 0x8F, 0xF1, 0xBF, 0x9D, 0x06, 0x91, 0x57, 0x6D, 0xE6, 0xA4, 0x26, 0x6D, 0x33,
-0xD4, 0xF8, 0x32, 0x69, 0xCB, 0xE6, 0xAA, 0xDC, 0xC2, 0x48, 0x0B, 0x66, 0x43, 0x03, 0x81, 0xA2, 0x79, 0x48, 0x01, 0x18, 0x17,
-0x3A, 0x83, 0x54, 0x1D, 0xD3, 0xC6, 0x86, 0x18, 0x29, 0xC7, 0xA4, 0x08, 0x93, 0x23, 0xDB, 0xF4, 0xEA, 0xE8, 0xAE, 0x06, 0xAE,
-0xEB, 0x0C, 0x8C, 0x58, 0xF5, 0x4C, 0xD5, 0x62, 0xEA, 0x5F, 0x0C, 0x43, 0x10, 0x74, 0x8C, 0xA2, 0xD1, 0xA4, 0x69, 0x0D, 0x1A,
-0xD3, 0x1A, 0x36, 0x82, 0x76, 0xCD, 0x5D, 0x03, 0x9C, 0x17, 0xAB, 0xCF, 0xD1, 0x1D, 0x9D, 0x2D, 0xA0, 0x52, 0x4B, 0x81, 0x3F,
-0xD4, 0x4B, 0x20, 0x0F, 0x95, 0x0B, 0x6C, 0xC8, 0x7B, 0x37, 0xC3, 0x53, 0x9C, 0x1E, 0x00, 0x7A, 0xB0, 0xAB, 0x7A, 0xA0, 0xA1,
-0x38, 0x65, 0x5E, 0x98, 0x0C, 0x81, 0xF6, 0x12, 0xDC, 0xD8, 0xBF, 0xAE, 0xC8, 0xFD, 0x3C, 0xE7, 0xDF, 0x94, 0xB0, 0xA6, 0xB2,
-0xBD, 0x9F, 0xE2, 0xE3, 0xC8, 0xEA, 0xA5, 0xFE, 0x61, 0xA3, 0x8A, 0x43, 0xBD, 0x22, 0x9C, 0xD1, 0x81, 0x30, 0x82, 0xAC, 0xA2,
-0x3F, 0x68, 0xF7, 0x0A, 0x3F, 0xF8, 0xD9, 0xFA, 0x59, 0x76, 0x28, 0x0A, 0x22, 0xEE, 0x11, 0xA1, 0x15, 0x15, 0x84, 0xDF, 0x41,
-0x3D, 0xD8, 0x17, 0xA9, 0x1F, 0xC6, 0xB0, 0x8A, 0x9D, 0x6E, 0x4D, 0xA1, 0xA7, 0x5E, 0x96, 0xE3, 0x61, 0x41, 0x1A, 0x5C, 0xBB,
-0x0A, 0x2D, 0x56, 0x8A, 0x90, 0x2F, 0x06, 0x3A, 0x15, 0x8D, 0x3C, 0x86, 0x23, 0x02, 0x9F, 0x9C, 0xDA, 0xCE, 0x60, 0xB9, 0x66,
-0x58, 0x78, 0xEC, 0xE1, 0x89, 0x6F, 0x0A, 0x72, 0xD3, 0xAC, 0x1A, 0x09, 0xCF, 0x93, 0xFD, 0x49, 0x9A, 0x60, 0xDA, 0xD2, 0x55,
-0xE0, 0xB8, 0x36, 0x79, 0x75, 0xC1, 0x87, 0xE5, 0x75, 0x5F, 0x75, 0xB3, 0x72, 0xA8, 0xE0, 0x2A, 0x42, 0x7C, 0x12, 0x53, 0x04,
-0x52, 0xB4, 0x41, 0x21, 0x75, 0x55, 0x5E, 0xAB, 0x59, 0x95, 0xE6, 0x67, 0x65, 0x59, 0x1A, 0x4B, 0x2A, 0x9F, 0x46, 0xB8, 0xA6,
-0x6C, 0xE3, 0x81, 0x4F, 0xF2, 0xA2, 0xAA, 0x28, 0xC2, 0x28, 0xBF, 0x86, 0x1A, 0x0F, 0x68, 0x7A, 0x57, 0xB6, 0xC7, 0x4A, 0x25,
-0x0D, 0x0E, 0x88, 0xDD, 0x80, 0x3F, 0x15, 0x21, 0xC4, 0x58, 0x1F, 0x6C, 0xDF, 0x73, 0xD6, 0x03, 0xE5, 0x13, 0xCA, 0x14, 0xF8,
-0x42, 0x75, 0x9B, 0xAB, 0x0E, 0x1B, 0x5A, 0xA8, 0x35, 0xA7, 0x29, 0x17, 0xA2, 0xAB, 0xF2, 0x68, 0x88, 0x03, 0xC7, 0x33, 0x6F,
-0x61, 0x5C, 0xF4, 0xB3, 0xDA, 0x1D, 0xDD, 0xBC, 0x26, 0xA5, 0x3E, 0x58, 0xE8, 0x97, 0xE7, 0x9E, 0x84, 0x3E, 0x4A, 0xD2, 0xA4,
-0x75, 0xE7, 0xCE, 0xDF, 0x5A, 0xDA, 0x0D, 0x5E, 0xE1, 0x81, 0x53, 0x1A, 0x25, 0xDB, 0x6A, 0x0E, 0x07, 0x03, 0xA8, 0x4A, 0xCE,
-0xBB, 0x04, 0x7E, 0x55, 0xC5, 0xBB, 0x97, 0xF1, 0x50, 0x96, 0x68, 0x1B, 0xFC, 0x49, 0xCA, 0x50, 0x8C, 0xD1, 0x07, 0xA5, 0xA2,
-0x94, 0x5F, 0xCB, 0x45, 0x45, 0x52, 0x60, 0xAD, 0x1C, 0x72, 0x6D, 0xB9, 0x98, 0xD8, 0xB2, 0x44, 0x91, 0x4E, 0x85, 0x44, 0xA2,
-0xF9, 0xAD, 0xAC, 0x21, 0xBC, 0x9C, 0x97, 0x86, 0x6C, 0xCD, 0x82, 0x55, 0xD7, 0xDB, 0xE5, 0xEE, 0xD4, 0x80, 0xB3, 0xC5, 0xD4,
-0xAE, 0xB5, 0x02, 0xDB, 0x31, 0x7C, 0x39, 0x71, 0xB3, 0xE5, 0xC9, 0xE7, 0xE8, 0xD6, 0x56, 0x13, 0xFC, 0xAE, 0xB2, 0x4A, 0x89,
-0x97, 0x4A, 0x3D, 0x03, 0x96, 0xC3, 0x55, 0xEE, 0x74, 0x24, 0xF3, 0x68, 0x69, 0x33, 0x97, 0xC2, 0x2A, 0xD6, 0x81, 0xC0, 0xB5,
-0x5A, 0x01, 0x62, 0xD8, 0x10, 0x04, 0x6C, 0x68, 0x15, 0x10, 0x36, 0xAA, 0xC7, 0x2E, 0xCC, 0xF9, 0x71, 0x75, 0x3E, 0xA6, 0x97,
-0x8F, 0xF6, 0x98, 0x7F, 0x2F, 0xBD, 0x1C, 0xA4, 0xA4, 0x98, 0x06, 0x6E, 0x79, 0xEB, 0x7F, 0xDC, 0x3C, 0x1F, 0xB8, 0x1F, 0x87,
-0xDD, 0x73, 0x23, 0x22, 0x0B, 0x96, 0xFD, 0xD9, 0x43, 0x81, 0xE6, 0x3A, 0x5B, 0xB3, 0x08, 0x98, 0x19, 0x5E, 0xB5, 0x3B, 0xF6,
-0x73, 0x0B, 0x56, 0x79, 0xC4, 0x65, 0xCF, 0x91, 0x00, 0x50, 0x46, 0x8C, 0x18, 0xD8, 0x5B, 0x08, 0x45, 0x61, 0x51, 0x15, 0xD7,
-0x42, 0xD9, 0x51, 0x16, 0x9A, 0x85, 0x97, 0xB5, 0x04, 0x59, 0x37, 0x5C, 0x88, 0xE4, 0x18, 0xEB, 0x45, 0x13, 0x3A, 0xDA, 0x8C,
-0xE3, 0x98, 0x69, 0xB7, 0x46, 0x6D, 0x75, 0x5A, 0x15, 0xE6, 0x38, 0x36, 0x6C, 0xDB, 0xC2, 0xF5, 0x69, 0x0B, 0x6F, 0x9D, 0x33,
-0xC3, 0xCA, 0x13, 0x43, 0x5D, 0xF0, 0x3F, 0x4B, 0xFC, 0xFC, 0x6A, 0x93, 0x38, 0x99, 0x69, 0x50, 0x83, 0x50, 0x61, 0x45, 0xA7,
-0x5D, 0x39, 0xCF, 0x69, 0xF2, 0x6E, 0x53, 0x12, 0xD6, 0x42, 0x50, 0xC4, 0x22, 0xED, 0x38, 0x0F, 0x2D, 0x67, 0x86, 0xBD, 0xAB,
-0x30, 0x0A, 0x95, 0x4C, 0x9B, 0xE8, 0x82, 0x03, 0x06, 0x8E, 0x06, 0xC5, 0xB0, 0x26, 0xD5, 0x06, 0xB8, 0x31, 0x48, 0xCC, 0xF6,
-0x19, 0x1B, 0x27, 0xDE, 0xB1, 0x56, 0x98, 0xA4, 0x99, 0xA5, 0xFC, 0xDE, 0xAB, 0x7D, 0x7B, 0xF1, 0xC8, 0xCB, 0x2D, 0xC5, 0x45,
-0x6E, 0xF9, 0x8A, 0x3A, 0xAA, 0x56, 0x57, 0x4F, 0x3A, 0x5F, 0xD1, 0x2F, 0xC5, 0x85, 0x56, 0x65, 0x90, 0xF2, 0x97, 0xDA, 0xDA,
-0x7B, 0xEA, 0xE0, 0xCA, 0xB7, 0xF6, 0x5A, 0x46, 0xA8, 0xB5, 0x0A, 0xEB, 0x58, 0x7B, 0xED, 0xA9, 0xA8, 0xF5, 0xA6, 0xA2, 0xAB,
-0xE4, 0x1E, 0x79, 0xCF, 0xE5, 0x51, 0x82, 0xF9, 0xE5, 0xAF, 0x7F, 0xAC, 0x28, 0x78, 0xFE, 0x9E, 0x28, 0xC9, 0xCA, 0xAB, 0xFE,
-0xAB, 0x8A, 0x11, 0x07, 0xED, 0x08, 0x59, 0x5D, 0x69, 0x45, 0x2D, 0xC6, 0x5B, 0x79, 0x27, 0xC2, 0xAE, 0x3C, 0x48, 0x92, 0x28,
-0xF0, 0xE2, 0x8E, 0xFB, 0x21, 0x09, 0xE3, 0x36, 0x50, 0xAA, 0x63, 0x89, 0x47, 0x52, 0x43, 0x9B, 0x43, 0x4E, 0x9B, 0xC8, 0xEC,
-0x1B, 0xD1, 0xA6, 0xD8, 0xFA, 0x77, 0xEA, 0x4A, 0x4B, 0x4F, 0x6E, 0xCA, 0xCC, 0xE8, 0xDB, 0x7D, 0xD2, 0xFE, 0x09, 0x85, 0xAE,
-0xC3, 0x94, 0xA6, 0xE7, 0xE2, 0x58, 0xFB, 0xF7, 0xC3, 0xA7, 0xAF, 0x8A, 0xDF, 0x6F, 0xDB, 0x3F, 0x7C, 0xBB, 0x47, 0xD0, 0xEB,
-0xF5, 0x6D, 0xA7, 0x73, 0xBD, 0x1F, 0x76, 0xD1, 0xD5, 0xCA, 0xDE, 0x10, 0x76, 0xE3, 0x89, 0xAF, 0x77, 0xEC, 0x89, 0x5F, 0x41,
-0xCC, 0x00, 0x32, 0x34, 0x4A, 0x33, 0xF7, 0x5A, 0x7B, 0x0D, 0x5F, 0x72, 0x6F, 0xB5, 0xFB, 0xBD, 0x36, 0x5A, 0x6A, 0xB4, 0x19,
-0x29, 0x28, 0x6B, 0xDD, 0x12, 0xA3, 0x65, 0xAB, 0xE0, 0x5A, 0xE8, 0x54, 0x72, 0x7C, 0xBE, 0x26, 0x1C, 0x9F, 0x91, 0x8A, 0xF0,
-0x9D, 0x42, 0x41, 0x65, 0xC1, 0xB5, 0x69, 0x54, 0xF5, 0xF4, 0x05, 0xE0, 0xF0, 0x60, 0xC0, 0x2E, 0x0A, 0x5C, 0x88, 0x38, 0x29,
-0xF9, 0x01, 0xEF, 0x6F, 0x44, 0x7D, 0xFC, 0x16, 0xCD, 0x8E, 0x23, 0x71, 0x37, 0xA8, 0xEE, 0x37, 0x8D, 0xE6, 0x89, 0xDD, 0xC5,
-0x35, 0x9A, 0x26, 0xB6, 0xE1, 0x55, 0xF6, 0xC0, 0x64, 0x43, 0xC5, 0xCB, 0x15, 0x33, 0x6B, 0x89, 0x78, 0x08, 0x08, 0xE7, 0x67,
-0xE6, 0x4C, 0xC1, 0x7A, 0x51, 0x82, 0x63, 0xBC, 0xF6, 0x5E, 0x5B, 0x71, 0x32, 0xA9, 0x8A, 0x23, 0xCE, 0xAD, 0x29, 0x71, 0xA3,
-0xAC, 0x75, 0x28, 0xB9, 0xA0, 0xDB, 0x47, 0x91, 0xBC, 0x34, 0xC8, 0x9F, 0x4C, 0x28, 0x3E, 0xB9, 0x34, 0xAB, 0x1A, 0xA8, 0x16,
-0x19, 0xD5, 0xA4, 0xAD, 0xD3, 0x8C, 0x70, 0xD2, 0xB7, 0x44, 0xEE, 0x99, 0x05, 0x34, 0xBA, 0xC9, 0x70, 0x73, 0x71, 0xBA, 0x43,
-0xF4, 0x80, 0x27, 0x3B, 0xA8, 0x48, 0xCE, 0xD1, 0xAD, 0xA5, 0x07, 0xD2, 0xCE, 0x61, 0xBC, 0x3D, 0x0F, 0x7D, 0x3F, 0x0A, 0x76,
-0x9C, 0xDD, 0xD6, 0x4E, 0x4D, 0xE3, 0x43, 0x7B, 0xE3, 0x66, 0x80, 0x95, 0x4F, 0xD1, 0xF8, 0x86, 0xBD, 0x71, 0x98, 0xF9, 0x4F,
-0xD2, 0xB6, 0x68, 0x4B, 0xB1, 0xC1, 0xAB, 0x16, 0x70, 0x8C, 0xD3, 0x93, 0x90, 0x73, 0xAC, 0xA6, 0x86, 0xF6, 0xFC, 0xD4, 0x9A,
-0xE9, 0xA1, 0x1F, 0x1E, 0x93, 0x49, 0xE4, 0x65, 0xD9, 0xC8, 0x41, 0x8B, 0x97, 0xDE, 0x7C, 0x99, 0x83, 0xE8, 0x3B, 0xCD, 0xF2,
-0x5E, 0x88, 0xD1, 0xC6, 0x27, 0x64, 0x71, 0xDA, 0xDB, 0x24, 0x8B, 0xB3, 0xDE, 0x86, 0xB3, 0xFB, 0x3C, 0xA1, 0x46, 0xC1, 0x19,
-0x7A, 0x44, 0x31, 0x6D, 0x25, 0xFA, 0x34, 0x94, 0x9D, 0xBA, 0xDB, 0x07, 0x68, 0xDA, 0x18, 0x2F, 0xE0, 0x42, 0x5A, 0x53, 0x49,
-0x92, 0xCD, 0x35, 0x25, 0x83, 0x4D, 0x55, 0xD5, 0x04, 0x4C, 0x4D, 0xE3, 0x4D, 0xF0, 0xD7, 0xB2, 0xEB, 0xBE, 0x24, 0x4F, 0x39,
-0xEE, 0x3D, 0x40, 0x1D, 0xE5, 0x2A, 0x8C, 0xD7, 0x15, 0xA5, 0x23, 0xCC, 0x47, 0x75, 0x5A, 0x30, 0xF8, 0xDA, 0x32, 0xC3, 0xA5,
-0xC1, 0x5B, 0x97, 0xCE, 0x21, 0xD7, 0x6A, 0xB5, 0xD0, 0x08, 0xBE, 0x87, 0x3B, 0xFE, 0xA2, 0x47, 0xAD, 0xC4, 0xFD, 0xDE, 0x34,
-0x0A, 0x4E, 0x09, 0x25, 0x46, 0xFA, 0x26, 0xEB, 0x65, 0x98, 0x75, 0xAB, 0x65, 0x05, 0x25, 0x0F, 0xF0, 0xBD, 0x6D, 0xCF, 0x92,
-0x89, 0x06, 0x01, 0xF7, 0xB2, 0x59, 0x1A, 0xC6, 0x47, 0xBD, 0x81, 0xB3, 0x7B, 0xFD, 0x23, 0xE7, 0x35, 0x74, 0xBC, 0x2E, 0xE5,
-0x36, 0xE7, 0x8C, 0x2E, 0xEC, 0xBB, 0x9F, 0x01, 0x0B, 0xBA, 0x7D, 0xD2, 0x1B, 0x92, 0x45, 0x80, 0x14, 0x77, 0x37, 0x5B, 0x78,
-0xB1, 0xF8, 0x3C, 0x0F, 0x7A, 0x43, 0x7C, 0x95, 0xA7, 0x20, 0x0E, 0x43, 0x4B, 0x45, 0xF0, 0x7C, 0x68, 0x80, 0xBF, 0x84, 0x1F,
-0x50, 0x61, 0xB7, 0x7A, 0xA3, 0x55, 0x00, 0x8E, 0x3D, 0xFF, 0x30, 0x20, 0xE3, 0xC3, 0x5E, 0x16, 0x40, 0x8F, 0x7D, 0x2F, 0x3D,
-0x73, 0x04, 0x58, 0x64, 0xA5, 0xE7, 0xAB, 0xA1, 0x49, 0x9D, 0xCF, 0xE6, 0x98, 0xB0, 0xBB, 0x5C, 0x43, 0x05, 0x28, 0xBE, 0xD3,
-0xA0, 0xF9, 0xE2, 0x73, 0x91, 0xF3, 0x3B, 0x73, 0xEA, 0x91, 0xB2, 0x0E, 0xC2, 0x4A, 0xE4, 0x57, 0x75, 0xF4, 0xEE, 0x98, 0x9E,
-0x6C, 0x8B, 0x61, 0xE7, 0x31, 0x81, 0xFF, 0xF7, 0xB2, 0x39, 0xFD, 0xE3, 0xA3, 0x89, 0x51, 0xEA, 0x90, 0x24, 0xA6, 0x9E, 0x56,
-0x23, 0x47, 0x75, 0xBE, 0x28, 0x7D, 0x5E, 0x53, 0x38, 0xCC, 0xC2, 0x98, 0x90, 0x82, 0xCF, 0x3B, 0x30, 0x11, 0x61, 0x01, 0x30,
-0x24, 0xE3, 0xB0, 0x97, 0xA7, 0x5E, 0x36, 0x83, 0xD7, 0xFD, 0x10, 0xFE, 0xCF, 0x5A, 0x5C, 0x7B, 0x78, 0xF6, 0x2F, 0xEF, 0x0D,
-0x32, 0x5D, 0xB5, 0x46, 0x65, 0x2B, 0x3C, 0x80, 0xA8, 0xD9, 0x15, 0x75, 0xAA, 0xF4, 0xFE, 0xB5, 0x2E, 0x86, 0xB5, 0xBC, 0x56,
-0x14, 0xFE, 0xB4, 0xAC, 0xB6, 0xE8, 0x52, 0x03, 0x4E, 0xDB, 0x20, 0xB0, 0x40, 0x75, 0x9D, 0x4B, 0xF1, 0x59, 0x1B, 0x94, 0x9A,
-0xA6, 0x1B, 0xA0, 0xAE, 0x82, 0xCB, 0x16, 0xE8, 0x68, 0xCA, 0x64, 0x2F, 0xCA, 0x62, 0xAF, 0x8C, 0xC1, 0x36, 0x60, 0xAF, 0x57,
-0xC7, 0x5C, 0x3F, 0x2B, 0x6B, 0xB5, 0x33, 0xD6, 0x45, 0x1A, 0xCE, 0x65, 0xB6, 0x2A, 0xFC, 0x1F, 0xCF, 0x89, 0xF6, 0x82, 0x88,
-0x6C, 0xB3, 0xF3, 0x30, 0xA6, 0x09, 0x67, 0x31, 0x79, 0x6E, 0x6B, 0x15, 0x07, 0xFE, 0x34, 0xFC, 0x77, 0x0D, 0x8C, 0x8A, 0xB9,
-0xA1, 0x8C, 0x94, 0xD2, 0x43, 0xF9, 0x0B, 0xF9, 0x2B, 0xD0, 0xC1, 0x46, 0x15, 0x5F, 0xAE, 0xE0, 0xCA, 0xC9, 0x32, 0xC7, 0x73,
-0xB3, 0xB4, 0x27, 0x95, 0x9C, 0x59, 0xF7, 0x3B, 0x6B, 0x0B, 0x76, 0xDC, 0x45, 0x47, 0x7A, 0x47, 0x70, 0x67, 0xAE, 0xA6, 0x02,
-0x6C, 0x8A, 0x15, 0x48, 0x51, 0xDA, 0x3A, 0x37, 0x78, 0xB6, 0x97, 0x22, 0x49, 0x2C, 0x17, 0xCD, 0xD8, 0xF6, 0x95, 0x76, 0x58,
-0xEF, 0x6F, 0x25, 0xDF, 0xED, 0x31, 0xC2, 0x68, 0x36, 0x14, 0x3F, 0x39, 0x89, 0x2F, 0x33, 0x98, 0x95, 0x9B, 0xA1, 0xE8, 0xDD,
-0xD5, 0xEC, 0x85, 0x55, 0xA4, 0x66, 0x7B, 0xAF, 0xEF, 0x82, 0x2B, 0x18, 0x68, 0xCD, 0x16, 0x78, 0xDE, 0xC0, 0x88, 0xC3, 0xEE,
-0xCE, 0xA6, 0x2B, 0x04, 0xD0, 0x22, 0xFC, 0x20, 0x79, 0x45, 0x71, 0x34, 0x7A, 0xE3, 0x78, 0x51, 0xBE, 0x87, 0x26, 0x19, 0xF8,
-0x83, 0xDF, 0x2E, 0xB1, 0x07, 0x38, 0xE5, 0xF3, 0x1F, 0xE2, 0x0D, 0xCD, 0xFA, 0xCA, 0x8B, 0x3E, 0x8A, 0x7D, 0xFE, 0x4B, 0x0D,
-0x06, 0xA8, 0xBC, 0x2B, 0x00, 0xAB, 0x21, 0xFD, 0x9C, 0x77, 0x6A, 0x16, 0xDE, 0xA2, 0x5F, 0x24, 0x99, 0x2A, 0xDD, 0x83, 0xBE,
-0xB3, 0x31, 0xD9, 0x3D, 0xFC, 0xDE, 0x40, 0xD9, 0x77, 0x3B, 0x95, 0xE8, 0x50, 0x9D, 0xF7, 0x8C, 0xB4, 0xE7, 0xBA, 0x27, 0x8E,
-0x28, 0x6A, 0x5E, 0xC6, 0x4B, 0x97, 0xCC, 0xE8, 0x15, 0x2C, 0x9E, 0x35, 0xEF, 0x16, 0xCB, 0x1D, 0x33, 0x2D, 0x8D, 0x37, 0xD0,
-0xF5, 0x25, 0xC5, 0xF5, 0x32, 0x2D, 0x8E, 0xD7, 0x2D, 0xF7, 0xEE, 0x49, 0x8A, 0x93, 0xCA, 0x8B, 0x65, 0x56, 0x1C, 0x2F, 0x9B,
-0x58, 0x71, 0xA3, 0x82, 0x71, 0xC7, 0xAC, 0x07, 0x7E, 0xAC, 0xEA, 0x97, 0x72, 0xBD, 0x9C, 0xC9, 0x8F, 0x15, 0x15, 0x8C, 0x9B,
-0x65, 0x3D, 0xEA, 0x63, 0x51, 0xD1, 0x1A, 0xC5, 0xB0, 0xC0, 0x6C, 0xF1, 0x50, 0xD1, 0x4E, 0x71, 0x97, 0x99, 0x89, 0x9F, 0x35,
-0x05, 0x8B, 0xD8, 0x88, 0x99, 0xB8, 0xD5, 0xC4, 0xC2, 0x78, 0xF7, 0x67, 0x2F, 0x2F, 0xC7, 0xE9, 0xCB, 0xA4, 0x6B, 0xCD, 0xBA,
-0x26, 0x58, 0x46, 0xA9, 0xE2, 0xB7, 0x7D, 0xE2, 0xF8, 0x75, 0x65, 0x59, 0xB2, 0x66, 0xCE, 0x8A, 0x84, 0x57, 0xFC, 0x57, 0x45,
-0xE3, 0x52, 0xCE, 0xAB, 0xE2, 0x77, 0x75, 0x51, 0xD1, 0x4D, 0xFE, 0xD3, 0xDE, 0xCB, 0x32, 0xF9, 0x95, 0xF8, 0x59, 0x59, 0x8E,
-0xAB, 0xA6, 0xD4, 0x57, 0x92, 0xD2, 0x4F, 0x57, 0x6D, 0x53, 0x95, 0x97, 0x45, 0x27, 0x68, 0xCD, 0x5C, 0x22, 0xC5, 0xCB, 0xAB,
-0x1C, 0x92, 0xE4, 0x0F, 0x9F, 0x51, 0x99, 0x0A, 0xFB, 0xDA, 0x66, 0xD8, 0x45, 0xE7, 0xAF, 0x25, 0x30, 0xF9, 0x29, 0xCC, 0xB9,
-0x4F, 0xCA, 0xD7, 0xF7, 0x60, 0x4F, 0xDA, 0xC6, 0xD3, 0xC0, 0xB6, 0xA2, 0xD7, 0x65, 0xFC, 0x85, 0x95, 0x31, 0x75, 0x76, 0x46,
-0x50, 0x33, 0x4A, 0x1A, 0xA5, 0x01, 0x0F, 0x36, 0x5B, 0xE3, 0x16, 0x25, 0xDA, 0x54, 0x2C, 0x2C, 0x56, 0x46, 0x4C, 0xBB, 0x78,
-0xC0, 0x34, 0x7B, 0xC8, 0xE0, 0x75, 0xCD, 0x5D, 0xD4, 0xE9, 0x93, 0x94, 0x20, 0xDA, 0x59, 0xCA, 0x3A, 0x1F, 0x43, 0xD3, 0xE2,
-0xC0, 0xAA, 0xA2, 0x37, 0x2B, 0x5B, 0x54, 0xA6, 0x52, 0xA4, 0x5D, 0x81, 0xFE, 0x5A, 0xD5, 0x5F, 0x55, 0x80, 0x5B, 0xA3, 0x72,
-0x85, 0x92, 0xAD, 0x36, 0xF7, 0x52, 0x03, 0x85, 0x59, 0x45, 0x18, 0x59, 0xA3, 0xBA, 0xA1, 0x1A, 0x32, 0xE2, 0xB4, 0x3E, 0x51,
-0x23, 0xBB, 0x51, 0x93, 0xE9, 0x03, 0xCE, 0xD4, 0x32, 0xBD, 0x68, 0x97, 0xD4, 0x06, 0x43, 0x3D, 0x37, 0xBA, 0x57, 0x17, 0x8A,
-0x75, 0x85, 0x0E, 0xA7, 0x32, 0x8D, 0x5F, 0x85, 0x2E, 0xA1, 0x2A, 0xDF, 0x52, 0xFD, 0xBD, 0xBF, 0x2D, 0x84, 0x69, 0xB9, 0x00,
-0xCB, 0x97, 0xB8, 0x00, 0xB7, 0x74, 0x23, 0x83, 0x05, 0x75, 0x2E, 0x6D, 0x57, 0xC3, 0xE8, 0x93, 0x8D, 0xAD, 0xAD, 0x0E, 0xF9,
-0x3B, 0xDA, 0x02, 0xD5, 0x36, 0x09, 0xFB, 0x72, 0x84, 0x4D, 0x3E, 0xF3, 0xF2, 0x99, 0x4B, 0xB5, 0x71, 0x6D, 0x00, 0x8E, 0xA9,
-0x29, 0x9C, 0xBF, 0x39, 0x5A, 0xA0, 0xAC, 0x0A, 0x86, 0xD7, 0xF9, 0x34, 0xB6, 0xD4, 0xB5, 0x86, 0xC3, 0xD5, 0x41, 0x35, 0x33,
-0xF7, 0xE0, 0x57, 0x8D, 0xAB, 0x66, 0x41, 0x4E, 0xE3, 0x8F, 0x8D, 0x01, 0x04, 0x8F, 0xCC, 0xD9, 0xAD, 0xCC, 0x74, 0xC4, 0xC7,
-0xA4, 0x19, 0x93, 0xA9, 0x21, 0x40, 0x57, 0xD7, 0xAD, 0xE8, 0xA7, 0x12, 0x02, 0x33, 0x2B, 0xE2, 0x5E, 0xAE, 0xE8, 0x2F, 0x8D,
-0xA8, 0xD9, 0xAD, 0xC9, 0x22, 0x54, 0xD7, 0xE7, 0x32, 0x84, 0x67, 0x93, 0xFA, 0xD6, 0x2E, 0x48, 0x16, 0xD0, 0x00, 0x06, 0x96,
-0x3E, 0xFE, 0xEA, 0xD8, 0xBB, 0x0B, 0x47, 0xAD, 0xA3, 0xB2, 0x64, 0xF1, 0x54, 0x51, 0x1A, 0x3B, 0xFA, 0x10, 0xA8, 0x80, 0x81,
-0xE5, 0x0F, 0x15, 0x65, 0x59, 0x2F, 0x84, 0x59, 0x2C, 0x2B, 0xFE, 0x40, 0x31, 0xFB, 0x33, 0x4B, 0x0B, 0x67, 0x33, 0x5A, 0x81,
-0x05, 0x59, 0x6E, 0x54, 0xFE, 0x21, 0x6C, 0x14, 0x67, 0x52, 0x25, 0xFA, 0x5C, 0x5B, 0xF3, 0x75, 0xE0, 0x61, 0x6C, 0x36, 0x5A,
-0xE7, 0x84, 0xFD, 0xAE, 0x19, 0xB3, 0x64, 0x88, 0x7B, 0x0D, 0x76, 0x6F, 0x8C, 0x96, 0x24, 0x5E, 0xE1, 0x7A, 0x67, 0xF6, 0x35,
-0x35, 0xF5, 0x4B, 0x13, 0xDD, 0xA2, 0xBE, 0x78, 0xD5, 0xA8, 0xBE, 0x64, 0xBD, 0xCB, 0x10, 0x29, 0x5E, 0xD4, 0xD4, 0x51, 0xAD,
-0x8D, 0x59, 0x35, 0xE9, 0x1D, 0xB6, 0xAB, 0xDA, 0xEE, 0x19, 0x10, 0x34, 0x83, 0x4F, 0x06, 0x42, 0x7E, 0x59, 0xF6, 0xBD, 0x1A,
-0x88, 0x62, 0x13, 0x8C, 0xA2, 0x8F, 0xF6, 0xB2, 0xE8, 0xC7, 0x0A, 0x18, 0x7C, 0x1C, 0x12, 0x00, 0x65, 0x14, 0xF5, 0x64, 0xA2,
-0x58, 0x11, 0x67, 0xEE, 0xB4, 0x7C, 0xAE, 0xA8, 0x17, 0x73, 0x93, 0x62, 0xD6, 0xEB, 0xCC, 0x15, 0xCF, 0x9D, 0xCA, 0x45, 0xFF,
-0x38, 0x0A, 0xD9, 0x1A, 0x9A, 0xC2, 0x8F, 0xEA, 0x62, 0x2C, 0xCA, 0x31, 0x96, 0xCB, 0xF1, 0x57, 0x75, 0xC1, 0xBD, 0x64, 0x3E,
-0xCF, 0xF0, 0x9A, 0x8E, 0x2F, 0xCC, 0xDC, 0xC3, 0x87, 0x8A, 0xF2, 0x69, 0x96, 0xBD, 0x4C, 0xC3, 0x24, 0x0D, 0x73, 0xB6, 0x0A,
-0xA4, 0x67, 0x9B, 0x31, 0x6F, 0x19, 0x83, 0x59, 0xEA, 0x86, 0x29, 0x31, 0x50, 0xDF, 0x0B, 0x3C, 0x61, 0x4B, 0x2C, 0xB0, 0x7C,
-0x99, 0xED, 0xD8, 0x6B, 0xC0, 0x39, 0x5C, 0x2F, 0x8F, 0x47, 0x73, 0xB3, 0x74, 0x2C, 0xD9, 0x4F, 0x4B, 0x35, 0xE4, 0xD7, 0xAA,
-0xC0, 0x2F, 0xA7, 0xB5, 0x98, 0x04, 0xAF, 0x61, 0x00, 0x58, 0x52, 0xAA, 0xAA, 0xBC, 0xC7, 0xBA, 0x9B, 0x03, 0x7D, 0x27, 0x06,
-0xCC, 0xFC, 0x94, 0x46, 0xB4, 0x34, 0xFF, 0xA9, 0xF2, 0xF2, 0xA2, 0xD4, 0xFE, 0xAA, 0x90, 0x10, 0xAD, 0x94, 0x19, 0x93, 0xE3,
-0x85, 0x49, 0xAB, 0x63, 0xCD, 0x66, 0xFD, 0x88, 0xC6, 0xC5, 0xC4, 0x70, 0x34, 0x02, 0x9E, 0x66, 0x86, 0xFC, 0x9E, 0x95, 0x7B,
-0x43, 0x87, 0x30, 0x72, 0xAE, 0x7F, 0x64, 0x7D, 0x3A, 0x77, 0xDE, 0x49, 0xF9, 0x8C, 0xCA, 0xCA, 0x62, 0xA4, 0x0A, 0xF4, 0x7B,
-0x62, 0x4C, 0x8A, 0x31, 0x81, 0xDD, 0x7D, 0x66, 0xA5, 0xE5, 0x67, 0x4B, 0x53, 0x72, 0xB6, 0x64, 0x0B, 0x50, 0x43, 0x05, 0x8A,
-0xB8, 0x53, 0xEF, 0xE4, 0x57, 0xC0, 0x95, 0x42, 0xF4, 0x99, 0x60, 0xC5, 0x47, 0x13, 0xAA, 0xA9, 0x11, 0x65, 0xB4, 0x25, 0xF7,
-0x43, 0x4A, 0xDC, 0x6B, 0x5C, 0x02, 0xF2, 0x3B, 0x83, 0x12, 0xBC, 0x91, 0xE5, 0xB7, 0x69, 0xCC, 0x4A, 0xE3, 0x4A, 0x47, 0x5E,
-0x86, 0xA1, 0xDF, 0x65, 0x29, 0x04, 0x1B, 0x18, 0xFA, 0x86, 0xBE, 0x8C, 0x82, 0x6B, 0xD7, 0xE4, 0x48, 0x82, 0x55, 0xF9, 0xB4,
-0xAD, 0x59, 0x69, 0x2C, 0xC1, 0xD9, 0x32, 0xB5, 0x9C, 0xAE, 0x7E, 0xA9, 0xB8, 0x45, 0x2A, 0x6E, 0xEB, 0x57, 0xDC, 0x1F, 0xD1,
-0x72, 0x93, 0x34, 0xDB, 0x4B, 0xFC, 0xA0, 0xC9, 0x05, 0x12, 0x2D, 0x1F, 0xE9, 0xF6, 0x8A, 0x75, 0x77, 0x48, 0xAC, 0x86, 0x64,
-0xAD, 0x28, 0x0B, 0xB5, 0xAC, 0x79, 0xBC, 0x26, 0x0D, 0xA7, 0xDC, 0xE5, 0x9C, 0x85, 0x6B, 0x7A, 0xFA, 0xE2, 0xF9, 0xC3, 0x17,
-0xCF, 0xFF, 0xF5, 0xD3, 0xF3, 0x87, 0x8F, 0x5E, 0x7D, 0xFF, 0xEA, 0x05, 0xFC, 0x75, 0x3A, 0x0D, 0x0D, 0xD1, 0xEB, 0x8C, 0xD6,
-0xED, 0x79, 0x19, 0x2A, 0x66, 0xA8, 0x2E, 0x4F, 0x93, 0x65, 0xA2, 0x26, 0xD6, 0xE2, 0x95, 0xF3, 0x65, 0xDC, 0x9E, 0xD5, 0x4C,
-0x99, 0x72, 0x61, 0x66, 0x99, 0xB2, 0xDA, 0x48, 0x3E, 0xE5, 0xB1, 0x2E, 0x13, 0xC9, 0xF1, 0xF0, 0x48, 0x97, 0xF1, 0x0E, 0x16,
-0xD7, 0x58, 0x7A, 0xBE, 0x8E, 0x0B, 0x79, 0x7E, 0x57, 0xA6, 0xE3, 0xC3, 0x34, 0x6F, 0x45, 0xEB, 0xE7, 0xF7, 0x44, 0xE6, 0x3C,
-0xC9, 0x94, 0x8A, 0xC5, 0xF4, 0x51, 0x73, 0xBF, 0x5D, 0x20, 0xAC, 0x1B, 0x75, 0xF8, 0x5D, 0x60, 0x3B, 0xD4, 0xED, 0xD7, 0x59,
-0x3B, 0xF4, 0x50, 0x45, 0x6A, 0x11, 0x29, 0x9B, 0x8A, 0x61, 0x5D, 0x6D, 0xB4, 0xC0, 0x92, 0x2C, 0xBD, 0xB8, 0x40, 0x24, 0x1A,
-0xA5, 0x6A, 0x19, 0xB0, 0x5F, 0xB9, 0x56, 0xD4, 0x4B, 0x69, 0x71, 0x69, 0xEE, 0x47, 0x11, 0xC1, 0x1B, 0xC9, 0xAC, 0x32, 0x4D,
-0x8A, 0x9C, 0x19, 0x46, 0xD6, 0x09, 0xC8, 0x50, 0x4D, 0x1F, 0x7D, 0xE6, 0x15, 0x8E, 0x80, 0x4B, 0x6F, 0x74, 0x7C, 0x92, 0xAE,
-0xDE, 0xAC, 0x31, 0x52, 0x78, 0xC6, 0x70, 0xE4, 0xBD, 0x48, 0xBF, 0x6F, 0x68, 0x62, 0x2C, 0xA7, 0xEB, 0xF8, 0x91, 0x7C, 0x55,
-0x2F, 0x2C, 0xC5, 0xE9, 0x75, 0x11, 0x23, 0xCA, 0x4C, 0xA4, 0x70, 0xD7, 0xC3, 0x9B, 0x14, 0x6D, 0x23, 0x4C, 0x1A, 0x78, 0x27,
-0x33, 0x82, 0x99, 0x58, 0xCA, 0x14, 0x4A, 0x61, 0xA6, 0x96, 0xB3, 0x59, 0xDC, 0xD0, 0x93, 0xB6, 0xD4, 0xDF, 0x32, 0x63, 0x3A,
-0xAD, 0x43, 0x2F, 0x03, 0xA9, 0xBF, 0x8D, 0x25, 0x0A, 0x2F, 0xD1, 0xFB, 0x2E, 0x3F, 0xBA, 0x80, 0x0B, 0x60, 0x70, 0x1C, 0x4C,
-0x44, 0x5F, 0xC2, 0x7C, 0x00, 0xDB, 0x0B, 0x52, 0xD3, 0x7C, 0xE7, 0x5C, 0xCB, 0x73, 0x68, 0x44, 0x41, 0x91, 0x1F, 0xA5, 0x99,
-0x10, 0x03, 0xA4, 0x71, 0x34, 0xED, 0x16, 0x7D, 0x4A, 0xA7, 0x8A, 0xD1, 0x61, 0x05, 0x37, 0xF4, 0x3B, 0x95, 0x49, 0x27, 0x2F,
-0x16, 0x55, 0xC9, 0x12, 0x59, 0x89, 0xB7, 0x54, 0x55, 0x4C, 0xA5, 0x65, 0x5A, 0x38, 0x36, 0xED, 0x4C, 0x9B, 0xD1, 0xB3, 0x19,
-0x6C, 0x69, 0x45, 0xD2, 0xC8, 0x26, 0x8B, 0xBF, 0x10, 0x50, 0x15, 0xFE, 0x69, 0xCB, 0x0C, 0x54, 0x56, 0x52, 0x93, 0x02, 0xA9,
-0xAB, 0x4A, 0xE7, 0xC3, 0xD6, 0xCC, 0x49, 0x6B, 0xE7, 0x4E, 0xB2, 0xD9, 0x64, 0xD8, 0xF3, 0x1C, 0xA9, 0xED, 0xAB, 0xC8, 0x5A,
-0x27, 0xC9, 0xD1, 0x05, 0x62, 0xDF, 0x69, 0xE1, 0x1A, 0xE8, 0x35, 0x3A, 0xA5, 0x63, 0x23, 0xF6, 0x5D, 0x0D, 0x56, 0x8D, 0xA1,
-0xAF, 0x85, 0xA9, 0x15, 0x22, 0x40, 0x55, 0xF6, 0xC0, 0xD5, 0x72, 0x1A, 0x4B, 0x86, 0x6B, 0xDF, 0xFA, 0x25, 0x9D, 0x54, 0xCD,
-0xA6, 0x5F, 0x28, 0xA3, 0x68, 0x19, 0x69, 0xC5, 0x58, 0x54, 0x44, 0x42, 0x2C, 0xAB, 0x53, 0x0E, 0x09, 0x41, 0x6C, 0x85, 0x36,
-0xAB, 0xA1, 0x06, 0x4B, 0x3A, 0x9D, 0xAC, 0x9B, 0x81, 0xAB, 0x52, 0x1E, 0xD3, 0xC4, 0x15, 0x3E, 0xEE, 0x2E, 0x5F, 0x0F, 0xCD,
-0xE4, 0xE9, 0x22, 0x31, 0x9A, 0x1E, 0x58, 0xEC, 0x5A, 0xD5, 0x4C, 0xA9, 0x72, 0xE5, 0x45, 0x55, 0x03, 0xE6, 0x82, 0xAB, 0x91,
-0xE0, 0xEB, 0x63, 0x82, 0xD4, 0x8A, 0xA1, 0x0D, 0xC6, 0x67, 0x17, 0x44, 0xED, 0xC3, 0xBC, 0xA0, 0x22, 0xA3, 0x66, 0xB4, 0x95,
-0x62, 0xF0, 0x5A, 0x83, 0xB6, 0x64, 0xBA, 0x6B, 0x3C, 0xA1, 0x98, 0x86, 0x74, 0xC5, 0x9C, 0x36, 0xD3, 0x9A, 0x34, 0x9F, 0x53,
-0xB6, 0xDA, 0xD7, 0x9B, 0xD6, 0x32, 0x87, 0x59, 0xBB, 0xE6, 0x38, 0xC1, 0x64, 0xFE, 0x1A, 0x2D, 0x7A, 0x79, 0x80, 0x58, 0x5D,
-0xA8, 0x72, 0x36, 0x2E, 0x47, 0x0F, 0x55, 0x43, 0xD4, 0x73, 0xBE, 0x99, 0x56, 0x12, 0x92, 0xA6, 0x65, 0x44, 0xCA, 0x88, 0xE3,
-0xE6, 0x38, 0x64, 0x0B, 0x0A, 0x57, 0xA9, 0x55, 0x3E, 0xA8, 0x7C, 0xA4, 0xFD, 0xBE, 0x5F, 0x7E, 0xBA, 0x37, 0x86, 0x93, 0x46,
-0xF9, 0x28, 0x1F, 0x32, 0x14, 0x9D, 0x8E, 0x04, 0xD9, 0xAA, 0xC4, 0xA1, 0x5D, 0x5C, 0xA5, 0xB5, 0x59, 0x1D, 0xE0, 0x87, 0xA5,
-0x16, 0x5D, 0xDF, 0x64, 0x04, 0xE5, 0xE3, 0x38, 0x08, 0xFC, 0x57, 0x01, 0x35, 0x25, 0xC4, 0x1E, 0xB7, 0x75, 0x45, 0x46, 0x07,
-0xD5, 0xBC, 0xD5, 0xDA, 0x06, 0xE6, 0x65, 0x2B, 0xDD, 0x23, 0x16, 0xE6, 0x26, 0x2B, 0x18, 0x5C, 0xD6, 0xC0, 0xD7, 0x31, 0x6B,
-0xEA, 0xE0, 0x98, 0x35, 0xF6, 0x6A, 0xCC, 0xD6, 0x77, 0x65, 0xCC, 0x9A, 0xFB, 0x2F, 0x66, 0xEB, 0x3B, 0x2D, 0x66, 0xAB, 0x3D,
-0xDE, 0x32, 0x79, 0x87, 0xAF, 0x66, 0x2F, 0x59, 0x33, 0x6F, 0xB8, 0x6C, 0x1D, 0x17, 0xB8, 0x4C, 0x12, 0x0A, 0x2A, 0x7D, 0xDF,
-0x32, 0x49, 0x2A, 0xA8, 0x74, 0x7A, 0xE3, 0x86, 0x0F, 0x15, 0x61, 0x6A, 0x44, 0x19, 0x65, 0x29, 0x9A, 0x26, 0x04, 0xBA, 0x6A,
-0x54, 0xA1, 0x3B, 0xBC, 0xCE, 0x44, 0xB9, 0xA4, 0x4C, 0x60, 0x27, 0xEB, 0xBA, 0xE4, 0xA2, 0x85, 0x26, 0x4B, 0x2D, 0x5E, 0xAA,
-0xBB, 0x14, 0xB8, 0x5C, 0x93, 0xA5, 0x96, 0x2D, 0x94, 0x5D, 0x7A, 0xD1, 0x07, 0x34, 0xC0, 0x8D, 0xD1, 0x09, 0xA6, 0xEA, 0xD2,
-0x0B, 0xCB, 0x2A, 0x17, 0x03, 0xBC, 0xAC, 0xA3, 0xD1, 0x2B, 0x2A, 0x8A, 0x16, 0xA3, 0xA6, 0xA2, 0x9B, 0x91, 0xAB, 0x32, 0x91,
-0xDD, 0xD6, 0xBF, 0x42, 0xB9, 0x66, 0x16, 0xA7, 0xFA, 0xB2, 0xBA, 0x3A, 0x4C, 0xC1, 0x26, 0x57, 0xE4, 0x4A, 0x33, 0x5B, 0x25,
-0xA1, 0x5B, 0x93, 0x8B, 0x2B, 0x2A, 0xB3, 0x11, 0xB9, 0xA6, 0x0D, 0xA7, 0x50, 0xB0, 0xE9, 0x75, 0x0A, 0x35, 0x99, 0x59, 0xA7,
-0x50, 0xAA, 0xE9, 0x98, 0x13, 0xCA, 0x31, 0x13, 0x6B, 0x85, 0x1E, 0x4D, 0xAF, 0x22, 0x2B, 0xA4, 0x8C, 0x5A, 0xB2, 0x0A, 0xCB,
-0x56, 0xD1, 0x3E, 0xB7, 0x85, 0xD2, 0x4A, 0xAE, 0x22, 0x69, 0x9E, 0xAC, 0xE8, 0x96, 0x14, 0x55, 0x72, 0x35, 0xA1, 0x7E, 0x52,
-0xEB, 0xC8, 0x4A, 0x2A, 0xA5, 0x91, 0x28, 0xD4, 0xC8, 0x5E, 0xE8, 0xA7, 0xE4, 0x52, 0x54, 0xF1, 0x63, 0x14, 0xE3, 0x59, 0x38,
-0x95, 0x95, 0xC4, 0x54, 0x4F, 0x46, 0xD1, 0x52, 0x43, 0x65, 0xAC, 0x51, 0xA6, 0x20, 0xB2, 0xAE, 0x6F, 0x5D, 0xAB, 0x64, 0xD4,
-0x45, 0x65, 0x51, 0x75, 0xCD, 0x42, 0xBB, 0xA4, 0xA0, 0x47, 0x56, 0x19, 0xD9, 0xAA, 0x9A, 0xAA, 0x26, 0x05, 0x5F, 0x8A, 0xDA,
-0xC8, 0x56, 0xDF, 0xA2, 0x70, 0x92, 0x01, 0x14, 0x4A, 0xA5, 0xA2, 0x82, 0xA4, 0x1B, 0xD2, 0xE4, 0x13, 0x45, 0x39, 0xA7, 0xE2,
-0x54, 0xD6, 0xE2, 0xAD, 0x69, 0xA0, 0x95, 0x5D, 0xDC, 0x32, 0xEB, 0xD8, 0x4B, 0x8B, 0x9B, 0x89, 0x83, 0xE0, 0x34, 0xAF, 0x0E,
-0x9A, 0xE3, 0x7C, 0x23, 0x0D, 0x8B, 0xDF, 0xBE, 0x6C, 0x73, 0x25, 0x86, 0xD3, 0x91, 0xEF, 0x61, 0xD4, 0xD1, 0x0A, 0xBB, 0x40,
-0xA9, 0x91, 0x9D, 0x2A, 0x3B, 0x15, 0x1A, 0x73, 0x46, 0xC9, 0x00, 0x2D, 0x59, 0x16, 0xD6, 0xB8, 0x12, 0x67, 0xAB, 0x3D, 0x88,
-0xB3, 0xD2, 0xF0, 0xB0, 0xDA, 0x77, 0x38, 0x2B, 0xAD, 0x0E, 0xAB, 0xBD, 0x86, 0xB3, 0xA6, 0xCE, 0xC2, 0xE7, 0x8A, 0xE6, 0xC2,
-0x48, 0x37, 0x8B, 0x97, 0xA2, 0x55, 0xB6, 0x29, 0x4C, 0xEA, 0x2A, 0x4C, 0x76, 0xA8, 0x99, 0xCC, 0x68, 0x45, 0xE9, 0x1D, 0x76,
-0xFA, 0x28, 0x2C, 0x08, 0x0F, 0x7E, 0xDD, 0xA9, 0xEE, 0x00, 0xCB, 0xFB, 0x6A, 0xE9, 0x82, 0x21, 0xFA, 0x49, 0x9D, 0x28, 0x04,
-0xC7, 0xD5, 0x02, 0xA3, 0xDE, 0x19, 0x51, 0x55, 0xA2, 0x0D, 0x5D, 0x9D, 0x38, 0xBA, 0x80, 0x5E, 0xD2, 0x00, 0xB7, 0x57, 0x2A,
-0xFD, 0xD6, 0xD6, 0x46, 0xCA, 0xBC, 0x48, 0xEA, 0x95, 0xA9, 0x7F, 0x54, 0x24, 0xC7, 0xA2, 0x3D, 0x43, 0xF1, 0x78, 0xA1, 0xD0,
-0xE2, 0xEF, 0xFB, 0x18, 0x94, 0x32, 0xE3, 0x92, 0xFC, 0xF5, 0x8F, 0xB2, 0xF8, 0x7E, 0x8F, 0xB4, 0xEE, 0xA5, 0x01, 0x26, 0x68,
-0x1B, 0x0D, 0xB9, 0x0F, 0xC3, 0xFB, 0xAE, 0x7A, 0x67, 0xC7, 0x63, 0x1B, 0x13, 0x1E, 0xDC, 0x58, 0xFE, 0xC4, 0x93, 0xA1, 0x6C,
-0x93, 0x8F, 0xA4, 0x25, 0xE7, 0x42, 0x69, 0x41, 0x69, 0x23, 0x84, 0x33, 0x39, 0x57, 0xEA, 0xD2, 0x20, 0xC9, 0x44, 0x8B, 0x16,
-0x9D, 0x75, 0x34, 0x7F, 0x00, 0x7D, 0x88, 0x39, 0x63, 0x28, 0x9A, 0xE2, 0x04, 0xDF, 0xD6, 0x44, 0x95, 0xC4, 0xCF, 0x18, 0x93,
-0x98, 0xC6, 0xDC, 0xBC, 0x31, 0x60, 0xD1, 0xB1, 0xD6, 0xCD, 0x74, 0xA3, 0x85, 0x62, 0x16, 0xE8, 0x5C, 0x3F, 0xD9, 0x4D, 0x71,
-0x10, 0x2B, 0x97, 0x4F, 0x28, 0x5F, 0x8D, 0x70, 0xEF, 0xEB, 0x06, 0x8A, 0xDE, 0x6A, 0x25, 0x32, 0xDE, 0x3F, 0xE2, 0xB5, 0x15,
-0xFE, 0x50, 0x02, 0x8F, 0xD1, 0xEB, 0x5E, 0xFE, 0xB2, 0xAE, 0x05, 0x16, 0x5B, 0xCC, 0x0F, 0x33, 0x38, 0x82, 0xE0, 0xAE, 0xE2,
-0x8C, 0xA3, 0x64, 0x72, 0x24, 0x5F, 0xB8, 0xE1, 0x52, 0x5C, 0x07, 0x40, 0x9C, 0xC4, 0x81, 0x53, 0xD9, 0x63, 0x3D, 0xB0, 0x3C,
-0x4E, 0x99, 0x71, 0x3A, 0xCD, 0xD3, 0x25, 0x2A, 0x30, 0x8A, 0x6D, 0x05, 0x0B, 0xD1, 0x3C, 0x51, 0x79, 0xBB, 0xD5, 0xEB, 0xF5,
-0x5A, 0x4A, 0x4E, 0xA9, 0x32, 0x30, 0x38, 0x46, 0x5C, 0x2A, 0xAA, 0xC8, 0x20, 0xCA, 0x70, 0x24, 0x6F, 0xE3, 0x5E, 0xFF, 0xB0,
-0x4B, 0x5A, 0x6F, 0xE3, 0xFF, 0xF7, 0x7F, 0xFE, 0x6F, 0x4B, 0x4E, 0x40, 0xC9, 0x02, 0xE8, 0xCA, 0x50, 0x1A, 0x1D, 0xAF, 0xF7,
-0x58, 0x96, 0x01, 0x94, 0x85, 0x2F, 0x9C, 0xC0, 0xA4, 0x3A, 0x25, 0xC0, 0x9A, 0xFA, 0x48, 0x74, 0xD2, 0xE4, 0x41, 0xF4, 0x45,
-0xD8, 0x7C, 0x4C, 0xF7, 0x83, 0x63, 0x0A, 0x45, 0xE6, 0xA9, 0xEF, 0xC3, 0xFC, 0x87, 0xE5, 0x98, 0x45, 0x52, 0xBD, 0x60, 0xC8,
-0xE9, 0xE6, 0xF9, 0x05, 0x78, 0x86, 0x25, 0x16, 0xB7, 0x89, 0x15, 0x6D, 0x10, 0x2A, 0xFF, 0x22, 0x39, 0x09, 0x34, 0xBC, 0x95,
-0x9D, 0xFB, 0xF7, 0xBF, 0xC9, 0xB5, 0xB2, 0x03, 0xF5, 0x51, 0xD8, 0xCB, 0xA4, 0x13, 0x13, 0x16, 0xD5, 0xA2, 0x0C, 0x84, 0xCE,
-0x93, 0x12, 0x64, 0x6B, 0xC4, 0x60, 0xD7, 0x07, 0x44, 0x65, 0xAB, 0x32, 0x77, 0x4E, 0x1B, 0xB8, 0xA1, 0xE9, 0x25, 0xCA, 0xA3,
-0xB6, 0x52, 0x4E, 0x05, 0x92, 0x4F, 0x0E, 0x0C, 0x07, 0x7F, 0xB7, 0xFB, 0x0F, 0xDA, 0x6F, 0xFD, 0xEF, 0x3A, 0x6F, 0x5D, 0xFA,
-0xA7, 0xF7, 0x5A, 0x7E, 0xEA, 0xDB, 0xFA, 0xC2, 0x60, 0xA8, 0xEA, 0xA8, 0x7B, 0xA6, 0xC6, 0xED, 0x01, 0xF2, 0xF4, 0xB9, 0xF7,
-0x21, 0x49, 0xB7, 0xC9, 0xF3, 0xE5, 0x7C, 0x1C, 0xA4, 0x6D, 0x5A, 0xF1, 0xCD, 0xF0, 0x5D, 0xA7, 0x8B, 0x19, 0x89, 0x8D, 0x0F,
-0x1B, 0xEF, 0x3A, 0x1A, 0x87, 0xC7, 0xFF, 0x5E, 0x57, 0xC1, 0xD9, 0xAC, 0x82, 0x73, 0x03, 0xE1, 0xD4, 0xA8, 0xCB, 0x08, 0xEC,
-0x52, 0x98, 0x3A, 0xA0, 0x32, 0x36, 0x05, 0x0F, 0xD8, 0x98, 0x3D, 0x0F, 0x4E, 0xE8, 0x66, 0xDB, 0x66, 0x93, 0xDE, 0x15, 0xF4,
-0x66, 0x22, 0x17, 0x49, 0x83, 0x15, 0x72, 0x69, 0x57, 0x69, 0x08, 0x1D, 0x5E, 0x9A, 0xBD, 0x31, 0x74, 0x92, 0x1C, 0x99, 0x4A,
-0xAD, 0x5D, 0xB5, 0x4E, 0x75, 0xD6, 0x08, 0xAD, 0x32, 0x22, 0x41, 0xAE, 0x8C, 0xCF, 0x2B, 0x46, 0xC7, 0x57, 0xF3, 0x48, 0x21,
-0x9E, 0x76, 0x99, 0x56, 0xA3, 0x6A, 0xAD, 0xE9, 0x35, 0xA4, 0x15, 0x50, 0xB5, 0x58, 0xE4, 0x95, 0xB2, 0x22, 0x59, 0x81, 0xB6,
-0x28, 0xF8, 0xCA, 0x04, 0x5E, 0x43, 0x15, 0xBE, 0x17, 0x5A, 0x22, 0x4C, 0xCC, 0xA4, 0x53, 0x29, 0xA6, 0xE8, 0x41, 0x31, 0x93,
-0xEE, 0x83, 0x0E, 0x4D, 0x59, 0xA8, 0x7E, 0x7F, 0x5D, 0x7E, 0x7F, 0xDD, 0xE9, 0x98, 0x33, 0x2D, 0x7A, 0xCD, 0xB3, 0xBC, 0xB6,
-0xDF, 0xDF, 0x8F, 0xB9, 0x5E, 0x12, 0x39, 0xA6, 0xE8, 0xBB, 0x48, 0x0F, 0x02, 0xA8, 0x39, 0x87, 0x16, 0x88, 0x77, 0x0C, 0x4C,
-0x15, 0x85, 0x3C, 0x17, 0xF3, 0x84, 0xEC, 0xA1, 0x1B, 0x26, 0x9A, 0xB2, 0xBF, 0xF8, 0x11, 0x8D, 0xD6, 0xB1, 0x62, 0x88, 0xA9,
-0x4F, 0xD1, 0xD7, 0x17, 0x98, 0x2D, 0x07, 0x17, 0x03, 0x5B, 0x86, 0xA9, 0x85, 0x62, 0x7B, 0x98, 0x14, 0x35, 0x12, 0x45, 0xBD,
-0x71, 0x02, 0xA7, 0x55, 0x84, 0xB3, 0x56, 0x6E, 0x12, 0x53, 0x33, 0x2E, 0x12, 0x51, 0x24, 0xB9, 0x87, 0x59, 0x28, 0x4A, 0x51,
-0xED, 0xFB, 0x47, 0x07, 0x20, 0x6F, 0x75, 0xF4, 0xD5, 0xE8, 0x42, 0xE7, 0x62, 0x4C, 0x28, 0x83, 0x4B, 0x00, 0xFE, 0x70, 0xC1,
-0xA9, 0xA2, 0xDC, 0x3C, 0x3B, 0xC4, 0x72, 0x62, 0x7E, 0xE1, 0xD1, 0x52, 0x92, 0x0A, 0x4F, 0x28, 0x3B, 0xC9, 0x45, 0x5B, 0x4C,
-0xAD, 0x1A, 0xC6, 0x61, 0x1E, 0x7A, 0x34, 0x55, 0x36, 0xC3, 0x08, 0xF4, 0xEC, 0x3B, 0x4B, 0x9E, 0x88, 0xCA, 0x04, 0x2B, 0xD6,
-0x48, 0xFF, 0xAA, 0x58, 0xF6, 0x3C, 0xE1, 0xB0, 0xE5, 0x29, 0x22, 0xBF, 0x24, 0x4B, 0x82, 0x94, 0xB8, 0xCC, 0xA8, 0x56, 0xB7,
-0xDC, 0xFF, 0xF8, 0xF4, 0xAE, 0x85, 0xFC, 0xF7, 0x57, 0x96, 0x89, 0xC5, 0x58, 0x32, 0x0C, 0x4F, 0x54, 0x9C, 0xC3, 0x8E, 0xA2,
-0xAF, 0x28, 0x1F, 0xCD, 0x36, 0x71, 0xBE, 0xBB, 0x44, 0x4A, 0x0D, 0x49, 0xC1, 0xF3, 0x3A, 0x9C, 0x86, 0x46, 0x8A, 0x23, 0x6D,
-0x0D, 0xB4, 0xEE, 0xA7, 0x2C, 0xC8, 0x7A, 0xB6, 0xE4, 0x3F, 0x4E, 0x3C, 0xE0, 0x16, 0x40, 0xAB, 0x13, 0x04, 0x41, 0x5E, 0x87,
-0x8F, 0xC3, 0x42, 0xE4, 0xBD, 0xD7, 0x2A, 0x84, 0xE9, 0xE1, 0x00, 0xA5, 0x69, 0xD3, 0x8F, 0x07, 0x68, 0x32, 0x48, 0x01, 0xB1,
-0x27, 0xD0, 0xF6, 0x4A, 0xCA, 0x6C, 0x42, 0x95, 0x55, 0x14, 0x29, 0x7A, 0xA2, 0x95, 0xAE, 0xA3, 0x4A, 0x3A, 0x22, 0xC4, 0x36,
-0x0E, 0x6A, 0x25, 0x45, 0x36, 0xC2, 0x33, 0x3F, 0x4D, 0xED, 0xD3, 0xC4, 0x9D, 0x17, 0xC7, 0x75, 0xCA, 0x0F, 0x65, 0x34, 0x7E,
-0x11, 0x85, 0xD5, 0x0C, 0xD5, 0xEC, 0x00, 0x67, 0xE2, 0xF9, 0xEA, 0xD1, 0xDC, 0x1D, 0x6E, 0xD0, 0x5E, 0x34, 0x46, 0x36, 0x1F,
-0x12, 0xA2, 0x9B, 0x8D, 0x68, 0x6D, 0x84, 0xF7, 0xFB, 0xE4, 0xA7, 0x3C, 0x8C, 0xF0, 0x72, 0x4B, 0x0A, 0x9D, 0x4F, 0x0E, 0x31,
-0x9C, 0x29, 0x32, 0x59, 0xFF, 0x0C, 0x84, 0xCB, 0x70, 0x42, 0x1E, 0x88, 0x24, 0xE3, 0x64, 0x0B, 0x43, 0x7A, 0x7A, 0x51, 0x66,
-0x39, 0x14, 0x3D, 0xC8, 0x58, 0x06, 0x72, 0x76, 0xD7, 0x94, 0x19, 0x27, 0x0C, 0x09, 0xB9, 0x42, 0xC5, 0xD6, 0x7A, 0xC6, 0x7A,
-0x2A, 0x9F, 0x7C, 0x51, 0xBA, 0xA4, 0x11, 0x40, 0xA4, 0x77, 0x39, 0x4B, 0x14, 0xDA, 0xF2, 0x70, 0xF8, 0xCA, 0x07, 0x16, 0xBD,
-0x19, 0x53, 0x73, 0x48, 0x6F, 0x13, 0x91, 0x65, 0x1C, 0x25, 0x14, 0x26, 0x92, 0x9C, 0xAB, 0x9F, 0xE9, 0x96, 0x21, 0x7D, 0x2D,
-0x19, 0x8F, 0x30, 0xD8, 0xCE, 0xA4, 0x3D, 0x1B, 0xD0, 0xB4, 0x47, 0xAD, 0xA1, 0xC8, 0x32, 0x0E, 0x7F, 0x5B, 0x06, 0xE4, 0xC9,
-0x43, 0xCA, 0x4E, 0x90, 0x96, 0x28, 0x3A, 0x8C, 0xF8, 0xFF, 0x5E, 0x44, 0xAF, 0xB7, 0x5A, 0x63, 0x86, 0x93, 0x1E, 0x66, 0xE5,
-0x44, 0xF5, 0x84, 0x1B, 0xF3, 0xE4, 0xE9, 0x96, 0x1A, 0x3F, 0xE4, 0xF3, 0x48, 0x0E, 0x10, 0x22, 0x87, 0x9E, 0xA0, 0x05, 0xC8,
-0xD4, 0xF3, 0x03, 0x87, 0x84, 0x3E, 0x1A, 0x9F, 0xF3, 0x46, 0xCE, 0x31, 0x17, 0xE8, 0x98, 0x46, 0x25, 0x18, 0x39, 0xBD, 0xA1,
-0x03, 0x9C, 0x39, 0xF4, 0x7A, 0x11, 0xDA, 0xFE, 0xC0, 0x31, 0x65, 0x7C, 0x26, 0x17, 0xA5, 0x16, 0x41, 0xBC, 0xC4, 0x2C, 0xF4,
-0xFD, 0x20, 0x1E, 0x39, 0x68, 0xA1, 0xE1, 0xD0, 0xB3, 0x44, 0x6F, 0x9C, 0xF5, 0xC6, 0xDE, 0xE4, 0xC8, 0x4F, 0x93, 0xC5, 0xC8,
-0xA1, 0x0A, 0xBB, 0x89, 0x1C, 0xC8, 0xC2, 0xE8, 0x4E, 0xCF, 0x0F, 0x3D, 0x38, 0x13, 0x10, 0xF9, 0xA1, 0x37, 0xE1, 0x99, 0x24,
-0xD4, 0x10, 0x18, 0x66, 0x5D, 0x9E, 0xC0, 0x55, 0x8F, 0x94, 0x61, 0x16, 0x64, 0xD7, 0x20, 0x66, 0x44, 0x8D, 0xBB, 0xB3, 0x2D,
-0xB5, 0x20, 0xA5, 0x29, 0x1D, 0x3B, 0x6C, 0xC8, 0xBB, 0xD7, 0x3F, 0xD2, 0xAF, 0xE7, 0x77, 0xFB, 0xB3, 0x2D, 0x13, 0x12, 0x8F,
-0x0B, 0x81, 0x44, 0x36, 0x72, 0xD8, 0x83, 0x23, 0x45, 0x89, 0xE8, 0x4D, 0xA2, 0x24, 0x93, 0x90, 0x04, 0xE7, 0xEE, 0x79, 0x58,
-0xB4, 0x2B, 0x63, 0x7C, 0xE4, 0xEC, 0xD1, 0xA2, 0x55, 0x11, 0x20, 0x6C, 0x31, 0x1E, 0xCC, 0x11, 0xE3, 0x02, 0x28, 0xA2, 0xCE,
-0x9D, 0xCC, 0xC2, 0x3C, 0xE8, 0x65, 0x0B, 0x38, 0x49, 0x6F, 0x93, 0x45, 0x1A, 0xF4, 0x4E, 0x60, 0x15, 0xEE, 0xE0, 0x88, 0xB0,
-0xD8, 0x79, 0x33, 0x88, 0x53, 0x58, 0xBE, 0x36, 0x1C, 0x5E, 0xFF, 0x98, 0x8B, 0x04, 0xBA, 0xAD, 0x09, 0x5B, 0x31, 0x2D, 0x0C,
-0x85, 0xB8, 0x0A, 0x23, 0x2C, 0x96, 0x54, 0x19, 0xFC, 0xA3, 0x0A, 0x33, 0xEA, 0x5C, 0xF4, 0x28, 0x2E, 0xE9, 0xCA, 0x73, 0x4A,
-0xA1, 0x8D, 0xE1, 0xE9, 0x3D, 0xBB, 0x1E, 0x5B, 0x77, 0x6A, 0x68, 0x47, 0x44, 0xC4, 0x19, 0x5B, 0x73, 0xC9, 0x11, 0x9D, 0x7C,
-0xDB, 0x28, 0x5B, 0x2F, 0x7E, 0xA4, 0x97, 0x72, 0x74, 0xCA, 0x30, 0xEE, 0x4C, 0xC3, 0x29, 0xD3, 0xDF, 0xA8, 0xCF, 0xEC, 0xE9,
-0xBD, 0xB4, 0xC2, 0x8B, 0x8B, 0x1C, 0x9C, 0x30, 0x17, 0x24, 0x59, 0x60, 0x61, 0xF7, 0xFD, 0x0F, 0x1E, 0xAE, 0x14, 0x34, 0x32,
-0x6E, 0xB7, 0xC6, 0x01, 0x30, 0x93, 0x20, 0x88, 0x31, 0xDB, 0x59, 0xC1, 0x09, 0x74, 0x0B, 0x06, 0xFA, 0x81, 0x5F, 0x04, 0xD5,
-0xDC, 0x96, 0xF2, 0xD1, 0x1B, 0x69, 0x3E, 0x18, 0x1F, 0xE2, 0x29, 0xDC, 0xC6, 0x82, 0x9D, 0xBB, 0x8C, 0x63, 0xCB, 0xB0, 0x3B,
-0x8A, 0x35, 0x42, 0x28, 0x76, 0x56, 0xC5, 0xA8, 0x64, 0x95, 0xBF, 0xC4, 0x7B, 0x63, 0x16, 0xDE, 0x77, 0x2C, 0xE1, 0xB2, 0x69,
-0xBC, 0x15, 0x18, 0x73, 0xDB, 0x48, 0x9F, 0xAE, 0xB4, 0xAA, 0x85, 0xA3, 0xE2, 0x43, 0xA1, 0x0A, 0x47, 0xE5, 0x8A, 0xA4, 0xE0,
-0xFA, 0x72, 0x7E, 0x9E, 0x8E, 0xE6, 0x91, 0x60, 0x92, 0x82, 0xB2, 0xEB, 0x37, 0x1D, 0x11, 0x23, 0xE3, 0xF5, 0x46, 0x55, 0xD3,
-0xF5, 0x72, 0x4F, 0x6A, 0x57, 0x47, 0x6D, 0x11, 0x3F, 0xE5, 0xD9, 0xB2, 0xB4, 0xCF, 0x38, 0xBB, 0x3B, 0xA6, 0x0A, 0x7E, 0x2F,
-0xB2, 0xE2, 0x17, 0x4F, 0xA0, 0x32, 0x92, 0xBF, 0xFD, 0x96, 0xAC, 0x40, 0x4C, 0x55, 0x0F, 0xCB, 0xB8, 0xC7, 0xD5, 0x00, 0xD9,
-0xAE, 0x6D, 0x82, 0x33, 0x66, 0x4B, 0x39, 0x9F, 0x28, 0xC3, 0x64, 0x31, 0x79, 0xAA, 0x26, 0x56, 0xE0, 0x95, 0x5E, 0xCD, 0x1A,
-0x33, 0xCE, 0x45, 0x04, 0xDD, 0x7C, 0xDD, 0xCC, 0xFD, 0x60, 0x98, 0xA1, 0xAF, 0x58, 0x63, 0xC6, 0x91, 0xB1, 0x66, 0x7E, 0xE5,
-0x83, 0x57, 0x57, 0x88, 0x2D, 0xB5, 0x82, 0xD9, 0xEB, 0x14, 0x6D, 0x9D, 0x53, 0x2A, 0x68, 0x78, 0x31, 0xA1, 0x92, 0x1F, 0x79,
-0x56, 0x4A, 0x1B, 0x85, 0xEC, 0x55, 0x88, 0x92, 0x5C, 0xEA, 0xA3, 0x5B, 0xDD, 0xA8, 0xF5, 0xB0, 0xC8, 0x1E, 0x4E, 0xA8, 0x6F,
-0x54, 0xAB, 0xCB, 0x5B, 0x1D, 0x0D, 0xCC, 0x0B, 0x71, 0xE4, 0x0A, 0x2F, 0xD3, 0x04, 0xB8, 0x77, 0x80, 0x52, 0x6C, 0x12, 0x1D,
-0xEB, 0xF6, 0xE5, 0xB2, 0x84, 0xC7, 0x76, 0x53, 0x96, 0x8A, 0xB1, 0x68, 0x95, 0xE5, 0x96, 0x64, 0x02, 0x1A, 0x6F, 0xA9, 0x5B,
-0x4C, 0xF2, 0x36, 0x07, 0xDA, 0x15, 0x54, 0x24, 0x5E, 0x9C, 0x6B, 0x53, 0x5A, 0x8B, 0x05, 0x22, 0xC4, 0x3A, 0x3B, 0x1A, 0x04,
-0x41, 0xA9, 0x88, 0x10, 0xD2, 0x75, 0xC3, 0xD1, 0x8B, 0xE1, 0x77, 0xEA, 0xC6, 0x2F, 0xCF, 0x2C, 0xC3, 0x85, 0xA9, 0x7D, 0x11,
-0xBD, 0x50, 0xCA, 0x22, 0x92, 0xCA, 0x15, 0xA6, 0x7E, 0xE3, 0x38, 0xB3, 0x2E, 0x92, 0x6D, 0xBE, 0x88, 0x79, 0xE7, 0x98, 0x61,
-0x6D, 0xD7, 0xB6, 0x3C, 0xF5, 0x92, 0xCC, 0x20, 0xDA, 0xCE, 0x53, 0x24, 0x84, 0xE3, 0xCE, 0x95, 0x4D, 0xD2, 0x70, 0x91, 0xD3,
-0xAD, 0xEC, 0x2E, 0xFB, 0xCD, 0x82, 0xE1, 0x0A, 0xE7, 0x9F, 0x89, 0x1F, 0xBB, 0x1F, 0x32, 0x1F, 0x33, 0x22, 0xA7, 0x6E, 0x1C,
-0xE4, 0xFD, 0x78, 0x31, 0xEF, 0x17, 0x7B, 0xC9, 0x3F, 0xB6, 0xDC, 0x4D, 0xF7, 0x36, 0x6C, 0x7F, 0x59, 0xDE, 0xFF, 0x90, 0x95,
-0xEF, 0xDD, 0xF1, 0x12, 0x8F, 0x71, 0x78, 0xF5, 0x06, 0xB5, 0x61, 0x97, 0x06, 0xC1, 0xEF, 0x10, 0xD5, 0xE6, 0x20, 0x64, 0xCE,
-0xBC, 0xCD, 0xDB, 0x37, 0x7A, 0x8F, 0x7F, 0x3C, 0x4B, 0x1E, 0x3D, 0x4E, 0xD2, 0xBD, 0xEF, 0xA3, 0xB3, 0xE3, 0x93, 0xD3, 0x3B,
-0x3F, 0x7C, 0x18, 0xDC, 0xF9, 0xE7, 0xE4, 0x97, 0x78, 0x33, 0x3E, 0xBE, 0x75, 0x12, 0xBE, 0xFC, 0x39, 0xFA, 0xFD, 0xD6, 0x2F,
-0xBF, 0x9C, 0xFC, 0x33, 0x7D, 0xFD, 0xF3, 0xE4, 0xBF, 0x7F, 0xEC, 0x3F, 0x98, 0xC7, 0x3F, 0x3F, 0x3C, 0x7D, 0xF6, 0xDD, 0xC3,
-0x8D, 0x6C, 0xF2, 0x5F, 0xE3, 0x27, 0x07, 0xA7, 0x4F, 0x40, 0x22, 0x48, 0x93, 0x2C, 0x4B, 0xD2, 0xF0, 0x30, 0x04, 0x91, 0xD6,
-0x8B, 0x93, 0xF8, 0x6C, 0x9E, 0x2C, 0x33, 0x94, 0xC3, 0x8A, 0x31, 0xC1, 0xFE, 0x0E, 0xD3, 0x42, 0x7F, 0xCC, 0x60, 0x7B, 0xDD,
-0xFD, 0xFF, 0x3F, 0x41, 0x6A, 0x44, 0x7B, 0x7A, 0x01, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x7D, 0xEB, 0x76, 0xDB, 0xB6, 0xD2, 0xE8, 0x7F, 0x3F, 0x05,
+0xC2, 0x66, 0x57, 0xD2, 0x8E, 0x44, 0x49, 0x76, 0x9C, 0x8B, 0x1D, 0x3B, 0x3B, 0x71, 0x92, 0xDD, 0xEC, 0x3A, 0x97, 0x2F, 0x76,
+0x9A, 0xAF, 0x4D, 0xFC, 0xED, 0x50, 0x22, 0x65, 0x31, 0xA6, 0x48, 0x95, 0xA4, 0x7C, 0xA9, 0xB7, 0xD7, 0x3A, 0xCF, 0x72, 0x1E,
+0xED, 0x3C, 0xC9, 0x99, 0x19, 0x5C, 0x08, 0x90, 0xA0, 0x2E, 0x76, 0x9A, 0xB6, 0x67, 0x9D, 0xB5, 0xDA, 0x58, 0x24, 0x07, 0x83,
+0xC1, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x83, 0x47, 0xB7, 0x9E, 0xBD, 0xD9, 0x3B, 0xFC, 0xF9, 0xED, 0x73, 0x36, 0xCE, 0x27, 0xD1,
+0xEE, 0xDA, 0x23, 0xFC, 0xC3, 0x22, 0x2F, 0x3E, 0xDE, 0x71, 0x82, 0xD8, 0xC1, 0x17, 0x81, 0xE7, 0xC3, 0x9F, 0x28, 0x8C, 0x4F,
+0xD8, 0x38, 0x0D, 0x46, 0x3B, 0xCE, 0x38, 0xCF, 0xA7, 0xD9, 0x56, 0xB7, 0x3B, 0xF4, 0x63, 0xF7, 0x4B, 0xE6, 0x07, 0x51, 0x78,
+0x9A, 0xBA, 0x71, 0x90, 0x77, 0xE3, 0xE9, 0xA4, 0x3B, 0x48, 0x92, 0x3C, 0xCB, 0x53, 0x6F, 0xFA, 0x8F, 0x4D, 0x77, 0xC3, 0x7D,
+0xD0, 0xF5, 0xC3, 0x2C, 0xEF, 0x0E, 0xB3, 0xAC, 0xF8, 0xE0, 0x4E, 0xC2, 0xD8, 0x85, 0x37, 0x0E, 0x4B, 0x83, 0x68, 0xC7, 0xC9,
+0xF2, 0x8B, 0x28, 0xC8, 0xC6, 0x41, 0x90, 0x3B, 0x2C, 0x8C, 0xF3, 0xE0, 0x38, 0x0D, 0xF3, 0x0B, 0x78, 0x3D, 0xF6, 0x36, 0x1E,
+0xDC, 0xED, 0x64, 0xEF, 0x5E, 0x46, 0x77, 0x4F, 0xCE, 0x5F, 0xEE, 0xBF, 0x38, 0xFD, 0xF9, 0xEE, 0xFD, 0x7F, 0xF5, 0xEF, 0x0D,
+0xD3, 0x87, 0xBF, 0x9C, 0x3D, 0xED, 0xDD, 0x3F, 0x7D, 0x7B, 0xF7, 0x5F, 0x0F, 0xEE, 0xEC, 0xFF, 0x70, 0xFF, 0xD7, 0x1F, 0xFF,
+0x2B, 0x9E, 0xFD, 0x7A, 0x32, 0x7B, 0xF9, 0xE4, 0xF4, 0xF5, 0x87, 0xFD, 0xDF, 0x82, 0xD7, 0x0F, 0xF2, 0xE7, 0x9B, 0x3F, 0x3F,
+0x9D, 0x7D, 0xF9, 0xE5, 0xD7, 0x7F, 0xED, 0x3F, 0x75, 0xD8, 0x30, 0x4D, 0xB2, 0x2C, 0x49, 0xC3, 0xE3, 0x30, 0xDE, 0x71, 0xBC,
+0x38, 0x89, 0x2F, 0x26, 0xC9, 0x2C, 0x73, 0x64, 0x93, 0x2A, 0x34, 0xAC, 0xD2, 0xC6, 0x4E, 0x38, 0x4C, 0xE2, 0xEC, 0x1F, 0x7D,
+0xB7, 0xDF, 0x77, 0x37, 0xBA, 0xA3, 0x24, 0xCE, 0xCB, 0xDF, 0x54, 0x63, 0xA1, 0xBE, 0x6C, 0x98, 0x86, 0xD3, 0x9C, 0x65, 0xE9,
+0xB0, 0xC0, 0xEF, 0x7D, 0xF1, 0xCE, 0xDD, 0xE3, 0x24, 0x39, 0x8E, 0x02, 0x6F, 0x1A, 0x66, 0xEE, 0x30, 0x99, 0xD0, 0xBB, 0x6E,
+0x14, 0x0E, 0xB2, 0xEE, 0x97, 0x5F, 0x67, 0x41, 0x7A, 0xD1, 0xDD, 0x70, 0xEF, 0xBB, 0x7D, 0xF1, 0x40, 0x08, 0xBF, 0x00, 0xBE,
+0x47, 0x5D, 0x8E, 0xAF, 0x06, 0x31, 0x10, 0xFE, 0x05, 0xD0, 0x45, 0xC9, 0xCC, 0x1F, 0x45, 0x5E, 0x1A, 0x94, 0x30, 0x17, 0x64,
+0x6E, 0x74, 0xF2, 0x8B, 0x69, 0xE0, 0x61, 0x37, 0x77, 0xEF, 0xBA, 0x3D, 0x77, 0xBD, 0xF8, 0xA6, 0x7D, 0xB2, 0x55, 0x3B, 0x09,
+0x72, 0x8F, 0x0D, 0xC7, 0x5E, 0x9A, 0x05, 0xF9, 0x8E, 0xF3, 0xFE, 0xF0, 0x45, 0xE7, 0x81, 0x23, 0x5F, 0xC7, 0xDE, 0x24, 0xD8,
+0x71, 0x4E, 0xC3, 0xE0, 0x6C, 0x9A, 0xA4, 0xC0, 0x55, 0xE0, 0x45, 0x1E, 0xC4, 0x00, 0x36, 0xCB, 0x82, 0xB4, 0x93, 0x0D, 0xBD,
+0xC8, 0x1B, 0x44, 0xC1, 0x4E, 0x9C, 0xB4, 0xA1, 0xD3, 0xC3, 0x3C, 0xF4, 0x22, 0x7A, 0x19, 0xEC, 0xF4, 0xDB, 0x6C, 0xE2, 0x9D,
+0x87, 0x93, 0xD9, 0x44, 0x7B, 0x01, 0x20, 0xC6, 0x8B, 0xB3, 0xD0, 0xCF, 0xC7, 0x3B, 0x7E, 0x70, 0x1A, 0x0E, 0x83, 0x0E, 0x3D,
+0x94, 0x2A, 0xF6, 0xA6, 0xD3, 0x28, 0xE8, 0x4C, 0x92, 0x41, 0x08, 0x7F, 0xCE, 0x82, 0x41, 0x07, 0x5E, 0x74, 0x86, 0xDE, 0x14,
+0x2B, 0xD5, 0x88, 0xB9, 0x08, 0xB2, 0x65, 0x0A, 0x66, 0xB9, 0x97, 0xCF, 0xB2, 0xCE, 0xC0, 0x03, 0xCA, 0x51, 0x52, 0x34, 0x0C,
+0x7E, 0x30, 0xF2, 0x66, 0x51, 0x6E, 0x8A, 0x13, 0x47, 0x92, 0x27, 0xB3, 0xE1, 0x98, 0xA4, 0x40, 0x0A, 0xD5, 0xC8, 0x3B, 0xC5,
+0x47, 0x77, 0x1A, 0x1F, 0x9B, 0x05, 0xEA, 0x80, 0x18, 0xF2, 0x1F, 0x3E, 0x4F, 0xBC, 0xE3, 0xA0, 0x2B, 0x4A, 0xE5, 0x61, 0x1E,
+0x05, 0xBB, 0xCF, 0x82, 0xA9, 0x97, 0xE6, 0xB3, 0x34, 0xC8, 0xD8, 0xD3, 0xC4, 0x4B, 0xFD, 0x47, 0x5D, 0xFE, 0x5E, 0x0A, 0xC3,
+0xEE, 0x5A, 0xB3, 0xD9, 0x62, 0x3B, 0xBB, 0xEC, 0x72, 0x0D, 0xC5, 0x30, 0x67, 0xF9, 0x38, 0x98, 0x04, 0xAF, 0xBC, 0x7C, 0x38,
+0x0E, 0x52, 0xB6, 0x03, 0x1C, 0x8C, 0xFD, 0xE4, 0xCC, 0x9D, 0xE0, 0x8B, 0x57, 0x81, 0x1F, 0x7A, 0xCD, 0x46, 0x73, 0x0A, 0xF5,
+0x07, 0x69, 0xD6, 0x19, 0x26, 0x51, 0x82, 0x7D, 0x84, 0x25, 0xB6, 0x98, 0xEF, 0xA5, 0x27, 0xAD, 0x46, 0x6B, 0x5B, 0xE0, 0xC1,
+0xB6, 0x5D, 0x1C, 0xE2, 0x27, 0xC0, 0x22, 0xAA, 0x60, 0x7E, 0x32, 0x9C, 0x4D, 0x80, 0x1F, 0xAE, 0xFC, 0xF1, 0x3C, 0x0A, 0xE8,
+0x19, 0x24, 0xE3, 0x49, 0x9E, 0xA7, 0xE1, 0x60, 0x96, 0x07, 0xCD, 0x86, 0xEF, 0xE5, 0x5E, 0x67, 0x90, 0x75, 0x88, 0x96, 0x46,
+0xDB, 0xA0, 0x89, 0x93, 0x02, 0xCD, 0x79, 0xCC, 0x1A, 0x58, 0x65, 0x83, 0x6D, 0xB1, 0x46, 0x14, 0x1E, 0x8F, 0x73, 0xA8, 0x9B,
+0x5D, 0x6D, 0xAF, 0x15, 0x15, 0x37, 0x81, 0x18, 0xA3, 0xA8, 0xE7, 0xFB, 0xCF, 0x4F, 0xA1, 0xBA, 0x7D, 0xD0, 0x35, 0x41, 0x1C,
+0xA4, 0xCD, 0x06, 0x48, 0x65, 0x7C, 0x8C, 0x55, 0x14, 0xA5, 0xA0, 0xD0, 0x55, 0x0B, 0x8B, 0x6A, 0x12, 0xDC, 0x15, 0xCA, 0x8D,
+0x7A, 0x75, 0x77, 0x6D, 0x2B, 0x05, 0xC9, 0x67, 0x97, 0x1D, 0xA4, 0x71, 0x90, 0xF8, 0x17, 0x1D, 0x1C, 0xD1, 0x9D, 0x2C, 0xFC,
+0x0D, 0xD8, 0xD0, 0x73, 0x1F, 0xDC, 0xDF, 0x4C, 0x83, 0xC9, 0xF6, 0xD5, 0x9A, 0x3B, 0xC8, 0x63, 0x09, 0x95, 0xC7, 0x73, 0x80,
+0x3A, 0xC9, 0x2C, 0x87, 0x4E, 0x0E, 0x3A, 0x59, 0x00, 0xCC, 0x83, 0x56, 0x5D, 0xB0, 0x4B, 0x0D, 0xBA, 0x2F, 0x20, 0x47, 0x49,
+0x3A, 0xE9, 0xA0, 0x44, 0xA5, 0x49, 0xD4, 0x66, 0xFC, 0x31, 0x0B, 0xA2, 0x60, 0x98, 0x1B, 0xE0, 0xA7, 0x5E, 0xDA, 0xB4, 0x90,
+0xD6, 0x22, 0x14, 0x51, 0xE2, 0xE5, 0x61, 0x7C, 0x0C, 0xAF, 0x93, 0x1C, 0x3A, 0xF8, 0x72, 0x9A, 0x64, 0x30, 0xAA, 0x92, 0x78,
+0x6B, 0x14, 0x9E, 0x07, 0xFE, 0xF6, 0x20, 0xC9, 0xF3, 0x64, 0xB2, 0xD5, 0xDB, 0x8E, 0x82, 0x51, 0x0E, 0x7F, 0x68, 0xCC, 0x6C,
+0xF5, 0x7B, 0xBD, 0xBF, 0x6D, 0x0F, 0xBC, 0xE1, 0xC9, 0x71, 0x9A, 0xCC, 0x62, 0x9F, 0x77, 0xFC, 0x96, 0x59, 0xCF, 0xE0, 0xB8,
+0xB5, 0xFD, 0x5B, 0x07, 0xA4, 0x25, 0x38, 0x07, 0xF8, 0x8D, 0x9E, 0xAD, 0x36, 0x97, 0xFF, 0x05, 0xA8, 0x18, 0xEB, 0xE6, 0xC8,
+0x61, 0xD0, 0x36, 0x1F, 0xF6, 0xFE, 0xD6, 0x66, 0x9B, 0xBD, 0xDE, 0xF4, 0xBC, 0xB5, 0x3D, 0xF1, 0x52, 0x50, 0xC1, 0x5B, 0x3D,
+0xE6, 0xCD, 0xF2, 0x64, 0x7B, 0x0A, 0x7D, 0x06, 0x18, 0x00, 0xE5, 0xF4, 0x1C, 0xA8, 0x4B, 0x7D, 0x28, 0x9E, 0x27, 0xD3, 0xAD,
+0xFE, 0xF4, 0x9C, 0x65, 0x49, 0x14, 0xFA, 0x7A, 0x73, 0xE9, 0x2B, 0x11, 0xD7, 0xDA, 0xCE, 0x83, 0xF3, 0xBC, 0xE3, 0x81, 0x60,
+0xC4, 0x5B, 0x43, 0xE8, 0xF2, 0x20, 0x45, 0x82, 0xC2, 0x98, 0xD8, 0x9C, 0x26, 0x67, 0x50, 0xFB, 0x38, 0xCC, 0x81, 0xE3, 0x53,
+0x6F, 0x18, 0x6C, 0xC5, 0xC9, 0x19, 0xA8, 0x31, 0x51, 0x35, 0xE1, 0xEF, 0x6C, 0x42, 0x7D, 0x66, 0x09, 0xD0, 0x44, 0x41, 0xC4,
+0x2E, 0x61, 0xA2, 0x9A, 0x46, 0xDE, 0xC5, 0x96, 0xF8, 0x32, 0x88, 0x92, 0xE1, 0x89, 0x2C, 0x99, 0xA2, 0x1C, 0x6E, 0x3D, 0x80,
+0xA2, 0xC4, 0xF6, 0xB3, 0x80, 0x9E, 0x63, 0xE8, 0x28, 0x2F, 0x2A, 0x61, 0x2B, 0xF7, 0x66, 0xE5, 0x93, 0xEC, 0x59, 0x6B, 0x7D,
+0x9C, 0x75, 0xC4, 0x21, 0x29, 0x18, 0x44, 0x9E, 0x14, 0x0B, 0x10, 0xF7, 0xE1, 0x49, 0x47, 0x50, 0xAC, 0xD3, 0x02, 0x4C, 0xC6,
+0x12, 0xC3, 0x59, 0x06, 0xFD, 0xDC, 0xC9, 0xBD, 0x41, 0xC6, 0x2E, 0x93, 0xD3, 0x20, 0x85, 0xAE, 0x3A, 0xDB, 0x1A, 0x87, 0xBE,
+0x1F, 0xC4, 0xE5, 0xEF, 0x6E, 0xEC, 0x9D, 0x0A, 0x48, 0xC1, 0x62, 0x2E, 0x25, 0x5C, 0xC7, 0x41, 0xEB, 0xE2, 0xC0, 0x5A, 0x84,
+0xD4, 0xD6, 0x65, 0x49, 0x56, 0x8E, 0x53, 0xEF, 0xA2, 0x03, 0x44, 0xB4, 0x44, 0x67, 0xF2, 0xE2, 0x15, 0xD9, 0xFA, 0xAE, 0xB7,
+0x79, 0xFF, 0xA1, 0x7F, 0x57, 0x75, 0x3F, 0xB0, 0x94, 0xF5, 0x1F, 0xF0, 0x2E, 0xB1, 0x56, 0xE4, 0x7A, 0xC3, 0x3C, 0x3C, 0x0D,
+0x80, 0xC4, 0x5A, 0x31, 0x55, 0x83, 0x8B, 0x64, 0xB5, 0x8C, 0x08, 0xFE, 0xED, 0x08, 0x6D, 0x0D, 0xA3, 0xA2, 0xA8, 0x76, 0x7B,
+0x59, 0x84, 0x82, 0x37, 0xA9, 0xE7, 0x87, 0xB3, 0x0C, 0xC4, 0xB7, 0xBF, 0x89, 0x34, 0x6F, 0x5A, 0x68, 0xA6, 0x1E, 0x4A, 0x51,
+0xF1, 0x6C, 0x6D, 0xE1, 0xDC, 0x71, 0x12, 0xC2, 0x08, 0x05, 0x51, 0xC6, 0xD2, 0xB3, 0x38, 0xC6, 0xB9, 0xA7, 0x03, 0xD3, 0xEA,
+0xF0, 0x64, 0x5E, 0x6B, 0x0A, 0x46, 0xCE, 0x45, 0x3F, 0x49, 0x7E, 0xE3, 0xBF, 0x57, 0xC3, 0xF8, 0x8F, 0x09, 0xEA, 0x7A, 0xD6,
+0x1C, 0xA3, 0x6C, 0x6C, 0x31, 0xEC, 0xA4, 0x16, 0x4C, 0x11, 0xDF, 0xA1, 0xB2, 0xF7, 0x67, 0x51, 0x70, 0xE8, 0x0D, 0x98, 0x5D,
+0x73, 0x6D, 0x51, 0x11, 0x4B, 0x3D, 0x50, 0x7F, 0x0C, 0xA3, 0x2D, 0x05, 0x06, 0xDF, 0x0A, 0x27, 0x38, 0xDB, 0x7B, 0x71, 0xBE,
+0x5D, 0x56, 0x25, 0x80, 0x92, 0x0F, 0x60, 0x0D, 0x46, 0x1F, 0xD8, 0x26, 0xA8, 0x31, 0xE4, 0xB5, 0x12, 0x57, 0x16, 0x4A, 0x7D,
+0xE4, 0x42, 0x5A, 0x4B, 0x9E, 0x89, 0xF7, 0xF8, 0xA6, 0xF5, 0x5F, 0xE1, 0xF4, 0xC1, 0x67, 0x8B, 0x47, 0xA8, 0x1F, 0x19, 0x3D,
+0xEC, 0x38, 0x42, 0xB2, 0xC4, 0x10, 0xDA, 0xBA, 0x87, 0x6A, 0x0D, 0x67, 0x6B, 0x3F, 0x3C, 0x95, 0x20, 0xA6, 0x5A, 0x9C, 0xAB,
+0x15, 0x7B, 0x6C, 0x53, 0x94, 0xC7, 0x4E, 0x67, 0xA1, 0x0F, 0x66, 0x01, 0xFC, 0x80, 0xD9, 0x14, 0xD5, 0x2E, 0xD9, 0x2C, 0xA3,
+0x30, 0x88, 0x7C, 0x78, 0x81, 0x76, 0x44, 0x70, 0x1C, 0xC4, 0xBE, 0xA2, 0x44, 0x6A, 0x7E, 0xB0, 0x2C, 0x3C, 0x1C, 0x3B, 0x16,
+0x95, 0x09, 0x44, 0x74, 0xC6, 0x5C, 0x71, 0xDC, 0xC5, 0x9A, 0x24, 0xF5, 0xA8, 0x21, 0x1F, 0x68, 0x94, 0x63, 0xC5, 0x71, 0x7A,
+0xE8, 0x48, 0xDC, 0x52, 0x67, 0xA1, 0xDC, 0x38, 0xBB, 0xEF, 0xBC, 0x30, 0x62, 0x55, 0x43, 0x04, 0x0A, 0x6A, 0xC5, 0xF3, 0x51,
+0x54, 0x57, 0xFE, 0x70, 0x36, 0x08, 0xD8, 0x93, 0x34, 0x0D, 0x4F, 0xBD, 0xA8, 0xA6, 0xF4, 0x60, 0x96, 0xD5, 0x95, 0x7E, 0x3A,
+0xCB, 0xE6, 0x56, 0x3E, 0x8C, 0xBC, 0x2C, 0x83, 0x42, 0x69, 0x32, 0x05, 0x4B, 0x27, 0x76, 0x2A, 0xFC, 0x81, 0x41, 0x95, 0x44,
+0x60, 0x97, 0x6C, 0x63, 0xAB, 0x91, 0x0B, 0x5C, 0xCB, 0xF7, 0xA8, 0xF5, 0x60, 0xB0, 0xE4, 0x49, 0x2C, 0x91, 0xE0, 0x84, 0x2F,
+0x11, 0x01, 0x93, 0x8E, 0x8F, 0xD1, 0x06, 0xE4, 0xB6, 0x19, 0x07, 0x74, 0x88, 0x5A, 0x30, 0x79, 0x66, 0x4F, 0xC5, 0xB3, 0xB2,
+0x75, 0x08, 0x5A, 0xA7, 0xC3, 0x4B, 0x43, 0xAF, 0x13, 0x9C, 0x4F, 0x3D, 0x98, 0x53, 0xB1, 0x63, 0xA1, 0xF1, 0xD0, 0x9C, 0xEF,
+0xBF, 0x7B, 0x78, 0xFF, 0xFE, 0xBD, 0xED, 0x47, 0x5D, 0x8E, 0x10, 0x48, 0x98, 0x45, 0xE5, 0x36, 0x74, 0xB0, 0x02, 0x66, 0x3C,
+0x75, 0xA0, 0xE7, 0x05, 0x4A, 0x9A, 0x15, 0xA2, 0xC0, 0x1F, 0x5C, 0x18, 0x94, 0x90, 0xA1, 0xB9, 0xFB, 0xC8, 0xAB, 0x20, 0x83,
+0x69, 0x72, 0x22, 0x8D, 0xCE, 0xEF, 0x1C, 0x96, 0xC4, 0xC3, 0x28, 0x1C, 0x9E, 0xC0, 0x0A, 0x02, 0x08, 0x8B, 0x82, 0x3D, 0x9C,
+0x69, 0xDE, 0x4F, 0xA1, 0x19, 0x41, 0xD6, 0x6C, 0x39, 0xBB, 0xF4, 0xCC, 0x40, 0x0A, 0x99, 0x78, 0xF9, 0xA8, 0xEB, 0xC1, 0x62,
+0x00, 0x50, 0x2F, 0x83, 0xBF, 0x7B, 0x12, 0x5C, 0x64, 0x2E, 0xAC, 0x2D, 0x9D, 0xDD, 0xE7, 0x7E, 0x98, 0xB3, 0x27, 0x6F, 0x5F,
+0xB2, 0x1F, 0xE1, 0xD5, 0x6A, 0x48, 0x40, 0x77, 0xE5, 0x69, 0xA6, 0xE3, 0x79, 0x77, 0x70, 0xC0, 0x5E, 0x04, 0x81, 0xBF, 0x1A,
+0x22, 0x4B, 0x6B, 0x61, 0xF9, 0x95, 0x7E, 0x08, 0x47, 0x21, 0x35, 0x15, 0x1F, 0xD8, 0x87, 0xF0, 0x45, 0xC8, 0x0E, 0xC4, 0x88,
+0xBB, 0x21, 0xFA, 0x77, 0x01, 0x2C, 0x21, 0xD2, 0xFC, 0xE0, 0x02, 0xEC, 0xD3, 0x09, 0x56, 0x21, 0x5E, 0x30, 0xFE, 0x46, 0xC3,
+0xDE, 0x9D, 0xE1, 0x22, 0x5C, 0x88, 0x71, 0x97, 0x8F, 0x6C, 0x53, 0xA0, 0x27, 0x83, 0xCE, 0x86, 0x10, 0xB7, 0xC4, 0x0F, 0x0E,
+0xC8, 0x9A, 0x48, 0x52, 0xEA, 0x66, 0x32, 0x0B, 0x04, 0x58, 0x61, 0x3B, 0xC0, 0x50, 0xC1, 0xB1, 0xC1, 0x5E, 0x01, 0x38, 0xA0,
+0xC4, 0x57, 0x26, 0x46, 0xD4, 0x78, 0xA8, 0x33, 0xA7, 0xEC, 0xAC, 0x03, 0x26, 0x21, 0xAC, 0xCB, 0x13, 0x94, 0x58, 0x7A, 0x85,
+0x78, 0xC3, 0x78, 0x3A, 0xCB, 0x85, 0xB8, 0xE3, 0x34, 0x98, 0x38, 0x7A, 0x49, 0x32, 0x49, 0x1C, 0xB1, 0x7C, 0x1A, 0x60, 0x4D,
+0x48, 0x57, 0x41, 0x21, 0x6A, 0x09, 0x07, 0xAC, 0xB9, 0x68, 0x06, 0xDF, 0x01, 0x39, 0x2A, 0x3A, 0x58, 0x8B, 0xC2, 0x0A, 0x29,
+0x87, 0x17, 0xC9, 0x68, 0x54, 0x21, 0x1D, 0x47, 0x9B, 0xDD, 0x7A, 0xF6, 0x3B, 0xA3, 0x28, 0x38, 0x67, 0xA4, 0xCB, 0x88, 0xE5,
+0xB0, 0x58, 0x21, 0x8D, 0xC6, 0xBE, 0xC0, 0x4C, 0x19, 0x8E, 0x2E, 0xE4, 0x54, 0x2F, 0x5E, 0x3B, 0x28, 0xB0, 0x1A, 0x19, 0xBB,
+0x8F, 0xC2, 0xC9, 0x31, 0x5F, 0x27, 0x77, 0xC3, 0x14, 0xDE, 0xB8, 0x30, 0x4D, 0x4F, 0x55, 0x73, 0x26, 0x41, 0x67, 0x1D, 0x08,
+0x8C, 0x60, 0x5D, 0xE7, 0xEC, 0x32, 0x2C, 0x51, 0xF0, 0xEB, 0x66, 0x4C, 0x40, 0x55, 0xA7, 0x98, 0xD0, 0xFF, 0xC3, 0x98, 0x40,
+0x64, 0x18, 0x4C, 0xC8, 0xE1, 0xCD, 0x3C, 0x26, 0x60, 0x89, 0xAF, 0xC5, 0x04, 0xD0, 0xD8, 0x8A, 0x07, 0xEB, 0x7F, 0x18, 0x0F,
+0x90, 0x0A, 0x83, 0x05, 0x30, 0xC7, 0xCC, 0xE3, 0x00, 0xC0, 0x17, 0x0C, 0x90, 0x03, 0xB3, 0x32, 0xCD, 0x14, 0xA3, 0x32, 0x4E,
+0x0F, 0x40, 0x7D, 0x0C, 0xC7, 0x4F, 0x93, 0xF3, 0x9A, 0x99, 0xAB, 0x7E, 0xA4, 0x72, 0x2A, 0x33, 0x2A, 0xFF, 0x1A, 0xD8, 0xE8,
+0xEC, 0x1E, 0xE4, 0x1E, 0x4E, 0x56, 0xE5, 0x2E, 0xC0, 0x8A, 0x34, 0x30, 0xD1, 0x25, 0x38, 0xD1, 0x3B, 0x0C, 0x6A, 0x1A, 0x06,
+0xE3, 0x24, 0x02, 0x0B, 0x66, 0xC7, 0x39, 0x84, 0x0F, 0xB8, 0xCE, 0x66, 0x19, 0x47, 0x44, 0xBD, 0xE3, 0x18, 0x55, 0x8B, 0xB5,
+0x0A, 0x53, 0xBE, 0x1E, 0x67, 0x61, 0x0B, 0xF7, 0xBC, 0x08, 0x3A, 0xE4, 0xF8, 0xFA, 0x4D, 0x1C, 0x72, 0x04, 0xA2, 0x75, 0xCE,
+0xEE, 0x9B, 0x38, 0x02, 0x53, 0x6A, 0x0C, 0x8B, 0xA4, 0x2C, 0x48, 0xD1, 0xAB, 0x93, 0x31, 0x01, 0xC2, 0xBC, 0xDC, 0x54, 0x5A,
+0xA5, 0xFA, 0x50, 0x0E, 0xB6, 0x8F, 0xBD, 0x29, 0x5F, 0x49, 0x96, 0x4C, 0x2E, 0xFC, 0xB8, 0xD5, 0xDF, 0x76, 0x0C, 0xBE, 0x95,
+0xEA, 0xAE, 0xE7, 0xDD, 0x81, 0xC6, 0x32, 0x06, 0x13, 0x1F, 0x4C, 0x0B, 0xB0, 0x12, 0x19, 0x44, 0x5E, 0xCC, 0x27, 0x42, 0xC0,
+0xA3, 0xC8, 0x75, 0xD6, 0xE6, 0xB3, 0xD4, 0x34, 0x02, 0x69, 0xE1, 0x5D, 0x62, 0xB3, 0x46, 0x72, 0x27, 0x1B, 0xA7, 0xB0, 0xF6,
+0x31, 0x4D, 0x11, 0x22, 0x1D, 0x67, 0xA6, 0x17, 0x61, 0x44, 0x12, 0xCD, 0xC7, 0x99, 0xF1, 0xAA, 0x34, 0x6E, 0xD4, 0x78, 0x29,
+0x19, 0x2B, 0x7C, 0x86, 0xD3, 0x4C, 0x8D, 0xAA, 0x58, 0x63, 0x6D, 0xC0, 0x8C, 0x1C, 0x9B, 0xC3, 0xB1, 0xEB, 0x9D, 0xAD, 0x2D,
+0xA8, 0x15, 0xDB, 0xE7, 0x77, 0xB8, 0x89, 0x4B, 0xEF, 0x70, 0x10, 0xCE, 0x2C, 0x60, 0xF2, 0x7B, 0x66, 0x93, 0xF4, 0x52, 0x61,
+0xA3, 0xC7, 0x26, 0xDE, 0x79, 0x14, 0xC4, 0xC7, 0xF9, 0x18, 0x74, 0xCA, 0x5D, 0x67, 0xCD, 0xE8, 0xC0, 0xE7, 0xA4, 0x11, 0x40,
+0xC7, 0x4C, 0x3C, 0xE8, 0x28, 0x30, 0x15, 0xC1, 0x6E, 0xF1, 0x55, 0x55, 0x2C, 0x9E, 0x4D, 0x06, 0x41, 0x9A, 0x61, 0xD7, 0x1A,
+0x9D, 0x6A, 0x1D, 0x1E, 0x4E, 0x2D, 0x9B, 0xE2, 0xF4, 0x65, 0x0C, 0x5A, 0x2D, 0xF4, 0x0F, 0x93, 0x93, 0x20, 0xB6, 0x0E, 0x08,
+0x25, 0x97, 0x02, 0xB1, 0x17, 0x05, 0x30, 0xF9, 0xD3, 0xBF, 0x62, 0xFD, 0x32, 0x47, 0xA3, 0xF1, 0x81, 0xC7, 0xE7, 0x64, 0x2A,
+0x42, 0xBE, 0xE4, 0xD3, 0x63, 0x76, 0x3E, 0x89, 0xE2, 0x8C, 0x7B, 0x7C, 0xB7, 0xBA, 0xDD, 0xB3, 0xB3, 0x33, 0xF7, 0x6C, 0xC3,
+0x4D, 0xD2, 0xE3, 0xEE, 0x7A, 0xAF, 0xD7, 0xEB, 0x02, 0x84, 0x23, 0x1C, 0xA5, 0xC8, 0x19, 0xC6, 0xED, 0x7D, 0xFE, 0x7B, 0x14,
+0x46, 0x11, 0x88, 0xCE, 0x2C, 0xC5, 0x55, 0xDB, 0x1E, 0xAE, 0x72, 0x0A, 0xD9, 0x09, 0xD9, 0x20, 0x04, 0xF3, 0x14, 0x1E, 0x27,
+0x24, 0xFE, 0xB0, 0xC0, 0x0C, 0x81, 0x44, 0x58, 0xBB, 0x62, 0x29, 0xA6, 0xC9, 0x67, 0xA7, 0xC7, 0xB8, 0xAA, 0x44, 0x37, 0x2F,
+0x88, 0x07, 0x4C, 0xEF, 0x0C, 0xD6, 0xC7, 0xF7, 0xE0, 0x3F, 0x49, 0x2F, 0xA8, 0x59, 0xDD, 0x3A, 0xDD, 0x71, 0x3E, 0x78, 0x69,
+0x8C, 0x2B, 0x1C, 0x6C, 0xC3, 0xD4, 0xCB, 0xC7, 0x0C, 0x18, 0xF8, 0xEA, 0x81, 0xFB, 0xF0, 0xC1, 0x3A, 0xEB, 0xBB, 0x9B, 0xF7,
+0xEE, 0x79, 0x7D, 0xB7, 0xBF, 0xC1, 0xE8, 0x1F, 0x44, 0xD6, 0xEB, 0xF4, 0xDD, 0x87, 0xF7, 0x58, 0x6F, 0xDF, 0xED, 0xDF, 0xDB,
+0x64, 0xFD, 0x0D, 0x77, 0x7D, 0x63, 0x63, 0xD8, 0x71, 0xEF, 0x6E, 0xDE, 0x77, 0xEF, 0xDF, 0x7F, 0xE0, 0xF6, 0x1E, 0xF6, 0x01,
+0xF6, 0xFE, 0xBD, 0xFB, 0x80, 0x80, 0xFF, 0x18, 0x03, 0xCC, 0xFD, 0xFE, 0xC6, 0xD0, 0x7D, 0xF0, 0xE0, 0x21, 0x12, 0xE3, 0xDE,
+0xDD, 0x78, 0xD0, 0x71, 0x1F, 0x3E, 0x04, 0x80, 0x0E, 0x01, 0xEC, 0x6B, 0x95, 0xFD, 0xF6, 0xEA, 0x01, 0xDB, 0x1C, 0xBA, 0x9B,
+0x1B, 0x9B, 0x00, 0xEA, 0x3E, 0xDC, 0xBC, 0xEB, 0xDE, 0xBD, 0xB7, 0xEE, 0x02, 0xEC, 0xC3, 0xCD, 0xA8, 0xE3, 0xC2, 0xDB, 0x0D,
+0x77, 0xB3, 0x77, 0xDF, 0x73, 0x37, 0x37, 0xD7, 0xF1, 0x7F, 0xA2, 0xA8, 0x0F, 0x68, 0xFA, 0x40, 0xD0, 0x7D, 0xF8, 0x77, 0x13,
+0x21, 0x9F, 0xB8, 0x0F, 0x7B, 0x9B, 0xF8, 0x3F, 0xFF, 0xCC, 0x00, 0xE5, 0x6F, 0x13, 0xB7, 0xD7, 0x5B, 0x67, 0xD0, 0x18, 0x78,
+0xC6, 0x77, 0xF8, 0xEF, 0xBA, 0xF8, 0x8B, 0xCF, 0xBD, 0xCE, 0xFA, 0x6F, 0x4E, 0x17, 0x45, 0x09, 0x7A, 0x89, 0x8B, 0xC6, 0xEE,
+0xDA, 0xCF, 0xC9, 0x8C, 0x4D, 0x60, 0xF6, 0x62, 0xBC, 0xDB, 0x3D, 0x46, 0x42, 0xC5, 0x5E, 0x53, 0x2F, 0x78, 0x11, 0xD9, 0x23,
+0x28, 0xAB, 0x7C, 0xD9, 0x05, 0xCB, 0x0B, 0xB2, 0xA2, 0x73, 0x14, 0x3A, 0xF8, 0x97, 0xCD, 0x60, 0x14, 0x95, 0x57, 0x64, 0x38,
+0xDF, 0xB9, 0xEC, 0x95, 0x17, 0x7B, 0xC7, 0x01, 0xBB, 0x48, 0x66, 0x29, 0x15, 0x41, 0x5B, 0x9C, 0x81, 0x0D, 0x5B, 0x36, 0xCD,
+0x0D, 0xE9, 0x24, 0xEF, 0x8B, 0xB3, 0x3B, 0x0E, 0xD2, 0x00, 0xCD, 0x53, 0xB7, 0x2C, 0xFD, 0xF3, 0x26, 0x08, 0x58, 0xF3, 0x7D,
+0xBD, 0x39, 0xF0, 0x70, 0xB4, 0xEF, 0xEC, 0xBE, 0x87, 0xB5, 0x52, 0xCA, 0xD7, 0xF5, 0x6C, 0xA9, 0x29, 0x11, 0x4B, 0x2D, 0x31,
+0x2B, 0xCE, 0x34, 0xBC, 0xC6, 0x0C, 0xB9, 0xB6, 0x70, 0x86, 0xD4, 0x16, 0xB8, 0xFB, 0x60, 0x9C, 0x68, 0x4A, 0x52, 0xF2, 0x23,
+0xC7, 0xB1, 0x71, 0xAD, 0xD6, 0xA3, 0x55, 0x56, 0x20, 0x75, 0x76, 0xF9, 0x5F, 0x36, 0xB8, 0x60, 0xF8, 0xB6, 0x68, 0xB9, 0xF0,
+0x25, 0x12, 0x19, 0x66, 0x11, 0x03, 0x35, 0x07, 0xA3, 0xBD, 0x1B, 0xFA, 0x55, 0xD5, 0x61, 0xD0, 0x88, 0x67, 0x61, 0x0A, 0x9F,
+0x80, 0x01, 0x5F, 0xBD, 0x25, 0x25, 0xCC, 0x7A, 0x73, 0xD4, 0xA7, 0xDA, 0x36, 0x95, 0x0B, 0x5B, 0x1B, 0xB6, 0xF6, 0x28, 0x99,
+0x52, 0xDF, 0x09, 0xEB, 0xD2, 0xD9, 0x7D, 0x12, 0x83, 0x91, 0x58, 0x20, 0xE7, 0x9F, 0x2B, 0x70, 0x61, 0x3C, 0xC0, 0xAE, 0x77,
+0x76, 0x5F, 0xF2, 0x1F, 0xB5, 0x80, 0x60, 0x81, 0x0A, 0xC8, 0x37, 0xE2, 0x97, 0x06, 0x5A, 0xE1, 0xEA, 0xBC, 0xB1, 0x01, 0xD6,
+0xE6, 0x93, 0x7C, 0x98, 0x5C, 0x7F, 0x64, 0x08, 0x04, 0xDC, 0x01, 0x72, 0x00, 0x53, 0x30, 0x7B, 0x72, 0xB8, 0xF7, 0x06, 0x66,
+0xB9, 0xF2, 0xEA, 0xEE, 0xC6, 0x86, 0x92, 0xAC, 0xA9, 0x7E, 0x1C, 0xF1, 0x09, 0x16, 0x07, 0x92, 0xA2, 0x81, 0xC1, 0x82, 0x97,
+0x4D, 0x41, 0xF9, 0x64, 0xEC, 0x34, 0x48, 0xC1, 0x12, 0xB7, 0xCF, 0xA6, 0x6B, 0x5F, 0xC5, 0x1E, 0xE2, 0x35, 0x70, 0x22, 0xC5,
+0x8E, 0xA3, 0xF6, 0x66, 0x49, 0x6B, 0x08, 0xE4, 0x24, 0x43, 0xDF, 0xAC, 0xBF, 0xFB, 0x13, 0x15, 0x9E, 0x6B, 0x17, 0xE9, 0x6D,
+0xE1, 0x0C, 0xD1, 0x38, 0xB5, 0x9F, 0xC4, 0xC7, 0xDC, 0x6C, 0xB7, 0xF8, 0xB1, 0x2C, 0xC3, 0x0A, 0x84, 0x82, 0xDD, 0x60, 0x6C,
+0x29, 0xA4, 0x55, 0x73, 0x0A, 0x65, 0x43, 0x9A, 0xA6, 0x36, 0x45, 0x59, 0x14, 0xBD, 0xA1, 0x31, 0x25, 0x2A, 0xB9, 0xB6, 0x2D,
+0xA5, 0x31, 0x08, 0x39, 0xF8, 0x43, 0x98, 0xE5, 0x49, 0x7A, 0xF1, 0x35, 0x59, 0xA4, 0xA1, 0xC5, 0xFD, 0x41, 0xF4, 0xBD, 0xA0,
+0x61, 0x05, 0xFC, 0x22, 0x59, 0x09, 0xA1, 0x11, 0x4A, 0x78, 0xB3, 0xAF, 0x32, 0x82, 0x34, 0x0D, 0x66, 0xA9, 0xBF, 0x46, 0x81,
+0x59, 0x55, 0xF3, 0xD2, 0x6B, 0x02, 0xC5, 0x37, 0x6D, 0x51, 0x50, 0xE6, 0xE5, 0x72, 0xAB, 0x82, 0x35, 0x51, 0xAC, 0x76, 0x14,
+0x54, 0x07, 0x03, 0xF6, 0xAA, 0x17, 0xE2, 0xD6, 0x1F, 0xF4, 0xD4, 0x5D, 0x36, 0x3D, 0xEF, 0xF4, 0x4A, 0xF6, 0x6E, 0x8A, 0x33,
+0x2B, 0xA3, 0x7F, 0x3B, 0xFD, 0xF3, 0x3E, 0xA9, 0x99, 0x51, 0x8A, 0xCB, 0x2A, 0xC1, 0xA4, 0x3C, 0x9C, 0x04, 0xD9, 0x2B, 0x0F,
+0xD6, 0xE0, 0x46, 0x10, 0x83, 0xFC, 0x42, 0x56, 0xED, 0x04, 0x3F, 0xD3, 0x2E, 0xF7, 0x8E, 0x83, 0xF2, 0x7D, 0x88, 0x5F, 0x18,
+0x16, 0x5A, 0x03, 0x41, 0x4B, 0xCE, 0x76, 0x9C, 0xE3, 0x00, 0x4C, 0xD9, 0xA1, 0x58, 0x52, 0x3E, 0xEA, 0xF2, 0x2A, 0x6C, 0x94,
+0xD7, 0x0D, 0x66, 0x98, 0x99, 0x40, 0x7B, 0x0D, 0x70, 0xF0, 0x18, 0x8A, 0x35, 0x83, 0x55, 0x68, 0x61, 0x31, 0x59, 0xA9, 0xE3,
+0xA6, 0x87, 0xB3, 0x96, 0xC3, 0xD2, 0x08, 0xC3, 0x21, 0xFE, 0x4D, 0xC3, 0xC0, 0xD9, 0xD5, 0x81, 0xC8, 0x90, 0x62, 0x87, 0xDE,
+0x14, 0x70, 0xAD, 0x99, 0xB8, 0x8E, 0xC3, 0x7C, 0x3C, 0x1B, 0x50, 0x90, 0xC6, 0xB1, 0xE7, 0x07, 0xC3, 0xCE, 0xEC, 0xA4, 0xEB,
+0x2B, 0x43, 0xAE, 0x43, 0xDE, 0x94, 0xEE, 0x77, 0x80, 0xAC, 0x83, 0x94, 0x75, 0x3C, 0x10, 0xAA, 0x0E, 0x51, 0x06, 0x2C, 0x29,
+0xD5, 0x28, 0x4D, 0x36, 0x1C, 0x01, 0x6B, 0xA3, 0x19, 0xD8, 0xEC, 0x61, 0x9C, 0xE5, 0xE9, 0x8C, 0xA6, 0xC2, 0xCC, 0x5D, 0xC1,
+0x8E, 0x93, 0x7B, 0x2D, 0x4F, 0xA8, 0x28, 0xF7, 0x27, 0x67, 0x4E, 0x79, 0xCB, 0x83, 0x56, 0x81, 0x9B, 0xD5, 0x11, 0x51, 0x3F,
+0x6C, 0x34, 0xE9, 0x05, 0x81, 0x7C, 0xE2, 0xC3, 0xCA, 0xE9, 0x40, 0x54, 0x55, 0x5D, 0xC4, 0x4E, 0xD3, 0x70, 0x62, 0x51, 0xDA,
+0xE5, 0x61, 0x07, 0x58, 0xD0, 0x0A, 0x56, 0x78, 0x34, 0xF9, 0xB5, 0x54, 0xB7, 0xE7, 0x81, 0xCD, 0x97, 0x05, 0xD1, 0x0D, 0x6B,
+0x93, 0x68, 0x96, 0x99, 0x32, 0xB4, 0xBD, 0x3C, 0xC7, 0xF0, 0xEE, 0xC7, 0xDE, 0x29, 0x93, 0x5B, 0xB1, 0xB6, 0x15, 0xF6, 0x7A,
+0xAF, 0xB4, 0xEF, 0x3C, 0x00, 0x8D, 0xBC, 0xCD, 0x7B, 0x08, 0x6C, 0x90, 0x43, 0x2A, 0xC6, 0x97, 0x5B, 0x80, 0x22, 0x22, 0x1D,
+0x87, 0x6E, 0x6A, 0x0D, 0xBF, 0x70, 0x4F, 0x73, 0x20, 0x9C, 0x9C, 0x41, 0x01, 0x8A, 0x61, 0x52, 0xDE, 0xEA, 0x50, 0x3B, 0xBC,
+0x7C, 0xE3, 0x55, 0x55, 0x83, 0xB2, 0x83, 0x24, 0x56, 0x77, 0x36, 0xCC, 0x97, 0x42, 0x18, 0xBF, 0x13, 0x45, 0x80, 0x3A, 0x18,
+0x13, 0x06, 0x2F, 0x15, 0xA9, 0x62, 0x65, 0x28, 0x26, 0x85, 0x4C, 0x55, 0x73, 0xA8, 0x3E, 0x71, 0x9D, 0x88, 0xBB, 0x24, 0x20,
+0xBF, 0xA0, 0xEE, 0xDF, 0x70, 0x00, 0x9D, 0xDD, 0xC2, 0x27, 0x7F, 0xB3, 0xC6, 0x9A, 0xE2, 0xBE, 0x4A, 0x33, 0xB5, 0xED, 0xC8,
+0x92, 0xCC, 0xAC, 0xD5, 0xB7, 0xD3, 0x28, 0x54, 0x6A, 0xA8, 0xD8, 0x0E, 0x92, 0x72, 0xFC, 0x3B, 0x35, 0xD5, 0xF3, 0x4F, 0xBD,
+0x78, 0x18, 0xF8, 0xAB, 0x34, 0x55, 0x96, 0x59, 0xA9, 0xA9, 0x46, 0x21, 0x7B, 0x53, 0x9F, 0x08, 0x90, 0xDF, 0xA9, 0xA9, 0x11,
+0x48, 0xF1, 0x2A, 0xCD, 0x44, 0xF8, 0x95, 0x9A, 0xA8, 0x0A, 0xD8, 0x9B, 0xB7, 0x8F, 0xE1, 0x0B, 0x3F, 0x85, 0xC1, 0x59, 0xA5,
+0x7D, 0x7C, 0xAF, 0x47, 0x53, 0x11, 0x5A, 0xAC, 0x82, 0x55, 0xCB, 0xAE, 0xEB, 0x76, 0x87, 0x56, 0x66, 0xEA, 0xC5, 0x01, 0x1B,
+0xC1, 0xB4, 0xC1, 0x4D, 0x40, 0xCB, 0xC8, 0x25, 0xFA, 0x54, 0x13, 0x10, 0x3E, 0xB2, 0xEC, 0x1A, 0xEA, 0xC3, 0xDC, 0x32, 0x27,
+0x2C, 0xB6, 0xB6, 0x68, 0x07, 0x35, 0x0E, 0x30, 0xDC, 0xF1, 0xA9, 0xFA, 0x5D, 0xB7, 0x7D, 0x10, 0x1F, 0x03, 0x8D, 0x13, 0x8C,
+0xCA, 0xEC, 0x93, 0xE5, 0x09, 0x36, 0xE7, 0xE6, 0xA6, 0xDA, 0x20, 0xD8, 0xEC, 0x99, 0x96, 0x92, 0x80, 0x27, 0x25, 0xAE, 0x55,
+0x53, 0x37, 0x91, 0xEF, 0x27, 0x67, 0x60, 0xDD, 0xC5, 0xC7, 0xB4, 0x38, 0x29, 0x0A, 0xB0, 0x33, 0xF4, 0x61, 0x8D, 0x83, 0x68,
+0x8A, 0x6B, 0x14, 0x8C, 0x19, 0x83, 0xD9, 0x3E, 0x8D, 0x3B, 0x61, 0xEC, 0x2E, 0x98, 0x10, 0x31, 0x12, 0x36, 0x55, 0x6F, 0x2E,
+0x3A, 0x3D, 0x96, 0x4C, 0xBD, 0x61, 0x98, 0x5F, 0x74, 0xFA, 0x65, 0x6B, 0x67, 0x7A, 0xC1, 0xE1, 0xF5, 0x5D, 0x68, 0xEE, 0xDD,
+0x2B, 0x6F, 0x4E, 0x0C, 0x82, 0xFC, 0x2C, 0x08, 0x62, 0x8B, 0xD7, 0xCF, 0x51, 0x86, 0x4A, 0x95, 0xE5, 0x7A, 0x10, 0x90, 0xCF,
+0x03, 0x87, 0xA4, 0xD7, 0x04, 0xBA, 0xFF, 0x19, 0xD8, 0xE5, 0xA0, 0x3F, 0xC4, 0x5A, 0x00, 0xE5, 0x3B, 0x60, 0x30, 0x36, 0xB2,
+0x61, 0x0A, 0x35, 0x55, 0x76, 0x32, 0xCA, 0xDC, 0x1B, 0xCA, 0x6D, 0x5E, 0xB0, 0x4D, 0xCF, 0xC2, 0x7C, 0x38, 0x46, 0xF7, 0x63,
+0xAF, 0x58, 0x17, 0x56, 0xE9, 0xA0, 0xF7, 0x72, 0xB4, 0xD0, 0xAB, 0x01, 0xAE, 0x71, 0x48, 0xA1, 0x4A, 0x72, 0x84, 0xE8, 0x71,
+0x8C, 0x4E, 0x9D, 0x49, 0xF9, 0xE7, 0xE7, 0x6F, 0x40, 0x41, 0x3C, 0x1F, 0x02, 0x0F, 0x38, 0x9B, 0x0A, 0x26, 0x0B, 0x2F, 0x2A,
+0x3B, 0xE3, 0x6F, 0xD1, 0x52, 0x14, 0x9E, 0xA4, 0xAE, 0x34, 0x24, 0xBF, 0x2D, 0xD7, 0x4D, 0x22, 0x97, 0x63, 0xBD, 0x5C, 0x86,
+0x81, 0x06, 0x00, 0xD3, 0x3A, 0xC8, 0x6A, 0x97, 0x5B, 0x7F, 0x95, 0x3E, 0xE2, 0xAD, 0xD8, 0x7D, 0x19, 0x0F, 0xA3, 0x19, 0xE8,
+0x45, 0xEC, 0x89, 0x34, 0xA0, 0xF5, 0x2C, 0xC6, 0xA5, 0x5A, 0xD6, 0xC6, 0xDF, 0xAE, 0x67, 0x04, 0x83, 0x97, 0xEA, 0x97, 0x6A,
+0xF7, 0xA0, 0xCC, 0x1D, 0x70, 0xEA, 0x5F, 0x65, 0xC7, 0x5F, 0xA5, 0xA3, 0xD6, 0xFF, 0x38, 0x65, 0xA5, 0xB7, 0x84, 0x0F, 0x27,
+0xE9, 0x85, 0x85, 0x25, 0x53, 0xE6, 0x1D, 0x97, 0x57, 0xE4, 0x02, 0x73, 0x36, 0xC1, 0xBD, 0x37, 0x8A, 0x6B, 0xA2, 0x20, 0xD5,
+0x62, 0x49, 0xBB, 0xFB, 0x8C, 0xF3, 0x21, 0x53, 0x88, 0xBE, 0xF7, 0x26, 0xD3, 0x6D, 0xE5, 0xA7, 0xE0, 0xA1, 0xDC, 0x1A, 0xF6,
+0xB9, 0x1E, 0x9E, 0xAF, 0xAE, 0x0D, 0x8D, 0x9E, 0xBB, 0x81, 0x04, 0xBC, 0x15, 0x7B, 0x58, 0x7F, 0xE1, 0x71, 0x9A, 0xE9, 0xCD,
+0xE0, 0x7D, 0x5F, 0xD9, 0x99, 0x6B, 0x86, 0x23, 0xE6, 0x9D, 0x7A, 0x21, 0x1D, 0x16, 0x68, 0x7D, 0xFB, 0xC9, 0xAB, 0x60, 0xF3,
+0x0D, 0xFA, 0xEA, 0x4D, 0x0A, 0x06, 0x1C, 0xD8, 0x82, 0x7F, 0xF1, 0xA1, 0xAA, 0x9A, 0x21, 0xC6, 0xA9, 0x18, 0x50, 0x09, 0x7F,
+0x2D, 0xBB, 0xEC, 0xDA, 0xC3, 0x75, 0x3D, 0xF6, 0xDB, 0x6C, 0x23, 0x85, 0x7F, 0xEE, 0xE6, 0x63, 0x16, 0xE4, 0x43, 0x97, 0xC5,
+0x50, 0x00, 0x57, 0xD9, 0xB2, 0x2A, 0xF4, 0xA3, 0x7C, 0xEB, 0x01, 0x5B, 0x74, 0xDE, 0x0D, 0x24, 0x60, 0xDF, 0xCB, 0xF2, 0x83,
+0xA0, 0x66, 0x6F, 0xF8, 0xAF, 0x23, 0x01, 0xAA, 0x19, 0xA6, 0x04, 0x40, 0x79, 0x9C, 0x50, 0xA1, 0x32, 0xE9, 0x7C, 0x5B, 0x55,
+0x08, 0x9E, 0xF8, 0x7E, 0xC6, 0xD1, 0xC0, 0x1C, 0x9D, 0xA4, 0xE8, 0x57, 0x96, 0xA8, 0xB0, 0xFF, 0xD1, 0x8C, 0xDD, 0x53, 0xD1,
+0x20, 0x0C, 0x3D, 0x1C, 0xDF, 0x5A, 0x0C, 0x8A, 0x1E, 0xBC, 0x81, 0x18, 0x60, 0x2C, 0xD5, 0xBE, 0xF4, 0x4F, 0xFE, 0xB5, 0x45,
+0xC1, 0x68, 0x8A, 0x29, 0x0E, 0xD2, 0x1E, 0xBE, 0xAE, 0x30, 0x28, 0x8D, 0x80, 0xDD, 0xAE, 0xC4, 0x20, 0x19, 0xD1, 0xB3, 0x70,
+0xCF, 0x31, 0xDC, 0x19, 0x94, 0x35, 0x7E, 0x6B, 0x59, 0x30, 0xBB, 0xF1, 0x06, 0xF2, 0xF0, 0x62, 0x16, 0x45, 0x42, 0xAE, 0xFF,
+0x62, 0xF3, 0xB8, 0x7E, 0x66, 0x45, 0x93, 0x0A, 0xBD, 0x41, 0xBB, 0x1F, 0xBC, 0x30, 0xA7, 0x5D, 0xA0, 0xD2, 0xD0, 0xC5, 0x11,
+0x2D, 0xC3, 0xFE, 0x34, 0xD7, 0x80, 0x19, 0x7F, 0x12, 0xC6, 0xA3, 0xA4, 0x33, 0x0C, 0xD3, 0x61, 0x14, 0x30, 0xA0, 0xAF, 0x6F,
+0x71, 0xDE, 0x24, 0x49, 0x94, 0x87, 0xD3, 0xE2, 0x83, 0x32, 0xEE, 0x77, 0x1C, 0x5A, 0xEE, 0x3B, 0x6B, 0x62, 0xAF, 0x00, 0x09,
+0xC9, 0x88, 0x92, 0x92, 0x22, 0x51, 0x0A, 0xAC, 0x44, 0x15, 0xAE, 0x95, 0x13, 0x0E, 0x35, 0x08, 0xA0, 0x5C, 0xC0, 0xE8, 0x38,
+0x99, 0xF4, 0x26, 0x48, 0x19, 0x54, 0x33, 0x60, 0xCC, 0x9D, 0x0C, 0xE8, 0xA2, 0x77, 0xD9, 0x73, 0xB2, 0xF1, 0xE1, 0x4D, 0xC8,
+0xEB, 0x84, 0x95, 0xC7, 0x85, 0xB4, 0x45, 0x33, 0x06, 0xF6, 0xCC, 0x45, 0x32, 0x63, 0x67, 0x5E, 0x2C, 0x66, 0x36, 0x1E, 0x86,
+0x40, 0x5E, 0xFA, 0x61, 0x89, 0x4F, 0xB4, 0x83, 0x26, 0x6B, 0x71, 0xD5, 0x8E, 0x29, 0x8C, 0xAF, 0x2C, 0x49, 0xB7, 0xA6, 0x49,
+0x48, 0xA1, 0xFC, 0xB4, 0xD1, 0xF1, 0x0D, 0xA5, 0xDF, 0x10, 0xDA, 0x1B, 0x0A, 0xFF, 0xD7, 0x5A, 0xC0, 0xFC, 0x39, 0x24, 0x9F,
+0x2F, 0x62, 0x94, 0xD8, 0xBF, 0x12, 0x4B, 0x0C, 0x0A, 0xD9, 0x39, 0x38, 0xF8, 0x83, 0xC5, 0x5E, 0x6A, 0x65, 0x29, 0xB4, 0x62,
+0x01, 0x24, 0x89, 0xC3, 0xA0, 0x16, 0x6C, 0x18, 0x1B, 0x05, 0x81, 0xFF, 0xD5, 0xC6, 0xC2, 0xFB, 0x2C, 0x00, 0xC9, 0xB6, 0x0C,
+0x03, 0x10, 0x98, 0x31, 0x1B, 0xA5, 0xC1, 0xAF, 0x33, 0xBE, 0x13, 0xAB, 0x70, 0xCA, 0x75, 0xF9, 0x9F, 0x4A, 0xDC, 0x57, 0x5F,
+0xAD, 0xFD, 0x55, 0xBC, 0x24, 0x2F, 0xC2, 0x74, 0x72, 0xE6, 0xA5, 0xE8, 0x84, 0x9F, 0xE5, 0x09, 0xC6, 0xFB, 0x0D, 0xD9, 0x48,
+0xBC, 0x63, 0x33, 0x7E, 0xCE, 0x03, 0xF4, 0xD1, 0x1A, 0x1D, 0x56, 0x98, 0xFD, 0x21, 0x7E, 0x2C, 0x45, 0xE2, 0x57, 0xF7, 0x21,
+0xAE, 0xFF, 0x19, 0x38, 0xFF, 0x0C, 0x16, 0xB7, 0x68, 0xF4, 0xE0, 0x1F, 0xA6, 0xD8, 0xA7, 0x3A, 0x61, 0x6D, 0x26, 0x0F, 0xDB,
+0xAC, 0x66, 0x44, 0xBD, 0x8C, 0xA1, 0xCB, 0xE0, 0xA3, 0xEA, 0x43, 0x1E, 0xE2, 0x36, 0x09, 0xFD, 0x18, 0x95, 0x04, 0xCE, 0x43,
+0x53, 0xF4, 0x90, 0xC3, 0x60, 0x47, 0x0B, 0xED, 0xDB, 0x19, 0x50, 0xB6, 0xD6, 0xFF, 0xBF, 0xE5, 0x1D, 0x3E, 0x88, 0x82, 0x60,
+0xEA, 0xEC, 0xBE, 0x39, 0x0D, 0x52, 0xCE, 0xEB, 0x0C, 0x5F, 0x50, 0x28, 0x26, 0x6B, 0x72, 0x2F, 0x7C, 0xE6, 0xC1, 0xC7, 0xD6,
+0x1F, 0x31, 0x9A, 0x38, 0x71, 0xAB, 0xF9, 0x84, 0x89, 0x7E, 0x0C, 0xB6, 0x90, 0x67, 0x8D, 0xEA, 0xE7, 0xEC, 0x1B, 0x04, 0xCD,
+0x2C, 0x08, 0x07, 0x45, 0x1A, 0x0E, 0x50, 0x0B, 0xC1, 0x6A, 0x83, 0xF8, 0xC9, 0xCF, 0x4F, 0x8D, 0x93, 0x59, 0x6A, 0x0D, 0x1D,
+0xD4, 0x0A, 0x5C, 0x33, 0xE0, 0x66, 0x79, 0xBA, 0x9E, 0x63, 0x5C, 0x20, 0xA7, 0x0A, 0xCF, 0x61, 0xCE, 0xA7, 0x09, 0x81, 0x97,
+0xA5, 0xA8, 0x2A, 0x17, 0x7F, 0x9C, 0x70, 0x63, 0x4E, 0x06, 0x21, 0xDA, 0x07, 0x5C, 0x18, 0x93, 0xD1, 0x88, 0x89, 0x5E, 0x66,
+0xFE, 0x8C, 0x36, 0xDB, 0x0A, 0x51, 0xFF, 0xB6, 0xC2, 0x5D, 0x10, 0x77, 0xFD, 0x69, 0xBA, 0x5F, 0x52, 0x29, 0xB5, 0x7D, 0x60,
+0xEC, 0xB8, 0x9A, 0x91, 0x03, 0xCB, 0x6D, 0xB3, 0x1A, 0x71, 0x06, 0xF6, 0xAD, 0xC6, 0xDF, 0x61, 0xA6, 0x5A, 0xAA, 0xB3, 0xD9,
+0xE8, 0xAC, 0x83, 0xE1, 0x25, 0xA6, 0x46, 0x53, 0xB1, 0x39, 0xBB, 0x62, 0x75, 0x93, 0x15, 0x51, 0x36, 0x96, 0x79, 0xE9, 0x77,
+0x53, 0x5E, 0x45, 0x8C, 0xD0, 0x52, 0xBD, 0x5C, 0x7B, 0x1E, 0x52, 0x21, 0x62, 0x18, 0x91, 0xC7, 0x9A, 0xAF, 0x78, 0xC2, 0x19,
+0xB6, 0x89, 0xA1, 0xF7, 0x69, 0x18, 0x64, 0x2D, 0xB3, 0x5D, 0x7A, 0x17, 0xA7, 0x58, 0x64, 0x4F, 0x46, 0xBC, 0xA9, 0xA1, 0x8C,
+0x2B, 0x36, 0x71, 0x88, 0x92, 0xF7, 0xA1, 0x7D, 0xF0, 0xAE, 0x97, 0x56, 0x36, 0x39, 0x9E, 0xA1, 0xC0, 0x18, 0xC7, 0xDA, 0xE9,
+0xEC, 0x1B, 0xF7, 0xB5, 0x0A, 0x8C, 0x92, 0x5D, 0x3D, 0x54, 0x21, 0x4E, 0xDF, 0xB0, 0xA7, 0x8B, 0xF0, 0xAC, 0x9B, 0x75, 0xB4,
+0xC4, 0xB3, 0x42, 0x3F, 0xCB, 0xF6, 0x2E, 0xEA, 0xE6, 0xA2, 0x87, 0x57, 0x51, 0x14, 0x46, 0x38, 0xCC, 0x42, 0x45, 0x61, 0x44,
+0xE9, 0xD8, 0x82, 0xF4, 0xCC, 0x60, 0x31, 0x95, 0xE4, 0xE5, 0x0F, 0xB5, 0x75, 0x2D, 0x2B, 0x64, 0x8C, 0x52, 0xC3, 0x64, 0x48,
+0x4A, 0xA8, 0x28, 0x35, 0x12, 0x2C, 0xF6, 0x62, 0x58, 0xDA, 0x7D, 0x93, 0xC5, 0xF0, 0x13, 0x96, 0x7B, 0x60, 0x33, 0x90, 0x18,
+0x81, 0x39, 0x2C, 0xDB, 0x09, 0xED, 0x1E, 0x85, 0xC7, 0x33, 0x34, 0x83, 0x27, 0x14, 0xE6, 0xD9, 0x04, 0xDB, 0xFB, 0xCC, 0x3B,
+0x81, 0x5F, 0xA3, 0x34, 0x99, 0x68, 0xF3, 0x59, 0xCB, 0x65, 0x2F, 0xB9, 0x0B, 0x52, 0x0A, 0x08, 0x2E, 0x9D, 0x95, 0x52, 0xE0,
+0xE6, 0x5D, 0x98, 0x89, 0xD8, 0x9B, 0x36, 0xF3, 0xCC, 0x0A, 0x85, 0x17, 0x9B, 0x76, 0x34, 0x94, 0x4F, 0x33, 0x9C, 0x50, 0x36,
+0x8E, 0x3C, 0x88, 0x2E, 0x16, 0xAE, 0x77, 0x97, 0x33, 0xFB, 0xDF, 0xC1, 0x8A, 0x3A, 0xC4, 0x83, 0x3F, 0x5E, 0x4C, 0x41, 0x9F,
+0x1E, 0x4A, 0x12, 0x3B, 0x3C, 0x7C, 0xBB, 0xBE, 0xBE, 0x21, 0xD8, 0x4D, 0x11, 0xDA, 0x14, 0x87, 0xF4, 0x2D, 0xCD, 0x7E, 0x25,
+0x01, 0x2B, 0x87, 0x23, 0x80, 0x0D, 0x77, 0xF1, 0x04, 0xBB, 0xC4, 0xB1, 0x8A, 0x7E, 0xE5, 0x94, 0x9D, 0x31, 0xA7, 0x2F, 0xD6,
+0xAB, 0xCB, 0xEA, 0x4F, 0xFE, 0x86, 0x38, 0xC0, 0x65, 0x1A, 0xFE, 0x19, 0x06, 0x1F, 0x80, 0x2E, 0xB4, 0x8C, 0xD1, 0xED, 0x73,
+0x12, 0xE8, 0x32, 0x33, 0xB8, 0x10, 0x42, 0x0E, 0x70, 0x5B, 0x56, 0x6B, 0xD0, 0x44, 0x60, 0x31, 0x09, 0x51, 0xE8, 0xF1, 0x8C,
+0x34, 0x3B, 0xA3, 0x3F, 0xD5, 0x53, 0x2E, 0xF7, 0xA0, 0x4D, 0x7D, 0x8C, 0xA0, 0x9A, 0xA1, 0x4B, 0xA9, 0xE6, 0xE4, 0xCA, 0x46,
+0x0F, 0xA0, 0x36, 0x05, 0x54, 0x56, 0x0B, 0x76, 0x0F, 0xC1, 0xFA, 0xBD, 0x85, 0x70, 0x0F, 0x09, 0x6E, 0x31, 0xBE, 0xFE, 0x03,
+0x04, 0xDC, 0xB0, 0x21, 0xAC, 0x33, 0x73, 0xFF, 0xFC, 0x0B, 0x3C, 0x68, 0xC2, 0x8B, 0x08, 0xF4, 0xCD, 0x2E, 0xFE, 0xCB, 0xA3,
+0xAB, 0x84, 0xFD, 0x0B, 0xCD, 0xFD, 0xDE, 0x0F, 0x8E, 0xB7, 0xBF, 0xAD, 0xD9, 0x2B, 0xE9, 0xF9, 0x7F, 0x65, 0x01, 0x0D, 0xED,
+0xF9, 0x21, 0xC1, 0xF0, 0xE5, 0x83, 0x00, 0x38, 0x41, 0xF1, 0xD2, 0xB0, 0x9A, 0xCA, 0x72, 0x3A, 0x80, 0x4D, 0x5E, 0x44, 0x9E,
+0xE4, 0xE5, 0x1B, 0xF3, 0x98, 0x68, 0x5A, 0x5E, 0x71, 0x15, 0x6A, 0x6A, 0x9D, 0xA3, 0xE0, 0x2D, 0x41, 0x2C, 0x83, 0x9A, 0x53,
+0x5F, 0xE5, 0x13, 0xEA, 0xAA, 0x40, 0xED, 0xF1, 0x9C, 0x8D, 0x75, 0xEB, 0xF1, 0x1C, 0x94, 0x49, 0xC5, 0x31, 0xCB, 0x91, 0x75,
+0x92, 0x59, 0x91, 0xB2, 0xB0, 0xEE, 0x64, 0x8E, 0x3D, 0xA0, 0xB2, 0xC0, 0x1F, 0x07, 0x67, 0x66, 0xAF, 0xD0, 0x5E, 0x07, 0x75,
+0x0D, 0x6B, 0x46, 0x41, 0x0E, 0x70, 0x59, 0x5B, 0xC6, 0x03, 0xB4, 0xD9, 0xF8, 0x62, 0x3A, 0x86, 0x99, 0x87, 0x25, 0x71, 0x74,
+0xD1, 0x72, 0xFF, 0x72, 0xEE, 0x3A, 0x9C, 0xB9, 0x7E, 0x31, 0x24, 0xB2, 0x09, 0x3D, 0xD6, 0x79, 0xFF, 0x63, 0x8B, 0xE2, 0x11,
+0xD8, 0x6F, 0x49, 0x1C, 0xAC, 0xEA, 0x9D, 0xA3, 0xD3, 0x5A, 0x3C, 0x45, 0x21, 0xDF, 0xE6, 0x54, 0x98, 0xE4, 0x3E, 0xE7, 0x90,
+0x0C, 0x74, 0x21, 0x22, 0xDF, 0x7A, 0xA2, 0xFE, 0xE5, 0xE6, 0xC2, 0x7E, 0xF8, 0xCB, 0x4A, 0xA2, 0x8E, 0x55, 0xAE, 0x76, 0x0E,
+0x0D, 0x99, 0xF4, 0xF6, 0xCD, 0xC1, 0xCB, 0xFF, 0xD6, 0x78, 0x97, 0xE5, 0xE4, 0x84, 0xB0, 0x88, 0xFD, 0xFB, 0x1F, 0xAF, 0x2D,
+0xED, 0xC1, 0x39, 0x98, 0x74, 0xE5, 0xAA, 0x6E, 0x74, 0x88, 0x47, 0x1E, 0x04, 0x01, 0x64, 0x1D, 0x44, 0xB6, 0xE8, 0x08, 0x0F,
+0x46, 0x2B, 0xBB, 0xF5, 0x06, 0xD2, 0xEB, 0xE4, 0x80, 0xB6, 0x68, 0xFE, 0xC2, 0x11, 0x05, 0xB1, 0x68, 0x02, 0xED, 0x1B, 0x1F,
+0xCC, 0xA6, 0xFC, 0xF8, 0xA8, 0xB6, 0x1F, 0xDA, 0x65, 0xB8, 0x18, 0x58, 0xBB, 0x6E, 0x4C, 0xE0, 0xE1, 0x2C, 0x45, 0x05, 0x34,
+0x1A, 0x51, 0xCA, 0x8E, 0x71, 0x92, 0x86, 0xBF, 0xE1, 0xCA, 0x2E, 0xD2, 0x36, 0xB7, 0xF0, 0xD4, 0x2A, 0x6E, 0x84, 0x8D, 0x78,
+0x32, 0xA9, 0x6F, 0x37, 0xE0, 0xF4, 0xB6, 0x5F, 0x77, 0x3F, 0xF5, 0x85, 0x97, 0xE5, 0xEF, 0x82, 0x11, 0x70, 0x6D, 0xFC, 0x17,
+0x96, 0x02, 0xB1, 0x35, 0xA0, 0xB5, 0x05, 0xC3, 0x77, 0xD3, 0xC0, 0x93, 0x89, 0x0D, 0x30, 0x77, 0x41, 0xCA, 0x3F, 0xE1, 0x59,
+0xC2, 0x60, 0xF5, 0x4D, 0x11, 0x8E, 0x4D, 0x2C, 0xEE, 0x82, 0xD3, 0x20, 0xBD, 0x60, 0x0F, 0x7B, 0xB0, 0x30, 0x1A, 0xD2, 0x0A,
+0xED, 0xEE, 0x26, 0xFD, 0xFC, 0x03, 0xB6, 0x43, 0xF4, 0xFE, 0xFB, 0x9D, 0xF6, 0x19, 0xFF, 0xB8, 0xE9, 0x73, 0x2F, 0x99, 0x4C,
+0xB2, 0x97, 0x43, 0x15, 0x28, 0x44, 0x4B, 0x64, 0x20, 0x13, 0xC6, 0xB4, 0x1F, 0xC2, 0x52, 0x18, 0xF4, 0xB3, 0x70, 0x1F, 0x5F,
+0x73, 0xB3, 0x4B, 0x45, 0x0C, 0x9D, 0x8D, 0x69, 0x4D, 0x3F, 0x99, 0xCC, 0x62, 0x44, 0x8C, 0x28, 0x69, 0xA7, 0x19, 0xDD, 0x03,
+0x6C, 0x9A, 0x26, 0xA7, 0x98, 0x8B, 0x33, 0xFB, 0xC6, 0xD3, 0x69, 0xD1, 0xFC, 0x95, 0xD7, 0xBE, 0xEF, 0xB2, 0x0C, 0x93, 0xDB,
+0x2D, 0xB5, 0xD8, 0x15, 0x9E, 0xC4, 0xF5, 0x92, 0x10, 0xCC, 0xDF, 0xBE, 0x48, 0x79, 0x05, 0xFC, 0x5C, 0xB4, 0x60, 0x23, 0xA9,
+0x41, 0xB0, 0xF1, 0x32, 0x15, 0x14, 0x90, 0xF1, 0xA8, 0x00, 0x1C, 0x34, 0x5B, 0xDF, 0xC4, 0x5B, 0x73, 0x88, 0x26, 0x51, 0x32,
+0x65, 0x9B, 0x15, 0x3A, 0x70, 0xDC, 0x52, 0x36, 0x2B, 0x71, 0xCA, 0x8A, 0x53, 0x46, 0x87, 0x7A, 0x06, 0xFC, 0xF4, 0x13, 0x88,
+0xEE, 0x88, 0xD2, 0xA7, 0xC4, 0x17, 0x2C, 0xA1, 0x03, 0x19, 0xA5, 0x90, 0x87, 0xC5, 0xB1, 0x05, 0xDA, 0x22, 0x5D, 0x67, 0xD0,
+0xA2, 0x94, 0x1A, 0xCB, 0x08, 0x2B, 0x75, 0x11, 0x4C, 0x48, 0x64, 0x3D, 0x58, 0xD3, 0x1A, 0xAA, 0xA9, 0x1F, 0x14, 0x52, 0x32,
+0x0D, 0x78, 0x3C, 0x85, 0x9A, 0x99, 0x18, 0xC2, 0xA2, 0xCF, 0xEC, 0xAF, 0x32, 0xFE, 0xA1, 0x5D, 0x6F, 0xD3, 0x30, 0xC1, 0x9C,
+0xFE, 0xCE, 0xAE, 0xF8, 0x15, 0x66, 0x81, 0x11, 0x74, 0xC2, 0xE5, 0xEB, 0xDA, 0xA3, 0xBE, 0x40, 0x23, 0x22, 0x54, 0xCA, 0x1D,
+0xFE, 0x2D, 0x07, 0xBC, 0xDE, 0xDE, 0xEB, 0x4E, 0xE7, 0xAF, 0x53, 0x74, 0x09, 0xBD, 0x19, 0x8D, 0xB2, 0x20, 0x5F, 0xDD, 0xEB,
+0xB5, 0xF4, 0x96, 0xC2, 0xB5, 0x5D, 0x5F, 0xB1, 0x4E, 0xDF, 0x2E, 0xFF, 0xCB, 0x0A, 0x3B, 0x97, 0x0D, 0x2E, 0xBE, 0x8D, 0x9A,
+0x10, 0xE1, 0x45, 0x7A, 0x4C, 0x9D, 0xDA, 0x8F, 0x2C, 0xA8, 0x19, 0xCD, 0x52, 0x52, 0x03, 0x30, 0xC6, 0x13, 0x11, 0x6C, 0x87,
+0x1F, 0xC8, 0xD5, 0x4B, 0x21, 0x4C, 0x30, 0xF9, 0xB6, 0x5C, 0xF6, 0x2C, 0x01, 0xD8, 0x38, 0xC9, 0x41, 0x7D, 0x8C, 0x70, 0xF4,
+0x57, 0x56, 0x61, 0xAB, 0xA8, 0x8D, 0xD8, 0xD6, 0x83, 0xF3, 0x5D, 0x7B, 0xF3, 0x36, 0x7F, 0x85, 0x5C, 0x60, 0xCE, 0xA7, 0x83,
+0x64, 0x96, 0x0E, 0x83, 0x3F, 0xA3, 0x54, 0xF8, 0x05, 0x75, 0x3C, 0x33, 0x30, 0xCD, 0xBA, 0x19, 0xBD, 0xF9, 0x36, 0xF2, 0xC0,
+0xE3, 0x13, 0xE4, 0xA9, 0x47, 0x59, 0x37, 0x2D, 0x00, 0x89, 0x20, 0xAC, 0x2B, 0xE5, 0x49, 0xCD, 0x5C, 0xC6, 0x33, 0xA6, 0x10,
+0x84, 0x88, 0x47, 0x53, 0xA9, 0xB1, 0xA8, 0xD5, 0x30, 0xAD, 0x60, 0x10, 0x14, 0x4D, 0x29, 0xAE, 0x4C, 0xAC, 0x85, 0x47, 0x7D,
+0x41, 0x89, 0xFF, 0x93, 0xF6, 0xF9, 0x42, 0x3C, 0x52, 0x86, 0xD6, 0x46, 0x80, 0x89, 0x7C, 0x57, 0x11, 0x0F, 0xBF, 0xDA, 0x91,
+0xD7, 0x13, 0x0E, 0x43, 0xFF, 0xAF, 0xDF, 0x60, 0x03, 0x5B, 0x9D, 0x61, 0x5E, 0xB8, 0x27, 0xA5, 0x8E, 0x53, 0xDB, 0x37, 0xAE,
+0x87, 0x5E, 0x7C, 0xEA, 0x65, 0x0A, 0xE7, 0x1E, 0x3D, 0x16, 0x79, 0xE8, 0x36, 0xEF, 0x15, 0x89, 0xE8, 0xEE, 0xDD, 0xB5, 0x65,
+0x45, 0xA4, 0xBB, 0x2E, 0x3A, 0x29, 0xF2, 0x14, 0x6D, 0xC2, 0xAD, 0x69, 0x78, 0x8E, 0x79, 0xAC, 0xF1, 0x0E, 0x83, 0x6A, 0x32,
+0xF9, 0x5E, 0x8F, 0xD8, 0xCB, 0x2B, 0x9D, 0x9B, 0xA1, 0x07, 0x89, 0x39, 0xA0, 0xB3, 0x5F, 0xCE, 0xEE, 0x6B, 0x18, 0xE5, 0x30,
+0x8D, 0xC4, 0x64, 0x41, 0x2C, 0x38, 0xF7, 0xCB, 0x6E, 0x3A, 0x2C, 0xB0, 0xE2, 0x77, 0x74, 0x24, 0xF7, 0x05, 0x66, 0x23, 0xC9,
+0xD8, 0x94, 0x4C, 0x12, 0x9C, 0xC6, 0xEC, 0xFB, 0x02, 0xAA, 0xC0, 0x75, 0xB6, 0x04, 0xFA, 0xCE, 0x6E, 0xBF, 0xD6, 0x27, 0x0F,
+0x26, 0xC0, 0x7A, 0xED, 0x47, 0xEC, 0x0C, 0x61, 0x54, 0xED, 0xDE, 0xAD, 0x77, 0xEB, 0xD3, 0x2E, 0xC1, 0x12, 0xCE, 0xFC, 0x05,
+0xD9, 0x45, 0xAE, 0x93, 0x42, 0xA4, 0x64, 0xAA, 0x6C, 0xD1, 0x15, 0x0F, 0xD2, 0x60, 0xD9, 0xD6, 0x3A, 0x48, 0x66, 0x39, 0xB7,
+0x07, 0x1B, 0x69, 0xD9, 0xD0, 0xF1, 0x32, 0x8C, 0x6D, 0x67, 0xAE, 0xDC, 0x8C, 0xCE, 0x50, 0x6B, 0x94, 0x76, 0x5A, 0xB7, 0xB8,
+0xD8, 0xD5, 0x64, 0x83, 0x7C, 0x92, 0xE7, 0xB5, 0xAB, 0xF0, 0x72, 0x0A, 0x19, 0x4C, 0xDA, 0x18, 0x8B, 0x04, 0x7F, 0x94, 0x8F,
+0x78, 0x98, 0xB8, 0xB3, 0x93, 0xAA, 0x43, 0x48, 0xCB, 0x57, 0x1B, 0xA7, 0x41, 0x94, 0x1C, 0x27, 0x22, 0x65, 0x2D, 0x65, 0xA9,
+0x35, 0x52, 0x04, 0x2A, 0x3D, 0x34, 0xF1, 0xCE, 0x55, 0x92, 0x77, 0x1E, 0x7B, 0x85, 0x76, 0x65, 0x85, 0xE0, 0xD4, 0x3F, 0x5E,
+0x95, 0x62, 0xA4, 0xD4, 0x17, 0xCA, 0x90, 0x36, 0xC3, 0xD1, 0xE5, 0x35, 0x97, 0x68, 0xA8, 0xA4, 0x4C, 0xB4, 0x45, 0xA5, 0xAE,
+0x4A, 0x7A, 0x3E, 0x8A, 0x56, 0x21, 0x1D, 0xC0, 0xDD, 0xE3, 0xE4, 0x14, 0x18, 0xDC, 0x9D, 0x4B, 0x2C, 0xC0, 0x95, 0x89, 0xC5,
+0x74, 0x82, 0x2B, 0x12, 0x37, 0xC8, 0x57, 0xA1, 0xCD, 0xC8, 0x25, 0x34, 0x97, 0xBA, 0x41, 0x5E, 0x26, 0xEE, 0xA9, 0x28, 0xBB,
+0x2C, 0x85, 0xC5, 0xE4, 0x61, 0x4A, 0x35, 0x46, 0xE8, 0xB1, 0x5E, 0xED, 0x80, 0xE0, 0x66, 0xB8, 0x54, 0x7E, 0xDF, 0x0F, 0x93,
+0xE9, 0xC5, 0x36, 0x5B, 0xEF, 0xAD, 0xDF, 0x63, 0xFF, 0x44, 0x67, 0x27, 0x3B, 0x48, 0x46, 0x39, 0x06, 0x75, 0xBA, 0xEC, 0x10,
+0x37, 0x04, 0xCE, 0x92, 0xF4, 0x04, 0xE7, 0xC8, 0x08, 0x4C, 0xF1, 0x38, 0x83, 0xE9, 0x94, 0x72, 0x2D, 0x56, 0xB3, 0x28, 0xA1,
+0x4F, 0x06, 0xF7, 0xCC, 0x71, 0x26, 0xC5, 0xFC, 0x44, 0xC8, 0x00, 0x51, 0x26, 0xEB, 0x0E, 0x2E, 0x3A, 0xF1, 0xB0, 0x93, 0x79,
+0x78, 0x33, 0x95, 0x85, 0x2D, 0x7B, 0xA2, 0x2C, 0xDB, 0xE3, 0x85, 0x99, 0xBC, 0x6C, 0x08, 0xF3, 0x96, 0xBE, 0x4E, 0x62, 0x7C,
+0x1D, 0xA4, 0x43, 0xBC, 0x5D, 0xEA, 0x60, 0x0C, 0xA4, 0x3D, 0x89, 0xC2, 0x93, 0x80, 0x01, 0x2E, 0x9E, 0x89, 0x09, 0x93, 0x04,
+0x0E, 0x15, 0x08, 0x65, 0xD0, 0x24, 0xFF, 0xBB, 0xA0, 0x1E, 0xAF, 0xA6, 0xC2, 0xE3, 0xE3, 0xE8, 0x47, 0xC0, 0x84, 0x23, 0xDC,
+0x53, 0x18, 0xC6, 0xEC, 0x24, 0xCC, 0xD1, 0xCB, 0x0C, 0xEC, 0x09, 0x26, 0x98, 0x38, 0x8E, 0x16, 0x0F, 0x6D, 0x6C, 0xEC, 0x34,
+0x4D, 0xC6, 0xE1, 0x20, 0x9C, 0x3F, 0xAF, 0x94, 0xAE, 0xCF, 0xA9, 0xF0, 0xBB, 0xB8, 0x4B, 0xA7, 0x94, 0x2C, 0x09, 0xE3, 0x46,
+0x65, 0x8A, 0x2F, 0xFE, 0x7B, 0x7E, 0xF6, 0xA2, 0x6C, 0x36, 0x98, 0x84, 0xB8, 0x9D, 0x86, 0xDE, 0xF0, 0x22, 0x95, 0x7D, 0x5D,
+0x62, 0x2F, 0xED, 0x4A, 0x89, 0x2E, 0xB6, 0xC8, 0xAE, 0xBF, 0x13, 0x1F, 0x58, 0x55, 0x58, 0x0E, 0x28, 0x79, 0x6F, 0x61, 0x59,
+0x3E, 0xCD, 0x5F, 0xE1, 0x17, 0xEC, 0xA3, 0x01, 0xDD, 0x16, 0xB4, 0xE3, 0xA0, 0x35, 0x47, 0xF6, 0x03, 0xBF, 0x7F, 0x46, 0x26,
+0xF1, 0xA9, 0xA2, 0xEB, 0xF8, 0xC0, 0xFE, 0xE4, 0x98, 0xE9, 0x0F, 0x42, 0xD0, 0x02, 0xDF, 0x5A, 0x40, 0x66, 0x49, 0xB1, 0x7D,
+0xC3, 0xF5, 0x20, 0x67, 0xDD, 0x78, 0xD3, 0xFC, 0x42, 0x76, 0x22, 0xAC, 0xBE, 0xD1, 0x8D, 0x0F, 0x1D, 0xFD, 0x0C, 0xB7, 0x56,
+0xC6, 0x9B, 0x05, 0x8F, 0xCD, 0x3C, 0x45, 0x7A, 0x66, 0xF3, 0x28, 0xC9, 0x82, 0xC2, 0x02, 0x85, 0xC1, 0x3C, 0x09, 0x15, 0x5A,
+0x33, 0xC1, 0xED, 0x1E, 0x81, 0xEE, 0x56, 0xB9, 0x5C, 0xA1, 0x13, 0x17, 0xB4, 0x73, 0xD3, 0xF6, 0x4B, 0x7B, 0x36, 0xD4, 0xF7,
+0xD9, 0x64, 0xC8, 0x09, 0xC3, 0xA9, 0x6E, 0x6B, 0xC5, 0x7C, 0x75, 0x7A, 0x30, 0xAA, 0xC0, 0xF3, 0x03, 0xD8, 0xA1, 0x8B, 0x03,
+0x52, 0x61, 0xAE, 0x8D, 0xD5, 0x3C, 0xAA, 0xAE, 0xA4, 0xEA, 0xBB, 0x74, 0xD9, 0x95, 0xB3, 0x0B, 0x74, 0x20, 0x84, 0xBD, 0x86,
+0x57, 0x14, 0x01, 0x70, 0x83, 0xA0, 0x57, 0xCE, 0xAE, 0x62, 0xB0, 0x2C, 0xE8, 0xAD, 0x72, 0x92, 0xBB, 0x9A, 0x5E, 0xDB, 0xDD,
+0xC3, 0xD8, 0xAA, 0xA8, 0x9A, 0x27, 0x6C, 0x2E, 0x5E, 0x35, 0xC2, 0x44, 0x36, 0xB1, 0x3D, 0x8C, 0x20, 0x4A, 0x27, 0x3C, 0x08,
+0xE4, 0x89, 0xEF, 0x2F, 0x4A, 0x9B, 0xB7, 0x78, 0x40, 0xC9, 0xF8, 0xA2, 0x67, 0x33, 0xCA, 0x97, 0x17, 0xFF, 0x65, 0x86, 0x95,
+0x0A, 0xB6, 0x93, 0x94, 0xFF, 0x79, 0x06, 0x97, 0xC8, 0x39, 0x6F, 0x32, 0xD6, 0xB1, 0x8E, 0x39, 0x9E, 0x37, 0x07, 0xE7, 0x2D,
+0x19, 0xA6, 0x55, 0x1B, 0xC1, 0x33, 0x1F, 0xA1, 0xF2, 0x10, 0x96, 0xE2, 0x71, 0x9C, 0xDD, 0x8D, 0x65, 0x82, 0x62, 0xFE, 0x5A,
+0xF2, 0x5F, 0x84, 0x8D, 0x2E, 0x3F, 0x06, 0xE4, 0x2D, 0x7C, 0xEA, 0x5E, 0x41, 0x5C, 0x9F, 0xE1, 0xAD, 0x82, 0x97, 0x6B, 0xE2,
+0xA0, 0xD8, 0x81, 0x58, 0x90, 0x6C, 0x31, 0xCA, 0xA5, 0xD5, 0x2E, 0xBF, 0x07, 0xAB, 0xAC, 0xFC, 0x09, 0xD3, 0xAF, 0x6E, 0x31,
+0xC7, 0x51, 0x2F, 0xF6, 0xDE, 0x1D, 0x18, 0xCF, 0xFB, 0xF0, 0x6F, 0x3E, 0xF3, 0xF1, 0xB2, 0xBE, 0xE2, 0x5D, 0x12, 0x1F, 0x17,
+0x2F, 0xCD, 0x6C, 0xF3, 0xBC, 0xB0, 0xF9, 0xEE, 0xCD, 0x8F, 0x5B, 0x0C, 0x07, 0x5D, 0x7B, 0x4D, 0x77, 0xF4, 0x50, 0x61, 0x3C,
+0x98, 0x5C, 0xD0, 0x80, 0x4F, 0x2F, 0xFD, 0xE2, 0x37, 0x26, 0x68, 0xA6, 0x67, 0xCC, 0x8C, 0xCA, 0x5F, 0xA9, 0xFC, 0xC6, 0x1A,
+0x94, 0x57, 0xE0, 0xDA, 0xC7, 0x0F, 0xF0, 0x1B, 0xEC, 0xC3, 0x02, 0x2D, 0x3C, 0x48, 0xAC, 0xF0, 0x53, 0x82, 0xE3, 0xCF, 0x02,
+0xFA, 0xA5, 0x8F, 0x54, 0x0A, 0xE6, 0xA8, 0x74, 0xAF, 0xAA, 0x50, 0xB9, 0x21, 0xB4, 0x37, 0x8D, 0x37, 0xC4, 0x60, 0x79, 0xD6,
+0xED, 0xF6, 0x76, 0xD0, 0x3E, 0x6F, 0xB3, 0xFE, 0x0E, 0x1E, 0x77, 0x6E, 0xB3, 0xF5, 0x1D, 0xB0, 0x32, 0xF1, 0x0E, 0xC6, 0x1F,
+0x83, 0x0B, 0x8E, 0xC4, 0xBC, 0x46, 0xA1, 0xD2, 0x55, 0xE6, 0x67, 0xA3, 0xC8, 0x5E, 0x9A, 0x89, 0xC6, 0xFE, 0x56, 0x10, 0x20,
+0x23, 0x4A, 0x8A, 0x37, 0x94, 0xFE, 0x1C, 0x96, 0x36, 0x48, 0x08, 0xA5, 0xD6, 0x37, 0x3E, 0xBC, 0xF3, 0x8F, 0x6B, 0x3F, 0x88,
+0x2C, 0x2B, 0xC6, 0xB7, 0xC2, 0xE7, 0x42, 0x1C, 0x92, 0x07, 0xAC, 0x7E, 0x0A, 0xD2, 0x4C, 0xD1, 0x87, 0x29, 0xC1, 0x5E, 0xD8,
+0x3E, 0xA8, 0x38, 0xCF, 0x2D, 0xF6, 0xF1, 0x08, 0xDB, 0xC1, 0xA5, 0x9D, 0x3F, 0x7D, 0xC9, 0xB0, 0xF9, 0xDC, 0xB8, 0xDA, 0x62,
+0x97, 0x57, 0xED, 0x35, 0xAF, 0x48, 0xF9, 0xCA, 0x41, 0xC4, 0x36, 0x42, 0x56, 0x14, 0x78, 0xAB, 0x55, 0x85, 0x85, 0xD6, 0xAE,
+0xE4, 0x05, 0x9B, 0x01, 0xBF, 0x3A, 0x33, 0xA3, 0x81, 0x80, 0x32, 0xB7, 0x55, 0x5C, 0xAF, 0x09, 0xC6, 0xAF, 0xB8, 0x59, 0xF3,
+0xE9, 0xC5, 0x4B, 0xBF, 0x69, 0x5E, 0x0A, 0xD6, 0x02, 0x3A, 0x55, 0xFE, 0xF3, 0x39, 0x85, 0xB4, 0x7B, 0x43, 0x8C, 0x22, 0x34,
+0x9A, 0x96, 0x28, 0x85, 0x6B, 0xA1, 0x56, 0x21, 0xCF, 0x2A, 0xAF, 0xF1, 0x9C, 0xC2, 0x95, 0x1C, 0xE9, 0x95, 0xF2, 0xF3, 0x0A,
+0x9B, 0x99, 0xCD, 0x5B, 0xA5, 0x71, 0xB3, 0x64, 0xFD, 0x96, 0xF4, 0xE6, 0x76, 0x4C, 0x0B, 0x28, 0x29, 0xE7, 0x23, 0x6F, 0x55,
+0x45, 0xBD, 0xB6, 0x7C, 0xE9, 0xE6, 0x91, 0x56, 0x55, 0xD7, 0xD4, 0x16, 0x2D, 0x5D, 0x81, 0x01, 0x45, 0x8B, 0xA4, 0x76, 0x73,
+0x8A, 0x69, 0xA9, 0xF2, 0xA0, 0x88, 0x76, 0x06, 0x6C, 0x4E, 0x19, 0xFD, 0xA4, 0x18, 0x0A, 0x88, 0x3A, 0x49, 0x35, 0x4F, 0x3A,
+0x8A, 0xE3, 0x56, 0xB2, 0xC8, 0xF3, 0xD8, 0x5F, 0x54, 0x00, 0xCF, 0x42, 0x21, 0x38, 0x2C, 0x4F, 0x78, 0x72, 0xD9, 0x79, 0x05,
+0x70, 0xBD, 0x83, 0xCC, 0xC6, 0x24, 0xC5, 0x0B, 0xA1, 0xF5, 0x5B, 0x51, 0xA0, 0x10, 0xF7, 0xE2, 0xCC, 0x1B, 0x48, 0xDC, 0xCD,
+0x03, 0xA0, 0x45, 0x02, 0xF1, 0x85, 0x95, 0x68, 0xB9, 0xC6, 0x5B, 0xA4, 0x54, 0xF1, 0xE7, 0xBC, 0xCE, 0x10, 0xF9, 0xD4, 0x5B,
+0x52, 0x57, 0x1F, 0x2F, 0x18, 0xA9, 0xE5, 0xB4, 0xE2, 0x2D, 0x43, 0x93, 0xCF, 0x2B, 0xA6, 0x09, 0xA7, 0x96, 0x0A, 0x7A, 0x39,
+0xB6, 0xC9, 0xBC, 0xD1, 0x45, 0x9B, 0xB4, 0xF4, 0xD5, 0x8B, 0xA9, 0xD5, 0x73, 0x5D, 0x03, 0x0A, 0x19, 0xF9, 0x3D, 0xA7, 0xA0,
+0x0A, 0x0E, 0xC7, 0x9E, 0xD2, 0xA3, 0xA2, 0xE7, 0x6B, 0x3E, 0x2D, 0x7A, 0x5A, 0xD4, 0xF3, 0xCB, 0x82, 0x4A, 0x7E, 0x21, 0x86,
+0x88, 0x88, 0xB3, 0x79, 0x6C, 0x90, 0x41, 0x69, 0x1C, 0x2F, 0x06, 0x62, 0xCE, 0xC7, 0x4C, 0xA1, 0x9A, 0x0A, 0xF7, 0x02, 0x78,
+0x2D, 0xBA, 0xB3, 0x55, 0xB6, 0x20, 0x6A, 0x0B, 0x19, 0x3B, 0x4A, 0x2D, 0x35, 0xA3, 0x2C, 0xE8, 0x12, 0x7D, 0xFB, 0xBA, 0x65,
+0xCE, 0x81, 0xB5, 0x65, 0xB4, 0xCD, 0x89, 0x56, 0x31, 0xF3, 0x19, 0x29, 0xA0, 0xE7, 0x0D, 0x53, 0x6B, 0xCA, 0x68, 0x14, 0xA5,
+0x72, 0xA2, 0xE7, 0x79, 0x92, 0x54, 0x49, 0x0A, 0xAD, 0x21, 0xD8, 0x53, 0x93, 0xEF, 0xC2, 0xF2, 0xCA, 0x2A, 0xD5, 0x1A, 0x62,
+0x9E, 0xDF, 0x5A, 0xA2, 0x25, 0xA5, 0x03, 0x5F, 0xAD, 0x62, 0xFA, 0x5F, 0x16, 0x93, 0xFD, 0x48, 0x51, 0xA1, 0x8F, 0x17, 0x73,
+0xA4, 0x51, 0x82, 0x6C, 0xA8, 0xC2, 0x8B, 0xB9, 0xD1, 0x30, 0x01, 0x1B, 0x2D, 0x34, 0x35, 0x6A, 0x81, 0x75, 0x8B, 0xA2, 0xD1,
+0xB2, 0xDC, 0xAC, 0x7D, 0x12, 0x5C, 0xE0, 0x85, 0x87, 0x8D, 0x36, 0x1B, 0xCD, 0x62, 0xEA, 0xE4, 0x26, 0x5E, 0x21, 0x8B, 0xBB,
+0xB0, 0xCD, 0xC0, 0x85, 0xAF, 0x6C, 0x67, 0x67, 0x87, 0x35, 0x28, 0x80, 0xB2, 0xD1, 0x62, 0x81, 0x2B, 0xF2, 0xAC, 0x3E, 0xE3,
+0x51, 0xC7, 0x4D, 0xBC, 0xCC, 0x5B, 0x5D, 0x26, 0xAE, 0x34, 0xD5, 0xF3, 0x34, 0xC5, 0x25, 0xDA, 0xDB, 0x88, 0xA2, 0xBD, 0xCC,
+0x0B, 0x70, 0x28, 0x19, 0x4A, 0x32, 0xE2, 0x69, 0xD9, 0xE5, 0xED, 0x60, 0x79, 0x82, 0x97, 0x18, 0x21, 0x58, 0x12, 0xB7, 0x17,
+0x5D, 0xCE, 0xE5, 0x3A, 0xB2, 0x42, 0x73, 0x1A, 0x5D, 0xA6, 0x56, 0x75, 0x31, 0xD5, 0x75, 0xAB, 0xCC, 0x7F, 0x9B, 0x57, 0x0D,
+0x0F, 0x2C, 0xE5, 0xFB, 0x92, 0xE4, 0xE9, 0x29, 0x45, 0xB2, 0x02, 0x8F, 0x29, 0x3C, 0x01, 0x37, 0x35, 0x3F, 0x39, 0x7B, 0x3C,
+0x02, 0x59, 0xC2, 0x7D, 0x72, 0x98, 0x58, 0x5C, 0x8A, 0xFB, 0x7F, 0xDE, 0xFF, 0x48, 0xDF, 0x8A, 0xCA, 0xA5, 0x55, 0x3D, 0x8F,
+0x04, 0x3D, 0x5E, 0xDC, 0x5A, 0x9D, 0x04, 0xA8, 0x54, 0xA7, 0x45, 0x93, 0x03, 0x74, 0x71, 0xEF, 0x10, 0xDD, 0x37, 0xF9, 0xC9,
+0x29, 0xC8, 0x78, 0xF5, 0xE4, 0xBF, 0xFF, 0xFD, 0xF4, 0xFD, 0xC1, 0xBF, 0x31, 0xA1, 0xFE, 0xC1, 0x4E, 0xBF, 0x27, 0xDF, 0x67,
+0x17, 0x19, 0x50, 0xB6, 0xE3, 0xF0, 0x6B, 0x30, 0x19, 0x51, 0xE9, 0x68, 0x1F, 0x5F, 0x93, 0xAB, 0xB3, 0x7C, 0xCB, 0xAB, 0x23,
+0x00, 0x78, 0xB8, 0xED, 0xBB, 0x60, 0x9A, 0x14, 0xDE, 0x64, 0x6F, 0x1A, 0xBA, 0x5A, 0x18, 0x2E, 0xE6, 0x13, 0xCB, 0xE6, 0x04,
+0xE3, 0xA6, 0x01, 0x71, 0x24, 0xEB, 0xE2, 0x16, 0x23, 0x28, 0x49, 0x81, 0x19, 0xC3, 0x49, 0x94, 0xA1, 0xF7, 0xCA, 0x9B, 0x92,
+0x2D, 0xEE, 0x0C, 0x60, 0xBA, 0x49, 0xA3, 0x24, 0x71, 0xC0, 0x60, 0x17, 0x37, 0xC7, 0x6C, 0x39, 0xA0, 0x2A, 0xF3, 0x31, 0xBF,
+0x1B, 0xA6, 0x2D, 0x6F, 0x89, 0xD9, 0x72, 0x5E, 0x27, 0xA9, 0x7C, 0x0B, 0xEB, 0x01, 0x07, 0x9D, 0x2E, 0x29, 0xAC, 0xB9, 0xF5,
+0x82, 0x1F, 0x82, 0x2C, 0xAF, 0x94, 0x7B, 0xEE, 0xC9, 0x97, 0x54, 0x8C, 0xF6, 0xC5, 0x8D, 0x52, 0x4F, 0xE2, 0x3C, 0xEC, 0xEC,
+0x61, 0x5C, 0xC2, 0x59, 0x98, 0x05, 0x7A, 0xD1, 0xE2, 0x25, 0x16, 0x85, 0xC5, 0x3E, 0xC8, 0xD0, 0x30, 0x5F, 0xB5, 0xCA, 0xB1,
+0x87, 0xEE, 0xF0, 0x6C, 0x02, 0x2C, 0xEC, 0xE0, 0x5E, 0xF2, 0xAA, 0xE5, 0xBF, 0xCC, 0x06, 0x21, 0x98, 0x76, 0x46, 0x31, 0x8D,
+0x19, 0x5A, 0x39, 0x8D, 0x71, 0x58, 0x70, 0x12, 0xE4, 0x69, 0x32, 0x4D, 0xA2, 0x30, 0xF7, 0xE2, 0xD5, 0x4B, 0xC7, 0x09, 0x05,
+0x79, 0xC4, 0xAB, 0x77, 0xCD, 0x34, 0x1C, 0x0E, 0x3D, 0x3F, 0x8C, 0xA2, 0x95, 0x9B, 0x0A, 0xE3, 0x1C, 0x0C, 0x9D, 0xD0, 0x5B,
+0xBD, 0xCE, 0x33, 0x10, 0x36, 0x14, 0xA4, 0xD5, 0x39, 0x8C, 0xBA, 0x5B, 0xEA, 0x5D, 0x11, 0x2E, 0xA9, 0xE4, 0x74, 0x1F, 0x3D,
+0x54, 0x59, 0x33, 0x22, 0x1F, 0x03, 0xDE, 0xEA, 0xCD, 0x65, 0x79, 0x42, 0xE2, 0x5B, 0x96, 0xE8, 0x8F, 0x1C, 0xEC, 0x48, 0x0E,
+0x36, 0x18, 0xD8, 0xE2, 0x0E, 0x24, 0x00, 0x56, 0xB3, 0xC3, 0xAF, 0xB3, 0x20, 0xBD, 0x90, 0x69, 0x1F, 0x9A, 0x8D, 0xEF, 0x2C,
+0x0B, 0x20, 0xA1, 0x12, 0x3E, 0x96, 0x6E, 0x54, 0x3A, 0x6A, 0xB4, 0x34, 0xD4, 0xF2, 0xD2, 0xA4, 0x9B, 0xE1, 0x56, 0x97, 0x30,
+0x11, 0x72, 0x9C, 0x70, 0x0A, 0xAA, 0xB1, 0xBD, 0xC5, 0x93, 0x8B, 0x5B, 0x55, 0x7B, 0xE2, 0xD6, 0xF7, 0x1D, 0x62, 0xC1, 0x63,
+0xFC, 0xD7, 0x15, 0xE4, 0x31, 0x58, 0xD6, 0x0B, 0x50, 0x50, 0x37, 0x57, 0x12, 0x97, 0x24, 0x53, 0x20, 0x93, 0x8F, 0xB5, 0xD8,
+0x24, 0x41, 0x88, 0x4E, 0x02, 0x13, 0xBE, 0xAB, 0xA2, 0x93, 0xA6, 0xC9, 0x74, 0x86, 0xCA, 0x05, 0xFD, 0xEC, 0x19, 0x6F, 0x6E,
+0x93, 0xFB, 0xFA, 0xF4, 0x4E, 0x12, 0x5E, 0xC5, 0x9D, 0xDA, 0x59, 0x5C, 0x15, 0xE1, 0x0D, 0xBF, 0xC5, 0x9F, 0x5B, 0x2C, 0x0D,
+0x40, 0x9D, 0xC5, 0xDB, 0x6B, 0xFC, 0xD9, 0xA5, 0x5D, 0xA3, 0x1F, 0x0E, 0x5F, 0xED, 0x03, 0x2A, 0x07, 0x48, 0xC1, 0x69, 0x09,
+0xCF, 0xE4, 0x50, 0x52, 0x0A, 0x78, 0xD7, 0xDB, 0xE6, 0xBF, 0x1E, 0xB1, 0xF5, 0xBB, 0xFC, 0xE7, 0x9D, 0x3B, 0x05, 0x15, 0x42,
+0xBB, 0x6B, 0x54, 0xD0, 0xE6, 0x5C, 0x20, 0x08, 0x69, 0x8A, 0x04, 0xF1, 0x0E, 0x10, 0xC1, 0x7F, 0xB9, 0xD4, 0x33, 0x50, 0x00,
+0x31, 0xA9, 0x97, 0x26, 0xBB, 0x0E, 0x68, 0x2E, 0x6B, 0x22, 0x44, 0xCB, 0x9D, 0x7A, 0x3E, 0xAD, 0x12, 0x9B, 0xEB, 0x6D, 0xE6,
+0xF4, 0x9C, 0x16, 0xBB, 0xC3, 0x9C, 0xAD, 0x5E, 0xCF, 0x51, 0x0D, 0xF0, 0xA6, 0xD3, 0x20, 0xF6, 0xF7, 0xC6, 0x61, 0xE4, 0x37,
+0x39, 0xBA, 0x56, 0x0D, 0x43, 0xB9, 0x2D, 0x8C, 0x56, 0xF1, 0x0D, 0xF9, 0xA9, 0x78, 0x34, 0x09, 0x63, 0xF4, 0xBA, 0x74, 0xEE,
+0x01, 0x97, 0xE8, 0xF7, 0xA3, 0x1D, 0xD6, 0x5F, 0x17, 0x0F, 0x9C, 0x4F, 0xC8, 0x7B, 0xFA, 0xF4, 0x37, 0xD6, 0xDF, 0x24, 0x4B,
+0xA7, 0xC7, 0xFE, 0xF3, 0x1F, 0xF1, 0x6E, 0x17, 0xC0, 0xD9, 0xF7, 0xDF, 0xAB, 0xB2, 0x9B, 0xAD, 0x6B, 0xB1, 0x56, 0xF8, 0x43,
+0x87, 0xF9, 0xCC, 0x8B, 0x7E, 0x12, 0xFC, 0xE5, 0x15, 0x60, 0x7D, 0x40, 0x50, 0x0B, 0xC4, 0xAF, 0xDF, 0x7F, 0x08, 0x52, 0x87,
+0x6F, 0x2B, 0x7D, 0xA1, 0x95, 0xAC, 0xE9, 0x92, 0xA6, 0x81, 0x1C, 0x1B, 0xD1, 0x5A, 0x7B, 0xCC, 0x1C, 0xDC, 0x9B, 0x66, 0x4D,
+0x31, 0xA1, 0xB7, 0x9C, 0xB5, 0x2D, 0xF6, 0xF9, 0xF6, 0xA5, 0x06, 0x7A, 0x25, 0xFC, 0xD6, 0xB7, 0x2F, 0x5F, 0x79, 0xF9, 0xD8,
+0xF5, 0x06, 0x99, 0x8E, 0xA8, 0xC5, 0xC9, 0x03, 0xDA, 0x1A, 0x0D, 0x20, 0xAD, 0x91, 0x35, 0xAE, 0x3E, 0x2F, 0xEE, 0x56, 0x4B,
+0xC7, 0x2A, 0x2B, 0x97, 0x2E, 0xF8, 0x69, 0x16, 0x3C, 0x1C, 0xA7, 0x07, 0x8B, 0xBA, 0xB5, 0xA1, 0x6F, 0x6B, 0x15, 0x2A, 0x68,
+0x12, 0x2F, 0x5F, 0x92, 0x6F, 0x57, 0x35, 0x74, 0xC1, 0x08, 0xF9, 0xC8, 0x09, 0xC5, 0xB0, 0x09, 0xB9, 0x2C, 0xE0, 0x17, 0x68,
+0x4B, 0x7D, 0x9F, 0x36, 0x78, 0x4B, 0x1B, 0x7C, 0xB8, 0xA8, 0xFE, 0xC1, 0xDF, 0xB4, 0x9F, 0xBE, 0xC3, 0x42, 0x37, 0x4F, 0xC4,
+0xF8, 0x30, 0xC7, 0x46, 0xA3, 0xC7, 0x55, 0x5C, 0x53, 0xB6, 0xB9, 0xA5, 0x5A, 0x8F, 0x36, 0x39, 0xF2, 0x90, 0x18, 0x68, 0x23,
+0x11, 0xC5, 0xF7, 0x5B, 0x92, 0x28, 0x99, 0xDB, 0x52, 0x6C, 0x36, 0x48, 0xB4, 0xF4, 0xB0, 0x5C, 0x8B, 0x94, 0x3B, 0xD8, 0x17,
+0x1B, 0x29, 0x8B, 0x3B, 0xAB, 0xBC, 0xF5, 0x52, 0xE9, 0xAE, 0x4D, 0xE2, 0xC5, 0x0E, 0x67, 0x06, 0xBB, 0x83, 0x83, 0x51, 0x1F,
+0x8B, 0x2B, 0x73, 0x24, 0xE4, 0x8F, 0xE6, 0x38, 0x82, 0xE1, 0x11, 0xCA, 0x41, 0x91, 0x81, 0xB0, 0x9B, 0xF4, 0x97, 0x85, 0x5E,
+0x70, 0xA3, 0x4E, 0xCC, 0xB7, 0xD7, 0x6A, 0xD8, 0x53, 0x7C, 0xD0, 0xE7, 0x10, 0xC3, 0xE5, 0x36, 0x0F, 0x84, 0x9C, 0x6C, 0x05,
+0x80, 0xA6, 0x36, 0x4B, 0x4E, 0x05, 0xCD, 0xB2, 0x10, 0xCB, 0x4D, 0x58, 0xDE, 0x34, 0xC3, 0xEC, 0x09, 0x5E, 0xAE, 0x15, 0x90,
+0x72, 0x95, 0xBE, 0x69, 0xB7, 0x70, 0xD9, 0xB9, 0xF2, 0xF6, 0x3C, 0xE0, 0xC7, 0x2D, 0x05, 0xBC, 0x5D, 0x80, 0x96, 0x17, 0xE3,
+0x46, 0x81, 0x02, 0x3D, 0x2A, 0x4E, 0xB9, 0x07, 0xE4, 0xCA, 0xEE, 0x75, 0xF9, 0x29, 0xC0, 0x47, 0x9B, 0x2D, 0x0B, 0x42, 0xC5,
+0xC0, 0x65, 0x30, 0xAA, 0xD5, 0xBC, 0x8E, 0xF2, 0x6A, 0xCD, 0xCB, 0x2E, 0xE2, 0xA1, 0x5A, 0xC9, 0xB2, 0x51, 0x90, 0x0F, 0xC7,
+0xE2, 0xD4, 0x05, 0x17, 0xCC, 0x3C, 0xBD, 0x50, 0x72, 0x03, 0xCB, 0x86, 0x29, 0xFC, 0x20, 0x1D, 0x7B, 0x46, 0x69, 0x1E, 0x11,
+0xBC, 0xD9, 0xE8, 0x62, 0xF0, 0x3E, 0x3A, 0xF5, 0xA5, 0x59, 0x72, 0x4B, 0x42, 0xBA, 0xC9, 0x09, 0x22, 0x91, 0x93, 0xF4, 0xD5,
+0x9A, 0xA2, 0x47, 0xEE, 0x08, 0x28, 0x5C, 0xAA, 0x08, 0x22, 0xC2, 0x4E, 0xE7, 0x21, 0x90, 0x05, 0x31, 0x50, 0x9C, 0x0D, 0x3D,
+0x0C, 0x4F, 0xD7, 0x11, 0x6A, 0xA3, 0xAB, 0x5C, 0x40, 0xD1, 0x4D, 0x4B, 0xD9, 0x1D, 0x56, 0xA9, 0x5B, 0x6A, 0x47, 0xF4, 0xF8,
+0x08, 0x98, 0xE5, 0x3C, 0x49, 0xDB, 0x6B, 0xB2, 0x48, 0xC5, 0xE0, 0xB8, 0xA9, 0x21, 0x81, 0x38, 0xAC, 0x73, 0x16, 0xD8, 0xD0,
+0x38, 0x3B, 0xC5, 0x49, 0x11, 0xEF, 0xDF, 0x72, 0x34, 0x42, 0xAC, 0x33, 0x0C, 0x7D, 0x01, 0xBD, 0xF0, 0xDC, 0x83, 0x7E, 0xC2,
+0x80, 0x09, 0xB6, 0xB3, 0xFB, 0x15, 0xAC, 0x1D, 0xC4, 0xE4, 0xCE, 0xD2, 0xA8, 0x86, 0x54, 0xFA, 0x8C, 0x0B, 0xE6, 0x45, 0xE4,
+0x5D, 0xD5, 0xCA, 0xA0, 0xE6, 0x48, 0x5D, 0x5E, 0x0C, 0xE9, 0x52, 0xB8, 0x31, 0x2F, 0xB5, 0xAA, 0x3C, 0x6A, 0x5B, 0x56, 0x8B,
+0x44, 0xD2, 0xA0, 0xAD, 0x4E, 0x2A, 0x4B, 0x8D, 0x42, 0x7D, 0xC1, 0xEF, 0x5D, 0x7C, 0xCA, 0xBD, 0xC4, 0x4D, 0xAC, 0xB0, 0x4D,
+0xB1, 0x4C, 0x6D, 0x06, 0x7A, 0x09, 0xFE, 0x01, 0x96, 0xA8, 0x36, 0x8A, 0x74, 0xA5, 0xFB, 0x25, 0xC9, 0xD5, 0xA8, 0x54, 0x76,
+0x52, 0x04, 0x9D, 0xE6, 0x5F, 0x3C, 0x3F, 0x87, 0xD7, 0x38, 0x9A, 0xB4, 0x92, 0x6E, 0x96, 0x80, 0x96, 0x93, 0xDD, 0x4E, 0xBD,
+0x82, 0x08, 0xC8, 0x4E, 0xC1, 0x1F, 0x82, 0x3B, 0x06, 0x86, 0xC2, 0xA2, 0xC6, 0x99, 0x44, 0x8C, 0x8A, 0x8F, 0xAE, 0xEB, 0x6A,
+0x78, 0x8F, 0x84, 0x60, 0xCD, 0xE2, 0x6C, 0x1C, 0x8E, 0xF2, 0xE6, 0x25, 0xB3, 0x35, 0x86, 0xDC, 0x5C, 0x02, 0x01, 0x81, 0x67,
+0x18, 0xD5, 0xD6, 0xEC, 0xB5, 0x4D, 0x6F, 0x08, 0x00, 0xD5, 0x74, 0x02, 0x16, 0xDA, 0x36, 0x7A, 0x7E, 0x10, 0x25, 0x03, 0xF8,
+0x80, 0x07, 0xF0, 0x9F, 0xC2, 0xCF, 0xE6, 0xDA, 0xC7, 0x7F, 0x1D, 0xBC, 0x79, 0xED, 0x72, 0x6F, 0x51, 0x38, 0xBA, 0x68, 0x62,
+0x11, 0x3C, 0x7A, 0x1F, 0x45, 0x6D, 0xB6, 0xDE, 0x3A, 0x6A, 0xAF, 0x5D, 0xD2, 0x6E, 0x3E, 0x58, 0x63, 0x50, 0x47, 0x14, 0xF2,
+0x80, 0x86, 0x2E, 0x89, 0x06, 0xBB, 0x5A, 0x53, 0xE6, 0x11, 0xBA, 0x9F, 0xE8, 0x42, 0x69, 0x8E, 0xFB, 0x85, 0x78, 0x6C, 0xF2,
+0x49, 0x95, 0x7E, 0x0B, 0x01, 0x6E, 0x36, 0x46, 0xB0, 0xBC, 0x6F, 0xB4, 0x89, 0x14, 0xB0, 0x01, 0xAC, 0x22, 0xB7, 0x40, 0x4C,
+0x67, 0xD3, 0x28, 0xF1, 0x7C, 0xC0, 0x71, 0xB9, 0x06, 0x8B, 0xFE, 0x71, 0xE2, 0x03, 0x79, 0x6F, 0xDF, 0x1C, 0x1C, 0x36, 0x70,
+0x17, 0xDA, 0xBF, 0xD8, 0x52, 0xE4, 0xD0, 0xF8, 0xB0, 0xC9, 0x2F, 0xC7, 0x37, 0x00, 0x45, 0x1F, 0x80, 0x2D, 0xE2, 0xBC, 0xF0,
+0xC2, 0x88, 0x67, 0xAD, 0x45, 0x31, 0xE3, 0xB7, 0x36, 0x0A, 0x9A, 0xF0, 0x25, 0x4F, 0x46, 0xEB, 0xB4, 0xB9, 0xB3, 0x89, 0xC4,
+0x58, 0xC9, 0xA9, 0x90, 0xDD, 0x66, 0x00, 0x1F, 0xE6, 0x21, 0xE6, 0x34, 0x1B, 0xA8, 0x61, 0xCD, 0x07, 0xAB, 0x17, 0x28, 0xE8,
+0x8A, 0x73, 0x46, 0x45, 0x05, 0x57, 0x35, 0x23, 0xA5, 0xD0, 0xD5, 0xA3, 0x30, 0xF6, 0x71, 0x7A, 0xF5, 0xF5, 0xE1, 0x50, 0xAF,
+0xB1, 0x0D, 0xB9, 0xE7, 0xE4, 0x73, 0x99, 0x42, 0x3C, 0xF3, 0x24, 0x1C, 0x17, 0x27, 0x28, 0x0E, 0xDB, 0xD5, 0x89, 0xA2, 0xAC,
+0x62, 0x96, 0xA8, 0x99, 0xFA, 0x82, 0xEA, 0xE5, 0x93, 0x28, 0x16, 0xC3, 0x03, 0x12, 0xE5, 0xBD, 0x1F, 0xA7, 0xCD, 0xA3, 0x00,
+0x0C, 0x5E, 0x2F, 0x3F, 0xD7, 0xD8, 0x36, 0x92, 0xBE, 0xCD, 0x94, 0xC3, 0xA3, 0x85, 0xE0, 0x95, 0xB0, 0x40, 0x3D, 0x3C, 0xE1,
+0x81, 0x4A, 0x5D, 0xDD, 0x04, 0x0A, 0x9A, 0xE0, 0x0F, 0x9D, 0x75, 0xB0, 0x3F, 0x16, 0x4D, 0x3B, 0xB8, 0xA8, 0x66, 0x4D, 0x94,
+0xCE, 0x42, 0x22, 0xE0, 0xD5, 0xE2, 0xE9, 0x12, 0xC7, 0x5B, 0x4D, 0x7F, 0x62, 0x10, 0x85, 0x29, 0xC2, 0x63, 0x2F, 0xF6, 0xA3,
+0x40, 0x83, 0x12, 0x56, 0x67, 0x21, 0x4B, 0x5C, 0x14, 0x59, 0x61, 0xB8, 0x55, 0xFA, 0x95, 0xB7, 0x4D, 0x39, 0x7C, 0x71, 0x40,
+0x40, 0x01, 0xFB, 0xE0, 0x90, 0x8E, 0x0F, 0xFC, 0x50, 0x68, 0xE9, 0x32, 0x72, 0xC5, 0x2D, 0x82, 0x13, 0xEC, 0x52, 0xD2, 0x4C,
+0x71, 0x31, 0x73, 0x3E, 0xA2, 0xBF, 0x59, 0x7D, 0xE6, 0x33, 0xB8, 0xFE, 0x79, 0xDF, 0xCB, 0xD5, 0x57, 0x50, 0xF3, 0xA5, 0x8F,
+0xD4, 0xAB, 0xE2, 0x63, 0x12, 0x97, 0x6B, 0x7D, 0xF3, 0x23, 0x7C, 0x45, 0x2E, 0x9A, 0x34, 0xCB, 0xBD, 0x5D, 0x53, 0xAA, 0xE5,
+0xF5, 0x02, 0x5B, 0xEC, 0xD1, 0x60, 0x17, 0x3B, 0xB2, 0xA0, 0x08, 0x7B, 0xF2, 0x51, 0x17, 0xDE, 0x6E, 0xAF, 0x69, 0x56, 0xBA,
+0xE8, 0x1E, 0x7E, 0x66, 0xEA, 0xA9, 0x76, 0xD9, 0x74, 0xD3, 0x66, 0x62, 0xF0, 0xAE, 0xDB, 0xD3, 0x36, 0x7B, 0x97, 0x37, 0x32,
+0xFC, 0x20, 0x7A, 0x3C, 0xDA, 0xB1, 0xDB, 0x1A, 0xCA, 0x14, 0x60, 0xB5, 0x96, 0xC5, 0xC7, 0xA3, 0x3A, 0x33, 0xA2, 0x4C, 0x24,
+0x6D, 0x4E, 0xE0, 0x6A, 0xE8, 0xE0, 0x27, 0xDE, 0x9A, 0x26, 0x1D, 0xBB, 0x6C, 0xA3, 0xCA, 0x4D, 0x52, 0x91, 0x5D, 0xBD, 0x10,
+0x36, 0x98, 0x03, 0x31, 0x9D, 0x1A, 0x8E, 0x03, 0x04, 0x73, 0xF1, 0xB9, 0x29, 0x85, 0x46, 0x7C, 0xD4, 0xD4, 0x96, 0x50, 0xA2,
+0x97, 0x6B, 0xC9, 0x89, 0x16, 0x3D, 0x34, 0xA3, 0x00, 0x2B, 0x74, 0xB2, 0x72, 0x9F, 0xA0, 0x2C, 0xC7, 0xE3, 0xC0, 0x61, 0x31,
+0xD6, 0x70, 0x1A, 0xAD, 0xEA, 0x44, 0xD1, 0x78, 0x96, 0xCC, 0x30, 0xAD, 0xDD, 0xAF, 0xB3, 0x04, 0x93, 0x2D, 0x37, 0x9D, 0x16,
+0x9D, 0x1D, 0xA3, 0xD3, 0x84, 0x62, 0x2D, 0x12, 0xF2, 0x83, 0xBC, 0x72, 0x37, 0xA9, 0xAB, 0x6D, 0x66, 0x89, 0x5D, 0xA5, 0xCC,
+0x6D, 0x28, 0x7D, 0x29, 0xE8, 0x22, 0x25, 0xCA, 0xA9, 0x11, 0x66, 0x51, 0x76, 0xFA, 0x2E, 0x38, 0x0E, 0xCE, 0xA1, 0x95, 0xDD,
+0xFF, 0xF9, 0xF8, 0x3F, 0xED, 0x4F, 0xD9, 0xD1, 0x9D, 0xE6, 0xA7, 0xEC, 0xEF, 0xF0, 0xE3, 0xEF, 0xE2, 0xB1, 0xF5, 0xF7, 0xDB,
+0x5D, 0xD1, 0x6A, 0x09, 0xED, 0xE2, 0xD6, 0x86, 0x6C, 0x8B, 0x85, 0x7C, 0x83, 0xA1, 0xF5, 0x24, 0xD4, 0xB3, 0x4C, 0xA0, 0xE6,
+0x60, 0x35, 0xDD, 0xF8, 0xD6, 0xD8, 0x79, 0xD3, 0xB4, 0x04, 0x3F, 0x64, 0xAB, 0xA9, 0x09, 0x73, 0x8F, 0xCE, 0x54, 0x11, 0x20,
+0x96, 0xB8, 0xD9, 0x24, 0x85, 0xB2, 0x56, 0x46, 0x2C, 0xFB, 0x7C, 0x9A, 0x2D, 0x01, 0x28, 0xC8, 0x92, 0x50, 0x32, 0x5A, 0x0E,
+0xEF, 0x43, 0x25, 0x84, 0x0D, 0xC7, 0xB1, 0x0A, 0x63, 0xE0, 0x72, 0x6D, 0x1E, 0x24, 0x1F, 0xD4, 0x35, 0x10, 0xF0, 0x5D, 0x54,
+0x28, 0xDA, 0x71, 0x55, 0xCF, 0x22, 0x35, 0x6E, 0xE7, 0x71, 0x47, 0x6D, 0x99, 0x5E, 0x8F, 0x31, 0xE6, 0x8E, 0xEB, 0x3C, 0x9E,
+0x68, 0x41, 0x82, 0xF5, 0xEC, 0x30, 0x81, 0x4A, 0x9C, 0x50, 0x1F, 0x57, 0x61, 0xC2, 0xE1, 0x2F, 0x5A, 0xEB, 0x53, 0x25, 0xEC,
+0xCD, 0x8F, 0x4F, 0x3A, 0xBF, 0x78, 0x9D, 0xDF, 0x8E, 0x2E, 0x37, 0xDA, 0x57, 0xAD, 0xE6, 0xC7, 0x3B, 0x9D, 0xA3, 0xC7, 0xCD,
+0xC7, 0x5B, 0x1F, 0x7B, 0x9D, 0x87, 0x47, 0xFF, 0xE9, 0xC3, 0x9F, 0xBB, 0x47, 0x2D, 0x78, 0xC6, 0x17, 0x9B, 0x47, 0xF4, 0xB6,
+0xF5, 0xB8, 0xFC, 0x0C, 0x6F, 0x0C, 0x2C, 0x08, 0xD0, 0x7E, 0xD5, 0xEC, 0x3D, 0xFE, 0xD8, 0x97, 0x58, 0xD6, 0x8F, 0x5A, 0x9F,
+0x5C, 0xC4, 0xDB, 0x07, 0x84, 0xFF, 0xD9, 0x84, 0x07, 0x78, 0x79, 0xEF, 0x08, 0xDE, 0x7C, 0xEA, 0x1A, 0xD5, 0xC1, 0x9F, 0x75,
+0x5E, 0x6B, 0xEB, 0xF1, 0xD7, 0xC0, 0xD1, 0x7A, 0x8C, 0xC3, 0x96, 0xB7, 0x5A, 0x4E, 0x61, 0xAA, 0xCF, 0x65, 0x3C, 0x0A, 0x67,
+0x9F, 0x52, 0x6D, 0x8A, 0xD1, 0x18, 0x47, 0xA9, 0xD8, 0x4F, 0x1D, 0xCA, 0x01, 0xA5, 0xBA, 0x93, 0x93, 0x25, 0x7E, 0x4A, 0x0B,
+0x8D, 0x40, 0x40, 0xAD, 0xE2, 0x73, 0x19, 0x9F, 0xE8, 0x73, 0x53, 0x59, 0x88, 0xED, 0xEC, 0x79, 0x1A, 0xFB, 0x07, 0xB1, 0x5F,
+0x6C, 0xEF, 0xC8, 0xC7, 0xB7, 0x3A, 0x2D, 0xD1, 0x0D, 0xC8, 0x02, 0xE4, 0x88, 0x7A, 0xEA, 0x1C, 0x5D, 0xF6, 0xDA, 0xF7, 0xFA,
+0x57, 0xDA, 0xF7, 0x25, 0x18, 0x83, 0xF5, 0xD5, 0xB1, 0xA6, 0x08, 0x2B, 0xFD, 0x9A, 0x0C, 0x32, 0xB0, 0x5A, 0xD9, 0x64, 0x6C,
+0xBC, 0xB7, 0x0A, 0x0D, 0x9E, 0xCD, 0x06, 0x7C, 0xB9, 0xF6, 0x0A, 0x67, 0x4A, 0x1A, 0x1A, 0xC0, 0x26, 0xB2, 0x0F, 0x85, 0x7E,
+0x6D, 0xFE, 0xDA, 0x66, 0xC3, 0x81, 0x78, 0x87, 0x04, 0xFD, 0x2A, 0xC8, 0x64, 0xBB, 0xB0, 0xA6, 0x83, 0x77, 0xB7, 0x5D, 0xEF,
+0x8B, 0x77, 0xDE, 0xBC, 0x5C, 0x9B, 0xA5, 0x11, 0x2C, 0x9D, 0xBA, 0x22, 0x88, 0x79, 0x1A, 0x0E, 0x4F, 0x82, 0xF4, 0xF1, 0xAF,
+0x3B, 0x0D, 0x5C, 0x96, 0xC4, 0x68, 0xAC, 0xBE, 0x7F, 0xF7, 0x72, 0x2F, 0x99, 0xC0, 0x3C, 0x8E, 0x86, 0xE5, 0xAF, 0xAD, 0x76,
+0xB1, 0xDE, 0xFA, 0xE7, 0x73, 0x5C, 0x6E, 0x65, 0xB3, 0xE1, 0x90, 0xE2, 0x07, 0x55, 0x17, 0x36, 0xD1, 0x40, 0xD4, 0xB6, 0x51,
+0xE4, 0x85, 0x1D, 0x3B, 0x64, 0xB8, 0xBB, 0x53, 0xEF, 0x02, 0xD7, 0x41, 0xAE, 0x7C, 0xEF, 0xF2, 0xA9, 0xAB, 0x99, 0x21, 0xB5,
+0x99, 0x7B, 0x32, 0xE0, 0x21, 0xDC, 0xB7, 0x68, 0x4B, 0x01, 0x7A, 0x6D, 0xD0, 0x94, 0x90, 0xC8, 0x82, 0xF6, 0x1A, 0xCD, 0x34,
+0x7A, 0x75, 0xE7, 0xE3, 0xB4, 0x2D, 0xEE, 0x64, 0x14, 0x13, 0xBB, 0xAC, 0x3C, 0x89, 0x02, 0x97, 0x5E, 0x34, 0x3F, 0x8B, 0x78,
+0x49, 0x6E, 0x82, 0x00, 0xBB, 0x71, 0x51, 0xB6, 0xC5, 0x6E, 0x5F, 0xF2, 0x72, 0x57, 0xAC, 0x03, 0xBF, 0x09, 0xF4, 0xEA, 0x33,
+0xAF, 0xF4, 0xE3, 0x11, 0xF7, 0xB5, 0x92, 0x49, 0x22, 0x54, 0x96, 0xF6, 0x7A, 0xBB, 0x08, 0xB6, 0x2D, 0x77, 0xC7, 0xE1, 0x68,
+0xFF, 0xE6, 0x3D, 0xA2, 0xC7, 0x22, 0x68, 0x67, 0x0E, 0x0F, 0xF2, 0x64, 0xFA, 0x16, 0x0F, 0x85, 0x77, 0x0F, 0x28, 0x96, 0xB6,
+0x5B, 0xDB, 0x51, 0xF0, 0xBE, 0xF1, 0x98, 0x12, 0xD2, 0xEE, 0xE0, 0xAE, 0x68, 0xDB, 0x8F, 0xD2, 0xEF, 0x27, 0xDE, 0xF9, 0x3B,
+0xD2, 0xA1, 0xD9, 0x4E, 0xBF, 0xF7, 0xFD, 0x08, 0xEC, 0x8B, 0x0C, 0x8F, 0xB0, 0xEF, 0xBC, 0x40, 0xE9, 0xFB, 0x5E, 0x18, 0x28,
+0x3F, 0x40, 0x73, 0xC4, 0x1B, 0x90, 0xD5, 0x7F, 0x9F, 0x04, 0x17, 0x24, 0x0D, 0x85, 0x2D, 0x46, 0xF1, 0xDB, 0x37, 0x97, 0x83,
+0x09, 0x71, 0xEB, 0x1B, 0x75, 0xFF, 0xFB, 0x7F, 0xB2, 0xDF, 0x45, 0x02, 0x6E, 0x37, 0x0B, 0x42, 0xA8, 0x17, 0x9B, 0x8D, 0x8F,
+0x75, 0xC9, 0x07, 0x8E, 0x1A, 0x2D, 0x57, 0xFC, 0x6E, 0x8A, 0x85, 0xD2, 0xED, 0x66, 0xE1, 0x0D, 0x57, 0xB1, 0xD1, 0x00, 0x75,
+0x31, 0x0D, 0x3C, 0x74, 0x51, 0x82, 0x38, 0xC4, 0x14, 0xDE, 0xD9, 0x90, 0x4C, 0x40, 0x4E, 0x8B, 0xE8, 0xBB, 0xB2, 0xDC, 0x35,
+0x31, 0x3A, 0x2F, 0xC0, 0x43, 0x5B, 0x6C, 0xA3, 0xD7, 0x6B, 0x8B, 0x6B, 0x3F, 0x0C, 0x5E, 0xE1, 0x5A, 0x0E, 0xC9, 0xE4, 0xC6,
+0x7B, 0x29, 0xEC, 0x9E, 0x7F, 0x55, 0xB6, 0x1B, 0x3E, 0x11, 0xC7, 0xC7, 0xE1, 0xF1, 0x38, 0xC2, 0x10, 0x60, 0x3B, 0x2E, 0x01,
+0xDE, 0x28, 0x8E, 0x97, 0x86, 0x74, 0x0A, 0x99, 0x1F, 0x2E, 0x35, 0xB3, 0x4B, 0x53, 0x24, 0xF1, 0xD6, 0xBD, 0xE9, 0xB9, 0xB3,
+0xDB, 0x10, 0x4B, 0x4B, 0xC9, 0x62, 0x8D, 0x15, 0x66, 0x88, 0xF3, 0x37, 0x63, 0xC7, 0x9E, 0xF5, 0x30, 0xC2, 0x57, 0xE3, 0x4A,
+0x9C, 0xDE, 0x80, 0x25, 0x46, 0xE4, 0xFC, 0x75, 0x39, 0x02, 0x45, 0x57, 0x66, 0x0A, 0x94, 0xF9, 0xBD, 0x18, 0x82, 0x6A, 0x69,
+0x55, 0x96, 0x28, 0x86, 0xA0, 0x75, 0x5C, 0x8D, 0x2C, 0x94, 0xA7, 0x55, 0xDB, 0xAC, 0x64, 0x56, 0x50, 0x7C, 0xE1, 0x9A, 0x25,
+0x90, 0x90, 0xCF, 0xE4, 0x36, 0x5B, 0xB4, 0xC5, 0xCC, 0xD9, 0xB8, 0x62, 0xF5, 0x92, 0x4A, 0x30, 0x8B, 0x97, 0x2D, 0xFB, 0x32,
+0x0E, 0xFB, 0x92, 0xC2, 0x82, 0x08, 0xAD, 0xA7, 0x72, 0xE1, 0xC2, 0x6A, 0xB2, 0x14, 0x28, 0xAC, 0x89, 0x72, 0xB1, 0xB2, 0x15,
+0x41, 0x85, 0x85, 0x02, 0xC0, 0x65, 0xBF, 0x50, 0x45, 0x16, 0x51, 0xB3, 0xF0, 0x77, 0x94, 0x80, 0xB9, 0x04, 0xEC, 0xE5, 0xB3,
+0x9B, 0xAD, 0x4C, 0x26, 0x3C, 0x38, 0x4B, 0xA3, 0x1C, 0x44, 0xB3, 0x54, 0x61, 0x14, 0xDB, 0x8A, 0xC9, 0x0C, 0xE8, 0xD6, 0x75,
+0xD4, 0x3E, 0x34, 0xE2, 0x05, 0xD6, 0xDD, 0x66, 0x9B, 0xBD, 0x9E, 0x81, 0xDC, 0xD4, 0x16, 0xCB, 0xD3, 0x5C, 0x2A, 0x67, 0xA3,
+0x7B, 0x21, 0xEA, 0xF9, 0xB4, 0x9B, 0x0A, 0x65, 0x4E, 0x13, 0x4A, 0xAB, 0xD5, 0xDA, 0x7A, 0xEC, 0xEB, 0x60, 0x3B, 0xA7, 0x61,
+0xE0, 0x5E, 0xA7, 0xFF, 0xB0, 0xD8, 0xFC, 0x2E, 0xB4, 0x23, 0x9E, 0xCF, 0x89, 0x42, 0x8B, 0xCC, 0xE1, 0x82, 0x79, 0x46, 0xC7,
+0x52, 0x07, 0xCF, 0x76, 0x8B, 0xB5, 0x04, 0xC2, 0x90, 0x2A, 0xC6, 0x8B, 0x3A, 0x18, 0x87, 0xA6, 0xBD, 0xCB, 0xCF, 0xF8, 0xCB,
+0x95, 0x22, 0x6D, 0xD0, 0xD8, 0x20, 0xC1, 0xC6, 0xA0, 0x53, 0x74, 0x85, 0x0F, 0xDA, 0x7E, 0xC8, 0xA7, 0x70, 0x45, 0x1B, 0x68,
+0x14, 0xA4, 0x70, 0x00, 0x1B, 0x2D, 0x29, 0xA1, 0x31, 0x3C, 0xC5, 0xCA, 0x9C, 0xB0, 0x47, 0xDF, 0x59, 0x68, 0x55, 0x4E, 0xD5,
+0x3A, 0x02, 0x95, 0x6F, 0xF5, 0xAA, 0xB5, 0x80, 0x90, 0x25, 0xF8, 0xCA, 0x6A, 0x9B, 0x59, 0x62, 0x2D, 0x33, 0x6A, 0xD3, 0x0E,
+0xFD, 0xCC, 0xAB, 0x85, 0xDB, 0x45, 0x04, 0xA6, 0x6E, 0x83, 0x32, 0xF6, 0xE6, 0xD5, 0x79, 0xA3, 0x79, 0x58, 0xB8, 0x60, 0x3D,
+0x55, 0xB0, 0x7B, 0xF4, 0xC1, 0x18, 0xBD, 0xC5, 0x29, 0x1F, 0x1B, 0xA2, 0x08, 0xD6, 0x3A, 0x0A, 0xCF, 0x5E, 0x71, 0xD6, 0x47,
+0x47, 0x51, 0x3E, 0xC8, 0xB3, 0x10, 0xCF, 0x4F, 0xAA, 0x40, 0x85, 0x12, 0xE3, 0xFC, 0xCC, 0x72, 0x04, 0x89, 0x22, 0xAD, 0xAA,
+0x8B, 0x5A, 0xF7, 0x7F, 0x57, 0xE3, 0xEB, 0x39, 0x93, 0x1A, 0xED, 0x3A, 0xFF, 0x7A, 0x09, 0xE1, 0xB2, 0x6A, 0x47, 0xF9, 0x96,
+0xF4, 0xF2, 0xF2, 0xE0, 0xCD, 0x5C, 0xB9, 0x12, 0x62, 0xC5, 0x45, 0xD8, 0xB8, 0x90, 0x01, 0x33, 0x5E, 0xEC, 0x61, 0xB8, 0x78,
+0x60, 0x1C, 0xE2, 0x69, 0x6D, 0x5F, 0x95, 0x2B, 0xF9, 0x65, 0xF9, 0x1A, 0xF4, 0xFC, 0xD1, 0x95, 0x0A, 0x7E, 0x41, 0xEC, 0x7C,
+0xF6, 0xB4, 0x7C, 0x01, 0x1C, 0x35, 0x2E, 0x13, 0x3E, 0x76, 0x99, 0xD5, 0x61, 0xC2, 0xAE, 0xCC, 0x91, 0xA0, 0x4A, 0x2E, 0xE4,
+0xE9, 0xE1, 0x2F, 0xA5, 0x76, 0x92, 0x23, 0x62, 0xC5, 0x96, 0xCA, 0xB4, 0xF0, 0xE5, 0xB6, 0xF2, 0xF3, 0x41, 0xF6, 0xD6, 0x8A,
+0x6F, 0xD5, 0xF6, 0x16, 0x9E, 0x90, 0x72, 0x8B, 0xAB, 0x7E, 0x10, 0x7B, 0xBB, 0x6B, 0x9A, 0x50, 0x6A, 0xB9, 0xF4, 0xF0, 0xE8,
+0xE5, 0x8B, 0x73, 0x43, 0xCB, 0xB0, 0x80, 0x8E, 0x8B, 0x58, 0x8A, 0x72, 0xE2, 0x6F, 0x21, 0xF5, 0xD0, 0x3E, 0x45, 0x7E, 0x01,
+0x01, 0xE4, 0x4F, 0xBD, 0x34, 0x0B, 0x5E, 0xC2, 0x4A, 0xB9, 0x16, 0x41, 0x8B, 0x5A, 0x1E, 0x5D, 0x3C, 0x95, 0xA7, 0x9A, 0xE9,
+0xD8, 0x89, 0x4D, 0xE1, 0xA9, 0xB0, 0xA0, 0x39, 0x23, 0x51, 0x4D, 0x59, 0xFC, 0x8C, 0x8B, 0xD0, 0xA2, 0x43, 0xDE, 0x21, 0x46,
+0x58, 0x94, 0x79, 0xD4, 0x46, 0x82, 0x14, 0x3E, 0xA2, 0x92, 0x8A, 0x2F, 0x81, 0x7F, 0x45, 0x12, 0x8A, 0x76, 0xD5, 0xD0, 0x80,
+0xD1, 0x0D, 0x78, 0x54, 0x84, 0xB2, 0x4B, 0xD0, 0x6D, 0x91, 0xF1, 0x30, 0x98, 0x1B, 0x64, 0x65, 0xA1, 0x0E, 0xB5, 0x5E, 0x43,
+0xDA, 0xEB, 0x4D, 0x8D, 0xC2, 0xDA, 0xB0, 0x2B, 0x8C, 0x91, 0xDD, 0x34, 0xFD, 0x6D, 0x7F, 0x06, 0x03, 0xFE, 0x52, 0x6C, 0x13,
+0x95, 0x19, 0x42, 0xBB, 0x62, 0xE5, 0x97, 0x22, 0x4A, 0x62, 0x90, 0x24, 0x39, 0x2C, 0xD1, 0xBC, 0xA9, 0x4B, 0x5F, 0x9B, 0xB5,
+0xB1, 0x8A, 0xA5, 0x0C, 0x39, 0x8D, 0x16, 0xCD, 0xF5, 0x15, 0xB4, 0x2E, 0x69, 0x05, 0x65, 0x07, 0xD4, 0xA2, 0x33, 0x93, 0x8E,
+0x58, 0xCF, 0x68, 0xC9, 0x8E, 0x91, 0x5D, 0x22, 0xCF, 0x02, 0x51, 0x08, 0xF8, 0x92, 0xA1, 0xB3, 0xE6, 0xF6, 0x02, 0x8F, 0x71,
+0x5C, 0x25, 0x7C, 0xD6, 0x2C, 0x8F, 0xAD, 0x3D, 0xC8, 0x53, 0x1E, 0x33, 0x89, 0x84, 0x5C, 0x6D, 0xDD, 0xBE, 0xE4, 0x48, 0x31,
+0x4A, 0x58, 0xEC, 0x6E, 0xD1, 0x6D, 0x4C, 0x00, 0x03, 0xB8, 0xF7, 0x44, 0xB8, 0x8D, 0xD8, 0x08, 0xA5, 0x16, 0x1F, 0x37, 0x79,
+0x70, 0x09, 0xFC, 0x72, 0x29, 0x29, 0xCE, 0x8E, 0xC4, 0xAB, 0xCE, 0xCE, 0x63, 0x0C, 0x0F, 0x98, 0xED, 0x2F, 0x31, 0x53, 0x8A,
+0x1E, 0xC6, 0x50, 0xC8, 0x21, 0x6E, 0x2E, 0xD3, 0x67, 0x33, 0x6C, 0x82, 0xE3, 0xDB, 0x51, 0x18, 0xC5, 0xEA, 0xD2, 0x44, 0x88,
+0x8E, 0xAD, 0x4E, 0xBF, 0xA5, 0x1B, 0xAF, 0x0A, 0xF1, 0x47, 0x03, 0xF4, 0x08, 0x23, 0x91, 0x88, 0x52, 0xCD, 0x62, 0xB4, 0x50,
+0x33, 0x9D, 0x65, 0xE3, 0x26, 0x07, 0x6C, 0x19, 0xF1, 0x58, 0x05, 0x48, 0x96, 0x80, 0xEC, 0x36, 0xBD, 0x36, 0xE3, 0x1E, 0x48,
+0x8F, 0x48, 0x75, 0x31, 0x3B, 0x09, 0xA8, 0x0E, 0x90, 0x2A, 0x2F, 0x0D, 0x9A, 0x03, 0x7A, 0x89, 0x82, 0x55, 0x15, 0xAB, 0x71,
+0x48, 0xEA, 0x4F, 0xEC, 0xBA, 0xA2, 0x90, 0x64, 0xC2, 0x43, 0x6E, 0xEA, 0x47, 0xA5, 0x16, 0x64, 0xF0, 0xE5, 0x22, 0xD5, 0x30,
+0x4F, 0x6F, 0x2D, 0xD6, 0x0C, 0xA5, 0x10, 0xCF, 0x3F, 0xB7, 0x62, 0xB0, 0xB2, 0x84, 0x5C, 0x95, 0xB6, 0x0F, 0xAB, 0x2A, 0x08,
+0x6B, 0xC6, 0x1F, 0xA1, 0x26, 0xAC, 0x15, 0xAC, 0xAE, 0x2A, 0x8A, 0xD3, 0x9F, 0x4B, 0xAB, 0x0B, 0x19, 0xCC, 0xBC, 0x5A, 0x18,
+0xB6, 0x39, 0xEC, 0x57, 0x19, 0xD1, 0x5A, 0x7D, 0x6A, 0x82, 0x97, 0xEF, 0x60, 0xF6, 0xEE, 0x76, 0x19, 0xA5, 0x31, 0xA3, 0x33,
+0x87, 0xE2, 0xF5, 0x5A, 0x55, 0x9A, 0xCC, 0x01, 0x65, 0xE7, 0xDE, 0x4A, 0x23, 0x42, 0xB5, 0xBD, 0x6A, 0xD4, 0x3C, 0x7B, 0xF3,
+0x4A, 0x44, 0xDF, 0xEC, 0x27, 0x9E, 0x1F, 0xF8, 0x4E, 0x59, 0xE0, 0xB5, 0xC8, 0x09, 0x3D, 0x8E, 0x57, 0x7B, 0xFD, 0x64, 0x1A,
+0xFE, 0x18, 0x5C, 0x94, 0xDF, 0x16, 0xBC, 0xD1, 0x5E, 0xCA, 0x6C, 0x21, 0xA5, 0xD7, 0x7A, 0x22, 0x91, 0x32, 0x72, 0x33, 0xC2,
+0xE2, 0x63, 0xA3, 0x2B, 0xFC, 0x98, 0xD0, 0xD7, 0x8D, 0xAE, 0x72, 0xE1, 0x35, 0x8E, 0x54, 0xB0, 0x52, 0x96, 0x0E, 0x75, 0x11,
+0x40, 0x77, 0x1F, 0x97, 0xE5, 0x97, 0x98, 0x95, 0x95, 0x5C, 0x6E, 0x93, 0x63, 0x97, 0xA0, 0xD0, 0x0F, 0xC8, 0x39, 0xC4, 0x6B,
+0x24, 0x3B, 0xE3, 0xFD, 0xF4, 0x38, 0x05, 0x4E, 0xBC, 0x4E, 0x72, 0x0C, 0x75, 0x54, 0x8E, 0x72, 0x87, 0x36, 0x9F, 0x3F, 0x52,
+0xE2, 0x3A, 0x8A, 0xC6, 0xC3, 0xBD, 0x8D, 0x23, 0xA7, 0xE5, 0x26, 0xB1, 0x66, 0x1A, 0x9A, 0xDE, 0xF8, 0x62, 0xF0, 0xCB, 0x1E,
+0xD1, 0x05, 0x03, 0x33, 0x34, 0x49, 0x53, 0xAF, 0xA6, 0xE3, 0xCE, 0x40, 0xD1, 0x27, 0x67, 0x6E, 0x1A, 0x4C, 0x92, 0xD3, 0x00,
+0x3B, 0xED, 0x25, 0xE9, 0x7B, 0x46, 0x41, 0x92, 0xAF, 0x29, 0x54, 0x93, 0x12, 0x6A, 0x95, 0xDC, 0x11, 0x1F, 0xE5, 0xE7, 0x23,
+0x37, 0x9B, 0x52, 0xC4, 0x26, 0x41, 0xB5, 0x59, 0x7F, 0x29, 0x89, 0x51, 0xF5, 0x62, 0xAD, 0x72, 0xD4, 0xC9, 0x9A, 0x05, 0x26,
+0x3F, 0x4C, 0x35, 0x8D, 0x48, 0x2F, 0xD9, 0x1D, 0x7C, 0xCB, 0x1E, 0xF1, 0xE3, 0x44, 0xFA, 0xAB, 0xDD, 0x9D, 0xDA, 0xB0, 0xF8,
+0x42, 0x5D, 0x8A, 0xEE, 0xE2, 0xD5, 0x54, 0xC1, 0xCB, 0x0D, 0xF9, 0xD8, 0x3B, 0xDA, 0x5E, 0x9B, 0x0F, 0xC6, 0x6B, 0x6F, 0x63,
+0x32, 0x20, 0xE5, 0x33, 0x36, 0xDA, 0x0E, 0x2D, 0xB5, 0x05, 0x2E, 0x4B, 0xD1, 0x5D, 0x36, 0x9C, 0x48, 0x0C, 0xFE, 0xFA, 0x68,
+0xE5, 0x7C, 0x9C, 0x26, 0x67, 0x24, 0x83, 0xA4, 0x98, 0xF5, 0xA0, 0x4C, 0xBE, 0x1B, 0xA4, 0x61, 0xE0, 0xF7, 0x03, 0x60, 0x84,
+0x2A, 0x1E, 0x1E, 0xC6, 0x69, 0xDD, 0xD1, 0xFD, 0x3E, 0x7A, 0xA2, 0x9E, 0xFA, 0x20, 0x67, 0x1F, 0x26, 0xBA, 0x3C, 0xD8, 0x0F,
+0x8E, 0xBD, 0xE1, 0x85, 0x84, 0xC6, 0xF7, 0xB8, 0xF1, 0xA9, 0x3F, 0xCF, 0x8F, 0x1D, 0xFD, 0x4C, 0xD4, 0x32, 0x2C, 0x84, 0x27,
+0xB9, 0x39, 0x91, 0x5B, 0x7C, 0x9B, 0x4A, 0x06, 0x8C, 0x5E, 0x7D, 0xD6, 0x43, 0x46, 0xED, 0x81, 0xE0, 0xC5, 0xD0, 0x5E, 0x96,
+0xA3, 0x32, 0xB3, 0x91, 0x9D, 0x9D, 0xA6, 0xC4, 0x88, 0x7C, 0x6F, 0x87, 0x17, 0xD3, 0x80, 0xC7, 0x68, 0x70, 0x40, 0x9E, 0xEA,
+0x2D, 0x43, 0x75, 0xDF, 0x74, 0x84, 0x8A, 0xEB, 0x20, 0x90, 0x23, 0x70, 0x1A, 0xE5, 0xC8, 0x13, 0x57, 0x0A, 0x2F, 0x76, 0x8A,
+0xBD, 0x43, 0x7C, 0x7C, 0x19, 0x8F, 0x92, 0x7A, 0x8E, 0xAB, 0x0E, 0x2A, 0x25, 0x65, 0x82, 0x12, 0xB2, 0xB0, 0xFA, 0x84, 0xC3,
+0xC3, 0xF0, 0xD7, 0xF1, 0xCC, 0x2D, 0x46, 0xF8, 0x5C, 0xA3, 0x92, 0x63, 0x74, 0xA9, 0x8B, 0x99, 0xE4, 0x59, 0xF0, 0x6A, 0x9A,
+0xD1, 0x22, 0x51, 0x93, 0xB1, 0x9B, 0x5A, 0x26, 0xF7, 0x0E, 0xD4, 0xDC, 0xF5, 0x76, 0x1B, 0xB6, 0xC8, 0x62, 0x73, 0x4F, 0xD3,
+0x91, 0x18, 0x85, 0x0C, 0xF3, 0x8D, 0x51, 0x87, 0xF6, 0x40, 0xE7, 0x08, 0x83, 0xA9, 0xEB, 0x97, 0x16, 0x88, 0x33, 0x63, 0x78,
+0x95, 0x63, 0xA9, 0xF5, 0xD1, 0xA1, 0x57, 0x50, 0xDF, 0x5F, 0x0B, 0x5B, 0x87, 0x68, 0xD8, 0xA2, 0x26, 0x16, 0xE6, 0x59, 0x35,
+0xEB, 0x96, 0xAE, 0xC5, 0xCA, 0x74, 0x41, 0x8F, 0xB3, 0xC7, 0x8F, 0xB9, 0x2F, 0xD6, 0x7E, 0x76, 0x42, 0xCE, 0xA9, 0x4B, 0x9F,
+0x9B, 0x98, 0x86, 0x98, 0xF7, 0xBD, 0x14, 0xBF, 0xEE, 0xF3, 0x80, 0xF8, 0x45, 0x32, 0xCB, 0xB7, 0xD4, 0xE5, 0xC6, 0xB8, 0x78,
+0x12, 0x42, 0xBA, 0xE4, 0x59, 0x54, 0x23, 0xE5, 0x8A, 0x18, 0xB4, 0x84, 0x2D, 0x4E, 0x29, 0x85, 0x19, 0xA2, 0xD3, 0x9F, 0xA5,
+0xC9, 0x7C, 0x6B, 0x87, 0x6D, 0xDC, 0x33, 0xFA, 0xB0, 0x92, 0x32, 0x4D, 0x5B, 0xF6, 0xAB, 0x6D, 0xF0, 0x1B, 0x86, 0x21, 0xF7,
+0xEA, 0x0E, 0xE8, 0x3C, 0xF3, 0x52, 0x18, 0x8B, 0x6C, 0x1F, 0xE6, 0x0B, 0xD6, 0xE4, 0xFA, 0xB3, 0xB5, 0xF0, 0x60, 0x6F, 0xD1,
+0x58, 0xB0, 0x0A, 0x9E, 0x05, 0x92, 0x7B, 0xE6, 0x1B, 0xD9, 0xE0, 0x47, 0x6C, 0x63, 0xBD, 0xDA, 0x5E, 0x3D, 0x13, 0xDC, 0xEF,
+0xD0, 0xDE, 0x7E, 0x5D, 0x7B, 0x6D, 0x09, 0xAC, 0x57, 0x6A, 0xEE, 0xC1, 0xE9, 0xB0, 0xD4, 0x5C, 0xFE, 0x66, 0x61, 0x73, 0xF5,
+0xFC, 0x76, 0x86, 0x63, 0xA7, 0x66, 0x58, 0xC2, 0xB0, 0x89, 0x51, 0x91, 0xCF, 0x22, 0x9F, 0x82, 0x52, 0xE9, 0x2C, 0x03, 0x48,
+0x3D, 0x5D, 0x77, 0x40, 0x73, 0xA4, 0x45, 0xE3, 0xD8, 0x0C, 0xBA, 0xF2, 0x22, 0xAE, 0xA2, 0xB0, 0xB5, 0x71, 0x6B, 0x19, 0xD6,
+0xC5, 0xF4, 0xB3, 0xC4, 0xB8, 0x2C, 0xB2, 0x7B, 0xD8, 0x15, 0xD7, 0x32, 0xA3, 0x54, 0x9C, 0x69, 0xA0, 0xDC, 0x1E, 0x87, 0xDE,
+0xB1, 0x1C, 0xA5, 0xB9, 0x77, 0xFC, 0x6F, 0x1E, 0xDD, 0xAD, 0x03, 0xBC, 0x0B, 0xA2, 0xD7, 0x14, 0xBF, 0xBB, 0x23, 0xF2, 0xB1,
+0xF0, 0x6D, 0x89, 0x28, 0x39, 0xA6, 0x68, 0x18, 0x17, 0x0F, 0xA7, 0xB4, 0xB6, 0x17, 0x32, 0x40, 0xD5, 0x66, 0x31, 0x0A, 0x1E,
+0x0D, 0x76, 0xDF, 0xF1, 0x59, 0x86, 0x51, 0x55, 0x5B, 0x18, 0xC9, 0xFD, 0x29, 0xBE, 0x7D, 0x69, 0x52, 0x70, 0xF5, 0x29, 0xFE,
+0x14, 0x7F, 0x6E, 0x17, 0xB3, 0x84, 0xE8, 0x06, 0xDF, 0x31, 0x35, 0xA7, 0x4D, 0x35, 0xEE, 0xD4, 0xCE, 0x4F, 0xD2, 0x52, 0xC7,
+0x58, 0xF2, 0x17, 0x67, 0xE2, 0xE5, 0x41, 0x10, 0x2C, 0xA5, 0xD3, 0x6B, 0x27, 0x26, 0x0B, 0xB6, 0x92, 0xDE, 0x5D, 0x78, 0x6A,
+0xA9, 0xB6, 0x3D, 0x6D, 0x3A, 0xC9, 0xC4, 0x0F, 0x32, 0xD1, 0x39, 0xA6, 0xEA, 0x31, 0xA6, 0xAF, 0x72, 0x8A, 0x49, 0x9B, 0x21,
+0x97, 0x3E, 0xBB, 0x24, 0x42, 0xA8, 0xC4, 0xC9, 0x25, 0x3A, 0xB8, 0x24, 0x6B, 0xB9, 0xDE, 0xB1, 0xA5, 0x98, 0x64, 0xCF, 0xC3,
+0x4B, 0x45, 0x3C, 0xFF, 0x2B, 0x9F, 0x5B, 0x52, 0xD6, 0x13, 0x0D, 0x17, 0x89, 0x7B, 0xEE, 0x09, 0xA6, 0x4A, 0x47, 0xC3, 0xA4,
+0xF5, 0x74, 0x96, 0x61, 0x10, 0x1B, 0xAE, 0x8E, 0x9A, 0x74, 0xA8, 0x61, 0xC9, 0x29, 0xF6, 0xB3, 0x35, 0xCB, 0x3D, 0x28, 0xA0,
+0x2E, 0x2C, 0x4E, 0xA7, 0x59, 0xF7, 0xF6, 0x25, 0x61, 0xA3, 0xE0, 0x2D, 0x2B, 0xE3, 0xAA, 0x47, 0x34, 0x70, 0x7A, 0xAD, 0x1E,
+0xCD, 0xE8, 0xD9, 0x8E, 0x64, 0xF4, 0x54, 0xBC, 0x8B, 0x52, 0x94, 0x2B, 0xCD, 0xF0, 0x45, 0xA5, 0xA4, 0x06, 0xA2, 0x24, 0xE6,
+0xDA, 0x43, 0x5A, 0x21, 0x48, 0xF1, 0x93, 0x34, 0xF5, 0x2E, 0xDC, 0x30, 0xA3, 0xBF, 0x4D, 0x01, 0xC7, 0xE5, 0xB4, 0x85, 0xE7,
+0x90, 0x8D, 0x37, 0x52, 0xBF, 0xA3, 0xE5, 0xBC, 0x5E, 0x6E, 0x1F, 0xA7, 0xD9, 0x80, 0x37, 0x97, 0x6B, 0xAA, 0xB1, 0x26, 0x4C,
+0xFF, 0xC8, 0xE6, 0x69, 0x5C, 0xC8, 0x19, 0x15, 0xD6, 0xCF, 0x63, 0x63, 0x75, 0xC1, 0xB2, 0x05, 0xE3, 0x39, 0x7C, 0x59, 0x43,
+0xDD, 0x8A, 0xEB, 0x1A, 0x3A, 0xC6, 0x80, 0x57, 0xB5, 0x21, 0x31, 0xC2, 0xBA, 0x23, 0xEF, 0xD9, 0x57, 0xEF, 0xB2, 0x9A, 0x43,
+0x2C, 0xC5, 0xA6, 0xAD, 0x16, 0x6D, 0x0C, 0xAB, 0x59, 0x3A, 0x5E, 0x62, 0x39, 0x7C, 0x54, 0x8A, 0x13, 0x96, 0x51, 0xA0, 0x14,
+0xFF, 0xA8, 0x64, 0xA1, 0x24, 0xEA, 0x12, 0x9D, 0x90, 0x4E, 0x01, 0x5D, 0xEE, 0x38, 0x0A, 0x5F, 0x90, 0xA0, 0x5F, 0xF7, 0xF4,
+0x4F, 0x85, 0x99, 0xC5, 0x19, 0xA0, 0xEA, 0xC1, 0x5A, 0x49, 0x42, 0xBB, 0x52, 0xCC, 0x7C, 0xB3, 0x8F, 0xE7, 0x54, 0x4B, 0xAC,
+0x6F, 0xAD, 0x70, 0xA8, 0x48, 0xCA, 0x9A, 0x56, 0x40, 0x46, 0x5A, 0x2C, 0x6E, 0xA2, 0x63, 0x65, 0x90, 0xE8, 0x6C, 0x7B, 0x85,
+0x25, 0x1D, 0x87, 0x77, 0x04, 0x02, 0x08, 0xC3, 0x5E, 0x2A, 0x8E, 0xE7, 0xD1, 0x4D, 0x60, 0xF2, 0xFE, 0xA6, 0xA1, 0x32, 0x78,
+0x06, 0x98, 0x40, 0x1F, 0x33, 0xF9, 0x38, 0xE5, 0x94, 0x14, 0xB6, 0x80, 0x06, 0x4D, 0x92, 0x78, 0xE3, 0x7C, 0x5D, 0x90, 0xF4,
+0x48, 0x09, 0xB1, 0xB9, 0x26, 0x03, 0x3C, 0x28, 0xDF, 0x02, 0xEE, 0xCA, 0x28, 0x54, 0x38, 0x22, 0x38, 0x0A, 0xF3, 0xF0, 0x9C,
+0xAD, 0x89, 0xFA, 0x61, 0x4A, 0x3D, 0x3C, 0xA4, 0xCC, 0x28, 0x13, 0x53, 0xD9, 0x07, 0x55, 0xE4, 0x7D, 0xE2, 0x2E, 0xB3, 0xAA,
+0x1F, 0x4D, 0x4D, 0x72, 0x68, 0xBF, 0x62, 0x6A, 0x19, 0x02, 0xA4, 0x54, 0x36, 0xA0, 0xA9, 0x9A, 0x73, 0x16, 0x13, 0x60, 0xA9,
+0xD6, 0x9B, 0xDE, 0x2D, 0x35, 0x9C, 0xD0, 0xB3, 0x68, 0x20, 0xEE, 0xEB, 0x09, 0xFF, 0x8C, 0x2F, 0xEB, 0x2A, 0x38, 0x06, 0xD6,
+0x36, 0xD0, 0x56, 0xA4, 0x49, 0x7B, 0xC5, 0x03, 0xA5, 0x39, 0x1B, 0x4A, 0x9F, 0x44, 0x80, 0x96, 0xF5, 0x1B, 0x5E, 0xBC, 0xC2,
+0x5F, 0x1A, 0x39, 0x20, 0xF4, 0x4D, 0x64, 0x1E, 0xA1, 0xCC, 0x0B, 0x88, 0x1B, 0x70, 0x16, 0x96, 0xE8, 0xAB, 0x12, 0x60, 0xD1,
+0x43, 0xDF, 0x05, 0x59, 0xB9, 0x6A, 0x0C, 0x8F, 0x80, 0x1F, 0xC2, 0x3E, 0x7F, 0x95, 0x1D, 0x4B, 0x08, 0x64, 0x1D, 0xB2, 0xA5,
+0x0C, 0x29, 0xA3, 0xC1, 0x6A, 0x10, 0xBD, 0x49, 0xFD, 0x30, 0x86, 0x41, 0xE1, 0xB4, 0x6D, 0x5F, 0xF7, 0xBD, 0x2C, 0x47, 0x8B,
+0x4B, 0xA3, 0xBC, 0x59, 0xD7, 0x58, 0x6B, 0xDF, 0xE9, 0xEB, 0x88, 0x56, 0x19, 0xFB, 0x0B, 0xB0, 0xBD, 0x04, 0x93, 0xED, 0xD5,
+0x23, 0xC0, 0x82, 0x26, 0xEA, 0x17, 0xDB, 0x56, 0x5B, 0xA8, 0x6E, 0xAE, 0xAE, 0x47, 0x20, 0x6F, 0x40, 0xAD, 0x87, 0xD0, 0x2E,
+0xC5, 0xB3, 0xD4, 0xA0, 0x27, 0x38, 0xA9, 0x88, 0xC9, 0xCB, 0x98, 0x18, 0x41, 0xCD, 0x87, 0xAF, 0xE6, 0x38, 0xB8, 0x35, 0x67,
+0x1C, 0x54, 0x3F, 0x1B, 0x03, 0x41, 0x8B, 0xF7, 0x42, 0x99, 0x36, 0x28, 0x86, 0x77, 0xBA, 0x50, 0x97, 0xBF, 0x71, 0x39, 0xB4,
+0x49, 0xCA, 0x21, 0x25, 0x83, 0xE7, 0x13, 0x43, 0x19, 0x04, 0x46, 0x15, 0x56, 0x04, 0x7F, 0xCA, 0x07, 0x78, 0x79, 0x2D, 0xC6,
+0x87, 0x9C, 0xD7, 0xC1, 0xDF, 0xE1, 0x7C, 0x86, 0xBF, 0x28, 0xC8, 0xD7, 0x72, 0x2A, 0x53, 0x38, 0x96, 0x47, 0xA9, 0x30, 0x80,
+0xEA, 0x92, 0xB7, 0x49, 0xC3, 0xEE, 0x95, 0x37, 0x95, 0x7E, 0x26, 0x5E, 0x88, 0x2F, 0x19, 0x53, 0x8A, 0x2E, 0xC5, 0x40, 0x61,
+0x97, 0xAE, 0x7A, 0x43, 0x27, 0xDD, 0xC3, 0x87, 0x7F, 0x6B, 0xE0, 0x72, 0x59, 0x85, 0x1B, 0x16, 0xA1, 0x21, 0x36, 0x70, 0xBC,
+0x1C, 0xAE, 0xB1, 0xCD, 0xAE, 0xDA, 0x0C, 0x7E, 0x09, 0x2D, 0x8E, 0xD5, 0xAC, 0x35, 0x2B, 0xA3, 0x56, 0xBB, 0x0A, 0x00, 0x0F,
+0xC0, 0xAF, 0x35, 0x49, 0x21, 0xE9, 0x10, 0x32, 0x4B, 0x3F, 0xFF, 0x8C, 0x4A, 0x49, 0xFF, 0x2A, 0xF5, 0xEC, 0x5A, 0xCB, 0x9C,
+0xDE, 0x64, 0x9C, 0xDE, 0x9C, 0x99, 0xEF, 0xAA, 0x08, 0xA5, 0x46, 0x55, 0x2B, 0xF2, 0xDF, 0x92, 0xBE, 0x2B, 0x9D, 0x9E, 0xAE,
+0x05, 0x03, 0xC4, 0xB5, 0x8E, 0x22, 0x04, 0xA0, 0x3B, 0xBE, 0x5A, 0x5A, 0x5C, 0x87, 0xA6, 0xC0, 0xE7, 0x6C, 0x06, 0x52, 0x59,
+0x14, 0xA2, 0x9A, 0xB2, 0xFD, 0x45, 0x65, 0x41, 0xE1, 0xD5, 0x14, 0x5D, 0x37, 0x9B, 0x26, 0x83, 0x84, 0x50, 0x94, 0x5E, 0xD0,
+0x42, 0xBA, 0x74, 0x26, 0xFC, 0xAD, 0x97, 0xC3, 0xE4, 0x16, 0xD3, 0x71, 0xB0, 0x4F, 0xFE, 0xE5, 0xC6, 0x55, 0xCF, 0xBD, 0xEC,
+0xB7, 0xAF, 0x8A, 0x73, 0x5E, 0x08, 0xF4, 0x93, 0x87, 0x93, 0xD3, 0x6D, 0x2E, 0x5B, 0x88, 0x8A, 0xEF, 0x2D, 0x36, 0x5B, 0x25,
+0xDB, 0x0D, 0x61, 0x9F, 0x8B, 0x09, 0x7F, 0x47, 0x96, 0x2C, 0xCE, 0xE7, 0xF4, 0x4A, 0x38, 0x43, 0x09, 0x25, 0xCB, 0x60, 0xC7,
+0x17, 0x34, 0xF1, 0x73, 0x5F, 0x02, 0x76, 0x6E, 0x34, 0xA1, 0x9E, 0x73, 0x48, 0xE1, 0x46, 0x3E, 0x54, 0x2C, 0xCE, 0xEA, 0x86,
+0x2B, 0x6D, 0x87, 0x35, 0xCA, 0x3B, 0x5E, 0x36, 0xBE, 0x6D, 0x7F, 0x33, 0xF3, 0xEA, 0x4A, 0xCF, 0xFF, 0x54, 0xBF, 0x5D, 0x2B,
+0x92, 0x8A, 0xA9, 0x8D, 0xDD, 0xCB, 0xB5, 0x09, 0x5D, 0x1A, 0x51, 0x35, 0x33, 0xDA, 0xE2, 0x74, 0x83, 0x83, 0x5B, 0x7B, 0xEA,
+0xF2, 0x09, 0xDC, 0x37, 0x32, 0x3C, 0x28, 0xDA, 0xF6, 0x1E, 0x49, 0x30, 0x28, 0x80, 0x6E, 0x97, 0x2E, 0xB2, 0x93, 0x1B, 0xC3,
+0x31, 0xD7, 0x3D, 0xB6, 0xE1, 0xAD, 0x36, 0x8F, 0x87, 0x69, 0x66, 0x01, 0xD9, 0x7B, 0x77, 0xA0, 0x20, 0x22, 0x2F, 0xB7, 0x40,
+0xC8, 0xDB, 0x40, 0x0A, 0x30, 0xD3, 0xF9, 0x5C, 0xBE, 0x20, 0xA4, 0xA8, 0xD0, 0x88, 0x0F, 0x37, 0x77, 0xDD, 0xF4, 0x2F, 0xE5,
+0x02, 0x7B, 0x26, 0xA1, 0xC5, 0x5B, 0x05, 0x58, 0x39, 0x3F, 0x5C, 0x13, 0xC7, 0xA0, 0x0A, 0x8C, 0x24, 0xE0, 0xC7, 0x1A, 0x1A,
+0xD8, 0x63, 0xF6, 0x59, 0xCC, 0xE4, 0x0C, 0xEF, 0x0A, 0xB9, 0x7D, 0x59, 0x03, 0x78, 0xF5, 0x99, 0xF1, 0xFB, 0x2E, 0xEA, 0x0E,
+0x33, 0x03, 0x22, 0x69, 0xB1, 0x18, 0x68, 0x4C, 0x30, 0x81, 0xE6, 0x48, 0x1E, 0x0F, 0x7B, 0x9A, 0xC0, 0x02, 0xD2, 0x8B, 0x5B,
+0xEE, 0x97, 0x24, 0x8C, 0x9B, 0x20, 0x0E, 0x4E, 0xA1, 0x45, 0xE7, 0xC8, 0x42, 0x5F, 0xC8, 0x02, 0x2A, 0xAD, 0x3A, 0x59, 0x90,
+0x8A, 0x7C, 0xBB, 0x04, 0xA0, 0x3D, 0xB9, 0x69, 0x40, 0x37, 0xC6, 0x36, 0xBB, 0xAC, 0xF9, 0x1E, 0xA7, 0x38, 0x7E, 0x87, 0xA8,
+0x3C, 0x53, 0xF6, 0x9F, 0x67, 0xFB, 0xEF, 0xD4, 0xEF, 0x4F, 0xCD, 0x1F, 0xBE, 0xDF, 0x63, 0x18, 0xB6, 0xFD, 0xA9, 0xD5, 0xBA,
+0xDD, 0x0D, 0xDB, 0x18, 0x86, 0x58, 0xC4, 0x1C, 0xD1, 0x6D, 0x2E, 0xE5, 0xEA, 0x5F, 0xFA, 0x85, 0xF0, 0x40, 0xC1, 0xB0, 0x02,
+0xC0, 0xA3, 0xC0, 0x8B, 0x38, 0x07, 0x2D, 0x24, 0xDB, 0x1E, 0xAB, 0x5D, 0x27, 0xB3, 0xE2, 0x6E, 0x98, 0x3A, 0x59, 0x15, 0xD7,
+0xC5, 0xCC, 0x93, 0x0B, 0x2D, 0x80, 0xFE, 0x96, 0x0C, 0xA0, 0xC7, 0x4E, 0xC5, 0x77, 0x46, 0x87, 0x16, 0x80, 0x55, 0x99, 0x30,
+0xE3, 0xCA, 0xA1, 0x34, 0x3C, 0x54, 0x0A, 0x2B, 0x80, 0x55, 0x84, 0x81, 0xBA, 0x1B, 0xEF, 0x99, 0xA9, 0xE9, 0x6D, 0xB1, 0x8E,
+0x55, 0x2D, 0x94, 0xAB, 0x6E, 0x53, 0xD7, 0xD5, 0xB1, 0x8F, 0xAF, 0x79, 0xEB, 0xB8, 0xC7, 0x75, 0xA9, 0x8E, 0xBA, 0x3A, 0x00,
+0xD5, 0xCB, 0x2A, 0x8F, 0x2D, 0x87, 0xDE, 0x81, 0x33, 0xC2, 0xC0, 0xCE, 0x0C, 0xF6, 0x28, 0x08, 0xC1, 0x1A, 0xCD, 0x09, 0xA3,
+0x42, 0xC6, 0xCA, 0xC9, 0x7A, 0xC4, 0xB6, 0xBB, 0x3D, 0x88, 0x6C, 0xB5, 0x08, 0x31, 0x91, 0x3B, 0x3B, 0xC8, 0x5F, 0x0E, 0x89,
+0x03, 0xC2, 0xEA, 0x50, 0xF1, 0x08, 0x9A, 0x35, 0xC1, 0xAA, 0x07, 0xBF, 0xBA, 0x96, 0x03, 0x82, 0xE2, 0xAA, 0xC9, 0xFE, 0xC6,
+0xF4, 0x7C, 0x9B, 0x95, 0xCF, 0x81, 0x6D, 0x33, 0x98, 0x3A, 0xF3, 0x10, 0x68, 0x11, 0x97, 0xAE, 0x4E, 0x42, 0xDF, 0x8F, 0xF0,
+0x7E, 0xEA, 0xC6, 0xB6, 0x59, 0x5F, 0xDF, 0x5E, 0x5F, 0xF5, 0xA8, 0xD9, 0x57, 0xAA, 0x6F, 0xDD, 0x5E, 0x1F, 0x74, 0xCF, 0xD7,
+0xAA, 0x4E, 0xA2, 0x6F, 0x6C, 0x57, 0xA6, 0xBD, 0x4A, 0x60, 0xAC, 0x9C, 0xFD, 0xB4, 0x63, 0x3B, 0xD6, 0x0B, 0x08, 0x4A, 0x3B,
+0xDD, 0xFA, 0xB5, 0xCE, 0x78, 0x3D, 0xE7, 0x64, 0x96, 0xE3, 0x7D, 0x94, 0x59, 0xDE, 0x09, 0x31, 0xD3, 0xCF, 0x90, 0x4D, 0xCF,
+0x3B, 0x1B, 0x6C, 0x7A, 0xD1, 0x59, 0xC7, 0x7B, 0x8F, 0x29, 0x96, 0x23, 0x63, 0x60, 0x91, 0x70, 0xF7, 0x30, 0x06, 0x53, 0x15,
+0x94, 0xF0, 0x8B, 0xB9, 0x1A, 0xDB, 0x2B, 0x04, 0x13, 0xD7, 0x42, 0x6A, 0xE6, 0x91, 0xF4, 0x2C, 0x4A, 0xAB, 0x79, 0x89, 0x22,
+0x65, 0xEC, 0xCB, 0xB0, 0xA2, 0xB1, 0x6D, 0x1B, 0x1B, 0x32, 0xB2, 0x89, 0xA2, 0x3D, 0xCD, 0x88, 0x1F, 0xE1, 0x04, 0x06, 0x06,
+0xD6, 0x27, 0x03, 0x85, 0xAF, 0xB8, 0x9E, 0x81, 0x3F, 0x2E, 0x71, 0x59, 0xB8, 0x32, 0x1B, 0x18, 0x24, 0xD4, 0xA1, 0xAB, 0x6F,
+0xE9, 0xCA, 0x61, 0xDB, 0x2D, 0xD1, 0x19, 0xA6, 0xE6, 0x6C, 0xF0, 0xB2, 0x3A, 0xA1, 0x9F, 0x4B, 0x77, 0x81, 0x06, 0xE7, 0x9D,
+0x6C, 0x9C, 0x86, 0xF1, 0x49, 0xA7, 0xE7, 0xEC, 0xDE, 0xBE, 0x14, 0x03, 0x93, 0xE8, 0x75, 0x69, 0x68, 0x5E, 0x59, 0xAF, 0x10,
+0x85, 0x62, 0x50, 0xFF, 0x59, 0xA7, 0xCF, 0xA6, 0x01, 0x76, 0x2E, 0xBF, 0xA2, 0x51, 0xDE, 0x18, 0x17, 0x74, 0xFA, 0xF8, 0x2A,
+0x4F, 0xC1, 0x70, 0x01, 0xA4, 0x2A, 0x35, 0x14, 0xE0, 0x12, 0x2F, 0x8B, 0x1B, 0x1B, 0xB5, 0x72, 0x03, 0xCF, 0x3F, 0x0E, 0xD8,
+0xE0, 0x58, 0xBB, 0x3E, 0x4E, 0x96, 0x46, 0xF5, 0x71, 0xA5, 0x0A, 0x69, 0xA4, 0x64, 0x13, 0xBC, 0xF7, 0xA0, 0x10, 0x3E, 0x55,
+0x42, 0xE8, 0x46, 0xDC, 0x0B, 0x7F, 0x2D, 0xAF, 0x4E, 0xC8, 0x9C, 0xAB, 0x79, 0xF7, 0xA2, 0x1A, 0xBC, 0x50, 0x17, 0xD2, 0x95,
+0xAF, 0xB6, 0x9B, 0xD0, 0x1F, 0x1F, 0x37, 0xE7, 0x52, 0x87, 0x25, 0x31, 0xC5, 0x2F, 0xEE, 0x38, 0x66, 0xA4, 0x57, 0x11, 0x91,
+0x9C, 0x82, 0xA5, 0x0D, 0x24, 0x61, 0xCF, 0x5F, 0xB5, 0xF0, 0x2A, 0x5D, 0xF3, 0x06, 0xFA, 0x3C, 0xF5, 0xB2, 0x31, 0xBF, 0xA4,
+0xBD, 0xEE, 0xE2, 0xBA, 0xCF, 0x8B, 0x45, 0x51, 0xDF, 0xEF, 0x85, 0x32, 0x2A, 0xB9, 0xE3, 0xDC, 0x98, 0xD7, 0xEA, 0x98, 0xB7,
+0x5E, 0x15, 0xF2, 0xD5, 0x87, 0xBC, 0xA2, 0xA3, 0x6E, 0xC4, 0xD7, 0x9F, 0x60, 0xA8, 0x03, 0x5C, 0x7A, 0xBC, 0xDB, 0x4A, 0x94,
+0x71, 0x2F, 0xC1, 0x85, 0x86, 0x2D, 0x80, 0xED, 0xFF, 0x0F, 0xF6, 0x6B, 0x0D, 0x76, 0x79, 0xA7, 0xA3, 0x2C, 0x2B, 0xC3, 0x6B,
+0xAF, 0x58, 0xE9, 0x05, 0x93, 0x09, 0xBE, 0x27, 0x61, 0x4C, 0x39, 0xBE, 0x31, 0xFF, 0x78, 0xE3, 0x5B, 0x6A, 0x05, 0x1A, 0xF9,
+0xD4, 0x15, 0xC5, 0x2F, 0x54, 0x08, 0xD0, 0x05, 0xEB, 0xF5, 0x1A, 0x23, 0x99, 0xE5, 0x68, 0x9A, 0xEB, 0x97, 0x62, 0x2A, 0xAD,
+0x51, 0x8E, 0xD3, 0x6C, 0x4A, 0x55, 0xD1, 0xC6, 0x50, 0x7F, 0x47, 0x6A, 0x0E, 0xE1, 0x18, 0x84, 0xB6, 0x4B, 0xB9, 0x25, 0x06,
+0x34, 0xAE, 0x2A, 0xFA, 0xC4, 0x4B, 0xB1, 0xA7, 0x66, 0xD3, 0x8A, 0x4A, 0xF9, 0xAA, 0xB4, 0x95, 0x49, 0xAB, 0xD5, 0x31, 0x1D,
+0xDE, 0x63, 0xCB, 0x51, 0x8D, 0x37, 0xFB, 0x2C, 0x49, 0xF7, 0x42, 0xF5, 0x2B, 0x09, 0xF9, 0xAA, 0xDA, 0xD7, 0xAE, 0x19, 0xEA,
+0x94, 0xAF, 0x66, 0x46, 0xDB, 0xA3, 0x3A, 0x95, 0x62, 0xC0, 0x40, 0x98, 0xC3, 0xE4, 0x1D, 0x35, 0x61, 0xE7, 0x23, 0xAC, 0x8B,
+0xF2, 0x3D, 0xDC, 0xBC, 0xC1, 0x1F, 0xF2, 0xB6, 0x3E, 0x7A, 0x80, 0x05, 0x84, 0xF8, 0x21, 0xDF, 0x50, 0x06, 0x6E, 0x01, 0xFA,
+0x3C, 0xF6, 0xC5, 0x2F, 0xF3, 0xF8, 0xB8, 0xF1, 0x4E, 0x21, 0x36, 0x4F, 0x82, 0x3B, 0x47, 0x22, 0x83, 0xB9, 0x22, 0x08, 0x6F,
+0x1F, 0xD2, 0xE9, 0x02, 0x6A, 0x79, 0x2B, 0x98, 0x35, 0xA2, 0xF5, 0x23, 0xC0, 0x1E, 0x6D, 0x1B, 0x8D, 0x36, 0x43, 0x56, 0x8B,
+0x6C, 0x2E, 0xE5, 0xF0, 0x3A, 0x09, 0xA3, 0x5B, 0x50, 0x85, 0x93, 0x05, 0x63, 0xBD, 0xE5, 0xB3, 0x8C, 0x6C, 0xB3, 0x78, 0x5A,
+0x08, 0x0C, 0xFD, 0x30, 0x35, 0x20, 0xD2, 0xD5, 0x42, 0x70, 0xB8, 0x34, 0x7B, 0xFC, 0xD8, 0xD8, 0xFC, 0x2D, 0xBB, 0x5A, 0x38,
+0x1C, 0xAE, 0x30, 0x4D, 0xB8, 0x8A, 0xE7, 0xA5, 0x7C, 0xD6, 0xBF, 0x42, 0x80, 0xE1, 0x7A, 0xC9, 0xF4, 0xC7, 0x32, 0x64, 0xC5,
+0xF7, 0x52, 0x3E, 0xDF, 0x5F, 0x29, 0x21, 0x1D, 0x10, 0x04, 0xAB, 0x1E, 0x6C, 0x50, 0x3C, 0xF1, 0xA4, 0xFC, 0x69, 0x83, 0x50,
+0x87, 0xE0, 0x33, 0xE9, 0x49, 0x40, 0x28, 0x5C, 0xA3, 0xCF, 0x39, 0xBC, 0x9E, 0x69, 0x0E, 0x05, 0x2B, 0x52, 0x9E, 0xB3, 0x52,
+0xFD, 0x2E, 0x71, 0x53, 0x38, 0x0D, 0x0A, 0x90, 0x2A, 0xC3, 0x55, 0xD2, 0x4C, 0xF1, 0xAB, 0x5C, 0x8B, 0x96, 0x37, 0x53, 0xFD,
+0xB6, 0xC0, 0x48, 0x42, 0xC4, 0xCF, 0x6A, 0x25, 0x92, 0x0C, 0xF1, 0xD3, 0x46, 0x05, 0xB9, 0x31, 0xCD, 0x57, 0x9A, 0xAB, 0xB7,
+0xEC, 0xC4, 0x27, 0xBF, 0xA8, 0xEE, 0x09, 0xB6, 0x66, 0xA6, 0xD3, 0x8E, 0x51, 0x57, 0xC9, 0xD6, 0xCE, 0x1E, 0x64, 0x34, 0x41,
+0x23, 0x59, 0x4D, 0xCE, 0x2A, 0x8C, 0xBF, 0x9C, 0x81, 0x5E, 0x1B, 0x41, 0x5F, 0xF9, 0xAC, 0x78, 0xFD, 0x18, 0x34, 0xEE, 0x16,
+0xDA, 0x75, 0x5B, 0xDC, 0x21, 0xCF, 0xC7, 0x2C, 0xFF, 0x68, 0x3F, 0x2F, 0xAB, 0x72, 0x96, 0xEA, 0xBB, 0x76, 0x58, 0xD1, 0x9C,
+0x40, 0x47, 0x59, 0x8B, 0x38, 0xA7, 0xB6, 0xE8, 0x28, 0xED, 0xF5, 0x4F, 0xD2, 0x96, 0xCE, 0x62, 0xAD, 0xBA, 0x1B, 0x66, 0x76,
+0x8A, 0xE6, 0xE0, 0xE3, 0x96, 0xAF, 0x95, 0xD5, 0xFD, 0xDA, 0x8D, 0x94, 0x2A, 0x78, 0x4D, 0xAE, 0x12, 0x75, 0x19, 0x8A, 0xD5,
+0x6B, 0x5C, 0x97, 0x25, 0xA4, 0x52, 0xAA, 0xEC, 0xCC, 0x9D, 0x9B, 0xA4, 0x72, 0x9E, 0xAF, 0xB6, 0x26, 0x19, 0x47, 0xA5, 0x5C,
+0xE1, 0xD0, 0xAC, 0x64, 0xBE, 0xE0, 0xE1, 0x56, 0x14, 0x7A, 0x73, 0x28, 0xB4, 0x45, 0x56, 0x86, 0x68, 0x33, 0x7B, 0x02, 0x8A,
+0xAB, 0xE5, 0x12, 0x5C, 0xD4, 0xF9, 0x23, 0x6B, 0xB3, 0xEC, 0x96, 0x3D, 0x6F, 0x75, 0x69, 0x2A, 0x6B, 0xBC, 0x68, 0xB6, 0xBC,
+0x11, 0xC5, 0x60, 0x28, 0x5E, 0xE2, 0x60, 0xD8, 0x54, 0x5B, 0x39, 0x53, 0x8A, 0xA6, 0x6E, 0xD6, 0x17, 0xEE, 0xB2, 0xF5, 0xCD,
+0xCD, 0x16, 0xFB, 0x3B, 0x6E, 0x15, 0xDA, 0x2B, 0xA1, 0x2B, 0xEB, 0x01, 0x09, 0x5D, 0x64, 0x43, 0xFE, 0xE0, 0xE6, 0x14, 0x6F,
+0x30, 0xB9, 0xC3, 0x9C, 0xBF, 0x39, 0xE5, 0x1D, 0x0A, 0x43, 0x93, 0xB4, 0xD8, 0xD7, 0x0D, 0xE0, 0xB1, 0xEF, 0xC6, 0xD4, 0xE7,
+0x31, 0xC8, 0xDC, 0xC3, 0x5F, 0xA4, 0x9E, 0xCA, 0x82, 0x9C, 0xD2, 0x02, 0x0C, 0xA0, 0x90, 0xC8, 0x82, 0xD0, 0xAE, 0xCD, 0x1A,
+0x29, 0xC8, 0x97, 0xFB, 0xC0, 0x66, 0x9E, 0x85, 0x85, 0x85, 0xE6, 0x25, 0x1A, 0xC8, 0x54, 0x76, 0x81, 0x3A, 0xC2, 0x28, 0x61,
+0x41, 0x7B, 0x4E, 0xDE, 0x46, 0x2B, 0x71, 0x45, 0x6A, 0x84, 0x65, 0x0A, 0xEA, 0x55, 0xEA, 0x57, 0x18, 0xB7, 0xD1, 0x7A, 0xC1,
+0x5F, 0x65, 0x20, 0x30, 0xB6, 0x4F, 0x0A, 0x10, 0xF5, 0x54, 0x06, 0x43, 0x8A, 0x9E, 0x41, 0xDF, 0x71, 0x44, 0xE2, 0xC1, 0x5E,
+0xA1, 0x8C, 0x09, 0xE1, 0x70, 0x4F, 0xF9, 0xAE, 0x7B, 0x15, 0x4C, 0x86, 0xB7, 0x12, 0x24, 0x4F, 0x23, 0x33, 0x1F, 0xF0, 0x19,
+0x28, 0xD3, 0x0B, 0x0D, 0x9A, 0x9E, 0xED, 0x45, 0x3E, 0xC0, 0x8A, 0x76, 0x1C, 0xA4, 0x04, 0x7C, 0xC6, 0x7F, 0xDB, 0x1A, 0xA4,
+0xC5, 0x9D, 0xDC, 0x82, 0x79, 0x0B, 0x4F, 0x44, 0xCA, 0x57, 0x38, 0xD6, 0xF8, 0x4E, 0xA3, 0xAD, 0x60, 0x11, 0x91, 0xA2, 0x0A,
+0xCA, 0x57, 0xF3, 0x0B, 0x6A, 0xC1, 0x2A, 0x9C, 0x3D, 0xF2, 0x85, 0x0D, 0xD8, 0x0C, 0xA0, 0xE1, 0xF0, 0xDA, 0x3B, 0xAC, 0x49,
+0x6C, 0xC6, 0x57, 0x8A, 0x96, 0xE2, 0x24, 0x78, 0x59, 0xFD, 0x65, 0x41, 0xA6, 0xA5, 0xB4, 0x11, 0xF4, 0x82, 0x33, 0x7A, 0xE9,
+0xA5, 0xAA, 0xB9, 0xAE, 0xB0, 0x20, 0x59, 0x2B, 0x69, 0x10, 0x5C, 0xD3, 0xCF, 0x46, 0x98, 0x4C, 0xE6, 0x8E, 0x8A, 0xE7, 0x72,
+0x81, 0x58, 0xC4, 0xCC, 0x70, 0x02, 0x33, 0x57, 0x3E, 0xB7, 0xAA, 0x83, 0xEE, 0x45, 0x14, 0x72, 0xD1, 0x1E, 0xC1, 0x0F, 0xCB,
+0x77, 0x9E, 0xAE, 0x05, 0x01, 0x72, 0xFC, 0x65, 0x81, 0xD8, 0x4B, 0x26, 0x93, 0x0C, 0x1D, 0x14, 0x62, 0x84, 0xE4, 0x1E, 0x3E,
+0x94, 0x01, 0xD3, 0x2C, 0x7B, 0x9B, 0x86, 0x49, 0x8A, 0x77, 0x19, 0x22, 0x9C, 0xF6, 0x6C, 0x04, 0xB1, 0x14, 0x79, 0x63, 0x8A,
+0x1A, 0x8B, 0x69, 0x51, 0xDD, 0x66, 0xA4, 0xA9, 0x95, 0xE2, 0x65, 0x56, 0x06, 0x85, 0xA5, 0x56, 0x19, 0x10, 0x57, 0x5F, 0x1A,
+0x98, 0x7E, 0xB9, 0x91, 0x06, 0xAA, 0xBF, 0x16, 0x36, 0xA6, 0x9E, 0x98, 0xAE, 0xB8, 0x54, 0x5A, 0x2B, 0x63, 0xBC, 0xC7, 0x42,
+0x1B, 0x3D, 0x35, 0x19, 0x41, 0x6B, 0xDF, 0xA7, 0x11, 0x81, 0x89, 0x9F, 0xC6, 0xE1, 0x1F, 0x78, 0xB7, 0xF8, 0x36, 0x2B, 0xED,
+0x72, 0x1D, 0xE3, 0xDA, 0x44, 0x90, 0x56, 0x75, 0xAF, 0x89, 0x42, 0x54, 0x8A, 0xBD, 0xF9, 0x6C, 0xDE, 0x91, 0x78, 0xFB, 0x92,
+0x53, 0x71, 0xE5, 0x1C, 0x61, 0x34, 0x75, 0x51, 0x4A, 0xBB, 0xDA, 0xAB, 0x40, 0xFB, 0x58, 0x92, 0xCF, 0xF7, 0xA1, 0xEC, 0xC1,
+0x90, 0x73, 0x0E, 0x98, 0x57, 0xAE, 0x25, 0xD6, 0x1C, 0x86, 0x15, 0x07, 0x3F, 0x32, 0x46, 0x78, 0xFA, 0x96, 0xBE, 0xAB, 0xD8,
+0x82, 0x4F, 0x7E, 0xD4, 0xD0, 0x55, 0xFD, 0xFE, 0x5C, 0x2A, 0xF4, 0x9A, 0x3F, 0xDA, 0x8E, 0xBC, 0x8A, 0xF5, 0x60, 0x81, 0xB0,
+0x48, 0x4F, 0x3F, 0xEF, 0x90, 0x6F, 0xB1, 0xC2, 0xD6, 0x07, 0x42, 0xE8, 0xB7, 0x79, 0x86, 0xE2, 0x79, 0x21, 0x3C, 0xA1, 0xAF,
+0xB7, 0xE9, 0xD6, 0x2D, 0x95, 0x10, 0xBB, 0x14, 0xD7, 0x6C, 0x4D, 0xDC, 0x68, 0x6C, 0xFF, 0x99, 0x00, 0xD5, 0xEC, 0xDB, 0xE6,
+0x0A, 0x5E, 0xBB, 0x93, 0xC8, 0xBE, 0x76, 0x27, 0x00, 0x58, 0xBE, 0xEF, 0x51, 0x84, 0xE8, 0x9C, 0xC5, 0x3B, 0x01, 0x46, 0x2A,
+0x6E, 0x62, 0xDE, 0xFA, 0x9D, 0x83, 0x16, 0xB1, 0x13, 0x14, 0x16, 0x46, 0xF5, 0xA0, 0x0B, 0x28, 0x1C, 0x89, 0x93, 0x1C, 0xFC,
+0x08, 0xE9, 0xFE, 0x9B, 0xD7, 0xCF, 0xDE, 0xBC, 0xFE, 0xF7, 0xFB, 0xD7, 0xCF, 0x9E, 0xBF, 0xFB, 0xE7, 0xBB, 0x37, 0xF0, 0xD7,
+0x69, 0xD5, 0x04, 0x59, 0x59, 0x02, 0xB0, 0x8A, 0x1C, 0x6A, 0x65, 0x4E, 0xCE, 0x4B, 0x0D, 0xAA, 0x33, 0x74, 0x68, 0x85, 0xAB,
+0xF2, 0xB5, 0xE2, 0x7F, 0xB0, 0xB1, 0xD6, 0x70, 0x39, 0x98, 0xAC, 0xB5, 0x1F, 0x5A, 0x2C, 0x2C, 0xFA, 0x4C, 0xA6, 0x09, 0x46,
+0x6B, 0x3E, 0x13, 0x64, 0x28, 0xD7, 0x80, 0xCA, 0x79, 0xB7, 0xCA, 0xB1, 0x8B, 0xDA, 0x44, 0xC4, 0x98, 0x41, 0x57, 0xD5, 0x76,
+0xF5, 0x58, 0xE6, 0x0C, 0xD6, 0x36, 0xAB, 0xF9, 0x81, 0xC6, 0x9A, 0x93, 0x19, 0x0B, 0xCF, 0x66, 0xD3, 0xD1, 0x80, 0x29, 0xA2,
+0xA7, 0x03, 0x02, 0xCE, 0x92, 0x87, 0x2B, 0xEB, 0xD2, 0x0A, 0xDA, 0x6F, 0x7E, 0x11, 0x17, 0x56, 0xBE, 0x59, 0xFE, 0x84, 0x9F,
+0x51, 0xA2, 0xC8, 0x97, 0xC5, 0x3D, 0x2D, 0xE6, 0xC7, 0xD2, 0x99, 0xBF, 0x27, 0x51, 0x44, 0x57, 0xE9, 0x66, 0xCE, 0x9C, 0xE4,
+0x87, 0xBA, 0x37, 0x52, 0x47, 0x26, 0x78, 0xC8, 0xCF, 0x6D, 0x20, 0x92, 0xE2, 0x64, 0x08, 0x3E, 0x69, 0xAE, 0x0A, 0x2D, 0x5E,
+0x8E, 0xDF, 0x1F, 0x81, 0xAA, 0x07, 0x45, 0xE9, 0x23, 0x65, 0x5E, 0x75, 0xDA, 0x8E, 0x1F, 0x91, 0xC7, 0x10, 0x63, 0xB1, 0x68,
+0xC9, 0xCD, 0x05, 0x24, 0x13, 0x37, 0x6C, 0x18, 0xD5, 0x60, 0x59, 0x3A, 0x9D, 0x48, 0x61, 0x9E, 0x96, 0xD7, 0x6A, 0xDF, 0x84,
+0x3B, 0xD6, 0x8B, 0x5C, 0x2D, 0x5A, 0xDD, 0xC5, 0x15, 0x18, 0x04, 0x44, 0xBE, 0x10, 0x8A, 0xA0, 0x54, 0x91, 0x6B, 0x05, 0x05,
+0xFA, 0xA3, 0x0B, 0xCD, 0x80, 0x51, 0x2E, 0x4A, 0xF1, 0x4B, 0x87, 0x81, 0x69, 0x30, 0xF6, 0x83, 0xB4, 0x48, 0xD1, 0xBC, 0xA6,
+0x71, 0x41, 0x12, 0x83, 0x4F, 0x05, 0x2D, 0x06, 0x4E, 0x45, 0x0B, 0xC2, 0xB8, 0xA1, 0xDF, 0xFA, 0x1A, 0x57, 0xD8, 0x0A, 0x5C,
+0x35, 0xA7, 0x3D, 0xE9, 0x6B, 0x6C, 0x3A, 0x0F, 0xE6, 0xF4, 0xBB, 0x7E, 0xC7, 0x69, 0x75, 0xF9, 0xAD, 0x15, 0x52, 0x46, 0x86,
+0x31, 0xD0, 0xB5, 0x88, 0xE0, 0x02, 0xD6, 0x48, 0x16, 0x49, 0x07, 0x51, 0x4A, 0xCA, 0x61, 0xF5, 0x94, 0x98, 0x0B, 0x92, 0x59,
+0x9A, 0x15, 0xAC, 0x90, 0xC7, 0x72, 0xFE, 0xF1, 0xF0, 0xD2, 0x19, 0x22, 0x72, 0x9A, 0x51, 0xDF, 0x17, 0xC7, 0xC3, 0x6B, 0x9B,
+0xAF, 0x2C, 0xF7, 0xE5, 0xDA, 0x57, 0x9D, 0x0E, 0xEA, 0x92, 0x22, 0xCF, 0x99, 0x5B, 0x79, 0x52, 0xF8, 0xD2, 0x34, 0xA0, 0x39,
+0x7E, 0x6D, 0x13, 0x80, 0xF2, 0xF8, 0xD2, 0x47, 0x14, 0x2B, 0x8B, 0x57, 0x56, 0x4E, 0xA5, 0x56, 0x7F, 0xAC, 0x9C, 0x3C, 0xEB,
+0x9C, 0xC4, 0x8B, 0x1C, 0xC3, 0x2B, 0x65, 0x35, 0xAD, 0xCE, 0xA4, 0xA5, 0x59, 0x49, 0x34, 0xA3, 0x2D, 0x24, 0xAC, 0xDE, 0x62,
+0x51, 0x49, 0x62, 0xD5, 0x69, 0xE1, 0x5B, 0x75, 0x7C, 0x35, 0xA3, 0x5D, 0x96, 0xF5, 0xDD, 0x59, 0xD2, 0x69, 0x55, 0xA6, 0x6C,
+0xED, 0xD4, 0xD8, 0x5C, 0x6B, 0x60, 0x1E, 0xB1, 0x76, 0x7B, 0xA0, 0xB4, 0x5B, 0xBF, 0x9A, 0xF7, 0xB0, 0x4A, 0x7A, 0xAD, 0xD1,
+0x51, 0xDF, 0x02, 0x4B, 0x3E, 0xDE, 0xC5, 0xAC, 0xC6, 0xCC, 0xE3, 0x76, 0x6E, 0x2F, 0xF0, 0x42, 0x2E, 0xE4, 0x36, 0x1F, 0x1C,
+0x73, 0x18, 0x5E, 0x64, 0x67, 0x6D, 0xDA, 0xEC, 0x2D, 0x6E, 0x22, 0xD9, 0xF6, 0x6B, 0x0A, 0x0B, 0x6B, 0xCE, 0xD7, 0x2A, 0xCB,
+0xAE, 0xDF, 0x3B, 0x65, 0xD2, 0xCB, 0x09, 0x6A, 0xB5, 0x2D, 0x34, 0xCD, 0x35, 0x09, 0x9A, 0x41, 0x25, 0x23, 0xAA, 0x49, 0x36,
+0xE3, 0x1A, 0xE0, 0xC5, 0x83, 0x18, 0x65, 0xCD, 0xCF, 0xDD, 0xE2, 0xDD, 0xE3, 0x01, 0x98, 0x5F, 0xC5, 0x23, 0xBF, 0xD0, 0x40,
+0x77, 0x7B, 0x6A, 0xB8, 0x4C, 0x3F, 0x27, 0x91, 0xB1, 0xC0, 0xB1, 0x59, 0x73, 0x8A, 0x92, 0x27, 0x13, 0x5F, 0x66, 0x83, 0x10,
+0x0D, 0x8E, 0x18, 0xD6, 0xAA, 0xEF, 0x02, 0x0A, 0x79, 0x40, 0x82, 0x9A, 0x65, 0xFF, 0x5F, 0x0B, 0x37, 0x1D, 0x16, 0xDD, 0xD1,
+0x82, 0x3A, 0x5C, 0xED, 0x2A, 0xD6, 0x8D, 0xF5, 0x6C, 0x5E, 0x60, 0x77, 0xB6, 0x30, 0xA6, 0x3B, 0x5B, 0x1C, 0xCE, 0x9D, 0xAD,
+0x10, 0xC9, 0x9D, 0x2D, 0x11, 0xC4, 0x9D, 0xAD, 0x10, 0xBF, 0x9D, 0xCD, 0x89, 0x28, 0xCE, 0xF4, 0x09, 0xC6, 0x32, 0x2E, 0xB3,
+0x05, 0xC1, 0xC6, 0xD9, 0x52, 0x71, 0xC6, 0x99, 0x36, 0x19, 0x55, 0xC3, 0x8C, 0x33, 0x6D, 0x36, 0xAA, 0x46, 0x19, 0x8B, 0xFD,
+0x30, 0xFB, 0x09, 0xC3, 0x92, 0xC8, 0x57, 0xF7, 0x99, 0xCA, 0x3E, 0x7B, 0x2E, 0x0E, 0xE8, 0x79, 0xC0, 0xA9, 0xAF, 0xC8, 0x76,
+0xAB, 0x7B, 0x72, 0x09, 0x46, 0xF9, 0x69, 0x4D, 0xB8, 0xC2, 0x99, 0xCB, 0x31, 0x09, 0x3F, 0xAD, 0x09, 0xA4, 0x5C, 0xB9, 0x0A,
+0xE6, 0x29, 0x9D, 0x47, 0xAC, 0xD4, 0xC7, 0x1D, 0xB9, 0x0A, 0x4A, 0x77, 0x3D, 0x56, 0x10, 0xEA, 0xBE, 0x4A, 0x55, 0xC2, 0x70,
+0x38, 0x56, 0x8A, 0x18, 0x3E, 0x4A, 0x2A, 0xC3, 0xED, 0x2F, 0x1B, 0x29, 0xCA, 0x59, 0xAC, 0xC1, 0x91, 0xFF, 0x77, 0x1E, 0x30,
+0x77, 0x18, 0x53, 0x09, 0xE1, 0x04, 0xB6, 0x41, 0x4B, 0x5F, 0x31, 0xC1, 0x19, 0x2E, 0x60, 0xBA, 0xCA, 0xDB, 0x20, 0x59, 0x39,
+0x8C, 0x15, 0xB0, 0x72, 0xFB, 0x56, 0x81, 0x95, 0x93, 0x58, 0xF1, 0x43, 0x3A, 0x7B, 0xAB, 0xBC, 0x50, 0x7E, 0x61, 0x05, 0xAB,
+0xBB, 0x5B, 0x2B, 0xE0, 0xBA, 0x83, 0xD6, 0x28, 0x61, 0xEF, 0x1C, 0xE5, 0x92, 0x25, 0x58, 0xCD, 0xAF, 0x6A, 0xE5, 0x9E, 0xE6,
+0x86, 0x25, 0x78, 0xE9, 0x5C, 0x35, 0x81, 0x75, 0x17, 0x2C, 0x47, 0x1B, 0x85, 0x25, 0x69, 0x94, 0xDE, 0x57, 0xFA, 0x4C, 0xBE,
+0xCE, 0xCA, 0x77, 0x91, 0x2C, 0x9B, 0x8B, 0x34, 0x77, 0xAC, 0x56, 0x60, 0x0A, 0xFF, 0x6B, 0x31, 0x3C, 0xB8, 0x3B, 0xD4, 0x3A,
+0xA6, 0xCA, 0x3E, 0xD4, 0xA2, 0x10, 0xBA, 0x46, 0xEB, 0x8B, 0x28, 0x5F, 0x2A, 0x6F, 0xB4, 0xEE, 0x20, 0xB5, 0x95, 0xA9, 0x3A,
+0x56, 0x39, 0x17, 0x0C, 0x27, 0xA9, 0xAD, 0xA0, 0xC5, 0xBD, 0x4A, 0x25, 0x95, 0x0B, 0x55, 0x41, 0x6A, 0x0E, 0x51, 0x39, 0xB1,
+0x1A, 0x7E, 0x65, 0x93, 0x53, 0xBA, 0x03, 0x7A, 0xD9, 0xFD, 0xF0, 0xEC, 0x1A, 0x1B, 0xE1, 0xA7, 0x5E, 0xAA, 0xD6, 0x69, 0x87,
+0xB0, 0x3A, 0xAC, 0x3F, 0x10, 0xE9, 0x7C, 0xA7, 0xB5, 0x40, 0xAC, 0x49, 0xB7, 0x84, 0xDB, 0xCF, 0x69, 0xE9, 0x4B, 0x4B, 0xD1,
+0x30, 0x19, 0x40, 0xA1, 0x61, 0xAF, 0xEE, 0x42, 0xD2, 0xA1, 0x44, 0x5C, 0xDB, 0x69, 0x21, 0x17, 0xD5, 0xB3, 0x11, 0x59, 0xED,
+0xB1, 0x88, 0xAC, 0x08, 0xC3, 0xA8, 0x1C, 0x8A, 0xC8, 0x8A, 0x08, 0x8C, 0xCA, 0x91, 0x88, 0x6C, 0xE1, 0x69, 0x08, 0x1E, 0xE7,
+0x5A, 0x4D, 0xC9, 0x8E, 0x0E, 0x8E, 0xF9, 0xB7, 0xD8, 0xA9, 0x5D, 0x55, 0xDA, 0xD7, 0x5C, 0x78, 0xE7, 0x1D, 0xB7, 0x46, 0x55,
+0x48, 0xC5, 0xE1, 0x2F, 0xDB, 0x96, 0x9A, 0x79, 0x7A, 0x74, 0x4B, 0xDD, 0x15, 0x23, 0x44, 0xAB, 0x5D, 0x99, 0x30, 0x4B, 0x5C,
+0x2F, 0x57, 0xA2, 0x42, 0x16, 0x45, 0x4E, 0x95, 0x7D, 0xDE, 0x73, 0xBC, 0xFE, 0xB5, 0xCE, 0xF3, 0x02, 0xCF, 0x5E, 0xE1, 0xA7,
+0x5E, 0xD9, 0x65, 0x4E, 0x83, 0x5F, 0xA3, 0xA3, 0xEA, 0x24, 0xE7, 0x16, 0x8D, 0xAA, 0xA1, 0xE2, 0x1D, 0x5F, 0x2A, 0x4D, 0xD3,
+0xE7, 0x2E, 0xA6, 0xA0, 0xC8, 0x84, 0x81, 0x78, 0xFB, 0x52, 0x37, 0x0E, 0x1F, 0xB3, 0xC6, 0xE3, 0x34, 0xC0, 0x3C, 0xB8, 0x3B,
+0x7D, 0x11, 0x78, 0xF8, 0xD9, 0x76, 0xED, 0xB7, 0xC8, 0x37, 0xB8, 0xC5, 0x2E, 0x59, 0x43, 0x4F, 0x37, 0xD8, 0xB0, 0x5F, 0x5C,
+0x2E, 0xEF, 0x09, 0x2F, 0xA5, 0x11, 0xCA, 0x5A, 0xE4, 0x6B, 0x11, 0x39, 0x08, 0xF8, 0xF8, 0x2C, 0x39, 0x18, 0xF1, 0x6D, 0x35,
+0x97, 0x04, 0xBE, 0xC5, 0xD4, 0x37, 0x94, 0x23, 0xE3, 0x6E, 0x8F, 0x1F, 0x2F, 0x9E, 0x9F, 0xDD, 0xB1, 0x94, 0xBB, 0x47, 0x36,
+0x7F, 0x41, 0x82, 0x47, 0x65, 0x75, 0x17, 0xF2, 0x1A, 0xFA, 0xDA, 0x05, 0x4B, 0x4B, 0x6C, 0x1A, 0x98, 0xBB, 0x0F, 0xE8, 0x04,
+0xC1, 0x45, 0x39, 0xFE, 0x90, 0x67, 0xAD, 0x59, 0x53, 0x3E, 0xCD, 0x43, 0xC7, 0x4F, 0x57, 0xFB, 0x61, 0x06, 0x46, 0x29, 0xAA,
+0x53, 0x67, 0x10, 0x25, 0xC3, 0x13, 0x47, 0xA4, 0x3D, 0x5E, 0xA9, 0x64, 0x9C, 0xC4, 0x81, 0x63, 0xDE, 0x6E, 0x5E, 0x4A, 0x9F,
+0x85, 0x0C, 0xD6, 0x6F, 0xEA, 0x9D, 0xA1, 0x4B, 0x50, 0xE9, 0x50, 0xFC, 0x4A, 0xB9, 0x47, 0xF3, 0x66, 0xA3, 0xD3, 0xE9, 0x34,
+0x78, 0x7A, 0xD2, 0x22, 0xA7, 0x13, 0x9E, 0xCC, 0x55, 0xB0, 0x7A, 0xD9, 0xE2, 0x64, 0xDF, 0xA7, 0xB8, 0xD3, 0x3D, 0x6E, 0xB3,
+0xC6, 0xA7, 0xF8, 0xFF, 0xFC, 0xAF, 0xFF, 0xAD, 0x5D, 0xA3, 0x6B, 0x14, 0xAF, 0xBF, 0x08, 0x99, 0x67, 0x3A, 0x43, 0xCB, 0x6A,
+0xE9, 0xAC, 0x81, 0x95, 0xEC, 0x64, 0x2B, 0x7A, 0xC6, 0x31, 0x0C, 0x9F, 0x27, 0xFD, 0x62, 0x22, 0xEF, 0x24, 0xC3, 0x3C, 0x96,
+0x48, 0x6E, 0x28, 0x13, 0x99, 0xFE, 0x33, 0xCC, 0x7F, 0x98, 0x0D, 0xDC, 0x65, 0xBD, 0xE6, 0x4B, 0x26, 0x3B, 0x1B, 0xF2, 0x83,
+0xBD, 0x1C, 0xA2, 0x3E, 0x57, 0xD8, 0x35, 0x33, 0xA3, 0xDD, 0x2A, 0xEA, 0x87, 0xB5, 0xE0, 0xAD, 0xA2, 0x32, 0x4B, 0x9A, 0xAA,
+0x22, 0x21, 0xDD, 0x90, 0x9F, 0x52, 0x2B, 0xF2, 0x54, 0x9D, 0x72, 0x32, 0x32, 0x7B, 0xFA, 0x2B, 0xB1, 0x1E, 0xC6, 0x39, 0xBB,
+0x48, 0x18, 0xD9, 0x04, 0x4D, 0x60, 0x04, 0xFB, 0xD3, 0x25, 0x85, 0x38, 0xA9, 0xE6, 0x29, 0xBF, 0xB0, 0xB0, 0xD9, 0x7D, 0xDA,
+0xFC, 0xE4, 0xDF, 0xC1, 0xDB, 0x59, 0xF1, 0x4F, 0xE7, 0x83, 0xFE, 0xD4, 0x2D, 0xA4, 0x86, 0x80, 0xD7, 0x1E, 0x03, 0xA2, 0xA7,
+0xA8, 0x92, 0x26, 0xDE, 0x17, 0xBC, 0xB5, 0xF0, 0xF5, 0x6C, 0x32, 0x08, 0xD2, 0x26, 0x7D, 0xFC, 0xD8, 0x3F, 0x6A, 0xB5, 0x31,
+0x29, 0x7E, 0xE5, 0xC3, 0xFA, 0x51, 0x0B, 0x15, 0xD4, 0x87, 0xBA, 0x82, 0x1B, 0x75, 0x05, 0xEF, 0x62, 0x41, 0x68, 0xDB, 0x16,
+0xC3, 0xA4, 0x67, 0xDA, 0x15, 0x95, 0x61, 0xF6, 0x3A, 0x38, 0xE3, 0x17, 0x85, 0x72, 0xDE, 0xB6, 0x65, 0x17, 0x6A, 0x87, 0xF6,
+0xF8, 0x17, 0x97, 0x6A, 0xA4, 0xA3, 0x9D, 0x02, 0x84, 0xBF, 0xD1, 0x54, 0x8C, 0x01, 0xB8, 0x6B, 0x82, 0x69, 0x07, 0x11, 0x25,
+0x18, 0x12, 0xAA, 0x83, 0xE1, 0xB3, 0x46, 0x9B, 0x90, 0xE0, 0x1D, 0xA3, 0x2F, 0x9A, 0x45, 0x06, 0xBC, 0x92, 0xCC, 0x95, 0x01,
+0x35, 0xE9, 0x30, 0xA4, 0x47, 0x17, 0x1D, 0x5B, 0x7A, 0xB3, 0x92, 0x94, 0x08, 0xA1, 0x84, 0x01, 0x44, 0xBB, 0x04, 0x76, 0x99,
+0xE1, 0x66, 0x02, 0xB1, 0x52, 0x72, 0xEB, 0xA9, 0xE2, 0xA4, 0xFB, 0xB4, 0x45, 0x79, 0x97, 0xCD, 0xEF, 0x1F, 0x8A, 0xEF, 0x1F,
+0x5A, 0x2A, 0xF7, 0xA1, 0xA0, 0x45, 0x24, 0x56, 0x6F, 0x7E, 0x7E, 0x12, 0x33, 0xB1, 0x7A, 0x83, 0xC1, 0x2D, 0x29, 0x92, 0x19,
+0xFD, 0xA0, 0x69, 0x57, 0x80, 0x96, 0x79, 0xA7, 0x30, 0xFE, 0x71, 0x9E, 0x76, 0x31, 0xB5, 0xDF, 0x1E, 0x46, 0xCC, 0x63, 0x6C,
+0xD8, 0x9B, 0x1F, 0x31, 0x0A, 0x0C, 0x0B, 0x86, 0x98, 0x9C, 0x1C, 0x4F, 0x4C, 0x80, 0x5E, 0x10, 0xE8, 0x62, 0xD0, 0x20, 0xC0,
+0x7D, 0x00, 0xDB, 0xC3, 0xB4, 0xE5, 0x91, 0x04, 0xF5, 0x06, 0x09, 0x58, 0xF8, 0x88, 0x67, 0xA5, 0x74, 0x82, 0x2D, 0x15, 0x3D,
+0xD8, 0x6C, 0x74, 0x93, 0xDC, 0xC3, 0x24, 0x76, 0xCC, 0xB8, 0x08, 0x94, 0x5D, 0xB5, 0xD6, 0x5C, 0x20, 0x20, 0xC6, 0x54, 0x8B,
+0x28, 0x5B, 0xF0, 0x47, 0x4C, 0x99, 0xF2, 0xC3, 0x24, 0x3B, 0xC6, 0x0F, 0xB2, 0x2B, 0xE0, 0x11, 0x3F, 0xD1, 0x54, 0x89, 0x33,
+0xA5, 0xFE, 0xAD, 0xC1, 0xDD, 0xFC, 0x61, 0x1C, 0xE6, 0xA1, 0x87, 0xB3, 0xA3, 0x68, 0x17, 0x54, 0x76, 0xC7, 0x92, 0x73, 0x4E,
+0x6C, 0x1C, 0x48, 0x6F, 0xA3, 0x39, 0xDD, 0xBE, 0x4E, 0x44, 0x61, 0x9D, 0x93, 0xEC, 0xE7, 0x64, 0x46, 0xF7, 0xAC, 0xCF, 0x32,
+0xDA, 0x46, 0x28, 0x34, 0xAA, 0xE8, 0x85, 0x95, 0x78, 0xF4, 0x79, 0xE9, 0x24, 0x88, 0x25, 0x69, 0xE4, 0xCD, 0xA4, 0xE9, 0x19,
+0xC9, 0xC0, 0x18, 0x7E, 0x41, 0xEB, 0x16, 0x73, 0xEE, 0x2C, 0x9B, 0x5D, 0x4F, 0x73, 0x96, 0x7E, 0x08, 0x47, 0x61, 0xB3, 0x4E,
+0xDC, 0x1A, 0x4F, 0x52, 0x9E, 0xE4, 0x2A, 0x9B, 0x89, 0x1F, 0x67, 0x1E, 0x0C, 0x2C, 0x10, 0x0B, 0xBA, 0xA8, 0x8A, 0x7D, 0x08,
+0x5F, 0x84, 0xCA, 0x1C, 0x79, 0xDC, 0x50, 0x66, 0x4D, 0xBF, 0x87, 0x76, 0x8D, 0x2E, 0x02, 0x41, 0x0A, 0x3C, 0x39, 0x83, 0xBA,
+0xBE, 0x92, 0x20, 0xC8, 0xAA, 0x16, 0x09, 0x04, 0xD1, 0x89, 0x9C, 0x42, 0x52, 0xE7, 0x0A, 0x83, 0x9D, 0x47, 0xC2, 0xB8, 0x3C,
+0xA0, 0x04, 0xDF, 0xD7, 0xE0, 0x53, 0x2A, 0x8C, 0x53, 0x3A, 0xFB, 0x4A, 0x48, 0xE6, 0xB2, 0x89, 0xDB, 0xAF, 0x55, 0x1E, 0xDD,
+0x84, 0x45, 0xED, 0xFE, 0x3A, 0x55, 0x33, 0x9F, 0x51, 0x82, 0x50, 0x64, 0x15, 0xA7, 0x73, 0x3E, 0xB3, 0x0C, 0xAB, 0xF0, 0x69,
+0xC6, 0xEF, 0x9C, 0xE0, 0x4B, 0xCF, 0xAC, 0x30, 0xBE, 0xF0, 0x3E, 0x1B, 0xEE, 0x21, 0x6E, 0xBC, 0xE2, 0x68, 0x1A, 0xDC, 0x9C,
+0xA6, 0x43, 0x75, 0xED, 0xB5, 0x9C, 0xA7, 0x02, 0x6F, 0x78, 0x48, 0x09, 0x3E, 0xF3, 0xE4, 0x3C, 0x98, 0x93, 0xAF, 0xBD, 0x96,
+0xC8, 0xEB, 0x24, 0x8A, 0x3B, 0x92, 0xAF, 0xE8, 0x2D, 0xE9, 0x27, 0xED, 0x25, 0x8C, 0x23, 0x19, 0x69, 0x94, 0x6D, 0x17, 0xF9,
+0xC8, 0xBC, 0x88, 0xD6, 0xA5, 0x8D, 0x01, 0xA7, 0xAE, 0x83, 0xD9, 0xB4, 0xD1, 0x1F, 0xE7, 0xC6, 0xFC, 0x3A, 0x0B, 0x0D, 0xF0,
+0x87, 0x7C, 0x12, 0x55, 0xCE, 0xCF, 0xD1, 0x17, 0x36, 0x82, 0xC5, 0x82, 0xC3, 0x42, 0x1F, 0x83, 0x9D, 0x04, 0xD2, 0x2B, 0xCC,
+0xD9, 0x3D, 0xA0, 0x43, 0x46, 0x3B, 0x4E, 0xA7, 0xEF, 0x80, 0x5A, 0x08, 0xBD, 0x4E, 0x84, 0xBB, 0x98, 0x60, 0x75, 0x0D, 0x2E,
+0x74, 0x50, 0xDA, 0xDB, 0x14, 0x10, 0xE3, 0xD0, 0xF7, 0x83, 0x78, 0xC7, 0xC1, 0x3D, 0x2F, 0x87, 0xC9, 0xCB, 0x7F, 0x07, 0xDE,
+0xF0, 0xC4, 0x4F, 0x93, 0xE9, 0x8E, 0x43, 0xFE, 0xE2, 0xA1, 0xB3, 0x5B, 0xA5, 0xA2, 0xE3, 0x87, 0x1E, 0xD8, 0x3F, 0x4C, 0x7F,
+0xE8, 0x0C, 0x45, 0xE6, 0x39, 0x6B, 0x01, 0x91, 0x33, 0xDD, 0xFA, 0x8D, 0x2F, 0x80, 0xF0, 0xD3, 0x78, 0xD3, 0xFC, 0x42, 0xBD,
+0x55, 0x6E, 0x2D, 0x6F, 0xC2, 0xEE, 0xED, 0x4B, 0xFA, 0x7A, 0xF5, 0xA8, 0x3B, 0xDE, 0x2C, 0xCE, 0x69, 0x61, 0x0F, 0xEE, 0x38,
+0xFC, 0xC1, 0xD1, 0x4E, 0x6D, 0x75, 0x86, 0x51, 0x92, 0x69, 0xAD, 0x04, 0x0B, 0x7E, 0x12, 0xAA, 0x8A, 0x74, 0x96, 0xED, 0x38,
+0x7B, 0x04, 0x6A, 0x39, 0x91, 0x55, 0xA1, 0x1C, 0x45, 0x47, 0x9D, 0x94, 0x3F, 0x1B, 0x87, 0x79, 0xD0, 0xC9, 0xA6, 0x1E, 0xDE,
+0x60, 0x3B, 0x4D, 0x83, 0xCE, 0x59, 0xEA, 0x4D, 0xB7, 0x91, 0x50, 0x04, 0xBB, 0xAA, 0x45, 0x32, 0x82, 0x11, 0x46, 0xCD, 0xBF,
+0x7D, 0x99, 0xCB, 0x94, 0xF2, 0x8D, 0x21, 0x17, 0xB5, 0x06, 0xE6, 0x51, 0x58, 0xD4, 0x36, 0x7E, 0x2E, 0xB8, 0x38, 0x41, 0x57,
+0xD7, 0x46, 0x93, 0x8D, 0x1D, 0xE2, 0x0A, 0xC9, 0xAE, 0x53, 0xCC, 0xB1, 0xBC, 0xC5, 0x9F, 0xF9, 0x72, 0x75, 0x6D, 0xA9, 0x9A,
+0xE5, 0x01, 0x4A, 0x1B, 0xFE, 0xE4, 0x84, 0x3A, 0xCA, 0xD6, 0xAC, 0xC6, 0x9B, 0x1F, 0x69, 0x55, 0x4C, 0xDC, 0xC6, 0x63, 0x94,
+0xF6, 0xF3, 0x6F, 0xC6, 0x9F, 0xCF, 0x5A, 0xF0, 0x1C, 0x32, 0xD5, 0x05, 0xC3, 0x01, 0x46, 0xEA, 0x13, 0xFF, 0x8B, 0x87, 0xD2,
+0x87, 0xC1, 0x31, 0xCD, 0xC6, 0x20, 0x80, 0x59, 0x28, 0x08, 0x62, 0x4C, 0x54, 0xAB, 0x46, 0x93, 0x39, 0xBE, 0xC4, 0xAA, 0x6E,
+0x8E, 0x63, 0x41, 0xB4, 0xA2, 0x48, 0xDD, 0xC7, 0x07, 0x6D, 0xCD, 0xE5, 0x36, 0x3A, 0x52, 0x71, 0x8F, 0x50, 0x28, 0x95, 0xB1,
+0xBE, 0x3B, 0x57, 0x57, 0xDB, 0xE7, 0x0A, 0xDB, 0x3E, 0x2F, 0x73, 0x55, 0x8D, 0x59, 0x07, 0xDF, 0xA2, 0x17, 0x84, 0xAA, 0x6B,
+0x5E, 0x94, 0xD6, 0x92, 0x69, 0x8E, 0x70, 0xBE, 0xA8, 0x76, 0xC8, 0xBC, 0xA8, 0xBD, 0xCF, 0x56, 0xA1, 0x59, 0x8A, 0x42, 0x0B,
+0x35, 0x54, 0xB8, 0xA9, 0x4E, 0x29, 0xEA, 0xAC, 0xB3, 0x20, 0xE4, 0x3A, 0xCA, 0x1D, 0xD0, 0x7E, 0x8B, 0x17, 0xE9, 0x8D, 0x17,
+0x37, 0x03, 0x2A, 0x0E, 0x7C, 0xFF, 0x3D, 0xB3, 0xB7, 0xCB, 0xA8, 0xB4, 0x48, 0xBC, 0x53, 0x5F, 0x98, 0xAB, 0x7F, 0x51, 0x54,
+0xE3, 0x9E, 0x49, 0x2C, 0x3F, 0xF2, 0x29, 0x5B, 0x22, 0x5B, 0x2A, 0x2F, 0x27, 0x22, 0x36, 0x8B, 0xE9, 0x43, 0xC4, 0x34, 0x55,
+0xB3, 0xBD, 0xF1, 0x50, 0xA5, 0x05, 0x22, 0xD8, 0xB2, 0xF0, 0x11, 0xE6, 0x98, 0x36, 0x13, 0xE8, 0xCB, 0x33, 0xA0, 0x9A, 0x72,
+0xC5, 0x44, 0x49, 0x6A, 0x72, 0xA7, 0xF1, 0x4C, 0xDD, 0xF8, 0xC0, 0x28, 0x9E, 0xB3, 0xD1, 0x16, 0xE5, 0x77, 0x7A, 0xDA, 0x0A,
+0x09, 0xA5, 0x1B, 0xAF, 0x6B, 0x0B, 0xB3, 0x00, 0xE7, 0xF6, 0x24, 0x3A, 0x15, 0x61, 0x48, 0xFA, 0xBC, 0xCA, 0x35, 0x2F, 0x4F,
+0xFB, 0xAC, 0x6A, 0xE1, 0x19, 0xAA, 0xF9, 0xC4, 0x29, 0x30, 0xB7, 0x15, 0xFB, 0xB6, 0x04, 0xAE, 0xB6, 0xEC, 0x0B, 0xF9, 0xE2,
+0x4A, 0x09, 0x82, 0x46, 0xBF, 0xE4, 0xB9, 0xD9, 0x02, 0x69, 0x3E, 0x2C, 0x22, 0x5B, 0xD2, 0xDD, 0xB2, 0x10, 0xCE, 0xE7, 0x7F,
+0xE9, 0x42, 0x93, 0xF8, 0x69, 0xDE, 0xDF, 0x2A, 0x84, 0x46, 0x4D, 0xFC, 0xDA, 0xA4, 0xBF, 0x25, 0x04, 0x4F, 0x20, 0xE7, 0x81,
+0x22, 0xC5, 0xF4, 0x5F, 0xFE, 0xCC, 0x63, 0x70, 0xD6, 0x8A, 0xE6, 0xD5, 0x7A, 0x30, 0x31, 0x83, 0x7E, 0x07, 0xE6, 0x6F, 0xEB,
+0xE5, 0x54, 0x48, 0x3C, 0x49, 0x3F, 0x02, 0x98, 0xB2, 0x2F, 0x6E, 0xDA, 0xC1, 0xE2, 0x3F, 0x85, 0xC1, 0x19, 0xE5, 0x26, 0x13,
+0xBF, 0x5D, 0x32, 0x9D, 0x9A, 0x16, 0xAF, 0x41, 0x36, 0x4C, 0xC3, 0x69, 0x3E, 0x27, 0x0B, 0x00, 0x07, 0x40, 0x27, 0x12, 0xFF,
+0x25, 0xAE, 0x3B, 0x6A, 0x74, 0x11, 0xF7, 0x29, 0xE2, 0x7E, 0x70, 0x77, 0xBD, 0xF7, 0xD0, 0xBF, 0x3B, 0x74, 0xBF, 0x64, 0x0D,
+0x05, 0x95, 0xC4, 0x94, 0x69, 0x5B, 0xDA, 0x40, 0x55, 0x42, 0x54, 0x7D, 0x38, 0xD9, 0x1B, 0xC1, 0x62, 0x1C, 0x43, 0xF9, 0xBE,
+0xA9, 0x95, 0xB8, 0x54, 0x28, 0x89, 0x25, 0xD8, 0xA4, 0xD1, 0x96, 0x4C, 0xE5, 0xE8, 0x7D, 0xD4, 0xE5, 0x64, 0x60, 0x92, 0x00,
+0xCE, 0x22, 0xCA, 0x87, 0x23, 0x43, 0x48, 0x87, 0x7E, 0x0C, 0xCD, 0xF5, 0xF1, 0xB6, 0x83, 0xD4, 0x8D, 0x83, 0xBC, 0x1B, 0x4F,
+0x27, 0x5D, 0x35, 0x09, 0xFC, 0x63, 0xD3, 0xDD, 0x70, 0x1F, 0xC0, 0x04, 0x95, 0xE5, 0xDD, 0x2F, 0x59, 0xF1, 0xDE, 0x1D, 0xCC,
+0xD0, 0x64, 0x47, 0xBF, 0x01, 0x94, 0x86, 0xF9, 0x11, 0x4C, 0xA0, 0x63, 0xDC, 0xA7, 0x01, 0xD3, 0x6A, 0xEC, 0x6D, 0x3C, 0xB8,
+0xDB, 0x79, 0xF1, 0xE3, 0x45, 0xF2, 0xFC, 0x45, 0x92, 0xEE, 0xFD, 0x33, 0xBA, 0x38, 0x3D, 0x3B, 0x7F, 0xF8, 0xC3, 0x97, 0xDE,
+0xC3, 0x7F, 0x0D, 0x7F, 0x8E, 0x37, 0xE2, 0xD3, 0xFB, 0x67, 0xE1, 0xDB, 0x9F, 0xA2, 0xDF, 0xEE, 0xFF, 0xFC, 0xF3, 0xD9, 0xBF,
+0xD2, 0x0F, 0x3F, 0x0D, 0xFF, 0xFB, 0xC7, 0xEE, 0xD3, 0x49, 0xFC, 0xD3, 0xB3, 0xF3, 0x57, 0x77, 0x9E, 0xAD, 0x67, 0xC3, 0xFF,
+0x1A, 0xBC, 0x3C, 0x3C, 0x7F, 0x09, 0x73, 0x71, 0x9A, 0x64, 0x59, 0x92, 0x86, 0xC7, 0x21, 0x18, 0x72, 0x5E, 0x9C, 0xC4, 0x17,
+0x93, 0x64, 0x96, 0xA1, 0xF1, 0xA2, 0x1A, 0xD4, 0x45, 0x61, 0xC7, 0xBF, 0x63, 0x98, 0x07, 0x77, 0xD7, 0xFE, 0x2F, 0x88, 0xF3,
+0xB5, 0x04, 0xF4, 0x26, 0x01, 0x00
 };
@@ -1,203 +1,187 @@
+// Generated from web/keys.htm (27928a9e60b862ef) - do not edit
 #include <Arduino.h>
 static const uint8_t keyshtm[] = {
-0x1F, 0x8B, 0x08, 0x00, 0xD0, 0x6D, 0xF8, 0x69, 0x02, 0xFF, 0xE5, 0x3B, 0x6B, 0x77, 0xDB, 0xB6, 0xD9, 0xDF, 0x77, 0xCE, 0xFE,
-0x03, 0xC2, 0x79, 0x95, 0x74, 0x26, 0x92, 0x92, 0x2F, 0xB9, 0xC8, 0x96, 0xBB, 0x24, 0x76, 0x53, 0x37, 0x76, 0xE3, 0x35, 0x5E,
-0xB2, 0x9C, 0x6D, 0x6F, 0x0D, 0x91, 0x90, 0x84, 0x98, 0x24, 0x58, 0x02, 0xB4, 0xAC, 0x65, 0xFA, 0xEF, 0x7B, 0x1E, 0x80, 0x94,
-0x28, 0x5E, 0x24, 0xDB, 0xED, 0x76, 0xDA, 0xF3, 0xFA, 0x43, 0x42, 0x81, 0xC0, 0x73, 0xBF, 0x02, 0xE0, 0xD1, 0x93, 0x93, 0x77,
-0xAF, 0xAF, 0x3E, 0x5D, 0x9E, 0x92, 0xA9, 0x0A, 0x83, 0xE3, 0xDF, 0xFF, 0xEE, 0x08, 0xFF, 0x27, 0x01, 0x8D, 0x26, 0x43, 0x8B,
-0x45, 0x96, 0x1E, 0x61, 0xD4, 0x87, 0xFF, 0x09, 0xFC, 0x1D, 0x05, 0x3C, 0xBA, 0x21, 0xD3, 0x84, 0x8D, 0x87, 0xD6, 0x54, 0xA9,
-0x58, 0x0E, 0x5C, 0xD7, 0xF3, 0x23, 0xE7, 0xB3, 0xF4, 0x59, 0xC0, 0x6F, 0x13, 0x27, 0x62, 0xCA, 0x8D, 0xE2, 0xD0, 0x1D, 0x09,
-0xA1, 0xA4, 0x4A, 0x68, 0xFC, 0xE7, 0x03, 0x67, 0xCF, 0x79, 0xEE, 0xFA, 0x5C, 0x2A, 0xD7, 0x93, 0x72, 0xF5, 0xC2, 0x09, 0x79,
-0xE4, 0xC0, 0x88, 0x45, 0x12, 0x16, 0x0C, 0x2D, 0xA9, 0xE6, 0x01, 0x93, 0x53, 0xC6, 0x94, 0x95, 0xE3, 0x92, 0x5E, 0xC2, 0x63,
-0x45, 0x64, 0xE2, 0xAD, 0x90, 0xD1, 0xCF, 0xF4, 0xCE, 0x99, 0x08, 0x31, 0x09, 0x18, 0x8D, 0xB9, 0x74, 0x3C, 0x11, 0xEA, 0x31,
-0x37, 0xE0, 0x23, 0xE9, 0x7E, 0xFE, 0x29, 0x65, 0xC9, 0xDC, 0xDD, 0x73, 0x9E, 0x39, 0xFD, 0xEC, 0x87, 0x46, 0xF3, 0x59, 0x5A,
-0xC7, 0x47, 0xAE, 0x81, 0x97, 0x43, 0x0F, 0x99, 0xA2, 0xC4, 0x9B, 0xD2, 0x44, 0x32, 0x35, 0xB4, 0xFE, 0x7A, 0xF5, 0x8D, 0xFD,
-0xDC, 0x5A, 0x7B, 0x17, 0xD1, 0x90, 0x0D, 0xAD, 0x5B, 0xCE, 0x66, 0xB1, 0x48, 0x94, 0x45, 0x3C, 0x11, 0x29, 0x16, 0xC1, 0xDC,
-0x54, 0xB2, 0xC4, 0x96, 0x1E, 0x0D, 0xE8, 0x28, 0x60, 0xC3, 0x48, 0x74, 0x09, 0x8F, 0xB8, 0xE2, 0x34, 0xD0, 0x83, 0x6C, 0xD8,
-0xEF, 0x92, 0x90, 0xDE, 0xF1, 0x30, 0x0D, 0x0B, 0x03, 0x30, 0x65, 0x6D, 0x60, 0xC6, 0x7D, 0x35, 0x1D, 0xFA, 0xEC, 0x96, 0x7B,
-0xCC, 0xD6, 0x3F, 0xEA, 0xB0, 0xD3, 0x38, 0x0E, 0x98, 0x1D, 0x8A, 0x11, 0x87, 0xFF, 0x66, 0x6C, 0x64, 0xC3, 0x80, 0xED, 0xD1,
-0x18, 0x31, 0x17, 0x28, 0x9A, 0x33, 0x10, 0xA3, 0x7B, 0xDF, 0xF5, 0x52, 0x51, 0x95, 0x4A, 0x7B, 0x44, 0x81, 0x0B, 0x94, 0x7A,
-0x01, 0x90, 0xCF, 0xC6, 0x34, 0x0D, 0x54, 0x01, 0x98, 0x56, 0xB8, 0xD6, 0x90, 0x81, 0xA5, 0x44, 0xEA, 0x4D, 0x6D, 0x0E, 0x2B,
-0xAC, 0xCC, 0x0E, 0xC6, 0xF4, 0x16, 0x7F, 0x3A, 0x71, 0x34, 0xB1, 0xAA, 0xAB, 0x9A, 0x66, 0x12, 0x35, 0x8F, 0x81, 0x40, 0x1E,
-0xD2, 0x09, 0x73, 0xF5, 0xC0, 0x12, 0xA5, 0xE2, 0x2A, 0x60, 0xC7, 0x27, 0x2C, 0xA6, 0x89, 0x4A, 0x13, 0x26, 0xC9, 0x2B, 0x41,
-0x13, 0xFF, 0xC8, 0x35, 0xE3, 0x6B, 0xC6, 0x91, 0xFD, 0xC2, 0xBF, 0x76, 0xBB, 0x43, 0x86, 0xC7, 0xE4, 0xCB, 0x6A, 0x04, 0x50,
-0x49, 0x45, 0xD4, 0x94, 0x85, 0xEC, 0x82, 0x2A, 0x6F, 0xCA, 0x12, 0x32, 0x04, 0xB9, 0x47, 0xBE, 0x98, 0x39, 0x21, 0x0E, 0x5C,
-0x30, 0x9F, 0xD3, 0x76, 0xAB, 0x1D, 0x03, 0x75, 0x2C, 0x91, 0xB6, 0x27, 0x02, 0x81, 0x9A, 0xC5, 0x15, 0x03, 0xE2, 0xD3, 0xE4,
-0xA6, 0xD3, 0xEA, 0x1C, 0x96, 0x01, 0xA2, 0x1C, 0xE6, 0x57, 0x38, 0x07, 0xC0, 0x65, 0x48, 0x89, 0x2F, 0xBC, 0x34, 0x04, 0x11,
-0x3A, 0xF9, 0xC3, 0x69, 0xC0, 0xF4, 0x6F, 0xB0, 0xAE, 0x97, 0x4A, 0x25, 0x7C, 0x94, 0x2A, 0xD6, 0x6E, 0xF9, 0x54, 0x51, 0x7B,
-0x24, 0x6D, 0x4D, 0x54, 0xAB, 0xBB, 0x46, 0x9C, 0xA1, 0x09, 0xD8, 0xFD, 0x9A, 0xB4, 0x10, 0x77, 0x8B, 0x0C, 0x48, 0x2B, 0xE0,
-0x93, 0xA9, 0x02, 0x22, 0xC8, 0xA2, 0x40, 0xC7, 0x8A, 0x82, 0x76, 0x91, 0xBC, 0x35, 0x60, 0xD4, 0xF7, 0x4F, 0x6F, 0x81, 0x80,
-0x73, 0x70, 0x3C, 0x16, 0xB1, 0xA4, 0xDD, 0x02, 0x5B, 0x8F, 0x26, 0x88, 0x74, 0xB5, 0xBC, 0xB8, 0x7A, 0xD1, 0x59, 0x02, 0x2B,
-0xB8, 0xCA, 0x91, 0x9B, 0x79, 0xFF, 0x91, 0x36, 0x95, 0x4C, 0xDE, 0x83, 0x04, 0xBC, 0x98, 0x7C, 0xB1, 0x91, 0x95, 0x91, 0xF0,
-0xE7, 0xF6, 0x18, 0x0C, 0xC8, 0x96, 0xFC, 0x5F, 0x20, 0xB6, 0x9E, 0xF3, 0xFC, 0xD9, 0x41, 0xC2, 0xC2, 0xC3, 0x85, 0x99, 0xEB,
-0x8C, 0x54, 0x94, 0x4F, 0x55, 0xD1, 0xB6, 0x99, 0xB6, 0x48, 0x15, 0x18, 0x0F, 0xB3, 0x25, 0x03, 0x69, 0x83, 0x18, 0xE6, 0xE4,
-0x4B, 0x61, 0x49, 0xBF, 0x38, 0x7D, 0x2C, 0x92, 0xD0, 0x46, 0xD3, 0x4D, 0x44, 0xD0, 0xCD, 0x7E, 0x4A, 0x16, 0x30, 0x4F, 0xAD,
-0xAD, 0xB9, 0xA5, 0x49, 0xBB, 0x86, 0xD2, 0xCE, 0x3A, 0x1C, 0x70, 0x66, 0xB6, 0x84, 0x02, 0x12, 0xF4, 0x6E, 0xCC, 0x50, 0x06,
-0x6A, 0xC6, 0x50, 0x11, 0x83, 0x83, 0x5E, 0x0F, 0x97, 0x81, 0x80, 0x32, 0x69, 0x1C, 0x21, 0x50, 0xE2, 0x05, 0x54, 0xCA, 0xA1,
-0x35, 0x9A, 0x18, 0x1C, 0x8A, 0x25, 0x10, 0x0E, 0x80, 0xF4, 0x78, 0x6E, 0xEF, 0x2F, 0x7D, 0xC2, 0xE7, 0xB7, 0x44, 0x2F, 0x1B,
-0x5A, 0xDA, 0xDF, 0x07, 0x18, 0x14, 0xDA, 0x2F, 0x7A, 0x7F, 0xEC, 0x12, 0x00, 0x1B, 0xDF, 0x81, 0x92, 0x43, 0x9A, 0x4C, 0x78,
-0x04, 0x92, 0x21, 0x34, 0x55, 0xE2, 0x90, 0xC4, 0xA0, 0x45, 0x1E, 0x4D, 0x70, 0xA0, 0x0F, 0x33, 0x0E, 0xAD, 0x82, 0xBD, 0x6B,
-0x78, 0x19, 0x62, 0x0F, 0xFC, 0x83, 0xC8, 0x29, 0x05, 0xCB, 0xB6, 0x65, 0x48, 0x46, 0x22, 0xF1, 0x21, 0x44, 0xF5, 0x8A, 0xD3,
-0xEB, 0x96, 0xD8, 0xA8, 0x5B, 0xF0, 0x0A, 0xA0, 0x3B, 0x4E, 0xC0, 0x13, 0x81, 0x62, 0xC5, 0xEE, 0x80, 0xD9, 0x29, 0x57, 0xCC,
-0x3C, 0x7A, 0x60, 0x42, 0x30, 0x03, 0x18, 0xD9, 0x2B, 0x43, 0xD3, 0x10, 0xA7, 0x07, 0x39, 0xC0, 0x70, 0x84, 0x08, 0xCB, 0x5E,
-0x4B, 0xDE, 0x33, 0x95, 0xC6, 0x60, 0x45, 0x07, 0x65, 0x5A, 0x20, 0x25, 0xDC, 0x6E, 0xA3, 0x4F, 0x0B, 0x37, 0x5E, 0xC9, 0x70,
-0x6D, 0x32, 0x6A, 0x8A, 0x70, 0x1F, 0xC2, 0x0A, 0x3C, 0x80, 0x9B, 0x29, 0x90, 0x94, 0xAC, 0x9B, 0x59, 0x06, 0x0D, 0x94, 0xEE,
-0x37, 0xCD, 0x33, 0xD1, 0x4B, 0x2B, 0x3E, 0x9B, 0xBD, 0xB2, 0x0E, 0x32, 0x9E, 0x01, 0x45, 0x81, 0x6F, 0x11, 0x18, 0x1B, 0x5A,
-0x89, 0x1F, 0x02, 0xB7, 0x6F, 0xD9, 0xDC, 0x3A, 0xFE, 0xE1, 0xE4, 0x0D, 0x39, 0xE7, 0xB7, 0x8C, 0x2C, 0xD9, 0xCF, 0xB8, 0x7F,
-0x79, 0x79, 0x46, 0x6E, 0xD8, 0xFC, 0xC8, 0xD5, 0x00, 0x36, 0xE1, 0xE4, 0x51, 0x9C, 0x2A, 0xCD, 0xCE, 0x0A, 0x6E, 0x16, 0x23,
-0x51, 0x11, 0x16, 0x89, 0x03, 0xEA, 0xB1, 0x29, 0xA0, 0x67, 0x80, 0xFB, 0x5D, 0xAC, 0xB8, 0x88, 0x68, 0x10, 0xCC, 0xBB, 0xC4,
-0x68, 0x68, 0x2E, 0xD2, 0x44, 0x07, 0x28, 0x88, 0x3E, 0x09, 0xB8, 0x38, 0x47, 0xBC, 0xD6, 0x1A, 0x13, 0x99, 0xAB, 0x6C, 0x64,
-0xBD, 0x20, 0x26, 0xBD, 0x46, 0xE3, 0x3E, 0xFE, 0x24, 0x52, 0x08, 0x9C, 0x41, 0x40, 0x22, 0xC6, 0x7C, 0x42, 0xC9, 0x11, 0x2D,
-0xD5, 0x00, 0x09, 0xE5, 0x01, 0xC6, 0x36, 0x47, 0x24, 0x13, 0x27, 0xBD, 0x71, 0xF1, 0xF9, 0x32, 0x11, 0x7E, 0xEA, 0x29, 0xF7,
-0xD2, 0xF6, 0x9F, 0xF7, 0xFD, 0xA7, 0x8C, 0x8E, 0xED, 0xE7, 0xBD, 0xA7, 0x3D, 0x7B, 0x7F, 0xFF, 0xE9, 0x33, 0x9B, 0xEE, 0xED,
-0xBD, 0xB0, 0xFB, 0xDE, 0xF3, 0xBD, 0x3D, 0x76, 0xD0, 0xF3, 0x46, 0x23, 0xE6, 0x8A, 0x5B, 0x96, 0x60, 0xB2, 0x05, 0xAE, 0xC1,
-0x0B, 0x30, 0x27, 0xFF, 0x38, 0x82, 0x32, 0xE4, 0xC6, 0x3A, 0xAE, 0x95, 0x6C, 0xBB, 0xEF, 0xF4, 0x3B, 0x47, 0x2E, 0x3D, 0x26,
-0xAF, 0x73, 0xA6, 0x41, 0x64, 0x64, 0x9C, 0x88, 0x90, 0xFC, 0x00, 0xD4, 0x90, 0x13, 0x20, 0x81, 0x5C, 0x40, 0x1C, 0x65, 0x4A,
-0x8B, 0x8E, 0xF0, 0x31, 0x0A, 0x89, 0xCC, 0x68, 0x04, 0x49, 0x41, 0x10, 0xA8, 0x48, 0x60, 0x7C, 0x4E, 0xBE, 0xA7, 0x46, 0x94,
-0x66, 0x95, 0xBF, 0xB4, 0x5F, 0x87, 0x20, 0xD7, 0x1E, 0x8D, 0x20, 0x8F, 0x4D, 0x30, 0x88, 0x26, 0xA8, 0x76, 0x42, 0x3D, 0x8F,
-0x49, 0x09, 0x78, 0x18, 0x23, 0x62, 0xAC, 0x0B, 0x88, 0x09, 0xDB, 0x2E, 0x90, 0x1C, 0xC6, 0x25, 0x40, 0x87, 0x68, 0x5C, 0x65,
-0x12, 0x62, 0x36, 0x43, 0x76, 0x1C, 0xF2, 0x8D, 0x08, 0x02, 0x31, 0xC3, 0x68, 0x4E, 0xC6, 0x29, 0xC8, 0x9C, 0x43, 0xD2, 0x49,
-0x40, 0x90, 0x40, 0xA5, 0xAC, 0x22, 0x5A, 0x11, 0x0C, 0xB6, 0x09, 0x82, 0x71, 0x26, 0x5C, 0x4D, 0xD3, 0x91, 0xC3, 0x85, 0xBB,
-0xF2, 0x45, 0x5B, 0xCB, 0xCC, 0x06, 0x6B, 0xB4, 0x41, 0x48, 0xD2, 0x7E, 0x93, 0x72, 0x9F, 0x39, 0xB1, 0x3F, 0xDE, 0x40, 0x47,
-0x9D, 0x83, 0x6E, 0x72, 0xDE, 0xFF, 0xAE, 0xA7, 0xBD, 0xBF, 0xF5, 0x96, 0x9E, 0xF6, 0x1E, 0x0D, 0xC5, 0x43, 0x93, 0x50, 0x20,
-0x65, 0xF9, 0x58, 0x27, 0xCB, 0x40, 0xFE, 0x6A, 0x9C, 0xEC, 0xCC, 0xD8, 0x27, 0x0D, 0xA4, 0xA8, 0x18, 0x29, 0xE6, 0x81, 0xCC,
-0x4C, 0x8F, 0xF8, 0xF1, 0x39, 0x85, 0x32, 0x44, 0x32, 0x16, 0x11, 0xAA, 0x8E, 0x5C, 0x7E, 0x0C, 0x26, 0x82, 0x70, 0xB4, 0x21,
-0x6B, 0x23, 0x5D, 0xB7, 0x69, 0x69, 0xE4, 0x25, 0xBB, 0xC6, 0xFE, 0x1F, 0xEF, 0xC7, 0xFB, 0x3E, 0xF3, 0xFA, 0xBB, 0xFB, 0xCF,
-0x6C, 0xBF, 0xB7, 0x0F, 0x7E, 0xBC, 0xFB, 0xA2, 0x07, 0x1E, 0x4D, 0xF7, 0xED, 0xA7, 0x7B, 0x2F, 0xFC, 0x31, 0xF5, 0x0E, 0xF6,
-0xE9, 0x8B, 0xDD, 0x0D, 0x7E, 0x5C, 0xD6, 0xDB, 0x83, 0x5D, 0xF8, 0xD7, 0x64, 0x93, 0x51, 0xA2, 0xED, 0x71, 0x5D, 0xD2, 0x57,
-0xE2, 0x06, 0x94, 0xD2, 0x3E, 0x67, 0x13, 0xEA, 0xCD, 0x3B, 0x0F, 0x32, 0x48, 0x03, 0xEF, 0xC1, 0xC6, 0xB8, 0xF7, 0x54, 0x87,
-0x20, 0xEA, 0xE1, 0x88, 0x42, 0xF4, 0xBF, 0xB0, 0x39, 0x4E, 0x29, 0x04, 0x5F, 0x5A, 0xB2, 0xA8, 0xD3, 0xE8, 0xA7, 0x94, 0x27,
-0x1C, 0x92, 0xFC, 0x09, 0x4D, 0xA0, 0xA2, 0x86, 0xE4, 0x07, 0x05, 0xC3, 0x47, 0x36, 0xCA, 0x4C, 0xCD, 0x50, 0xA2, 0xD7, 0x63,
-0x00, 0x95, 0x0A, 0x6D, 0x0E, 0xDA, 0x26, 0x1D, 0xD4, 0x02, 0x2D, 0x1D, 0x82, 0xA6, 0x45, 0xC6, 0x60, 0x87, 0x0E, 0xB9, 0x9A,
-0x72, 0xA9, 0x1F, 0x09, 0xFC, 0x1F, 0xF0, 0x1B, 0x16, 0xCC, 0xD1, 0xF8, 0x47, 0x0C, 0xED, 0x1F, 0x39, 0xE0, 0x51, 0x8A, 0x2F,
-0xA3, 0x2C, 0x28, 0xEA, 0x34, 0x80, 0x5E, 0xC2, 0x20, 0x36, 0x43, 0x07, 0x08, 0x85, 0xB6, 0xBF, 0x8C, 0xD2, 0x50, 0x05, 0x80,
-0x8D, 0xAB, 0xA9, 0x9E, 0x5B, 0x9F, 0x09, 0xDA, 0x74, 0x04, 0x56, 0xDA, 0x71, 0x80, 0x0F, 0x2D, 0xB6, 0x69, 0x4E, 0x30, 0xBB,
-0x03, 0x41, 0x02, 0x72, 0x2A, 0x11, 0x30, 0x83, 0xBC, 0x03, 0x89, 0x26, 0x47, 0xAB, 0x3D, 0x8C, 0x44, 0xD9, 0x9F, 0x5D, 0xF3,
-0x4F, 0xFE, 0xD7, 0x59, 0xE5, 0x0E, 0x2F, 0x4D, 0x12, 0x50, 0x17, 0xC0, 0x34, 0x42, 0x58, 0xCF, 0x25, 0x19, 0xDA, 0xAD, 0xC9,
-0x84, 0xD1, 0x40, 0xF1, 0x90, 0x39, 0x51, 0xA6, 0x05, 0x74, 0x53, 0x68, 0x7D, 0xD1, 0x43, 0xDF, 0xC5, 0x2C, 0x3A, 0x3F, 0x79,
-0xF5, 0xF1, 0xFD, 0x0F, 0x1A, 0x72, 0xA2, 0x67, 0xFC, 0x36, 0xC2, 0xBA, 0x98, 0x85, 0xDA, 0x87, 0x90, 0x85, 0x8F, 0x8C, 0x2A,
-0x6C, 0xD0, 0x2E, 0x68, 0xAC, 0xE3, 0xF9, 0xDB, 0x07, 0xC6, 0xF3, 0x0C, 0xD6, 0x83, 0xFD, 0x27, 0xCB, 0x1D, 0xBF, 0x94, 0xD3,
-0x9C, 0x56, 0x20, 0x97, 0xCB, 0x0E, 0x09, 0xEF, 0xC0, 0x04, 0x67, 0x19, 0xBF, 0xC6, 0x0B, 0x30, 0xE2, 0x95, 0xA4, 0xD0, 0x54,
-0x7E, 0x18, 0x63, 0x81, 0x2A, 0x44, 0xA4, 0x00, 0xB0, 0x62, 0x2A, 0x53, 0x01, 0x66, 0x22, 0x00, 0x54, 0x86, 0x20, 0x04, 0x48,
-0x10, 0xCB, 0x5D, 0xDC, 0xB3, 0x90, 0xAE, 0xE4, 0x93, 0xE8, 0xC7, 0x34, 0xDE, 0x54, 0x7D, 0x40, 0x5F, 0x48, 0x74, 0x21, 0x61,
-0x12, 0x45, 0x9E, 0x80, 0xEA, 0xE9, 0xB5, 0x2F, 0x98, 0x62, 0x02, 0x59, 0x8C, 0xC4, 0x8A, 0x61, 0x69, 0x04, 0x0C, 0x9E, 0xFD,
-0x2B, 0x32, 0x36, 0x68, 0x7A, 0xB5, 0xB1, 0x5D, 0x25, 0x34, 0x92, 0xB8, 0xA1, 0xA3, 0xC5, 0x79, 0x0E, 0x3D, 0x26, 0xE4, 0xCC,
-0xC7, 0x58, 0x5C, 0x06, 0xF0, 0xE1, 0x11, 0x7B, 0xB7, 0x10, 0xB1, 0xAF, 0xC6, 0xE7, 0xE4, 0x65, 0x1C, 0xFF, 0x92, 0x26, 0xD8,
-0x80, 0xB6, 0x91, 0x6F, 0x54, 0x59, 0x1B, 0x98, 0xF9, 0x11, 0x1E, 0x3A, 0xB9, 0xB5, 0xEA, 0xA8, 0x2F, 0x22, 0x08, 0x95, 0x6A,
-0xDD, 0x1E, 0xC0, 0xB4, 0x20, 0xC4, 0x40, 0x34, 0x84, 0x1E, 0x5D, 0x87, 0x59, 0xE8, 0xD7, 0x71, 0x62, 0x67, 0x8B, 0xBD, 0x9A,
-0x52, 0xA9, 0x6A, 0xAF, 0xF0, 0xC2, 0x46, 0xAA, 0x68, 0xE0, 0xA8, 0x71, 0xE0, 0x4C, 0xC4, 0x2D, 0x06, 0x35, 0xB4, 0xD3, 0x8D,
-0x66, 0xFA, 0x18, 0xC3, 0x3A, 0x72, 0x51, 0x4A, 0x8F, 0x69, 0x43, 0xC7, 0x42, 0x28, 0xD3, 0x26, 0x2B, 0x2D, 0x45, 0x8A, 0x21,
-0x1D, 0xFB, 0x52, 0x12, 0x2B, 0xBB, 0xD7, 0xD8, 0x6E, 0x97, 0x61, 0x25, 0x50, 0xD5, 0x4F, 0xEA, 0xFB, 0xE8, 0x0A, 0x5A, 0x11,
-0xD8, 0x4F, 0x37, 0x2A, 0x7F, 0x94, 0x2A, 0x05, 0x1A, 0x44, 0x4B, 0x94, 0xA0, 0x2C, 0x2B, 0xDB, 0xF0, 0x33, 0xCF, 0xF9, 0x7E,
-0x84, 0x8A, 0x08, 0xEE, 0xA9, 0xE4, 0xCD, 0xFD, 0xCC, 0xEE, 0xF7, 0x7A, 0xB9, 0xC5, 0x1A, 0x00, 0x50, 0x95, 0xC1, 0x8A, 0x23,
-0xD7, 0xFC, 0xFA, 0x99, 0xAE, 0xFA, 0x20, 0xAA, 0xC1, 0x54, 0x3C, 0x16, 0xE4, 0x74, 0xE7, 0xBF, 0x4A, 0x94, 0x57, 0x77, 0x83,
-0xEA, 0x78, 0xC0, 0x28, 0x85, 0x3B, 0xA2, 0xFE, 0xF1, 0x6B, 0x0D, 0xE6, 0x91, 0xEC, 0xD4, 0xDA, 0x42, 0x69, 0xAC, 0xF8, 0x7B,
-0xED, 0xB9, 0xB2, 0x1F, 0x19, 0x30, 0x88, 0xF7, 0x4C, 0x2A, 0x68, 0x33, 0xCE, 0x4E, 0xC8, 0x90, 0xB4, 0x5A, 0x87, 0xC4, 0x75,
-0xC9, 0x7B, 0x25, 0x12, 0x2C, 0xA8, 0xF0, 0x55, 0xDE, 0xC9, 0x9C, 0x9D, 0x94, 0xF7, 0x18, 0xC1, 0x57, 0x4E, 0x93, 0x44, 0x24,
-0x57, 0xE0, 0xD2, 0xB0, 0xD6, 0x22, 0x97, 0x01, 0xA3, 0x50, 0x3F, 0xE9, 0x8D, 0xA9, 0x95, 0x87, 0x7A, 0x22, 0xE6, 0x50, 0xA2,
-0x68, 0x07, 0x47, 0xF7, 0xF2, 0x04, 0x54, 0x1B, 0x58, 0xC1, 0x38, 0xE4, 0x4C, 0x91, 0x10, 0xE2, 0xB6, 0xA2, 0x37, 0x8C, 0xA4,
-0x31, 0x66, 0x9E, 0xBD, 0x1E, 0x6E, 0x38, 0xA5, 0x80, 0x38, 0xF3, 0xCC, 0x88, 0xCD, 0xA0, 0x2E, 0xF1, 0xA0, 0xBA, 0x50, 0x00,
-0x04, 0xD7, 0xEB, 0xA2, 0x0B, 0x0A, 0x2A, 0x4C, 0x30, 0x0A, 0xAA, 0x1F, 0xE7, 0x1F, 0xD1, 0x3F, 0xA2, 0xEF, 0x05, 0x31, 0x5B,
-0x87, 0xD2, 0x20, 0x1D, 0x61, 0xE3, 0x81, 0x76, 0xE6, 0x3B, 0xD6, 0xE1, 0xEF, 0x7F, 0xB7, 0x22, 0x7D, 0xA7, 0x9D, 0x6F, 0x7E,
-0x76, 0x1C, 0x00, 0xEA, 0xCF, 0xDB, 0xE3, 0x34, 0xD2, 0x7D, 0x6B, 0xBB, 0x53, 0xDC, 0x97, 0x5D, 0xB1, 0xA9, 0x8B, 0xDE, 0x4B,
-0xAA, 0xC0, 0xBB, 0x22, 0x60, 0xD3, 0xFD, 0xBF, 0xBF, 0x53, 0x7B, 0xDC, 0xB3, 0x5F, 0xFC, 0xF3, 0xCB, 0xF3, 0x85, 0xBD, 0x7C,
-0xDE, 0xBF, 0xC7, 0x73, 0x7F, 0x77, 0xB1, 0xE3, 0x1E, 0xD6, 0xE1, 0x80, 0xB0, 0xD2, 0x84, 0x64, 0x2F, 0x5B, 0xB4, 0xBE, 0x2C,
-0x27, 0x9A, 0xDC, 0xD2, 0x80, 0x43, 0xBE, 0x63, 0xD8, 0x32, 0x57, 0x39, 0x28, 0x72, 0xF1, 0x01, 0x0A, 0x63, 0x00, 0xBD, 0xD3,
-0x6E, 0xFD, 0x41, 0xB3, 0xD4, 0xEA, 0x38, 0xB0, 0xB8, 0xDD, 0x71, 0x14, 0x78, 0xDE, 0xDA, 0x1E, 0x6D, 0x85, 0x36, 0x5C, 0x6A,
-0x56, 0x9A, 0x84, 0x52, 0x5D, 0xDA, 0x8C, 0xF6, 0xD4, 0xA4, 0x59, 0x44, 0xAD, 0x69, 0x70, 0x02, 0x16, 0x4D, 0xA0, 0xF2, 0x3D,
-0x26, 0xBD, 0x4D, 0x28, 0xF3, 0x65, 0xC3, 0x0C, 0xFF, 0xFA, 0xB2, 0x8D, 0x5C, 0x72, 0x8D, 0xEC, 0x49, 0x01, 0xF5, 0xBF, 0xFF,
-0xBD, 0xA6, 0x45, 0x07, 0xED, 0xBA, 0xAD, 0xE7, 0x6E, 0x63, 0x9B, 0x23, 0x05, 0x4F, 0x0A, 0xF4, 0x00, 0xA8, 0x35, 0x65, 0x19,
-0x58, 0x66, 0xF2, 0x26, 0x41, 0xB0, 0x08, 0x9D, 0x1F, 0xE3, 0x58, 0x2E, 0x08, 0x00, 0xFD, 0xD5, 0x57, 0x4B, 0x34, 0xB5, 0x4B,
-0x51, 0xE2, 0x68, 0xC4, 0x20, 0xEF, 0x38, 0x11, 0x71, 0xBB, 0x95, 0xC7, 0x90, 0x56, 0x97, 0x3C, 0x59, 0x41, 0x2C, 0x33, 0xB1,
-0x28, 0xC3, 0xA2, 0x72, 0x1E, 0x79, 0x55, 0x9B, 0x79, 0xA7, 0xEB, 0xD1, 0xB6, 0xAE, 0xEF, 0x6B, 0x4D, 0x07, 0x12, 0xAD, 0x79,
-0x4B, 0x86, 0x43, 0x0C, 0x0E, 0x1D, 0xC8, 0x9B, 0xD0, 0xD7, 0x40, 0xAF, 0x91, 0xA4, 0xAC, 0x46, 0x72, 0x0A, 0x77, 0xC2, 0xEB,
-0xE3, 0x99, 0x91, 0x42, 0xC2, 0x20, 0xBD, 0x47, 0x12, 0x65, 0x40, 0x67, 0x94, 0x43, 0x9E, 0x67, 0xCA, 0x9B, 0xB6, 0xAF, 0x0B,
-0x99, 0xB6, 0xAE, 0x30, 0xC4, 0x82, 0xCE, 0xDD, 0x75, 0x0E, 0xDC, 0x6C, 0xFC, 0xEB, 0x80, 0xAA, 0xE1, 0x41, 0xFF, 0xAB, 0x40,
-0x44, 0xC3, 0xDE, 0x57, 0x60, 0x93, 0x10, 0xAB, 0x77, 0xBE, 0x68, 0x4A, 0x17, 0xD7, 0x75, 0x2A, 0xC5, 0xBF, 0x8C, 0xF4, 0x9C,
-0x04, 0x47, 0xDC, 0xD4, 0x4C, 0x5C, 0x40, 0x75, 0x00, 0x14, 0x91, 0x36, 0xC3, 0xC8, 0xD6, 0x69, 0xE2, 0x26, 0x83, 0x35, 0xA6,
-0x81, 0xAC, 0x93, 0xC3, 0xE2, 0x71, 0xFA, 0xF8, 0xC1, 0x9F, 0x98, 0x4D, 0xD5, 0x9F, 0xA1, 0x92, 0xFF, 0x8E, 0x52, 0xFA, 0x4E,
-0x79, 0xD3, 0xA5, 0xDF, 0xEB, 0xF7, 0xEC, 0x00, 0xC2, 0xAF, 0xBD, 0xDC, 0xDC, 0x33, 0x7B, 0x7B, 0xF8, 0xBB, 0xFF, 0xE3, 0xAE,
-0xAB, 0xFB, 0x3D, 0x5C, 0xEB, 0xEE, 0xF6, 0x76, 0x77, 0x7B, 0xFD, 0xDD, 0x9E, 0xFB, 0x86, 0x29, 0xE0, 0x4F, 0x6F, 0xF3, 0x7D,
-0x84, 0xAA, 0x2C, 0xDB, 0x62, 0x71, 0x3F, 0xBE, 0xBC, 0xBA, 0xEE, 0x36, 0x91, 0x18, 0x32, 0x28, 0xDF, 0xFC, 0x01, 0x69, 0xBD,
-0x39, 0xBD, 0x6A, 0x75, 0xEB, 0xE7, 0x98, 0x13, 0x02, 0x39, 0x68, 0x82, 0x81, 0x7F, 0xAD, 0x3B, 0x1B, 0x68, 0x81, 0xFC, 0xD1,
-0x1A, 0x98, 0x86, 0xB6, 0xBB, 0x61, 0xEE, 0x4B, 0xCF, 0x63, 0xB1, 0x82, 0x99, 0x2D, 0x3C, 0x86, 0xE2, 0x9E, 0xEE, 0x57, 0xDD,
-0xCF, 0x52, 0x44, 0xAD, 0xFA, 0x55, 0x8B, 0x86, 0xE1, 0xFA, 0x88, 0x90, 0xEB, 0xF1, 0x49, 0xC1, 0x16, 0x3B, 0x65, 0x9B, 0xDA,
-0xA4, 0x31, 0xDD, 0xE0, 0xE4, 0xDA, 0x5A, 0x02, 0x41, 0xFA, 0xDA, 0x4D, 0xD6, 0x8F, 0xF8, 0xB4, 0xFE, 0xA0, 0x3A, 0xE4, 0x51,
-0x96, 0xD3, 0x25, 0x46, 0xA0, 0xEA, 0x68, 0x21, 0xD6, 0x76, 0x36, 0xC9, 0xB4, 0x58, 0x39, 0x54, 0xA1, 0xFC, 0xBD, 0xF7, 0x4F,
-0x47, 0xE6, 0xB5, 0x83, 0x2E, 0x2B, 0xDE, 0x24, 0x74, 0x04, 0x29, 0x5D, 0x56, 0x0B, 0x8A, 0x7B, 0xC8, 0x72, 0x73, 0xE4, 0xB9,
-0xA7, 0xDF, 0xA2, 0xF8, 0x44, 0xC0, 0x9C, 0x40, 0x4C, 0xB2, 0x99, 0x87, 0xFF, 0x63, 0x07, 0x37, 0x1B, 0xBA, 0xBF, 0x15, 0x07,
-0xCF, 0x54, 0x05, 0x3E, 0xAD, 0x5D, 0xB5, 0xD9, 0xAF, 0x33, 0xA5, 0xE7, 0x2E, 0x0D, 0xC1, 0x38, 0xB7, 0x8D, 0xC5, 0xFF, 0x3F,
-0xDF, 0xFE, 0x15, 0x65, 0x1A, 0xF0, 0xBA, 0x73, 0x41, 0x7D, 0x53, 0x0A, 0xE7, 0xAD, 0xB4, 0x5C, 0x9F, 0xB3, 0xE3, 0x40, 0xFF,
-0xFA, 0xDD, 0xFB, 0x77, 0xDF, 0xB7, 0x5B, 0xAE, 0x91, 0xA3, 0xD4, 0xB1, 0x04, 0x8A, 0x8C, 0xA5, 0x05, 0xEB, 0xD8, 0xD1, 0x68,
-0xAF, 0xDA, 0x6E, 0x96, 0x47, 0x82, 0x8D, 0xBC, 0x60, 0x39, 0xB3, 0x9C, 0x95, 0xD5, 0x90, 0xA5, 0xA5, 0xDB, 0x59, 0x2C, 0xE3,
-0x34, 0x0E, 0xB5, 0x0D, 0xA7, 0x99, 0x55, 0xC2, 0x99, 0x2D, 0x7D, 0x20, 0xCE, 0x28, 0xB9, 0x6A, 0x74, 0xDE, 0x1C, 0x63, 0xB1,
-0xC0, 0x5E, 0x5B, 0xF4, 0x40, 0x5C, 0x62, 0x16, 0x6E, 0x47, 0x66, 0xB6, 0x15, 0x8B, 0xD8, 0x96, 0xCB, 0x1E, 0x88, 0xCE, 0x54,
-0xF7, 0x1B, 0x91, 0xAD, 0x35, 0x00, 0xC5, 0x45, 0xF7, 0x43, 0x05, 0xF6, 0xF8, 0x21, 0x0B, 0x86, 0xF9, 0x1E, 0x3B, 0xF6, 0x74,
-0x74, 0x8C, 0x7B, 0x17, 0x01, 0x58, 0x2A, 0x8F, 0x26, 0xD5, 0x55, 0xEB, 0x4D, 0xCE, 0x61, 0x7D, 0xA1, 0x6C, 0xBA, 0xF3, 0xBA,
-0x52, 0x59, 0x3B, 0x4F, 0xA5, 0x48, 0xAE, 0xFA, 0x6F, 0x91, 0x38, 0xDC, 0x00, 0xC0, 0x6D, 0xB4, 0x92, 0xAB, 0xE4, 0xBA, 0xED,
-0x92, 0x95, 0x24, 0x20, 0xEB, 0xB6, 0xF4, 0xDC, 0x35, 0x87, 0xA9, 0x95, 0xE2, 0x46, 0x46, 0x6A, 0x28, 0x5A, 0xE3, 0xCB, 0x83,
-0x68, 0x75, 0x93, 0xDD, 0x20, 0xCA, 0x6E, 0x08, 0x4D, 0xB9, 0x84, 0x56, 0x7D, 0xEE, 0x8C, 0x28, 0xBC, 0xE9, 0xD4, 0xAF, 0xCF,
-0x1A, 0x08, 0xB3, 0xBA, 0x94, 0x98, 0x36, 0x75, 0x8C, 0x3B, 0xB8, 0xBF, 0x81, 0x5D, 0x9F, 0x02, 0x2C, 0xCD, 0x7D, 0xD2, 0xD2,
-0x77, 0xB3, 0x0E, 0xB1, 0xEC, 0xE0, 0x5B, 0xFB, 0xCB, 0xA5, 0x23, 0xAE, 0x00, 0xAC, 0x79, 0xEB, 0x56, 0x00, 0x99, 0x6F, 0x3D,
-0xA6, 0xB7, 0xCD, 0x1D, 0x25, 0x5B, 0xBB, 0xE6, 0x49, 0x5B, 0x17, 0x1B, 0x03, 0x78, 0x70, 0x63, 0x8C, 0x72, 0xAD, 0xDA, 0x28,
-0x66, 0xF7, 0x66, 0x54, 0x5C, 0x42, 0xAF, 0x96, 0xB7, 0xA3, 0x26, 0x87, 0x97, 0x9A, 0xB8, 0x4D, 0x2E, 0xAF, 0x6B, 0xCD, 0x15,
-0x88, 0x46, 0xFF, 0x36, 0x80, 0x47, 0xF2, 0x65, 0xC0, 0x12, 0xD5, 0xBE, 0xC6, 0x5D, 0xF6, 0xA3, 0x51, 0xF9, 0xE4, 0xE3, 0xC8,
-0x1D, 0x1D, 0x17, 0xB7, 0xD1, 0x23, 0x91, 0xD1, 0xE2, 0xEC, 0x7C, 0x29, 0xEE, 0x08, 0x35, 0x37, 0x62, 0xF5, 0x02, 0xA8, 0x75,
-0xD2, 0xF5, 0x2C, 0x58, 0x1F, 0x62, 0x9A, 0x65, 0x66, 0xFA, 0xA9, 0x7A, 0xB1, 0xAD, 0x7A, 0xAD, 0x8D, 0xC9, 0x27, 0x13, 0x5D,
-0x01, 0xD2, 0x43, 0xA4, 0x87, 0x17, 0x01, 0x40, 0x82, 0x75, 0x77, 0x43, 0x7E, 0x03, 0x62, 0x44, 0xDE, 0x57, 0xDE, 0xFD, 0x04,
-0x8B, 0x51, 0xBD, 0x63, 0xB1, 0xAC, 0xFA, 0x9F, 0x98, 0xFA, 0x74, 0x63, 0xED, 0xA9, 0x65, 0x07, 0xD3, 0x1B, 0xB5, 0x90, 0x15,
-0xC4, 0x1B, 0xD3, 0xF1, 0xBA, 0x26, 0x72, 0x68, 0x1B, 0x7B, 0x93, 0x66, 0x6D, 0x94, 0x4E, 0xF8, 0x7F, 0xBE, 0x22, 0x1E, 0xA9,
-0x8C, 0x8D, 0x0A, 0x69, 0x48, 0x9F, 0x1B, 0xCC, 0x3D, 0xA6, 0x73, 0xCC, 0x9F, 0x20, 0xE2, 0xA6, 0x4A, 0x32, 0x57, 0xE5, 0x60,
-0xF5, 0xD8, 0x6D, 0x9C, 0x6A, 0x94, 0x31, 0x58, 0x3D, 0x36, 0x4C, 0xCD, 0x82, 0xEF, 0x20, 0x7F, 0x68, 0x98, 0x96, 0x87, 0xA7,
-0xC1, 0xF2, 0xA9, 0x61, 0xA2, 0x89, 0xA3, 0x83, 0xEC, 0xFF, 0x1A, 0x09, 0xD4, 0xC7, 0x54, 0x07, 0xEF, 0x57, 0xB7, 0x1B, 0x38,
-0x4F, 0x93, 0x00, 0xCA, 0x7D, 0x17, 0x13, 0x21, 0x16, 0xB7, 0x4D, 0xAD, 0x06, 0x6E, 0xD7, 0xC3, 0xBC, 0xCB, 0x77, 0xEF, 0x1B,
-0xBB, 0x91, 0xEC, 0x0E, 0xF2, 0x95, 0x99, 0x59, 0x69, 0x20, 0x1A, 0x56, 0x61, 0x99, 0x34, 0x20, 0x58, 0x61, 0x3B, 0x52, 0xE1,
-0xD9, 0x3F, 0x1F, 0xCF, 0xDB, 0x99, 0xBE, 0x3A, 0x0D, 0x6B, 0x64, 0xAA, 0xEF, 0x70, 0x0D, 0xCA, 0xAD, 0x64, 0x3B, 0xEF, 0x2A,
-0x1E, 0x60, 0xFD, 0xF9, 0x92, 0xAE, 0x55, 0x7F, 0xF3, 0xD1, 0xEA, 0xF6, 0x7B, 0xF0, 0xB7, 0xC9, 0x50, 0x03, 0x61, 0xF8, 0x74,
-0x12, 0xA6, 0xCF, 0x0F, 0xDB, 0x96, 0x6B, 0x35, 0xCD, 0x5F, 0x34, 0xB0, 0xA4, 0x1B, 0x9D, 0x2A, 0x43, 0x77, 0xD3, 0xA4, 0x4B,
-0xCC, 0x75, 0xEF, 0x2E, 0xD9, 0xDC, 0x0C, 0x55, 0x59, 0x83, 0xC5, 0x4E, 0xCE, 0x1E, 0x7A, 0x69, 0xD7, 0x7A, 0x3F, 0x97, 0x8A,
-0x85, 0x44, 0xFB, 0xAD, 0xF5, 0x0B, 0xBB, 0x6C, 0x9D, 0x47, 0xD6, 0x56, 0x71, 0x0D, 0x25, 0x1D, 0x14, 0x98, 0x7F, 0x55, 0x3C,
-0xE0, 0x6A, 0xBE, 0xE2, 0x5F, 0x09, 0x32, 0xC1, 0xBB, 0xCF, 0x58, 0x74, 0xFA, 0xF3, 0x88, 0x86, 0xDC, 0x03, 0xDD, 0x64, 0xDF,
-0x1F, 0x90, 0x03, 0x12, 0x0A, 0x1F, 0x48, 0x5A, 0xC1, 0x58, 0x2E, 0x94, 0x53, 0x31, 0x7B, 0x25, 0x2F, 0xF0, 0x75, 0x5B, 0xE8,
-0xF3, 0x54, 0xD9, 0x70, 0x82, 0x51, 0x1A, 0xD4, 0x57, 0xD4, 0xF1, 0xB0, 0xE7, 0x02, 0x0C, 0x8C, 0xE2, 0x6D, 0xEB, 0xF5, 0xF7,
-0xFA, 0x42, 0x2B, 0x86, 0xF6, 0xD2, 0x38, 0xFA, 0x07, 0x8E, 0x53, 0x94, 0x7C, 0xE5, 0x25, 0x0F, 0x19, 0x1E, 0xB3, 0x0E, 0x49,
-0xAF, 0xF4, 0x46, 0x44, 0xAF, 0x45, 0x34, 0xE6, 0x49, 0xB8, 0xBA, 0x89, 0xBE, 0xA8, 0x4E, 0xD1, 0x45, 0x6E, 0x61, 0x46, 0x49,
-0xA8, 0xF0, 0x26, 0xE3, 0xB1, 0xAE, 0x6A, 0x7F, 0xAD, 0x8F, 0x87, 0x48, 0x1A, 0xF1, 0x9F, 0x52, 0x46, 0x20, 0x33, 0xE1, 0xD9,
-0x11, 0x1E, 0x0A, 0x6B, 0xE1, 0xD5, 0x89, 0x44, 0xBF, 0x38, 0xC3, 0x68, 0xD9, 0x1A, 0x19, 0x19, 0xDA, 0x2D, 0xF2, 0x27, 0xBC,
-0x85, 0xC3, 0x9C, 0x48, 0xCC, 0x6A, 0x4A, 0xB7, 0xC2, 0xBA, 0x6F, 0xF1, 0xEB, 0x93, 0x21, 0xB9, 0x6E, 0x3E, 0x91, 0xD5, 0xD3,
-0xC0, 0x96, 0x7C, 0x66, 0xE9, 0x73, 0xC4, 0x9D, 0x2F, 0x19, 0xC2, 0x05, 0x9E, 0x17, 0x8F, 0xA0, 0x78, 0x67, 0x77, 0x43, 0xCB,
-0xEE, 0x5B, 0x84, 0x26, 0x9C, 0x9A, 0xBB, 0x00, 0x60, 0x7F, 0xA3, 0x79, 0x71, 0xEA, 0x39, 0x8E, 0x66, 0x33, 0xA6, 0xDC, 0xF7,
-0x59, 0x34, 0xB4, 0xB0, 0x4C, 0xB4, 0x48, 0x7E, 0x43, 0x1F, 0xCB, 0x7E, 0x1F, 0x2C, 0x18, 0xBF, 0x4C, 0x01, 0xF7, 0xF4, 0x36,
-0xDD, 0xA5, 0xD6, 0x50, 0x6D, 0x9F, 0xD3, 0x40, 0x4C, 0x48, 0xF1, 0x47, 0x76, 0x7D, 0x9A, 0xF9, 0xDB, 0x8E, 0x86, 0xCD, 0xA2,
-0x2C, 0x04, 0xDE, 0x6F, 0xB2, 0xD9, 0xBD, 0x69, 0x3C, 0x4C, 0x2E, 0x5C, 0xCC, 0xD6, 0xD3, 0xB5, 0x65, 0x96, 0x25, 0x66, 0xC4,
-0x70, 0xBC, 0xF3, 0x45, 0xBF, 0x5D, 0xD4, 0x5C, 0xD3, 0x2E, 0x9F, 0xDC, 0xAE, 0x9F, 0xBB, 0xAE, 0x4E, 0x6B, 0x6D, 0x2F, 0x10,
-0xB2, 0x20, 0x3E, 0x70, 0xFB, 0x90, 0x2F, 0xB1, 0x17, 0x75, 0x31, 0xB4, 0x5E, 0xEB, 0xA9, 0xC7, 0x1B, 0x4E, 0x69, 0x1B, 0x4F,
-0x68, 0x2B, 0x52, 0x40, 0x87, 0xB2, 0x96, 0xD7, 0xEA, 0xF1, 0xDE, 0xBA, 0x2D, 0x63, 0x08, 0xA2, 0x03, 0x12, 0x27, 0xCC, 0x9E,
-0x81, 0x9F, 0x1F, 0x22, 0x7F, 0x38, 0x6D, 0x71, 0x7F, 0xA8, 0xE6, 0xC0, 0xBF, 0x49, 0xB6, 0x20, 0x2E, 0xED, 0xAE, 0xB8, 0x87,
-0xE8, 0x19, 0xFF, 0x6B, 0x91, 0xAF, 0xC9, 0xF5, 0x36, 0x19, 0xE9, 0x13, 0xED, 0xE5, 0x49, 0x76, 0xB3, 0xAC, 0xD6, 0x75, 0xA4,
-0xBF, 0x9A, 0xC8, 0x8E, 0xC7, 0xCB, 0xE7, 0xDB, 0xD7, 0xF8, 0x89, 0x48, 0x6B, 0xF1, 0x38, 0x95, 0x15, 0xAF, 0x06, 0xD4, 0x22,
-0x15, 0x37, 0xDA, 0x34, 0xEA, 0x78, 0x6D, 0xBD, 0x7B, 0xAB, 0x3F, 0x4F, 0xD1, 0xAA, 0x6C, 0x2D, 0x1E, 0xA3, 0xCA, 0x7B, 0x1C,
-0xB6, 0xAF, 0xC6, 0xAE, 0x2B, 0x31, 0x63, 0xF9, 0xC1, 0x0D, 0xAA, 0xD6, 0xE1, 0x90, 0xA3, 0x12, 0xF5, 0xD2, 0xFF, 0x4C, 0xD1,
-0xE3, 0xBE, 0xBD, 0xBA, 0x38, 0x6F, 0xB7, 0x46, 0x0C, 0x42, 0x15, 0x63, 0x11, 0xA6, 0x9E, 0x65, 0x6C, 0xE9, 0x1C, 0x36, 0x86,
-0x9E, 0xEC, 0x8B, 0x1D, 0xDC, 0x70, 0xCF, 0x61, 0x4F, 0x58, 0xFE, 0x1D, 0xCF, 0xAB, 0xF9, 0x99, 0xDF, 0xCE, 0xA4, 0x53, 0x0F,
-0x23, 0x8B, 0x75, 0x78, 0x04, 0xC9, 0x66, 0x64, 0xF5, 0x99, 0x9B, 0xC9, 0x22, 0x45, 0x0C, 0xE5, 0xF5, 0x78, 0x53, 0x80, 0xCB,
-0x2C, 0x92, 0xEB, 0x73, 0xD9, 0xFA, 0x83, 0x8A, 0x26, 0xB2, 0xAE, 0x2B, 0x7A, 0xBB, 0xEE, 0xD4, 0x7D, 0xFF, 0x83, 0xBB, 0x14,
-0x20, 0x8B, 0xCA, 0x77, 0x52, 0xBA, 0x05, 0x58, 0xC3, 0x5F, 0x73, 0x12, 0x90, 0xB1, 0xE7, 0x40, 0xB4, 0x64, 0x95, 0xC6, 0x7D,
-0x99, 0x87, 0xEE, 0xB3, 0xF1, 0xA2, 0x77, 0xE1, 0x2B, 0x46, 0x55, 0xC9, 0xAF, 0xF7, 0xE5, 0xD6, 0xB8, 0xC6, 0xC3, 0x39, 0xDE,
-0xCA, 0x54, 0x31, 0x7B, 0xB6, 0x37, 0x96, 0x22, 0xB5, 0xED, 0x43, 0x51, 0xE3, 0x35, 0xB4, 0x99, 0xAC, 0xE3, 0x8C, 0xA4, 0xA3,
-0x27, 0x36, 0xEA, 0xC5, 0xB4, 0x66, 0x2B, 0xE5, 0x60, 0x97, 0xB8, 0x5D, 0x78, 0x9B, 0x69, 0x27, 0x0C, 0xCC, 0x6B, 0x0B, 0x68,
-0x53, 0x89, 0x34, 0x01, 0x6E, 0xD2, 0xF6, 0x06, 0x11, 0x24, 0x2C, 0x14, 0xB7, 0xEC, 0x3E, 0x06, 0x92, 0x6B, 0x05, 0xAB, 0xB0,
-0x76, 0x83, 0xFD, 0x64, 0x25, 0x51, 0xDD, 0x31, 0x9A, 0x64, 0xEA, 0xCA, 0xBC, 0x6E, 0x37, 0x2A, 0x5E, 0x6F, 0xCB, 0x6E, 0xF1,
-0xF2, 0xCE, 0xA3, 0x2C, 0xA6, 0x5C, 0x5D, 0x75, 0xF3, 0xF2, 0x6D, 0x83, 0xAC, 0x16, 0xA5, 0x42, 0xF6, 0x23, 0xC4, 0x8D, 0x38,
-0xBF, 0x40, 0x17, 0x11, 0x5D, 0x8E, 0x93, 0x8B, 0xF5, 0x7A, 0x6B, 0x59, 0xAB, 0xE6, 0xE5, 0x7A, 0x68, 0x2A, 0xCE, 0xAE, 0x4E,
-0xE5, 0xC3, 0x56, 0xB9, 0x1D, 0x69, 0x75, 0x33, 0x3A, 0x86, 0x55, 0x89, 0x65, 0x07, 0x21, 0x18, 0xB7, 0x2E, 0x13, 0x01, 0xB9,
-0x88, 0x61, 0x5F, 0x23, 0x02, 0xBC, 0x50, 0x51, 0x11, 0x5F, 0xB1, 0x36, 0x36, 0x75, 0x43, 0x17, 0x43, 0xF0, 0x60, 0x89, 0x1F,
-0x1B, 0xB8, 0xBC, 0x90, 0xCD, 0x70, 0x76, 0x97, 0x26, 0x33, 0xC8, 0x00, 0x77, 0x73, 0xEB, 0xCC, 0x07, 0xB6, 0x14, 0xFB, 0x95,
-0x0F, 0x13, 0x1B, 0xBF, 0x10, 0xBE, 0xFF, 0xE7, 0xC8, 0x9F, 0x8B, 0x5F, 0x23, 0x8F, 0xD2, 0xC8, 0x0F, 0x58, 0xFE, 0xB5, 0x30,
-0xE1, 0x50, 0x89, 0x4D, 0x12, 0xE8, 0x26, 0xA0, 0xFE, 0x9B, 0xD2, 0xBD, 0xE7, 0xFB, 0xF6, 0x37, 0x6F, 0xE7, 0xE2, 0xF4, 0x1B,
-0x91, 0xBC, 0x7E, 0x13, 0xCC, 0x6F, 0x67, 0x77, 0x2F, 0xBE, 0xFD, 0xDC, 0x7B, 0xF1, 0x9D, 0xF7, 0x29, 0xDA, 0x8B, 0x6E, 0x9F,
-0xCD, 0xF8, 0xE5, 0x87, 0xE0, 0x5F, 0xCF, 0x3E, 0x7D, 0x9A, 0x7D, 0x97, 0x7C, 0xFC, 0xE0, 0xFD, 0xED, 0xAD, 0xFB, 0x2A, 0x8C,
-0x3E, 0x9C, 0xDC, 0x5D, 0xFC, 0xE9, 0x64, 0x57, 0x7A, 0x7F, 0x19, 0x9D, 0x5D, 0xDD, 0x9D, 0x41, 0xEA, 0x4D, 0x84, 0x94, 0x22,
-0xE1, 0x13, 0x0E, 0xD5, 0x26, 0x8D, 0x44, 0x34, 0x0F, 0x45, 0xBA, 0xFE, 0x65, 0x32, 0x24, 0x52, 0x90, 0xA5, 0xF9, 0xEE, 0x12,
-0xBF, 0xC7, 0xFE, 0x0F, 0x3A, 0x2F, 0xB7, 0xE8, 0x9F, 0x3D, 0x00, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xBD, 0x1A, 0x6B, 0x77, 0xDB, 0xB6, 0xF5, 0xBB, 0x7E, 0x05, 0xC2,
+0x65, 0xA5, 0x74, 0x26, 0x92, 0x92, 0x1F, 0x79, 0xC8, 0x96, 0xBA, 0x24, 0x76, 0x53, 0x37, 0x76, 0xE3, 0x35, 0x5E, 0xB3, 0x9C,
+0x76, 0xAB, 0x21, 0x12, 0x92, 0x10, 0x93, 0x04, 0x0B, 0x40, 0x96, 0x55, 0xCF, 0xFF, 0x7D, 0xF7, 0x02, 0x20, 0x45, 0x4A, 0xB2,
+0x93, 0xF4, 0xAC, 0xCD, 0x39, 0xAD, 0x45, 0x10, 0xF7, 0xFD, 0x06, 0x71, 0xF8, 0xE8, 0xE8, 0xED, 0xAB, 0x8B, 0x0F, 0xE7, 0xC7,
+0x64, 0xA6, 0xB3, 0x74, 0xD4, 0x3A, 0xC4, 0x3F, 0x24, 0xA5, 0xF9, 0x74, 0xE8, 0xB1, 0xDC, 0xC3, 0x05, 0x46, 0x13, 0xF8, 0x93,
+0xF2, 0xFC, 0x8A, 0xCC, 0x24, 0x9B, 0x0C, 0xBD, 0x99, 0xD6, 0x85, 0x1A, 0x44, 0x51, 0x9C, 0xE4, 0xE1, 0x47, 0x95, 0xB0, 0x94,
+0x5F, 0xCB, 0x30, 0x67, 0x3A, 0xCA, 0x8B, 0x2C, 0x1A, 0x0B, 0xA1, 0x95, 0x96, 0xB4, 0xF8, 0xFB, 0x7E, 0xB8, 0x1B, 0x3E, 0x8B,
+0x12, 0xAE, 0x74, 0x14, 0x2B, 0xB5, 0x7A, 0x11, 0x66, 0x3C, 0x0F, 0x61, 0xC5, 0x23, 0x92, 0xA5, 0x43, 0x4F, 0xE9, 0x65, 0xCA,
+0xD4, 0x8C, 0x31, 0x8D, 0xD4, 0x54, 0x2C, 0x79, 0xA1, 0x89, 0x92, 0xF1, 0x8A, 0x0E, 0xFD, 0x48, 0x6F, 0xC2, 0xA9, 0x10, 0xD3,
+0x94, 0xD1, 0x82, 0xAB, 0x30, 0x16, 0x99, 0x59, 0x8B, 0x52, 0x3E, 0x56, 0xD1, 0xC7, 0x5F, 0xE7, 0x4C, 0x2E, 0xA3, 0xDD, 0xF0,
+0x69, 0xD8, 0x77, 0x0F, 0x86, 0xC2, 0x47, 0xE5, 0x8D, 0x0E, 0x23, 0x8B, 0x0F, 0x10, 0x67, 0x4C, 0x53, 0x12, 0xCF, 0xA8, 0x54,
+0x4C, 0x0F, 0xBD, 0x7F, 0x5E, 0x7C, 0x13, 0x3C, 0xF3, 0xCA, 0xE5, 0x9C, 0x66, 0x6C, 0xE8, 0x5D, 0x73, 0xB6, 0x28, 0x84, 0xD4,
+0x1E, 0x89, 0x45, 0xAE, 0x59, 0x0E, 0xDB, 0xE6, 0x8A, 0xC9, 0x40, 0xC5, 0x34, 0xA5, 0xE3, 0x94, 0x0D, 0x73, 0xD1, 0x25, 0x3C,
+0xE7, 0x9A, 0xD3, 0xD4, 0x2C, 0xB2, 0x61, 0xBF, 0x4B, 0x32, 0x7A, 0xC3, 0xB3, 0x79, 0x56, 0x5B, 0x80, 0x2D, 0x8D, 0x85, 0x05,
+0x4F, 0xF4, 0x6C, 0x98, 0xB0, 0x6B, 0x1E, 0xB3, 0xC0, 0x3C, 0xAC, 0x11, 0xA6, 0x45, 0x91, 0xB2, 0x20, 0x13, 0x63, 0x0E, 0x7F,
+0x16, 0x6C, 0x1C, 0xC0, 0x42, 0x10, 0xD3, 0x02, 0x89, 0xD6, 0x98, 0x59, 0x32, 0x50, 0x59, 0xF4, 0x19, 0xA0, 0x4A, 0x53, 0x3D,
+0x57, 0xC1, 0x98, 0x02, 0xEF, 0xA8, 0xDC, 0x1A, 0x8E, 0x84, 0x4D, 0xE8, 0x3C, 0xD5, 0x16, 0x8F, 0x31, 0xA9, 0xB1, 0x81, 0x45,
+0xA3, 0xC5, 0x3C, 0x9E, 0x05, 0x1C, 0x36, 0x7B, 0xCE, 0xD2, 0x13, 0x7A, 0x8D, 0x8F, 0x61, 0x91, 0x4F, 0xBD, 0x06, 0xC0, 0x7D,
+0x9B, 0x88, 0x5E, 0x16, 0xC0, 0x16, 0xCF, 0xE8, 0x94, 0x45, 0x66, 0x01, 0x09, 0x69, 0xAE, 0x53, 0x36, 0x3A, 0x62, 0x05, 0x95,
+0x7A, 0x2E, 0x99, 0x22, 0x2F, 0x05, 0x95, 0xC9, 0x61, 0x64, 0xD7, 0x4B, 0xA3, 0x8F, 0x5A, 0xED, 0x76, 0x87, 0x0C, 0x47, 0xE4,
+0xB6, 0x05, 0xE8, 0x94, 0x26, 0x7A, 0xC6, 0x32, 0x76, 0x46, 0x75, 0x3C, 0x63, 0x92, 0x0C, 0x41, 0x8F, 0x79, 0x22, 0x16, 0x61,
+0x86, 0x0B, 0x67, 0x2C, 0xE1, 0xB4, 0xED, 0xB7, 0x0B, 0xE0, 0x80, 0x49, 0x15, 0xC4, 0x22, 0x15, 0x68, 0x29, 0x84, 0x18, 0x90,
+0x84, 0xCA, 0xAB, 0x8E, 0xDF, 0x39, 0x70, 0x78, 0x50, 0xBA, 0xE5, 0x05, 0xBE, 0x02, 0x2C, 0x8E, 0x04, 0x49, 0x44, 0x3C, 0xCF,
+0x40, 0x27, 0x61, 0xF9, 0xE3, 0x38, 0x65, 0xE6, 0x19, 0xFC, 0xE3, 0x85, 0xD6, 0x92, 0x8F, 0xE7, 0x9A, 0xB5, 0xFD, 0x84, 0x6A,
+0x1A, 0x8C, 0x55, 0x60, 0x78, 0xF1, 0xBB, 0x0D, 0x9E, 0x2C, 0x2B, 0x20, 0xCE, 0xD7, 0xC4, 0x47, 0x92, 0x3E, 0x19, 0x10, 0x3F,
+0xE5, 0xD3, 0x99, 0x06, 0xDA, 0xE4, 0xEE, 0xA0, 0xB5, 0x22, 0xDC, 0x06, 0x66, 0x1A, 0xA0, 0x34, 0x49, 0x8E, 0xAF, 0x81, 0xDC,
+0x29, 0x84, 0x07, 0xCB, 0x99, 0x6C, 0xFB, 0xE0, 0x9B, 0xF9, 0x14, 0x49, 0xAC, 0xA0, 0x00, 0xE8, 0xAE, 0x83, 0xA0, 0x35, 0x3F,
+0x8E, 0x5C, 0x3C, 0x1A, 0xCB, 0x8E, 0x5A, 0x03, 0x09, 0x61, 0x45, 0x6E, 0x03, 0xE4, 0x71, 0x2C, 0x92, 0x65, 0x30, 0x01, 0x53,
+0x07, 0x8A, 0xFF, 0x06, 0x6A, 0xE8, 0x85, 0xCF, 0x9E, 0xEE, 0x4B, 0x96, 0x1D, 0xDC, 0xB5, 0xC2, 0xB1, 0xCE, 0xCB, 0x5D, 0x3A,
+0x7F, 0x60, 0x53, 0x20, 0xE6, 0x1A, 0xCC, 0xCC, 0x02, 0xC5, 0x40, 0x79, 0x20, 0xD5, 0x92, 0xDC, 0xD6, 0x76, 0xF7, 0xDD, 0xCE,
+0x89, 0x90, 0x59, 0x80, 0x5E, 0x25, 0x45, 0xDA, 0x25, 0xF6, 0x51, 0xB1, 0x94, 0xC5, 0xBA, 0xB1, 0xFD, 0x9A, 0xCA, 0xF6, 0x16,
+0xD6, 0x3A, 0x15, 0x0A, 0x08, 0x2C, 0x56, 0x21, 0x00, 0xC5, 0xC4, 0x57, 0x76, 0xC9, 0x61, 0x59, 0x30, 0xD4, 0xE6, 0x60, 0xBF,
+0xD7, 0x03, 0x08, 0x50, 0x82, 0x95, 0xF9, 0x10, 0xB1, 0x91, 0x38, 0xA5, 0x4A, 0x0D, 0xBD, 0xF1, 0xD4, 0x22, 0xD7, 0x4C, 0x42,
+0x60, 0x02, 0xBB, 0xC5, 0x32, 0xD8, 0x43, 0x67, 0x4D, 0xF8, 0x35, 0x31, 0x00, 0x43, 0xCF, 0x04, 0xDD, 0x00, 0x23, 0xB3, 0xFD,
+0xBC, 0xF7, 0xD7, 0x2E, 0x01, 0x7C, 0xC5, 0x0D, 0x98, 0x28, 0xA3, 0x72, 0xCA, 0x73, 0xD0, 0x01, 0xA1, 0x73, 0x2D, 0x0E, 0x48,
+0x01, 0x56, 0xE1, 0xF9, 0x14, 0x17, 0xFA, 0xB0, 0xE3, 0xA0, 0x44, 0xE3, 0x48, 0xC5, 0xE0, 0xB4, 0x44, 0xCD, 0x28, 0x78, 0x61,
+0xA0, 0x32, 0x32, 0x16, 0x32, 0x81, 0xF4, 0xD0, 0xDB, 0xB2, 0x2B, 0x40, 0x23, 0x81, 0xD3, 0x02, 0x73, 0x85, 0x84, 0x60, 0x00,
+0xB6, 0x34, 0xBB, 0x01, 0x79, 0x66, 0x5C, 0x33, 0xFB, 0x33, 0x06, 0xE3, 0xC3, 0x0E, 0xE0, 0x76, 0xD7, 0x64, 0xD9, 0xFD, 0x12,
+0x3E, 0x1B, 0x23, 0xCA, 0xF5, 0x60, 0x21, 0xEF, 0x98, 0x9E, 0x17, 0x60, 0xFD, 0x7D, 0xF4, 0x01, 0x20, 0xB7, 0x85, 0xA8, 0x51,
+0x4B, 0x61, 0xA5, 0x47, 0x85, 0x12, 0x9E, 0x40, 0x74, 0xC2, 0x0F, 0x70, 0x69, 0x0D, 0x72, 0xA9, 0x35, 0x4E, 0x81, 0x92, 0xD9,
+0x6B, 0x35, 0xEE, 0x16, 0x57, 0x66, 0x21, 0x93, 0x05, 0xA0, 0x4C, 0x13, 0x8F, 0xC0, 0xDA, 0xD0, 0x93, 0x49, 0x06, 0x4C, 0xBD,
+0x61, 0x4B, 0x6F, 0xF4, 0xC3, 0xD1, 0x6B, 0x72, 0xCA, 0xAF, 0x19, 0xA9, 0xB8, 0x74, 0x4C, 0xBE, 0x38, 0x3F, 0x21, 0x57, 0x6C,
+0x79, 0x18, 0x19, 0x04, 0x80, 0x9A, 0xE7, 0xC5, 0x5C, 0x1B, 0x3E, 0x56, 0xE0, 0x2E, 0x47, 0xA0, 0x16, 0x3C, 0x52, 0xA4, 0x34,
+0x66, 0x33, 0xA0, 0xC2, 0x80, 0xC4, 0xDB, 0x42, 0x73, 0x91, 0xD3, 0x34, 0x5D, 0x76, 0x89, 0x55, 0xCF, 0x52, 0xCC, 0x25, 0x66,
+0x2F, 0x05, 0x21, 0x2A, 0x21, 0x32, 0x38, 0xA2, 0xF7, 0x1A, 0xBC, 0x3A, 0x2F, 0x5C, 0x93, 0xCD, 0xBC, 0x32, 0x24, 0x46, 0x1F,
+0xC4, 0x1C, 0x72, 0x47, 0x9A, 0x92, 0x9C, 0xB1, 0x84, 0x50, 0x72, 0x48, 0xD7, 0xEA, 0x98, 0xA4, 0x3C, 0xC5, 0x38, 0x0F, 0x85,
+0x9C, 0x86, 0xF3, 0xAB, 0x08, 0x7F, 0x9F, 0x4B, 0x91, 0xCC, 0x63, 0x1D, 0x9D, 0x07, 0xC9, 0xB3, 0x7E, 0xF2, 0x84, 0xD1, 0x49,
+0xF0, 0xAC, 0xF7, 0xA4, 0x17, 0xEC, 0xED, 0x3D, 0x79, 0x1A, 0xD0, 0xDD, 0xDD, 0xE7, 0x41, 0x3F, 0x7E, 0xB6, 0xBB, 0xCB, 0xF6,
+0x7B, 0xF1, 0x78, 0xCC, 0x22, 0x71, 0xCD, 0x24, 0xD6, 0x0F, 0x10, 0x0E, 0x7C, 0x0A, 0x2B, 0xCC, 0x2F, 0x63, 0x28, 0xA2, 0x57,
+0xDE, 0x68, 0xAB, 0x9E, 0xDA, 0xFD, 0xB0, 0xDF, 0x39, 0x8C, 0xE8, 0x88, 0xBC, 0x2A, 0x65, 0x03, 0xCD, 0x90, 0x89, 0x14, 0x19,
+0xF9, 0x01, 0xB8, 0x21, 0x47, 0xC0, 0x02, 0x39, 0x83, 0x9C, 0xC2, 0xB4, 0xD1, 0x10, 0xE1, 0x13, 0xD4, 0x05, 0x59, 0xD0, 0x1C,
+0xF2, 0xA2, 0x20, 0x50, 0x55, 0x61, 0x7D, 0x49, 0xBE, 0xA7, 0x56, 0x63, 0x16, 0x2A, 0xA9, 0x9C, 0x26, 0x24, 0x28, 0x75, 0x4C,
+0x73, 0x48, 0xD7, 0x53, 0x4C, 0x31, 0x12, 0x8D, 0x48, 0x68, 0x1C, 0x33, 0xA5, 0x80, 0x0E, 0x63, 0x44, 0x4C, 0x4C, 0x39, 0x9C,
+0xB2, 0x4F, 0x2B, 0xA4, 0xC4, 0x71, 0x0E, 0xD8, 0x21, 0x57, 0x6D, 0x0A, 0x09, 0x19, 0x8D, 0xA1, 0x38, 0x21, 0xF9, 0x46, 0xA4,
+0xA9, 0x58, 0x60, 0x9A, 0x24, 0x93, 0x39, 0xE8, 0x9C, 0x43, 0x02, 0x96, 0xA0, 0x48, 0xE0, 0x52, 0x6D, 0x12, 0x5A, 0x31, 0x0C,
+0x9E, 0x06, 0x8A, 0x09, 0xA7, 0x5C, 0xCF, 0xE6, 0xE3, 0x90, 0x8B, 0x68, 0x15, 0x00, 0x81, 0xD1, 0x59, 0x00, 0xBE, 0x15, 0x80,
+0x92, 0x54, 0xF0, 0x7A, 0xCE, 0x13, 0x16, 0x16, 0xC9, 0xE4, 0x01, 0x3E, 0xCA, 0x10, 0xD9, 0x8C, 0x94, 0x2F, 0x76, 0xFA, 0x77,
+0xD7, 0x71, 0xE5, 0xF4, 0xEF, 0xD0, 0xCA, 0x31, 0xDA, 0x53, 0x83, 0x8A, 0xD4, 0x27, 0xFC, 0xDD, 0x41, 0xFE, 0xD9, 0xFE, 0x7E,
+0x62, 0x5D, 0x85, 0xA6, 0x4A, 0x6C, 0xF8, 0x0B, 0x26, 0x38, 0xE7, 0x31, 0x87, 0x7C, 0x74, 0x4A, 0xA1, 0x3A, 0x2A, 0xC6, 0x72,
+0x42, 0xF5, 0x61, 0xC4, 0x47, 0x60, 0x2D, 0xC4, 0x63, 0x7C, 0xCA, 0xF8, 0x4B, 0xD3, 0xBD, 0x94, 0x95, 0x5E, 0x75, 0xAD, 0x2B,
+0xFE, 0xFE, 0x90, 0xDA, 0x4B, 0x58, 0xDC, 0xDF, 0xD9, 0x7B, 0x1A, 0x24, 0xBD, 0x3D, 0x08, 0xA9, 0x9D, 0xE7, 0x3D, 0x08, 0x2E,
+0xBA, 0x17, 0x3C, 0xD9, 0x7D, 0x9E, 0x4C, 0x68, 0xBC, 0xBF, 0x47, 0x9F, 0xEF, 0x3C, 0x10, 0x52, 0xEB, 0x56, 0xF8, 0xE2, 0x68,
+0xFA, 0xBF, 0xB9, 0x47, 0x2E, 0x8D, 0x6B, 0x34, 0xD5, 0x74, 0x21, 0xAE, 0x40, 0xA3, 0xED, 0x53, 0x36, 0xA5, 0xF1, 0xB2, 0xB3,
+0xCD, 0x37, 0x2C, 0xD8, 0x17, 0xFB, 0xC5, 0xEE, 0x13, 0x13, 0xB1, 0x34, 0xC6, 0x15, 0x8D, 0x54, 0x7E, 0x9F, 0x67, 0xCC, 0x28,
+0xA4, 0x24, 0xBA, 0x66, 0xDC, 0xE3, 0xFC, 0xD7, 0x39, 0x97, 0x1C, 0xEA, 0xCD, 0x11, 0x95, 0xD0, 0x6A, 0x41, 0x82, 0x87, 0x52,
+0xF5, 0x9E, 0x8D, 0x9D, 0xD5, 0x2D, 0x41, 0x03, 0x8F, 0x69, 0x45, 0x69, 0x34, 0x3F, 0xF4, 0xC7, 0x26, 0xD4, 0x53, 0x23, 0x2B,
+0x41, 0x2B, 0x93, 0x09, 0xB8, 0x44, 0x48, 0x2E, 0x66, 0x5C, 0x99, 0x9F, 0x04, 0xFE, 0xA6, 0xFC, 0x8A, 0xA5, 0x4B, 0xF4, 0xC3,
+0x31, 0x43, 0x57, 0x44, 0x46, 0x79, 0x3E, 0xC7, 0x97, 0xB9, 0x4B, 0x15, 0x26, 0x39, 0xA2, 0xC3, 0x32, 0xC8, 0x58, 0xD0, 0xE0,
+0x43, 0x2B, 0x96, 0x54, 0xB9, 0x0B, 0x6A, 0x17, 0xB8, 0x9B, 0x9E, 0x99, 0xBD, 0xDB, 0xF3, 0x63, 0x9B, 0x8E, 0xC1, 0x61, 0x3A,
+0x21, 0xC8, 0x61, 0xB4, 0x33, 0x2B, 0x19, 0x66, 0x37, 0xA0, 0x2F, 0x20, 0x4E, 0x15, 0x22, 0x66, 0x90, 0x8D, 0x21, 0xFD, 0x96,
+0x64, 0x8D, 0xB3, 0x93, 0xDC, 0xFD, 0x0B, 0xB6, 0xFC, 0xAF, 0xFC, 0xD7, 0x59, 0x65, 0xD4, 0x78, 0x2E, 0x25, 0x58, 0x05, 0x70,
+0x5A, 0x25, 0x34, 0x33, 0xAC, 0x23, 0xFB, 0xC9, 0x14, 0xCB, 0x68, 0xAA, 0x79, 0xC6, 0xC2, 0xDC, 0x59, 0x01, 0x23, 0x06, 0x26,
+0x1B, 0x0C, 0x96, 0xB7, 0x05, 0xCB, 0x4F, 0x8F, 0x5E, 0xBE, 0x7F, 0xF7, 0x83, 0xC1, 0x2C, 0xCD, 0x8E, 0x3F, 0x21, 0xD9, 0x89,
+0x45, 0x66, 0xDC, 0x19, 0xE9, 0xBF, 0x67, 0x54, 0x63, 0xDB, 0x7D, 0x46, 0x0B, 0x93, 0xE5, 0xDE, 0x6C, 0xCF, 0x72, 0x0E, 0xE4,
+0x8B, 0x5D, 0xD9, 0x25, 0xCE, 0x2F, 0xF4, 0xDF, 0xE3, 0x0D, 0x04, 0xEB, 0x75, 0x51, 0xC1, 0x3B, 0xF0, 0x86, 0x85, 0xE3, 0xDE,
+0x3A, 0x24, 0xE6, 0x81, 0x35, 0x99, 0xEE, 0xAB, 0x8F, 0xD6, 0x6E, 0x50, 0x26, 0xC5, 0x1C, 0x10, 0x6E, 0x58, 0x6D, 0x26, 0xC0,
+0x62, 0x02, 0x50, 0x39, 0x02, 0x19, 0x60, 0x82, 0x0C, 0x17, 0xE1, 0x9C, 0xA8, 0x22, 0xC5, 0xA7, 0xF9, 0x2F, 0xF3, 0xE2, 0xA1,
+0xF2, 0x08, 0x6D, 0x3D, 0x31, 0x95, 0xCE, 0xA6, 0xCF, 0x32, 0x2D, 0x6F, 0xE7, 0x37, 0x38, 0x63, 0x9A, 0x09, 0x14, 0x31, 0x17,
+0x2B, 0x81, 0x95, 0xD5, 0x23, 0x04, 0xD9, 0xFF, 0xCB, 0xEE, 0x30, 0x70, 0x18, 0xBB, 0x5F, 0x48, 0x9A, 0x2B, 0x9C, 0x80, 0x8D,
+0x2E, 0x4E, 0xA1, 0xFD, 0x87, 0x32, 0xF0, 0x80, 0xF1, 0x1D, 0xDC, 0x97, 0xE7, 0xB1, 0x9D, 0x5A, 0x1E, 0xBB, 0x98, 0x9C, 0x92,
+0x17, 0x45, 0xF1, 0x3B, 0xBC, 0xE1, 0x1E, 0xEC, 0xF7, 0x4A, 0x81, 0xDA, 0x6B, 0x03, 0xCF, 0xBF, 0xC0, 0x8F, 0x4E, 0xE9, 0x38,
+0x26, 0x17, 0x8A, 0x1C, 0x12, 0x88, 0x6E, 0x9A, 0x06, 0xAC, 0x0C, 0x81, 0x07, 0x39, 0x02, 0x86, 0x21, 0x93, 0x7C, 0x60, 0x30,
+0xC2, 0x8D, 0x9D, 0x4F, 0xB8, 0x8E, 0x2D, 0xD9, 0x9B, 0xAE, 0x03, 0x2F, 0x02, 0xE4, 0x8A, 0xA6, 0xA1, 0x9E, 0xA4, 0xE1, 0x54,
+0x5C, 0x63, 0xA8, 0xA3, 0xCB, 0x3C, 0xE8, 0x31, 0x6B, 0x36, 0x8E, 0x50, 0xFE, 0xFB, 0x27, 0x80, 0x09, 0x0C, 0x83, 0x76, 0xEC,
+0xD0, 0x46, 0x0B, 0x14, 0x13, 0x15, 0x8E, 0x04, 0xA4, 0xD0, 0x41, 0xEF, 0xBE, 0x89, 0x45, 0x42, 0xC3, 0x36, 0xB5, 0x63, 0x48,
+0x1D, 0xA1, 0x48, 0x83, 0x27, 0xB8, 0x06, 0x83, 0xB0, 0x06, 0x15, 0xA2, 0xC5, 0x15, 0x68, 0xCB, 0x73, 0x47, 0x0F, 0xF6, 0x77,
+0x39, 0x85, 0xC1, 0x78, 0x89, 0xD3, 0x63, 0x39, 0xED, 0x2C, 0x82, 0x7E, 0xAF, 0x57, 0x7A, 0x86, 0x45, 0x00, 0x75, 0x1B, 0x20,
+0x0E, 0x23, 0xFB, 0xB4, 0x5D, 0x86, 0x2D, 0x24, 0x41, 0xD1, 0x31, 0x4B, 0x4B, 0xA2, 0xE5, 0xD3, 0x1A, 0xD9, 0xCD, 0xA1, 0x75,
+0x1B, 0x03, 0x18, 0x6E, 0x78, 0xA6, 0x92, 0x8C, 0x5E, 0x19, 0x34, 0x9B, 0xBC, 0x3C, 0xF4, 0xA7, 0x9C, 0xC0, 0x53, 0x06, 0x99,
+0x86, 0x29, 0x0D, 0xDD, 0xDD, 0xC9, 0x11, 0x19, 0x12, 0xDF, 0x3F, 0x20, 0x51, 0x44, 0xDE, 0x69, 0x21, 0xB1, 0xAA, 0xE2, 0xAB,
+0xB2, 0x4F, 0x3C, 0x39, 0x72, 0x27, 0x10, 0xE0, 0x11, 0xC7, 0x52, 0x0A, 0x79, 0x01, 0x8E, 0x0B, 0x20, 0x1E, 0x39, 0x4F, 0x19,
+0x85, 0xDA, 0x69, 0x26, 0xDE, 0x95, 0x1F, 0xC6, 0xA2, 0xE0, 0x50, 0x9E, 0x8C, 0x1B, 0xA3, 0x13, 0xC5, 0x02, 0x2A, 0x0D, 0x56,
+0xAF, 0x90, 0x9C, 0x68, 0x98, 0x56, 0xA1, 0x84, 0xD2, 0x2B, 0x46, 0xE6, 0x05, 0xA6, 0xBA, 0xDD, 0x1E, 0x0E, 0xB4, 0x73, 0xA0,
+0xE7, 0xFC, 0x2F, 0x67, 0x0B, 0xA8, 0x49, 0x31, 0x54, 0x16, 0x0D, 0x48, 0x10, 0xDE, 0x14, 0x5C, 0x28, 0xA6, 0x98, 0xD1, 0x34,
+0x54, 0xBE, 0xF0, 0xE7, 0xFC, 0xE7, 0xFC, 0x7B, 0x41, 0xEC, 0x51, 0x83, 0xB2, 0x44, 0xC7, 0xD8, 0xFF, 0xA1, 0x31, 0x93, 0xD0,
+0x3B, 0x68, 0x3D, 0x6E, 0x97, 0xE7, 0x21, 0x9D, 0x10, 0x30, 0x25, 0xCB, 0xF6, 0x64, 0x9E, 0x9B, 0xF6, 0xBD, 0xDD, 0xA9, 0x0E,
+0x66, 0x4C, 0xFF, 0x72, 0x4E, 0x35, 0xF8, 0x5A, 0x0E, 0xE2, 0x44, 0xFF, 0xF9, 0x89, 0x06, 0x93, 0x5E, 0xF0, 0xFC, 0xDF, 0xB7,
+0xCF, 0xEE, 0x82, 0xEA, 0xF7, 0xDE, 0x67, 0xFC, 0xEE, 0xEF, 0xDC, 0x3D, 0x8E, 0xCA, 0x73, 0x1A, 0x88, 0x8B, 0xFB, 0xF0, 0xEE,
+0xDA, 0x7D, 0x25, 0x2F, 0xE4, 0x9A, 0xA6, 0x1C, 0x92, 0x25, 0xC3, 0x81, 0xA0, 0xC1, 0xD8, 0x8F, 0xD0, 0xCF, 0x00, 0xE8, 0xE3,
+0xB6, 0xFF, 0x17, 0xC3, 0xA5, 0xDF, 0x09, 0x61, 0x6F, 0xBB, 0x13, 0x6A, 0xF0, 0xCC, 0x76, 0xA7, 0x46, 0x0A, 0x77, 0xDA, 0x8D,
+0x36, 0x8F, 0xDD, 0xB3, 0x33, 0x97, 0xC7, 0x36, 0xDD, 0x22, 0x5A, 0x83, 0x3F, 0x4C, 0x59, 0x3E, 0x85, 0x66, 0x64, 0x44, 0x7A,
+0x35, 0x74, 0xE5, 0xAE, 0xA1, 0xC3, 0xBD, 0x65, 0x97, 0x81, 0xE6, 0x06, 0xD1, 0xA3, 0x1A, 0xDA, 0xFF, 0xFE, 0xB7, 0xA1, 0xD0,
+0x10, 0x3D, 0xA8, 0x6D, 0xF6, 0xAE, 0xB1, 0xCB, 0x11, 0xFB, 0xA3, 0x1A, 0x2D, 0x80, 0x6C, 0xE8, 0xCC, 0x82, 0xDA, 0xCD, 0x15,
+0x2C, 0xCB, 0xD1, 0xE7, 0x31, 0xF6, 0x4A, 0x01, 0x00, 0xCF, 0x57, 0x5F, 0x55, 0x38, 0xD1, 0xE6, 0xFE, 0x5F, 0xD0, 0x01, 0x40,
+0x03, 0x85, 0x14, 0x45, 0xDB, 0x2F, 0xE3, 0xC4, 0xEF, 0x92, 0x47, 0x2B, 0x70, 0x3C, 0x8D, 0x6A, 0x51, 0xB5, 0xCC, 0x63, 0xB2,
+0x61, 0x87, 0xB7, 0xA6, 0x0F, 0x68, 0x9B, 0xDE, 0x07, 0xCD, 0x01, 0xD9, 0xD5, 0x3E, 0x90, 0xE1, 0x10, 0x43, 0xA4, 0x03, 0xC9,
+0x12, 0x5A, 0x3C, 0x68, 0xBB, 0xE4, 0x9C, 0x1D, 0xB4, 0x34, 0x1E, 0x2B, 0x39, 0xFE, 0x60, 0xC2, 0x2B, 0xE0, 0x07, 0x72, 0x47,
+0x17, 0x94, 0x43, 0xDA, 0x66, 0x3A, 0x9E, 0xB5, 0x2F, 0x6B, 0x89, 0x73, 0x5B, 0xC9, 0xC5, 0x52, 0x19, 0xED, 0x84, 0xFB, 0x91,
+0x5B, 0xFF, 0x3A, 0xA5, 0x7A, 0xB8, 0xDF, 0xFF, 0x2A, 0x15, 0xF9, 0xB0, 0xF7, 0x15, 0x98, 0x14, 0x92, 0xC7, 0xE3, 0x5B, 0xC3,
+0xC3, 0xDD, 0x25, 0xB0, 0xEE, 0xE8, 0x97, 0xD4, 0x42, 0x71, 0x05, 0xE2, 0x40, 0x1A, 0x07, 0x5A, 0xA4, 0xCD, 0x30, 0x38, 0x91,
+0x6F, 0xB7, 0x6B, 0x02, 0xC3, 0x13, 0x43, 0x71, 0xEF, 0x15, 0xF8, 0x87, 0x64, 0x6A, 0x8F, 0x33, 0xFE, 0x28, 0x99, 0xFB, 0xE1,
+0xFA, 0x0C, 0xD5, 0xEF, 0xF5, 0x7B, 0x41, 0x0A, 0x61, 0x1C, 0x54, 0x63, 0xB3, 0x9D, 0x9A, 0xF1, 0xB9, 0xFF, 0xCB, 0x4E, 0x64,
+0x7A, 0x46, 0x84, 0x8D, 0x76, 0x7A, 0x3B, 0x3B, 0xBD, 0xFE, 0x4E, 0x2F, 0x7A, 0xCD, 0x34, 0xB0, 0x69, 0x06, 0xE8, 0xF7, 0x50,
+0xC3, 0xDC, 0xC4, 0x14, 0xBD, 0x7F, 0x71, 0x71, 0xD9, 0x05, 0x6E, 0x32, 0x06, 0x75, 0x2D, 0x19, 0x10, 0xFF, 0xF5, 0xF1, 0x85,
+0xDF, 0x6D, 0xD9, 0x53, 0x2B, 0x35, 0x80, 0x37, 0xFE, 0x4D, 0x00, 0x88, 0x20, 0x89, 0xF8, 0x03, 0xDB, 0xD1, 0x76, 0x5B, 0xFE,
+0x8B, 0x38, 0x66, 0x85, 0x86, 0x05, 0x1F, 0x8F, 0x28, 0x79, 0x6C, 0xFA, 0xD2, 0xE8, 0xA3, 0x12, 0xB9, 0x8F, 0xAA, 0x02, 0x25,
+0xA3, 0x0A, 0x1E, 0xD5, 0x54, 0x5C, 0xA9, 0xC0, 0x29, 0xD4, 0x4A, 0x6F, 0xBA, 0x9C, 0x52, 0xF2, 0x6A, 0x37, 0xE2, 0x69, 0x3B,
+0x1C, 0x46, 0x6C, 0x28, 0x61, 0x3C, 0x77, 0x99, 0x54, 0xA1, 0xC7, 0x6E, 0xAE, 0xD6, 0x82, 0x0C, 0x2D, 0x50, 0x4F, 0xCB, 0x9B,
+0x9B, 0x7F, 0xEA, 0xFD, 0x3B, 0x54, 0x65, 0x62, 0x36, 0x39, 0xFB, 0xB5, 0xA4, 0x63, 0x48, 0x9C, 0xD5, 0x22, 0x48, 0xD1, 0x30,
+0xD9, 0xA6, 0x7F, 0xA0, 0x00, 0x22, 0x65, 0x61, 0x2A, 0xA6, 0x6E, 0xF1, 0xE0, 0x8B, 0x7C, 0xC6, 0x1E, 0x09, 0xFC, 0xC9, 0x3E,
+0xE3, 0xE4, 0x03, 0x37, 0x31, 0xD6, 0xBF, 0xDF, 0x55, 0x9C, 0xA6, 0x4A, 0x2F, 0x81, 0xF0, 0x29, 0x15, 0x7A, 0xF7, 0x87, 0xB8,
+0xCB, 0xEF, 0x8D, 0xC9, 0xC7, 0x21, 0x34, 0x4B, 0xDF, 0xBD, 0x7B, 0xFB, 0x7D, 0xDB, 0x8F, 0x2C, 0x59, 0x65, 0xDC, 0x07, 0xF2,
+0x55, 0xA5, 0x74, 0xE3, 0x43, 0xA5, 0x8A, 0x8D, 0x4A, 0xAA, 0x13, 0x48, 0x5C, 0xC5, 0x9C, 0x57, 0x2D, 0xB8, 0xD4, 0xBF, 0xB6,
+0x0B, 0x69, 0xD5, 0x81, 0xAD, 0xED, 0x6A, 0xC0, 0x76, 0x61, 0x0D, 0xD8, 0xED, 0x6A, 0x00, 0xE7, 0xF2, 0xA2, 0x34, 0xF8, 0x7A,
+0x61, 0x6A, 0xBC, 0x6F, 0x00, 0xC1, 0x68, 0xD5, 0x80, 0xB2, 0xA3, 0x56, 0x1D, 0xAC, 0xDA, 0xD1, 0x80, 0xB3, 0xD5, 0xAC, 0x84,
+0x6A, 0xD4, 0xB6, 0xFA, 0x7B, 0x84, 0x69, 0x56, 0x51, 0x5B, 0x08, 0x6C, 0x87, 0xB5, 0xAD, 0x14, 0x18, 0x03, 0x98, 0x4F, 0x12,
+0x07, 0x2B, 0x31, 0xBA, 0x64, 0x45, 0x02, 0xE2, 0xD7, 0x37, 0xD3, 0x41, 0xC3, 0x0E, 0xC8, 0xC9, 0x3A, 0xA1, 0xBB, 0x75, 0x62,
+0x31, 0xF8, 0xC7, 0x95, 0xFB, 0xFC, 0xE3, 0xBE, 0xF3, 0xCC, 0xA0, 0xB7, 0x16, 0x72, 0x19, 0x8E, 0x29, 0xBC, 0xE9, 0x74, 0x1A,
+0x65, 0xCA, 0x6E, 0x5F, 0x0B, 0xB3, 0x5A, 0x1F, 0xF0, 0x18, 0x1B, 0x43, 0x2C, 0xEE, 0x1A, 0xB0, 0x54, 0x95, 0xB0, 0x32, 0xAD,
+0xAB, 0xFB, 0xEB, 0xF6, 0x5F, 0x2F, 0xFD, 0x95, 0x35, 0x57, 0xFB, 0x1B, 0x26, 0xDF, 0x6C, 0x15, 0xEC, 0xD1, 0xCF, 0xA7, 0xDB,
+0x8F, 0xD2, 0x72, 0x6E, 0x6B, 0xC3, 0xB4, 0xEB, 0x7B, 0xAD, 0x7A, 0x1F, 0x6E, 0x55, 0x50, 0xDE, 0x4D, 0x83, 0x61, 0x0E, 0xA9,
+0xD0, 0x70, 0x05, 0x35, 0xBA, 0x6C, 0x22, 0x6C, 0x02, 0x59, 0x2B, 0xDE, 0x35, 0x77, 0x32, 0x79, 0x7C, 0x05, 0x81, 0x8A, 0xB5,
+0x20, 0x63, 0xF5, 0x22, 0x65, 0x52, 0xB7, 0x2F, 0x71, 0x90, 0x3D, 0x1C, 0xAF, 0x1F, 0x15, 0x40, 0x47, 0x3D, 0xAA, 0x4F, 0xAA,
+0xB9, 0x70, 0x54, 0xC2, 0xC7, 0xB7, 0xF5, 0x1E, 0xD8, 0x54, 0xE4, 0xED, 0x4C, 0x97, 0x5E, 0x66, 0xA3, 0x1E, 0xBD, 0xB4, 0xE4,
+0xDF, 0x96, 0xDC, 0xED, 0x22, 0xAC, 0xCA, 0x71, 0x3D, 0x7E, 0x9D, 0x18, 0x35, 0xC0, 0x7B, 0x24, 0xC1, 0xB3, 0x5D, 0x90, 0x66,
+0xDB, 0x59, 0xFD, 0x1F, 0x22, 0x12, 0x32, 0xB6, 0xF2, 0xC6, 0x47, 0x98, 0xF9, 0x4D, 0x4B, 0x56, 0xD5, 0xAF, 0x47, 0xB6, 0x18,
+0xDC, 0xD6, 0x85, 0x87, 0x37, 0xF7, 0x0A, 0xEF, 0xEA, 0x4A, 0x3D, 0xFF, 0xAC, 0x84, 0x2F, 0x01, 0x1F, 0x16, 0x7E, 0xED, 0x54,
+0xF5, 0x0F, 0x91, 0xBB, 0x34, 0x66, 0x41, 0x97, 0xA9, 0xA0, 0x28, 0x09, 0xA4, 0xF7, 0x52, 0x0F, 0x83, 0x55, 0x80, 0x76, 0x5B,
+0x95, 0x24, 0x83, 0x55, 0x18, 0x76, 0x5B, 0x2E, 0xC2, 0x06, 0x65, 0xA8, 0x75, 0x5B, 0xA5, 0xD3, 0x0E, 0xAA, 0x98, 0xEA, 0xB6,
+0x6C, 0x90, 0x0C, 0x5C, 0xE4, 0xB4, 0xEE, 0x80, 0xBF, 0x10, 0xEF, 0x0B, 0xB4, 0x6F, 0x5B, 0x73, 0x99, 0x42, 0x3D, 0x8A, 0x30,
+0x8D, 0x60, 0xD5, 0x80, 0x22, 0x86, 0x13, 0x22, 0x2C, 0x9D, 0xBF, 0x7D, 0x87, 0x25, 0xCD, 0x7D, 0x28, 0xBF, 0xB0, 0x8B, 0x1B,
+0x75, 0xAB, 0xDB, 0xC2, 0x14, 0x3A, 0x20, 0x58, 0x7B, 0x42, 0xA5, 0xF1, 0x60, 0x92, 0x4F, 0x96, 0x6D, 0x27, 0x4E, 0xA7, 0xDB,
+0x52, 0x73, 0xF3, 0x85, 0x05, 0x68, 0xAF, 0xE5, 0xA6, 0xB2, 0xC6, 0x6D, 0xDA, 0xA0, 0x7C, 0xD3, 0xF5, 0xB6, 0x7F, 0xF3, 0xF3,
+0xBA, 0x30, 0xC9, 0xF6, 0x7A, 0xA0, 0xC7, 0x54, 0x58, 0x5E, 0x60, 0x30, 0x33, 0xC7, 0x2C, 0x6D, 0x2F, 0xF2, 0x30, 0x99, 0x76,
+0x5B, 0xA6, 0x56, 0x6E, 0x12, 0xBD, 0x99, 0xC9, 0x2E, 0xB1, 0xB7, 0x01, 0xBA, 0xA4, 0xAA, 0xA7, 0x4D, 0xF2, 0xB0, 0x27, 0x2C,
+0x59, 0x40, 0x7B, 0x76, 0xBD, 0x77, 0x4B, 0xA5, 0x59, 0x46, 0x8C, 0x85, 0xBD, 0x4F, 0x1A, 0xD7, 0x56, 0xF2, 0xF2, 0xBF, 0x8A,
+0xB6, 0x9A, 0x89, 0xC5, 0x4B, 0x75, 0x26, 0x12, 0xC8, 0x53, 0xC2, 0x1C, 0xD4, 0xA8, 0x95, 0x3B, 0x43, 0xA7, 0x86, 0x5F, 0xFE,
+0x71, 0x78, 0x3E, 0x03, 0x6D, 0x51, 0xFC, 0xEC, 0xDD, 0x32, 0x5F, 0x2F, 0xD1, 0xED, 0xAD, 0x4D, 0xF0, 0x27, 0x45, 0x0E, 0xF1,
+0x99, 0x67, 0x0C, 0x8F, 0x5F, 0x86, 0xA4, 0x07, 0x16, 0xCF, 0x5F, 0x89, 0x7C, 0xC2, 0x65, 0xB6, 0xFA, 0x98, 0x7F, 0x67, 0x56,
+0x4D, 0x2D, 0xA9, 0x2D, 0x42, 0x2B, 0x31, 0x24, 0x8E, 0x76, 0x99, 0x05, 0x33, 0x64, 0xE8, 0x04, 0x1D, 0xCF, 0x1F, 0x5B, 0xEE,
+0x02, 0x9F, 0xFC, 0x0D, 0x8F, 0x93, 0x59, 0x98, 0x8B, 0xC5, 0x2A, 0xEB, 0x9A, 0x8D, 0xDF, 0xE2, 0x5D, 0x98, 0x21, 0xB9, 0x6C,
+0x9E, 0xAD, 0xE1, 0x1B, 0x10, 0x3F, 0x61, 0x9E, 0x39, 0xA0, 0x78, 0x7C, 0xEB, 0x90, 0xDE, 0xE1, 0x31, 0xCE, 0x18, 0x8A, 0x17,
+0xBB, 0x19, 0x7A, 0x41, 0xDF, 0x23, 0x54, 0x72, 0x6A, 0x0F, 0xDC, 0x40, 0x65, 0xE3, 0x65, 0x7D, 0xEB, 0x29, 0xAE, 0xBA, 0x1D,
+0x33, 0x9E, 0x24, 0x2C, 0x1F, 0x7A, 0x98, 0xAE, 0x3D, 0x52, 0x5E, 0x38, 0xC0, 0xB2, 0x97, 0x80, 0xD2, 0xF1, 0x82, 0x0C, 0x58,
+0x3D, 0x5E, 0xFF, 0x76, 0x6B, 0x78, 0x4F, 0x38, 0x85, 0x4E, 0x94, 0xD4, 0x1F, 0xDC, 0x87, 0x65, 0x96, 0x6C, 0x05, 0x70, 0xFE,
+0xBD, 0xF5, 0x9D, 0x6D, 0xE7, 0xD6, 0x3E, 0x46, 0x9B, 0x37, 0xC6, 0x5A, 0xEB, 0xD2, 0x5A, 0x11, 0x46, 0xD0, 0x24, 0xE2, 0xDB,
+0x3B, 0xF7, 0x69, 0xDA, 0x9D, 0xDC, 0x34, 0xCF, 0x5D, 0x56, 0xA7, 0x35, 0x41, 0x9C, 0x0A, 0x55, 0x93, 0x12, 0x1C, 0x2A, 0xE3,
+0x15, 0xA1, 0xBA, 0xCA, 0x86, 0xDE, 0x2B, 0xB3, 0x75, 0xF4, 0xE0, 0x89, 0x91, 0xE5, 0x0F, 0x5D, 0xC7, 0xAB, 0x3E, 0xF6, 0xE3,
+0x37, 0xF6, 0x40, 0x15, 0x10, 0x20, 0x03, 0x52, 0xC0, 0x8C, 0xB4, 0x90, 0xB4, 0x38, 0x40, 0x46, 0x71, 0xDB, 0xDD, 0xBD, 0x48,
+0xEC, 0xD9, 0x19, 0x88, 0x0F, 0x12, 0x19, 0xFF, 0xC3, 0x86, 0x3C, 0xB6, 0xAE, 0xE6, 0x93, 0xAF, 0xC9, 0xE5, 0xA7, 0x64, 0x33,
+0x27, 0x51, 0xD5, 0x09, 0xD4, 0xFD, 0x32, 0x36, 0xD5, 0x68, 0xEE, 0x63, 0xB8, 0x63, 0xAD, 0xF5, 0x73, 0xA9, 0x4B, 0xBC, 0x50,
+0xE2, 0xDF, 0xB5, 0x3E, 0x8B, 0xB2, 0x3B, 0x7A, 0xDB, 0x8A, 0x5F, 0x5C, 0x19, 0x43, 0x6D, 0x13, 0xCB, 0x7F, 0xFB, 0xC6, 0xDC,
+0x5B, 0x31, 0xDA, 0xF6, 0xEF, 0x3E, 0xEB, 0x4C, 0xEC, 0xF2, 0xA0, 0x55, 0x5D, 0x9F, 0x41, 0xA5, 0x86, 0x1C, 0x92, 0x87, 0xD4,
+0x2F, 0x92, 0x8F, 0x14, 0xBD, 0xEF, 0xDB, 0x8B, 0xB3, 0xD3, 0xB6, 0x3F, 0x66, 0x13, 0x21, 0x19, 0xCB, 0x31, 0x59, 0x54, 0xD1,
+0xD4, 0x8C, 0x2F, 0x77, 0xE5, 0x06, 0xA7, 0xB5, 0x12, 0x1D, 0x34, 0xF6, 0x6E, 0xF5, 0xE5, 0xF2, 0x24, 0x69, 0x3B, 0x29, 0x2A,
+0x30, 0x17, 0xB4, 0x78, 0x92, 0xC1, 0x16, 0x64, 0x75, 0xA5, 0xCC, 0x26, 0x9A, 0x3A, 0x52, 0xCC, 0x97, 0x0C, 0x2B, 0xA7, 0xCB,
+0x16, 0xE6, 0x68, 0xC6, 0xCD, 0x10, 0xF7, 0x51, 0xBB, 0xDC, 0x50, 0xDB, 0x65, 0x67, 0xDB, 0x4D, 0x1D, 0xEC, 0x3E, 0x41, 0xAA,
+0xF2, 0xB6, 0x52, 0x93, 0x86, 0x9D, 0xDC, 0x1C, 0xA3, 0xD0, 0xC5, 0x26, 0xE6, 0xF2, 0x4F, 0x95, 0xB5, 0xCA, 0xF6, 0xD7, 0x4C,
+0x7E, 0x1B, 0x06, 0xC1, 0x1C, 0xF9, 0xB9, 0xDC, 0x59, 0xA7, 0xF9, 0x2C, 0x0E, 0xB7, 0x70, 0x63, 0x80, 0x4B, 0x66, 0xEE, 0x5A,
+0x75, 0xD5, 0x6D, 0x41, 0x68, 0x73, 0x54, 0x38, 0x56, 0xA1, 0xD9, 0x58, 0x17, 0xDE, 0xB6, 0x19, 0x2B, 0x0D, 0x60, 0x1F, 0xB3,
+0x55, 0xAE, 0x06, 0x51, 0xC2, 0xC0, 0x12, 0xE4, 0x61, 0x60, 0x9B, 0xFE, 0x1D, 0x68, 0x4D, 0x7B, 0x4D, 0x66, 0x25, 0xCB, 0xC4,
+0x35, 0x2B, 0x25, 0x29, 0x25, 0xC5, 0xFA, 0x53, 0x9E, 0x26, 0x94, 0xE5, 0xC3, 0x9D, 0x12, 0x28, 0xA6, 0x2F, 0xEC, 0x4A, 0xBB,
+0x2E, 0xC4, 0xA7, 0x5C, 0xB0, 0xB3, 0x45, 0x8F, 0x50, 0x63, 0xA0, 0xCD, 0xB6, 0xC8, 0xEC, 0xE3, 0xAA, 0x02, 0x96, 0x05, 0x36,
+0xB3, 0x15, 0xAE, 0x6B, 0xD2, 0xE4, 0xD0, 0x5F, 0x2F, 0xF2, 0x7E, 0xD7, 0xC1, 0x0F, 0x7B, 0xB5, 0x61, 0x17, 0xBD, 0xFB, 0x5C,
+0x0A, 0xC8, 0x1B, 0x0C, 0x1B, 0x04, 0x91, 0xE2, 0xE9, 0x1D, 0x72, 0x5A, 0xAF, 0xAB, 0x36, 0xF3, 0x76, 0x31, 0x02, 0x07, 0x15,
+0x15, 0xEC, 0x5C, 0xCA, 0xC2, 0xE9, 0x30, 0x77, 0x2B, 0xF5, 0x0D, 0x1C, 0xAE, 0x6E, 0x69, 0x8B, 0x72, 0xA1, 0xAA, 0xE1, 0xF5,
+0xAB, 0x66, 0xDB, 0xEE, 0x62, 0x7E, 0xFE, 0x9D, 0xCF, 0x8F, 0xF5, 0x2B, 0x9F, 0xE3, 0x79, 0x9E, 0xA4, 0xAC, 0xBC, 0x97, 0x49,
+0x38, 0x54, 0xA1, 0xA9, 0xE4, 0x1A, 0x6A, 0xA2, 0x9A, 0xD1, 0xDD, 0x67, 0x7B, 0xC1, 0x37, 0x6F, 0x96, 0xE2, 0xF8, 0x1B, 0x21,
+0x5F, 0xBD, 0x4E, 0x97, 0xD7, 0x8B, 0x9B, 0xE7, 0xDF, 0x7E, 0xEC, 0x3D, 0xFF, 0x2E, 0xFE, 0x90, 0xEF, 0xE6, 0xD7, 0x4F, 0x17,
+0xFC, 0xFC, 0xC7, 0xF4, 0xB7, 0xA7, 0x1F, 0x3E, 0x2C, 0xBE, 0x93, 0xEF, 0x7F, 0x8C, 0xFF, 0xF5, 0x26, 0x7A, 0x99, 0xE5, 0x3F,
+0x1E, 0xDD, 0x9C, 0xFD, 0xED, 0x68, 0x47, 0xC5, 0xFF, 0x18, 0x9F, 0x5C, 0xDC, 0x9C, 0x40, 0x3A, 0x94, 0x42, 0x29, 0x21, 0xF9,
+0x94, 0x43, 0x2D, 0xA5, 0xB9, 0xC8, 0x97, 0x99, 0x98, 0x37, 0xEF, 0x80, 0x46, 0xA8, 0x2A, 0x73, 0x87, 0xCE, 0xDC, 0x75, 0xFD,
+0x1F, 0xEB, 0xFC, 0x2E, 0xFC, 0xFC, 0x2A, 0x00, 0x00
 };
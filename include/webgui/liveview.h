@@ -0,0 +1,45 @@
+// Generated from web/liveview.js (84209d4ca88a7b8a) - do not edit
+#include <Arduino.h>
+static const uint8_t liveviewjs[] = {
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8D, 0x55, 0xDB, 0x6E, 0xDB, 0x30, 0x0C, 0x7D, 0xCF, 0x57, 0x68,
+0x2F, 0xB5, 0x5C, 0x67, 0xAA, 0x73, 0x59, 0x17, 0xD4, 0x76, 0x81, 0xAD, 0x6B, 0x81, 0x02, 0x5B, 0x37, 0xAC, 0xBB, 0x3C, 0x14,
+0x19, 0xA0, 0xDA, 0x4A, 0x2A, 0xCC, 0x91, 0x0C, 0x59, 0x6E, 0x62, 0x0C, 0xFD, 0xF7, 0x91, 0x72, 0x12, 0xC7, 0x69, 0xD0, 0x0D,
+0x41, 0x10, 0x47, 0x3C, 0x24, 0x0F, 0x0F, 0x49, 0x79, 0x29, 0x55, 0xA6, 0x97, 0x2C, 0x97, 0x8F, 0xE2, 0x87, 0x14, 0x4B, 0x92,
+0x10, 0x4A, 0x7D, 0x92, 0x9C, 0x93, 0x3F, 0xBD, 0x54, 0xAB, 0xD2, 0x12, 0xB4, 0xC0, 0xE9, 0x9F, 0x52, 0xA7, 0xBF, 0x85, 0x3D,
+0x53, 0x55, 0x9E, 0xF7, 0xC9, 0xCC, 0xF0, 0x85, 0x38, 0x53, 0x80, 0xFF, 0x2E, 0x95, 0x9D, 0xBC, 0x33, 0x86, 0xD7, 0x74, 0x18,
+0x8E, 0x27, 0xFE, 0x53, 0xD4, 0x9B, 0x55, 0x2A, 0xB5, 0x52, 0x2B, 0x92, 0x19, 0xBE, 0xFC, 0x08, 0xEE, 0x57, 0x88, 0x86, 0xA8,
+0x9B, 0x90, 0x29, 0x57, 0x8F, 0xBC, 0x84, 0xA0, 0x99, 0x4E, 0xAB, 0x85, 0x50, 0x96, 0xCD, 0x85, 0xBD, 0xCC, 0x05, 0x3E, 0xBE,
+0xAF, 0xAF, 0x33, 0xEA, 0x61, 0xD2, 0x0B, 0x87, 0xF2, 0xFC, 0x68, 0xE3, 0x65, 0x57, 0xE0, 0xD2, 0xF8, 0xA2, 0xC3, 0x85, 0x56,
+0x56, 0xAC, 0x2C, 0xF5, 0x86, 0x59, 0x0B, 0x92, 0x0B, 0x3E, 0x47, 0xBA, 0x00, 0x66, 0xA9, 0x11, 0xDC, 0x8A, 0x6B, 0x3C, 0xF9,
+0xC0, 0x2D, 0xA7, 0xC3, 0x37, 0xA7, 0xFD, 0xD3, 0x31, 0x40, 0x67, 0xDA, 0x10, 0x9A, 0x0B, 0x4B, 0xEA, 0x24, 0x8C, 0xEA, 0xF8,
+0x74, 0x1C, 0xD5, 0x41, 0x80, 0xF4, 0xB6, 0x86, 0x15, 0x18, 0x56, 0x31, 0x38, 0x44, 0xAB, 0xC6, 0x22, 0x67, 0x60, 0x00, 0x52,
+0xCC, 0x55, 0x7E, 0x47, 0xEB, 0xF3, 0xF3, 0x91, 0x7F, 0x0C, 0x80, 0x60, 0x35, 0x25, 0x47, 0x84, 0x0E, 0xE2, 0x98, 0xD6, 0x47,
+0x6F, 0x7D, 0xBF, 0xAD, 0xB2, 0x40, 0x2D, 0xEB, 0x06, 0xE3, 0x1F, 0x8F, 0xA3, 0x9E, 0xE3, 0xC6, 0x32, 0xA0, 0x72, 0x57, 0x4C,
+0xC1, 0x18, 0xAE, 0xAE, 0xAE, 0xBA, 0xA7, 0xC1, 0xA0, 0x39, 0xBF, 0x08, 0xA3, 0xDE, 0x93, 0xFB, 0x6C, 0x19, 0x15, 0xC9, 0x28,
+0x2A, 0xE2, 0x16, 0xCC, 0x72, 0xA1, 0xE6, 0xF6, 0x21, 0x2A, 0x82, 0x64, 0xEC, 0x93, 0xC3, 0xA1, 0x51, 0x84, 0xA2, 0xB2, 0xAD,
+0x02, 0x0E, 0xD6, 0x0F, 0xFB, 0xA1, 0x8F, 0xF1, 0xB7, 0x7D, 0xE2, 0x45, 0x91, 0xD7, 0xD8, 0xA8, 0x4F, 0xA2, 0x2C, 0x01, 0x41,
+0x17, 0xE5, 0x7C, 0x53, 0x34, 0x3C, 0xAE, 0x53, 0x91, 0x98, 0x8C, 0x46, 0x3E, 0x31, 0xC2, 0x56, 0x46, 0x45, 0x1B, 0xE3, 0x5D,
+0x08, 0xF9, 0x12, 0xC8, 0xE8, 0x93, 0x56, 0x1F, 0x36, 0x93, 0x79, 0x4E, 0xC3, 0x6D, 0x57, 0x90, 0x18, 0xB0, 0xBA, 0x9B, 0xEE,
+0x68, 0x2F, 0x93, 0xD1, 0x28, 0x92, 0x71, 0x1B, 0x3F, 0xDA, 0x19, 0x10, 0x68, 0xAD, 0xD1, 0x39, 0xB8, 0x60, 0x06, 0x19, 0x04,
+0xD3, 0x26, 0xDF, 0xE6, 0x3C, 0x26, 0x83, 0xE1, 0xA4, 0xD3, 0x30, 0x05, 0x0D, 0x53, 0x71, 0xB2, 0x06, 0x44, 0x0A, 0xBB, 0xE6,
+0x64, 0x2A, 0xAA, 0xF2, 0x81, 0x6E, 0xA2, 0x60, 0xD9, 0x44, 0xE4, 0xA5, 0x78, 0xEE, 0xBA, 0xF6, 0x7C, 0x3D, 0x18, 0xBE, 0x3D,
+0xE8, 0x8D, 0xBE, 0x10, 0xA2, 0xE9, 0x8B, 0x6B, 0x88, 0xC6, 0x09, 0x0E, 0x77, 0x2A, 0xB2, 0x32, 0x17, 0x10, 0x0B, 0x7F, 0xDC,
+0xE8, 0xE0, 0x43, 0x3B, 0x3D, 0xAF, 0x5C, 0x9C, 0x41, 0x40, 0xF1, 0x18, 0xA7, 0x67, 0x3B, 0x37, 0x78, 0xE0, 0x46, 0xC7, 0x77,
+0x85, 0x4B, 0x55, 0x89, 0x8D, 0x70, 0xF7, 0xBC, 0xC4, 0x69, 0x46, 0xC4, 0xF1, 0xA4, 0x23, 0x5E, 0x08, 0xDA, 0x4D, 0x22, 0x89,
+0xF1, 0x77, 0xE6, 0x12, 0xF1, 0x81, 0x9C, 0x92, 0x5F, 0x09, 0x69, 0x86, 0x41, 0x97, 0x4E, 0xBC, 0xA7, 0xDE, 0xDE, 0x2E, 0x76,
+0xFA, 0x5F, 0x5A, 0x6E, 0x2C, 0xED, 0x8C, 0x79, 0xB3, 0xED, 0x6D, 0xB7, 0x1B, 0x3A, 0x00, 0xB4, 0xD5, 0x3F, 0x17, 0xF7, 0xD6,
+0xA1, 0x70, 0x27, 0x1B, 0x3C, 0xC3, 0x35, 0x75, 0xDB, 0xAA, 0x2C, 0xF8, 0x7A, 0xF0, 0xA8, 0x04, 0x64, 0x56, 0x73, 0xC6, 0x98,
+0x17, 0xF5, 0x76, 0x12, 0x82, 0x19, 0x2F, 0x95, 0x9F, 0xE2, 0xFE, 0xD6, 0xFD, 0xA7, 0xDE, 0xB2, 0x3C, 0x3B, 0x39, 0xF1, 0x48,
+0x40, 0x72, 0x9D, 0x72, 0x64, 0xCB, 0x1E, 0x34, 0x30, 0x09, 0x88, 0x77, 0xB2, 0x90, 0xC6, 0x68, 0x83, 0x79, 0x76, 0x22, 0xB0,
+0x7B, 0xA9, 0xB8, 0xA9, 0xBF, 0xD5, 0x05, 0x0A, 0xE7, 0x71, 0xBC, 0x99, 0xEE, 0xAB, 0xD9, 0x4C, 0x98, 0x6E, 0x26, 0xA6, 0x95,
+0x2E, 0x84, 0xC2, 0x1D, 0x5D, 0x5F, 0x77, 0x2F, 0x92, 0x15, 0xD9, 0x1E, 0x53, 0x56, 0x0A, 0x05, 0xF5, 0x1A, 0xB8, 0x61, 0xCE,
+0x90, 0xDE, 0x8B, 0x8A, 0x7C, 0x05, 0x94, 0xE7, 0xB3, 0x47, 0x9E, 0x57, 0x02, 0xA5, 0xDF, 0x67, 0xB2, 0x68, 0xF6, 0x0E, 0xC9,
+0x88, 0x47, 0xF0, 0x5C, 0x33, 0xC2, 0x6E, 0xB8, 0xFF, 0x6E, 0xB3, 0x89, 0x84, 0x16, 0x70, 0x95, 0x0A, 0x3D, 0x23, 0xEE, 0xC2,
+0x7D, 0xEF, 0xCA, 0xF2, 0x9F, 0xAF, 0xEF, 0xDE, 0xBD, 0xDC, 0x86, 0xF0, 0x0F, 0x25, 0x4F, 0x73, 0xED, 0x86, 0xEC, 0x65, 0x1D,
+0x6E, 0xB4, 0x5B, 0xCB, 0x83, 0x5A, 0x60, 0xD7, 0xE0, 0xB5, 0xE0, 0x62, 0x77, 0xC6, 0x4A, 0x17, 0x87, 0xA7, 0x6A, 0x97, 0x80,
+0x4B, 0xDF, 0x0C, 0xE4, 0xFF, 0x68, 0xC8, 0xB3, 0xEC, 0x12, 0xEB, 0xF9, 0x28, 0x4B, 0xA0, 0x26, 0x0C, 0xF5, 0xD2, 0x07, 0xAE,
+0xE6, 0xC2, 0xEB, 0x3F, 0xD7, 0x6E, 0x97, 0xE2, 0xD1, 0x51, 0x27, 0x2B, 0xBC, 0x1A, 0xB2, 0x1A, 0x07, 0x55, 0xB8, 0xDB, 0x6B,
+0x3B, 0x70, 0xEC, 0xF3, 0x97, 0xCB, 0x9B, 0x2E, 0xC1, 0xBD, 0x46, 0x37, 0x6A, 0xC2, 0xC6, 0x00, 0xC9, 0xB6, 0xA3, 0xF0, 0x6D,
+0x56, 0x05, 0x5E, 0x94, 0xB8, 0x4D, 0x7D, 0x57, 0x3D, 0xEA, 0xE1, 0x63, 0x6D, 0x7F, 0x01, 0x53, 0x77, 0xA4, 0x9C, 0x66, 0x07,
+0x00, 0x00
+};
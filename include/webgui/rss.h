@@ -1,18 +1,19 @@
+// Generated from web/rss.json (46ea4485494c5f61) - do not edit
 #include <Arduino.h>
 static const uint8_t rssjson[] = {
-0x1F, 0x8B, 0x08, 0x00, 0xD0, 0x6D, 0xF8, 0x69, 0x02, 0xFF, 0x95, 0xD2, 0x51, 0x4B, 0xC3, 0x30, 0x10, 0x00, 0xE0, 0xF7, 0xC1,
-0xFE, 0x43, 0xC8, 0x83, 0x4F, 0x23, 0x55, 0x04, 0x1F, 0x06, 0x22, 0x4E, 0x64, 0x6F, 0x7B, 0xD0, 0xBD, 0x88, 0xC8, 0x48, 0xDB,
-0xB3, 0x0D, 0x6D, 0x93, 0x92, 0x5C, 0x89, 0x55, 0xFC, 0xEF, 0x5E, 0xDA, 0x2A, 0xC2, 0xB2, 0xE9, 0xFA, 0xD6, 0xDE, 0xDD, 0x77,
-0x77, 0x49, 0x9F, 0xE7, 0x33, 0x46, 0xCF, 0x07, 0xD7, 0xB2, 0x01, 0xBE, 0xE4, 0xAB, 0xD5, 0x1D, 0xDB, 0x80, 0x77, 0x7C, 0xC1,
-0x3B, 0x5B, 0xD3, 0x87, 0x12, 0xB1, 0x75, 0xCB, 0x24, 0x79, 0x05, 0xC8, 0x9D, 0x48, 0xD3, 0x4C, 0x89, 0xCC, 0x88, 0xAE, 0x4A,
-0x34, 0x65, 0x25, 0xD6, 0x39, 0xF1, 0xD6, 0xD4, 0x37, 0x90, 0x2B, 0x54, 0x46, 0x5F, 0x77, 0x15, 0xFF, 0x5C, 0x44, 0xC8, 0x55,
-0xE7, 0x94, 0x06, 0xE7, 0x4E, 0xB1, 0xD3, 0xA9, 0xE6, 0xBB, 0x49, 0x5C, 0xDE, 0x42, 0x56, 0x6A, 0x53, 0x9B, 0xA2, 0x3F, 0xC5,
-0xC6, 0x9F, 0xAA, 0xE3, 0xFA, 0xBD, 0x46, 0xB0, 0x28, 0x95, 0x6E, 0x40, 0x23, 0x3B, 0x63, 0xB7, 0x16, 0xFF, 0xDB, 0x02, 0x7E,
-0x97, 0xEE, 0xA4, 0xCE, 0x77, 0x92, 0x8A, 0x8F, 0xB7, 0x7B, 0x6C, 0x8D, 0xC5, 0xBF, 0x7D, 0x17, 0xD2, 0x0E, 0x4B, 0xDB, 0x12,
-0xD8, 0xBA, 0x93, 0x36, 0x57, 0x52, 0xEF, 0x61, 0xDE, 0x7B, 0x81, 0x25, 0x14, 0x53, 0x9C, 0xC4, 0x26, 0x21, 0x92, 0xB0, 0x7D,
-0xE8, 0x49, 0x96, 0xC6, 0xC4, 0x8F, 0x35, 0xAC, 0x28, 0xFA, 0x10, 0x1F, 0x04, 0x2A, 0x4F, 0xD0, 0xB4, 0x0E, 0x8D, 0x55, 0x10,
-0x91, 0x1E, 0xA4, 0xAA, 0xE3, 0x50, 0x98, 0xC7, 0x52, 0x74, 0x00, 0xC7, 0xF5, 0x02, 0x16, 0x5E, 0xE3, 0x8C, 0x97, 0x3D, 0x5B,
-0xCB, 0x77, 0x40, 0x84, 0x83, 0x18, 0xE5, 0x14, 0x63, 0xCA, 0x30, 0xDD, 0xC5, 0xE5, 0xD5, 0xB9, 0x88, 0x6E, 0xB8, 0x01, 0xF4,
-0xC6, 0x56, 0x2C, 0xC0, 0x51, 0x4D, 0x8F, 0x09, 0x01, 0x6D, 0xE8, 0x27, 0x97, 0x19, 0x5D, 0xA6, 0x85, 0x69, 0xD0, 0x70, 0x31,
-0xE3, 0xC9, 0xCD, 0x67, 0x2F, 0x5F, 0xC9, 0x15, 0x52, 0x37, 0x4A, 0x03, 0x00, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0xD2, 0xC1, 0x4E, 0x84, 0x30, 0x10, 0x06, 0xE0, 0x57, 0x69,
+0x7A, 0xF0, 0xB4, 0x69, 0x35, 0x26, 0x1E, 0x36, 0x31, 0x46, 0x8C, 0xD9, 0xDB, 0x1E, 0x74, 0x2F, 0xC6, 0x98, 0x4D, 0x81, 0x91,
+0x36, 0x40, 0x4B, 0xDA, 0x21, 0x15, 0x8D, 0xEF, 0x6E, 0x0B, 0x68, 0x76, 0x11, 0xA2, 0x7B, 0x84, 0xCE, 0xFF, 0x31, 0x33, 0xE5,
+0xF9, 0x83, 0x6A, 0x51, 0x03, 0x5D, 0xD3, 0x24, 0xB9, 0x23, 0x5B, 0xF0, 0x8E, 0xAE, 0x68, 0x6B, 0xAB, 0xF0, 0x42, 0x22, 0x36,
+0x6E, 0xCD, 0xF9, 0x2B, 0x40, 0xEE, 0x58, 0x9A, 0x66, 0x8A, 0x65, 0x86, 0xB5, 0x25, 0xD7, 0xA1, 0x8A, 0x5B, 0xE7, 0xD8, 0x5B,
+0x5D, 0xDD, 0x40, 0xAE, 0x50, 0x19, 0x7D, 0xDD, 0x96, 0xF4, 0x73, 0x75, 0x84, 0x25, 0xAD, 0x53, 0x1A, 0x9C, 0x3B, 0x45, 0x4D,
+0xC7, 0xCC, 0x37, 0x3F, 0x35, 0x77, 0x90, 0x49, 0x6D, 0x2A, 0x53, 0x74, 0xA7, 0xA8, 0xF8, 0x93, 0x5A, 0x72, 0xEF, 0x35, 0x82,
+0x45, 0xA1, 0x74, 0x0D, 0x1A, 0xC9, 0x19, 0xB9, 0xB5, 0xF8, 0x5F, 0x1C, 0x0E, 0xA3, 0x7B, 0xA1, 0xF3, 0xBD, 0x08, 0xE1, 0xA5,
+0x0F, 0x3D, 0x36, 0xC6, 0xE2, 0xDF, 0xB2, 0x8B, 0x65, 0x73, 0xC6, 0x4E, 0x02, 0xD9, 0xB4, 0xC2, 0xE6, 0x4A, 0xE8, 0x5F, 0x8C,
+0xF7, 0x9E, 0xA1, 0x84, 0x62, 0x3C, 0x0F, 0x56, 0xCD, 0x03, 0x16, 0x98, 0x43, 0xE2, 0x49, 0x48, 0x63, 0xE6, 0xD7, 0x17, 0x07,
+0x62, 0x5D, 0x3C, 0xEF, 0xB3, 0x21, 0xC8, 0xD1, 0x34, 0x0E, 0x8D, 0x55, 0x70, 0x64, 0x3C, 0x08, 0x55, 0xCD, 0x13, 0xB1, 0x07,
+0x1B, 0x4E, 0x7B, 0x6A, 0x18, 0x26, 0x32, 0xF1, 0x71, 0x0A, 0x78, 0xD1, 0x91, 0x8D, 0x78, 0x07, 0x44, 0x58, 0x64, 0x42, 0x4D,
+0x31, 0x94, 0xF4, 0x1D, 0x5D, 0x5C, 0x5E, 0x9D, 0xB3, 0xC9, 0x3C, 0x5B, 0x40, 0x6F, 0x6C, 0x49, 0x22, 0x39, 0xEB, 0xE8, 0xA1,
+0x20, 0x72, 0x75, 0xF8, 0x5D, 0x45, 0x16, 0x2E, 0xCA, 0xC2, 0xD8, 0x5C, 0x5C, 0xFD, 0xB0, 0xA1, 0x97, 0x2F, 0xEF, 0xB0, 0x82,
+0x7E, 0x0C, 0x03, 0x00, 0x00
 };
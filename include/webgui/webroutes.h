@@ -0,0 +1,40 @@
+// Generated by scripts/generate_headers.py - do not edit
+#pragma once
+#include <Arduino.h>
+#include <webgui/editrss.h>
+#include <webgui/index.h>
+#include <webgui/keys.h>
+#include <webgui/liveview.h>
+#include <webgui/rss.h>
+#include <webgui/webgraphics.h>
+
+struct webRoute {
+    const char *path;
+    const uint8_t *data;
+    size_t length;
+    const char *contentType;
+    bool gzipped;
+    const char *etag;
+    const char *cacheControl;
+};
+
+#define WEBROUTECOUNT 16
+
+static const webRoute webRoutes[WEBROUTECOUNT] = {
+    {"/btlogo.webp", btlogo, sizeof(btlogo), "image/webp", false, "\"bd80e5b4a148fa71\"", "public,max-age=86400"},
+    {"/editrss.htm", editrsshtm, sizeof(editrsshtm), "text/html", true, "\"9cfe8eee81e91fd9\"", "no-cache"},
+    {"/favicon.png", faviconpng, sizeof(faviconpng), "image/png", false, "\"36006d3b8236f602\"", "public,max-age=86400"},
+    {"/ibus.webp", ibus, sizeof(ibus), "image/webp", false, "\"24cfd26fcd257967\"", "public,max-age=86400"},
+    {"/index.htm", indexhtm, sizeof(indexhtm), "text/html", true, "\"6f44359d85451c0f\"", "no-cache"},
+    {"/irail.webp", irail, sizeof(irail), "image/webp", false, "\"bbcbcb519743005f\"", "public,max-age=86400"},
+    {"/itube.webp", itube, sizeof(itube), "image/webp", false, "\"1215bb3cc5667397\"", "public,max-age=86400"},
+    {"/keys.htm", keyshtm, sizeof(keyshtm), "text/html", true, "\"c6c61843641f55bc\"", "no-cache"},
+    {"/liveview.84209d4c.js", liveviewjs, sizeof(liveviewjs), "application/javascript", true, "\"cc84de7b2e82d12b\"", "public,max-age=31536000,immutable"},
+    {"/liveview.js", liveviewjs, sizeof(liveviewjs), "application/javascript", true, "\"cc84de7b2e82d12b\"", "no-cache"},
+    {"/nr.webp", nricon, sizeof(nricon), "image/webp", false, "\"8311c8e28b2fd83e\"", "public,max-age=86400"},
+    {"/nrelogo.webp", nrelogo, sizeof(nrelogo), "image/webp", false, "\"15d88c22a00c289f\"", "public,max-age=86400"},
+    {"/rdglogo.webp", rdglogo, sizeof(rdglogo), "image/webp", false, "\"30ca9f36cfe6407c\"", "public,max-age=86400"},
+    {"/rss.json", rssjson, sizeof(rssjson), "application/json", true, "\"01021de5ea481343\"", "no-cache"},
+    {"/tfllogo.webp", tfllogo, sizeof(tfllogo), "image/webp", false, "\"cc8363f7b140c9b7\"", "public,max-age=86400"},
+    {"/tube.webp", tubeicon, sizeof(tubeicon), "image/webp", false, "\"19087078b14dd9e9\"", "public,max-age=86400"},
+};
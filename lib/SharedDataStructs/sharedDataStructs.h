@@ -1,16 +1,26 @@
 // Common station data structures shared by both data clients
 #pragma once
 #include <Arduino.h>
+#include <stringArena.h>
+#include <serviceTime.h>
 
 #define MAXBOARDMESSAGES 4
 #define MAXMESSAGESIZE 400
-#define MAXCALLINGSIZE 450
 #define MAXBOARDSERVICES 9
 #define MAXLOCATIONSIZE 85
 #define MAXBUSTUBELOCATIONSIZE 50
 #define MAXFILTERSIZE 25
 #define MAXLINESIZE 20
+#define MAXOPCOSIZE 50
 #define MAXTUBEBUSREADSERVICES 20
+#define MAXCALLINGPOINTS 160      // Calling points for all services in a rail data download
+#define MAXBOARDCALLINGPOINTS 64  // Calling points kept for the first service on the board
+#define CALLINGINDEXSIZE 256      // Name hash index for the download's calling points (power of two, above MAXCALLINGPOINTS)
+#define MAXCALLINGLINESIZE 1600   // Formatted "Calling at" line including the last seen report
+
+#define MAXFETCHTEXTSIZE 4096     // Text arena for a rail data download (all services)
+#define MAXBOARDTEXTSIZE 2048     // Text arena for the displayed board
+#define MAXBUSTUBETEXTSIZE 1792   // Text arena for a tube/bus data download
 
 #define MAXKEYNAMESIZE 50
 #define MAXRESULTMESSAGESIZE 80
@@ -27,51 +37,90 @@ struct stnMessages {
     char messages[MAXBOARDMESSAGES][MAXMESSAGESIZE];
 };
 
+// Change flags for each service on a newly fetched board (see boardDiff)
+#define SVC_NEW       0x01    // Not on the previous board
+#define SVC_MOVED     0x02    // Was on the previous board in a different row
+#define SVC_TIME      0x04    // Scheduled/expected time, status or time to station
+#define SVC_DEST      0x08    // Destination or via
+#define SVC_PLATFORM  0x10
+#define SVC_STATUS    0x20    // Cancelled or delayed
+#define SVC_DETAIL    0x40    // Operator, coaches, classes or service type
+
+// What changed between the displayed board and the one replacing it
+struct boardDiff {
+    bool headerChanged;     // Location or platform availability
+    bool callingChanged;    // Calling points of the first service
+    bool detailsChanged;    // Origin or service message of the first service
+    bool messagesChanged;
+    uint8_t removed;        // Services no longer on the board
+    uint8_t service[MAXBOARDSERVICES];  // SVC_ flags for each row of the new board
+    int8_t fromRow[MAXBOARDSERVICES];   // Row the service was on in the previous board (-1 if new)
+};
+
+// A stop after this station. Names are shared between services that call at the same place.
+struct callingPoint {
+    strRef name;
+    uint16_t scheduled;   // Minutes since midnight or NOTIME
+    uint16_t expected;    // NOTIME if there's no estimate (or it's cancelled)
+};
+
 struct rdService {
-    char sTime[6];
-    char destination[MAXLOCATIONSIZE];
-    char via[MAXLOCATIONSIZE];  // also used for line name for TfL
-    char etd[11];
+    uint16_t sTime;     // Minutes since midnight
+    strRef destination;
+    strRef via;  // also used for line name for TfL
+    char etd[11];       // Status text when there's no estimated time
+    uint16_t etdTime;   // Estimated time or NOTIME
     char platform[4];
     bool isCancelled;
     bool isDelayed;
     int trainLength;
     byte classesAvailable;
-    char opco[50];
+    strRef opco;
 
     int serviceType;
     int timeToStation;  // Only for TfL
+    uint32_t serviceId;     // Stable identity across fetches (0 if not known)
+    uint32_t fingerprint;   // Hash of everything displayed for the service
   };
 
   struct rdStation {
     char location[MAXLOCATIONSIZE];
     bool platformAvailable;
     int numServices;
-    bool boardChanged;  // Only for TfL
-    char calling[MAXCALLINGSIZE];   // Only store the calling stops for the first service returned
-    char origin[MAXLOCATIONSIZE]; // Only store the origin for the first service returned
-    char serviceMessage[MAXMESSAGESIZE];  // Only store the service message for the first service returned
+    bool boardChanged;  // Only for TfL/bus, primary services need scrolling in
+    boardDiff changes;  // Set by the data client when the board is fetched
+    uint32_t fingerprint;   // Hash of the whole board including messages
+    uint8_t numCalling;   // Only store the calling stops for the first service returned
+    bool callingTruncated;  // There were more stops than could be kept
+    callingPoint calling[MAXBOARDCALLINGPOINTS];
+    strRef lastSeen;  // Last reported location of the first service
+    strRef origin; // Only store the origin for the first service returned
+    strRef serviceMessage;  // Only store the service message for the first service returned
     rdService service[MAXBOARDSERVICES];
+    stringArena<MAXBOARDTEXTSIZE> text;   // Holds all the strRef strings above
   };
 
   // Rail structure for data downloads
   struct rdiService {
-    char sTime[6];
-    char destination[MAXLOCATIONSIZE];
-    char via[MAXLOCATIONSIZE];
-    char origin[MAXLOCATIONSIZE];
+    uint16_t sTime;
+    strRef destination;
+    strRef via;
+    strRef origin;
     char etd[11];
+    uint16_t etdTime;
     char platform[4];
     bool isCancelled;
     bool isDelayed;
     int trainLength;
     byte classesAvailable;
-    char opco[50];
-    char calling[MAXCALLINGSIZE];
-    char serviceMessage[MAXMESSAGESIZE];
+    strRef opco;
+    uint8_t firstCalling;   // Range of this service's stops in rdiStation::callingPoints
+    uint8_t numCalling;
+    bool callingTruncated;  // Stops were dropped for lack of room
+    strRef serviceMessage;
     int serviceType;
     char serviceID[18];
-    char sortTime[6];
+    uint16_t sortTime;  // Minutes into the service day
   };
 
   struct rdiStation {
@@ -79,21 +128,28 @@ struct rdService {
     bool platformAvailable;
     int numServices;
     rdiService service[MAXBOARDSERVICES];
+    uint8_t numCallingPoints;
+    uint8_t callingIndex[CALLINGINDEXSIZE];   // Calling point (plus one) for each name hash, 0 if the slot is empty
+    callingPoint callingPoints[MAXCALLINGPOINTS];   // Stops for all services, each service's are consecutive
+    strRef lastSeen;    // Last reported location of the first service
+    stringArena<MAXFETCHTEXTSIZE> text;   // Reset at the start of each fetch
   };
 
   // Common structure for tube/bus data downloads
     struct busTubeService {
-      char destinationName[MAXBUSTUBELOCATIONSIZE];
-      char currentLocation[MAXBUSTUBELOCATIONSIZE];
-      char lineName[MAXLINESIZE];
+      strRef destinationName;
+      strRef currentLocation;
+      strRef lineName;
       int timeToStation;
-      char scheduled[6];
-      char expected[6];
+      uint16_t scheduled;
+      uint16_t expected;
+      uint32_t serviceId;   // Hash of the TfL vehicle/prediction id
   };
 
   struct busTubeStation {
       int numServices;
       busTubeService service[MAXTUBEBUSREADSERVICES];
+      stringArena<MAXBUSTUBETEXTSIZE> text;   // Reset at the start of each fetch
   };
 
   // Common data buffers for parsing JSON
@@ -12,8 +12,9 @@
 #include <TfLdataClient.h>
 #include <JsonListenerGS.h>
 #include <WiFiClientSecure.h>
+#include <fetchMetrics.h>
 
-TfLdataClient::TfLdataClient(busTubeStation *station, stnMessages *messages,  sharedBufferSpace *sharedBuffer) : xStation(station), xMessages(messages), js(sharedBuffer) {}
+TfLdataClient::TfLdataClient(busTubeStation *station, rdStation *board, stnMessages *messages,  sharedBufferSpace *sharedBuffer) : xStation(station), xBoard(board), xMessages(messages), js(sharedBuffer) {}
 
 int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, const char *locationId, const char *lineId, const char *lineDirection, bool noMessages, const char *apiKey) {
 
@@ -21,6 +22,7 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
     long dataReceived = 0;
     bool bChunked = false;
     js->lastResultMessage[0] = '\0';
+    fetchTrace trace(UPSTREAM_TFL);
 
     JsonStreamingParserGS parser;
     parser.setListener(this);
@@ -29,8 +31,6 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
     httpsClient.setTimeout(8000);
     httpsClient.setConnectionTimeout(8000);
 
-    boardChanged = false;
-
     int retryCounter=0;
     while (!httpsClient.connect(apiHost,443) && (retryCounter++ < 15)){
         delay(200);
@@ -39,6 +39,7 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
         strcpy(js->lastResultMessage,"Error: Connect timed out");
         return UPD_NO_RESPONSE;
     }
+    trace.mark(PHASE_CONNECT);
     String request;
     if (strcmp(lineId,"all")) {
         request="GET /Line/" + String(lineId) + "/Arrivals/" + String(locationId);
@@ -59,6 +60,7 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
         strcpy(js->lastResultMessage,"Error: GET timed out");
         return UPD_TIMEOUT;
     }
+    trace.mark(PHASE_WAIT);
 
     // Parse status code
     String statusLine = httpsClient.readStringUntil('\n');
@@ -89,7 +91,8 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
     xStation->numServices = 0;
     xMessages->numMessages = 0;
     for (int i=0;i<MAXBOARDMESSAGES;i++) strcpy(xMessages->messages[i],"");
-    for (int i=0;i<MAXTUBEBUSREADSERVICES;i++) strcpy(xStation->service[i].destinationName,"Check front of Train");
+    xStation->text.reset();
+    noDestination = xStation->text.add(tflNoDestination);
 
     unsigned long dataSendTimeout = millis() + 10000UL;
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout) && (!maxServicesRead)) {
@@ -102,6 +105,8 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
         delay(5);
     }
     httpsClient.stop();
+    trace.setBytes(dataReceived);
+    trace.mark(PHASE_BODY);
     if (millis() >= dataSendTimeout) {
         sprintf(js->lastResultMessage,"Error: Timeout after %d bytes",dataReceived);
         return UPD_TIMEOUT;
@@ -117,6 +122,7 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
             strcpy(js->lastResultMessage,"Error: Connect timed out [Msgs]");
             return UPD_NO_RESPONSE;
         }
+        trace.mark(PHASE_CONNECT);
         request = "GET /StopPoint/" + String(locationId) + "/Disruption?getFamily=true&flattenResponse=true&app_key=" + String(apiKey) + " HTTP/1.0\r\nHost: " + String(apiHost) + "\r\nConnection: close\r\n\r\n";
         httpsClient.print(request);
         retryCounter=0;
@@ -130,6 +136,7 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
             strcpy(js->lastResultMessage,"Error: GET timed out [Msgs]");
             return UPD_TIMEOUT;
         }
+        trace.mark(PHASE_WAIT);
 
         // Parse status code
         statusLine = httpsClient.readStringUntil('\n');
@@ -169,6 +176,8 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
             delay(5);
         }
         httpsClient.stop();
+        trace.setBytes(dataReceived);
+        trace.mark(PHASE_BODY);
         if (millis() >= dataSendTimeout) {
             sprintf(js->lastResultMessage,"Error: Timeout after %d bytes [Msgs]",dataReceived);
             return UPD_TIMEOUT;
@@ -177,7 +186,10 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
 
     // Sort the services by arrival time
     size_t arraySize = xStation->numServices;
-    std::sort(xStation->service, xStation->service+arraySize,compareTimes);
+    {
+        TRACE_SPAN("sort","tfl");
+        std::sort(xStation->service, xStation->service+arraySize,compareTimes);
+    }
 
     // Limit results to the nearest MAXBOARDSERVICES services
     if (xStation->numServices > MAXBOARDSERVICES) xStation->numServices = MAXBOARDSERVICES;
@@ -187,17 +199,12 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
 
     // Clean up the destinations
     for (int i=0;i<xStation->numServices;++i) {
-        pruneFromPhrase(xStation->service[i].destinationName," Underground Station");
-        pruneFromPhrase(xStation->service[i].destinationName," DLR Station");
-        pruneFromPhrase(xStation->service[i].destinationName," (H&C Line)");
-        pruneFromPhrase(xStation->service[i].currentLocation," Platform ");
-    }
-
-    // Check if any of the services have changed
-    if (xStation->numServices != station->numServices) boardChanged=true;
-    else if (xStation->numServices && strcmp(xStation->service[0].destinationName,station->service[0].destination)) boardChanged = true;
-    if (!noMessages) {
-        if (messages->numMessages != xMessages->numMessages) boardChanged = true;
+        pruneFromPhrase(xStation->text.edit(xStation->service[i].destinationName)," Underground Station");
+        pruneFromPhrase(xStation->text.edit(xStation->service[i].destinationName)," DLR Station");
+        pruneFromPhrase(xStation->text.edit(xStation->service[i].destinationName)," (H&C Line)");
+        pruneFromPhrase(xStation->text.edit(xStation->service[i].currentLocation)," Platform ");
+        xStation->text.refresh(xStation->service[i].destinationName);
+        xStation->text.refresh(xStation->service[i].currentLocation);
     }
 
     // Remove line break and excess spaces from messages
@@ -207,26 +214,49 @@ int TfLdataClient::fetchArrivals(rdStation *station, stnMessages *messages, cons
         if (i<xMessages->numMessages-1) fixFullStop(xMessages->messages[i]);
     }
 
+    // Check if any of the services have changed. A new first service or number of services scrolls the board in,
+    // anything else is redrawn in place.
+    buildBoard();
+    diffBoards(station,messages,xBoard,xMessages);
+    xBoard->boardChanged = servicesReplaced(station,xBoard);
+    int result = boardUpdateResult(&xBoard->changes);
+    if (xBoard->boardChanged || xBoard->changes.messagesChanged) result = UPD_SUCCESS;
+    else if (result == UPD_SUCCESS) result = UPD_SEC_CHANGE;
+
+    trace.mark(PHASE_PROCESS);
     UBaseType_t uxHighWaterMark = uxTaskGetStackHighWaterMark(NULL);
-    if (boardChanged) {
-        sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"OK: UP D:%d T:%d S:%d %s",dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
-        return UPD_SUCCESS;
-    } else {
-        sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"OK: NC D:%d T:%d S:%d %s",dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
-        return UPD_NO_CHANGE;
+    const char *changeType = (result == UPD_NO_CHANGE) ? "NC" : (result == UPD_SEC_CHANGE) ? "SC" : "UP";
+    sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"OK: %s D:%d T:%d S:%d %s",changeType,dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
+    return result;
+}
+
+// Build the next board from the fetched arrivals
+void TfLdataClient::buildBoard() {
+    TRACE_SPAN("build","tfl");
+    xBoard->location[0] = '\0';
+    xBoard->platformAvailable = false;
+    xBoard->numServices = xStation->numServices;
+    xBoard->text.reset();
+    for (int i=0;i<xStation->numServices;i++) {
+        xBoard->service[i] = {};
+        xBoard->service[i].sTime = NOTIME;
+        xBoard->service[i].etdTime = NOTIME;
+        xBoard->service[i].destination = xBoard->text.add(xStation->text.get(xStation->service[i].destinationName));
+        xBoard->service[i].via = xBoard->text.add(xStation->text.get(xStation->service[i].lineName));
+        xBoard->service[i].timeToStation = xStation->service[i].timeToStation;
+        xBoard->service[i].serviceId = xStation->service[i].serviceId;
     }
+    xBoard->origin = xStation->numServices ? xBoard->text.add(xStation->text.get(xStation->service[0].currentLocation)) : strRef{};
+    xBoard->numCalling = 0;
+    xBoard->callingTruncated = false;
+    xBoard->lastSeen = {};
+    xBoard->serviceMessage = {};
+    fingerprintBoard(xBoard,xMessages);
 }
 
 void TfLdataClient::loadArrivals(rdStation *station, stnMessages *messages) {
     // Update the callers data with the new data
-    station->boardChanged = boardChanged;
-    station->numServices = xStation->numServices;
-    for (int i=0;i<xStation->numServices;i++) {
-        strcpy(station->service[i].destination,xStation->service[i].destinationName);
-        strcpy(station->service[i].via,xStation->service[i].lineName);
-        station->service[i].timeToStation = xStation->service[i].timeToStation;
-    }
-    strcpy(station->origin,xStation->service[0].currentLocation);
+    *station = *xBoard;
     messages->numMessages = xMessages->numMessages;
     for (int i=0;i<xMessages->numMessages;i++) strcpy(messages->messages[i],xMessages->messages[i]);
 }
@@ -324,6 +354,10 @@ void TfLdataClient::key(const char *key) {
         if (xStation->numServices<MAXTUBEBUSREADSERVICES) {
             xStation->numServices++;
             id = xStation->numServices-1;
+            xStation->service[id].destinationName = noDestination;
+            xStation->service[id].currentLocation = {};
+            xStation->service[id].lineName = {};
+            xStation->service[id].serviceId = 0;
         } else {
             // We've read all we need to
             maxServicesRead = true;
@@ -342,11 +376,18 @@ void TfLdataClient::key(const char *key) {
 
 void TfLdataClient::value(const char *value) {
     if (fetchingArrivals) {
-        if (strcmp(js->currentKey, "destinationName")==0) strlcpy(xStation->service[id].destinationName,value,MAXBUSTUBELOCATIONSIZE);
-        else if (strcmp(js->currentKey, "currentLocation")==0) strlcpy(xStation->service[id].currentLocation,value,MAXBUSTUBELOCATIONSIZE);
+        if ((strcmp(js->currentKey, "id")==0 || strcmp(js->currentKey, "vehicleId")==0) && value[0]) {
+            // Prediction id, replaced by the vehicle id if there is one
+            xStation->service[id].serviceId = hashText(FNV_OFFSET,value);
+        } else if (strcmp(js->currentKey, "destinationName")==0) {
+            // Keep the default text if the arena is full
+            strRef destination = xStation->text.add(value,MAXBUSTUBELOCATIONSIZE);
+            if (destination.length) xStation->service[id].destinationName = destination;
+        }
+        else if (strcmp(js->currentKey, "currentLocation")==0) xStation->service[id].currentLocation = xStation->text.add(value,MAXBUSTUBELOCATIONSIZE);
         else if (strcmp(js->currentKey, "timeToStation")==0) xStation->service[id].timeToStation = atoi(value);
         else if (strcmp(js->currentKey, "lineName")==0) {
-            strlcpy(xStation->service[id].lineName,value,MAXLINESIZE);
+            xStation->service[id].lineName = xStation->text.add(value,MAXLINESIZE);
         }
     } else {
         // Fetching messages
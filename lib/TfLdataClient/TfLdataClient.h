@@ -13,6 +13,7 @@
 #include <JsonStreamingParserGS.h>
 #include <sharedDataStructs.h>
 #include <responseCodes.h>
+#include <boardDiff.h>
 
 class TfLdataClient: public JsonListenerGS {
 
@@ -20,13 +21,15 @@ class TfLdataClient: public JsonListenerGS {
 
         const char* apiHost = "api.tfl.gov.uk";
         const char* tflAttribution = "Powered by TfL Open Data";
+        const char* tflNoDestination = "Check front of Train";
 
         int id=0;
         bool maxServicesRead = false;
-        bool boardChanged = false;
         bool fetchingArrivals = false;
+        strRef noDestination = {};   // Shared default destination text in the arena
 
         busTubeStation *xStation = nullptr;
+        rdStation *xBoard = nullptr;   // The next board to display, built at the end of each fetch
         stnMessages *xMessages = nullptr;
         sharedBufferSpace* js = nullptr;
 
@@ -35,10 +38,11 @@ class TfLdataClient: public JsonListenerGS {
         void removeExcessSpaces(char *input);
         void fixFullStop(char *input);
         static bool compareTimes(const busTubeService& a, const busTubeService& b);
+        void buildBoard();
 
     public:
 
-        TfLdataClient(busTubeStation *station, stnMessages *messages, sharedBufferSpace *sharedBuffer);
+        TfLdataClient(busTubeStation *station, rdStation *board, stnMessages *messages, sharedBufferSpace *sharedBuffer);
         int fetchArrivals(rdStation *station, stnMessages *messages, const char *locationId, const char *lineId, const char *lineDirection, bool noMessages, const char *apiKey);
         void loadArrivals(rdStation *station, stnMessages *messages);
 
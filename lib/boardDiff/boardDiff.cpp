@@ -0,0 +1,179 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * boardDiff Library - works out what changed between two departure boards
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <boardDiff.h>
+#include <spanTrace.h>
+
+uint32_t hashBytes(uint32_t hash, const void *data, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i=0;i<length;i++) {
+        hash ^= bytes[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+uint32_t hashText(uint32_t hash, const char *text) {
+    return hashBytes(hash,text,strlen(text)+1);
+}
+
+static uint32_t fingerprintService(const rdStation *board, const rdService *service) {
+    uint32_t hash = FNV_OFFSET;
+    hash = hashBytes(hash,&service->serviceId,sizeof(service->serviceId));
+    hash = hashBytes(hash,&service->sTime,sizeof(service->sTime));
+    hash = hashBytes(hash,&service->etdTime,sizeof(service->etdTime));
+    hash = hashText(hash,service->etd);
+    hash = hashText(hash,board->text.get(service->destination));
+    hash = hashText(hash,board->text.get(service->via));
+    hash = hashText(hash,service->platform);
+    hash = hashBytes(hash,&service->isCancelled,sizeof(service->isCancelled));
+    hash = hashBytes(hash,&service->isDelayed,sizeof(service->isDelayed));
+    hash = hashBytes(hash,&service->trainLength,sizeof(service->trainLength));
+    hash = hashBytes(hash,&service->classesAvailable,sizeof(service->classesAvailable));
+    hash = hashText(hash,board->text.get(service->opco));
+    hash = hashBytes(hash,&service->serviceType,sizeof(service->serviceType));
+    hash = hashBytes(hash,&service->timeToStation,sizeof(service->timeToStation));
+    return hash;
+}
+
+// Only what's shown on the calling line is included, so a change to an estimate alone doesn't repaint it
+static uint32_t hashCallingPoints(uint32_t hash, const rdStation *board) {
+    hash = hashBytes(hash,&board->numCalling,sizeof(board->numCalling));
+    hash = hashBytes(hash,&board->callingTruncated,sizeof(board->callingTruncated));
+    for (int i=0;i<board->numCalling;i++) {
+        hash = hashText(hash,board->text.get(board->calling[i].name));
+        hash = hashBytes(hash,&board->calling[i].scheduled,sizeof(uint16_t));
+    }
+    return hashText(hash,board->text.get(board->lastSeen));
+}
+
+static bool sameCallingPoints(const rdStation *oldBoard, const rdStation *newBoard) {
+    if (oldBoard->numCalling != newBoard->numCalling || oldBoard->callingTruncated != newBoard->callingTruncated) return false;
+    for (int i=0;i<newBoard->numCalling;i++) {
+        if (oldBoard->calling[i].scheduled != newBoard->calling[i].scheduled) return false;
+        if (strcmp(oldBoard->text.get(oldBoard->calling[i].name),newBoard->text.get(newBoard->calling[i].name))) return false;
+    }
+    return strcmp(oldBoard->text.get(oldBoard->lastSeen),newBoard->text.get(newBoard->lastSeen)) == 0;
+}
+
+void fingerprintBoard(rdStation *board, const stnMessages *messages) {
+    uint32_t hash = FNV_OFFSET;
+    hash = hashText(hash,board->location);
+    hash = hashBytes(hash,&board->platformAvailable,sizeof(board->platformAvailable));
+    hash = hashBytes(hash,&board->numServices,sizeof(board->numServices));
+    hash = hashCallingPoints(hash,board);
+    hash = hashText(hash,board->text.get(board->origin));
+    hash = hashText(hash,board->text.get(board->serviceMessage));
+    for (int i=0;i<board->numServices && i<MAXBOARDSERVICES;i++) {
+        board->service[i].fingerprint = fingerprintService(board,&board->service[i]);
+        hash = hashBytes(hash,&board->service[i].fingerprint,sizeof(uint32_t));
+    }
+    if (messages) {
+        hash = hashBytes(hash,&messages->numMessages,sizeof(messages->numMessages));
+        for (int i=0;i<messages->numMessages;i++) hash = hashText(hash,messages->messages[i]);
+    }
+    board->fingerprint = hash;
+}
+
+// Services are matched on their identity if both boards have one, otherwise on scheduled time and destination
+static bool sameService(const rdStation *oldBoard, const rdService *oldService, const rdStation *newBoard, const rdService *newService) {
+    if (oldService->serviceId && newService->serviceId) return oldService->serviceId == newService->serviceId;
+    if (oldService->sTime != newService->sTime) return false;
+    return strcmp(oldBoard->text.get(oldService->destination),newBoard->text.get(newService->destination)) == 0;
+}
+
+static uint8_t compareService(const rdStation *oldBoard, const rdService *oldService, const rdStation *newBoard, const rdService *newService) {
+    uint8_t flags = 0;
+    if (oldService->fingerprint == newService->fingerprint) return 0;
+
+    if (oldService->sTime != newService->sTime || oldService->etdTime != newService->etdTime || strcmp(oldService->etd,newService->etd) || oldService->timeToStation != newService->timeToStation) flags |= SVC_TIME;
+    if (strcmp(oldBoard->text.get(oldService->destination),newBoard->text.get(newService->destination)) || strcmp(oldBoard->text.get(oldService->via),newBoard->text.get(newService->via))) flags |= SVC_DEST;
+    if (strcmp(oldService->platform,newService->platform)) flags |= SVC_PLATFORM;
+    if (oldService->isCancelled != newService->isCancelled || oldService->isDelayed != newService->isDelayed) flags |= SVC_STATUS;
+    if (oldService->trainLength != newService->trainLength || oldService->classesAvailable != newService->classesAvailable || oldService->serviceType != newService->serviceType || strcmp(oldBoard->text.get(oldService->opco),newBoard->text.get(newService->opco))) flags |= SVC_DETAIL;
+
+    return flags;
+}
+
+void diffBoards(const rdStation *oldBoard, const stnMessages *oldMessages, rdStation *newBoard, const stnMessages *newMessages) {
+    TRACE_SPAN("diff","board");
+    boardDiff *changes = &newBoard->changes;
+    memset(changes,0,sizeof(boardDiff));
+    for (int i=0;i<MAXBOARDSERVICES;i++) changes->fromRow[i] = i;
+
+    // An identical fingerprint means nothing on the board has changed
+    if (oldBoard->fingerprint == newBoard->fingerprint && oldBoard->numServices == newBoard->numServices) return;
+
+    changes->headerChanged = (strcmp(oldBoard->location,newBoard->location) || oldBoard->platformAvailable != newBoard->platformAvailable);
+    changes->callingChanged = !sameCallingPoints(oldBoard,newBoard);
+    changes->detailsChanged = (strcmp(oldBoard->text.get(oldBoard->origin),newBoard->text.get(newBoard->origin)) || strcmp(oldBoard->text.get(oldBoard->serviceMessage),newBoard->text.get(newBoard->serviceMessage)));
+
+    if (!oldMessages || !newMessages) {
+        // Board type without messages
+    } else if (oldMessages->numMessages != newMessages->numMessages) {
+        changes->messagesChanged = true;
+    } else {
+        for (int i=0;i<newMessages->numMessages;i++) {
+            if (strcmp(oldMessages->messages[i],newMessages->messages[i])) {
+                changes->messagesChanged = true;
+                break;
+            }
+        }
+    }
+
+    // Match each new row to a service on the old board, preferring the same row
+    bool matched[MAXBOARDSERVICES] = {};
+    int oldServices = min(oldBoard->numServices,MAXBOARDSERVICES);
+    for (int i=0;i<newBoard->numServices && i<MAXBOARDSERVICES;i++) {
+        const rdService *newService = &newBoard->service[i];
+        int match = -1;
+        if (i<oldServices && !matched[i] && sameService(oldBoard,&oldBoard->service[i],newBoard,newService)) {
+            match = i;
+        } else {
+            for (int j=0;j<oldServices;j++) {
+                if (!matched[j] && sameService(oldBoard,&oldBoard->service[j],newBoard,newService)) {
+                    match = j;
+                    break;
+                }
+            }
+        }
+        changes->fromRow[i] = match;
+        if (match<0) {
+            changes->service[i] = SVC_NEW;
+        } else {
+            matched[match] = true;
+            changes->service[i] = compareService(oldBoard,&oldBoard->service[match],newBoard,newService);
+            if (match != i) changes->service[i] |= SVC_MOVED;
+        }
+    }
+    for (int j=0;j<oldServices;j++) {
+        if (!matched[j]) changes->removed++;
+    }
+}
+
+bool primaryServiceChanged(const boardDiff *changes) {
+    return (changes->service[0] & (SVC_NEW|SVC_MOVED|SVC_DEST|SVC_STATUS|SVC_DETAIL)) != 0;
+}
+
+int boardUpdateResult(const boardDiff *changes) {
+    if (changes->headerChanged || changes->removed || changes->messagesChanged || changes->detailsChanged || primaryServiceChanged(changes)) return UPD_SUCCESS;
+
+    bool rowChanged = changes->callingChanged;
+    for (int i=0;i<MAXBOARDSERVICES && !rowChanged;i++) {
+        if (changes->service[i]) rowChanged = true;
+    }
+    return rowChanged ? UPD_SEC_CHANGE : UPD_NO_CHANGE;
+}
+
+bool servicesReplaced(const rdStation *oldBoard, const rdStation *newBoard) {
+    if (oldBoard->numServices != newBoard->numServices) return true;
+    return (newBoard->numServices && (newBoard->changes.service[0] & (SVC_NEW|SVC_MOVED|SVC_DEST)));
+}
@@ -0,0 +1,38 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * boardDiff Library - works out what changed between two departure boards
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <sharedDataStructs.h>
+#include <responseCodes.h>
+
+#define FNV_OFFSET 2166136261UL     // FNV-1a starting hash
+
+// FNV-1a hash, chained by passing the previous hash back in
+uint32_t hashBytes(uint32_t hash, const void *data, size_t length);
+
+// Hash a string including its terminator, so "ab"+"c" and "a"+"bc" differ
+uint32_t hashText(uint32_t hash, const char *text);
+
+// Set the fingerprint of each service and of the whole board. Call once the board has been built.
+void fingerprintBoard(rdStation *board, const stnMessages *messages);
+
+// Compare the displayed board with a newly fetched one and fill in newBoard->changes. Messages may be nullptr for boards without them.
+void diffBoards(const rdStation *oldBoard, const stnMessages *oldMessages, rdStation *newBoard, const stnMessages *newMessages);
+
+// True if the first service has changed in a way that affects more than its own row (messages, scroll in etc.)
+bool primaryServiceChanged(const boardDiff *changes);
+
+// Summarise a change set as UPD_NO_CHANGE, UPD_SEC_CHANGE (changed rows can be redrawn in place) or UPD_SUCCESS (full redraw)
+int boardUpdateResult(const boardDiff *changes);
+
+// True if the number of services or the first service has changed (TfL and bus boards scroll the services in)
+bool servicesReplaced(const rdStation *oldBoard, const rdStation *newBoard);
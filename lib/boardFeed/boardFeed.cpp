@@ -0,0 +1,259 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * boardFeed Library - compact JSON snapshots and changes of the displayed board for subscribers
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <boardFeed.h>
+#include <serviceTime.h>
+
+#define ALLFIELDS (SVC_TIME | SVC_DEST | SVC_PLATFORM | SVC_STATUS | SVC_DETAIL)
+
+// Writes into a fixed buffer, or just counts when there isn't one
+class feedWriter : public Print {
+
+    private:
+        char *buffer;
+        size_t used = 0;
+
+    public:
+        feedWriter(char *target) : buffer(target) {}
+
+        size_t write(uint8_t c) override {
+            if (buffer) buffer[used] = c;
+            used++;
+            return 1;
+        }
+
+        size_t write(const uint8_t *data, size_t size) override {
+            if (buffer) memcpy(buffer+used,data,size);
+            used += size;
+            return size;
+        }
+
+        size_t written() const {
+            return used;
+        }
+};
+
+// Display glyphs in 0x80-0x9F that can appear in board text (the rest of the range isn't used there)
+static uint16_t glyphCodePoint(uint8_t c) {
+    switch (c) {
+        case 0x80: return 0x00A9;   // Copyright
+        case 0x81: return 0x2026;   // Ellipsis
+        case 0x90: return 0x2022;   // RSS headline separator
+        default: return 0xFFFD;
+    }
+}
+
+// Length of the UTF-8 sequence starting at p, or 0 if it isn't one
+static int utf8Length(const uint8_t *p) {
+    int length;
+    if (p[0] >= 0xC2 && p[0] <= 0xDF) length = 2;
+    else if (p[0] >= 0xE0 && p[0] <= 0xEF) length = 3;
+    else if (p[0] >= 0xF0 && p[0] <= 0xF4) length = 4;
+    else return 0;
+    for (int i=1;i<length;i++) {
+        if ((p[i] & 0xC0) != 0x80) return 0;
+    }
+    return length;
+}
+
+void writeJsonText(Print &out, const char *text) {
+    out.write('"');
+    const char *run = text;
+    const char *p = text;
+    while (*p) {
+        uint8_t c = *p;
+        if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\') {
+            p++;
+            continue;
+        }
+        int sequence = (c >= 0x80) ? utf8Length((const uint8_t *)p) : 0;
+        if (sequence) {
+            // Already UTF-8, so it can go as it is
+            p += sequence;
+            continue;
+        }
+        out.write((const uint8_t *)run,p-run);
+        run = ++p;
+        if (c == '"' || c == '\\') {
+            out.write('\\');
+            out.write(c);
+        } else if (c == '\n') {
+            out.print("\\n");
+        } else {
+            // Other bytes from 0x80 up are in the display fonts' encoding, which is Latin-1 from 0xA0
+            out.printf("\\u%04x",(c >= 0x80 && c < 0xA0) ? glyphCodePoint(c) : c);
+        }
+    }
+    out.write((const uint8_t *)run,p-run);
+    out.write('"');
+}
+
+static void writeField(Print &out, const char *name, const char *text, bool sparse) {
+    if (sparse && !text[0]) return;
+    out.printf(",\"%s\":",name);
+    writeJsonText(out,text);
+}
+
+static void writeTimeField(Print &out, const char *name, uint16_t mins, bool sparse) {
+    char time[6];
+    writeField(out,name,formatTime(mins,time),sparse);
+}
+
+static void writeNumber(Print &out, const char *name, int value, bool sparse) {
+    if (sparse && !value) return;
+    out.printf(",\"%s\":%d",name,value);
+}
+
+static void writeFlag(Print &out, const char *name, bool value, bool sparse) {
+    if (sparse && !value) return;
+    out.printf(",\"%s\":%s",name,value?"true":"false");
+}
+
+// One service, with the field groups in the SVC_ flags. Sparse leaves out empty fields (whole boards).
+static void writeService(Print &out, const rdStation *board, int row, uint8_t fields, bool sparse) {
+    const rdService &s = board->service[row];
+    out.printf("{\"row\":%d",row);
+    if (s.serviceId) out.printf(",\"id\":%u",s.serviceId);
+    if (!sparse && (board->changes.service[row] & SVC_MOVED) && board->changes.fromRow[row] >= 0) out.printf(",\"from\":%d",board->changes.fromRow[row]);
+    if (fields & SVC_TIME) {
+        writeTimeField(out,"time",s.sTime,sparse);
+        writeField(out,"etd",s.etd,sparse);
+        writeTimeField(out,"expected",s.etdTime,sparse);
+        writeNumber(out,"due",s.timeToStation,sparse);
+    }
+    if (fields & SVC_DEST) {
+        writeField(out,"dest",board->text.get(s.destination),sparse);
+        writeField(out,"via",board->text.get(s.via),sparse);
+    }
+    if (fields & SVC_PLATFORM) writeField(out,"platform",s.platform,sparse);
+    if (fields & SVC_STATUS) {
+        writeFlag(out,"cancelled",s.isCancelled,sparse);
+        writeFlag(out,"delayed",s.isDelayed,sparse);
+    }
+    if (fields & SVC_DETAIL) {
+        writeField(out,"operator",board->text.get(s.opco),sparse);
+        writeNumber(out,"length",s.trainLength,sparse);
+        writeNumber(out,"classes",s.classesAvailable,sparse);
+        writeNumber(out,"type",s.serviceType,sparse);
+    }
+    out.write('}');
+}
+
+static void writeCalling(Print &out, const rdStation *board, bool sparse) {
+    out.print(",\"calling\":[");
+    char scheduled[6];
+    char expected[6];
+    for (int i=0;i<board->numCalling;i++) {
+        const callingPoint &cp = board->calling[i];
+        out.print(i ? ",[" : "[");
+        writeJsonText(out,board->text.get(cp.name));
+        out.printf(",\"%s\",\"%s\"]",formatTime(cp.scheduled,scheduled),formatTime(cp.expected,expected));
+    }
+    out.write(']');
+    writeField(out,"lastSeen",board->text.get(board->lastSeen),sparse);
+}
+
+static void writeDetails(Print &out, const rdStation *board, bool sparse) {
+    writeField(out,"origin",board->text.get(board->origin),sparse);
+    writeField(out,"serviceMessage",board->text.get(board->serviceMessage),sparse);
+}
+
+static void writeMessages(Print &out, const stnMessages *messages) {
+    out.print(",\"messages\":[");
+    for (int i=0;i<messages->numMessages;i++) {
+        if (i) out.write(',');
+        writeJsonText(out,messages->messages[i]);
+    }
+    out.write(']');
+}
+
+void writeBoardFields(Print &out, const rdStation *board, const stnMessages *messages) {
+    writeField(out,"location",board->location,true);
+    writeFlag(out,"platforms",board->platformAvailable,true);
+    out.print(",\"services\":[");
+    for (int i=0;i<board->numServices;i++) {
+        if (i) out.write(',');
+        writeService(out,board,i,ALLFIELDS,true);
+    }
+    out.write(']');
+    if (board->numServices) {
+        writeDetails(out,board,true);
+        if (board->numCalling) writeCalling(out,board,true);
+    }
+    if (messages) writeMessages(out,messages);
+}
+
+static void writeBoard(Print &out, uint32_t id, const char *mode, const rdStation *board, const stnMessages *messages) {
+    out.printf("{\"id\":%u,\"mode\":\"%s\"",id,mode);
+    writeBoardFields(out,board,messages);
+    out.write('}');
+}
+
+static void writeChanges(Print &out, uint32_t id, const rdStation *board, const stnMessages *messages) {
+    const boardDiff &changes = board->changes;
+    out.printf("{\"id\":%u,\"numServices\":%d",id,board->numServices);
+    if (changes.headerChanged) {
+        writeField(out,"location",board->location,false);
+        writeFlag(out,"platforms",board->platformAvailable,false);
+    }
+    out.print(",\"services\":[");
+    bool first = true;
+    for (int i=0;i<board->numServices;i++) {
+        uint8_t flags = changes.service[i];
+        if (!flags) continue;
+        if (!first) out.write(',');
+        first = false;
+        writeService(out,board,i,(flags & SVC_NEW) ? ALLFIELDS : flags,false);
+    }
+    out.write(']');
+    if (changes.detailsChanged) writeDetails(out,board,false);
+    if (changes.callingChanged) writeCalling(out,board,false);
+    if (changes.messagesChanged && messages) writeMessages(out,messages);
+    out.write('}');
+}
+
+boardFeed::~boardFeed() {
+    release();
+}
+
+bool boardFeed::allocate(size_t size) {
+    release();
+    buffer = (char *)malloc(size+1);
+    if (!buffer) return false;
+    buffer[size] = '\0';
+    length = size;
+    return true;
+}
+
+void boardFeed::release() {
+    free(buffer);
+    buffer = nullptr;
+    length = 0;
+}
+
+size_t boardFeed::encodeBoard(const char *mode, const rdStation *board, const stnMessages *messages) {
+    feedWriter counter(nullptr);
+    writeBoard(counter,sequence+1,mode,board,messages);
+    if (!allocate(counter.written())) return 0;
+    feedWriter writer(buffer);
+    writeBoard(writer,++sequence,mode,board,messages);
+    fullPending = false;
+    return length;
+}
+
+size_t boardFeed::encodeChanges(const rdStation *board, const stnMessages *messages) {
+    feedWriter counter(nullptr);
+    writeChanges(counter,sequence+1,board,messages);
+    if (!allocate(counter.written())) return 0;
+    feedWriter writer(buffer);
+    writeChanges(writer,++sequence,board,messages);
+    return length;
+}
@@ -0,0 +1,78 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * boardFeed Library - compact JSON snapshots and changes of the displayed board for subscribers
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <sharedDataStructs.h>
+#include <atomic>
+
+// Write text as a JSON string. Control characters are escaped, so it's also safe in an SSE data line. UTF-8 is
+// passed through, other bytes from 0x80 up are taken as display font characters and escaped as their Unicode
+// equivalents.
+void writeJsonText(Print &out, const char *text);
+
+// Write the board as the fields of a JSON object (each one preceded by a comma), as in a "board" message.
+// Messages may be nullptr.
+void writeBoardFields(Print &out, const rdStation *board, const stnMessages *messages);
+
+//
+// A "board" message has everything on the board:
+//   {"id":n,"mode":"rail","location":...,"platforms":true,"services":[{"row":0,"time":"12:34",...}],
+//    "origin":...,"serviceMessage":...,"lastSeen":...,"calling":[["name","12:40","12:41"]],"messages":[...]}
+// Empty fields are left out. A "changes" message describes a secondary change to the previous message (id-1)
+// using the board's change flags: numServices, then for each changed row its "row", "from" (the row it was on
+// in the previous message, if it moved) and every field in the groups that changed, including empty ones.
+// Location, calling points, first service details and messages are sent in full when they change.
+// A subscriber that misses a message should reconnect to get the whole board again.
+//
+// Each message is measured, then written into a buffer of exactly that size, so it's never built up a piece
+// at a time and the buffer is only held for as long as it takes to hand the message to the server. The server
+// then makes one copy of it with the event framing (a String), which is shared by every subscriber.
+//
+class boardFeed {
+
+    private:
+        char *buffer = nullptr;
+        size_t length = 0;
+        uint32_t sequence = 0;
+        std::atomic<bool> fullPending{false};   // Set by the web server task when a subscriber connects
+
+        bool allocate(size_t size);
+
+    public:
+        ~boardFeed();
+
+        // A subscriber has connected, so the next message should be the whole board
+        void requestFull() {
+            fullPending = true;
+        }
+
+        bool fullRequested() const {
+            return fullPending;
+        }
+
+        // Encode the whole board. Messages may be nullptr (bus boards). Returns the length, 0 if there isn't enough memory.
+        size_t encodeBoard(const char *mode, const rdStation *board, const stnMessages *messages);
+
+        // Encode what board->changes says has changed since the last message
+        size_t encodeChanges(const rdStation *board, const stnMessages *messages);
+
+        const char *data() const {
+            return buffer;
+        }
+
+        uint32_t id() const {
+            return sequence;
+        }
+
+        // Free the message once it's been sent
+        void release();
+};
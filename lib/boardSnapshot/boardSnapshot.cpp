@@ -0,0 +1,131 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * boardSnapshot Library - saves the last good board to flash so it can be shown at boot
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <boardSnapshot.h>
+#include <boardDiff.h>
+#include <LittleFS.h>
+#include <time.h>
+#include <stddef.h>
+
+#define SNAPSHOTMAGIC 0x53534244UL    // "DBSS"
+#define BOARDFIELDSIZE offsetof(rdStation,text)   // Everything in the board except the text arena
+
+struct snapshotHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t boardSize;
+    char key[MAXSNAPSHOTKEYSIZE];
+    char savedTime[6];
+    uint16_t textBytes;
+    uint32_t checksum;      // FNV-1a hash of everything after the header
+};
+
+bool saveBoardSnapshot(const char *path, const char *key, const rdStation *board, const stnMessages *messages, const char *weather) {
+    snapshotHeader header = {};
+    header.magic = SNAPSHOTMAGIC;
+    header.version = SNAPSHOTVERSION;
+    header.boardSize = BOARDFIELDSIZE;
+    strlcpy(header.key,key,sizeof(header.key));
+    struct tm now;
+    if (getLocalTime(&now,0)) sprintf(header.savedTime,"%02d:%02d",now.tm_hour,now.tm_min);
+    header.textBytes = board->text.bytesUsed();
+
+    uint8_t numMessages = messages->numMessages;
+    uint8_t weatherLength = strnlen(weather,255);
+
+    // Work out the checksum of the payload first so the file is written in one pass
+    uint32_t hash = FNV_OFFSET;
+    hash = hashBytes(hash,board,BOARDFIELDSIZE);
+    hash = hashBytes(hash,board->text.buffer(),header.textBytes);
+    hash = hashBytes(hash,&numMessages,sizeof(numMessages));
+    for (int i=0;i<numMessages;i++) {
+        uint16_t length = strlen(messages->messages[i]);
+        hash = hashBytes(hash,&length,sizeof(length));
+        hash = hashBytes(hash,messages->messages[i],length);
+    }
+    hash = hashBytes(hash,&weatherLength,sizeof(weatherLength));
+    hash = hashBytes(hash,weather,weatherLength);
+    header.checksum = hash;
+
+    File f = LittleFS.open(path,"w");
+    if (!f) return false;
+    f.write((const uint8_t *)&header,sizeof(header));
+    f.write((const uint8_t *)board,BOARDFIELDSIZE);
+    f.write((const uint8_t *)board->text.buffer(),header.textBytes);
+    f.write(&numMessages,sizeof(numMessages));
+    for (int i=0;i<numMessages;i++) {
+        uint16_t length = strlen(messages->messages[i]);
+        f.write((const uint8_t *)&length,sizeof(length));
+        f.write((const uint8_t *)messages->messages[i],length);
+    }
+    f.write(&weatherLength,sizeof(weatherLength));
+    size_t written = f.write((const uint8_t *)weather,weatherLength);
+    f.close();
+    return written == weatherLength;
+}
+
+// Check the payload against the header checksum without loading it anywhere
+static bool checkPayload(File &f, const snapshotHeader &header) {
+    uint8_t buffer[64];
+    uint32_t hash = FNV_OFFSET;
+    size_t remaining = f.size() - sizeof(snapshotHeader);
+    while (remaining) {
+        size_t chunk = f.read(buffer,min(remaining,sizeof(buffer)));
+        if (!chunk) return false;
+        hash = hashBytes(hash,buffer,chunk);
+        remaining -= chunk;
+    }
+    return hash == header.checksum;
+}
+
+bool loadBoardSnapshot(const char *path, const char *key, rdStation *board, stnMessages *messages, char *weather, size_t weatherSize, char *savedTime) {
+    if (!LittleFS.exists(path)) return false;
+    File f = LittleFS.open(path,"r");
+    if (!f) return false;
+
+    snapshotHeader header;
+    if (f.read((uint8_t *)&header,sizeof(header)) != sizeof(header) || header.magic != SNAPSHOTMAGIC || header.version != SNAPSHOTVERSION ||
+        header.boardSize != BOARDFIELDSIZE || header.textBytes > board->text.capacity() || strncmp(header.key,key,sizeof(header.key)) || !checkPayload(f,header)) {
+        f.close();
+        return false;
+    }
+
+    // The file is good, so load it
+    f.seek(sizeof(header));
+    f.read((uint8_t *)board,BOARDFIELDSIZE);
+    f.read((uint8_t *)board->text.restore(header.textBytes),header.textBytes);
+    uint8_t numMessages = 0;
+    f.read(&numMessages,sizeof(numMessages));
+    messages->numMessages = 0;
+    for (int i=0;i<numMessages;i++) {
+        uint16_t length = 0;
+        f.read((uint8_t *)&length,sizeof(length));
+        if (i<MAXBOARDMESSAGES && length<MAXMESSAGESIZE) {
+            f.read((uint8_t *)messages->messages[i],length);
+            messages->messages[i][length] = '\0';
+            messages->numMessages++;
+        } else {
+            f.seek(length,SeekCur);
+        }
+    }
+    uint8_t weatherLength = 0;
+    f.read(&weatherLength,sizeof(weatherLength));
+    if (weatherLength < weatherSize) {
+        f.read((uint8_t *)weather,weatherLength);
+        weather[weatherLength] = '\0';
+    }
+    f.close();
+
+    if (board->numServices > MAXBOARDSERVICES) board->numServices = MAXBOARDSERVICES;
+    if (board->numCalling > MAXBOARDCALLINGPOINTS) board->numCalling = MAXBOARDCALLINGPOINTS;
+    strlcpy(savedTime,header.savedTime,sizeof(header.savedTime));
+    return true;
+}
@@ -0,0 +1,24 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * boardSnapshot Library - saves the last good board to flash so it can be shown at boot
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <sharedDataStructs.h>
+
+#define SNAPSHOTVERSION 3
+#define MAXSNAPSHOTKEYSIZE 64     // Identifies the board settings the snapshot was taken with
+
+// Save the board, messages and weather. The key is checked on load so a snapshot is only shown for the same board settings.
+bool saveBoardSnapshot(const char *path, const char *key, const rdStation *board, const stnMessages *messages, const char *weather);
+
+// Load a snapshot saved with the same key. savedTime receives the local time ("hh:mm") it was taken. Returns false
+// (leaving the board untouched) if there's no snapshot, it's for different settings or it fails the checksum.
+bool loadBoardSnapshot(const char *path, const char *key, rdStation *board, stnMessages *messages, char *weather, size_t weatherSize, char *savedTime);
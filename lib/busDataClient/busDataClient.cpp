@@ -11,8 +11,9 @@
 
 #include <busDataClient.h>
 #include <WiFiClientSecure.h>
+#include <fetchMetrics.h>
 
-busDataClient::busDataClient(busTubeStation *station, sharedBufferSpace *sharedBuffer) : xBusStop(station), js(sharedBuffer) {}
+busDataClient::busDataClient(busTubeStation *station, rdStation *board, sharedBufferSpace *sharedBuffer) : xBusStop(station), xBoard(board), js(sharedBuffer) {}
 
 //
 // Strip HTML tag from string
@@ -118,19 +119,138 @@ void busDataClient::cleanFilter(const char* rawFilter, char* cleanedFilter, size
     return;
 }
 
+//
+// End of a departure row - keep it if it matches the filter, otherwise reuse the slot for the next row
+//
+void busDataClient::nextRow(const char *filter) {
+    if (serviceMatchesFilter(filter,xBusStop->text.get(xBusStop->service[id].lineName))) {
+        id++;
+        if (id>=MAXBOARDSERVICES) maxServicesRead=true;
+    } else {
+        // Give back the text used by this row
+        xBusStop->text.release(rowMark);
+        xBusStop->service[id].destinationName = noDestination;
+        xBusStop->service[id].lineName = {};
+        xBusStop->service[id].scheduled = NOTIME;
+        xBusStop->service[id].expected = NOTIME;
+    }
+    rowMark = xBusStop->text.mark();
+}
+
+void busDataClient::startPage() {
+    id=0;
+    maxServicesRead = false;
+    xBusStop->numServices = 0;
+    xBusStop->text.reset();
+    noDestination = xBusStop->text.add(busNoDestination);
+    for (int i=0;i<MAXBOARDSERVICES;i++) {
+        xBusStop->service[i].destinationName = noDestination;
+        xBusStop->service[i].lineName = {};
+        xBusStop->service[i].scheduled = NOTIME;
+        xBusStop->service[i].expected = NOTIME;
+    }
+    rowMark = xBusStop->text.mark();
+    parseStep = PBT_START; // looking for the start of data
+    dataColumns = 0;
+    serviceData = false;
+}
+
+bool busDataClient::parseLine(String &line, const char *filter) {
+    if (maxServicesRead) return true;
+    line.trim();
+    if (!line.length()) return false;
+    if (line.indexOf("</body>")>=0) return true;    // end of page
+
+    switch (parseStep) {
+        case PBT_START:
+            if (line.indexOf("<tr>")>=0) parseStep = PBT_HEADER;
+            break;
+
+        case PBT_HEADER:
+            if (line.indexOf("</tr>")>=0) {
+                parseStep = PBT_SERVICE;
+                serviceData = false;
+            }
+            else if (line.substring(0,1)=="<") dataColumns++;
+            break;
+
+        case PBT_SERVICE:
+            if (line.indexOf("</table>")>=0) {
+                // Assume another day of data with headers
+                dataColumns=0;
+                parseStep = PBT_START;
+            }
+            else if (line.indexOf("</td>")>=0) parseStep = PBT_DESTINATION;
+            else if (line.substring(0,3)=="<td") serviceData = true;
+            else if (line.substring(0,7)=="<a href" && serviceData) {
+                // Get the service name from within the hyperlink
+                String serviceId = stripTag(line);
+                xBusStop->service[id].lineName = xBusStop->text.add(serviceId.c_str(),MAXLINESIZE);
+            } else {
+                // must be a service Id without hyperlink
+                xBusStop->service[id].lineName = xBusStop->text.add(line.c_str(),MAXLINESIZE);
+            }
+            break;
+
+        case PBT_DESTINATION:
+            if (line.indexOf("</td>")>=0) parseStep = PBT_SCHEDULED;
+            else if (line.substring(0,1)!="<") {
+                xBusStop->service[id].destinationName = xBusStop->text.add(line.c_str(),MAXBUSTUBELOCATIONSIZE);
+            } else if (line.indexOf("class=\"vehicle\"")>=0) {
+                // Get the vehicle details
+                String vehicle = stripTag(line);
+                // Strip off ticket m/c if it's included
+                int tikregsep = vehicle.indexOf(" - ");
+                if (tikregsep>0) {
+                    vehicle = vehicle.substring(tikregsep+3);
+                    vehicle.trim();
+                }
+                if ((xBusStop->service[id].destinationName.length + vehicle.length() + 3) < MAXBUSTUBELOCATIONSIZE) {
+                    char destination[MAXBUSTUBELOCATIONSIZE];
+                    sprintf(destination,"%s (%s)",xBusStop->text.get(xBusStop->service[id].destinationName),vehicle.c_str());
+                    xBusStop->service[id].destinationName = xBusStop->text.add(destination,MAXBUSTUBELOCATIONSIZE);
+                }
+            }
+            break;
+
+        case PBT_SCHEDULED:
+            if (line.indexOf("</td>")>=0) {
+                if (dataColumns == 4) parseStep = PBT_EXPECTED; else {
+                    xBusStop->service[id].expected = NOTIME;
+                    parseStep = PBT_HEADER;
+                    nextRow(filter);
+                }
+            } else if (line.substring(0,1)!="<") {
+                xBusStop->service[id].scheduled = parseTime(line.c_str());
+            }
+            break;
+
+        case PBT_EXPECTED:
+            if (line.indexOf("</td>")>=0) {
+                parseStep = PBT_HEADER;
+                nextRow(filter);
+            }
+            else if (line.substring(0,1)!="<") {
+                xBusStop->service[id].expected = parseTime(line.c_str());
+            }
+            break;
+    }
+    return maxServicesRead;
+}
+
 int busDataClient::fetchDepartures(rdStation *station, const char *locationId, const char *filter) {
 
     unsigned long perfTimer=millis();
     long dataReceived = 0;
     bool bChunked = false;
     js->lastResultMessage[0] = '\0';
+    fetchTrace trace(UPSTREAM_BUS);
 
 
     WiFiClientSecure httpsClient;
     httpsClient.setInsecure();
     httpsClient.setTimeout(5000);
     httpsClient.setConnectionTimeout(5000);
-    boardChanged=false;
 
     int retryCounter=0;
     while (!httpsClient.connect(apiHost,443) && (retryCounter++ < 10)){
@@ -140,6 +260,7 @@ int busDataClient::fetchDepartures(rdStation *station, const char *locationId, c
         strcpy(js->lastResultMessage,"Error: Connect timed out");
         return UPD_NO_RESPONSE;
     }
+    trace.mark(PHASE_CONNECT);
     String request = "GET /stops/" + String(locationId) + "/departures HTTP/1.0\r\nHost: " + String(apiHost) + "\r\nConnection: close\r\n\r\n";
     httpsClient.print(request);
     retryCounter=0;
@@ -153,6 +274,7 @@ int busDataClient::fetchDepartures(rdStation *station, const char *locationId, c
         strcpy(js->lastResultMessage,"Error: GET timed out");
         return UPD_TIMEOUT;
     }
+    trace.mark(PHASE_WAIT);
 
     // Parse status code
     String statusLine = httpsClient.readStringUntil('\n');
@@ -177,112 +299,21 @@ int busDataClient::fetchDepartures(rdStation *station, const char *locationId, c
 
     // Start scraping the data
     unsigned long dataSendTimeout = millis() + 10000UL;
-    id=0;
-    bool maxServicesRead = false;
-    xBusStop->numServices = 0;
-    for (int i=0;i<MAXBOARDSERVICES;i++) {
-        strcpy(xBusStop->service[i].destinationName,"Check front of bus");
-        strcpy(xBusStop->service[i].scheduled,"");
-        strcpy(xBusStop->service[i].expected,"");
-    }
-    int parseStep = PBT_START; // looking for the start of data
-    int dataColumns = 0;
-    bool serviceData;
-    String serviceId;
-    String destination;
-
-    while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout) && (!maxServicesRead)) {
-        while(httpsClient.available() && !maxServicesRead) {
+    startPage();
+    bool parseComplete = false;
+
+    while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout) && (!parseComplete)) {
+        while(httpsClient.available() && !parseComplete) {
             String line = httpsClient.readStringUntil('\n');
             dataReceived+=line.length()+1;
-            line.trim();
-            if (line.length()) {
-                if (line.indexOf("</body>")>=0) {
-                    // end of page
-                    maxServicesRead = true;
-                } else {
-                    switch (parseStep) {
-                        case PBT_START:
-                            if (line.indexOf("<tr>")>=0) parseStep = PBT_HEADER;
-                            break;
-
-                        case PBT_HEADER:
-                            if (line.indexOf("</tr>")>=0) {
-                                parseStep = PBT_SERVICE;
-                                serviceData = false;
-                            }
-                            else if (line.substring(0,1)=="<") dataColumns++;
-                            break;
-
-                        case PBT_SERVICE:
-                            if (line.indexOf("</table>")>=0) {
-                                // Assume another day of data with headers
-                                dataColumns=0;
-                                parseStep = PBT_START;
-                            }
-                            else if (line.indexOf("</td>")>=0) parseStep = PBT_DESTINATION;
-                            else if (line.substring(0,3)=="<td") serviceData = true;
-                            else if (line.substring(0,7)=="<a href" && serviceData) {
-                                // Get the service name from within the hyperlink
-                                serviceId = stripTag(line);
-                                strlcpy(xBusStop->service[id].lineName,serviceId.c_str(),MAXLINESIZE);
-                            } else {
-                                // must be a service Id without hyperlink
-                                serviceId = line;
-                                strlcpy(xBusStop->service[id].lineName,serviceId.c_str(),MAXLINESIZE);
-                            }
-                            break;
-
-                        case PBT_DESTINATION:
-                            if (line.indexOf("</td>")>=0) parseStep = PBT_SCHEDULED;
-                            else if (line.substring(0,1)!="<") {
-                                strlcpy(xBusStop->service[id].destinationName,line.c_str(),MAXLOCATIONSIZE);
-                            } else if (line.indexOf("class=\"vehicle\"")>=0) {
-                                // Get the vehicle details
-                                String vehicle = stripTag(line);
-                                // Strip off ticket m/c if it's included
-                                int tikregsep = vehicle.indexOf(" - ");
-                                if (tikregsep>0) {
-                                    vehicle = vehicle.substring(tikregsep+3);
-                                    vehicle.trim();
-                                }
-                                if ((strlen(xBusStop->service[id].destinationName) + vehicle.length() + 3) < sizeof(xBusStop->service[id].destinationName)) {
-                                    sprintf(xBusStop->service[id].destinationName,"%s (%s)",xBusStop->service[id].destinationName,vehicle.c_str());
-                                }
-                            }
-                            break;
-
-                        case PBT_SCHEDULED:
-                            if (line.indexOf("</td>")>=0) {
-                                if (dataColumns == 4) parseStep = PBT_EXPECTED; else {
-                                    strcpy(xBusStop->service[id].expected,"");
-                                    parseStep = PBT_HEADER;
-                                    if (serviceMatchesFilter(filter,xBusStop->service[id].lineName)) id++;
-                                    if (id>=MAXBOARDSERVICES) maxServicesRead=true;
-                                }
-                            } else if (line.substring(0,1)!="<") {
-                                strlcpy(xBusStop->service[id].scheduled,line.c_str(),sizeof(xBusStop->service[id].scheduled));
-                            }
-                            break;
-
-                        case PBT_EXPECTED:
-                            if (line.indexOf("</td>")>=0) {
-                                parseStep = PBT_HEADER;
-                                if (serviceMatchesFilter(filter,xBusStop->service[id].lineName)) id++;
-                                if (id>=MAXBOARDSERVICES) maxServicesRead=true;
-                            }
-                            else if (line.substring(0,1)!="<") {
-                                strlcpy(xBusStop->service[id].expected,line.c_str(),sizeof(xBusStop->service[id].expected));
-                            }
-                            break;
-                    }
-                }
-            }
+            parseComplete = parseLine(line,filter);
         }
         delay(5);
     }
 
     httpsClient.stop();
+    trace.setBytes(dataReceived);
+    trace.mark(PHASE_BODY);
     if (millis() >= dataSendTimeout) {
         sprintf(js->lastResultMessage,"Error: Timeout after %d bytes",dataReceived);
         return UPD_TIMEOUT;
@@ -291,30 +322,53 @@ int busDataClient::fetchDepartures(rdStation *station, const char *locationId, c
     xBusStop->numServices = id;
 
     // Remove &amp; from destination name
-    for (int i=0;i<xBusStop->numServices;i++) replaceWord(xBusStop->service[i].destinationName,"&amp;","&");
+    for (int i=0;i<xBusStop->numServices;i++) {
+        replaceWord(xBusStop->text.edit(xBusStop->service[i].destinationName),"&amp;","&");
+        xBusStop->text.refresh(xBusStop->service[i].destinationName);
+    }
 
-    // Check if any of the services have changed
-    if (xBusStop->numServices != station->numServices) boardChanged=true;
-    else if (xBusStop->numServices && strcmp(xBusStop->service[0].destinationName,station->service[0].destination) || strcmp(xBusStop->service[0].lineName,station->service[0].via)) boardChanged=true;
+    // Check if any of the services have changed. A new first service or number of services scrolls the board in,
+    // anything else is redrawn in place.
+    buildBoard();
+    diffBoards(station,nullptr,xBoard,nullptr);
+    xBoard->boardChanged = servicesReplaced(station,xBoard);
+    int result = boardUpdateResult(&xBoard->changes);
+    if (xBoard->boardChanged) result = UPD_SUCCESS;
+    else if (result == UPD_SUCCESS) result = UPD_SEC_CHANGE;
 
+    trace.mark(PHASE_PROCESS);
     UBaseType_t uxHighWaterMark = uxTaskGetStackHighWaterMark(NULL);
-    if (boardChanged) {
-        sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"OK: UP D:%d T:%d S:%d %s",dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
-        return UPD_SUCCESS;
-    } else {
-        sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"OK: NC D:%d T:%d S:%d %s",dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
-        return UPD_NO_CHANGE;
+    const char *changeType = (result == UPD_NO_CHANGE) ? "NC" : (result == UPD_SEC_CHANGE) ? "SC" : "UP";
+    sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"OK: %s D:%d T:%d S:%d %s",changeType,dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
+    return result;
+}
+
+// Build the next board from the fetched departures
+void busDataClient::buildBoard() {
+    TRACE_SPAN("build","bus");
+    xBoard->location[0] = '\0';
+    xBoard->platformAvailable = false;
+    xBoard->numServices = xBusStop->numServices;
+    xBoard->text.reset();
+    for (int i=0;i<xBusStop->numServices;i++) {
+        xBoard->service[i] = {};
+        xBoard->service[i].destination = xBoard->text.add(xBusStop->text.get(xBusStop->service[i].destinationName));
+        xBoard->service[i].via = xBoard->text.add(xBusStop->text.get(xBusStop->service[i].lineName));
+        xBoard->service[i].sTime = xBusStop->service[i].scheduled;
+        xBoard->service[i].etdTime = xBusStop->service[i].expected;
+        // Identity is the service number and scheduled time
+        uint32_t hash = hashText(FNV_OFFSET,xBusStop->text.get(xBusStop->service[i].lineName));
+        xBoard->service[i].serviceId = hashBytes(hash,&xBusStop->service[i].scheduled,sizeof(uint16_t));
     }
+    xBoard->origin = {};
+    xBoard->numCalling = 0;
+    xBoard->callingTruncated = false;
+    xBoard->lastSeen = {};
+    xBoard->serviceMessage = {};
+    fingerprintBoard(xBoard,nullptr);
 }
 
 void busDataClient::loadDepartures(rdStation *station) {
     // Update the callers data with the new data
-    station->boardChanged = boardChanged;
-    station->numServices = xBusStop->numServices;
-    for (int i=0;i<xBusStop->numServices;i++) {
-        strcpy(station->service[i].destination,xBusStop->service[i].destinationName);
-        strcpy(station->service[i].via,xBusStop->service[i].lineName);
-        strcpy(station->service[i].sTime,xBusStop->service[i].scheduled);
-        strcpy(station->service[i].etd,xBusStop->service[i].expected);
-    }
-}
\ No newline at end of file
+    *station = *xBoard;
+}
@@ -11,6 +11,7 @@
 #pragma once
 #include <sharedDataStructs.h>
 #include <responseCodes.h>
+#include <boardDiff.h>
 
 #define MAXBUSFILTERSIZE 25
 
@@ -26,11 +27,17 @@ class busDataClient {
     private:
 
         const char* apiHost = "bustimes.org";
+        const char* busNoDestination = "Check front of bus";
 
         int id=0;
-        bool maxServicesRead = false;
-        bool boardChanged = false;
+        bool maxServicesRead = false;   // Set by nextRow() once MAXBOARDSERVICES rows have been kept
+        int parseStep = 0;
+        int dataColumns = 0;
+        bool serviceData = false;
+        strRef noDestination = {};   // Shared default destination text in the arena
+        uint16_t rowMark = 0;        // Arena position at the start of the current row
         busTubeStation* xBusStop = nullptr;
+        rdStation* xBoard = nullptr;   // The next board to display, built at the end of each fetch
         sharedBufferSpace* js = nullptr;
 
         String stripTag(String html);
@@ -38,11 +45,19 @@ class busDataClient {
         void trim(char* &start, char* &end);
         bool equalsIgnoreCase(const char* a, int a_len, const char* b);
         bool serviceMatchesFilter(const char* filter, const char* serviceId);
+        void nextRow(const char *filter);
+        void buildBoard();
 
     public:
 
-        busDataClient(busTubeStation *station, sharedBufferSpace *sharedBuffer);
+        busDataClient(busTubeStation *station, rdStation *board, sharedBufferSpace *sharedBuffer);
         void cleanFilter(const char* rawFilter, char* cleanedFilter, size_t maxLen);
         int fetchDepartures(rdStation *station, const char *locationId, const char *filter);
         void loadDepartures(rdStation *station);
+
+        // Page parsing, used by fetchDepartures() a line at a time. parseLine() returns true once the end of
+        // the page is reached or MAXBOARDSERVICES services have been read.
+        void startPage();
+        bool parseLine(String &line, const char *filter);
+        int servicesRead() const { return id; }
 };
\ No newline at end of file
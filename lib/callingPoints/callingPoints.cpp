@@ -0,0 +1,153 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * callingPoints Library - builds and formats the list of stops for rail services
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <callingPoints.h>
+#include <boardDiff.h>
+
+// Index slot holding a stop with this name, or the empty slot where it would go. Slots for stops that have
+// since been released are passed over (their names are compared like any other, so they never match wrongly).
+static int findName(const rdiStation *station, const char *name, size_t length, uint32_t hash) {
+    int slot = hash & (CALLINGINDEXSIZE-1);
+    for (int probes=0;probes<CALLINGINDEXSIZE;probes++) {
+        uint8_t entry = station->callingIndex[slot];
+        if (!entry) return slot;
+        if (entry <= station->numCallingPoints) {
+            strRef ref = station->callingPoints[entry-1].name;
+            if (ref.length == length && memcmp(station->text.get(ref),name,length) == 0) return slot;
+        }
+        slot = (slot+1) & (CALLINGINDEXSIZE-1);
+    }
+    return -1;
+}
+
+void resetCallingPoints(rdiStation *station) {
+    station->numCallingPoints = 0;
+    memset(station->callingIndex,0,sizeof(station->callingIndex));
+}
+
+bool addCallingPoint(rdiStation *station, int service, const char *name) {
+    if (!name[0]) return false;
+    rdiService *svc = &station->service[service];
+    if (station->numCallingPoints >= MAXCALLINGPOINTS) {
+        svc->callingTruncated = true;
+        return false;
+    }
+
+    // Most services on a board share their stops, so reuse the name if another stop already has it
+    size_t length = strnlen(name,MAXLOCATIONSIZE-1);
+    uint32_t hash = hashBytes(FNV_OFFSET,name,length);
+    int slot = findName(station,name,length,hash);
+    strRef ref = {};
+    if (slot >= 0 && station->callingIndex[slot]) ref = station->callingPoints[station->callingIndex[slot]-1].name;
+    else ref = station->text.add(name,MAXLOCATIONSIZE);
+    if (!ref.length) {
+        svc->callingTruncated = true;   // Text arena is full
+        return false;
+    }
+
+    if (!svc->numCalling) svc->firstCalling = station->numCallingPoints;
+    callingPoint *point = &station->callingPoints[station->numCallingPoints++];
+    point->name = ref;
+    point->scheduled = NOTIME;
+    point->expected = NOTIME;
+    svc->numCalling++;
+    if (slot >= 0 && !station->callingIndex[slot]) station->callingIndex[slot] = station->numCallingPoints;
+    return true;
+}
+
+void releaseCallingPoints(rdiStation *station, int service) {
+    rdiService *svc = &station->service[service];
+    if (svc->numCalling && svc->firstCalling + svc->numCalling == station->numCallingPoints) {
+        station->numCallingPoints = svc->firstCalling;
+        // Rebuild the index from the stops that are left, so released slots don't build up (this only happens
+        // when services are filtered out, at most once per service)
+        memset(station->callingIndex,0,sizeof(station->callingIndex));
+        for (int i=0;i<station->numCallingPoints;i++) {
+            strRef ref = station->callingPoints[i].name;
+            const char *name = station->text.get(ref);
+            int slot = findName(station,name,ref.length,hashBytes(FNV_OFFSET,name,ref.length));
+            if (slot >= 0 && !station->callingIndex[slot]) station->callingIndex[slot] = i+1;
+        }
+    }
+    svc->numCalling = 0;
+    svc->callingTruncated = false;
+}
+
+void copyCallingPoints(rdStation *board, const rdiStation *station, int service) {
+    const rdiService *svc = &station->service[service];
+    board->numCalling = 0;
+    board->callingTruncated = svc->callingTruncated || svc->numCalling > MAXBOARDCALLINGPOINTS;
+    for (int i=0;i<svc->numCalling && board->numCalling<MAXBOARDCALLINGPOINTS;i++) {
+        const callingPoint *from = &station->callingPoints[svc->firstCalling+i];
+        callingPoint *to = &board->calling[board->numCalling];
+        to->name = board->text.add(station->text.get(from->name));
+        if (!to->name.length) {
+            board->callingTruncated = true;   // Board arena is full
+            break;
+        }
+        to->scheduled = from->scheduled;
+        to->expected = from->expected;
+        board->numCalling++;
+    }
+    board->lastSeen = board->text.add(station->text.get(station->lastSeen));
+}
+
+// Copy text to buffer+pos if it fits, returning the new position (or 0 if it doesn't fit)
+static size_t appendText(char *buffer, size_t pos, size_t size, const char *text, size_t length) {
+    if (pos + length >= size) return 0;
+    memcpy(buffer+pos,text,length);
+    return pos + length;
+}
+
+#define MORESTOPS ", ..."
+
+size_t formatCallingPoints(const rdStation *board, char *buffer, size_t size) {
+    if (!size) return 0;
+    size_t pos = 0;
+    bool more = board->callingTruncated;
+    // Room is kept for the marker that shows stops have been left off
+    size_t stopsSize = size > sizeof(MORESTOPS) ? size - (sizeof(MORESTOPS)-1) : size;
+    char stop[MAXLOCATIONSIZE+12];
+    for (int i=0;i<board->numCalling;i++) {
+        const callingPoint *point = &board->calling[i];
+        // Build the whole stop first so a stop is never cut in half
+        size_t length = 0;
+        if (i) {
+            stop[length++] = ',';
+            stop[length++] = ' ';
+        }
+        memcpy(stop+length,board->text.get(point->name),point->name.length);
+        length += point->name.length;
+        if (point->scheduled != NOTIME) {
+            stop[length++] = ' ';
+            stop[length++] = '(';
+            formatTime(point->scheduled,stop+length);
+            length += 5;
+            stop[length++] = ')';
+        }
+        size_t next = appendText(buffer,pos,stopsSize,stop,length);
+        if (!next) {
+            more = true;
+            break;
+        }
+        pos = next;
+    }
+    if (more && pos) {
+        size_t next = appendText(buffer,pos,size,MORESTOPS,sizeof(MORESTOPS)-1);
+        if (next) pos = next;
+    }
+    if (board->lastSeen.length) {
+        size_t next = appendText(buffer,pos,size,board->text.get(board->lastSeen),board->lastSeen.length);
+        if (next) pos = next;
+    }
+    buffer[pos] = '\0';
+    return pos;
+}
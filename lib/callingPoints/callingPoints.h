@@ -0,0 +1,34 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * callingPoints Library - builds and formats the list of stops for rail services
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <sharedDataStructs.h>
+
+// Empty the download's calling points, at the start of a fetch
+void resetCallingPoints(rdiStation *station);
+
+// Add a stop to the end of a service's calling points. Services must be added one at a time so each
+// service's stops stay together. Returns false if there's no room (the stop is dropped and the service
+// is marked as truncated).
+bool addCallingPoint(rdiStation *station, int service, const char *name);
+
+// Give back the stops of a service that is being discarded (must be the most recently added service)
+void releaseCallingPoints(rdiStation *station, int service);
+
+// Copy the calling points and last seen report for a service onto the board. If any of its stops have been
+// dropped, the board is marked as truncated.
+void copyCallingPoints(rdStation *board, const rdiStation *station, int service);
+
+// Format the board's calling points as "Name (hh:mm), Name (hh:mm)" followed by the last seen report. If the
+// list is truncated, or stops don't fit in the buffer, it ends with ", ..." after the last stop that does.
+// Returns the length of the formatted text.
+size_t formatCallingPoints(const rdStation *board, char *buffer, size_t size);
@@ -0,0 +1,33 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * chunkWriter Library - keeps one chunk of a response that is written in full each time
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <chunkWriter.h>
+
+size_t chunkWriter::write(uint8_t c) {
+    if (position >= start && position < start + size) buffer[position-start] = c;
+    position++;
+    return 1;
+}
+
+size_t chunkWriter::write(const uint8_t *data, size_t len) {
+    size_t end = position + len;
+    // Copy the part of this write that falls inside the chunk
+    size_t from = position > start ? position : start;
+    size_t to = end < start + size ? end : start + size;
+    if (from < to) memcpy(buffer+(from-start),data+(from-position),to-from);
+    position = end;
+    return len;
+}
+
+size_t chunkWriter::length() const {
+    if (position <= start) return 0;
+    return position - start < size ? position - start : size;
+}
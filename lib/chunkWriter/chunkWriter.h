@@ -0,0 +1,47 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * chunkWriter Library - keeps one chunk of a response that is written in full each time
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+//
+// Chunked responses are filled by running the code that writes the whole response again for each chunk.
+// Everything before the chunk is counted and dropped, the chunk is copied into the server's buffer and
+// anything after it is ignored (writers can stop early once isFull()). Memory use is the same for any size
+// of response, as long as the output is the same each time it's written.
+//
+class chunkWriter : public Print {
+
+    private:
+        uint8_t *buffer;
+        size_t start;           // Offset of the chunk in the response
+        size_t size;
+        size_t position = 0;    // Bytes of the response written so far
+
+    public:
+        chunkWriter(uint8_t *target, size_t offset, size_t maxLen) : buffer(target), start(offset), size(maxLen) {}
+
+        size_t write(uint8_t c) override;
+        size_t write(const uint8_t *data, size_t len) override;
+        using Print::write;
+
+        // Bytes placed in the buffer
+        size_t length() const;
+
+        bool isFull() const {
+            return position >= start + size;
+        }
+
+        // True when writing the start of the response
+        bool isFirstChunk() const {
+            return start == 0;
+        }
+};
@@ -0,0 +1,315 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * configSnapshot Library - config.json compiled into a fixed layout binary file for fast reloads
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <configSnapshot.h>
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <serviceTime.h>
+#include <algorithm>
+#include <stddef.h>
+
+#define CONFIGSNAPSHOTMAGIC 0x46434244UL  // "DBCF"
+#define CONFIGTEMPPATH "/config.bin.tmp"
+
+// What each setting affects when it's changed, in configSetting order
+struct settingField {
+    uint16_t offset;
+    uint16_t size;
+    uint8_t impact;
+};
+
+#define SETTING(member,impact) {offsetof(configSettings,member),sizeof(configSettings::member),impact}
+
+static const settingField settingFields[] = {
+    SETTING(hostname,IMPACT_REBOOT),                    // mDNS is only started at boot
+    SETTING(wsdlHost,IMPACT_TRANSPORT),
+    SETTING(wsdlAPI,IMPACT_TRANSPORT),
+    SETTING(showDate,IMPACT_RENDER),
+    SETTING(showBus,IMPACT_BOARD),
+    SETTING(showFullCalling,IMPACT_RENDER),
+    SETTING(showFullMsgs,IMPACT_RENDER),
+    SETTING(sleep,IMPACT_RENDER),
+    SETTING(darkSleep,IMPACT_RENDER),
+    SETTING(fastRefresh,IMPACT_SETTINGS),
+    SETTING(weather,IMPACT_WEATHER | IMPACT_RENDER),
+    SETTING(update,IMPACT_SETTINGS),
+    SETTING(updateDaily,IMPACT_SETTINGS),
+    SETTING(sleepStarts,IMPACT_RENDER),
+    SETTING(sleepEnds,IMPACT_RENDER),
+    SETTING(brightness,IMPACT_RENDER),
+    SETTING(noScroll,IMPACT_BOARD | IMPACT_RENDER),     // Last seen locations aren't fetched without scrolling
+    SETTING(flip,IMPACT_RENDER),
+    SETTING(touch,IMPACT_SETTINGS),
+    SETTING(dataIcon,IMPACT_RENDER),
+    SETTING(forceWakeTime,IMPACT_SETTINGS),
+    SETTING(timezone,IMPACT_TRANSPORT),                 // Moves the scheduler entries
+    SETTING(nrTimeOffset,IMPACT_BOARD | IMPACT_RENDER),
+    SETTING(hidePlatform,IMPACT_RENDER),
+    SETTING(hideOrdinals,IMPACT_RENDER),
+    SETTING(showLastSeen,IMPACT_BOARD),
+    SETTING(showTubeLocation,IMPACT_RENDER),
+    SETTING(showServiceMsgs,IMPACT_BOARD),
+    SETTING(enableScheduler,IMPACT_TRANSPORT),
+    SETTING(enableCarousel,IMPACT_TRANSPORT),
+    SETTING(rssUrl,IMPACT_RSS | IMPACT_RENDER),
+    SETTING(rssName,IMPACT_RSS | IMPACT_RENDER),
+    SETTING(rssPriority,IMPACT_RENDER),
+    SETTING(mode,IMPACT_TRANSPORT),
+    SETTING(dataSource,IMPACT_TRANSPORT)
+};
+
+static_assert(sizeof(settingFields)/sizeof(settingFields[0]) == CFG_DATASOURCE+1, "settingFields must list every configSetting");
+
+// Each of these copies a setting if it's in the JSON with the right type, returning false (and leaving the
+// target alone) if it isn't
+static bool getText(JsonVariantConst value, char *target, size_t size) {
+    if (!value.is<const char*>()) return false;
+    strlcpy(target,value.as<const char*>(),size);
+    return true;
+}
+
+static bool getFlag(JsonVariantConst value, bool &target) {
+    if (!value.is<bool>()) return false;
+    target = value.as<bool>();
+    return true;
+}
+
+static bool getInt(JsonVariantConst value, int32_t &target) {
+    if (!value.is<int>()) return false;
+    target = value.as<int>();
+    return true;
+}
+
+static bool getFloat(JsonVariantConst value, float &target) {
+    if (!value.is<float>()) return false;
+    target = value.as<float>();
+    return true;
+}
+
+// The board mode, or the legacy v1.x tube setting
+static bool getMode(JsonObjectConst json, int32_t &mode) {
+    if (getInt(json["mode"],mode)) return true;
+    if (!json["tube"].is<bool>()) return false;
+    mode = json["tube"].as<bool>() ? 1 : 0;
+    return true;
+}
+
+static bool isSet(JsonVariantConst value) {
+    return value.is<const char*>() && value.as<const char*>()[0];
+}
+
+static void compileSettings(JsonObjectConst json, configSettings *s) {
+    memset(s,0,sizeof(configSettings));
+    uint64_t present = 0;
+    s->railSet = isSet(json["crs"]);
+    s->tubeSet = isSet(json["tubeId"]);
+    s->busSet = isSet(json["busId"]);
+    if (getText(json["hostname"],s->hostname,sizeof(s->hostname)))         present |= 1ULL << CFG_HOSTNAME;
+    if (getText(json["wsdlHost"],s->wsdlHost,sizeof(s->wsdlHost)))         present |= 1ULL << CFG_WSDLHOST;
+    if (getText(json["wsdlAPI"],s->wsdlAPI,sizeof(s->wsdlAPI)))            present |= 1ULL << CFG_WSDLAPI;
+    if (getFlag(json["showDate"],s->showDate))                             present |= 1ULL << CFG_SHOWDATE;
+    if (getFlag(json["showBus"],s->showBus))                               present |= 1ULL << CFG_SHOWBUS;
+    if (getFlag(json["showFullCalling"],s->showFullCalling))               present |= 1ULL << CFG_SHOWFULLCALLING;
+    if (getFlag(json["showFullMsgs"],s->showFullMsgs))                     present |= 1ULL << CFG_SHOWFULLMSGS;
+    if (getFlag(json["sleep"],s->sleep))                                   present |= 1ULL << CFG_SLEEP;
+    if (getFlag(json["darkSleep"],s->darkSleep))                           present |= 1ULL << CFG_DARKSLEEP;
+    if (getFlag(json["fastRefresh"],s->fastRefresh))                       present |= 1ULL << CFG_FASTREFRESH;
+    if (getFlag(json["weather"],s->weather))                               present |= 1ULL << CFG_WEATHER;
+    if (getFlag(json["update"],s->update))                                 present |= 1ULL << CFG_UPDATE;
+    if (getFlag(json["updateDaily"],s->updateDaily))                       present |= 1ULL << CFG_UPDATEDAILY;
+    if (getInt(json["sleepStarts"],s->sleepStarts))                        present |= 1ULL << CFG_SLEEPSTARTS;
+    if (getInt(json["sleepEnds"],s->sleepEnds))                            present |= 1ULL << CFG_SLEEPENDS;
+    if (getInt(json["brightness"],s->brightness))                          present |= 1ULL << CFG_BRIGHTNESS;
+    if (getFlag(json["noScroll"],s->noScroll))                             present |= 1ULL << CFG_NOSCROLL;
+    if (getFlag(json["flip"],s->flip))                                     present |= 1ULL << CFG_FLIP;
+    if (getFlag(json["touch"],s->touch))                                   present |= 1ULL << CFG_TOUCH;
+    if (getFlag(json["dataIcon"],s->dataIcon))                             present |= 1ULL << CFG_DATAICON;
+    if (getInt(json["forceWakeTime"],s->forceWakeTime))                    present |= 1ULL << CFG_FORCEWAKETIME;
+    if (getText(json["TZ"],s->timezone,sizeof(s->timezone)))               present |= 1ULL << CFG_TZ;
+    if (getInt(json["nrTimeOffset"],s->nrTimeOffset))                      present |= 1ULL << CFG_NRTIMEOFFSET;
+    if (getFlag(json["hidePlatform"],s->hidePlatform))                     present |= 1ULL << CFG_HIDEPLATFORM;
+    if (getFlag(json["hideOrdinals"],s->hideOrdinals))                     present |= 1ULL << CFG_HIDEORDINALS;
+    if (getFlag(json["showLastSeen"],s->showLastSeen))                     present |= 1ULL << CFG_SHOWLASTSEEN;
+    if (getFlag(json["showTubeLocation"],s->showTubeLocation))             present |= 1ULL << CFG_SHOWTUBELOCATION;
+    if (getFlag(json["showServiceMsgs"],s->showServiceMsgs))               present |= 1ULL << CFG_SHOWSERVICEMSGS;
+    if (getFlag(json["enableScheduler"],s->enableScheduler))               present |= 1ULL << CFG_ENABLESCHEDULER;
+    if (getFlag(json["enableCarousel"],s->enableCarousel))                 present |= 1ULL << CFG_ENABLECAROUSEL;
+    if (getText(json["rssUrl"],s->rssUrl,sizeof(s->rssUrl)))               present |= 1ULL << CFG_RSSURL;
+    if (getText(json["rssName"],s->rssName,sizeof(s->rssName)))            present |= 1ULL << CFG_RSSNAME;
+    if (getFlag(json["rssPriority"],s->rssPriority))                       present |= 1ULL << CFG_RSSPRIORITY;
+    if (getMode(json,s->mode))                                             present |= 1ULL << CFG_MODE;
+    if (getInt(json["dataSource"],s->dataSource))                          present |= 1ULL << CFG_DATASOURCE;
+    s->present = present;
+}
+
+static void compileSlot(JsonObjectConst json, configSlot *slot) {
+    memset(slot,0,sizeof(configSlot));
+    uint32_t present = 0;
+    if (getMode(json,slot->mode))                                                       present |= 1UL << SLOT_MODE;
+    if (getInt(json["duration"],slot->duration))                                        present |= 1UL << SLOT_DURATION;
+    if (getText(json["crs"],slot->crs,sizeof(slot->crs)))                               present |= 1UL << SLOT_CRS;
+    if (getText(json["platformFilter"],slot->platformFilter,sizeof(slot->platformFilter)))  present |= 1UL << SLOT_PLATFORMFILTER;
+    if (getText(json["callingCrs"],slot->callingCrs,sizeof(slot->callingCrs)))          present |= 1UL << SLOT_CALLINGCRS;
+    if (getText(json["callingStation"],slot->callingStation,sizeof(slot->callingStation)))  present |= 1UL << SLOT_CALLINGSTATION;
+    if (getFloat(json["lat"],slot->lat))                                                present |= 1UL << SLOT_LAT;
+    if (getFloat(json["lon"],slot->lon))                                                present |= 1UL << SLOT_LON;
+    if (getText(json["tubeId"],slot->tubeId,sizeof(slot->tubeId)))                      present |= 1UL << SLOT_TUBEID;
+    if (getText(json["lineid"],slot->lineId,sizeof(slot->lineId)))                      present |= 1UL << SLOT_LINEID;
+    if (getText(json["direction"],slot->direction,sizeof(slot->direction)))             present |= 1UL << SLOT_DIRECTION;
+    if (getText(json["tubeName"],slot->tubeName,sizeof(slot->tubeName)))                present |= 1UL << SLOT_TUBENAME;
+    if (getFloat(json["tubeLat"],slot->tubeLat))                                        present |= 1UL << SLOT_TUBELAT;
+    if (getFloat(json["tubeLon"],slot->tubeLon))                                        present |= 1UL << SLOT_TUBELON;
+    if (getText(json["name"],slot->name,sizeof(slot->name)))                            present |= 1UL << SLOT_NAME;
+    if (getText(json["busId"],slot->busId,sizeof(slot->busId)))                         present |= 1UL << SLOT_BUSID;
+    if (getText(json["busFilter"],slot->busFilter,sizeof(slot->busFilter)))             present |= 1UL << SLOT_BUSFILTER;
+    if (getText(json["busName"],slot->busName,sizeof(slot->busName)))                   present |= 1UL << SLOT_BUSNAME;
+    if (getFloat(json["busLat"],slot->busLat))                                          present |= 1UL << SLOT_BUSLAT;
+    if (getFloat(json["busLon"],slot->busLon))                                          present |= 1UL << SLOT_BUSLON;
+    slot->present = present;
+}
+
+// FNV-1a
+static uint32_t hashBytes(uint32_t hash, const uint8_t *data, size_t len) {
+    for (size_t i=0;i<len;i++) {
+        hash ^= data[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+// Slot record n of the snapshot: the default board, then the sorted scheduler entries, then the carousel
+static void compileEntry(JsonObjectConst json, JsonArrayConst scheduler, JsonArrayConst carousel, const uint8_t *order, int n, configSlot *slot) {
+    int numScheduler = min((int)scheduler.size(),CONFIGMAXSLOTS);
+    if (n == 0) compileSlot(json,slot);
+    else if (n <= numScheduler) compileSlot(scheduler[order[n-1]],slot);
+    else compileSlot(carousel[n-1-numScheduler],slot);
+}
+
+bool configSnapshot::compile() {
+    File source = LittleFS.open(CONFIGJSONPATH,"r");
+    if (!source) return false;
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc,source);
+    uint32_t sourceSize = source.size();
+    int64_t sourceTime = source.getLastWrite();
+    source.close();
+    if (error || !doc.is<JsonObject>()) return false;
+    JsonObjectConst json = doc.as<JsonObjectConst>();
+
+    memset(&header,0,sizeof(header));
+    header.magic = CONFIGSNAPSHOTMAGIC;
+    header.version = CONFIGSNAPSHOTVERSION;
+    header.settingsSize = sizeof(configSettings);
+    header.slotSize = sizeof(configSlot);
+    header.sourceSize = sourceSize;
+    header.sourceTime = sourceTime;
+    compileSettings(json,&settings);
+
+    // Scheduler entries go in order of start time (those without a valid time last), so the active one can be found
+    // from the times in the header
+    JsonArrayConst scheduler = json["scheduler"];
+    JsonArrayConst carousel = json["carousel"];
+    uint8_t order[CONFIGMAXSLOTS];
+    header.numScheduler = min((int)scheduler.size(),CONFIGMAXSLOTS);
+    header.numCarousel = min((int)carousel.size(),CONFIGMAXSLOTS);
+    for (int i=0;i<header.numScheduler;i++) {
+        order[i] = i;
+        header.schedulerTimes[i] = parseTime(scheduler[i]["time"]);
+    }
+    std::stable_sort(order,order+header.numScheduler,[this](uint8_t a, uint8_t b) { return header.schedulerTimes[a] < header.schedulerTimes[b]; });
+    std::sort(header.schedulerTimes,header.schedulerTimes+header.numScheduler);
+
+    // The slots are compiled twice, first for the hash that goes in the header and then to write them
+    configSlot slot;
+    uint32_t hash = hashBytes(2166136261UL,(const uint8_t *)header.schedulerTimes,sizeof(header.schedulerTimes));
+    int numSlots = 1 + header.numScheduler + header.numCarousel;
+    for (int i=0;i<numSlots;i++) {
+        compileEntry(json,scheduler,carousel,order,i,&slot);
+        hash = hashBytes(hash,(const uint8_t *)&slot,sizeof(slot));
+    }
+    header.slotsHash = hash;
+
+    File f = LittleFS.open(CONFIGTEMPPATH,"w");
+    if (!f) return false;
+    bool ok = f.write((const uint8_t *)&header,sizeof(header)) == sizeof(header);
+    ok = ok && f.write((const uint8_t *)&settings,sizeof(settings)) == sizeof(settings);
+    for (int i=0;ok && i<numSlots;i++) {
+        compileEntry(json,scheduler,carousel,order,i,&slot);
+        ok = f.write((const uint8_t *)&slot,sizeof(slot)) == sizeof(slot);
+    }
+    f.close();
+    if (!ok || !LittleFS.rename(CONFIGTEMPPATH,CONFIGSNAPSHOTPATH)) {
+        LittleFS.remove(CONFIGTEMPPATH);
+        return false;
+    }
+    return true;
+}
+
+bool configSnapshot::load() {
+    File source = LittleFS.open(CONFIGJSONPATH,"r");
+    if (!source) return false;
+    uint32_t sourceSize = source.size();
+    int64_t sourceTime = source.getLastWrite();
+    source.close();
+
+    File f = LittleFS.open(CONFIGSNAPSHOTPATH,"r");
+    bool current = f && f.read((uint8_t *)&header,sizeof(header)) == sizeof(header)
+        && header.magic == CONFIGSNAPSHOTMAGIC && header.version == CONFIGSNAPSHOTVERSION
+        && header.settingsSize == sizeof(configSettings) && header.slotSize == sizeof(configSlot)
+        && header.sourceSize == sourceSize && header.sourceTime == sourceTime
+        && f.read((uint8_t *)&settings,sizeof(settings)) == sizeof(settings);
+    if (f) f.close();
+    return current || compile();
+}
+
+uint8_t configSnapshot::reload() {
+    configSettings previous = settings;
+    uint32_t previousSlots = header.slotsHash;
+    if (!compile()) return IMPACT_TRANSPORT;
+
+    uint8_t impact = (header.slotsHash != previousSlots) ? IMPACT_TRANSPORT : 0;
+    for (int i=0;i<=CFG_DATASOURCE;i++) {
+        const settingField &field = settingFields[i];
+        // A setting that has been removed keeps its current value (applySettings() only copies those present,
+        // as a soft reset did), so only new and changed values count
+        if (!settings.has((configSetting)i)) continue;
+        if (!previous.has((configSetting)i) || memcmp((const uint8_t *)&previous + field.offset,(const uint8_t *)&settings + field.offset,field.size)) {
+            impact |= field.impact;
+        }
+    }
+    return impact;
+}
+
+void configSnapshot::invalidate() {
+    LittleFS.remove(CONFIGSNAPSHOTPATH);
+}
+
+bool configSnapshot::readSlot(configSlotTable table, int index, configSlot *slot) {
+    int record = 0;
+    if (table == SLOTS_SCHEDULER) {
+        if (index < 0 || index >= header.numScheduler) return false;
+        record = 1 + index;
+    } else if (table == SLOTS_CAROUSEL) {
+        if (index < 0 || index >= header.numCarousel) return false;
+        record = 1 + header.numScheduler + index;
+    }
+    File f = LittleFS.open(CONFIGSNAPSHOTPATH,"r");
+    if (!f) return false;
+    bool ok = f.seek(sizeof(configHeader) + sizeof(configSettings) + record*sizeof(configSlot)) && f.read((uint8_t *)slot,sizeof(configSlot)) == sizeof(configSlot);
+    f.close();
+    return ok;
+}
+
+int configSnapshot::activeSchedulerSlot(int minutes) const {
+    int active = -1;
+    for (int i=0;i<header.numScheduler && header.schedulerTimes[i] <= minutes;i++) active = i;
+    return active >= 0 ? active : header.numScheduler - 1;
+}
@@ -0,0 +1,200 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * configSnapshot Library - config.json compiled into a fixed layout binary file for fast reloads
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <sharedDataStructs.h>
+#include <serviceTime.h>
+
+#define CONFIGJSONPATH "/config.json"
+#define CONFIGSNAPSHOTPATH "/config.bin"
+#define CONFIGSNAPSHOTVERSION 2
+#define CONFIGMAXSLOTS 32           // Scheduler or carousel entries kept (any more are ignored)
+
+#define CONFIGHOSTNAMESIZE 33
+#define CONFIGWSDLSIZE 48
+#define CONFIGTZSIZE 64
+#define CONFIGRSSURLSIZE 512
+#define CONFIGRSSNAMESIZE 64
+#define CONFIGCODESIZE 13           // CRS, Naptan or Atco code
+#define CONFIGCRSSIZE 4
+#define CONFIGSTATIONSIZE 45
+#define CONFIGLINESIZE 33
+#define CONFIGDIRECTIONSIZE 9
+
+// What a change to the settings affects, combined as bits (see reload())
+#define IMPACT_SETTINGS 0x01        // Nothing visible, the new value is picked up when it's next used
+#define IMPACT_RENDER 0x02          // Redraw the board from the data already held
+#define IMPACT_BOARD 0x04           // Fetch the departures again with the new parameters
+#define IMPACT_WEATHER 0x08
+#define IMPACT_RSS 0x10
+#define IMPACT_TRANSPORT 0x20       // Location, mode, schedule or data source changed (soft reset the board)
+#define IMPACT_REBOOT 0x40          // Only takes effect after a restart
+
+// Common settings, each is a bit in configSettings::present if it was in config.json
+enum configSetting : uint8_t {
+    CFG_HOSTNAME, CFG_WSDLHOST, CFG_WSDLAPI, CFG_SHOWDATE, CFG_SHOWBUS, CFG_SHOWFULLCALLING, CFG_SHOWFULLMSGS,
+    CFG_SLEEP, CFG_DARKSLEEP, CFG_FASTREFRESH, CFG_WEATHER, CFG_UPDATE, CFG_UPDATEDAILY, CFG_SLEEPSTARTS,
+    CFG_SLEEPENDS, CFG_BRIGHTNESS, CFG_NOSCROLL, CFG_FLIP, CFG_TOUCH, CFG_DATAICON, CFG_FORCEWAKETIME, CFG_TZ,
+    CFG_NRTIMEOFFSET, CFG_HIDEPLATFORM, CFG_HIDEORDINALS, CFG_SHOWLASTSEEN, CFG_SHOWTUBELOCATION,
+    CFG_SHOWSERVICEMSGS, CFG_ENABLESCHEDULER, CFG_ENABLECAROUSEL, CFG_RSSURL, CFG_RSSNAME, CFG_RSSPRIORITY,
+    CFG_MODE, CFG_DATASOURCE
+};
+
+// Location settings of the default board or a scheduler/carousel entry, bits in configSlot::present
+enum configSlotField : uint8_t {
+    SLOT_MODE, SLOT_DURATION, SLOT_CRS, SLOT_PLATFORMFILTER, SLOT_CALLINGCRS, SLOT_CALLINGSTATION, SLOT_LAT,
+    SLOT_LON, SLOT_TUBEID, SLOT_LINEID, SLOT_DIRECTION, SLOT_TUBENAME, SLOT_TUBELAT, SLOT_TUBELON, SLOT_NAME,
+    SLOT_BUSID, SLOT_BUSFILTER, SLOT_BUSNAME, SLOT_BUSLAT, SLOT_BUSLON
+};
+
+struct configSettings {
+    uint64_t present;
+    bool railSet;               // A location has been chosen for each mode
+    bool tubeSet;
+    bool busSet;
+    char hostname[CONFIGHOSTNAMESIZE];
+    char wsdlHost[CONFIGWSDLSIZE];
+    char wsdlAPI[CONFIGWSDLSIZE];
+    bool showDate;
+    bool showBus;
+    bool showFullCalling;
+    bool showFullMsgs;
+    bool sleep;
+    bool darkSleep;
+    bool fastRefresh;
+    bool weather;
+    bool update;
+    bool updateDaily;
+    bool noScroll;
+    bool flip;
+    bool touch;
+    bool dataIcon;
+    bool hidePlatform;
+    bool hideOrdinals;
+    bool showLastSeen;
+    bool showTubeLocation;
+    bool showServiceMsgs;
+    bool enableScheduler;
+    bool enableCarousel;
+    bool rssPriority;
+    int32_t sleepStarts;
+    int32_t sleepEnds;
+    int32_t brightness;
+    int32_t forceWakeTime;
+    int32_t nrTimeOffset;
+    int32_t mode;               // Including the legacy v1.x "tube" setting
+    int32_t dataSource;
+    char timezone[CONFIGTZSIZE];
+    char rssUrl[CONFIGRSSURLSIZE];
+    char rssName[CONFIGRSSNAMESIZE];
+
+    bool has(configSetting setting) const {
+        return present & (1ULL << setting);
+    }
+};
+
+struct configSlot {
+    uint32_t present;
+    int32_t mode;
+    int32_t duration;           // Carousel minutes
+    char crs[CONFIGCODESIZE];
+    char platformFilter[MAXFILTERSIZE];
+    char callingCrs[CONFIGCRSSIZE];
+    char callingStation[CONFIGSTATIONSIZE];
+    char tubeId[CONFIGCODESIZE];
+    char lineId[CONFIGLINESIZE];
+    char direction[CONFIGDIRECTIONSIZE];
+    char busId[CONFIGCODESIZE];
+    char busFilter[MAXFILTERSIZE];
+    char name[MAXLOCATIONSIZE];
+    char tubeName[MAXLOCATIONSIZE];
+    char busName[MAXLOCATIONSIZE];
+    float lat;
+    float lon;
+    float tubeLat;
+    float tubeLon;
+    float busLat;
+    float busLon;
+
+    bool has(configSlotField field) const {
+        return present & (1UL << field);
+    }
+};
+
+enum configSlotTable : uint8_t {
+    SLOTS_DEFAULT,              // The settings for the board when there's no scheduler or carousel
+    SLOTS_SCHEDULER,
+    SLOTS_CAROUSEL
+};
+
+struct configHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t settingsSize;
+    uint16_t slotSize;
+    uint8_t numScheduler;
+    uint8_t numCarousel;
+    uint32_t sourceSize;        // Size and modification time of the config.json this was compiled from
+    int64_t sourceTime;
+    uint32_t slotsHash;         // Hash of all the slot records, so changes to any of them can be spotted
+    uint16_t schedulerTimes[CONFIGMAXSLOTS];    // Start of each scheduler entry (minutes since midnight), in order
+};
+
+//
+// config.json is parsed once, when it changes, into a file of fixed size records: the header and common
+// settings, then the default board, the scheduler entries sorted by time and the carousel entries. Reloading
+// the settings reads the header and settings, and changing slot reads just that entry, so there's no JSON
+// parsing (or heap use) when the board is switched.
+//
+class configSnapshot {
+
+    private:
+        configHeader header;
+
+    public:
+        configSettings settings;
+
+        // Compile config.json. Returns false if it's missing or isn't valid JSON.
+        bool compile();
+
+        // Read the header and settings, compiling config.json first if it's changed since the snapshot was made.
+        // Returns false if there's no usable configuration.
+        bool load();
+
+        // Compile config.json again after it's been saved and return the IMPACT_ bits of what has changed since
+        // the last load() or reload(). Settings that are no longer present aren't counted. A missing or invalid
+        // config.json counts as IMPACT_TRANSPORT.
+        uint8_t reload();
+
+        // Remove the snapshot so the next load() compiles config.json again (call when config.json is written)
+        void invalidate();
+
+        // Read one entry (index is ignored for SLOTS_DEFAULT)
+        bool readSlot(configSlotTable table, int index, configSlot *slot);
+
+        int schedulerSlots() const {
+            return header.numScheduler;
+        }
+
+        int carouselSlots() const {
+            return header.numCarousel;
+        }
+
+        // Index of the scheduler entry active at a time of day (minutes since midnight). Before the first entry
+        // of the day it's the last one, carried over from the day before.
+        int activeSchedulerSlot(int minutes) const;
+
+        // Start time of a scheduler entry (minutes since midnight), NOTIME if it doesn't have a valid time
+        uint16_t schedulerTime(int index) const {
+            return (index >= 0 && index < header.numScheduler) ? header.schedulerTimes[index] : NOTIME;
+        }
+};
@@ -0,0 +1,198 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * dmaDisplay Library - SSD1322 256x64 OLED driven by queued DMA SPI transfers
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <dmaDisplay.h>
+#include <hal/gpio_ll.h>
+
+dmaDisplay *dmaDisplay::instance = nullptr;
+static int dcPin = -1;
+
+// Runs from the SPI interrupt before each transaction, so the D/C line is set directly
+static void IRAM_ATTR setDC(spi_transaction_t *t) {
+    gpio_ll_set_level(&GPIO,(gpio_num_t)dcPin,(uint32_t)(uintptr_t)t->user);
+}
+
+dmaDisplay::dmaDisplay(const u8g2_cb_t *rotation, uint8_t cs, uint8_t dc, uint8_t reset) : U8G2() {
+    instance = this;
+    u8g2_Setup_ssd1322_nhd_256x64_f(&u8g2,rotation,byteCallback,u8x8_gpio_and_delay_arduino);
+    u8x8_SetPin_4Wire_HW_SPI(getU8x8(),cs,dc,reset);
+}
+
+// u8g2 byte level interface. Everything u8g2 sends itself goes through here once the queue has emptied.
+uint8_t dmaDisplay::byteCallback(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+    switch (msg) {
+        case U8X8_MSG_BYTE_INIT:
+            instance->begin(u8x8);
+            break;
+
+        case U8X8_MSG_BYTE_SET_DC:
+            instance->dcLevel = arg_int;
+            break;
+
+        case U8X8_MSG_BYTE_START_TRANSFER:
+            instance->waitForIdle();
+            break;
+
+        case U8X8_MSG_BYTE_SEND:
+            instance->sendNow((const uint8_t *)arg_ptr,arg_int);
+            break;
+
+        case U8X8_MSG_BYTE_END_TRANSFER:
+            break;
+
+        default:
+            return 0;
+    }
+    return 1;
+}
+
+void dmaDisplay::begin(u8x8_t *u8x8) {
+    if (spi) return;
+    dcPin = u8x8->pins[U8X8_PIN_DC];
+
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = MOSI;
+    bus.miso_io_num = -1;
+    bus.sclk_io_num = SCK;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = DISPLAYDMABUFFERSIZE;
+    if (spi_bus_initialize(SPI3_HOST,&bus,SPI_DMA_CH_AUTO) != ESP_OK) return;
+
+    spi_device_interface_config_t device = {};
+    device.clock_speed_hz = u8x8->bus_clock;
+    device.mode = u8x8->display_info->spi_mode;
+    device.spics_io_num = u8x8->pins[U8X8_PIN_CS];
+    device.queue_size = DISPLAYDMAQUEUE;
+    device.pre_cb = setDC;
+    if (spi_bus_add_device(SPI3_HOST,&device,&spi) != ESP_OK) {
+        spi = nullptr;
+        return;
+    }
+
+    // Without both transfer buffers, areas are sent by u8g2 instead
+    for (int i=0;i<2;i++) buffers[i] = (uint8_t *)heap_caps_malloc(DISPLAYDMABUFFERSIZE,MALLOC_CAP_DMA);
+    if (!buffers[0] || !buffers[1]) {
+        for (int i=0;i<2;i++) {
+            heap_caps_free(buffers[i]);
+            buffers[i] = nullptr;
+        }
+    }
+}
+
+// Transactions complete in the order they were queued, so counting results is enough to know what's been sent
+void dmaDisplay::waitFor(uint32_t count) {
+    spi_transaction_t *done;
+    while (completed < count) {
+        if (spi_device_get_trans_result(spi,&done,portMAX_DELAY) != ESP_OK) return;
+        completed++;
+    }
+}
+
+spi_transaction_t *dmaDisplay::nextTransaction() {
+    if (queued - completed >= DISPLAYDMAQUEUE) waitFor(queued - DISPLAYDMAQUEUE + 1);
+    spi_transaction_t *t = &transactions[queued % DISPLAYDMAQUEUE];
+    memset(t,0,sizeof(spi_transaction_t));
+    return t;
+}
+
+void dmaDisplay::queueTransfer(const uint8_t *data, int length, uint8_t level) {
+    spi_transaction_t *t = nextTransaction();
+    t->length = length*8;
+    t->user = (void *)(uintptr_t)level;
+    if (length <= 4) {
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data,data,length);
+    } else {
+        t->tx_buffer = data;
+    }
+    spi_device_queue_trans(spi,t,portMAX_DELAY);
+    queued++;
+}
+
+void dmaDisplay::queueCommand(uint8_t command, uint8_t arg0, uint8_t arg1) {
+    uint8_t args[2] = {arg0,arg1};
+    queueTransfer(&command,1,0);
+    queueTransfer(args,2,1);
+}
+
+// Space in a transfer buffer. When the current one is full the other is used, once it has been sent.
+uint8_t *dmaDisplay::reserve(int size) {
+    if (used + size > DISPLAYDMABUFFERSIZE) {
+        current = 1 - current;
+        used = 0;
+        waitFor(bufferDone[current]);
+    }
+    uint8_t *p = buffers[current] + used;
+    used += size;
+    return p;
+}
+
+// Convert tiles from the frame buffer (8 vertical pixels per byte) to the SSD1322's 4 bits per pixel, left
+// to right and top to bottom. This is the same conversion u8g2 does for each tile.
+void dmaDisplay::expand(uint8_t *dest, int tx, int ty, int tw, int th) {
+    const uint8_t *frame = getBufferPtr();
+    int frameWidth = getBufferTileWidth()*8;
+    for (int row=0;row<th*8;row++) {
+        const uint8_t *src = frame + (ty+row/8)*frameWidth + tx*8;
+        uint8_t bit = 1 << (row & 7);
+        for (int x=0;x<tw*8;x+=2) {
+            *dest++ = ((src[x] & bit) ? 0xF0 : 0) | ((src[x+1] & bit) ? 0x0F : 0);
+        }
+    }
+}
+
+void dmaDisplay::sendNow(const uint8_t *data, int length) {
+    if (!spi || !length) return;
+    spi_transaction_t t = {};
+    t.length = length*8;
+    t.user = (void *)(uintptr_t)dcLevel;
+    if (length <= 4) {
+        t.flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t.tx_data,data,length);
+    } else {
+        t.tx_buffer = data;
+    }
+    spi_device_polling_transmit(spi,&t);
+}
+
+void dmaDisplay::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+    int tileWidth = getBufferTileWidth();
+    int tileHeight = getBufferTileHeight();
+    if (tx >= tileWidth || ty >= tileHeight) return;
+    if (tx+tw > tileWidth) tw = tileWidth-tx;
+    if (ty+th > tileHeight) th = tileHeight-ty;
+    if (!tw || !th) return;
+    if (!spi || !buffers[0]) {
+        U8G2::updateDisplayArea(tx,ty,tw,th);
+        return;
+    }
+
+    u8x8_t *u8x8 = getU8x8();
+    int rowBytes = tw*32;     // A row of tiles at 4 bits per pixel
+    while (th) {
+        int rows = min((int)th,DISPLAYDMABUFFERSIZE/rowBytes);
+        int size = rows*rowBytes;
+        uint8_t *data = reserve(size);
+        expand(data,tx,ty,tw,rows);
+
+        // Set the window and write the whole area in one transfer. Each column address covers 4 pixels.
+        queueCommand(0x15,tx*2+u8x8->x_offset,(tx+tw)*2-1+u8x8->x_offset);
+        queueCommand(0x75,ty*8,(ty+rows)*8-1);
+        uint8_t write = 0x5C;
+        queueTransfer(&write,1,0);
+        queueTransfer(data,size,1);
+        bufferDone[current] = queued;
+
+        ty += rows;
+        th -= rows;
+    }
+}
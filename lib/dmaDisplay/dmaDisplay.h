@@ -0,0 +1,63 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * dmaDisplay Library - SSD1322 256x64 OLED driven by queued DMA SPI transfers
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include <driver/spi_master.h>
+
+#define DISPLAYDMABUFFERSIZE 4096   // Size of each of the two transfer buffers (bytes of 4 bit pixels)
+#define DISPLAYDMAQUEUE 48          // SPI transactions that can be queued at once
+
+//
+// A drop in replacement for U8G2_SSD1322_NHD_256X64_F_4W_HW_SPI. updateDisplayArea() converts the area to
+// the display's 4 bit pixel format in one of two transfer buffers, queues it and returns straight away, so the
+// next frame can be drawn while the previous one is still being sent. A transfer buffer is only waited on
+// when it's needed again. Everything else u8g2 sends (sendBuffer, contrast, power save...) waits for the
+// queue to empty and is then sent as before.
+//
+class dmaDisplay : public U8G2 {
+
+    private:
+        spi_device_handle_t spi = nullptr;
+        uint8_t *buffers[2] = {nullptr,nullptr};
+        int current = 0;                        // Transfer buffer being filled
+        int used = 0;                           // Bytes used in the current transfer buffer
+        uint32_t bufferDone[2] = {0,0};         // Transactions that must complete before each buffer is free
+        spi_transaction_t transactions[DISPLAYDMAQUEUE];
+        uint32_t queued = 0;                    // Transactions queued so far
+        uint32_t completed = 0;                 // Transactions known to have completed
+        uint8_t dcLevel = 0;                    // Data/command level for u8g2's own transfers
+
+        static dmaDisplay *instance;
+        static uint8_t byteCallback(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+
+        void begin(u8x8_t *u8x8);
+        void collect(bool wait);
+        void waitFor(uint32_t count);
+        spi_transaction_t *nextTransaction();
+        void queueTransfer(const uint8_t *data, int length, uint8_t level);
+        void queueCommand(uint8_t command, uint8_t arg0, uint8_t arg1);
+        uint8_t *reserve(int size);
+        void expand(uint8_t *dest, int tx, int ty, int tw, int th);
+        void sendNow(const uint8_t *data, int length);
+
+    public:
+        dmaDisplay(const u8g2_cb_t *rotation, uint8_t cs, uint8_t dc, uint8_t reset = U8X8_PIN_NONE);
+
+        // Queue tiles to be sent (tile units, as u8g2 updateDisplayArea)
+        void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+
+        // Wait until everything queued has been sent
+        void waitForIdle() {
+            waitFor(queued);
+        }
+};
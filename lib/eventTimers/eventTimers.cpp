@@ -0,0 +1,101 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * eventTimers Library - millis() deadlines for the periodic work in loop(), dispatched as callbacks
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <eventTimers.h>
+
+// Called with the lock held
+void eventTimers::updateNextDue() {
+    anyScheduled = false;
+    uint32_t now = millis();
+    int32_t earliest = 0;
+    for (int i=0;i<MAXEVENTTIMERS;i++) {
+        if (!events[i].scheduled) continue;
+        int32_t wait = (int32_t)(events[i].due - now);
+        if (!anyScheduled || wait < earliest) {
+            earliest = wait;
+            nextDue = events[i].due;
+            anyScheduled = true;
+        }
+    }
+}
+
+void eventTimers::attach(int id, timerCallback callback) {
+    if (id < 0 || id >= MAXEVENTTIMERS) return;
+    portENTER_CRITICAL(&lock);
+    events[id].callback = callback;
+    portEXIT_CRITICAL(&lock);
+}
+
+void eventTimers::schedule(int id, uint32_t ms) {
+    if (id < 0 || id >= MAXEVENTTIMERS) return;
+    portENTER_CRITICAL(&lock);
+    events[id].due = millis() + ms;
+    events[id].scheduled = true;
+    updateNextDue();
+    portEXIT_CRITICAL(&lock);
+}
+
+void eventTimers::postpone(int id, uint32_t ms) {
+    if (id < 0 || id >= MAXEVENTTIMERS) return;
+    portENTER_CRITICAL(&lock);
+    events[id].due = (events[id].scheduled ? events[id].due : millis()) + ms;
+    events[id].scheduled = true;
+    updateNextDue();
+    portEXIT_CRITICAL(&lock);
+}
+
+void eventTimers::cancel(int id) {
+    if (id < 0 || id >= MAXEVENTTIMERS) return;
+    portENTER_CRITICAL(&lock);
+    events[id].scheduled = false;
+    updateNextDue();
+    portEXIT_CRITICAL(&lock);
+}
+
+int32_t eventTimers::remaining(int id) const {
+    if (!isScheduled(id)) return -1;
+    portENTER_CRITICAL(&lock);
+    uint32_t due = events[id].due;
+    portEXIT_CRITICAL(&lock);
+    int32_t wait = (int32_t)(due - millis());
+    return wait > 0 ? wait : 0;
+}
+
+void eventTimers::run() {
+    // nextDue and anyScheduled are written from both cores, so they're only read under the lock
+    portENTER_CRITICAL(&lock);
+    bool due = anyScheduled && timeReached(nextDue);
+    portEXIT_CRITICAL(&lock);
+    if (!due) return;
+    // Each due timer is unscheduled before its callback is called, so the callback can schedule it again
+    for (int i=0;i<MAXEVENTTIMERS;i++) {
+        timerCallback callback = nullptr;
+        portENTER_CRITICAL(&lock);
+        if (events[i].scheduled && timeReached(events[i].due)) {
+            events[i].scheduled = false;
+            callback = events[i].callback;
+            updateNextDue();
+        }
+        portEXIT_CRITICAL(&lock);
+        if (callback) callback();
+    }
+}
+
+uint32_t eventTimers::idleTime(uint32_t limit) const {
+    portENTER_CRITICAL(&lock);
+    bool scheduled = anyScheduled;
+    uint32_t due = nextDue;
+    portEXIT_CRITICAL(&lock);
+    if (!scheduled) return limit;
+    int32_t wait = (int32_t)(due - millis());
+    if (wait <= 0) return 0;
+    return ((uint32_t)wait < limit) ? wait : limit;
+}
@@ -0,0 +1,75 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * eventTimers Library - millis() deadlines for the periodic work in loop(), dispatched as callbacks
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#define MAXEVENTTIMERS 8
+
+// True once the deadline has been reached. Compares the difference so it still works when millis() wraps
+// (after 49 days), as long as deadlines are less than 24 days ahead.
+inline bool timeReached(uint32_t deadline, uint32_t now) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+inline bool timeReached(uint32_t deadline) {
+    return timeReached(deadline,millis());
+}
+
+typedef void (*timerCallback)();
+
+//
+// A fixed set of one-shot timers, each with a callback that's called from run() once it's due. Callbacks
+// reschedule themselves for periodic work. The earliest deadline is kept so run() is a single comparison
+// when nothing is due, and idleTime() gives how long loop() can sleep for. Timers can be scheduled from
+// the fetch task on the other core.
+//
+class eventTimers {
+
+    private:
+        struct timerEvent {
+            timerCallback callback;
+            uint32_t due;
+            bool scheduled;
+        };
+
+        timerEvent events[MAXEVENTTIMERS] = {};
+        uint32_t nextDue = 0;
+        bool anyScheduled = false;
+        mutable portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+        void updateNextDue();
+
+    public:
+        // Set the callback for a timer id (0 to MAXEVENTTIMERS-1). It isn't scheduled until schedule() is called.
+        void attach(int id, timerCallback callback);
+
+        // Call the timer's callback in ms milliseconds (0 for the next run), replacing any earlier schedule
+        void schedule(int id, uint32_t ms);
+
+        // Push a scheduled timer back by ms (or schedule it ms from now if it isn't scheduled)
+        void postpone(int id, uint32_t ms);
+
+        void cancel(int id);
+
+        bool isScheduled(int id) const {
+            return id >= 0 && id < MAXEVENTTIMERS && events[id].scheduled;
+        }
+
+        // Milliseconds until the timer is due (0 if it's due now, -1 if it isn't scheduled)
+        int32_t remaining(int id) const;
+
+        // Call the callbacks of the timers that are due
+        void run();
+
+        // Milliseconds until the next timer is due, at most limit
+        uint32_t idleTime(uint32_t limit) const;
+};
@@ -0,0 +1,148 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * fetchMetrics Library - fixed size counters and latency histograms for the data fetches
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <fetchMetrics.h>
+
+fetchMetrics fetchStats;
+
+// Upper bounds of the latency buckets in milliseconds
+static const uint32_t bucketBounds[METRICBUCKETS-1] = {50,100,250,500,1000,2500,5000,10000};
+
+static const char *upstreamNames[MAXUPSTREAMS] = {"darwin","rdm","tfl","bus","weather","rss","github"};
+static const char *phaseNames[MAXPHASES] = {"connect","wait","body","process","total"};
+static const char *resultNames[METRICRESULTCODES] = {"success","incomplete","unauthorised","http_error","timeout","no_response","data_error","no_change","sec_change"};
+
+void latencyHistogram::add(uint32_t ms) {
+    int b = 0;
+    while (b < METRICBUCKETS-1 && ms > bucketBounds[b]) b++;
+    bucket[b] = bucket[b] + 1;
+    count = count + 1;
+    sumMs = sumMs + ms;
+}
+
+void fetchMetrics::recordPhase(fetchUpstream u, fetchPhase phase, uint32_t ms) {
+    if (u >= MAXUPSTREAMS || phase >= MAXPHASES) return;
+    upstream[u].phase[phase].add(ms);
+}
+
+void fetchMetrics::recordFetch(fetchUpstream u, uint32_t bytes, uint32_t freeStack) {
+    if (u >= MAXUPSTREAMS) return;
+    upstream[u].bytes = upstream[u].bytes + bytes;
+    if (!upstream[u].minStack || freeStack < upstream[u].minStack) upstream[u].minStack = freeStack;
+}
+
+void fetchMetrics::countResult(fetchUpstream u, int resultCode) {
+    if (u >= MAXUPSTREAMS || resultCode < 0 || resultCode >= METRICRESULTCODES) return;
+    upstream[u].results[resultCode] = upstream[u].results[resultCode] + 1;
+}
+
+// Upstreams that have never been used are left out
+bool fetchMetrics::used(int u) const {
+    if (upstream[u].phase[PHASE_TOTAL].count) return true;
+    for (int r=0;r<METRICRESULTCODES;r++) {
+        if (upstream[u].results[r]) return true;
+    }
+    return false;
+}
+
+void fetchMetrics::writeJson(Print &out, const systemGauges &gauges) const {
+    out.printf("{\"uptime\":%u,\"heap\":{\"free\":%u,\"minFree\":%u,\"largestBlock\":%u},",gauges.uptime,gauges.freeHeap,gauges.minFreeHeap,gauges.largestBlock);
+    out.printf("\"stack\":{\"fetchTask\":%u,\"loopTask\":%u},",gauges.fetchStack,gauges.loopStack);
+    out.printf("\"render\":{\"frames\":%u,\"overruns\":%u,\"worstFrameUs\":%u,\"averageJitterUs\":%u,\"worstJitterUs\":%u},",gauges.frames,gauges.overruns,gauges.worstFrameTime,gauges.averageJitter,gauges.worstJitter);
+    out.print("\"upstreams\":{");
+    bool first = true;
+    for (int u=0;u<MAXUPSTREAMS;u++) {
+        if (!used(u)) continue;
+        const upstreamMetrics &m = upstream[u];
+        out.printf("%s\"%s\":{\"bytes\":%u,\"minStack\":%u,\"results\":{",first?"":",",upstreamNames[u],m.bytes,m.minStack);
+        first = false;
+        for (int r=0;r<METRICRESULTCODES;r++) out.printf("%s\"%s\":%u",r?",":"",resultNames[r],m.results[r]);
+        out.print("},\"latencyMs\":{");
+        for (int p=0;p<MAXPHASES;p++) {
+            const latencyHistogram &h = m.phase[p];
+            out.printf("%s\"%s\":{\"count\":%u,\"sum\":%u,\"buckets\":[",p?",":"",phaseNames[p],h.count,h.sumMs);
+            for (int b=0;b<METRICBUCKETS;b++) out.printf("%s%u",b?",":"",h.bucket[b]);
+            out.print("]}");
+        }
+        out.print("}}");
+    }
+    out.print("},\"bucketBoundsMs\":[");
+    for (int b=0;b<METRICBUCKETS-1;b++) out.printf("%s%u",b?",":"",bucketBounds[b]);
+    out.print("]}");
+}
+
+void fetchMetrics::writePrometheus(Print &out, const systemGauges &gauges) const {
+    out.printf("# TYPE departures_uptime_seconds gauge\ndepartures_uptime_seconds %u\n",gauges.uptime);
+    out.printf("# TYPE departures_heap_free_bytes gauge\ndepartures_heap_free_bytes %u\n",gauges.freeHeap);
+    out.printf("# TYPE departures_heap_min_free_bytes gauge\ndepartures_heap_min_free_bytes %u\n",gauges.minFreeHeap);
+    out.printf("# TYPE departures_heap_largest_block_bytes gauge\ndepartures_heap_largest_block_bytes %u\n",gauges.largestBlock);
+    out.printf("# TYPE departures_stack_free_bytes gauge\ndepartures_stack_free_bytes{task=\"fetch\"} %u\ndepartures_stack_free_bytes{task=\"loop\"} %u\n",gauges.fetchStack,gauges.loopStack);
+    out.printf("# TYPE departures_frames_total counter\ndepartures_frames_total %u\n",gauges.frames);
+    out.printf("# TYPE departures_frame_overruns_total counter\ndepartures_frame_overruns_total %u\n",gauges.overruns);
+    out.printf("# TYPE departures_frame_worst_microseconds gauge\ndepartures_frame_worst_microseconds %u\n",gauges.worstFrameTime);
+    out.printf("# TYPE departures_frame_jitter_microseconds gauge\ndepartures_frame_jitter_microseconds{stat=\"average\"} %u\ndepartures_frame_jitter_microseconds{stat=\"worst\"} %u\n",gauges.averageJitter,gauges.worstJitter);
+
+    out.print("# TYPE departures_fetch_bytes_total counter\n");
+    for (int u=0;u<MAXUPSTREAMS;u++) {
+        if (used(u)) out.printf("departures_fetch_bytes_total{upstream=\"%s\"} %u\n",upstreamNames[u],upstream[u].bytes);
+    }
+    out.print("# TYPE departures_fetch_stack_min_free_bytes gauge\n");
+    for (int u=0;u<MAXUPSTREAMS;u++) {
+        if (used(u)) out.printf("departures_fetch_stack_min_free_bytes{upstream=\"%s\"} %u\n",upstreamNames[u],upstream[u].minStack);
+    }
+    out.print("# TYPE departures_fetch_results_total counter\n");
+    for (int u=0;u<MAXUPSTREAMS;u++) {
+        if (!used(u)) continue;
+        for (int r=0;r<METRICRESULTCODES;r++) out.printf("departures_fetch_results_total{upstream=\"%s\",result=\"%s\"} %u\n",upstreamNames[u],resultNames[r],upstream[u].results[r]);
+    }
+    out.print("# TYPE departures_fetch_duration_milliseconds histogram\n");
+    for (int u=0;u<MAXUPSTREAMS;u++) {
+        if (!used(u)) continue;
+        for (int p=0;p<MAXPHASES;p++) {
+            const latencyHistogram &h = upstream[u].phase[p];
+            // Prometheus buckets are cumulative
+            uint32_t total = 0;
+            for (int b=0;b<METRICBUCKETS;b++) {
+                total += h.bucket[b];
+                if (b < METRICBUCKETS-1) out.printf("departures_fetch_duration_milliseconds_bucket{upstream=\"%s\",phase=\"%s\",le=\"%u\"} %u\n",upstreamNames[u],phaseNames[p],bucketBounds[b],total);
+                else out.printf("departures_fetch_duration_milliseconds_bucket{upstream=\"%s\",phase=\"%s\",le=\"+Inf\"} %u\n",upstreamNames[u],phaseNames[p],total);
+            }
+            out.printf("departures_fetch_duration_milliseconds_sum{upstream=\"%s\",phase=\"%s\"} %u\n",upstreamNames[u],phaseNames[p],h.sumMs);
+            out.printf("departures_fetch_duration_milliseconds_count{upstream=\"%s\",phase=\"%s\"} %u\n",upstreamNames[u],phaseNames[p],h.count);
+        }
+    }
+}
+
+fetchTrace::fetchTrace(fetchUpstream u) : upstream(u) {
+    start = millis();
+    last = start;
+    lastUs = micros();
+}
+
+fetchTrace::~fetchTrace() {
+    phaseMs[PHASE_TOTAL] = millis() - start;
+    marked |= 1 << PHASE_TOTAL;
+    for (int p=0;p<MAXPHASES;p++) {
+        if (marked & (1 << p)) fetchStats.recordPhase(upstream,(fetchPhase)p,phaseMs[p]);
+    }
+    fetchStats.recordFetch(upstream,bytes,uxTaskGetStackHighWaterMark(NULL));
+}
+
+void fetchTrace::mark(fetchPhase phase) {
+    unsigned long now = millis();
+    phaseMs[phase] += now - last;
+    marked |= 1 << phase;
+    last = now;
+    // Each phase also goes into the span trace, under the upstream's name
+    uint32_t nowUs = micros();
+    spanLog.record(phaseNames[phase],upstreamNames[upstream],lastUs,nowUs);
+    lastUs = nowUs;
+}
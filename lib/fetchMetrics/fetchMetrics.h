@@ -0,0 +1,120 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * fetchMetrics Library - fixed size counters and latency histograms for the data fetches
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <spanTrace.h>
+
+#define METRICBUCKETS 9         // Latency buckets, the last one catches everything over the largest bound
+#define METRICRESULTCODES 9     // UPD_SUCCESS to UPD_SEC_CHANGE
+
+enum fetchUpstream : uint8_t {
+    UPSTREAM_DARWIN,
+    UPSTREAM_RDM,
+    UPSTREAM_TFL,
+    UPSTREAM_BUS,
+    UPSTREAM_WEATHER,
+    UPSTREAM_RSS,
+    UPSTREAM_GITHUB,
+    MAXUPSTREAMS
+};
+
+// The TLS handshake is done inside WiFiClientSecure::connect(), so it's counted as part of connecting.
+// Body includes the streaming parse, which runs as the data arrives.
+enum fetchPhase : uint8_t {
+    PHASE_CONNECT,      // TCP and TLS
+    PHASE_WAIT,         // Request sent until the first byte of the response (TTFB)
+    PHASE_BODY,         // Headers and body received and parsed
+    PHASE_PROCESS,      // Building the board after the data has been read
+    PHASE_TOTAL,
+    MAXPHASES
+};
+
+struct latencyHistogram {
+    volatile uint32_t bucket[METRICBUCKETS];
+    volatile uint32_t count;
+    volatile uint32_t sumMs;
+
+    void add(uint32_t ms);
+};
+
+struct upstreamMetrics {
+    latencyHistogram phase[MAXPHASES];
+    volatile uint32_t bytes;
+    volatile uint32_t results[METRICRESULTCODES];
+    volatile uint32_t minStack;     // Lowest free stack (bytes) seen at the end of a fetch, 0 if none yet
+};
+
+// Values read at the time of the request, rather than counted
+struct systemGauges {
+    uint32_t uptime;            // Seconds
+    uint32_t freeHeap;
+    uint32_t minFreeHeap;
+    uint32_t largestBlock;
+    uint32_t fetchStack;        // Free stack (bytes) of the fetch task
+    uint32_t loopStack;
+    uint32_t frames;
+    uint32_t overruns;
+    uint32_t worstFrameTime;    // Microseconds
+    uint32_t averageJitter;
+    uint32_t worstJitter;
+};
+
+//
+// Everything is fixed size and each counter only has one writer at a time, so updates are plain 32 bit stores
+// with no locking. Most fetches run on the fetch task, but setup(), soft resets and manual update checks fetch
+// from loop(). Those only start once fetchInProgress is clear, so the two never write at once. A reader on
+// another task may see one fetch's counters part way through being updated, which doesn't matter for monitoring.
+//
+class fetchMetrics {
+
+    private:
+        upstreamMetrics upstream[MAXUPSTREAMS] = {};
+
+        bool used(int u) const;
+
+    public:
+        void recordPhase(fetchUpstream u, fetchPhase phase, uint32_t ms);
+        void recordFetch(fetchUpstream u, uint32_t bytes, uint32_t freeStack);
+        void countResult(fetchUpstream u, int resultCode);
+
+        void writeJson(Print &out, const systemGauges &gauges) const;
+        void writePrometheus(Print &out, const systemGauges &gauges) const;
+};
+
+extern fetchMetrics fetchStats;
+
+//
+// Times the phases of a single fetch. Create one at the start of the fetch and call mark() as each phase ends,
+// the time since the previous mark is added to that phase and recorded as a span. Everything else is recorded
+// when it goes out of scope, so early returns are still counted.
+//
+class fetchTrace {
+
+    private:
+        fetchUpstream upstream;
+        unsigned long start;
+        unsigned long last;
+        uint32_t lastUs;
+        uint32_t phaseMs[MAXPHASES] = {};
+        uint8_t marked = 0;
+        uint32_t bytes = 0;
+
+    public:
+        fetchTrace(fetchUpstream u);
+        ~fetchTrace();
+
+        void mark(fetchPhase phase);
+
+        void setBytes(uint32_t received) {
+            bytes = received;
+        }
+};
@@ -0,0 +1,86 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * frameMirror Library - encodes display frame changes for the web live view
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <frameMirror.h>
+
+#define MIRRORHEADER 33   // Type byte and tile map
+
+void frameMirror::setRate(int fps) {
+    if (fps < 1) fps = 1;
+    if (fps > MIRRORMAXRATE) fps = MIRRORMAXRATE;
+    rate = fps;
+}
+
+bool frameMirror::isDue() {
+    unsigned long now = millis();
+    if ((long)(now - nextFrame) < 0) return false;
+    // Top up the data allowance for the time that's passed
+    budget += (long)((uint64_t)(now - lastRefill) * MIRRORBYTESPERSEC / 1000);
+    if (budget > MIRRORBYTESPERSEC) budget = MIRRORBYTESPERSEC;
+    lastRefill = now;
+    if (budget <= 0) return false;
+    nextFrame = now + 1000 / rate;
+    return true;
+}
+
+// Run length encode length bytes starting at message[from] into message[to] onwards. The source is always
+// further along the buffer than the output, which never grows by more than a byte per 128, so packing can't
+// overwrite bytes it hasn't read yet. Returns the end of the output.
+size_t frameMirror::pack(size_t from, size_t length, size_t to) {
+    size_t i = 0;
+    while (i < length) {
+        const uint8_t *src = message + from;
+        size_t run = 1;
+        while (i+run < length && run < 128 && src[i+run] == src[i]) run++;
+        if (run >= 3) {
+            message[to++] = 127 + run;
+            message[to++] = src[i];
+            i += run;
+            continue;
+        }
+        size_t start = i;
+        while (i < length && i-start < 128) {
+            if (i+2 < length && src[i] == src[i+1] && src[i] == src[i+2]) break;
+            i++;
+        }
+        message[to++] = i-start-1;
+        memmove(message+to,src+start,i-start);
+        to += i-start;
+    }
+    return to;
+}
+
+size_t frameMirror::encode(const uint8_t *frame, size_t viewers) {
+    // Taken before encoding, so a viewer that connects part way through gets the next frame in full
+    bool key = keyFrame.exchange(false);
+    if (key) memset(shadow,0,sizeof(shadow));
+    message[0] = key ? 0 : 1;
+    memset(message+1,0,MIRRORHEADER-1);
+
+    // Gather the changes at the end of the buffer, then pack them down behind the header
+    size_t from = MIRRORMAXMESSAGE - MIRRORFRAMESIZE;
+    size_t changed = from;
+    for (int tile=0;tile<MIRRORTILES;tile++) {
+        const uint8_t *now = frame + tile*8;
+        uint8_t *was = shadow + tile*8;
+        if (!key && !memcmp(now,was,8)) continue;
+        message[1 + tile/8] |= 1 << (tile & 7);
+        for (int i=0;i<8;i++) {
+            message[changed++] = now[i] ^ was[i];
+            was[i] = now[i];
+        }
+    }
+    if (changed == from) return 0;
+
+    size_t length = pack(from,changed-from,MIRRORHEADER);
+    budget -= (long)(length * viewers);
+    return length;
+}
@@ -0,0 +1,62 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * frameMirror Library - encodes display frame changes for the web live view
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+#define MIRRORFRAMESIZE 2048      // u8g2 frame buffer for 256x64 (32x8 tiles of 8 bytes)
+#define MIRRORTILES 256
+#define MIRRORMAXMESSAGE 2112     // Header, tile map and worst case packed tile data
+#define MIRRORDEFAULTRATE 4       // Frames per second
+#define MIRRORMAXRATE 10
+#define MIRRORBYTESPERSEC 16384   // Average data rate limit across all viewers
+#define MIRRORMAXCLIENTS 2        // Live view connections allowed at once
+
+//
+// Each message starts with a type byte (0 = the viewer should clear its copy first, 1 = changes only) and a
+// 32 byte map with a bit set for each tile that has changed (tile row * 32 + tile column, lowest bit first).
+// Then the changed tiles, XORed with what was last sent, are run length encoded: a control byte below 128
+// is followed by that many plus one literal bytes, 128 and above repeats the next byte (control-127) times.
+//
+class frameMirror {
+
+    private:
+        uint8_t shadow[MIRRORFRAMESIZE];    // The frame as the viewers last saw it
+        uint8_t message[MIRRORMAXMESSAGE];
+        std::atomic<bool> keyFrame{true};   // Set by the web server task, taken by encode()
+        int rate = MIRRORDEFAULTRATE;
+        unsigned long nextFrame = 0;
+        unsigned long lastRefill = 0;
+        long budget = MIRRORBYTESPERSEC;
+
+        size_t pack(size_t from, size_t length, size_t to);
+
+    public:
+        // Frames per second to send (limited to MIRRORMAXRATE)
+        void setRate(int fps);
+
+        // Send the whole frame next time (a viewer has just connected)
+        void requestKeyFrame() {
+            keyFrame = true;
+        }
+
+        // True if it's time to send a frame and the data rate allows it
+        bool isDue();
+
+        // Encode what has changed since the last frame sent, charging the data rate for each viewer it will go to.
+        // Returns the message length, or 0 if nothing has changed.
+        size_t encode(const uint8_t *frame, size_t viewers);
+
+        const uint8_t *data() const {
+            return message;
+        }
+};
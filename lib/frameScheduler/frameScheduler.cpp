@@ -0,0 +1,53 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * frameScheduler Library - fixed rate frame pacing with timing statistics
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <frameScheduler.h>
+#include <spanTrace.h>
+
+void frameScheduler::waitForFrame(uint32_t periodMs) {
+    TickType_t period = pdMS_TO_TICKS(periodMs);
+    if (!period) period = 1;
+
+    if (!running) {
+        // First frame of a new schedule goes straight out
+        lastWake = xTaskGetTickCount();
+        lastRelease = micros();
+        running = true;
+        return;
+    }
+
+    uint32_t work = micros() - lastRelease;
+    if (work > worstWork) worstWork = work;
+    renderLog.record("frame","render",lastRelease,lastRelease+work);
+
+    if ((TickType_t)(xTaskGetTickCount() - lastWake) >= period) {
+        overruns++;
+        lastWake = xTaskGetTickCount();
+    } else {
+        vTaskDelayUntil(&lastWake,period);
+    }
+
+    uint32_t now = micros();
+    int32_t jitter = (int32_t)(now - lastRelease) - (int32_t)(periodMs * 1000);
+    if (jitter < 0) jitter = -jitter;
+    if ((uint32_t)jitter > maxJitter) maxJitter = jitter;
+    totalJitter += jitter;
+    frames++;
+    lastRelease = now;
+}
+
+void frameScheduler::resetStats() {
+    frames = 0;
+    overruns = 0;
+    worstWork = 0;
+    maxJitter = 0;
+    totalJitter = 0;
+}
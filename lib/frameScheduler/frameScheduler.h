@@ -0,0 +1,50 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * frameScheduler Library - fixed rate frame pacing with timing statistics
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+//
+// Frames are released on fixed deadlines (vTaskDelayUntil) rather than by delaying for whatever is left of
+// the frame after the work is done, so the time taken by one frame doesn't push back the ones after it.
+// If a frame misses its deadline it's counted as an overrun and the schedule restarts from now instead of
+// trying to catch up with a burst of frames.
+//
+class frameScheduler {
+
+    private:
+        TickType_t lastWake = 0;
+        uint32_t lastRelease = 0;       // micros() when the previous frame was released
+        bool running = false;
+
+        uint32_t frames = 0;
+        uint32_t overruns = 0;
+        uint32_t worstWork = 0;         // Longest time spent preparing a frame (us)
+        uint32_t maxJitter = 0;         // Largest difference between a frame interval and the period (us)
+        uint64_t totalJitter = 0;
+
+    public:
+        // Wait until the next frame is due. Call once per frame, just before sending it to the display.
+        void waitForFrame(uint32_t periodMs);
+
+        // Start a new schedule (after anything that stops the frames for a while, so it isn't counted as an overrun)
+        void restart() {
+            running = false;
+        }
+
+        void resetStats();
+
+        uint32_t frameCount() const { return frames; }
+        uint32_t overrunCount() const { return overruns; }
+        uint32_t worstFrameTime() const { return worstWork; }
+        uint32_t worstJitter() const { return maxJitter; }
+        uint32_t averageJitter() const { return frames ? totalJitter / frames : 0; }
+};
@@ -15,12 +15,14 @@
 #include <WiFiClientSecure.h>
 #include <LittleFS.h>
 #include <md5Utils.h>
+#include <fetchMetrics.h>
 
 github::github(sharedBufferSpace *sharedBuffer) : js(sharedBuffer) {}
 
 int github::getLatestRelease() {
 
     js->lastResultMessage[0] = '\0';
+    fetchTrace trace(UPSTREAM_GITHUB);
     JsonStreamingParserGS parser;
     parser.setListener(this);
     WiFiClientSecure httpsClient;
@@ -38,6 +40,7 @@ int github::getLatestRelease() {
         strcpy(js->lastResultMessage,"Error: GH Connect timed out");
         return UPD_NO_RESPONSE;
     }
+    trace.mark(PHASE_CONNECT);
 
     String request = "GET " GITHUBREPOPATH " HTTP/1.0\r\nHost: " GITHUBAPIHOST "\r\nuser-agent: esp32/1.0\r\nX-GitHub-Api-Version: 2022-11-28\r\nAccept: application/vnd.github+json\r\n";
     if (strlen(GITHUBTOKEN)) request += "Authorization: Bearer " GITHUBTOKEN "\r\nConnection: close\r\n\r\n";
@@ -55,6 +58,7 @@ int github::getLatestRelease() {
             return UPD_TIMEOUT;
         }
     }
+    trace.mark(PHASE_WAIT);
 
     while (httpsClient.connected()) {
         String line = httpsClient.readStringUntil('\n');
@@ -96,6 +100,8 @@ int github::getLatestRelease() {
         delay(5);
     }
     httpsClient.stop();
+    trace.setBytes(dataReceived);
+    trace.mark(PHASE_BODY);
     if (millis() >= dataSendTimeout) {
         sprintf(js->lastResultMessage,"Error: GH Timeout after %d bytes",dataReceived);
         return UPD_TIMEOUT;
@@ -0,0 +1,202 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * heapProfiler Library - heap fragmentation trend and (optional) allocation profiling
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <heapProfiler.h>
+#include <esp_heap_caps.h>
+#include <algorithm>
+
+heapProfiler heapProfile;
+
+static heapRegion *regions = nullptr;
+
+heapRegion::heapRegion(const char *regionName) : name(regionName) {
+    next = regions;
+    regions = this;
+}
+
+#ifdef HEAPPROFILE
+
+// Plain data so it's usable by allocations made before the C++ constructors have run
+struct allocationProfile {
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t failed;
+    uint32_t liveBytes;
+    uint32_t peakLiveBytes;
+    uint32_t sizes[HEAPSIZEBUCKETS];
+    heapSite sites[HEAPSITES];
+    uint32_t otherAllocs;
+    uint32_t otherBytes;
+};
+
+struct activeRegion {
+    heapRegion *region;
+    TaskHandle_t task;
+};
+
+static allocationProfile profile;
+static activeRegion active[portNUM_PROCESSORS];
+static portMUX_TYPE profileLock = portMUX_INITIALIZER_UNLOCKED;
+
+static void noteAlloc(void *ptr, uintptr_t site) {
+    if (!ptr) {
+        portENTER_CRITICAL(&profileLock);
+        profile.failed++;
+        portEXIT_CRITICAL(&profileLock);
+        return;
+    }
+    uint32_t size = heap_caps_get_allocated_size(ptr);
+    int bucket = 0;
+    while (bucket < HEAPSIZEBUCKETS-1 && size > (16UL << bucket)) bucket++;
+    // Regions are only opened by tasks pinned to a core, so the core identifies the region
+    activeRegion &current = active[xPortGetCoreID()];
+    bool inRegion = current.region && current.task == xTaskGetCurrentTaskHandle();
+
+    portENTER_CRITICAL(&profileLock);
+    profile.allocs++;
+    profile.sizes[bucket]++;
+    profile.liveBytes += size;
+    if (profile.liveBytes > profile.peakLiveBytes) profile.peakLiveBytes = profile.liveBytes;
+    int slot = (site >> 2) % HEAPSITES;
+    int probes = 0;
+    while (probes < HEAPSITES && profile.sites[slot].address && profile.sites[slot].address != site) {
+        slot = (slot+1) % HEAPSITES;
+        probes++;
+    }
+    if (probes < HEAPSITES) {
+        profile.sites[slot].address = site;
+        profile.sites[slot].allocs++;
+        profile.sites[slot].bytes += size;
+    } else {
+        profile.otherAllocs++;
+        profile.otherBytes += size;
+    }
+    if (inRegion) {
+        current.region->allocs = current.region->allocs + 1;
+        current.region->bytes = current.region->bytes + size;
+    }
+    portEXIT_CRITICAL(&profileLock);
+}
+
+static void noteFree(uint32_t size) {
+    portENTER_CRITICAL(&profileLock);
+    profile.frees++;
+    // Blocks from heap_caps_malloc() (and anything allocated before the wrappers) weren't counted when they
+    // were allocated, so freeing them could take the total below zero
+    profile.liveBytes = (size < profile.liveBytes) ? profile.liveBytes - size : 0;
+    portEXIT_CRITICAL(&profileLock);
+}
+
+// Called in place of the C library functions (-Wl,--wrap=malloc etc)
+extern "C" {
+    void *__real_malloc(size_t size);
+    void __real_free(void *ptr);
+    void *__real_realloc(void *ptr, size_t size);
+    void *__real_calloc(size_t count, size_t size);
+
+    void *__wrap_malloc(size_t size) {
+        void *ptr = __real_malloc(size);
+        noteAlloc(ptr,(uintptr_t)__builtin_return_address(0));
+        return ptr;
+    }
+
+    void __wrap_free(void *ptr) {
+        if (ptr) noteFree(heap_caps_get_allocated_size(ptr));
+        __real_free(ptr);
+    }
+
+    void *__wrap_realloc(void *ptr, size_t size) {
+        // Counted as a free of the old block and an allocation of the new one
+        uint32_t oldSize = ptr ? heap_caps_get_allocated_size(ptr) : 0;
+        void *newPtr = __real_realloc(ptr,size);
+        if (ptr && (newPtr || !size)) noteFree(oldSize);
+        if (newPtr || size) noteAlloc(newPtr,(uintptr_t)__builtin_return_address(0));
+        return newPtr;
+    }
+
+    void *__wrap_calloc(size_t count, size_t size) {
+        void *ptr = __real_calloc(count,size);
+        noteAlloc(ptr,(uintptr_t)__builtin_return_address(0));
+        return ptr;
+    }
+}
+
+heapRegionScope::heapRegionScope(heapRegion &region) {
+    activeRegion &current = active[xPortGetCoreID()];
+    previous = current.region;
+    previousTask = current.task;
+    current.task = xTaskGetCurrentTaskHandle();
+    current.region = &region;
+}
+
+heapRegionScope::~heapRegionScope() {
+    activeRegion &current = active[xPortGetCoreID()];
+    current.region = previous;
+    current.task = previousTask;
+}
+
+#endif
+
+void heapProfiler::sample() {
+    if (sampleCount && millis() - lastSample < HEAPSAMPLEINTERVAL) return;
+    lastSample = millis();
+    heapSample &s = samples[sampleCount % HEAPSAMPLES];
+    s.uptime = millis()/1000;
+    s.freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    s.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    s.minFreeHeap = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+#ifdef HEAPPROFILE
+    s.allocs = profile.allocs;
+#else
+    s.allocs = 0;
+#endif
+    sampleCount++;
+}
+
+// Fragmentation is the share of free memory that can't be had in a single allocation
+static uint32_t fragmentation(uint32_t freeHeap, uint32_t largestBlock) {
+    return freeHeap ? 100 - (uint32_t)((uint64_t)largestBlock * 100 / freeHeap) : 0;
+}
+
+void heapProfiler::writeJson(Print &out) const {
+    uint32_t freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    uint32_t largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    out.printf("{\"uptime\":%u,\"freeHeap\":%u,\"largestBlock\":%u,\"minFreeHeap\":%u,\"fragmentation\":%u,\"sampleIntervalMs\":%u,\"samples\":[",
+        (uint32_t)(millis()/1000),freeHeap,largestBlock,(uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT),fragmentation(freeHeap,largestBlock),HEAPSAMPLEINTERVAL);
+    // Oldest first, as [uptime,freeHeap,largestBlock,minFreeHeap,fragmentation,allocs]
+    uint32_t count = sampleCount < HEAPSAMPLES ? sampleCount : HEAPSAMPLES;
+    for (uint32_t i=sampleCount-count;i<sampleCount;i++) {
+        const heapSample &s = samples[i % HEAPSAMPLES];
+        out.printf("%s[%u,%u,%u,%u,%u,%u]",i==sampleCount-count?"":",",s.uptime,s.freeHeap,s.largestBlock,s.minFreeHeap,fragmentation(s.freeHeap,s.largestBlock),s.allocs);
+    }
+    out.print("],\"profile\":");
+
+#ifdef HEAPPROFILE
+    // Take a copy first, the response itself allocates
+    allocationProfile copy;
+    portENTER_CRITICAL(&profileLock);
+    copy = profile;
+    portEXIT_CRITICAL(&profileLock);
+    std::sort(copy.sites,copy.sites+HEAPSITES,[](const heapSite &a, const heapSite &b) { return a.allocs > b.allocs; });
+
+    out.printf("{\"allocs\":%u,\"frees\":%u,\"failed\":%u,\"liveBytes\":%u,\"peakLiveBytes\":%u,\"sizeBuckets\":[",copy.allocs,copy.frees,copy.failed,copy.liveBytes,copy.peakLiveBytes);
+    for (int b=0;b<HEAPSIZEBUCKETS;b++) out.printf("%s%u",b?",":"",copy.sizes[b]);
+    out.print("],\"sites\":[");
+    for (int i=0;i<HEAPSITES && copy.sites[i].address;i++) {
+        out.printf("%s{\"address\":\"0x%08x\",\"allocs\":%u,\"bytes\":%u}",i?",":"",copy.sites[i].address,copy.sites[i].allocs,copy.sites[i].bytes);
+    }
+    out.printf("],\"other\":{\"allocs\":%u,\"bytes\":%u},\"regions\":{",copy.otherAllocs,copy.otherBytes);
+    for (heapRegion *r=regions;r;r=r->next) out.printf("%s\"%s\":{\"allocs\":%u,\"bytes\":%u}",r==regions?"":",",r->name,r->allocs,r->bytes);
+    out.print("}}}");
+#else
+    out.print("null}");
+#endif
+}
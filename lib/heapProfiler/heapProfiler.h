@@ -0,0 +1,98 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * heapProfiler Library - heap fragmentation trend and (optional) allocation profiling
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#define HEAPSAMPLES 96              // Heap samples kept for the trend
+#ifdef HEAPSOAK
+#define HEAPSAMPLEINTERVAL 60000    // Soak builds run the fetches much faster, so sample more often (ms - 1 min)
+#else
+#define HEAPSAMPLEINTERVAL 900000   // How often the heap is sampled (ms - 15 mins, so the trend covers a day)
+#endif
+#define HEAPSITES 32                // Distinct call sites counted, any more are added to "other"
+#define HEAPSIZEBUCKETS 12          // Allocation sizes from 16 bytes doubling up to 32K, the last is anything larger
+
+struct heapSample {
+    uint32_t uptime;                // Seconds
+    uint32_t freeHeap;
+    uint32_t largestBlock;
+    uint32_t minFreeHeap;
+    uint32_t allocs;                // Allocations since boot (0 unless profiling)
+};
+
+struct heapSite {
+    uintptr_t address;              // Return address of the caller of malloc/realloc/calloc
+    uint32_t allocs;
+    uint32_t bytes;
+};
+
+//
+// Allocations made while a region is active on the current task are counted against it, which shows
+// whether code that should be allocation free (drawing a frame, parsing a response) really is. Regions are
+// static objects, nesting is allowed and the innermost region is counted.
+//
+class heapRegion {
+
+    public:
+        const char *name;
+        volatile uint32_t allocs = 0;
+        volatile uint32_t bytes = 0;
+        heapRegion *next = nullptr;
+
+        heapRegion(const char *regionName);
+};
+
+//
+// The heap trend is always kept: sample() is called from loop() and is cheap. The allocation profile only
+// exists in builds with HEAPPROFILE defined, which also need the linker to wrap malloc, free, realloc and
+// calloc (see the heapprofile environment in platformio.ini). Allocations through operator new are counted
+// but their call site is inside the C++ library rather than the caller. Blocks from heap_caps_malloc() (the
+// display DMA buffers and many ESP-IDF internals) bypass the wrappers, so liveBytes doesn't include them.
+//
+class heapProfiler {
+
+    private:
+        heapSample samples[HEAPSAMPLES];
+        uint32_t sampleCount = 0;
+        unsigned long lastSample = 0;
+
+    public:
+        void sample();
+        void writeJson(Print &out) const;
+};
+
+extern heapProfiler heapProfile;
+
+#ifdef HEAPPROFILE
+
+class heapRegionScope {
+
+    private:
+        heapRegion *previous;
+        TaskHandle_t previousTask;
+
+    public:
+        heapRegionScope(heapRegion &region);
+        ~heapRegionScope();
+};
+
+#define HEAPCONCAT2(a,b) a##b
+#define HEAPCONCAT(a,b) HEAPCONCAT2(a,b)
+
+// Count allocations on this task against a region for the rest of the enclosing block
+#define HEAP_REGION(region) heapRegionScope HEAPCONCAT(heapRegion_,__LINE__)(region)
+
+#else
+
+#define HEAP_REGION(region)
+
+#endif
@@ -0,0 +1,243 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * jsonUpload Library - streams a JSON request body to a file, checking it's valid JSON as it goes
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <jsonUpload.h>
+#include <LittleFS.h>
+#include <responseCodes.h>
+
+static bool isJsonSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+jsonUpload::~jsonUpload() {
+    abort();
+}
+
+bool jsonUpload::begin(const char *filePath) {
+    strlcpy(path,filePath,sizeof(path));
+    snprintf(tempPath,sizeof(tempPath),"%s.tmp",path);
+    failed = false;
+    received = 0;
+    state = JS_VALUE;
+    stack = 0;
+    depth = 0;
+    file = LittleFS.open(tempPath,"w");
+    return (bool)file;
+}
+
+void jsonUpload::write(const uint8_t *data, size_t len) {
+    received += len;
+    if (received > JSONUPLOADMAXSIZE) state = JS_ERROR;
+    if (failed || state == JS_ERROR || !file) return;
+    for (size_t i=0;i<len && state != JS_ERROR;i++) parse(data[i]);
+    if (file.write(data,len) != len) failed = true;
+}
+
+int jsonUpload::finish() {
+    if (!file) return UPD_INCOMPLETE;
+    file.close();
+    int result = UPD_SUCCESS;
+    if (failed) {
+        result = UPD_INCOMPLETE;
+    } else if (state != JS_DONE) {
+        result = UPD_DATA_ERROR;
+    } else if (!LittleFS.rename(tempPath,path)) {
+        // LittleFS replaces the old file in one step, so it's either the old or new version after a power cut
+        result = UPD_INCOMPLETE;
+    }
+    if (result != UPD_SUCCESS) LittleFS.remove(tempPath);
+    return result;
+}
+
+void jsonUpload::abort() {
+    if (file) {
+        file.close();
+        LittleFS.remove(tempPath);
+    }
+}
+
+bool jsonUpload::push(bool isObject) {
+    if (depth >= JSONUPLOADMAXDEPTH) {
+        state = JS_ERROR;
+        return false;
+    }
+    if (isObject) stack |= (1UL << depth); else stack &= ~(1UL << depth);
+    depth++;
+    return true;
+}
+
+void jsonUpload::pop(char close) {
+    bool isObject = (stack >> (depth-1)) & 1;
+    if (isObject != (close == '}')) {
+        state = JS_ERROR;
+        return;
+    }
+    depth--;
+    endValue();
+}
+
+void jsonUpload::endValue() {
+    state = depth ? JS_AFTERVALUE : JS_DONE;
+}
+
+void jsonUpload::startValue(char c) {
+    // The body must be an object (the settings files are always read as one)
+    if (!depth && c != '{') {
+        state = JS_ERROR;
+        return;
+    }
+    switch (c) {
+        case '{':
+            if (push(true)) state = JS_FIRSTKEY;
+            break;
+        case '[':
+            if (push(false)) state = JS_FIRSTVALUE;
+            break;
+        case '"':
+            stringIsKey = false;
+            state = JS_STRING;
+            break;
+        case '-':
+            state = JS_MINUS;
+            break;
+        case '0':
+            state = JS_ZERO;
+            break;
+        case 't':
+            literal = "rue";
+            state = JS_LITERAL;
+            break;
+        case 'f':
+            literal = "alse";
+            state = JS_LITERAL;
+            break;
+        case 'n':
+            literal = "ull";
+            state = JS_LITERAL;
+            break;
+        default:
+            state = (c >= '1' && c <= '9') ? JS_INT : JS_ERROR;
+    }
+}
+
+// A number only ends when something else follows it, which then needs parsing in its own right
+void jsonUpload::endNumber(char c) {
+    endValue();
+    parse(c);
+}
+
+void jsonUpload::parse(char c) {
+    switch (state) {
+        case JS_VALUE:
+            if (!isJsonSpace(c)) startValue(c);
+            break;
+
+        case JS_FIRSTVALUE:
+            if (c == ']') pop(c);
+            else if (!isJsonSpace(c)) startValue(c);
+            break;
+
+        case JS_FIRSTKEY:
+        case JS_KEY:
+            if (c == '"') {
+                stringIsKey = true;
+                state = JS_STRING;
+            } else if (c == '}' && state == JS_FIRSTKEY) {
+                pop(c);
+            } else if (!isJsonSpace(c)) {
+                state = JS_ERROR;
+            }
+            break;
+
+        case JS_COLON:
+            if (c == ':') state = JS_VALUE;
+            else if (!isJsonSpace(c)) state = JS_ERROR;
+            break;
+
+        case JS_AFTERVALUE:
+            if (c == ',') state = ((stack >> (depth-1)) & 1) ? JS_KEY : JS_VALUE;
+            else if (c == '}' || c == ']') pop(c);
+            else if (!isJsonSpace(c)) state = JS_ERROR;
+            break;
+
+        case JS_STRING:
+            if (c == '"') {
+                if (stringIsKey) state = JS_COLON; else endValue();
+            } else if (c == '\\') {
+                state = JS_ESCAPE;
+            } else if ((uint8_t)c < 0x20) {
+                state = JS_ERROR;
+            }
+            break;
+
+        case JS_ESCAPE:
+            if (c == 'u') {
+                hexDigits = 0;
+                state = JS_UNICODE;
+            } else {
+                state = (c && strchr("\"\\/bfnrt",c)) ? JS_STRING : JS_ERROR;
+            }
+            break;
+
+        case JS_UNICODE:
+            if (!isxdigit((uint8_t)c)) state = JS_ERROR;
+            else if (++hexDigits == 4) state = JS_STRING;
+            break;
+
+        case JS_MINUS:
+            if (c == '0') state = JS_ZERO;
+            else state = isDigit(c) ? JS_INT : JS_ERROR;
+            break;
+
+        case JS_ZERO:
+        case JS_INT:
+            if (isDigit(c) && state == JS_INT) break;
+            if (c == '.') state = JS_DOT;
+            else if (c == 'e' || c == 'E') state = JS_EXP;
+            else endNumber(c);
+            break;
+
+        case JS_DOT:
+            state = isDigit(c) ? JS_FRAC : JS_ERROR;
+            break;
+
+        case JS_FRAC:
+            if (isDigit(c)) break;
+            if (c == 'e' || c == 'E') state = JS_EXP;
+            else endNumber(c);
+            break;
+
+        case JS_EXP:
+            if (c == '+' || c == '-') state = JS_EXPSIGN;
+            else state = isDigit(c) ? JS_EXPDIGITS : JS_ERROR;
+            break;
+
+        case JS_EXPSIGN:
+            state = isDigit(c) ? JS_EXPDIGITS : JS_ERROR;
+            break;
+
+        case JS_EXPDIGITS:
+            if (!isDigit(c)) endNumber(c);
+            break;
+
+        case JS_LITERAL:
+            if (c != *literal) state = JS_ERROR;
+            else if (!*++literal) endValue();
+            break;
+
+        case JS_DONE:
+            if (!isJsonSpace(c)) state = JS_ERROR;
+            break;
+
+        case JS_ERROR:
+            break;
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * jsonUpload Library - streams a JSON request body to a file, checking it's valid JSON as it goes
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+
+#define JSONUPLOADMAXDEPTH 32       // Deepest nesting of objects and arrays accepted
+#define JSONUPLOADMAXSIZE 32768     // Largest body accepted
+#define JSONUPLOADPATHSIZE 32
+
+//
+// Each chunk of the body is written to "<path>.tmp" as it arrives and run through a validating state machine,
+// so only a few bytes of state are kept whatever the size of the upload. finish() renames the temporary file
+// over the real one if the whole body was a valid JSON object, otherwise the old file is left untouched.
+//
+class jsonUpload {
+
+    private:
+        enum parseState : uint8_t {
+            JS_VALUE, JS_FIRSTVALUE, JS_FIRSTKEY, JS_KEY, JS_COLON, JS_AFTERVALUE, JS_STRING, JS_ESCAPE, JS_UNICODE,
+            JS_MINUS, JS_ZERO, JS_INT, JS_DOT, JS_FRAC, JS_EXP, JS_EXPSIGN, JS_EXPDIGITS, JS_LITERAL, JS_DONE, JS_ERROR
+        };
+
+        File file;
+        char path[JSONUPLOADPATHSIZE];
+        char tempPath[JSONUPLOADPATHSIZE+4];
+        bool failed = false;
+        size_t received = 0;
+
+        parseState state = JS_VALUE;
+        uint32_t stack = 0;         // Bit n set if nesting level n is an object, clear for an array
+        uint8_t depth = 0;
+        bool stringIsKey = false;
+        uint8_t hexDigits = 0;
+        const char *literal = nullptr;
+
+        bool push(bool isObject);
+        void pop(char close);
+        void endValue();
+        void startValue(char c);
+        void endNumber(char c);
+        void parse(char c);
+
+    public:
+        ~jsonUpload();
+
+        // Start an upload that will replace path. Returns false if the temporary file can't be created.
+        bool begin(const char *path);
+
+        // Add the next chunk of the body
+        void write(const uint8_t *data, size_t len);
+
+        // Replace the file with the upload. Returns UPD_SUCCESS, UPD_DATA_ERROR if the body wasn't valid JSON,
+        // or UPD_INCOMPLETE if it couldn't be written.
+        int finish();
+
+        // Give up and remove the temporary file
+        void abort();
+};
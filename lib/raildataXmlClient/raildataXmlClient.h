@@ -14,6 +14,8 @@
 #include <xmlStreamingParser.h>
 #include <sharedDataStructs.h>
 #include <responseCodes.h>
+#include <boardDiff.h>
+#include <callingPoints.h>
 
 #define MAXHOSTSIZE 48
 #define MAXAPIURLSIZE 48
@@ -26,8 +28,9 @@ class raildataXmlClient: public xmlListener {
 
         struct rdiLocation {
           char location[MAXLOCATIONSIZE];
-          char scheduledTime[6];
-          char actualTime[6];
+          uint16_t scheduledTime;
+          uint16_t actualTime;
+          bool onTime;
         };
 
         String greatGrandParentTagName = "";
@@ -45,6 +48,7 @@ class raildataXmlClient: public xmlListener {
         String currentPath = "";
 
         rdiStation* xStation = nullptr;
+        rdStation* xBoard = nullptr;   // The next board to display, built at the end of each fetch
         stnMessages* xMessages = nullptr;
         sharedBufferSpace* js = nullptr;
 
@@ -53,6 +57,7 @@ class raildataXmlClient: public xmlListener {
 
         bool addedStopLocation = false;
         int id=0;
+        uint16_t serviceMark = 0;   // Arena position at the start of the current service
         int coaches=0;
 
         bool firstDataLoad;
@@ -67,8 +72,11 @@ class raildataXmlClient: public xmlListener {
         void replaceWord(char* input, const char* target, const char* replacement);
         void pruneFromPhrase(char* input, const char* target);
         void fixFullStop(char* input);
-        int timeDiff(const char *scheduled, const char *actual);
+        void fixFullStop(strRef &text);
+        void sanitiseText(strRef &text);
+        void clearService(int x);
         void sanitiseData();
+        void buildBoard();
         void deleteService(int x);
         void trim(char* &start, char* &end);
         bool equalsIgnoreCase(const char* a, int a_len, const char* b);
@@ -83,7 +91,7 @@ class raildataXmlClient: public xmlListener {
         virtual void attribute(const char *attribute);
 
     public:
-        raildataXmlClient(rdiStation *station, stnMessages *messages, sharedBufferSpace *sharedBuffer);
+        raildataXmlClient(rdiStation *station, rdStation *board, stnMessages *messages, sharedBufferSpace *sharedBuffer);
         int init(const char *wsdlHost, const char *wsdlAPI);
         void cleanFilter(const char* rawFilter, char* cleanedFilter, size_t maxLen);
         int fetchDepartures(rdStation *station, stnMessages *messages, const char *crsCode, const char *customToken, int numRows, bool includeBusServices, const char *callingCrsCode, const char *platforms, int timeOffset, bool fetchLastSeen, bool includeServiceMessages);
@@ -12,28 +12,16 @@
 #include <rdmRailClient.h>
 #include <jsonListenerGS.h>
 #include <WiFiClientSecure.h>
+#include <fetchMetrics.h>
 #include <time.h>
 
-rdmRailClient::rdmRailClient(rdiStation *station, stnMessages *messages, sharedBufferSpace *sharedBuffer) : xStation(station), xMessages(messages), js(sharedBuffer) {
+rdmRailClient::rdmRailClient(rdiStation *station, rdStation *board, stnMessages *messages, sharedBufferSpace *sharedBuffer) : xStation(station), xBoard(board), xMessages(messages), js(sharedBuffer) {
     firstDataLoad=true;
 }
 
-// Custom comparator function to compare time strings
+// Custom comparator function to compare departure times
 bool rdmRailClient::compareTimes(const rdiService& a, const rdiService& b) {
-    // Convert time strings to integers for comparison
-    int hour1, minute1, hour2, minute2;
-    sscanf(a.sortTime, "%d:%d", &hour1, &minute1);
-    sscanf(b.sortTime, "%d:%d", &hour2, &minute2);
-
-    // Compare hours first
-    if (hour1 != hour2) {
-        // Fudge for rollover at midnight
-        if (hour1 < 2 && hour2 > 20) return false;
-        if (hour2 < 2 && hour1 > 20) return true;
-        else return hour1 < hour2;
-    }
-    // If hours are equal, compare minutes
-    return minute1 < minute2;
+    return a.sortTime < b.sortTime;
 }
 
 //
@@ -99,6 +87,27 @@ void rdmRailClient::fixFullStop(char *input) {
     }
 }
 
+//
+// As above for a string held in the fetch arena
+//
+void rdmRailClient::fixFullStop(strRef &text) {
+    if (text.length) {
+        char *input = xStation->text.edit(text);
+        while (input[0] && (input[strlen(input)-1] == '.' || input[strlen(input)-1] == ' ')) input[strlen(input)-1] = '\0'; // Remove all trailing full stops
+        xStation->text.refresh(text);
+        xStation->text.append(text,".",MAXMESSAGESIZE);  // Add a single fullstop
+    }
+}
+
+//
+// Remove any html from a string held in the fetch arena (edits can only shorten it)
+//
+void rdmRailClient::sanitiseText(strRef &text) {
+    removeHtmlTags(xStation->text.edit(text));
+    replaceWord(xStation->text.edit(text),"&amp;","&");
+    xStation->text.refresh(text);
+}
+
 // Trim leading and trailing spaces in-place
 void rdmRailClient::trim(char* &start, char* &end) {
   while (start <= end && isspace(*start)) start++;
@@ -175,6 +184,7 @@ int rdmRailClient::fetchDepartures(rdStation *station, stnMessages *messages, co
     unsigned long perfTimer=millis();
     bool bChunked = false;
     js->lastResultMessage[0] = '\0';
+    fetchTrace trace(UPSTREAM_RDM);
 
     // Reset the counters
     xStation->numServices=0;
@@ -182,24 +192,12 @@ int rdmRailClient::fetchDepartures(rdStation *station, stnMessages *messages, co
     xStation->platformAvailable=false;
     addedStopLocation = false;
     strcpy(xStation->location,"");
+    xStation->text.reset();
+    resetCallingPoints(xStation);
+    xStation->lastSeen = {};
+    serviceMark = 0;
 
-    for (int i=0;i<MAXBOARDSERVICES;++i) {
-      strcpy(xStation->service[i].sTime,"");
-      strcpy(xStation->service[i].destination,"");
-      strcpy(xStation->service[i].via,"");
-      strcpy(xStation->service[i].origin,"");
-      strcpy(xStation->service[i].etd,"");
-      strcpy(xStation->service[i].platform,"");
-      strcpy(xStation->service[i].opco,"");
-      strcpy(xStation->service[i].calling,"");
-      strcpy(xStation->service[i].serviceMessage,"");
-      strcpy(xStation->service[i].serviceID,"");
-      xStation->service[i].trainLength=0;
-      xStation->service[i].classesAvailable=0;
-      xStation->service[i].serviceType=0;
-      xStation->service[i].isCancelled=false;
-      xStation->service[i].isDelayed=false;
-    }
+    for (int i=0;i<MAXBOARDSERVICES;++i) clearService(i);
     for (int i=0;i<MAXBOARDMESSAGES;++i) strcpy(xMessages->messages[i],"");
     id=0;
     coaches=0;
@@ -217,6 +215,7 @@ int rdmRailClient::fetchDepartures(rdStation *station, stnMessages *messages, co
         strcpy(js->lastResultMessage,"Error: Connect timed out");
         return UPD_NO_RESPONSE;
     }
+    trace.mark(PHASE_CONNECT);
 
     int reqRows = MAXBOARDSERVICES;
     if (platforms[0]) reqRows = 10;   // Request maximum services if we're filtering platforms
@@ -235,6 +234,7 @@ int rdmRailClient::fetchDepartures(rdStation *station, stnMessages *messages, co
             return UPD_TIMEOUT;     // No response within 8s
         }
     }
+    trace.mark(PHASE_WAIT);
     unsigned long dataSendTimeout = millis() + 1000UL;
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
         String line = httpsClient.readStringUntil('\n');
@@ -286,6 +286,8 @@ int rdmRailClient::fetchDepartures(rdStation *station, stnMessages *messages, co
     }
 
     httpsClient.stop();
+    trace.setBytes(dataReceived);
+    trace.mark(PHASE_BODY);
     if (millis() >= dataSendTimeout) {
         sprintf(js->lastResultMessage,"Error: Timeout after %d bytes",dataReceived);
         return UPD_TIMEOUT;
@@ -307,29 +309,26 @@ int rdmRailClient::fetchDepartures(rdStation *station, stnMessages *messages, co
         }
     }
 
-    // Get the sort times (scheduled or estimated if present)
+    // Get the sort times (estimated if present or scheduled) as minutes into the service day
+    uint16_t timeNow = currentMinutes();
     for (int i=0;i<xStation->numServices;++i) {
-        if (isdigit(xStation->service[i].etd[0]) && strlen(xStation->service[i].etd) == 5) {
-            strcpy(xStation->service[i].sortTime,xStation->service[i].etd);
-        } else {
-            strcpy(xStation->service[i].sortTime,xStation->service[i].sTime);
-        }
+        if (xStation->service[i].etdTime != NOTIME) xStation->service[i].sortTime = serviceDayMinutes(xStation->service[i].etdTime,timeNow);
+        else xStation->service[i].sortTime = serviceDayMinutes(xStation->service[i].sTime,timeNow);
     }
     // Sort the services by actual departure time
     size_t arraySize = xStation->numServices;
-    std::sort(xStation->service, xStation->service+arraySize,compareTimes);
+    {
+        TRACE_SPAN("sort","rdm");
+        std::sort(xStation->service, xStation->service+arraySize,compareTimes);
+    }
 
     if (xStation->numServices && (xStation->service[0].isCancelled || strcmp(xStation->service[0].etd,"Delayed")==0)) {
-        // First service is cancelled or delayed (without estimate), check if it should be dropped
-        struct tm nowtime;
-        getLocalTime(&nowtime);
-        char timenow[6];
-        sprintf(timenow,"%02d:%02d",nowtime.tm_hour,nowtime.tm_min);
-        if (timeDiff(xStation->service[0].sortTime,timenow) < -1) deleteService(0);
+        // First service is cancelled or delayed (without estimate), drop it if it was due more than a minute ago
+        if (timeNow != NOTIME && xStation->service[0].sortTime + 1 < SERVICEDAYLEAD) deleteService(0);
     }
 
     // Handle getting last seen location from GetServiceDetails api
-    if (fetchLastSeen && serviceApiKey!="" && xStation->numServices && xStation->service[0].serviceID[0] && strcmp(xStation->location,xStation->service[0].origin)) {
+    if (fetchLastSeen && serviceApiKey!="" && xStation->numServices && xStation->service[0].serviceID[0] && strcmp(xStation->location,xStation->text.get(xStation->service[0].origin))) {
         getServiceDetails(xStation->service[0].serviceID, serviceApiKey);
     }
 
@@ -337,81 +336,66 @@ int rdmRailClient::fetchDepartures(rdStation *station, stnMessages *messages, co
     if (!includeServiceMessages) xMessages->numMessages=0;
 
     sanitiseData();
-    bool noUpdate = true;
-    bool secondaryChange = true;
-    if (!firstDataLoad) {
-        // Check for any changes
-        if (messages->numMessages != xMessages->numMessages || station->numServices != xStation->numServices || station->platformAvailable != xStation->platformAvailable || strcmp(station->location,xStation->location)) {
-            noUpdate=false;
-            secondaryChange = false;
-        }
-        else {
-            for (int i=0;i<xMessages->numMessages;++i) {
-                if (strcmp(messages->messages[i],xMessages->messages[i])) {
-                    noUpdate=false;
-                    break;
-                }
-            }
-            if (strcmp(station->calling,xStation->service[0].calling)) noUpdate=false;
-            for (int i=0;i<xStation->numServices;++i) {
-                if (strcmp(station->service[i].sTime, xStation->service[i].sTime) || strcmp(station->service[i].destination, xStation->service[i].destination) || strcmp(station->service[i].via, xStation->service[i].via) || strcmp(station->service[i].etd, xStation->service[i].etd) || strcmp(station->service[i].platform, xStation->service[i].platform)) {
-                    noUpdate=false;
-                    if (i==0 && (strcmp(station->service[i].destination, xStation->service[i].destination) || strcmp(station->service[i].via, xStation->service[i].via))) secondaryChange = false;
-                    break;
-                }
-                if (station->service[i].isCancelled != xStation->service[i].isCancelled || station->service[i].isDelayed != xStation->service[i].isDelayed || station->service[i].trainLength != xStation->service[i].trainLength || station->service[i].classesAvailable != xStation->service[i].classesAvailable || station->service[i].serviceType != xStation->service[i].serviceType) {
-                    noUpdate=false;
-                    if (i==0) secondaryChange = false;
-                    break;
-                }
-            }
-        }
-    } else {
+    buildBoard();
+
+    // Work out what has changed since the board being displayed
+    diffBoards(station,messages,xBoard,xMessages);
+    int result = boardUpdateResult(&xBoard->changes);
+    if (firstDataLoad) {
         firstDataLoad=false;
-        noUpdate=false;
-        secondaryChange=false;
+        result = UPD_SUCCESS;
     }
 
+    trace.mark(PHASE_PROCESS);
     UBaseType_t uxHighWaterMark = uxTaskGetStackHighWaterMark(NULL);
-    if (noUpdate) {
-        sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"[DB] OK: NC D:%d T:%d S:%d %s",dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
-        return UPD_NO_CHANGE;
-    } else {
-        if (secondaryChange) {
-            sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"[DB] OK: SC D:%d T:%d S:%d %s",dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
-            return UPD_SEC_CHANGE;
-        } else {
-            sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"[DB] OK: UP D:%d T:%d S:%d %s",dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
-            return UPD_SUCCESS;
-        }
-    }
+    const char *changeType = (result == UPD_NO_CHANGE) ? "NC" : (result == UPD_SEC_CHANGE) ? "SC" : "UP";
+    sprintf(js->lastResultMessage+strlen(js->lastResultMessage),"[DB] OK: %s D:%d T:%d S:%d %s",changeType,dataReceived,millis()-perfTimer,uxHighWaterMark,bChunked?"C!":"");
+    return result;
 }
 
 void rdmRailClient::loadDepartures(rdStation *station, stnMessages *messages) {
     // copy everything back to the caller's structure
     messages->numMessages = xMessages->numMessages;
-    station->numServices = xStation->numServices;
-    strcpy(station->location,xStation->location);
-    station->platformAvailable = xStation->platformAvailable;
     for (int i=0;i<xMessages->numMessages;++i) strcpy(messages->messages[i],xMessages->messages[i]);
+    *station = *xBoard;
+}
+
+// Build the next board from the fetched data. Only the strings needed for display are copied across, so the board arena is much smaller than the fetch arena
+void rdmRailClient::buildBoard() {
+    TRACE_SPAN("build","rdm");
+    xBoard->numServices = xStation->numServices;
+    strcpy(xBoard->location,xStation->location);
+    xBoard->platformAvailable = xStation->platformAvailable;
+    xBoard->boardChanged = false;
+    xBoard->text.reset();
     for (int i=0;i<xStation->numServices;++i) {
-        strcpy(station->service[i].sTime, xStation->service[i].sTime);
-        strcpy(station->service[i].destination, xStation->service[i].destination);
-        strcpy(station->service[i].via, xStation->service[i].via);
-        strcpy(station->service[i].etd, xStation->service[i].etd);
-        strcpy(station->service[i].platform, xStation->service[i].platform);
-        station->service[i].isCancelled = xStation->service[i].isCancelled;
-        station->service[i].isDelayed = xStation->service[i].isDelayed;
-        station->service[i].trainLength = xStation->service[i].trainLength;
-        station->service[i].classesAvailable = xStation->service[i].classesAvailable;
-        strcpy(station->service[i].opco, xStation->service[i].opco);
-        station->service[i].serviceType = xStation->service[i].serviceType;
+        xBoard->service[i] = {};
+        xBoard->service[i].sTime = xStation->service[i].sTime;
+        xBoard->service[i].destination = xBoard->text.add(xStation->text.get(xStation->service[i].destination));
+        xBoard->service[i].via = xBoard->text.add(xStation->text.get(xStation->service[i].via));
+        strcpy(xBoard->service[i].etd, xStation->service[i].etd);
+        xBoard->service[i].etdTime = xStation->service[i].etdTime;
+        strcpy(xBoard->service[i].platform, xStation->service[i].platform);
+        xBoard->service[i].isCancelled = xStation->service[i].isCancelled;
+        xBoard->service[i].isDelayed = xStation->service[i].isDelayed;
+        xBoard->service[i].trainLength = xStation->service[i].trainLength;
+        xBoard->service[i].classesAvailable = xStation->service[i].classesAvailable;
+        xBoard->service[i].opco = xBoard->text.add(xStation->text.get(xStation->service[i].opco));
+        xBoard->service[i].serviceType = xStation->service[i].serviceType;
+        xBoard->service[i].serviceId = xStation->service[i].serviceID[0] ? hashText(FNV_OFFSET,xStation->service[i].serviceID) : 0;
     }
     if (xStation->numServices) {
-        strcpy(station->calling,xStation->service[0].calling);
-        strcpy(station->origin,xStation->service[0].origin);
-        strcpy(station->serviceMessage,xStation->service[0].serviceMessage);
+        copyCallingPoints(xBoard,xStation,0);
+        xBoard->origin = xBoard->text.add(xStation->text.get(xStation->service[0].origin));
+        xBoard->serviceMessage = xBoard->text.add(xStation->text.get(xStation->service[0].serviceMessage));
+    } else {
+        xBoard->numCalling = 0;
+        xBoard->callingTruncated = false;
+        xBoard->lastSeen = {};
+        xBoard->origin = {};
+        xBoard->serviceMessage = {};
     }
+    fingerprintBoard(xBoard,xMessages);
 }
 
 int rdmRailClient::getServiceDetails(const char *serviceID, String apiToken) {
@@ -419,8 +403,9 @@ int rdmRailClient::getServiceDetails(const char *serviceID, String apiToken) {
     unsigned long perfTimer=millis();
     bool bChunked = false;
     js->lastResultMessage[0] = '\0';
-    // Use a spare char buffer space for the last report temporary text
-    xStation->service[1].calling[0] = '\0';
+    // Temporary buffer for the last report text
+    char lastSeen[MAXLOCATIONSIZE+48];
+    lastSeen[0] = '\0';
 
     // Reset the counters
     WiFiClientSecure httpsClient;
@@ -484,12 +469,11 @@ int rdmRailClient::getServiceDetails(const char *serviceID, String apiToken) {
     parser.reset();
     fetchingDepartures = false;
     long dataReceived = 0;
-    lastLocation.actualTime[0]='\0';
     lastLocation.location[0]='\0';
-    lastLocation.scheduledTime[0]='\0';
-    thisLocation.actualTime[0]='\0';
-    thisLocation.location[0]='\0';
-    thisLocation.scheduledTime[0]='\0';
+    lastLocation.scheduledTime=NOTIME;
+    lastLocation.actualTime=NOTIME;
+    lastLocation.onTime=false;
+    thisLocation = lastLocation;
 
     char c;
     dataSendTimeout = millis() + 12000UL;
@@ -511,23 +495,18 @@ int rdmRailClient::getServiceDetails(const char *serviceID, String apiToken) {
     }
 
     // Handle possible last location
-    if (thisLocation.actualTime[0]) {
-        strcpy(lastLocation.location,thisLocation.location);
-        strcpy(lastLocation.actualTime,thisLocation.actualTime);
-        strcpy(lastLocation.scheduledTime,thisLocation.scheduledTime);
-    }
-
-    if (lastLocation.location[0] && lastLocation.actualTime[0] && lastLocation.scheduledTime[0]) {
-        sprintf(xStation->service[1].calling,".  Last seen at %s",lastLocation.location);
-        if (strcmp(lastLocation.actualTime,"On ti")==0) {
-            sprintf(xStation->service[1].calling + strlen(xStation->service[1].calling)," (%s), on time.",lastLocation.scheduledTime);
-        } else if (isdigit(lastLocation.actualTime[0]) && isdigit(lastLocation.scheduledTime[0])) {
-            int offMins = timeDiff(lastLocation.scheduledTime,lastLocation.actualTime);
-            sprintf(xStation->service[1].calling + strlen(xStation->service[1].calling)," (%s), %d %s %s.",lastLocation.actualTime, abs(offMins), abs(offMins)==1?"min":"mins", offMins>0?"early":"late");
-        }
-        if ((strlen(xStation->service[0].calling) + strlen(xStation->service[1].calling)) < MAXCALLINGSIZE) {
-            strcat(xStation->service[0].calling, xStation->service[1].calling);
+    if (thisLocation.onTime || thisLocation.actualTime != NOTIME) lastLocation = thisLocation;
+
+    if (lastLocation.location[0] && (lastLocation.onTime || lastLocation.actualTime != NOTIME) && lastLocation.scheduledTime != NOTIME) {
+        char reportTime[6];
+        sprintf(lastSeen,".  Last seen at %s",lastLocation.location);
+        if (lastLocation.onTime) {
+            sprintf(lastSeen + strlen(lastSeen)," (%s), on time.",formatTime(lastLocation.scheduledTime,reportTime));
+        } else {
+            int offMins = timeDifference(lastLocation.scheduledTime,lastLocation.actualTime);
+            sprintf(lastSeen + strlen(lastSeen)," (%s), %d %s %s.",formatTime(lastLocation.actualTime,reportTime), abs(offMins), abs(offMins)==1?"min":"mins", offMins>0?"early":"late");
         }
+        xStation->lastSeen = xStation->text.add(lastSeen);
     }
 
     sprintf(js->lastResultMessage,"[SD] OK: D:%d T:%d ",dataReceived,millis()-perfTimer);
@@ -548,30 +527,34 @@ void rdmRailClient::deleteService(int x) {
   xStation->numServices--;
 }
 
-int rdmRailClient::timeDiff(const char *scheduled, const char *actual) {
-    int h_scheduled, m_scheduled;
-    int h_actual, m_actual;
-
-    sscanf(scheduled, "%d:%d", &h_scheduled, &m_scheduled);
-    sscanf(actual, "%d:%d", &h_actual, &m_actual);
-
-    int mins_scheduled = (h_scheduled * 60) + m_scheduled;
-    int mins_actual = (h_actual * 60) + m_actual;
-    int diff = mins_scheduled - mins_actual;
-
-    // Handle midnight wrap-around
-    if (diff > 720) diff -= 1440;
-    else if (diff < -720) diff += 1440;
-
-    return diff;
+void rdmRailClient::clearService(int x) {
+    xStation->service[x].sTime=NOTIME;
+    xStation->service[x].destination = {};
+    xStation->service[x].via = {};
+    xStation->service[x].origin = {};
+    strcpy(xStation->service[x].etd,"");
+    xStation->service[x].etdTime=NOTIME;
+    strcpy(xStation->service[x].platform,"");
+    xStation->service[x].opco = {};
+    xStation->service[x].firstCalling = 0;
+    xStation->service[x].numCalling = 0;
+    xStation->service[x].callingTruncated = false;
+    xStation->service[x].serviceMessage = {};
+    strcpy(xStation->service[x].serviceID,"");
+    xStation->service[x].trainLength=0;
+    xStation->service[x].classesAvailable=0;
+    xStation->service[x].serviceType=0;
+    xStation->service[x].isCancelled=false;
+    xStation->service[x].isDelayed=false;
 }
 
 void rdmRailClient::sanitiseData() {
+    TRACE_SPAN("sanitise","rdm");
 
   int i=0;
   while (i<xStation->numServices) {
     // Remove any services that are missing destinations/std/etd
-    if (!xStation->service[i].destination[0] || !xStation->service[i].etd[0] || !xStation->service[i].sTime[0]) deleteService(i);
+    if (!xStation->service[i].destination.length || (!xStation->service[i].etd[0] && xStation->service[i].etdTime == NOTIME) || xStation->service[i].sTime == NOTIME) deleteService(i);
     else i++;
   }
 
@@ -581,20 +564,15 @@ void rdmRailClient::sanitiseData() {
 
   for (int i=0;i<xStation->numServices;++i) {
     // first change any &lt; &gt;
-    removeHtmlTags(xStation->service[i].destination);
-    replaceWord(xStation->service[i].destination,"&amp;","&");
-    removeHtmlTags(xStation->service[i].via);
-    replaceWord(xStation->service[i].via,"&amp;","&");
+    sanitiseText(xStation->service[i].destination);
+    sanitiseText(xStation->service[i].via);
     if (i==0) {
-        removeHtmlTags(xStation->service[i].calling);
-        replaceWord(xStation->service[i].calling,"&amp;","&");
-        removeHtmlTags(xStation->service[i].opco);
-        replaceWord(xStation->service[i].opco,"&amp;","&");
-        removeHtmlTags(xStation->service[i].origin);
-        replaceWord(xStation->service[i].origin,"&amp;","&");
-        removeHtmlTags(xStation->service[i].serviceMessage);
-        replaceWord(xStation->service[i].serviceMessage,"&amp;","&");
-        replaceWord(xStation->service[i].serviceMessage,"&quot;","\"");
+        for (int c=0;c<xStation->service[i].numCalling;c++) sanitiseText(xStation->callingPoints[xStation->service[i].firstCalling+c].name);
+        sanitiseText(xStation->service[i].opco);
+        sanitiseText(xStation->service[i].origin);
+        sanitiseText(xStation->service[i].serviceMessage);
+        replaceWord(xStation->text.edit(xStation->service[i].serviceMessage),"&quot;","\"");
+        xStation->text.refresh(xStation->service[i].serviceMessage);
         fixFullStop(xStation->service[i].serviceMessage);
     }
   }
@@ -681,21 +659,17 @@ void rdmRailClient::key(const char *key) {
 
 void rdmRailClient::value(const char *value) {
     if (fetchingDepartures) {
+        // Ignore any services beyond the end of the service array
+        if (id >= MAXBOARDSERVICES && strcmp(js->currentPath, "/locationName") && strcmp(js->currentPath, "/platformAvailable") && strcmp(js->arrayName, "/nrccMessages")) return;
         if (strcmp(js->currentKey, "locationName")==0 && inCallingArray == 1) {
-            // Check if there's room to add another stopping point
-            if ((strlen(xStation->service[id].calling) + strlen(value) + 13) < sizeof(xStation->service[0].calling)) {
-                // Add the calling point, add a comma prefix if this isn't the first one
-                if (xStation->service[id].calling[0]) strcat(xStation->service[id].calling,", ");
-                strcat(xStation->service[id].calling,value);
-                addedStopLocation = true;
-            }
+            addedStopLocation = addCallingPoint(xStation,id,value);
             return;
         } else if (strcmp(js->currentKey, "st")==0 && inCallingArray == 1 && addedStopLocation) {
-            // check there's still room to add the eta of the calling point
-            if ((strlen(xStation->service[id].calling) + strlen(value) + 4) < sizeof(xStation->service[0].calling)) {
-                sprintf(xStation->service[id].calling + strlen(xStation->service[id].calling)," (%s)",value);
-            }
-            addedStopLocation = false;
+            xStation->callingPoints[xStation->numCallingPoints-1].scheduled = parseTime(value);
+            return;
+        } else if (strcmp(js->currentKey, "et")==0 && inCallingArray == 1 && addedStopLocation) {
+            callingPoint *stop = &xStation->callingPoints[xStation->numCallingPoints-1];
+            stop->expected = (strcmp(value,"On time")==0) ? stop->scheduled : parseTime(value);
             return;
         } else if (strcmp(js->currentKey, "coachClass")==0 && strcmp(js->arrayName, "formation/coaches")==0 && arrayNestLevel==2) {
             if (strcmp(value,"First")==0) xStation->service[id].classesAvailable = xStation->service[id].classesAvailable | 1;
@@ -706,33 +680,35 @@ void rdmRailClient::value(const char *value) {
             xStation->service[id].trainLength = atoi(value);
             return;
         } else if (strcmp(js->currentPath, "/operator")==0) {
-            strlcpy(xStation->service[id].opco,value,sizeof(xStation->service[0].opco));
+            xStation->service[id].opco = xStation->text.add(value,MAXOPCOSIZE);
             return;
         } else if (strcmp(js->currentPath, "origin/locationName")==0) {
-            strlcpy(xStation->service[id].origin,value,sizeof(xStation->service[0].origin));
+            xStation->service[id].origin = xStation->text.add(value,MAXLOCATIONSIZE);
             return;
         } else if (strcmp(js->currentPath, "/serviceType")==0) {
             if (strcmp(value,"train")==0) xStation->service[id].serviceType = TRAIN;
             else if (strcmp(value,"bus")==0) xStation->service[id].serviceType = BUS;
             return;
         } else if (strcmp(js->currentPath, "/std")==0) {
-            strlcpy(xStation->service[id].sTime,value,sizeof(xStation->service[0].sTime));
+            xStation->service[id].sTime = parseTime(value);
             return;
         } else if (strcmp(js->currentPath, "/etd")==0) {
-            strlcpy(xStation->service[id].etd,value,sizeof(xStation->service[0].etd));
+            // Keep the text only if it's a status rather than an estimated time
+            xStation->service[id].etdTime = parseTime(value);
+            if (xStation->service[id].etdTime == NOTIME) strlcpy(xStation->service[id].etd,value,sizeof(xStation->service[0].etd));
             return;
         } else if (strcmp(js->currentPath, "destination/locationName")==0) {
-            strlcpy(xStation->service[id].destination,value,sizeof(xStation->service[0].destination));
+            xStation->service[id].destination = xStation->text.add(value,MAXLOCATIONSIZE);
             return;
         } else if (strcmp(js->currentPath, "destination/via")==0) {
-            strlcpy(xStation->service[id].via,value,sizeof(xStation->service[0].via));
+            xStation->service[id].via = xStation->text.add(value,MAXLOCATIONSIZE);
             return;
         } else if (strcmp(js->currentPath, "/delayReason")==0) {
-            strlcpy(xStation->service[id].serviceMessage,value,sizeof(xStation->service[0].serviceMessage));
+            xStation->service[id].serviceMessage = xStation->text.add(value,MAXMESSAGESIZE);
             xStation->service[id].isDelayed = true;
             return;
         } else if (strcmp(js->currentPath, "/cancelReason")==0) {
-            strlcpy(xStation->service[id].serviceMessage,value,sizeof(xStation->service[0].serviceMessage));
+            xStation->service[id].serviceMessage = xStation->text.add(value,MAXMESSAGESIZE);
             xStation->service[id].isCancelled = true;
             return;
         } else if (strcmp(js->currentPath, "/platform")==0) {
@@ -745,28 +721,19 @@ void rdmRailClient::value(const char *value) {
             // This should mark the end of this service, so check if we need to keep it and add it to the list
             if (xStation->numServices < MAXBOARDSERVICES) {
                 if (filterPlatforms && !keepRoute) {
-                    // We don't want this service, so clear it
-                    strcpy(xStation->service[id].sTime,"");
-                    strcpy(xStation->service[id].destination,"");
-                    strcpy(xStation->service[id].via,"");
-                    strcpy(xStation->service[id].origin,"");
-                    strcpy(xStation->service[id].etd,"");
-                    strcpy(xStation->service[id].platform,"");
-                    strcpy(xStation->service[id].opco,"");
-                    strcpy(xStation->service[id].calling,"");
-                    strcpy(xStation->service[id].serviceMessage,"");
-                    xStation->service[id].trainLength=0;
-                    xStation->service[id].classesAvailable=0;
-                    xStation->service[id].serviceType=0;
-                    xStation->service[id].isCancelled=false;
-                    xStation->service[id].isDelayed=false;
+                    // We don't want this service, so clear it and give back its text
+                    releaseCallingPoints(xStation,id);
+                    clearService(id);
+                    xStation->text.release(serviceMark);
                 } else {
                     if (xStation->service[id].trainLength == 0) xStation->service[id].trainLength = coaches;
                     xStation->numServices++;
                     id++;
+                    serviceMark = xStation->text.mark();
                 }
                 coaches=0;
                 keepRoute = false;
+                addedStopLocation = false;
             }
             return;
         } else if (strcmp(js->currentPath, "/locationName")==0) {
@@ -786,20 +753,18 @@ void rdmRailClient::value(const char *value) {
         // Loading service details
         if (strcmp(js->currentKey, "locationName")==0 && inCallingArray == 1) {
             // Next location, save the previous one if it has an actual time
-            if (thisLocation.actualTime[0]) {
-                strcpy(lastLocation.location,thisLocation.location);
-                strcpy(lastLocation.actualTime,thisLocation.actualTime);
-                strcpy(lastLocation.scheduledTime,thisLocation.scheduledTime);
-            }
+            if (thisLocation.onTime || thisLocation.actualTime != NOTIME) lastLocation = thisLocation;
             strlcpy(thisLocation.location,value,sizeof(thisLocation.location));
-            thisLocation.actualTime[0]='\0';
-            thisLocation.scheduledTime[0]='\0';
+            thisLocation.scheduledTime=NOTIME;
+            thisLocation.actualTime=NOTIME;
+            thisLocation.onTime=false;
             return;
         } else if (strcmp(js->currentKey, "st")==0 && inCallingArray == 1) {
-            strlcpy(thisLocation.scheduledTime,value,sizeof(thisLocation.scheduledTime));
+            thisLocation.scheduledTime = parseTime(value);
             return;
         } else if (strcmp(js->currentKey, "at")==0 && inCallingArray == 1) {
-            strlcpy(thisLocation.actualTime,value,sizeof(thisLocation.actualTime));
+            thisLocation.actualTime = parseTime(value);
+            thisLocation.onTime = (strcmp(value,"On time")==0);
             return;
         }
     }
@@ -14,6 +14,8 @@
 #include "JsonStreamingParserGS.h"
 #include <sharedDataStructs.h>
 #include <responseCodes.h>
+#include <boardDiff.h>
+#include <callingPoints.h>
 
 #define MAXHOSTSIZE 48
 #define MAXAPIURLSIZE 48
@@ -26,8 +28,9 @@ class rdmRailClient: public JsonListenerGS {
 
         struct rdiLocation {
           char location[MAXLOCATIONSIZE];
-          char scheduledTime[6];
-          char actualTime[6];
+          uint16_t scheduledTime;
+          uint16_t actualTime;
+          bool onTime;
         };
 
         const char* rdmHost = "api1.raildata.org.uk";
@@ -38,6 +41,7 @@ class rdmRailClient: public JsonListenerGS {
         int arrayNestLevel = 0;
         bool fetchingDepartures;
         rdiStation* xStation = nullptr;
+        rdStation* xBoard = nullptr;   // The next board to display, built at the end of each fetch
         stnMessages* xMessages = nullptr;
         sharedBufferSpace* js = nullptr;
 
@@ -46,6 +50,7 @@ class rdmRailClient: public JsonListenerGS {
 
         bool addedStopLocation = false;
         int id=0;
+        uint16_t serviceMark = 0;   // Arena position at the start of the current service
         int coaches=0;
 
         bool firstDataLoad;
@@ -60,8 +65,11 @@ class rdmRailClient: public JsonListenerGS {
         void replaceWord(char* input, const char* target, const char* replacement);
         void pruneFromPhrase(char* input, const char* target);
         void fixFullStop(char* input);
-        int timeDiff(const char *scheduled, const char *actual);
+        void fixFullStop(strRef &text);
+        void sanitiseText(strRef &text);
+        void clearService(int x);
         void sanitiseData();
+        void buildBoard();
         void deleteService(int x);
         void trim(char* &start, char* &end);
         bool equalsIgnoreCase(const char* a, int a_len, const char* b);
@@ -80,7 +88,7 @@ class rdmRailClient: public JsonListenerGS {
         virtual void startObject();
 
     public:
-        rdmRailClient(rdiStation *station, stnMessages *messages, sharedBufferSpace *sharedBuffer);
+        rdmRailClient(rdiStation *station, rdStation *board, stnMessages *messages, sharedBufferSpace *sharedBuffer);
         void cleanFilter(const char* rawFilter, char* cleanedFilter, size_t maxLen);
         int fetchDepartures(rdStation *station, stnMessages *messages, const char *crsCode, String departuresApiKey, String serviceApiKey, int numRows, bool includeBusServices, const char *callingCrsCode, const char *platforms, int timeOffset, bool fetchLastSeen, bool includeServiceMessages);
         void loadDepartures(rdStation *station, stnMessages *messages);
@@ -0,0 +1,29 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * rowLayout Library - a board row laid out ready to draw
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <rowLayout.h>
+
+void rowLayout::clear(const uint8_t *font) {
+    rowFont = font;
+    numRuns = 0;
+    used = 0;
+}
+
+bool rowLayout::add(int x, const char *s) {
+    size_t length = strlen(s);
+    if (numRuns >= MAXLAYOUTRUNS || used + length + 1 > MAXLAYOUTTEXT) return false;
+    runX[numRuns] = x;
+    runStart[numRuns] = used;
+    memcpy(text+used,s,length+1);
+    used += length + 1;
+    numRuns++;
+    return true;
+}
@@ -0,0 +1,43 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * rowLayout Library - a board row laid out ready to draw
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#define MAXLAYOUTRUNS 5       // Separately positioned pieces of text in a row
+#define MAXLAYOUTTEXT 160     // Total text in a row, including terminators
+
+//
+// The text of a row is formatted, clipped and positioned once when the board data changes. Drawing the row
+// is then just a drawStr for each run of text, however many times it's redrawn while scrolling.
+//
+class rowLayout {
+
+    private:
+        const uint8_t *rowFont = nullptr;
+        uint8_t numRuns = 0;
+        uint8_t used = 0;
+        int16_t runX[MAXLAYOUTRUNS];
+        uint8_t runStart[MAXLAYOUTRUNS];
+        char text[MAXLAYOUTTEXT];
+
+    public:
+        // Empty the row, which will be drawn in font
+        void clear(const uint8_t *font);
+
+        // Add text to be drawn at x. Returns false if the row is full.
+        bool add(int x, const char *s);
+
+        const uint8_t *font() const { return rowFont; }
+        int count() const { return numRuns; }
+        int x(int run) const { return runX[run]; }
+        const char *runText(int run) const { return text + runStart[run]; }
+};
@@ -14,6 +14,7 @@
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
 #include <WiFiClient.h>
+#include <fetchMetrics.h>
 
 rssClient::rssClient(sharedBufferSpace *sharedBuffer) : js(sharedBuffer) {}
 
@@ -40,6 +41,7 @@ int rssClient::loadFeed(String url) {
     WiFiClientSecure clientSecure;
 
     unsigned long perfTimer = millis();
+    fetchTrace trace(UPSTREAM_RSS);
     int redirectCount = 0;
     const int maxRedirects = 5;
 
@@ -51,6 +53,7 @@ int rssClient::loadFeed(String url) {
         if (url.startsWith("https")) http.begin(clientSecure,url);
         else http.begin(client, url);
         int httpCode = http.GET();
+        trace.mark(PHASE_WAIT);     // HTTPClient connects, sends the request and reads the headers in one go
         if (httpCode == HTTP_CODE_OK) {
             WiFiClient *stream = http.getStreamPtr();
             xmlStreamingParser parser;
@@ -74,6 +77,8 @@ int rssClient::loadFeed(String url) {
             }
 
             http.end();
+            trace.setBytes(dataReceived);
+            trace.mark(PHASE_BODY);
             if (millis() >= dataSendTimeout) {
                 return UPD_TIMEOUT;
             }
@@ -0,0 +1,28 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * scrollMotion Library - scroll positions worked out from elapsed time
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <scrollMotion.h>
+
+void scrollMotion::start(int from, int to, int pixelsPerSec, unsigned long startAt) {
+    this->from = from;
+    this->to = to;
+    speed = pixelsPerSec;
+    startMs = startAt;
+}
+
+int scrollMotion::position() const {
+    long elapsed = (long)(millis() - startMs);
+    if (elapsed <= 0) return from;
+    long distance = (long)((int64_t)elapsed * speed / 1000);
+    int length = abs(to - from);
+    if (distance >= length) return to;
+    return (to > from) ? from + distance : from - distance;
+}
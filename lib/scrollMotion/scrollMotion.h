@@ -0,0 +1,40 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * scrollMotion Library - scroll positions worked out from elapsed time
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+//
+// Moves from one position to another at a fixed number of pixels per second. The position depends only on
+// the time since the move started, so a late or dropped frame doesn't slow the scrolling down.
+//
+class scrollMotion {
+
+    private:
+        unsigned long startMs = 0;
+        int from = 0;
+        int to = 0;
+        int speed = 0;      // Pixels per second
+
+    public:
+        // Start moving at startAt (defaults to now). Until then the position stays at from.
+        void start(int from, int to, int pixelsPerSec, unsigned long startAt);
+        void start(int from, int to, int pixelsPerSec) {
+            start(from,to,pixelsPerSec,millis());
+        }
+
+        // The position now (to once the move has finished)
+        int position() const;
+
+        bool finished() const {
+            return position() == to;
+        }
+};
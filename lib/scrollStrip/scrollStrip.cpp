@@ -0,0 +1,128 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * scrollStrip Library - pre-rendered text strips for the horizontally scrolling messages
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <scrollStrip.h>
+
+// The strip is taken from scratch rows 8 onwards, leaving room above for glyphs drawn higher than the strip
+#define SCRATCHWIDTH 256
+#define SCRATCHTOP 8
+
+scrollStrip::~scrollStrip() {
+    free(rows);
+}
+
+void scrollStrip::clear() {
+    width = 0;
+    attempted = false;
+    if (capacity > STRIPKEEPWIDTH) {
+        free(rows);
+        rows = nullptr;
+        capacity = 0;
+    }
+}
+
+// Copy a rendered chunk from the scratch buffer into the strip. u8g2 frame buffers hold 8 vertical pixels
+// per byte (top row in bit 0) with each tile row of 8 pixels following on from the previous one.
+void scrollStrip::copyChunk(int chunkStart, int chunkWidth) {
+    for (int x=0;x<chunkWidth;x++) {
+        uint16_t column = scratch[SCRATCHWIDTH+x] | (scratch[SCRATCHWIDTH*2+x] << 8);
+        if (!column) continue;
+        int sx = chunkStart+x;
+        uint8_t bit = 1 << (sx & 7);
+        for (int r=0;r<STRIPHEIGHT;r++) {
+            if (column & (1<<r)) rows[r*stride + (sx>>3)] |= bit;
+        }
+    }
+}
+
+bool scrollStrip::render(U8G2 *display, const char *text, int textWidth, int y) {
+    width = 0;
+    attempted = true;
+    if (textWidth <= 0 || textWidth > STRIPMAXWIDTH) return false;
+    if (textWidth > capacity) {
+        // Nothing in the old strip is needed, so free it first rather than realloc (which may copy it)
+        free(rows);
+        capacity = ((textWidth + STRIPALLOCSTEP - 1) / STRIPALLOCSTEP) * STRIPALLOCSTEP;
+        rows = (uint8_t *)malloc(STRIPHEIGHT * (capacity/8));
+        if (!rows) {
+            capacity = 0;
+            return false;
+        }
+    }
+    stride = (textWidth + 7) / 8;
+    memset(rows,0,STRIPHEIGHT*stride);
+
+    // Point u8g2 at the scratch buffer and draw the text a screen width at a time
+    u8g2_t *u8g2 = display->getU8g2();
+    uint8_t *frameBuffer = u8g2->tile_buf_ptr;
+    u8g2->tile_buf_ptr = scratch;
+    display->setClipWindow(0,0,SCRATCHWIDTH,sizeof(scratch)/SCRATCHWIDTH*8);
+    int maxGlyphWidth = display->getMaxCharWidth();
+
+    // Glyphs that reach into the next chunk are drawn again there, so track the first one that does
+    const uint8_t *first = (const uint8_t *)text;
+    int firstX = 0;
+    for (int chunkStart=0;chunkStart<textWidth;chunkStart+=SCRATCHWIDTH) {
+        memset(scratch,0,sizeof(scratch));
+        const uint8_t *p = first;
+        int x = firstX;
+        bool carry = false;
+        while (*p && x < chunkStart+SCRATCHWIDTH) {
+            int advance = display->drawGlyph(x-chunkStart,SCRATCHTOP+y,*p);
+            if (!carry && x+maxGlyphWidth > chunkStart+SCRATCHWIDTH) {
+                first = p;
+                firstX = x;
+                carry = true;
+            }
+            x += advance;
+            p++;
+        }
+        if (!carry) {
+            first = p;
+            firstX = x;
+        }
+        copyChunk(chunkStart,min(SCRATCHWIDTH,textWidth-chunkStart));
+    }
+
+    display->setMaxClipWindow();
+    u8g2->tile_buf_ptr = frameBuffer;
+    width = textWidth;
+    return true;
+}
+
+void scrollStrip::draw(U8G2 *display, int x, int y, int height) {
+    if (height > STRIPHEIGHT) height = STRIPHEIGHT;
+    uint8_t *buffer = display->getBufferPtr();
+    int bufferWidth = display->getBufferTileWidth()*8;
+    int tileRows = display->getBufferTileHeight();
+    int firstTile = y >> 3;
+    int shift = y & 7;
+    uint32_t mask = ((1UL<<height)-1) << shift;
+
+    for (int sx=0;sx<bufferWidth;sx++) {
+        int column = x + sx;
+        uint32_t bits = 0;
+        if (column >= 0 && column < width) {
+            const uint8_t *b = rows + (column >> 3);
+            uint8_t bit = 1 << (column & 7);
+            for (int r=0;r<height;r++,b+=stride) {
+                if (*b & bit) bits |= 1UL << r;
+            }
+            bits <<= shift;
+        }
+        for (int t=0;t<3;t++) {
+            uint8_t byteMask = mask >> (t*8);
+            if (!byteMask || firstTile+t >= tileRows) continue;
+            uint8_t *b = buffer + (firstTile+t)*bufferWidth + sx;
+            *b = (*b & ~byteMask) | ((bits >> (t*8)) & byteMask);
+        }
+    }
+}
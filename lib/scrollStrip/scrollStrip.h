@@ -0,0 +1,60 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * scrollStrip Library - pre-rendered text strips for the horizontally scrolling messages
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+#define STRIPHEIGHT 10          // Pixel rows held for each column
+#define STRIPMAXWIDTH 10240     // Widest message that's pre-rendered (wider ones are drawn as text, 12.5K at 1 bit per pixel)
+#define STRIPALLOCSTEP 1024     // The strip buffer is sized in steps of this many columns
+#define STRIPKEEPWIDTH 2048     // Buffers up to this wide are kept for the next message, larger ones are freed
+
+//
+// A message is drawn once into an offscreen strip (one bit per pixel, a row at a time) when it starts to
+// scroll. Each frame then copies a screen-wide window of the strip into the frame buffer, so the cost per
+// frame doesn't depend on the length of the message. A small buffer is kept and reused for the next message,
+// one for a long message is freed as soon as it's cleared so it doesn't stay held between fetches.
+//
+class scrollStrip {
+
+    private:
+        uint8_t *rows = nullptr;    // STRIPHEIGHT rows of stride bytes, leftmost column in bit 0
+        int capacity = 0;       // Columns allocated
+        int stride = 0;         // Bytes per row
+        int width = 0;          // Columns rendered (0 if nothing is ready)
+        bool attempted = false; // render() has been called for the current message
+        uint8_t scratch[3*256]; // Three tile rows of frame buffer to render into
+
+        void copyChunk(int chunkStart, int chunkWidth);
+
+    public:
+        ~scrollStrip();
+
+        // Render text in the display's current font. y is where the text would be drawn relative to the top
+        // row of the strip. Returns false if the text is too wide or there isn't enough memory.
+        bool render(U8G2 *display, const char *text, int textWidth, int y);
+
+        // Copy the strip into the frame buffer. Strip column x is drawn at the left of the screen, replacing rows y to y+height-1.
+        void draw(U8G2 *display, int x, int y, int height);
+
+        bool isReady() const {
+            return width > 0;
+        }
+
+        // True until the current message has been rendered (or has failed to render)
+        bool needsRender() const {
+            return !attempted;
+        }
+
+        // The message has changed, so render it again before it's next drawn
+        void clear();
+};
@@ -0,0 +1,61 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * serviceTime Library - compact minute-of-day times for departure data
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <serviceTime.h>
+#include <time.h>
+
+uint16_t parseTime(const char *text) {
+    if (!text) return NOTIME;
+    // Strictly "hh:mm" (optionally followed by ":ss" or other text which is ignored)
+    if (!isdigit(text[0]) || !isdigit(text[1]) || text[2] != ':' || !isdigit(text[3]) || !isdigit(text[4])) return NOTIME;
+    int hours = (text[0]-'0')*10 + (text[1]-'0');
+    int mins = (text[3]-'0')*10 + (text[4]-'0');
+    if (hours > 23 || mins > 59) return NOTIME;
+    return hours*60 + mins;
+}
+
+char *formatTime(uint16_t mins, char *buffer) {
+    if (mins >= MINSPERDAY) {
+        buffer[0] = '\0';
+    } else {
+        int hours = mins / 60;
+        mins = mins % 60;
+        buffer[0] = '0' + hours/10;
+        buffer[1] = '0' + hours%10;
+        buffer[2] = ':';
+        buffer[3] = '0' + mins/10;
+        buffer[4] = '0' + mins%10;
+        buffer[5] = '\0';
+    }
+    return buffer;
+}
+
+int timeDifference(uint16_t a, uint16_t b) {
+    int diff = (int)a - (int)b;
+
+    // Handle midnight wrap-around
+    if (diff > MINSPERDAY/2) diff -= MINSPERDAY;
+    else if (diff < -MINSPERDAY/2) diff += MINSPERDAY;
+
+    return diff;
+}
+
+uint16_t serviceDayMinutes(uint16_t mins, uint16_t reference) {
+    if (mins >= MINSPERDAY) return NOTIME;
+    if (reference >= MINSPERDAY) return mins;   // No clock, so just use the time of day
+    return (mins + MINSPERDAY + SERVICEDAYLEAD - reference) % MINSPERDAY;
+}
+
+uint16_t currentMinutes() {
+    struct tm nowtime;
+    if (!getLocalTime(&nowtime,0)) return NOTIME;
+    return nowtime.tm_hour*60 + nowtime.tm_min;
+}
@@ -0,0 +1,33 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * serviceTime Library - compact minute-of-day times for departure data
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+#define NOTIME 0xFFFF           // No (or not a) time
+#define MINSPERDAY 1440
+#define SERVICEDAYLEAD 360      // Sort window starts 6 hours before the time of the fetch
+
+// Parse "hh:mm" into minutes since midnight. Returns NOTIME for anything else ("On time", "Delayed" etc.)
+uint16_t parseTime(const char *text);
+
+// Format minutes since midnight as "hh:mm" into a buffer of at least 6 chars. NOTIME gives an empty string.
+char *formatTime(uint16_t mins, char *buffer);
+
+// Signed difference (a - b) in minutes, allowing for the times being either side of midnight
+int timeDifference(uint16_t a, uint16_t b);
+
+// Minutes since the start of the service day used for sorting. The day starts SERVICEDAYLEAD minutes
+// before the reference (fetch) time so that a late 23:58 sorts before a 00:05 on the same board.
+uint16_t serviceDayMinutes(uint16_t mins, uint16_t reference);
+
+// Current local time in minutes since midnight (NOTIME if the clock isn't set)
+uint16_t currentMinutes();
@@ -0,0 +1,80 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * spanTrace Library - timestamped spans in a ring buffer, exported as Chrome trace JSON
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <spanTrace.h>
+
+static traceSpan fetchSpans[SPANTRACESIZE];
+static traceSpan renderSpans[RENDERTRACESIZE];
+
+spanTrace spanLog(fetchSpans,SPANTRACESIZE);
+spanTrace renderLog(renderSpans,RENDERTRACESIZE);
+
+void spanTrace::record(const char *name, const char *category, uint32_t start, uint32_t end) {
+    uint32_t slot = head.fetch_add(1,std::memory_order_relaxed) & mask;
+    traceSpan &span = spans[slot];
+    span.name = nullptr;
+    span.category = category;
+    span.start = start;
+    span.duration = end - start;
+    span.core = xPortGetCoreID();
+    span.name = name;
+}
+
+bool spanTrace::newestStart(uint32_t &start) const {
+    uint32_t end = head.load(std::memory_order_relaxed);
+    if (!end) return false;
+    start = spans[(end-1) & mask].start;
+    return true;
+}
+
+uint32_t spanTrace::earliestStart(uint32_t newest) const {
+    uint32_t end = head.load(std::memory_order_relaxed);
+    uint32_t count = end <= mask ? end : mask+1;
+
+    // Spans are stored as they finish, so the earliest start isn't always the oldest slot
+    uint32_t base = newest;
+    for (uint32_t i=end-count;i!=end;i++) {
+        const traceSpan &span = spans[i & mask];
+        if (span.name && (int32_t)(span.start - newest) < (int32_t)(base - newest)) base = span.start;
+    }
+    return base;
+}
+
+void spanTrace::writeEvents(Print &out, uint32_t base) const {
+    uint32_t end = head.load(std::memory_order_relaxed);
+    uint32_t count = end <= mask ? end : mask+1;
+
+    for (uint32_t i=end-count;i!=end;i++) {
+        traceSpan span = spans[i & mask];
+        if (!span.name) continue;
+        out.printf(",{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%u,\"dur\":%u,\"pid\":1,\"tid\":%u}",span.name,span.category,span.start-base,span.duration,span.core);
+    }
+}
+
+void writeTraceJson(Print &out) {
+    // Timestamps are made relative to the earliest span in either buffer. Both are compared against the newest
+    // span so a micros() wrap inside the buffers is handled.
+    uint32_t newest = 0;
+    uint32_t renderNewest;
+    bool haveSpans = spanLog.newestStart(newest);
+    if (renderLog.newestStart(renderNewest) && (!haveSpans || (int32_t)(renderNewest - newest) > 0)) newest = renderNewest;
+    uint32_t base = spanLog.earliestStart(newest);
+    uint32_t renderBase = renderLog.earliestStart(newest);
+    if ((int32_t)(renderBase - newest) < (int32_t)(base - newest)) base = renderBase;
+
+    out.print("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    out.print("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Departures Board\"}},");
+    out.print("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Core 0 (fetch)\"}},");
+    out.print("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Core 1 (display)\"}}");
+    spanLog.writeEvents(out,base);
+    renderLog.writeEvents(out,base);
+    out.print("]}");
+}
@@ -0,0 +1,88 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * spanTrace Library - timestamped spans in a ring buffer, exported as Chrome trace JSON
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+#define SPANTRACESIZE 256       // Fetch and board spans kept (20 bytes each), must be a power of two
+#define RENDERTRACESIZE 64      // Per-frame render spans kept, about a second of frames (power of two)
+
+// Names and categories must be string literals (or otherwise never freed), only the pointer is stored
+struct traceSpan {
+    const char *name;
+    const char *category;
+    uint32_t start;             // micros()
+    uint32_t duration;
+    uint8_t core;
+};
+
+//
+// Both cores write spans. Each writer claims a slot with an atomic increment and fills it in, so recording
+// a span never blocks. Once the buffer has wrapped the oldest spans are overwritten. A dump taken while a
+// span is being written may show that one slot with a mix of old and new values.
+//
+class spanTrace {
+
+    private:
+        traceSpan *spans;
+        uint32_t mask;
+        std::atomic<uint32_t> head{0};
+
+    public:
+        spanTrace(traceSpan *buffer, uint32_t size) : spans(buffer), mask(size-1) {}
+
+        void record(const char *name, const char *category, uint32_t start, uint32_t end);
+
+        void record(const char *name, const char *category, uint32_t start) {
+            record(name,category,start,micros());
+        }
+
+        // Start of the most recently recorded span, false if there are none
+        bool newestStart(uint32_t &start) const;
+        // Earliest start in the buffer, compared against newest so a micros() wrap is handled
+        uint32_t earliestStart(uint32_t newest) const;
+        // Write each span as a Chrome trace event, with times relative to base
+        void writeEvents(Print &out, uint32_t base) const;
+};
+
+// Frames and panel flushes arrive ~80 times a second, so they have their own ring and can't push the
+// (much rarer) fetch spans out of spanLog
+extern spanTrace spanLog;
+extern spanTrace renderLog;
+
+// Write both buffers in the Chrome trace event format (chrome://tracing or ui.perfetto.dev), one thread per core
+void writeTraceJson(Print &out);
+
+// Records a span from construction until it goes out of scope
+class spanScope {
+
+    private:
+        spanTrace &log;
+        const char *name;
+        const char *category;
+        uint32_t start;
+
+    public:
+        spanScope(spanTrace &traceLog, const char *spanName, const char *spanCategory) : log(traceLog), name(spanName), category(spanCategory), start(micros()) {}
+
+        ~spanScope() {
+            log.record(name,category,start);
+        }
+};
+
+#define SPANCONCAT2(a,b) a##b
+#define SPANCONCAT(a,b) SPANCONCAT2(a,b)
+
+// Time the rest of the enclosing block
+#define TRACE_SPAN(name,category) spanScope SPANCONCAT(traceSpan_,__LINE__)(spanLog,name,category)
+// The same for code that runs every frame
+#define TRACE_RENDER_SPAN(name) spanScope SPANCONCAT(traceSpan_,__LINE__)(renderLog,name,"render")
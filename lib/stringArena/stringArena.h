@@ -0,0 +1,121 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * stringArena Library - fixed-size bump allocator for the text held by the board data structures
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+
+// Reference to a null terminated string held in a stringArena. A zero length is an empty string.
+struct strRef {
+    uint16_t offset;
+    uint16_t length;
+};
+
+//
+// Strings are packed end to end into a single buffer which is reset at the start of each fetch, so
+// the board structures only carry a 4 byte reference per field instead of a worst-case char array.
+// If the arena fills up new strings are dropped (stored as empty) rather than overwriting anything.
+//
+template <uint16_t ARENASIZE>
+class stringArena {
+
+    private:
+        char data[ARENASIZE];
+        uint16_t used = 0;
+
+    public:
+        // Discard everything held in the arena
+        void reset() {
+            used = 0;
+        }
+
+        // Current allocation point, used to roll back strings belonging to a discarded service
+        uint16_t mark() const {
+            return used;
+        }
+
+        void release(uint16_t toMark) {
+            if (toMark < used) used = toMark;
+        }
+
+        uint16_t bytesUsed() const {
+            return used;
+        }
+
+        uint16_t capacity() const {
+            return ARENASIZE;
+        }
+
+        // Copy a string into the arena, truncating it to fit a buffer of maxSize bytes (as strlcpy)
+        strRef add(const char *text, size_t maxSize = ARENASIZE) {
+            strRef ref = {0,0};
+            if (!text || !text[0] || maxSize < 2) return ref;
+            size_t len = strnlen(text,maxSize-1);
+            if (used + len + 1 > ARENASIZE) return ref;
+            memcpy(data+used,text,len);
+            data[used+len] = '\0';
+            ref.offset = used;
+            ref.length = len;
+            used += len + 1;
+            return ref;
+        }
+
+        // Append to an existing string. Extends in place if it's the most recent allocation, otherwise
+        // the string is moved to the end of the arena. Returns false (leaving ref unchanged) if it won't fit.
+        bool append(strRef &ref, const char *text, size_t maxSize = ARENASIZE) {
+            size_t extra = strlen(text);
+            if (!extra) return true;
+            if (ref.length + extra + 1 > maxSize) return false;
+            if (!ref.length) {
+                ref = add(text,maxSize);
+                return ref.length != 0;
+            }
+            if (ref.offset + ref.length + 1 != used) {
+                // Not at the end of the arena so relocate it first
+                if (used + ref.length + extra + 1 > ARENASIZE) return false;
+                memcpy(data+used,data+ref.offset,ref.length);
+                ref.offset = used;
+                used += ref.length + 1;
+            } else if (used + extra > ARENASIZE) return false;
+            memcpy(data+ref.offset+ref.length,text,extra+1);
+            ref.length += extra;
+            used = ref.offset + ref.length + 1;
+            return true;
+        }
+
+        const char *get(strRef ref) const {
+            return ref.length ? data+ref.offset : "";
+        }
+
+        // Writable access for in-place edits that can only shorten the string. Call refresh() afterwards.
+        char *edit(strRef ref) {
+            static char empty[1];
+            if (!ref.length) {
+                empty[0] = '\0';
+                return empty;
+            }
+            return data+ref.offset;
+        }
+
+        void refresh(strRef &ref) {
+            if (ref.length) ref.length = strlen(data+ref.offset);
+        }
+
+        // Raw access to the used part of the arena for saving and restoring board snapshots
+        const char *buffer() const {
+            return data;
+        }
+
+        char *restore(uint16_t length) {
+            if (length > ARENASIZE) return nullptr;
+            used = length;
+            return data;
+        }
+};
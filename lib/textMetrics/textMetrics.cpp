@@ -0,0 +1,91 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * textMetrics Library - fast text width and truncation for the display fonts
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#include <textMetrics.h>
+
+void textMetrics::begin(U8G2 *u8g2) {
+    display = u8g2;
+    numFonts = 0;
+    nextFont = 0;
+}
+
+// Get the glyph table for the font currently set on the display, building it if needed
+textMetrics::fontMetrics *textMetrics::currentFont() {
+    const uint8_t *font = display->getU8g2()->font;
+    for (int i=0;i<numFonts;i++) {
+        if (fonts[i].font == font) return &fonts[i];
+    }
+    fontMetrics *metrics = &fonts[nextFont];
+    nextFont = (nextFont+1) % MAXMETRICFONTS;
+    if (numFonts < MAXMETRICFONTS) numFonts++;
+    metrics->font = font;
+    buildFont(metrics);
+    return metrics;
+}
+
+// u8g2 measures a string as the advance of each glyph except the last, which counts only up to the
+// edge of its bitmap. Both are taken from u8g2 itself so the result always matches getStrWidth.
+void textMetrics::buildFont(fontMetrics *metrics) {
+    char text[3] = {0,0,0};
+    int reference = 0;
+    metrics->advance[0] = 0;
+    metrics->last[0] = 0;
+    for (int c=1;c<256;c++) {
+        text[0] = c;
+        metrics->last[c] = display->getStrWidth(text);
+        if (!reference && metrics->last[c] > 0) reference = c;
+    }
+    // Measuring a glyph followed by one that's known to exist gives its advance
+    text[1] = reference;
+    for (int c=1;c<256;c++) {
+        text[0] = c;
+        metrics->advance[c] = reference ? display->getStrWidth(text) - metrics->last[reference] : 0;
+    }
+}
+
+int textMetrics::measure(const char *text, const fontMetrics *metrics) {
+    int width = 0;
+    const uint8_t *p = (const uint8_t *)text;
+    while (*p) {
+        width += p[1] ? metrics->advance[*p] : metrics->last[*p];
+        p++;
+    }
+    return width;
+}
+
+int textMetrics::measureFit(const char *text, const fontMetrics *metrics, int maxWidth) {
+    int run = 0;
+    int length = 0;
+    const uint8_t *p = (const uint8_t *)text;
+    for (int i=0;p[i];i++) {
+        if (run + metrics->last[p[i]] <= maxWidth) length = i+1;
+        run += metrics->advance[p[i]];
+    }
+    return length;
+}
+
+int textMetrics::width(const char *text) {
+    if (!display) return 0;
+    return measure(text,currentFont());
+}
+
+int textMetrics::advance(const char *text) {
+    if (!display) return 0;
+    fontMetrics *metrics = currentFont();
+    int total = 0;
+    for (const uint8_t *p=(const uint8_t *)text;*p;p++) total += metrics->advance[*p];
+    return total;
+}
+
+int textMetrics::fit(const char *text, int maxWidth) {
+    if (!display) return 0;
+    return measureFit(text,currentFont(),maxWidth);
+}
@@ -0,0 +1,53 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * textMetrics Library - fast text width and truncation for the display fonts
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+#define MAXMETRICFONTS 4      // Fonts with a glyph table at any one time
+
+//
+// Widths are worked out from a table of glyph advances for the current font, built the first time the
+// font is measured, so a string is measured with one pass of table lookups instead of decoding each glyph.
+// That pass costs no more than hashing the string would, so results are not cached.
+//
+class textMetrics {
+
+    private:
+        struct fontMetrics {
+            const uint8_t *font;
+            int8_t advance[256];    // Width of a glyph followed by another
+            int8_t last[256];       // Width of a glyph at the end of the string
+        };
+
+        U8G2 *display = nullptr;
+        fontMetrics fonts[MAXMETRICFONTS];
+        uint8_t numFonts = 0;
+        uint8_t nextFont = 0;
+
+        fontMetrics *currentFont();
+        void buildFont(fontMetrics *metrics);
+        int measure(const char *text, const fontMetrics *metrics);
+        int measureFit(const char *text, const fontMetrics *metrics, int maxWidth);
+
+    public:
+        void begin(U8G2 *u8g2);
+
+        // Width of text in the current font (the same as u8g2 getStrWidth)
+        int width(const char *text);
+
+        // Distance the drawing position moves for text in the current font (the same as u8g2 drawStr returns)
+        int advance(const char *text);
+
+        // Length of the longest start of text that fits in maxWidth pixels in the current font
+        int fit(const char *text, int maxWidth);
+};
@@ -0,0 +1,154 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * trackedDisplay Library - records which display tiles have been drawn on so only those are sent
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include <spanTrace.h>
+
+#define MAXDIRTYTILEROWS 8      // Tile rows tracked (64 pixels)
+#define MAXDIRTYTILECOLS 32     // Tile columns tracked (256 pixels)
+
+//
+// Wraps a full buffer u8g2 display. Each drawing call marks the 8x8 pixel tiles it touched (limited to the
+// clip window) and flush() sends just those tiles to the panel, as one block per run of tile rows with the
+// same columns. sendBuffer() and updateDisplayArea() still work and clear whatever they send.
+//
+template <class DISPLAY>
+class trackedDisplay : public DISPLAY {
+
+    private:
+        uint32_t dirty[MAXDIRTYTILEROWS] = {};   // Bit n set if tile column n of the row needs sending
+        int clipX0 = 0;
+        int clipY0 = 0;
+        int clipX1 = MAXDIRTYTILECOLS*8;
+        int clipY1 = MAXDIRTYTILEROWS*8;
+
+        void markTiles(int tx0, int ty0, int tx1, int ty1) {
+            if (tx0 < 0) tx0 = 0;
+            if (ty0 < 0) ty0 = 0;
+            if (tx1 >= MAXDIRTYTILECOLS) tx1 = MAXDIRTYTILECOLS-1;
+            if (ty1 >= MAXDIRTYTILEROWS) ty1 = MAXDIRTYTILEROWS-1;
+            if (tx0 > tx1) return;
+            uint32_t bits = (tx1-tx0 == 31) ? 0xFFFFFFFFUL : (((1UL << (tx1-tx0+1)) - 1) << tx0);
+            for (int ty=ty0;ty<=ty1;ty++) dirty[ty] |= bits;
+        }
+
+        void cleanTiles(int tx0, int ty0, int tw, int th) {
+            uint32_t bits = (tw >= 32) ? 0xFFFFFFFFUL : (((1UL << tw) - 1) << tx0);
+            for (int ty=ty0;ty<ty0+th && ty<MAXDIRTYTILEROWS;ty++) dirty[ty] &= ~bits;
+        }
+
+    public:
+        using DISPLAY::DISPLAY;
+
+        // Mark an area as changed (for anything written straight into the frame buffer)
+        void markDirty(int x, int y, int w, int h) {
+            int x0 = max(x,clipX0);
+            int y0 = max(y,clipY0);
+            int x1 = min(x+w,clipX1);
+            int y1 = min(y+h,clipY1);
+            if (x0 >= x1 || y0 >= y1) return;
+            markTiles(x0>>3,y0>>3,(x1-1)>>3,(y1-1)>>3);
+        }
+
+        bool isDirty() const {
+            for (int i=0;i<MAXDIRTYTILEROWS;i++) {
+                if (dirty[i]) return true;
+            }
+            return false;
+        }
+
+        // Send the changed tiles to the panel
+        void flush() {
+            TRACE_RENDER_SPAN("flush");
+            int row = 0;
+            while (row < MAXDIRTYTILEROWS) {
+                uint32_t bits = dirty[row];
+                if (!bits) {
+                    row++;
+                    continue;
+                }
+                int first = __builtin_ctz(bits);
+                int last = 31 - __builtin_clz(bits);
+                uint32_t span = (last-first == 31) ? 0xFFFFFFFFUL : (((1UL << (last-first+1)) - 1) << first);
+                // Send following rows with changes in the same columns in the same block
+                int end = row+1;
+                while (end < MAXDIRTYTILEROWS && dirty[end] && (dirty[end] & ~span) == 0) end++;
+                DISPLAY::updateDisplayArea(first,row,last-first+1,end-row);
+                for (int i=row;i<end;i++) dirty[i] = 0;
+                row = end;
+            }
+        }
+
+        u8g2_uint_t drawStr(u8g2_uint_t x, u8g2_uint_t y, const char *s) {
+            u8g2_uint_t width = DISPLAY::drawStr(x,y,s);
+            // Fonts are referenced from the top, allow a pixel either side for glyph offsets
+            markDirty((int16_t)x-1,(int16_t)y,width+2,DISPLAY::getAscent()-DISPLAY::getDescent()+1);
+            return width;
+        }
+
+        void drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) {
+            DISPLAY::drawBox(x,y,w,h);
+            markDirty((int16_t)x,(int16_t)y,w,h);
+        }
+
+        void drawFrame(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) {
+            DISPLAY::drawFrame(x,y,w,h);
+            markDirty((int16_t)x,(int16_t)y,w,h);
+        }
+
+        void drawXBM(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap) {
+            DISPLAY::drawXBM(x,y,w,h,bitmap);
+            markDirty((int16_t)x,(int16_t)y,w,h);
+        }
+
+        void clearBuffer() {
+            DISPLAY::clearBuffer();
+            markTiles(0,0,MAXDIRTYTILECOLS-1,MAXDIRTYTILEROWS-1);
+        }
+
+        void sendBuffer() {
+            DISPLAY::sendBuffer();
+            memset(dirty,0,sizeof(dirty));
+        }
+
+        void updateDisplay() {
+            DISPLAY::updateDisplay();
+            memset(dirty,0,sizeof(dirty));
+        }
+
+        void clearDisplay() {
+            DISPLAY::clearDisplay();
+            memset(dirty,0,sizeof(dirty));
+        }
+
+        void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+            DISPLAY::updateDisplayArea(tx,ty,tw,th);
+            cleanTiles(tx,ty,tw,th);
+        }
+
+        void setClipWindow(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t x1, u8g2_uint_t y1) {
+            DISPLAY::setClipWindow(x0,y0,x1,y1);
+            clipX0 = x0;
+            clipY0 = y0;
+            clipX1 = x1;
+            clipY1 = y1;
+        }
+
+        void setMaxClipWindow() {
+            DISPLAY::setMaxClipWindow();
+            clipX0 = 0;
+            clipY0 = 0;
+            clipX1 = MAXDIRTYTILECOLS*8;
+            clipY1 = MAXDIRTYTILEROWS*8;
+        }
+};
@@ -12,6 +12,7 @@
 #include <weatherClient.h>
 #include <JsonListenerGS.h>
 #include <WiFiClientSecure.h>
+#include <fetchMetrics.h>
 
 const char* const weatherClient::apiHosts[] = {
     "api.openweathermap.org",
@@ -23,6 +24,7 @@ weatherClient::weatherClient(sharedBufferSpace *sharedBuffer) : js(sharedBuffer)
 int weatherClient::updateWeather(const char *apiKey, float lat, float lon) {
 
     currentWeatherMessage[0] = '\0';
+    fetchTrace trace(UPSTREAM_WEATHER);
 
     JsonStreamingParserGS parser;
     parser.setListener(this);
@@ -42,6 +44,7 @@ int weatherClient::updateWeather(const char *apiKey, float lat, float lon) {
     if (retryCounter>=15) {
         return UPD_NO_RESPONSE;
     }
+    trace.mark(PHASE_CONNECT);
 
     String request;
     if (weatherSource == OPENWEATHERMAP) {
@@ -60,6 +63,7 @@ int weatherClient::updateWeather(const char *apiKey, float lat, float lon) {
         httpsClient.stop();
         return UPD_TIMEOUT;
     }
+    trace.mark(PHASE_WAIT);
 
     // Parse status code
     String statusLine = httpsClient.readStringUntil('\n');
@@ -87,17 +91,21 @@ int weatherClient::updateWeather(const char *apiKey, float lat, float lon) {
     temperature=0;
     windSpeed=0;
     weatherCode=-1;
+    long dataReceived = 0;
 
     unsigned long dataSendTimeout = millis() + 10000UL;
     while((httpsClient.available() || httpsClient.connected()) && (millis() < dataSendTimeout)) {
         while(httpsClient.available()) {
             c = httpsClient.read();
+            dataReceived++;
             if (c == '{' || c == '[') isBody = true;
             if (isBody) parser.parse(c);
         }
         delay(5);
     }
     httpsClient.stop();
+    trace.setBytes(dataReceived);
+    trace.mark(PHASE_BODY);
     if (millis() >= dataSendTimeout) {
         return UPD_TIMEOUT;
     }
@@ -113,6 +121,7 @@ int weatherClient::updateWeather(const char *apiKey, float lat, float lon) {
             snprintf(currentWeatherMessage, MAXWEATHERSIZE, "%s %.0f\xB0 Wind: %.0fmph", weatherDesc, temperature, windSpeed);
         }
     }
+    trace.mark(PHASE_PROCESS);
     return UPD_SUCCESS;
 }
 
@@ -1,37 +1,181 @@
-import os
-import subprocess
-import sys
-
-# Define the folder containing your source web files
-SOURCE_DIR = "web"
-# Define where the .h files should go
-INCLUDE_DIR = "include/webgui"
-
-def build_web_headers(target=None, source=None, env=None):
-
-    for filename in os.listdir(SOURCE_DIR):
-        # Process specific web file types
-        if filename.endswith((".htm", ".css", ".js", ".json")):
-            input_path = os.path.join(SOURCE_DIR, filename)
-
-            # Generate the output path: e.g., "include/index.h"
-            base_name = os.path.splitext(filename)[0]
-            output_path = os.path.join(INCLUDE_DIR, f"{base_name}.h")
-
-            print(f"--- Generating {base_name}.h ---")
-            subprocess.run([sys.executable, "scripts/header_tool.py", input_path, output_path])
-
-# PlatformIO Hook
-try:
-    # Import the PlatformIO environment
-    Import("env")
-
-    # We call it once, directly.
-    # Because 'extra_scripts = pre:generate_headers.py' is in platformio.ini,
-    # this line executes as soon as PlatformIO starts the build environment,
-    # but BEFORE it starts compiling any .cpp files.
-    build_web_headers()
-
-except NameError:
-    # This allows you to still run the script manually via terminal
-    build_web_headers()
\ No newline at end of file
+import hashlib
+import json
+import os
+import re
+import sys
+
+# header_tool.py lives alongside this script (PlatformIO runs it from the project folder)
+sys.path.insert(0, "scripts")
+from header_tool import c_variable_name, data_to_c_header, gzip_data
+
+# Define the folder containing your source web files
+SOURCE_DIR = "web"
+# Define where the .h files should go
+INCLUDE_DIR = "include/webgui"
+# The routing table for the assets held in flash
+ROUTES_HEADER = os.path.join(INCLUDE_DIR, "webroutes.h")
+
+# Pages keep their names. Scripts (*.js) are modules that pages fetch when they're needed and are served
+# under a name that includes a hash of their content, so browsers can cache them for good. Pages built here
+# are pointed at the hashed name. Modules are also served under their own name (checked every time like a
+# page) for pages that aren't built here, such as a development index_d.htm uploaded to the file system.
+PAGE_TYPES = {".htm": "text/html", ".json": "application/json"}
+MODULE_TYPES = {".js": "application/javascript"}
+
+# Images are kept in the hand written webgraphics.h: URL, array name, content type
+IMAGES = [
+    ("/nrelogo.webp", "nrelogo", "image/webp"),
+    ("/rdglogo.webp", "rdglogo", "image/webp"),
+    ("/tfllogo.webp", "tfllogo", "image/webp"),
+    ("/btlogo.webp", "btlogo", "image/webp"),
+    ("/tube.webp", "tubeicon", "image/webp"),
+    ("/nr.webp", "nricon", "image/webp"),
+    ("/ibus.webp", "ibus", "image/webp"),
+    ("/irail.webp", "irail", "image/webp"),
+    ("/itube.webp", "itube", "image/webp"),
+    ("/favicon.png", "faviconpng", "image/png"),
+]
+
+# Pages are checked with the board every time (a 304 if unchanged), images can be cached for a day
+CACHE_PAGE = "no-cache"
+CACHE_IMAGE = "public,max-age=86400"
+CACHE_MODULE = "public,max-age=31536000,immutable"
+
+def minify_text(text):
+    # Conservative minification that's safe for the hand written pages: drop indentation, blank lines,
+    # HTML comments, CSS comments and whole line // comments. Line breaks are kept so JavaScript
+    # statements without semicolons still end where they did.
+    text = re.sub(r'<!--(?!\[).*?-->', '', text, flags=re.S)
+    text = re.sub(r'(<style[^>]*>)(.*?)(</style>)',
+                  lambda m: m.group(1) + re.sub(r'/\*.*?\*/', '', m.group(2), flags=re.S) + m.group(3),
+                  text, flags=re.S)
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines) + "\n"
+
+def minify(filename, text):
+    if filename.endswith(".json"):
+        return json.dumps(json.loads(text), separators=(',', ':'), ensure_ascii=False)
+    return minify_text(text)
+
+def write_header(source_name, data, output_path):
+    # Headers are only rewritten when their content changes, so unchanged pages don't trigger a rebuild
+    digest = hashlib.sha256(data).hexdigest()
+    comment = f"Generated from {SOURCE_DIR}/{source_name} ({digest[:16]}) - do not edit"
+    if os.path.exists(output_path):
+        with open(output_path, 'r') as f:
+            if f.readline().strip() == f"// {comment}":
+                print(f"--- {os.path.basename(output_path)} is up to date ---")
+                return
+    compressed = gzip_data(data)
+    data_to_c_header(compressed, c_variable_name(source_name), output_path, comment)
+    print(f"--- Generated {os.path.basename(output_path)} ({len(data)} -> {len(compressed)} bytes) ---")
+
+def read_arrays(header_path):
+    # Pull the byte arrays out of a generated (or hand written) header
+    with open(header_path, 'r') as f:
+        text = f.read()
+    arrays = {}
+    for match in re.finditer(r'static const uint8_t (\w+)\[\]\s*=\s*\{(.*?)\};', text, re.S):
+        arrays[match.group(1)] = bytes(int(b, 16) for b in re.findall(r'0x([0-9A-Fa-f]{2})', match.group(2)))
+    return arrays
+
+def build_web_headers(target=None, source=None, env=None):
+    routes = []     # URL, array name, header, content type, gzipped, cache control
+    files = sorted(os.listdir(SOURCE_DIR))
+
+    # Modules first, so the pages can be pointed at their hashed names
+    renames = {}
+    for filename in files:
+        base_name, ext = os.path.splitext(filename)
+        if ext not in MODULE_TYPES:
+            continue
+        with open(os.path.join(SOURCE_DIR, filename), 'r', encoding='utf-8') as f:
+            data = minify(filename, f.read()).encode('utf-8')
+        hashed_url = f"/{base_name}.{hashlib.sha256(data).hexdigest()[:8]}{ext}"
+        renames[f"/{filename}"] = hashed_url
+        write_header(filename, data, os.path.join(INCLUDE_DIR, f"{base_name}.h"))
+        routes.append((hashed_url, c_variable_name(filename), f"{base_name}.h", MODULE_TYPES[ext], True, CACHE_MODULE))
+        routes.append((f"/{filename}", c_variable_name(filename), f"{base_name}.h", MODULE_TYPES[ext], True, CACHE_PAGE))
+
+    for filename in files:
+        base_name, ext = os.path.splitext(filename)
+        if ext not in PAGE_TYPES:
+            continue
+        with open(os.path.join(SOURCE_DIR, filename), 'r', encoding='utf-8') as f:
+            text = f.read()
+        for original, hashed_url in renames.items():
+            text = text.replace(f"'{original}'", f"'{hashed_url}'").replace(f'"{original}"', f'"{hashed_url}"')
+        data = minify(filename, text).encode('utf-8')
+        write_header(filename, data, os.path.join(INCLUDE_DIR, f"{base_name}.h"))
+        routes.append((f"/{filename}", c_variable_name(filename), f"{base_name}.h", PAGE_TYPES[ext], True, CACHE_PAGE))
+
+    for url, name, content_type in IMAGES:
+        routes.append((url, name, "webgraphics.h", content_type, False, CACHE_IMAGE))
+
+    build_route_table(routes)
+
+def build_route_table(routes):
+    headers = sorted(set(route[2] for route in routes))
+    arrays = {}
+    for header in headers:
+        arrays.update(read_arrays(os.path.join(INCLUDE_DIR, header)))
+
+    # Sorted by URL so the board can binary search the table
+    lines = []
+    for url, name, header, content_type, gzipped, cache in sorted(routes):
+        etag = hashlib.sha256(arrays[name]).hexdigest()[:16]
+        gzip_flag = "true" if gzipped else "false"
+        lines.append(f'    {{"{url}", {name}, sizeof({name}), "{content_type}", {gzip_flag}, "\\"{etag}\\"", "{cache}"}},')
+
+    includes = "\n".join(f"#include <webgui/{header}>" for header in headers)
+    table = "\n".join(lines)
+    content = (
+        f"// Generated by scripts/generate_headers.py - do not edit\n"
+        f"#pragma once\n"
+        f"#include <Arduino.h>\n"
+        f"{includes}\n"
+        f"\n"
+        f"struct webRoute {{\n"
+        f"    const char *path;\n"
+        f"    const uint8_t *data;\n"
+        f"    size_t length;\n"
+        f"    const char *contentType;\n"
+        f"    bool gzipped;\n"
+        f"    const char *etag;\n"
+        f"    const char *cacheControl;\n"
+        f"}};\n"
+        f"\n"
+        f"#define WEBROUTECOUNT {len(routes)}\n"
+        f"\n"
+        f"static const webRoute webRoutes[WEBROUTECOUNT] = {{\n"
+        f"{table}\n"
+        f"}};\n"
+    )
+
+    if os.path.exists(ROUTES_HEADER):
+        with open(ROUTES_HEADER, 'r') as f:
+            if f.read() == content:
+                return
+    with open(ROUTES_HEADER, 'w') as f:
+        f.write(content)
+    print(f"--- Generated {os.path.basename(ROUTES_HEADER)} ({len(routes)} routes) ---")
+
+# PlatformIO Hook
+try:
+    # Import the PlatformIO environment
+    Import("env")
+
+    # We call it once, directly.
+    # Because 'extra_scripts = pre:generate_headers.py' is in platformio.ini,
+    # this line executes as soon as PlatformIO starts the build environment,
+    # but BEFORE it starts compiling any .cpp files.
+    build_web_headers()
+
+except NameError:
+    # This allows you to still run the script manually via terminal
+    build_web_headers()
@@ -3,29 +3,13 @@ import gzip
 import argparse
 import re
 
-def file_to_gzipped_c_header(input_path, output_path=None, add_version=False):
-    if not os.path.exists(input_path):
-        print(f"Error: File '{input_path}' not found.")
-        return
-
-    # Determine output filename if not provided
-    if output_path is None:
-        base_name = os.path.splitext(input_path)[0]
-        output_path = f"{base_name}.h"
-
-    # Read the raw file
-    with open(input_path, 'rb') as f:
-        raw_data = f.read()
-
-    # Compress the data using gzip
-    compressed_data = gzip.compress(raw_data)
-
+def c_variable_name(filename):
     # Generate a valid C variable name from the filename
-    filename = os.path.basename(input_path)
-    var_name = re.sub(r'\W+', '', filename)
+    return re.sub(r'\W+', '', os.path.basename(filename))
 
+def data_to_c_header(data, var_name, output_path, comment=None):
     # Format as hex bytes (0xXX)
-    hex_bytes = [f"0x{b:02X}" for b in compressed_data]
+    hex_bytes = [f"0x{b:02X}" for b in data]
 
     # Chunk into lines of maximum 21 bytes
     lines = []
@@ -37,6 +21,7 @@ def file_to_gzipped_c_header(input_path, output_path=None, add_version=False):
 
     # Create the C header content
     header_content = (
+        (f"// {comment}\n" if comment else "") +
         f"#include <Arduino.h>\n"
         f"static const uint8_t {var_name}[] = {{\n"
         f"{formatted_array}\n"
@@ -47,6 +32,29 @@ def file_to_gzipped_c_header(input_path, output_path=None, add_version=False):
     with open(output_path, 'w') as f:
         f.write(header_content)
 
+def gzip_data(raw_data):
+    # A fixed timestamp keeps the output (and its ETag) the same for the same input
+    return gzip.compress(raw_data, compresslevel=9, mtime=0)
+
+def file_to_gzipped_c_header(input_path, output_path=None, add_version=False):
+    if not os.path.exists(input_path):
+        print(f"Error: File '{input_path}' not found.")
+        return
+
+    # Determine output filename if not provided
+    if output_path is None:
+        base_name = os.path.splitext(input_path)[0]
+        output_path = f"{base_name}.h"
+
+    # Read the raw file
+    with open(input_path, 'rb') as f:
+        raw_data = f.read()
+
+    # Compress the data using gzip
+    compressed_data = gzip_data(raw_data)
+
+    data_to_c_header(compressed_data, c_variable_name(input_path), output_path)
+
     print(f"Converted '{input_path}' ({len(raw_data)}) -> '{output_path}' ({len(compressed_data)}).")
 
 if __name__ == "__main__":
@@ -54,4 +62,4 @@ if __name__ == "__main__":
     parser.add_argument("input_file", help="The source file to be gzipped (e.g., index.htm)")
     parser.add_argument("output_file", nargs='?', help="Optional specific output filename (e.g., custom.h)")
     args = parser.parse_args()
-    file_to_gzipped_c_header(args.input_file, args.output_file)
\ No newline at end of file
+    file_to_gzipped_c_header(args.input_file, args.output_file)
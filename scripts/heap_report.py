@@ -0,0 +1,122 @@
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import time
+import urllib.request
+
+# Polls a running board's /heap and /metrics endpoints during a soak test and reports how the free heap,
+# largest free block and fragmentation move as fetch cycles accumulate. Build with the soak environment
+# (pio run -e soak) so fetches run many times faster than normal.
+
+def get_json(host, path):
+    with urllib.request.urlopen(f"http://{host}{path}", timeout=10) as response:
+        return json.load(response)
+
+BOARD_UPSTREAMS = ("darwin", "rdm", "tfl", "bus")
+
+def fetch_cycles(metrics):
+    # Every completed board fetch is counted under one of the result codes. Weather, RSS and firmware
+    # checks run on their own timers, so they aren't fetch cycles.
+    upstreams = metrics.get("upstreams", {})
+    return sum(sum(upstreams[name]["results"].values()) for name in BOARD_UPSTREAMS if name in upstreams)
+
+def slope(xs, ys):
+    # Least squares gradient of ys against xs
+    n = len(xs)
+    if n < 2:
+        return 0.0
+    mx = sum(xs) / n
+    my = sum(ys) / n
+    den = sum((x - mx) ** 2 for x in xs)
+    return sum((x - mx) * (y - my) for x, y in zip(xs, ys)) / den if den else 0.0
+
+def resolve_sites(sites, elf):
+    # Turn call site addresses into function and line with addr2line from the ESP32 toolchain
+    if not elf or not sites:
+        return {}
+    addresses = [s["address"] for s in sites]
+    try:
+        output = subprocess.run(["xtensa-esp32-elf-addr2line", "-pfiaC", "-e", elf] + addresses,
+                                capture_output=True, text=True, check=True).stdout.splitlines()
+    except (OSError, subprocess.CalledProcessError) as e:
+        print(f"Could not run addr2line: {e}", file=sys.stderr)
+        return {}
+    return {a: line.split(": ", 1)[-1] for a, line in zip(addresses, output)}
+
+def report(rows, heap, interval, elf):
+    cycles = [r["cycles"] for r in rows]
+    largest = [r["largestBlock"] for r in rows]
+    free = [r["freeHeap"] for r in rows]
+    frag = [r["fragmentation"] for r in rows]
+    span = cycles[-1] - cycles[0]
+    print(f"\nSamples: {len(rows)}  Fetch cycles: {span}  Equivalent normal running: {span * interval / 86400:.1f} days")
+    print(f"Free heap      first {free[0]:>7}  last {free[-1]:>7}  min {min(free):>7}  per 1000 cycles {slope(cycles, free) * 1000:+.0f}")
+    print(f"Largest block  first {largest[0]:>7}  last {largest[-1]:>7}  min {min(largest):>7}  per 1000 cycles {slope(cycles, largest) * 1000:+.0f}")
+    print(f"Fragmentation  first {frag[0]:>6}%  last {frag[-1]:>6}%  max {max(frag):>6}%  per 1000 cycles {slope(cycles, frag) * 1000:+.2f}%")
+
+    profile = heap.get("profile")
+    if not profile:
+        print("\nNo allocation profile (build with -DHEAPPROFILE to count allocations)")
+        return
+    print(f"\nAllocations {profile['allocs']}  frees {profile['frees']}  failed {profile['failed']}  live {profile['liveBytes']} bytes  peak {profile['peakLiveBytes']} bytes")
+    if span:
+        print(f"Allocations per fetch cycle: {(rows[-1]['allocs'] - rows[0]['allocs']) / span:.0f}")
+    print("\nRegions:")
+    for name, region in sorted(profile["regions"].items()):
+        print(f"  {name:<16} {region['allocs']:>10} allocs {region['bytes']:>12} bytes")
+    names = resolve_sites(profile["sites"], elf)
+    print("\nBusiest call sites:")
+    for site in profile["sites"]:
+        print(f"  {site['address']} {site['allocs']:>10} allocs {site['bytes']:>12} bytes  {names.get(site['address'], '')}")
+    if profile["other"]["allocs"]:
+        print(f"  (other)    {profile['other']['allocs']:>10} allocs {profile['other']['bytes']:>12} bytes")
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Record and report the heap trend of a board during a soak test.")
+    parser.add_argument("host", help="IP address or hostname of the board")
+    parser.add_argument("--every", type=int, default=60, help="Seconds between samples (default 60)")
+    parser.add_argument("--duration", type=float, default=0, help="Hours to run for (default until Ctrl-C)")
+    parser.add_argument("--csv", default="heap_soak.csv", help="File the samples are appended to")
+    parser.add_argument("--elf", help="Firmware .elf to resolve call site addresses")
+    parser.add_argument("--interval", type=int, default=90, help="Normal seconds between board fetches, to convert cycles to days (default 90)")
+    args = parser.parse_args()
+
+    fields = ["time", "uptime", "cycles", "freeHeap", "largestBlock", "minFreeHeap", "fragmentation", "allocs"]
+    rows = []
+    heap = None
+    end = time.time() + args.duration * 3600 if args.duration else None
+    new_file = not os.path.exists(args.csv)
+    with open(args.csv, "a", newline="") as f:
+        writer = csv.DictWriter(f, fieldnames=fields)
+        if new_file:
+            writer.writeheader()
+        try:
+            while not end or time.time() < end:
+                try:
+                    heap = get_json(args.host, "/heap")
+                    cycles = fetch_cycles(get_json(args.host, "/metrics"))
+                except OSError as e:
+                    print(f"Poll failed: {e}", file=sys.stderr)
+                    time.sleep(args.every)
+                    continue
+                if rows and heap["uptime"] < rows[-1]["uptime"]:
+                    print("Board restarted, starting a new trend", file=sys.stderr)
+                    rows = []
+                profile = heap.get("profile") or {}
+                row = {"time": int(time.time()), "uptime": heap["uptime"], "cycles": cycles,
+                       "freeHeap": heap["freeHeap"], "largestBlock": heap["largestBlock"],
+                       "minFreeHeap": heap["minFreeHeap"], "fragmentation": heap["fragmentation"],
+                       "allocs": profile.get("allocs", 0)}
+                rows.append(row)
+                writer.writerow(row)
+                f.flush()
+                print(f"{row['uptime']:>8}s  cycles {cycles:>7}  free {row['freeHeap']:>7}  largest {row['largestBlock']:>7}  frag {row['fragmentation']:>3}%")
+                time.sleep(args.every)
+        except KeyboardInterrupt:
+            pass
+
+    if rows:
+        report(rows, heap, args.interval, args.elf)
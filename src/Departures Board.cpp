@@ -46,14 +46,28 @@
 #include <rdmRailClient.h>
 #include <TfLdataClient.h>
 #include <busDataClient.h>
+#include <boardSnapshot.h>
+#include <configSnapshot.h>
+#include <callingPoints.h>
+#include <textMetrics.h>
+#include <scrollStrip.h>
+#include <dmaDisplay.h>
+#include <trackedDisplay.h>
+#include <frameScheduler.h>
+#include <eventTimers.h>
+#include <scrollMotion.h>
+#include <rowLayout.h>
+#include <frameMirror.h>
+#include <jsonUpload.h>
+#include <boardFeed.h>
+#include <chunkWriter.h>
+#include <fetchMetrics.h>
+#include <spanTrace.h>
+#include <heapProfiler.h>
 #include <githubClient.h>
 #include <rssClient.h>
 #include <touchSensor.h>
-#include <webgui/webgraphics.h>
-#include <webgui/index.h>
-#include <webgui/keys.h>
-#include <webgui/editrss.h>
-#include <webgui/rss.h>
+#include <webgui/webroutes.h>
 #include <gfx/xbmgfx.h>
 #include <time.h>
 
@@ -65,6 +79,12 @@
 #define msMin 60000 // 60000 milliseconds in a second
 
 static AsyncWebServer server(80); // Hosting the Web GUI
+static AsyncWebSocket mirrorSocket("/mirror");  // Live view of the display for the Web GUI
+static frameMirror mirror;
+static AsyncEventSource boardEvents("/events");  // Server-Sent Events feed of the board for the Web GUI and other screens
+static boardFeed feed;
+static SemaphoreHandle_t boardLock;             // Held while the board is replaced, so the web server never reads it half copied
+static volatile uint32_t boardVersion = 0;      // Incremented each time the board is replaced
 
 // Shorthand for response formats
 static const char contentTypeJson[] = "application/json";
@@ -134,7 +154,9 @@ static const char successPage[] =
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 #define DIMMED_BRIGHTNESS 1 // OLED display brightness level when in sleep/screensaver mode
 
-U8G2_SSD1322_NHD_256X64_F_4W_HW_SPI u8g2(U8G2_R0, /* cs=*/ GPIO_NUM_26, /* dc=*/ GPIO_NUM_5, /* reset=*/ U8X8_PIN_NONE);
+trackedDisplay<dmaDisplay> u8g2(U8G2_R0, /* cs=*/ GPIO_NUM_26, /* dc=*/ GPIO_NUM_5, /* reset=*/ U8X8_PIN_NONE);
+textMetrics metrics;      // Glyph width tables for the display fonts
+scrollStrip messageStrip; // The current scrolling message, pre-rendered
 
 // Vertical line positions on the OLED display (National Rail)
 #define LINE0 0
@@ -308,17 +330,35 @@ static const char rdgAttribution[] = "Powered by Rail Delivery Group";
 static const char btAttribution[] = "Powered by bustimes.org";
 
 #define SCREENSAVERINTERVAL 8000      // How often the screen is changed in sleep mode (ms - 8 seconds)
+#ifdef HEAPSOAK
+// Soak test builds fetch much more often than normal, so weeks of fetch cycles are run in a day or two
+#define DATAUPDATEINTERVAL 6000
+#define FASTDATAUPDATEINTERVAL 6000
+#define UGDATAUPDATEINTERVAL 5000
+#define BUSDATAUPDATEINTERVAL 10000
+#define RSSUPDATEINTERVAL 20000
+#define WEATHERUPDATEINTERVAL 90000   // Stays inside the OpenWeatherMap free tier
+#else
 #define DATAUPDATEINTERVAL 90000      // How often we fetch data from National Rail (ms - 1.5 mins) - "default" option
 #define FASTDATAUPDATEINTERVAL 45000  // How often we fetch data from National Rail (ms - 45 secs) - "fast" option
 #define UGDATAUPDATEINTERVAL 30000    // How often we fetch data from TfL (ms - 30 secs)
 #define BUSDATAUPDATEINTERVAL 45000   // How often we fetch data from bustimes.org (ms - 45 secs)
 #define RSSUPDATEINTERVAL 600000      // How often to refresh the RSS feed (ms - 10 mins)
 #define WEATHERUPDATEINTERVAL 1200000 // How often to update the weather forecast (ms - 20 mins)
+#endif
+#define SNAPSHOTINTERVAL 600000       // Minimum time between saving the board to flash (ms - 10 mins)
+#define CLOCKUPDATEINTERVAL 100       // How often the current time is read (ms)
+#define WIFICHECKINTERVAL 1000        // How often the WiFi connection is checked (ms)
+#define WIFIRECONNECTINTERVAL 10000   // Time between WiFi reconnection attempts (ms - 10 secs)
+#define SCHEDULERCHECKINTERVAL 10000  // How often the scheduler/carousel is checked for a change of slot (ms - 10 secs)
+#define TIMERRETRYINTERVAL 250        // Timers that can't start their work yet (a fetch is running) try again after this (ms)
+#define IDLEPOLLINTERVAL 50           // Longest loop() waits while the screen is sleeping, so taps are still seen (ms)
 
 // Reusable data transfer structures
 rdiStation xfrStation;
 stnMessages xfrMessages;
 busTubeStation xfrBusTubeStation;
+rdStation xfrBoard;           // Next board to display (with the changes from the current one)
 sharedBufferSpace jsonKeyBuffer;
 
 // Station Data (shared)
@@ -327,10 +367,10 @@ rdStation station;
 stnMessages messages;
 
 // Data transfer clients
-rdmRailClient rdmRailData(&xfrStation,&xfrMessages,&jsonKeyBuffer);
-raildataXmlClient darwinRailData(&xfrStation,&xfrMessages,&jsonKeyBuffer);
-TfLdataClient tfldata(&xfrBusTubeStation,&xfrMessages,&jsonKeyBuffer);
-busDataClient busdata(&xfrBusTubeStation,&jsonKeyBuffer);
+rdmRailClient rdmRailData(&xfrStation,&xfrBoard,&xfrMessages,&jsonKeyBuffer);
+raildataXmlClient darwinRailData(&xfrStation,&xfrBoard,&xfrMessages,&jsonKeyBuffer);
+TfLdataClient tfldata(&xfrBusTubeStation,&xfrBoard,&xfrMessages,&jsonKeyBuffer);
+busDataClient busdata(&xfrBusTubeStation,&xfrBoard,&jsonKeyBuffer);
 weatherClient currentWeather(&jsonKeyBuffer);
 rssClient rss(&jsonKeyBuffer);
 github ghUpdate(&jsonKeyBuffer);
@@ -345,7 +385,7 @@ static bool forcedSleep = false;           // Is the system in manual sleep mode
 static bool forcedAwake = false;           // Was the system woken by touch sensor?
 static int stayAwakeSeconds = 300;         // How long to force stay awake since last tap
 static bool sleepClock = true;             // Showing the clock in sleep mode?
-static bool softResetNeeded = false;       // Is a soft reset pending?
+static bool configChanged = false;         // Have the settings been saved (and not yet applied)?
 static bool manualUpdateCheck = false;     // Has the GUI requested a firmware update check
 static bool showDataIcon = false;          // Show the data transfer indicator?
 static bool updateIconVisible = false;     // Is the data update icon visible?
@@ -362,11 +402,13 @@ static bool firstLoad = true;              // Are we loading for the first time
 static int prevProgressBarPosition=0;      // Used for progress bar smooth animation
 static int startupProgressPercent;         // Initialisation progress
 static bool wifiConnected = false;         // Connected to WiFi?
-volatile unsigned long nextDataUpdate = 0; // Next National Rail update time (millis)
 static int dataLoadSuccess = 0;            // Count of successful data downloads
 static int dataLoadFailure = 0;            // Count of failed data downloads
 static unsigned long lastLoadFailure = 0;  // When the last failure occurred
 static bool noDataLoaded = true;           // True if no data received for the location
+static bool showingSnapshot = false;       // Showing the saved board until live data is received
+static configSnapshot config;              // config.json compiled for fast reloads
+static unsigned long nextSnapshotSave = 0; // Earliest time the board can be saved to flash again
 static unsigned long lastDataLoadTime = 0; // Timestamp of last data load
 static long apiRefreshRate = DATAUPDATEINTERVAL; // User selected refresh rate for National Rail API (90/45 secs)
 static int dateWidth;                      // Width of the displayed date in pixels
@@ -383,7 +425,6 @@ static bool showServiceMsgs = true;        // Show station and service messages
 static bool showTubeCurrentLocation=false; // Show the current location of the primary tube service
 static int nrTimeOffset = 0;               // Offset minutes for Rail departures display
 static int prevUpdateCheckDay;             // Day of the month the last daily firmware update check was made
-static unsigned long fwUpdateCheckTimer=0; // Next time to check if the day has rolled over for firmware update check
 static bool apiKeys = false;               // Does apikeys.json exist?
 static bool touchEnabled = false;          // TTP223 Touch Sensor installed?
 static bool useRDMclient = false;          // Use the new Rail Data Marketplace API instead of Darwin Lite
@@ -393,7 +434,6 @@ static int numCarouselSlots = 0;
 static int currentCarouselSlot = 0;
 static int numScheduleSlots = 0;
 static int currentScheduleSlot = 0;
-static unsigned long nextSchedulerCheck = 0;
 static char hostname[33];                  // Network hostname (mDNS)
 static char myUrl[24];                     // Stores the board's own url
 
@@ -450,21 +490,31 @@ static const char dualClassSeating[] = " First and Standard class seating availa
 #define frameTimeRail 25
 #define frameTimeTube 18
 #define frameTimeBus 40
+#define scrollSpeedRail 40    // Scrolling speeds in pixels per second
+#define scrollSpeedTube 55
+#define scrollSpeedBus 25
 static int numMessages=0;
 static int scrollStopsXpos = 0;
 static int scrollStopsYpos = 0;
 static int scrollStopsLength = 0;
+static scrollMotion stopsXmotion;
+static scrollMotion stopsYmotion;
 static bool isScrollingStops = false;
 static bool isShowingCalling = false;
 static int currentMessage = 0;
 static int prevMessage = 0;
 static int prevScrollStopsLength = 0;
-static long delayMs;
-static char line2[5+MAXBOARDMESSAGES][MAXCALLINGSIZE+12];
+static char line2[5+MAXBOARDMESSAGES][MAXMESSAGESIZE+12];
+static char callingLine[MAXCALLINGLINESIZE];   // The "Calling at" message is too long for line2
+static int callingMessage = -1;                 // Which message is the calling line (-1 if none)
+static rowLayout serviceRows[MAXBOARDSERVICES+2]; // Laid out service rows, followed by the weather/attribution rows (rail)
+static rowLayout viaRow;                        // The first service showing its via (rail) or current location (tube)
+static bool layoutReady = false;                // Rows have been laid out for the current board data
 
 // Line 3 (additional services)
 static int line3Service = 0;
 static int scrollServiceYpos = 0;
+static scrollMotion serviceYmotion;
 static bool isScrollingService = false;
 static int prevService = 0;
 static bool isShowingVia=false;
@@ -474,22 +524,24 @@ static bool showingMessage = false;
 
 // TfL/bus specific animation
 static int scrollPrimaryYpos = 0;
+static scrollMotion primaryYmotion;
 static bool isScrollingPrimary = false;
 static bool attributionScrolled = false;
 
 static char displayedTime[9] = "";        // The currently displayed time
 static char currentTime[9] = "";          // The current time (keep updated in loop)
-static unsigned long lastTimeUpdate = 0;
-static unsigned long refreshTimer = 0;
+static frameScheduler frameClock;        // Paces the animation frames
+
+// The periodic work in loop(), each a callback run by its timer
+enum loopTimer { TIMER_CLOCK, TIMER_FIRMWARE, TIMER_WIFI, TIMER_DATA, TIMER_WEATHER, TIMER_RSS, TIMER_SCHEDULER, TIMER_SCREENSAVER };
+static eventTimers timers;
 
 // Weather Stuff
-static unsigned long nextWeatherUpdate = 0;            // When the next weather update is due
 static char openWeatherMapApiKey[33] = "";             // If no OWM API key is provided, we use Open-Meteo weather data
 
 // RSS Client
 static bool rssEnabled = false;                        // Add RSS feed to the messages
 static bool rssPriority = false;                       // Prioritise RSS feed
-static unsigned long nextRssUpdate = 0;                // When the next RSS update is due
 static String rssURL;                                  // RSS URL to use
 static String rssName;                                 // Name of feed for atrribution
 static char rssMessage[MAXMESSAGESIZE] = "";           // Holds the current, formatted, RSS message
@@ -500,18 +552,28 @@ touchSensor button(GPIO_NUM_34);
 
 // FreeRTOS Task Handle and Status Flags
 TaskHandle_t fetchTaskHandle = NULL;
+extern TaskHandle_t loopTaskHandle;   // Created by the Arduino core to run setup() and loop()
+// Allocations counted by area (builds with HEAPPROFILE only)
+static heapRegion boardLoopHeap("board loop");
+static heapRegion fetchBoardHeap("fetch board");
+static heapRegion fetchWeatherHeap("fetch weather");
+static heapRegion fetchRssHeap("fetch rss");
+static heapRegion fetchReleaseHeap("fetch release");
 volatile bool fetchComplete = false;
 volatile bool fetchInProgress = false;
 volatile bool rssFetchComplete = false;
 volatile bool weatherFetchComplete = false;
+volatile bool releaseFetchComplete = false;
 volatile int lastUpdateResult = UPD_SUCCESS;
 volatile int lastWeatherUpdateResult = UPD_SUCCESS;
 volatile int lastRssUpdateResult = UPD_SUCCESS;
+volatile int lastReleaseResult = UPD_SUCCESS;
 
 enum fetchModes {
   FETCH_BOARD = 0,
   FETCH_WEATHER = 1,
-  FETCH_RSS = 2
+  FETCH_RSS = 2,
+  FETCH_RELEASE = 3
 };
 fetchModes fetchMode = FETCH_BOARD;
 
@@ -525,26 +587,56 @@ void blankArea(int x, int y, int w, int h) {
 }
 
 int getStringWidth(const char *message) {
-  return u8g2.getStrWidth(message);
+  return metrics.width(message);
+}
+
+// Shorten text (in a buffer of size bytes) that's wider than space, leaving margin pixels for the ellipsis
+void clipText(char *text, size_t size, int space, int margin, const char *ellipsis) {
+  if (metrics.width(text) <= space) return;
+  int length = min((size_t)metrics.fit(text,space-margin),size-strlen(ellipsis)-1);
+  // check if there's a trailing space left
+  if (length && text[length-1] == ' ') length--;
+  strcpy(text+length,ellipsis);
 }
 
 void drawTruncatedText(const char *message, int line, int x) {
   char buff[strlen(message)+4];
   int maxWidth = SCREEN_WIDTH - 6 - x;
-  strcpy(buff,message);
-  int i = strlen(buff);
-  while (u8g2.getStrWidth(buff)>maxWidth && i) buff[i--] = '\0';
-  strcat(buff,"...");
+  int length = metrics.fit(message,maxWidth);
+  memcpy(buff,message,length);
+  strcpy(buff+length,"...");
   u8g2.drawStr(x,line,buff);
 }
 
 void centreText(const char *message, int line) {
-  int width = u8g2.getStrWidth(message);
+  int width = metrics.width(message);
   if (width<=SCREEN_WIDTH) u8g2.drawStr((SCREEN_WIDTH-width)/2,line,message);
   else drawTruncatedText(message,line,0);
 }
 
+// Draw a row that has been laid out in advance
+void drawRow(const rowLayout *row, int y) {
+  if (!row->font()) return;   // Never laid out
+  u8g2.setFont(row->font());
+  for (int i=0;i<row->count();i++) u8g2.drawStr(row->x(i),y,row->runText(i));
+}
+
+// Lay out a row of text centred (or truncated) the same way as centreText
+void layoutCentred(rowLayout *row, const char *message) {
+  int width = metrics.width(message);
+  if (width<=SCREEN_WIDTH) {
+    row->add((SCREEN_WIDTH-width)/2,message);
+  } else {
+    char buff[strlen(message)+4];
+    int length = metrics.fit(message,SCREEN_WIDTH-6);
+    memcpy(buff,message,length);
+    strcpy(buff+length,"...");
+    row->add(0,buff);
+  }
+}
+
 void drawProgressBar(int percent) {
+  if (showingSnapshot) return;  // Don't draw over the saved board
   int newPosition = (percent*190)/100;
   u8g2.drawFrame(32,36,192,12);
   if (prevProgressBarPosition>newPosition) {
@@ -570,6 +662,7 @@ void drawProgressBar(int percent) {
 }
 
 void progressBar(const char *text, int percent) {
+  if (showingSnapshot) return;
   u8g2.setFont(NatRailSmall9);
   blankArea(0,24,256,25);
   centreText(text,24);
@@ -1050,6 +1143,7 @@ void saveFirmwareInfo() {
 void writeDefaultConfig() {
   String defaultConfig = "{\"crs\":\"\",\"station\":\"\",\"lat\":0,\"lon\":0,\"weather\":true,\"sleep\":false,\"showDate\":false,\"showBus\":false,\"update\":true,\"sleepStarts\":23,\"sleepEnds\":8,\"brightness\":20,\"tubeId\":\"\",\"tubeName\":\"\",\"mode\":" + String((!nrToken[0] && rdmDeparturesApiKey=="")?"1":"0") + "}";
   saveFile("/config.json",defaultConfig);
+  config.invalidate();
   resetLocationIds();
   saveFirmwareInfo();
 }
@@ -1069,7 +1163,7 @@ int getTimeInMinutes() {
   return (timeinfo.tm_hour * 60 + timeinfo.tm_min);
 }
 
-void loadSlot(JsonObjectConst slot, bool isDefault, boardModes requestedMode) {
+void loadSlot(const configSlot &slot, bool isDefault, boardModes requestedMode) {
   if (requestedMode == MODE_NEXTMODE) {
     switch (boardMode) {
       case MODE_RAIL:
@@ -1086,59 +1180,111 @@ void loadSlot(JsonObjectConst slot, bool isDefault, boardModes requestedMode) {
         break;
     }
   } else {
-    if (slot["mode"].is<int>()) boardMode = slot["mode"];
-    else if (slot["tube"].is<bool>()) boardMode = slot["tube"] ? MODE_TUBE : MODE_RAIL; // handle legacy v1.x config
+    if (slot.has(SLOT_MODE)) boardMode = (boardModes)slot.mode;   // includes legacy v1.x config
   }
 
   switch (boardMode) {
     case MODE_RAIL:
-      if (slot["crs"].is<const char*>())              strlcpy(locationCode, slot["crs"], sizeof(locationCode));
-      if (slot["platformFilter"].is<const char*>())   strlcpy(locationFilter, slot["platformFilter"], sizeof(locationFilter));
-      if (slot["callingCrs"].is<const char*>())       strlcpy(callingCrsCode, slot["callingCrs"], sizeof(callingCrsCode));
-      if (slot["callingStation"].is<const char*>())   strlcpy(callingStation, slot["callingStation"], sizeof(callingStation));
-      if (slot["lat"].is<float>())                    locationLat = slot["lat"];
-      if (slot["lon"].is<float>())                    locationLon = slot["lon"];
+      if (slot.has(SLOT_CRS))             strlcpy(locationCode, slot.crs, sizeof(locationCode));
+      if (slot.has(SLOT_PLATFORMFILTER))  strlcpy(locationFilter, slot.platformFilter, sizeof(locationFilter));
+      if (slot.has(SLOT_CALLINGCRS))      strlcpy(callingCrsCode, slot.callingCrs, sizeof(callingCrsCode));
+      if (slot.has(SLOT_CALLINGSTATION))  strlcpy(callingStation, slot.callingStation, sizeof(callingStation));
+      if (slot.has(SLOT_LAT))             locationLat = slot.lat;
+      if (slot.has(SLOT_LON))             locationLon = slot.lon;
       break;
 
     case MODE_TUBE:
-      if (slot["tubeId"].is<const char*>())     strlcpy(locationCode, slot["tubeId"], sizeof(locationCode));
-      if (slot["lineid"].is<const char*>())     strlcpy(lineId, slot["lineid"], sizeof(lineId));
-      if (slot["direction"].is<const char*>())  strlcpy(lineDirection, slot["direction"], sizeof(lineDirection));
+      if (slot.has(SLOT_TUBEID))     strlcpy(locationCode, slot.tubeId, sizeof(locationCode));
+      if (slot.has(SLOT_LINEID))     strlcpy(lineId, slot.lineId, sizeof(lineId));
+      if (slot.has(SLOT_DIRECTION))  strlcpy(lineDirection, slot.direction, sizeof(lineDirection));
       if (isDefault) {
-        if (slot["tubeName"].is<const char*>()) strlcpy(locationName, slot["tubeName"], sizeof(locationName));
-        if (slot["tubeLat"].is<float>())      locationLat = slot["tubeLat"];
-        if (slot["tubeLon"].is<float>())      locationLon = slot["tubeLon"];
+        if (slot.has(SLOT_TUBENAME)) strlcpy(locationName, slot.tubeName, sizeof(locationName));
+        if (slot.has(SLOT_TUBELAT))  locationLat = slot.tubeLat;
+        if (slot.has(SLOT_TUBELON))  locationLon = slot.tubeLon;
         pruneFromPhrase(locationName," Underground Station");
         pruneFromPhrase(locationName," DLR Station");
         pruneFromPhrase(locationName," (H&C Line)");
       } else {
-        if (slot["name"].is<const char*>()) strlcpy(locationName, slot["name"], sizeof(locationName));
-        if (slot["lat"].is<float>())          locationLat = slot["lat"];
-        if (slot["lon"].is<float>())          locationLon = slot["lon"];
+        if (slot.has(SLOT_NAME))     strlcpy(locationName, slot.name, sizeof(locationName));
+        if (slot.has(SLOT_LAT))      locationLat = slot.lat;
+        if (slot.has(SLOT_LON))      locationLon = slot.lon;
       }
       break;
 
     case MODE_BUS:
-      if (slot["busId"].is<const char*>())      strlcpy(locationCode, slot["busId"], sizeof(locationCode));
-      if (slot["busFilter"].is<const char*>())  strlcpy(locationFilter, slot["busFilter"], sizeof(locationFilter));
+      if (slot.has(SLOT_BUSID))      strlcpy(locationCode, slot.busId, sizeof(locationCode));
+      if (slot.has(SLOT_BUSFILTER))  strlcpy(locationFilter, slot.busFilter, sizeof(locationFilter));
       if (isDefault) {
-        if (slot["busName"].is<const char*>())    strlcpy(locationName, slot["busName"], sizeof(locationName));
-        if (slot["busLat"].is<float>())           locationLat = slot["busLat"];
-        if (slot["busLon"].is<float>())           locationLon = slot["busLon"];
+        if (slot.has(SLOT_BUSNAME))  strlcpy(locationName, slot.busName, sizeof(locationName));
+        if (slot.has(SLOT_BUSLAT))   locationLat = slot.busLat;
+        if (slot.has(SLOT_BUSLON))   locationLon = slot.busLon;
       } else {
-        if (slot["name"].is<const char*>())   strlcpy(locationName, slot["name"], sizeof(locationName));
-        if (slot["lat"].is<float>())          locationLat = slot["lat"];
-        if (slot["lon"].is<float>())          locationLon = slot["lon"];
+        if (slot.has(SLOT_NAME))     strlcpy(locationName, slot.name, sizeof(locationName));
+        if (slot.has(SLOT_LAT))      locationLat = slot.lat;
+        if (slot.has(SLOT_LON))      locationLon = slot.lon;
       }
       break;
 
   }
 }
 
-// Load the configuration settings (if they exist, if not create a default set for the Web GUI page to read)
-void loadConfig(bool coldBoot = false, boardModes requestedMode = MODE_LOADCONFIG) {
-  JsonDocument doc;
+// Copy the common settings into the running configuration
+void applySettings(const configSettings &settings) {
+  // Load common settings
+  railIsSet = settings.railSet;
+  tubeIsSet = settings.tubeSet;
+  busIsSet = settings.busSet;
+
+  if (settings.has(CFG_HOSTNAME))         strlcpy(hostname, settings.hostname, sizeof(hostname));
+  if (settings.has(CFG_WSDLHOST))         strlcpy(wsdlHost, settings.wsdlHost, sizeof(wsdlHost));
+  if (settings.has(CFG_WSDLAPI))          strlcpy(wsdlAPI, settings.wsdlAPI, sizeof(wsdlAPI));
+  if (settings.has(CFG_SHOWDATE))         dateEnabled = settings.showDate;
+  if (settings.has(CFG_SHOWBUS))          enableBus = settings.showBus;
+  if (settings.has(CFG_SHOWFULLCALLING))  showFullCalling = settings.showFullCalling;
+  if (settings.has(CFG_SHOWFULLMSGS))     showFullMsgs = settings.showFullMsgs;
+  if (settings.has(CFG_SLEEP))            sleepEnabled = settings.sleep;
+  if (settings.has(CFG_DARKSLEEP))        sleepClock = !settings.darkSleep;
+  if (settings.has(CFG_FASTREFRESH))      apiRefreshRate = settings.fastRefresh ? FASTDATAUPDATEINTERVAL : DATAUPDATEINTERVAL;
+  if (settings.has(CFG_WEATHER))          weatherEnabled = settings.weather;
+  if (settings.has(CFG_UPDATE))           firmwareUpdates = settings.update;
+  if (settings.has(CFG_UPDATEDAILY)) {
+    if (settings.updateDaily && !dailyUpdateCheck) timers.schedule(TIMER_FIRMWARE,0);   // Start checking now
+    dailyUpdateCheck = settings.updateDaily;
+  }
+  if (settings.has(CFG_SLEEPSTARTS))      sleepStarts = settings.sleepStarts;
+  if (settings.has(CFG_SLEEPENDS))        sleepEnds = settings.sleepEnds;
+  if (settings.has(CFG_BRIGHTNESS))       brightness = settings.brightness;
+
+  if (settings.has(CFG_NOSCROLL))         noScrolling = settings.noScroll;
+  if (settings.has(CFG_FLIP))             flipScreen = settings.flip;
+  if (settings.has(CFG_TOUCH))            touchEnabled = settings.touch;
+  if (settings.has(CFG_DATAICON))         showDataIcon = settings.dataIcon;
+  if (settings.has(CFG_FORCEWAKETIME))    stayAwakeSeconds = settings.forceWakeTime;
+  if (settings.has(CFG_TZ))               timezone = settings.timezone;
+  if (settings.has(CFG_NRTIMEOFFSET))     nrTimeOffset = settings.nrTimeOffset;
+  if (settings.has(CFG_HIDEPLATFORM))     hidePlatform = settings.hidePlatform;
+  if (settings.has(CFG_HIDEORDINALS))     hideOrdinals = settings.hideOrdinals;
+  if (settings.has(CFG_SHOWLASTSEEN))     showLastSeen = settings.showLastSeen;
+  if (settings.has(CFG_SHOWTUBELOCATION)) showTubeCurrentLocation = settings.showTubeLocation;
+  if (settings.has(CFG_SHOWSERVICEMSGS))  showServiceMsgs = settings.showServiceMsgs;
+
+  if (settings.has(CFG_ENABLESCHEDULER))  enableScheduler = settings.enableScheduler;
+  if (settings.has(CFG_ENABLECAROUSEL))   enableCarousel = settings.enableCarousel;
+
+  if (settings.has(CFG_RSSURL))           rssURL = settings.rssUrl;
+  if (settings.has(CFG_RSSNAME))          rssName = settings.rssName;
+  if (rssURL != "") rssEnabled = true; else rssEnabled = false;
+  if (settings.has(CFG_RSSPRIORITY))      rssPriority = settings.rssPriority;
+
+  if (settings.has(CFG_DATASOURCE))       useRDMclient = (settings.dataSource?1:0);
+  // validate the data source against which api keys are available
+  if (nrToken[0] && rdmDeparturesApiKey=="") useRDMclient = false;
+  else if (!nrToken[0] && rdmDeparturesApiKey!="") useRDMclient = true;
+}
 
+// Load the configuration settings (if they exist, if not create a default set for the Web GUI page to read).
+// config.json is only parsed when it's changed, otherwise the settings come from the compiled snapshot.
+void loadConfig(bool coldBoot = false, boardModes requestedMode = MODE_LOADCONFIG) {
   // Set defaults
   strcpy(hostname,defaultHostname);
   strcpy(lineId,"all");
@@ -1150,163 +1296,58 @@ void loadConfig(bool coldBoot = false, boardModes requestedMode = MODE_LOADCONFI
   schedulerActive = false;
   carouselActive = false;
 
-  if (LittleFS.exists("/config.json")) {
-    File file = LittleFS.open("/config.json", "r");
-    if (file) {
-      DeserializationError error = deserializeJson(doc, file);
-      if (!error) {
-        JsonObject settings = doc.as<JsonObject>();
-
-        // Load common settings
-        if (settings["crs"].is<const char*>() && strlen(settings["crs"])) railIsSet = true; else railIsSet = false;
-        if (settings["tubeId"].is<const char*>() && strlen(settings["tubeId"])) tubeIsSet = true; else tubeIsSet = false;
-        if (settings["busId"].is<const char*>() && strlen(settings["busId"])) busIsSet = true; else busIsSet = false;
-
-        if (settings["hostname"].is<const char*>())   strlcpy(hostname, settings["hostname"], sizeof(hostname));
-        if (settings["wsdlHost"].is<const char*>())   strlcpy(wsdlHost, settings["wsdlHost"], sizeof(wsdlHost));
-        if (settings["wsdlAPI"].is<const char*>())    strlcpy(wsdlAPI, settings["wsdlAPI"], sizeof(wsdlAPI));
-        if (settings["showDate"].is<bool>())          dateEnabled = settings["showDate"];
-        if (settings["showBus"].is<bool>())           enableBus = settings["showBus"];
-        if (settings["showFullCalling"].is<bool>())   showFullCalling = settings["showFullCalling"];
-        if (settings["showFullMsgs"].is<bool>())      showFullMsgs = settings["showFullMsgs"];
-        if (settings["sleep"].is<bool>())             sleepEnabled = settings["sleep"];
-        if (settings["darkSleep"].is<bool>())         sleepClock = !settings["darkSleep"];
-        if (settings["fastRefresh"].is<bool>())       apiRefreshRate = settings["fastRefresh"] ? FASTDATAUPDATEINTERVAL : DATAUPDATEINTERVAL;
-        if (settings["weather"].is<bool>())           weatherEnabled = settings["weather"];
-        if (settings["update"].is<bool>())            firmwareUpdates = settings["update"];
-        if (settings["updateDaily"].is<bool>())       dailyUpdateCheck = settings["updateDaily"];
-        if (settings["sleepStarts"].is<int>())        sleepStarts = settings["sleepStarts"];
-        if (settings["sleepEnds"].is<int>())          sleepEnds = settings["sleepEnds"];
-        if (settings["brightness"].is<int>())         brightness = settings["brightness"];
-
-        if (settings["noScroll"].is<bool>())          noScrolling = settings["noScroll"];
-        if (settings["flip"].is<bool>())              flipScreen = settings["flip"];
-        if (settings["touch"].is<bool>())             touchEnabled = settings["touch"];
-        if (settings["dataIcon"].is<bool>())          showDataIcon = settings["dataIcon"];
-        if (settings["forceWakeTime"].is<int>())      stayAwakeSeconds = settings["forceWakeTime"];
-        if (settings["TZ"].is<const char*>())         timezone = settings["TZ"].as<String>();
-        if (settings["nrTimeOffset"].is<int>())       nrTimeOffset = settings["nrTimeOffset"];
-        if (settings["hidePlatform"].is<bool>())      hidePlatform = settings["hidePlatform"];
-        if (settings["hideOrdinals"].is<bool>())      hideOrdinals = settings["hideOrdinals"];
-        if (settings["showLastSeen"].is<bool>())      showLastSeen = settings["showLastSeen"];
-        if (settings["showTubeLocation"].is<bool>())  showTubeCurrentLocation = settings["showTubeLocation"];
-        if (settings["showServiceMsgs"].is<bool>())   showServiceMsgs = settings["showServiceMsgs"];
-
-        if (settings["enableScheduler"].is<bool>())   enableScheduler = settings["enableScheduler"];
-        if (settings["enableCarousel"].is<bool>())    enableCarousel = settings["enableCarousel"];
-
-        if (settings["rssUrl"].is<const char*>())     rssURL = settings["rssUrl"].as<String>();
-        if (settings["rssName"].is<const char*>())    rssName = settings["rssName"].as<String>();
-        if (rssURL != "") rssEnabled = true; else rssEnabled = false;
-        if (settings["rssPriority"].is<bool>())       rssPriority = settings["rssPriority"];
-
-        if (requestedMode != MODE_NEXTMODE) {
-          if (settings[F("mode")].is<int>())            boardMode = settings[F("mode")];
-          else if (settings[F("tube")].is<bool>())      boardMode = settings[F("tube")] ? MODE_TUBE : MODE_RAIL; // handle legacy v1.x config
-        }
-
-        if (settings["dataSource"].is<int>())         useRDMclient = (settings["dataSource"]?1:0);
-        // validate the data source against which api keys are available
-        if (nrToken[0] && rdmDeparturesApiKey=="") useRDMclient = false;
-        else if (!nrToken[0] && rdmDeparturesApiKey!="") useRDMclient = true;
-
-        if (coldBoot) {
-          // Just load base parameters at boot, clock not set yet so exit
-          file.close();
-          return;
-        }
-
-        // Work out what board mode we're in
-        JsonArray scheduler = settings["scheduler"].as<JsonArray>();
-        JsonArray carousel = settings["carousel"].as<JsonArray>();
-
-        if (enableScheduler && !scheduler.isNull() && scheduler.size() > 0 && (requestedMode==MODE_LOADCONFIG || requestedMode==MODE_NEXTSCHEDULE)) {
-          if (requestedMode == MODE_LOADCONFIG) {
-            int currentMins = getTimeInMinutes();
-            int activeIndex = -1;
-
-            // Iterate through the sorted schedule to find the last entry that has already started
-            for (int i = 0; i < scheduler.size(); i++) {
-              const char* timeStr = scheduler[i]["time"];
-              if (timeStr) {
-                int h, m;
-                if (sscanf(timeStr, "%d:%d", &h, &m) == 2) {
-                  int entryMins = h * 60 + m;
-                  if (entryMins <= currentMins) {
-                    activeIndex = i;
-                  } else {
-                    // Since the array is chronologically sorted, the first entry strictly
-                    // greater than the current time implies we've passed the active one.
-                    break;
-                  }
-                }
-              }
-            }
-
-            // If activeIndex is still -1, it means the current time is before the first entry
-            // of the day. Because of midnight wrap-around, the active entry is the LAST entry
-            // from the previous day.
-            if (activeIndex == -1) {
-              activeIndex = scheduler.size() - 1;
-            }
-
-            // Save the active entry index (for touch)
-            currentScheduleSlot = activeIndex;
-            numScheduleSlots = scheduler.size();
+  if (!config.load()) {
+    if (!LittleFS.exists(CONFIGJSONPATH) && apiKeys) writeDefaultConfig();
+    return;
+  }
+  applySettings(config.settings);
 
-            // The next entry simply follows the active one, wrapping back to 0 at the end of the array
-            int nextIndex = (activeIndex + 1) % scheduler.size();
+  // Includes the legacy v1.x "tube" setting
+  if (requestedMode != MODE_NEXTMODE && config.settings.has(CFG_MODE)) boardMode = (boardModes)config.settings.mode;
 
-            JsonObject currentSchedule = scheduler[activeIndex];
-            loadSlot(currentSchedule,false,requestedMode);
-            schedulerActive = true;
+  if (coldBoot) {
+    // Just load base parameters at boot, clock not set yet so exit
+    return;
+  }
 
-            // Save the time of the active entry
-            const char* timeStrActive = scheduler[activeIndex]["time"];
-            if (timeStrActive) {
-              int h, m;
-              if (sscanf(timeStrActive, "%d:%d", &h, &m) == 2) {
-                activeSlotEventTime = h * 60 + m; // The time (in minutes) of the active event
-              }
-            }
+  // Work out what board mode we're in
+  configSlot slot;
+  if (enableScheduler && config.schedulerSlots() > 0 && (requestedMode==MODE_LOADCONFIG || requestedMode==MODE_NEXTSCHEDULE)) {
+    numScheduleSlots = config.schedulerSlots();
+    if (requestedMode == MODE_LOADCONFIG) {
+      // The snapshot holds the schedule sorted by time, so the active entry is the last one that's already started
+      // (or the last of the previous day if it's before the first entry)
+      currentScheduleSlot = config.activeSchedulerSlot(getTimeInMinutes());
+
+      // The next entry simply follows the active one, wrapping back to 0 at the end
+      int nextIndex = (currentScheduleSlot + 1) % numScheduleSlots;
+
+      // Save the time of the active entry and of the next change (for the loop scheduler)
+      if (config.schedulerTime(currentScheduleSlot) != NOTIME) activeSlotEventTime = config.schedulerTime(currentScheduleSlot);
+      if (config.schedulerTime(nextIndex) != NOTIME) nextSlotEventTime = config.schedulerTime(nextIndex);
+    } else {
+      // Push on to the next schedule slot via touch
+      currentScheduleSlot = (currentScheduleSlot + 1) % numScheduleSlots;
+    }
+    if (config.readSlot(SLOTS_SCHEDULER,currentScheduleSlot,&slot)) loadSlot(slot,false,requestedMode);
+    schedulerActive = true;
+  } else if (enableCarousel && config.carouselSlots() > 0 && requestedMode == MODE_LOADCONFIG) {
+    numCarouselSlots = config.carouselSlots();
+    if (currentCarouselSlot >= numCarouselSlots) currentCarouselSlot = 0;
+    if (config.readSlot(SLOTS_CAROUSEL,currentCarouselSlot,&slot)) {
+      loadSlot(slot,false,requestedMode);
+      if (slot.has(SLOT_DURATION)) nextSlotEventTime = slot.duration;
+    }
+    carouselActive = true;
 
-            // Save the time of the next entry (for the loop scheduler)
-            const char* timeStr = scheduler[nextIndex]["time"];
-            if (timeStr) {
-              int h, m;
-              if (sscanf(timeStr, "%d:%d", &h, &m) == 2) {
-                nextSlotEventTime = h * 60 + m; // The time (in minutes) of the next change
-              }
-            }
-          } else {
-            // Push on to the next schedule slot via touch
-            currentScheduleSlot = (currentScheduleSlot + 1) % numScheduleSlots;
-            JsonObject currentSchedule = scheduler[currentScheduleSlot];
-            loadSlot(currentSchedule,false,requestedMode);
-            schedulerActive = true;
-          }
-        } else if (enableCarousel && !carousel.isNull() && carousel.size() > 0 && requestedMode == MODE_LOADCONFIG) {
-          numCarouselSlots = carousel.size();
-          if (currentCarouselSlot >= numCarouselSlots) currentCarouselSlot = 0;
-          JsonObject currentCarousel = carousel[currentCarouselSlot];
-          loadSlot(currentCarousel,false,requestedMode);
-          carouselActive = true;
-
-          // Work out when the next change occurs
-          activeSlotEventTime = getTimeInMinutes();
-          if (currentCarousel["duration"].is<int>()) nextSlotEventTime = currentCarousel["duration"];
-          nextSlotEventTime = (activeSlotEventTime + nextSlotEventTime) % 1440;
+    // Work out when the next change occurs
+    activeSlotEventTime = getTimeInMinutes();
+    nextSlotEventTime = (activeSlotEventTime + nextSlotEventTime) % 1440;
 
-        } else {
-          // Plain board mode as defined by the user
-          loadSlot(settings,true,requestedMode);
-        }
-      } else {
-        // JSON deserialization failed - TODO
-      }
-      file.close();
-    }
-  } else if (apiKeys) writeDefaultConfig();
+  } else {
+    // Plain board mode as defined by the user
+    if (config.readSlot(SLOTS_DEFAULT,0,&slot)) loadSlot(slot,true,requestedMode);
+  }
 }
 
 void buildRssMessage() {
@@ -1326,20 +1367,24 @@ void buildRssMessage() {
 }
 
 void updateRssFeed() {
-  if (lastRssUpdateResult=rss.loadFeed(rssURL); lastRssUpdateResult == UPD_SUCCESS) {
-    nextRssUpdate = millis() + RSSUPDATEINTERVAL; // update every ten minutes
+  lastRssUpdateResult = rss.loadFeed(rssURL);
+  fetchStats.countResult(UPSTREAM_RSS,lastRssUpdateResult);
+  if (lastRssUpdateResult == UPD_SUCCESS) {
+    timers.schedule(TIMER_RSS,RSSUPDATEINTERVAL); // update every ten minutes
     buildRssMessage();
   }
-  else nextRssUpdate = millis() + (RSSUPDATEINTERVAL/2); // Failed so try again in 5 minutes
+  else timers.schedule(TIMER_RSS,RSSUPDATEINTERVAL/2); // Failed so try again in 5 minutes
 }
 
 // Update the current weather message if weather updates are enabled and we have a lat/lon for the selected location
 void updateCurrentWeather(float latitude, float longitude) {
-  nextWeatherUpdate = millis() + WEATHERUPDATEINTERVAL;
+  timers.schedule(TIMER_WEATHER,WEATHERUPDATEINTERVAL);
   if (!latitude || !longitude) return; // No location co-ordinates
   weatherMsg[0]='\0';
   lastWeatherUpdateResult = currentWeather.updateWeather(openWeatherMapApiKey, latitude, longitude);
+  fetchStats.countResult(UPSTREAM_WEATHER,lastWeatherUpdateResult);
   if (lastWeatherUpdateResult == UPD_SUCCESS) strlcpy(weatherMsg,currentWeather.currentWeatherMessage,MAXWEATHERSIZE);
+  layoutReady = false;
 }
 
 void checkWeatherUpdate(float prevLat, float prevLon) {
@@ -1350,8 +1395,18 @@ void checkWeatherUpdate(float prevLat, float prevLon) {
   }
 }
 
+// Board snapshots (defined with the board drawing functions)
+void saveSnapshot(bool force);
+bool showBoardSnapshot();
+
 // Soft reset/reload the board.
 void softResetBoard(boardModes requestedMode) {
+  // The weather and RSS may be fetched below, never alongside the fetch task
+  if (fetchInProgress) {
+    showSwitchScreen();
+    while (fetchInProgress) delay(50);
+  }
+  saveSnapshot(false);  // Keep the current board in case we come back to it (if it hasn't been saved lately)
   boardModes previousMode = boardMode;
   String prevRssUrl = rssURL;
   float prevLat = locationLat;
@@ -1367,15 +1422,11 @@ void softResetBoard(boardModes requestedMode) {
     setenv("TZ",ukTimezone,1);
   }
   tzset();
-  u8g2.clearBuffer();
-  drawStartupHeading();
-  if (requestedMode==MODE_NEXTMODE) centreText("Switching modes...",53);
-  u8g2.updateDisplay();
 
   // Force an update asap
-  nextDataUpdate = 0;
-  nextWeatherUpdate = millis()+60000; // Ensure the weather is updated after the data feed
-  nextRssUpdate += 30000;
+  timers.schedule(TIMER_DATA,0);
+  timers.schedule(TIMER_WEATHER,60000); // Ensure the weather is updated after the data feed
+  timers.postpone(TIMER_RSS,30000);
   isScrollingService = false;
   isScrollingStops = false;
   isScrollingPrimary = false;
@@ -1383,20 +1434,36 @@ void softResetBoard(boardModes requestedMode) {
   forcedSleep=false;
   firstLoad=true;
   noDataLoaded=true;
-  viaTimer=0;
-  timer=0;
-  serviceTimer=0;
+  viaTimer=millis();
+  timer=millis();
+  frameClock.restart();
+  serviceTimer=millis();
   prevProgressBarPosition=133;
   startupProgressPercent=70;
   currentMessage=0;
+  messageStrip.clear();
   prevMessage=0;
   prevScrollStopsLength=0;
   isShowingVia=false;
   line3Service=0;
   prevService=0;
   fetchComplete=false;
-  nextSchedulerCheck=millis()+10000;
-  if (!weatherEnabled) weatherMsg[0]='\0';
+  timers.schedule(TIMER_SCHEDULER,SCHEDULERCHECKINTERVAL);
+  xSemaphoreTake(boardLock,portMAX_DELAY);
+  station.numServices=0;
+  messages.numMessages=0;
+  boardVersion++;
+  xSemaphoreGive(boardLock);
+  if (!showBoardSnapshot()) {
+    u8g2.clearBuffer();
+    drawStartupHeading();
+    if (requestedMode==MODE_NEXTMODE) centreText("Switching modes...",53);
+    u8g2.updateDisplay();
+  }
+  if (!weatherEnabled) {
+    weatherMsg[0]='\0';
+    layoutReady = false;
+  }
   else if (!prevWeatherEnabled) {
     // force a weather update, even if the location hasn't changed
     prevLat=0;
@@ -1442,8 +1509,6 @@ void softResetBoard(boardModes requestedMode) {
       busdata.cleanFilter(locationFilter,locationCleanFilter,sizeof(locationFilter));
       break;
   }
-  station.numServices=0;
-  messages.numMessages=0;
 }
 
 // Handle switching to next board mode or carousel/scheduler slot (touch sensor)
@@ -1546,46 +1611,42 @@ bool checkForFirmwareUpdate() {
  * Station Board functions - pulling updates and animating the Departures Board main display
  */
 
-// Draw the primary service line
-void drawPrimaryService(bool showVia) {
+// Lay out the primary service line
+void layoutPrimaryService(rowLayout *row, bool showVia) {
   int destPos;
   char clipDestination[MAXLOCATIONSIZE];
   char etd[16];
   char plat[9];
+  char sTime[6];
 
   u8g2.setFont(NatRailTall12);
-  blankArea(0,LINE1,256,LINE2-LINE1);
-  destPos = u8g2.drawStr(0,LINE1-1,station.service[0].sTime) + 6;
-  if (isDigit(station.service[0].etd[0])) sprintf(etd,"Exp %s",station.service[0].etd);
+  row->clear(NatRailTall12);
+  formatTime(station.service[0].sTime,sTime);
+  row->add(0,sTime);
+  destPos = metrics.advance(sTime) + 6;
+  if (station.service[0].etdTime != NOTIME) sprintf(etd,"Exp %s",formatTime(station.service[0].etdTime,sTime));
   else strcpy(etd,station.service[0].etd);
   int etdWidth = getStringWidth(etd) + (etd[strlen(etd)-1]=='1'?1:0);
-  u8g2.drawStr(SCREEN_WIDTH - etdWidth,LINE1-1,etd);
+  row->add(SCREEN_WIDTH - etdWidth,etd);
   int spaceAvailable = SCREEN_WIDTH - destPos - etdWidth - 6;
 
   if (station.platformAvailable && station.service[0].platform[0] && station.service[0].serviceType == TRAIN && !hidePlatform) {
     sprintf(plat,"Plat %.3s",station.service[0].platform);
     int platWidth = getStringWidth(plat) + (plat[strlen(plat)-1]=='1'?1:0);;
-    u8g2.drawStr(SCREEN_WIDTH - etdWidth - platWidth - 7,LINE1-1,plat);
+    row->add(SCREEN_WIDTH - etdWidth - platWidth - 7,plat);
     spaceAvailable-=(platWidth+7);
   }
 
-  if (showVia) strcpy(clipDestination,station.service[0].via);
-  else strcpy(clipDestination,station.service[0].destination);
-  if (getStringWidth(clipDestination) > spaceAvailable) {
-    while (getStringWidth(clipDestination) > (spaceAvailable - 8)) {
-      clipDestination[strlen(clipDestination)-1] = '\0';
-    }
-    // check if there's a trailing space left
-    if (clipDestination[strlen(clipDestination)-1] == ' ') clipDestination[strlen(clipDestination)-1] = '\0';
-    strcat(clipDestination,"...");
-  }
-  u8g2.drawStr(destPos,LINE1-1,clipDestination);
+  if (showVia) strlcpy(clipDestination,station.text.get(station.service[0].via),sizeof(clipDestination));
+  else strlcpy(clipDestination,station.text.get(station.service[0].destination),sizeof(clipDestination));
+  clipText(clipDestination,sizeof(clipDestination),spaceAvailable,8,"...");
+  row->add(destPos,clipDestination);
   // Set font back to standard
   u8g2.setFont(NatRailSmall9);
 }
 
-// Draw the secondary service line
-void drawServiceLine(int line, int y) {
+// Lay out a secondary service line (or the weather/attribution line after the services)
+void layoutServiceLine(rowLayout *row, int line) {
   char clipDestination[MAXLOCATIONSIZE];
   char ordinal[5];
   char plat[9];
@@ -1604,53 +1665,90 @@ void drawServiceLine(int line, int y) {
   }
 
   u8g2.setFont(NatRailSmall9);
-  blankArea(0,y,256,9);
+  row->clear(NatRailSmall9);
 
   if (line<station.numServices) {
+    char sTime[6];
+    formatTime(station.service[line].sTime,sTime);
     if (hideOrdinals) {
-      destPos = u8g2.drawStr(0,y-1,station.service[line].sTime) + 6;
+      row->add(0,sTime);
+      destPos = metrics.advance(sTime) + 6;
     } else {
-      u8g2.drawStr(0,y-1,ordinal);
-      destPos = u8g2.drawStr(21,y-1,station.service[line].sTime) + 25;
+      row->add(0,ordinal);
+      row->add(21,sTime);
+      destPos = metrics.advance(sTime) + 25;
     }
     char etd[16];
-    if (isDigit(station.service[line].etd[0])) sprintf(etd,"Exp %s",station.service[line].etd);
+    if (station.service[line].etdTime != NOTIME) sprintf(etd,"Exp %s",formatTime(station.service[line].etdTime,sTime));
     else strcpy(etd,station.service[line].etd);
     int etdWidth = getStringWidth(etd) + (etd[strlen(etd)-1]=='1'?1:0);
-    u8g2.drawStr(SCREEN_WIDTH - etdWidth,y-1,etd);
+    row->add(SCREEN_WIDTH - etdWidth,etd);
     int spaceAvailable = SCREEN_WIDTH - destPos - etdWidth - 6;
 
     if (station.platformAvailable && !hidePlatform && station.service[line].platform[0] && station.service[line].serviceType == TRAIN) {
       sprintf(plat,"Plat %.3s",station.service[line].platform);
       int platWidth = getStringWidth(plat) + (plat[strlen(plat)-1]=='1'?1:0);
-      u8g2.drawStr(SCREEN_WIDTH - etdWidth - platWidth - 7,y-1,plat);
+      row->add(SCREEN_WIDTH - etdWidth - platWidth - 7,plat);
       spaceAvailable-=(platWidth+7);
     }
     // work out if we need to clip the destination
-    strcpy(clipDestination,station.service[line].destination);
-    if (getStringWidth(clipDestination) > spaceAvailable) {
-      while (getStringWidth(clipDestination) > spaceAvailable - 5) {
-        clipDestination[strlen(clipDestination)-1] = '\0';
-      }
-      // check if there's a trailing space left
-      if (clipDestination[strlen(clipDestination)-1] == ' ') clipDestination[strlen(clipDestination)-1] = '\0';
-      strcat(clipDestination,"...");
-    }
-    u8g2.drawStr(destPos,y-1,clipDestination);
+    strlcpy(clipDestination,station.text.get(station.service[line].destination),sizeof(clipDestination));
+    clipText(clipDestination,sizeof(clipDestination),spaceAvailable,5,"...");
+    row->add(destPos,clipDestination);
   } else {
     if (weatherMsg[0] && line==station.numServices) {
       // We're showing the weather
-      centreText(weatherMsg,y-1);
+      layoutCentred(row,weatherMsg);
     } else {
       // We're showing the mandatory attribution
-      centreText(useRDMclient?rdgAttribution:nrAttributionn,y-1);
+      layoutCentred(row,useRDMclient?rdgAttribution:nrAttributionn);
     }
   }
 }
 
+// Lay out every row of the rail board for the current data
+void layoutRailBoard() {
+  if (station.numServices) {
+    layoutPrimaryService(&serviceRows[0],false);
+    if (station.service[0].via.length) layoutPrimaryService(&viaRow,true);
+  }
+  for (int line=station.numServices?1:0;line<=station.numServices+1;line++) layoutServiceLine(&serviceRows[line],line);
+  layoutReady = true;
+}
+
+// Draw the primary service line
+void drawPrimaryService(bool showVia) {
+  if (!layoutReady) layoutRailBoard();
+  blankArea(0,LINE1,256,LINE2-LINE1);
+  drawRow((showVia && station.service[0].via.length) ? &viaRow : &serviceRows[0],LINE1-1);
+  // Set font back to standard
+  u8g2.setFont(NatRailSmall9);
+}
+
+// Draw the secondary service line
+void drawServiceLine(int line, int y) {
+  if (!layoutReady) layoutRailBoard();
+  u8g2.setFont(NatRailSmall9);
+  blankArea(0,y,256,9);
+  if (line>station.numServices+1) line=station.numServices+1;
+  drawRow(&serviceRows[line],y-1);
+}
+
+// Format the calling points of the first service into the calling line
+void formatCallingLine() {
+  strcpy(callingLine,"Calling at: ");
+  formatCallingPoints(&station,callingLine+12,sizeof(callingLine)-12);
+}
+
+// Text of a rail board line 2 message
+const char *line2Text(int message) {
+  return (message==callingMessage) ? callingLine : line2[message];
+}
+
 // Draw the initial Departures Board
 void drawStationBoard() {
   numMessages=0;
+  callingMessage=-1;
   if (firstLoad) {
     // Clear the entire screen for the first load since boot up/wake from sleep
     u8g2.clearBuffer();
@@ -1668,29 +1766,33 @@ void drawStationBoard() {
   viaTimer=millis()+300000;  // effectively don't check for via
   if (station.numServices) {
     drawPrimaryService(false);
-    if (station.service[0].via[0]) viaTimer=millis()+4000;
+    const char *serviceMessage = station.text.get(station.serviceMessage);
+    const char *origin = station.text.get(station.origin);
+    const char *opco = station.text.get(station.service[0].opco);
+    if (station.service[0].via.length) viaTimer=millis()+4000;
     if (station.service[0].isCancelled) {
       // This train is cancelled
-      if (station.serviceMessage[0]) {
-        strcpy(line2[0],station.serviceMessage);
+      if (serviceMessage[0]) {
+        strcpy(line2[0],serviceMessage);
         numMessages=1;
       }
     } else {
       // The train is not cancelled
-      if (station.service[0].isDelayed && station.serviceMessage[0]) {
+      if (station.service[0].isDelayed && serviceMessage[0]) {
         // The train is delayed and there's a reason
-        strcpy(line2[0],station.serviceMessage);
+        strcpy(line2[0],serviceMessage);
         numMessages++;
       }
-      if (station.calling[0]) {
+      if (station.numCalling) {
         // Add the calling stops message
-        sprintf(line2[numMessages],"Calling at: %s",station.calling);
+        formatCallingLine();
+        callingMessage=numMessages;
         numMessages++;
       }
-      if (strcmp(station.origin, station.location)==0) {
+      if (strcmp(origin, station.location)==0) {
         // Service originates at this station
-        if (station.service[0].opco[0]) {
-          sprintf(line2[numMessages],"This %s service starts here.",station.service[0].opco);
+        if (opco[0]) {
+          sprintf(line2[numMessages],"This %s service starts here.",opco);
         } else {
           strcpy(line2[numMessages],"This service starts here.");
         }
@@ -1710,15 +1812,15 @@ void drawStationBoard() {
       } else {
         // Service originates elsewhere
         strcpy(line2[numMessages],"");
-        if (station.service[0].opco[0]) {
-          if (station.origin[0]) {
-            sprintf(line2[numMessages],"This is the %s service from %s.",station.service[0].opco,station.origin);
+        if (opco[0]) {
+          if (origin[0]) {
+            sprintf(line2[numMessages],"This is the %s service from %s.",opco,origin);
           } else {
-            sprintf(line2[numMessages],"This is the %s service.",station.service[0].opco);
+            sprintf(line2[numMessages],"This is the %s service.",opco);
           }
         } else {
-          if (station.origin[0]) {
-            sprintf(line2[numMessages],"This service originated at %s.",station.origin);
+          if (origin[0]) {
+            sprintf(line2[numMessages],"This service originated at %s.",origin);
           }
         }
         // Add the seating if available
@@ -1770,17 +1872,45 @@ void drawStationBoard() {
   // Setup for the first message to rollover to
   isScrollingStops=false;
   currentMessage=numMessages-1;
+  messageStrip.clear();
 
   u8g2.setFont(NatRailSmall9);
   u8g2.sendBuffer();
 }
 
+// Send the board to the event feed subscribers, either in full or just the secondary changes
+void publishBoard(bool changesOnly) {
+  if (!boardEvents.count()) return;
+  if (feed.fullRequested()) changesOnly = false;
+  const stnMessages *boardMessages = (boardMode == MODE_BUS) ? nullptr : &messages;
+  size_t len;
+  if (changesOnly) {
+    len = feed.encodeChanges(&station,boardMessages);
+  } else {
+    len = feed.encodeBoard(boardMode == MODE_RAIL ? "rail" : boardMode == MODE_TUBE ? "tube" : "bus",&station,boardMessages);
+  }
+  if (len) boardEvents.send(feed.data(),changesOnly ? "changes" : "board",feed.id());
+  feed.release();
+}
+
+// New subscribers are sent the whole board once there is one
+void updateFeed() {
+  if (feed.fullRequested() && !noDataLoaded) publishBoard(false);
+}
+
 void updateRailDepartures() {
+  xSemaphoreTake(boardLock,portMAX_DELAY);
   if (useRDMclient) rdmRailData.loadDepartures(&station,&messages);
   else darwinRailData.loadDepartures(&station,&messages);
+  boardVersion++;
+  xSemaphoreGive(boardLock);
   lastDataLoadTime = millis();
   noDataLoaded = false;
+  showingSnapshot = false;
   dataLoadSuccess++;
+  layoutReady = false;
+  saveSnapshot(false);
+  publishBoard(lastUpdateResult == UPD_SEC_CHANGE);
 }
 
 void waitForFirstLoad() {
@@ -1824,41 +1954,62 @@ bool drawCurrentTimeUG() {
 }
 
 void updateArrivals() {
+  xSemaphoreTake(boardLock,portMAX_DELAY);
   tfldata.loadArrivals(&station,&messages);
+  boardVersion++;
+  xSemaphoreGive(boardLock);
   lastDataLoadTime = millis();
   noDataLoaded = false;
+  showingSnapshot = false;
   dataLoadSuccess++;
+  layoutReady = false;
+  saveSnapshot(false);
+  publishBoard(lastUpdateResult == UPD_SEC_CHANGE);
 }
 
-void drawUndergroundService(int serviceId, int y, bool isShowingCurrentLocation = false) {
+// Lay out an arrival row
+void layoutUndergroundService(rowLayout *row, int serviceId, bool isShowingCurrentLocation) {
   char serviceData[4+MAXLOCATIONSIZE];
   int usedSpace = 4;
 
   u8g2.setFont(Underground10);
-  blankArea(0,y,256,10);
+  row->clear(Underground10);
 
   if (serviceId < station.numServices) {
-    if (serviceId || (strcmp(station.origin,"At Platform") && station.service[0].timeToStation>10)) {
+    if (serviceId || (strcmp(station.text.get(station.origin),"At Platform") && station.service[0].timeToStation>10)) {
       if (station.service[serviceId].timeToStation <= 40) {
-        usedSpace += u8g2.drawStr(SCREEN_WIDTH-19,y-1,"Due");
+        row->add(SCREEN_WIDTH-19,"Due");
+        usedSpace += metrics.advance("Due");
       } else {
         int mins = (station.service[serviceId].timeToStation + 30) / 60; // Round to nearest minute
         sprintf(serviceData,"%d",mins);
-        if (mins==1) u8g2.drawStr(SCREEN_WIDTH-22,y-1,"min"); else u8g2.drawStr(SCREEN_WIDTH-22,y-1,"mins");
-        usedSpace += u8g2.drawStr(SCREEN_WIDTH-27-(strlen(serviceData)*7),y-1,serviceData) + 22;
+        row->add(SCREEN_WIDTH-22,(mins==1)?"min":"mins");
+        row->add(SCREEN_WIDTH-27-(strlen(serviceData)*7),serviceData);
+        usedSpace += metrics.advance(serviceData) + 22;
       }
     }
 
-    if (isShowingCurrentLocation) sprintf(serviceData,"%d %s",serviceId+1,station.origin);
-    else sprintf(serviceData,"%d %s",serviceId+1,station.service[serviceId].destination);
-    if (getStringWidth(serviceData) > SCREEN_WIDTH-usedSpace) {
-      while (getStringWidth(serviceData) > SCREEN_WIDTH-usedSpace-6) {
-        serviceData[strlen(serviceData)-1] = '\0';
-      }
-      if (serviceData[strlen(serviceData)-1] == ' ') serviceData[strlen(serviceData)-1] = '\0'; // remove any trailing space
-      strcat(serviceData,"\x81");
-    }
-    u8g2.drawStr(0,y-1,serviceData);
+    if (isShowingCurrentLocation) snprintf(serviceData,sizeof(serviceData),"%d %s",serviceId+1,station.text.get(station.origin));
+    else snprintf(serviceData,sizeof(serviceData),"%d %s",serviceId+1,station.text.get(station.service[serviceId].destination));
+    clipText(serviceData,sizeof(serviceData),SCREEN_WIDTH-usedSpace,6,"\x81");
+    row->add(0,serviceData);
+  }
+}
+
+// Lay out every arrival row for the current data
+void layoutUndergroundBoard() {
+  for (int i=0;i<station.numServices;i++) layoutUndergroundService(&serviceRows[i],i,false);
+  if (station.numServices && station.origin.length) layoutUndergroundService(&viaRow,0,true);
+  layoutReady = true;
+}
+
+void drawUndergroundService(int serviceId, int y, bool isShowingCurrentLocation = false) {
+  if (!layoutReady) layoutUndergroundBoard();
+  u8g2.setFont(Underground10);
+  blankArea(0,y,256,10);
+
+  if (serviceId < station.numServices) {
+    drawRow((isShowingCurrentLocation && serviceId==0) ? &viaRow : &serviceRows[serviceId],y-1);
   }
 }
 
@@ -1879,16 +2030,18 @@ void drawUndergroundBoard() {
 
   if (station.boardChanged) {
     isShowingVia = false;
-    if (station.origin[0]) viaTimer=millis()+6000; else viaTimer=millis()+300000;
+    if (station.origin.length) viaTimer=millis()+6000; else viaTimer=millis()+300000;
     // prepare to scroll up primary services
     scrollPrimaryYpos = 11;
+    primaryYmotion.start(11,0,scrollSpeedTube);
     isScrollingPrimary = true;
     // reset line3
     line3Service = 99;
     prevScrollStopsLength = 0;
     currentMessage=99;
+    messageStrip.clear();
     blankArea(0,ULINE3,256,11);
-    serviceTimer=0;
+    serviceTimer=millis();
   } else {
     // Draw the primary service line(s)
     if (station.numServices) {
@@ -1934,34 +2087,43 @@ void drawUndergroundBoard() {
  * Bus Departures Board
  *
  */
-void drawBusService(int serviceId, int y, int destPos) {
+// Lay out a bus departure row
+void layoutBusService(rowLayout *row, int serviceId, int destPos) {
   char clipDestination[MAXLOCATIONSIZE];
   char etd[16];
 
+  u8g2.setFont(NatRailSmall9);
+  row->clear(NatRailSmall9);
   if (serviceId < station.numServices) {
-    u8g2.setFont(NatRailSmall9);
-    blankArea(0,y,256,9);
-
-    u8g2.drawStr(0,y-1,station.service[serviceId].via);
+    row->add(0,station.text.get(station.service[serviceId].via));
     int etdWidth = 25;
-    if (isDigit(station.service[serviceId].etd[0])) {
-      sprintf(etd,"Exp %s",station.service[serviceId].etd);
+    char sTime[6];
+    if (station.service[serviceId].etdTime != NOTIME) {
+      sprintf(etd,"Exp %s",formatTime(station.service[serviceId].etdTime,sTime));
       etdWidth = 47;
-    } else strcpy(etd,station.service[serviceId].sTime);
-    u8g2.drawStr(SCREEN_WIDTH - etdWidth,y-1,etd);
+    } else formatTime(station.service[serviceId].sTime,etd);
+    row->add(SCREEN_WIDTH - etdWidth,etd);
 
     // work out if we need to clip the destination
-    strcpy(clipDestination,station.service[serviceId].destination);
+    strlcpy(clipDestination,station.text.get(station.service[serviceId].destination),sizeof(clipDestination));
     int spaceAvailable = SCREEN_WIDTH - destPos - etdWidth - 6;
-    if (getStringWidth(clipDestination) > spaceAvailable) {
-      while (getStringWidth(clipDestination) > spaceAvailable - 17) {
-        clipDestination[strlen(clipDestination)-1] = '\0';
-      }
-      // check if there's a trailing space left
-      if (clipDestination[strlen(clipDestination)-1] == ' ') clipDestination[strlen(clipDestination)-1] = '\0';
-      strcat(clipDestination,"...");
-    }
-    u8g2.drawStr(destPos,y-1,clipDestination);
+    clipText(clipDestination,sizeof(clipDestination),spaceAvailable,17,"...");
+    row->add(destPos,clipDestination);
+  }
+}
+
+// Lay out every bus departure row for the current data
+void layoutBusBoard() {
+  for (int i=0;i<station.numServices;i++) layoutBusService(&serviceRows[i],i,busDestX);
+  layoutReady = true;
+}
+
+void drawBusService(int serviceId, int y) {
+  if (!layoutReady) layoutBusBoard();
+  if (serviceId < station.numServices) {
+    u8g2.setFont(NatRailSmall9);
+    blankArea(0,y,256,9);
+    drawRow(&serviceRows[serviceId],y-1);
   }
 }
 
@@ -1983,6 +2145,7 @@ void drawBusDeparturesBoard() {
   if (station.boardChanged) {
     // prepare to scroll up primary services
     scrollPrimaryYpos = 11;
+    primaryYmotion.start(11,0,scrollSpeedBus);
     isScrollingPrimary = true;
     // reset line3
     if (station.numServices>2) {
@@ -1992,12 +2155,12 @@ void drawBusDeparturesBoard() {
     }
     currentMessage = -1;
     blankArea(0,ULINE3,256,11);
-    serviceTimer=0;
+    serviceTimer=millis();
   } else {
     // Draw the primary service line(s)
     if (station.numServices) {
-      drawBusService(0,ULINE1,busDestX);
-      if (station.numServices>1) drawBusService(1,ULINE2,busDestX);
+      drawBusService(0,ULINE1);
+      if (station.numServices>1) drawBusService(1,ULINE2);
     } else {
       u8g2.setFont(NatRailSmall9);
       centreText("There are no scheduled services at this stop.",ULINE1-1);
@@ -2006,16 +2169,13 @@ void drawBusDeparturesBoard() {
   u8g2.sendBuffer();
 }
 
-void updateBusDepartures() {
-  busdata.loadDepartures(&station);
-  lastDataLoadTime = millis();
-  noDataLoaded = false;
-  dataLoadSuccess++;
+// Work out the service number column width and the bus board messages
+void prepareBusBoard() {
   // Work out the max column size for service numbers
   busDestX=0;
   u8g2.setFont(NatRailSmall9);
   for (int i=0;i<station.numServices;i++) {
-    int svcWidth = getStringWidth(station.service[i].via);
+    int svcWidth = getStringWidth(station.text.get(station.service[i].via));
     busDestX = (busDestX > svcWidth) ? busDestX : svcWidth;
   }
   busDestX+=5;
@@ -2029,6 +2189,163 @@ void updateBusDepartures() {
   }
 }
 
+void updateBusDepartures() {
+  xSemaphoreTake(boardLock,portMAX_DELAY);
+  busdata.loadDepartures(&station);
+  boardVersion++;
+  xSemaphoreGive(boardLock);
+  lastDataLoadTime = millis();
+  noDataLoaded = false;
+  showingSnapshot = false;
+  dataLoadSuccess++;
+  layoutReady = false;
+  saveSnapshot(false);
+  publishBoard(lastUpdateResult == UPD_SEC_CHANGE);
+  prepareBusBoard();
+}
+
+/*
+ * Board snapshots
+ */
+
+// Snapshots are kept per mode and only shown if the board settings are unchanged
+const char *getSnapshotPath() {
+  switch (boardMode) {
+    case MODE_TUBE: return "/snapshot_tube.bin";
+    case MODE_BUS: return "/snapshot_bus.bin";
+    default: return "/snapshot_rail.bin";
+  }
+}
+
+void getSnapshotKey(char *key, size_t size) {
+  snprintf(key,size,"%d|%s|%s|%s|%d|%s|%s",boardMode,locationCode,locationFilter,callingCrsCode,nrTimeOffset,lineId,lineDirection);
+}
+
+// Save the displayed board to flash (not more often than SNAPSHOTINTERVAL unless forced)
+void saveSnapshot(bool force) {
+  if (noDataLoaded || showingSnapshot) return;   // Nothing live to save
+  if (!force && !timeReached(nextSnapshotSave)) return;
+  char key[MAXSNAPSHOTKEYSIZE];
+  getSnapshotKey(key,sizeof(key));
+  saveBoardSnapshot(getSnapshotPath(),key,&station,&messages,weatherEnabled ? weatherMsg : "");
+  nextSnapshotSave = millis() + SNAPSHOTINTERVAL;
+}
+
+// Mark the board as saved data in place of the clock
+void drawSnapshotTime(const char *savedTime) {
+  char marker[16];
+  if (savedTime[0]) sprintf(marker,"As at %s",savedTime); else strcpy(marker,"Saved");
+  u8g2.setFont(NatRailSmall9);
+  int width = getStringWidth(marker);
+  if (boardMode == MODE_RAIL) {
+    blankArea(96,LINE4,64,SCREEN_HEIGHT-LINE4);
+    u8g2.drawStr(96+(64-width)/2,LINE4-1,marker);
+  } else {
+    blankArea(99,ULINE4,58,8);
+    u8g2.drawStr(99+(58-width)/2,ULINE4-1,marker);
+    if (boardMode == MODE_TUBE) u8g2.setFont(Underground10);
+  }
+  displayedTime[0] = '\0';  // Clock will be drawn over it once running
+}
+
+// Show the last saved board for the current settings (if any) until live data arrives
+bool showBoardSnapshot() {
+  char key[MAXSNAPSHOTKEYSIZE];
+  char savedTime[6];
+  getSnapshotKey(key,sizeof(key));
+  xSemaphoreTake(boardLock,portMAX_DELAY);
+  showingSnapshot = loadBoardSnapshot(getSnapshotPath(),key,&station,&messages,weatherMsg,sizeof(weatherMsg),savedTime);
+  boardVersion++;
+  xSemaphoreGive(boardLock);
+  if (!showingSnapshot) return false;
+
+  layoutReady = false;
+  firstLoad = true;
+  station.boardChanged = false;
+  // The clock may not be set yet, so leave the date off until the board is refreshed
+  bool showDate = dateEnabled;
+  dateEnabled = false;
+  switch (boardMode) {
+    case MODE_RAIL:
+      drawStationBoard();
+      break;
+    case MODE_TUBE:
+      drawUndergroundBoard();
+      break;
+    case MODE_BUS:
+      prepareBusBoard();
+      drawBusDeparturesBoard();
+      break;
+  }
+  dateEnabled = showDate;
+  drawSnapshotTime(savedTime);
+  u8g2.sendBuffer();
+  return true;
+}
+
+/*
+ * Applying settings changes
+ */
+
+// Draw the board again from the data already held, after a display setting has changed
+void redrawBoard() {
+  if (isSleeping || noDataLoaded || showingSnapshot) return;   // The new settings are used when the board is next drawn
+  isScrollingService = false;
+  isScrollingStops = false;
+  isScrollingPrimary = false;
+  layoutReady = false;
+  firstLoad = true;             // Clear the whole screen and set the brightness
+  station.boardChanged = false; // Don't scroll the services in again
+  switch (boardMode) {
+    case MODE_RAIL:
+      drawStationBoard();
+      break;
+    case MODE_TUBE:
+      drawUndergroundBoard();
+      break;
+    case MODE_BUS:
+      prepareBusBoard();
+      drawBusDeparturesBoard();
+      break;
+  }
+}
+
+// Apply saved settings. Only location, mode, schedule and data source changes need the board to be soft reset,
+// anything else is applied in place and only refetches the data it affects.
+void applyConfigChange() {
+  uint8_t impact = config.reload();
+  if (!impact) return;
+  if (impact & IMPACT_REBOOT) {
+    // Give the web server a moment to finish sending the response to the save
+    saveSnapshot(true);
+    restartTimer.once(1, []() { ESP.restart(); });
+    return;
+  }
+  if (impact & IMPACT_TRANSPORT) {
+    softResetBoard(MODE_LOADCONFIG);
+    return;
+  }
+
+  String prevRssUrl = rssURL;
+  bool prevWeatherEnabled = weatherEnabled;
+  applySettings(config.settings);
+
+  if (impact & IMPACT_WEATHER) {
+    if (!weatherEnabled) weatherMsg[0] = '\0';
+    else if (!prevWeatherEnabled) timers.schedule(TIMER_WEATHER,0);
+  }
+  if (impact & IMPACT_RSS) {
+    rssMessage[0] = '\0';
+    if (rssEnabled && prevRssUrl != rssURL) timers.schedule(TIMER_RSS,0);
+    else if (rssEnabled) buildRssMessage();
+  }
+  if (impact & IMPACT_BOARD) timers.schedule(TIMER_DATA,0);
+  if (impact & IMPACT_RENDER) {
+    u8g2.setFlipMode(flipScreen ? 1 : 0);
+    redrawBoard();
+  }
+}
+
 /*
  * Web GUI functions
  */
@@ -2084,17 +2401,30 @@ bool handleStreamFile(String filename, AsyncWebServerRequest *request) {
 }
 
 // Stream a file stored in flash (default graphics are now included in the firmware image)
-void handleStreamFlashFile(String filename, const uint8_t *filedata, size_t contentLength, AsyncWebServerRequest *request) {
-  String contentType = getContentType(filename);
-  AsyncWebServerResponse *response = request->beginResponse(200, contentType, filedata, contentLength);
-  response->addHeader("Cache-Control", "public,max-age=3600,s-maxage=3600");
-  request->send(response);
+// Find a web asset held in flash (the table is sorted by path)
+const webRoute *findWebRoute(const char *path) {
+  int low = 0;
+  int high = WEBROUTECOUNT-1;
+  while (low <= high) {
+    int mid = (low+high)/2;
+    int cmp = strcmp(path,webRoutes[mid].path);
+    if (!cmp) return &webRoutes[mid];
+    if (cmp < 0) high = mid-1; else low = mid+1;
+  }
+  return nullptr;
 }
 
-void handleStreamGzipFlashFile(String filename, const uint8_t *filedata, size_t contentLength, AsyncWebServerRequest *request) {
-  String contentType = getContentType(filename);
-  AsyncWebServerResponse *response = request->beginResponse(200, contentType, filedata, contentLength);
-  response->addHeader("Content-Encoding", "gzip");
+// Send a web asset held in flash, or just a 304 if the browser already has this version
+void handleStreamRoute(const webRoute *route, AsyncWebServerRequest *request) {
+  AsyncWebServerResponse *response;
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match").indexOf(route->etag) >= 0) {
+    response = request->beginResponse(304);
+  } else {
+    response = request->beginResponse(200, route->contentType, route->data, route->length);
+    if (route->gzipped) response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", route->etag);
+  response->addHeader("Cache-Control", route->cacheControl);
   request->send(response);
 }
 
@@ -2110,34 +2440,49 @@ String getFSInfo() {
   return String(info);
 }
 
-// Send a basic directory listing to the browser
+// Send a response in chunks. The writer is run again for each chunk and only that chunk's part of its output
+// is kept, so memory use doesn't grow with the size of the response. The writer must give the same output
+// every time, so anything that can change between chunks should be copied before the response starts.
+void sendChunked(AsyncWebServerRequest *request, const char *contentType, std::function<void(chunkWriter &)> writer) {
+  AsyncWebServerResponse *response = request->beginChunkedResponse(contentType,[writer](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+    chunkWriter out(buffer,index,maxLen);
+    writer(out);
+    return out.length();
+  });
+  response->addHeader("Cache-Control","no-store");
+  request->send(response);
+}
+
+// Send a basic directory listing to the browser. This is best effort: the directory is read again for each chunk,
+// so a file added or deleted while a long listing is being sent can leave an entry repeated or missing.
 void handleFileList(AsyncWebServerRequest *request) {
   String path;
   if (!request->hasParam("dir")) path="/"; else path = request->getParam("dir")->value();
-  File root = LittleFS.open(path);
 
-  String output="<html><body style=\"font-family:Helvetica,Arial,sans-serif\"><h2>Departures Board File System</h2>";
-  if (!root) {
-    output+="<p>Failed to open directory</p>";
-  } else if (!root.isDirectory()) {
-    output+="<p>Not a directory</p>";
-  } else {
-    output+="<table>";
-    File file = root.openNextFile();
-    while (file) {
-      output+="<tr><td>";
-      if (file.isDirectory()) {
-        output+="[DIR]</td><td><a href=\"/rmdir?f=" + String(file.path()) + "\" title=\"Delete\">X</a></td><td><a href=\"/dir?dir=" + String(file.path()) + "\">" + String(file.name()) + "</a></td></tr>";
-      } else {
-        output+=String(file.size()) + "</td><td><a href=\"/del?f="+ String(file.path()) + "\" title=\"Delete\">X</a></td><td><a href=\"/cat?f=" + String(file.path()) + "\">" + String(file.name()) + "</a></td></tr>";
+  sendChunked(request,contentTypeHtml,[path](chunkWriter &out) {
+    out.print("<html><body style=\"font-family:Helvetica,Arial,sans-serif\"><h2>Departures Board File System</h2>");
+    File root = LittleFS.open(path);
+    if (!root) {
+      out.print("<p>Failed to open directory</p>");
+    } else if (!root.isDirectory()) {
+      out.print("<p>Not a directory</p>");
+    } else {
+      out.print("<table>");
+      File file = root.openNextFile();
+      while (file && !out.isFull()) {
+        if (file.isDirectory()) {
+          out.printf("<tr><td>[DIR]</td><td><a href=\"/rmdir?f=%s\" title=\"Delete\">X</a></td><td><a href=\"/dir?dir=%s\">%s</a></td></tr>",file.path(),file.path(),file.name());
+        } else {
+          out.printf("<tr><td>%u</td><td><a href=\"/del?f=%s\" title=\"Delete\">X</a></td><td><a href=\"/cat?f=%s\">%s</a></td></tr>",file.size(),file.path(),file.path(),file.name());
+        }
+        file = root.openNextFile();
       }
-      file = root.openNextFile();
     }
-  }
-
-  output += "</table><br>";
-  output += getFSInfo() + "<p><a href=\"/upload\">Upload</a> a file</p></body></html>";
-  request->send(200,contentTypeHtml,output);
+    if (out.isFull()) return;
+    out.print("</table><br>");
+    out.print(getFSInfo());
+    out.print("<p><a href=\"/upload\">Upload</a> a file</p></body></html>");
+  });
 }
 
 // Stream a file to the browser
@@ -2176,21 +2521,13 @@ void handleFormatFFS(AsyncWebServerRequest *request) {
 
 // Fallback function for browser requests
 void handleNotFound(AsyncWebServerRequest *request) {
-  if ((LittleFS.exists(request->url())) && (request->method() == HTTP_GET)) handleStreamFile(request->url(),request);
-  else if (request->url() == "/keys.htm") handleStreamGzipFlashFile(request->url(), keyshtm, sizeof(keyshtm),request);
-  else if (request->url() == "/index.htm") handleStreamGzipFlashFile(request->url(), indexhtm, sizeof(indexhtm),request);
-  else if (request->url() == "/editrss.htm") handleStreamGzipFlashFile(request->url(), editrsshtm, sizeof(editrsshtm),request);
-  else if (request->url() == "/nrelogo.webp") handleStreamFlashFile(request->url(), nrelogo, sizeof(nrelogo),request);
-  else if (request->url() == "/rdglogo.webp") handleStreamFlashFile(request->url(), rdglogo, sizeof(nrelogo),request);
-  else if (request->url() == "/tfllogo.webp") handleStreamFlashFile(request->url(), tfllogo, sizeof(tfllogo),request);
-  else if (request->url() == "/btlogo.webp") handleStreamFlashFile(request->url(), btlogo, sizeof(btlogo),request);
-  else if (request->url() == "/tube.webp") handleStreamFlashFile(request->url(), tubeicon, sizeof(tubeicon),request);
-  else if (request->url() == "/nr.webp") handleStreamFlashFile(request->url(), nricon, sizeof(nricon),request);
-  else if (request->url() == "/ibus.webp") handleStreamFlashFile(request->url(), ibus, sizeof(ibus),request);
-  else if (request->url() == "/irail.webp") handleStreamFlashFile(request->url(), irail, sizeof(irail),request);
-  else if (request->url() == "/itube.webp") handleStreamFlashFile(request->url(), itube, sizeof(itube),request);
-  else if (request->url() == "/favicon.png") handleStreamFlashFile(request->url(), faviconpng, sizeof(faviconpng),request);
-  else if (request->url() == "/rss.json") handleStreamGzipFlashFile(request->url(), rssjson, sizeof(rssjson),request);
+  // A file saved to LittleFS (e.g. an uploaded rss.json) takes priority over the built-in copy
+  if ((request->method() == HTTP_GET) && (LittleFS.exists(request->url()))) {
+    handleStreamFile(request->url(),request);
+    return;
+  }
+  const webRoute *route = findWebRoute(request->url().c_str());
+  if (route) handleStreamRoute(route,request);
   else sendResponse(404,"Not Found",request);
 }
 
@@ -2229,68 +2566,197 @@ String getResultCodeText(int resultCode) {
   }
 }
 
-// Send some useful system & station information to the browser
-void handleInfo(AsyncWebServerRequest *request) {
-  unsigned long uptime = millis();
-  char sysUptime[30];
-  int days = uptime / msDay ;
-  int hours = (uptime % msDay) / msHour;
-  int minutes = ((uptime % msDay) % msHour) / msMin;
-
-  sprintf(sysUptime,"%d days, %d hrs, %d min", days,hours,minutes);
-
-  String message = "Free Heap: " + String(ESP.getFreeHeap()) + "\nMin Heap: " + String(ESP.getMinFreeHeap()) + "\nLargest free block: " + String(heap_caps_get_largest_free_block(MALLOC_CAP_8BIT)) + "\nHostname: " + String(hostname) + "\nFirmware version: v" + String(VERSION_MAJOR) + "." + String(VERSION_MINOR) + " " + getBuildTime() + "\nSystem uptime: " + String(sysUptime) + "\nFree LittleFS space: " + String(LittleFS.totalBytes() - LittleFS.usedBytes());
-  message+="\nCore Plaform: " + String(ESP.getCoreVersion()) + "\nCPU speed: " + String(ESP.getCpuFreqMHz()) + "MHz\nCPU Temperature: " + String(temperatureRead()) + "\nWiFi network: " + String(WiFi.SSID()) + "\nWiFi signal strength: " + String(WiFi.RSSI()) + "dB";
-
-  sprintf(sysUptime,"%02d:%02d:%02d %02d/%02d/%04d",timeinfo.tm_hour,timeinfo.tm_min,timeinfo.tm_sec,timeinfo.tm_mday,timeinfo.tm_mon+1,timeinfo.tm_year+1900);
-  message+="\nSystem clock: " + String(sysUptime);
-  if (ghUpdate.releaseId.length()) {
-    message+="\nGithub: " + ghUpdate.releaseId;
-  }
+// Everything on the info page that can change while it's being sent
+struct systemInfo {
+  unsigned long now;
+  char hostname[33];
+  char buildTime[11];
+  char ssid[33];
+  char releaseId[32];
+  char locationCode[13];
+  char locationName[MAXLOCATIONSIZE];
+  const char *client;             // Rail data client name, empty for other modes
+  uint32_t freeHeap;
+  uint32_t minFreeHeap;
+  uint32_t largestBlock;
+  uint32_t fsFree;
+  float temperature;
+  int rssi;
+  struct tm clock;
+  bool schedulerActive;
+  bool carouselActive;
+  int nextSlotEventTime;
+  int dataLoadSuccess;
+  int dataLoadFailure;
+  unsigned long lastDataLoadTime;
+  unsigned long lastLoadFailure;
+  char lastResultMessage[MAXRESULTMESSAGESIZE];
+  char lastUpdateResult[32];
+  int numServices;
+  int numMessages;
+  uint16_t boardTextUsed;
+  uint32_t frames;
+  uint32_t overruns;
+  uint32_t worstFrameTime;
+  uint32_t averageJitter;
+  uint32_t worstJitter;
+  bool rssEnabled;
+  char lastRssUpdateResult[32];
+  int32_t nextRssUpdate;          // ms from now
+  bool weatherEnabled;
+  char lastWeatherUpdateResult[32];
+  int32_t nextWeatherUpdate;
+};
 
-  if (schedulerActive) message+="\nScheduler active, next event at " + String(nextSlotEventTime);
-  else if (carouselActive) message+="\nCarousel active, next event at " + String(nextSlotEventTime);
+// Send some useful system & station information to the browser. The page is written again for each chunk, so
+// everything on it is copied here first and every pass writes exactly the same text.
+void handleInfo(AsyncWebServerRequest *request) {
+  systemInfo info;
+  info.now = millis();
+  strlcpy(info.hostname,hostname,sizeof(info.hostname));
+  strlcpy(info.buildTime,getBuildTime().c_str(),sizeof(info.buildTime));
+  strlcpy(info.ssid,WiFi.SSID().c_str(),sizeof(info.ssid));
+  strlcpy(info.releaseId,ghUpdate.releaseId.c_str(),sizeof(info.releaseId));
+  strlcpy(info.locationCode,locationCode,sizeof(info.locationCode));
+  strlcpy(info.locationName,locationName,sizeof(info.locationName));
+  info.client = (boardMode != MODE_RAIL) ? "" : useRDMclient ? "RDMClient: " : "darwinClient: ";
+  info.freeHeap = ESP.getFreeHeap();
+  info.minFreeHeap = ESP.getMinFreeHeap();
+  info.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  info.fsFree = LittleFS.totalBytes() - LittleFS.usedBytes();
+  info.temperature = temperatureRead();
+  info.rssi = WiFi.RSSI();
+  info.clock = timeinfo;
+  info.schedulerActive = schedulerActive;
+  info.carouselActive = carouselActive;
+  info.nextSlotEventTime = nextSlotEventTime;
+  info.dataLoadSuccess = dataLoadSuccess;
+  info.dataLoadFailure = dataLoadFailure;
+  info.lastDataLoadTime = lastDataLoadTime;
+  info.lastLoadFailure = lastLoadFailure;
+  strlcpy(info.lastResultMessage,jsonKeyBuffer.lastResultMessage,sizeof(info.lastResultMessage));
+  strlcpy(info.lastUpdateResult,getResultCodeText(lastUpdateResult).c_str(),sizeof(info.lastUpdateResult));
+  info.numServices = station.numServices;
+  info.numMessages = messages.numMessages;
+  if (boardMode == MODE_TUBE) info.numMessages--;
+  info.boardTextUsed = station.text.bytesUsed();
+  info.frames = frameClock.frameCount();
+  info.overruns = frameClock.overrunCount();
+  info.worstFrameTime = frameClock.worstFrameTime();
+  info.averageJitter = frameClock.averageJitter();
+  info.worstJitter = frameClock.worstJitter();
+  info.rssEnabled = rssEnabled;
+  strlcpy(info.lastRssUpdateResult,getResultCodeText(lastRssUpdateResult).c_str(),sizeof(info.lastRssUpdateResult));
+  info.nextRssUpdate = timers.remaining(TIMER_RSS);
+  info.weatherEnabled = weatherEnabled;
+  strlcpy(info.lastWeatherUpdateResult,getResultCodeText(lastWeatherUpdateResult).c_str(),sizeof(info.lastWeatherUpdateResult));
+  info.nextWeatherUpdate = timers.remaining(TIMER_WEATHER);
+
+  sendChunked(request,contentTypeText,[info](chunkWriter &out) {
+    int days = info.now / msDay;
+    int hours = (info.now % msDay) / msHour;
+    int minutes = ((info.now % msDay) % msHour) / msMin;
+    out.printf("Free Heap: %u\nMin Heap: %u\nLargest free block: %u\nHostname: %s\nFirmware version: v%d.%d %s\nSystem uptime: %d days, %d hrs, %d min\nFree LittleFS space: %u",
+      info.freeHeap,info.minFreeHeap,info.largestBlock,info.hostname,VERSION_MAJOR,VERSION_MINOR,info.buildTime,days,hours,minutes,info.fsFree);
+    out.printf("\nCore Plaform: %s\nCPU speed: %uMHz\nCPU Temperature: %.2f\nWiFi network: %s\nWiFi signal strength: %ddB",ESP.getCoreVersion(),ESP.getCpuFreqMHz(),info.temperature,info.ssid,info.rssi);
+    out.printf("\nSystem clock: %02d:%02d:%02d %02d/%02d/%04d",info.clock.tm_hour,info.clock.tm_min,info.clock.tm_sec,info.clock.tm_mday,info.clock.tm_mon+1,info.clock.tm_year+1900);
+    if (info.releaseId[0]) out.printf("\nGithub: %s",info.releaseId);
+
+    if (info.schedulerActive) out.printf("\nScheduler active, next event at %d",info.nextSlotEventTime);
+    else if (info.carouselActive) out.printf("\nCarousel active, next event at %d",info.nextSlotEventTime);
+
+    out.printf("\nCurrent location code: %s\nCurrent location name: %s\nSuccessful: %d\nFailures: %d\nTime since last data load: %d seconds",info.locationCode,info.locationName,info.dataLoadSuccess,info.dataLoadFailure,(int)((info.now-info.lastDataLoadTime)/1000));
+    if (info.dataLoadFailure) out.printf("\nTime since last failure: %d seconds",(int)((info.now-info.lastLoadFailure)/1000));
+    out.print("\nLast Result: ");
+    out.print(info.client);
+    out.print(info.lastResultMessage);
+    out.printf("\nUpdate result code: %s",info.lastUpdateResult);
+    out.printf("\nServices: %d\nMessages: %d\nBoard text: %u/%u bytes\n",info.numServices,info.numMessages,info.boardTextUsed,station.text.capacity());
+    out.printf("Frames: %u (%u overruns)\nWorst frame time: %uus\nFrame jitter: %uus average, %uus worst\n",info.frames,info.overruns,info.worstFrameTime,info.averageJitter,info.worstJitter);
+
+    if (info.rssEnabled) {
+      out.printf("Last RSS result: %s\nNext RSS update: %ldms\n\n",info.lastRssUpdateResult,(long)info.nextRssUpdate);
+    }
 
-  message+="\nCurrent location code: " + String(locationCode) + "\nCurrent location name: " + String(locationName) + "\nSuccessful: " + String(dataLoadSuccess) + "\nFailures: " + String(dataLoadFailure) + "\nTime since last data load: " + String((int)((millis()-lastDataLoadTime)/1000)) + " seconds";
-  if (dataLoadFailure) message+="\nTime since last failure: " + String((int)((millis()-lastLoadFailure)/1000)) + " seconds";
-  message+="\nLast Result: ";
-  switch (boardMode) {
-    case MODE_RAIL:
-      if (useRDMclient) message+="RDMClient: " + String(jsonKeyBuffer.lastResultMessage);
-      else message+="darwinClient: " + String(jsonKeyBuffer.lastResultMessage);
-      break;
+    if (info.weatherEnabled) {
+      out.printf("Last weather result: %s\nNext weather update: %ldms",info.lastWeatherUpdateResult,(long)info.nextWeatherUpdate);
+    }
+  });
+}
 
-    case MODE_TUBE:
-      message+=String(jsonKeyBuffer.lastResultMessage);
-      break;
+// The board as JSON for scripts: the same fields as the /events feed, plus the weather and the age of the data
+// in seconds. It's written straight from the displayed board a chunk at a time, starting from whichever board is
+// current when the first chunk is sent. If the board is replaced part way through the response is cut short (and
+// won't parse), so the request should be made again.
+void handleBoardApi(AsyncWebServerRequest *request) {
+  unsigned long now = millis();
+  sendChunked(request,contentTypeJson,[version = (uint32_t)0,now](chunkWriter &out) mutable {
+    xSemaphoreTake(boardLock,portMAX_DELAY);
+    if (out.isFirstChunk()) version = boardVersion;
+    if (boardVersion == version) {
+      out.printf("{\"version\":%u,\"mode\":\"%s\",\"locationCode\":",version,boardMode == MODE_RAIL ? "rail" : boardMode == MODE_TUBE ? "tube" : "bus");
+      writeJsonText(out,locationCode);
+      writeBoardFields(out,&station,(boardMode == MODE_BUS) ? nullptr : &messages);
+      if (weatherEnabled) {
+        out.print(",\"weather\":");
+        writeJsonText(out,weatherMsg);
+      }
+      if (noDataLoaded) out.print(",\"age\":null");
+      else out.printf(",\"age\":%lu",(now-lastDataLoadTime)/1000);
+      out.printf(",\"snapshot\":%s}",showingSnapshot ? "true" : "false");
+    }
+    xSemaphoreGive(boardLock);
+  });
+}
 
-    case MODE_BUS:
-      message+=String(jsonKeyBuffer.lastResultMessage);
-      break;
-  }
-  message+="\nUpdate result code: ";
-  message+=getResultCodeText(lastUpdateResult);
-  message+="\nServices: " + String(station.numServices) + "\nMessages: ";
-  int nMsgs = messages.numMessages;
-  if (boardMode == MODE_TUBE) nMsgs--;
-  message+=String(nMsgs) + "\n";
+// Counters, fetch latency histograms and system gauges for monitoring. JSON by default, or Prometheus text
+// format with ?format=prometheus (or when the client asks for text/plain).
+void handleMetrics(AsyncWebServerRequest *request) {
+  systemGauges gauges;
+  gauges.uptime = millis()/1000;
+  gauges.freeHeap = ESP.getFreeHeap();
+  gauges.minFreeHeap = ESP.getMinFreeHeap();
+  gauges.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  gauges.fetchStack = fetchTaskHandle ? uxTaskGetStackHighWaterMark(fetchTaskHandle) : 0;
+  gauges.loopStack = loopTaskHandle ? uxTaskGetStackHighWaterMark(loopTaskHandle) : 0;
+  gauges.frames = frameClock.frameCount();
+  gauges.overruns = frameClock.overrunCount();
+  gauges.worstFrameTime = frameClock.worstFrameTime();
+  gauges.averageJitter = frameClock.averageJitter();
+  gauges.worstJitter = frameClock.worstJitter();
+
+  bool prometheus = request->hasParam("format") ? request->getParam("format")->value() == "prometheus" : (request->hasHeader("Accept") && request->header("Accept").indexOf("text/plain") >= 0);
+  AsyncResponseStream *response = request->beginResponseStream(prometheus ? "text/plain; version=0.0.4" : contentTypeJson);
+  response->addHeader("Cache-Control", "no-store");
+  if (prometheus) fetchStats.writePrometheus(*response,gauges); else fetchStats.writeJson(*response,gauges);
+  request->send(response);
+}
 
-  if (rssEnabled) {
-    message+="Last RSS result: " + getResultCodeText(lastRssUpdateResult) + "\nNext RSS update: " + String(nextRssUpdate-millis()) + "ms\n\n";
-  }
+// The most recent fetch and render spans as Chrome trace JSON. Save the response and open it in ui.perfetto.dev
+// (or chrome://tracing) to see how the two cores interleaved.
+void handleTrace(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response = request->beginResponseStream(contentTypeJson);
+  response->addHeader("Cache-Control", "no-store");
+  response->addHeader("Content-Disposition", "attachment; filename=\"trace.json\"");
+  writeTraceJson(*response);
+  request->send(response);
+}
 
-  if (weatherEnabled) {
-    message+="Last weather result: " + getResultCodeText(lastWeatherUpdateResult) + "\nNext weather update: " + String(nextWeatherUpdate-millis()) + "ms";
-  }
-  sendResponse(200,message,request);
+// Heap size, largest free block and fragmentation over time, with the allocation profile in HEAPPROFILE builds.
+// scripts/heap_report.py polls this during a soak test.
+void handleHeap(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response = request->beginResponseStream(contentTypeJson);
+  response->addHeader("Cache-Control", "no-store");
+  heapProfile.writeJson(*response);
+  request->send(response);
 }
 
 // Stream the index.htm page unless we're in first time setup and need the api keys
 void handleRoot(AsyncWebServerRequest *request) {
   if (!apiKeys) {
-    if (LittleFS.exists("/keys.htm")) handleStreamFile("/keys.htm",request); else handleStreamGzipFlashFile("/keys.htm",keyshtm,sizeof(keyshtm),request);
+    if (LittleFS.exists("/keys.htm")) handleStreamFile("/keys.htm",request); else handleStreamRoute(findWebRoute("/keys.htm"),request);
   } else {
-    if (LittleFS.exists("/index_d.htm")) handleStreamFile("/index_d.htm",request); else handleStreamGzipFlashFile("/index.htm",indexhtm,sizeof(indexhtm),request);
+    if (LittleFS.exists("/index_d.htm")) handleStreamFile("/index_d.htm",request); else handleStreamRoute(findWebRoute("/index.htm"),request);
   }
 }
 
@@ -2344,7 +2810,9 @@ void doManualOtaCheck() {
   centreText("Getting latest firmware details from GitHub...",26);
   u8g2.sendBuffer();
 
-  if (ghUpdate.getLatestRelease()==UPD_SUCCESS) {
+  int result = ghUpdate.getLatestRelease();
+  fetchStats.countResult(UPSTREAM_GITHUB,result);
+  if (result==UPD_SUCCESS) {
     checkForFirmwareUpdate();
   } else {
     for (int i=15;i>=0;i--) {
@@ -2372,6 +2840,58 @@ void handleControl(AsyncWebServerRequest *request) {
   request->send(200, contentTypeJson, resp);
 }
 
+// Stream a JSON request body into a temporary file as it arrives, replacing path once it's complete and valid.
+// The upload is kept in the request's _tempObject until finishJsonBody() is called.
+void receiveJsonBody(AsyncWebServerRequest *request, const char *path, uint8_t *data, size_t len, size_t index) {
+  if (!index) {
+    jsonUpload *upload = new jsonUpload();
+    upload->begin(path);    // If the file can't be created the upload reports it when finished
+    request->_tempObject = upload;
+    // Remove the temporary file if the connection drops part way through
+    request->onDisconnect([request]() {
+      if (request->_tempObject) {
+        delete (jsonUpload *)request->_tempObject;
+        request->_tempObject = nullptr;
+      }
+    });
+  }
+  if (request->_tempObject) ((jsonUpload *)request->_tempObject)->write(data,len);
+}
+
+// Commit a JSON body received by receiveJsonBody(). Returns UPD_NO_RESPONSE if there wasn't a body.
+int finishJsonBody(AsyncWebServerRequest *request) {
+  jsonUpload *upload = (jsonUpload *)request->_tempObject;
+  if (!upload) return UPD_NO_RESPONSE;
+  int result = upload->finish();
+  delete upload;
+  request->_tempObject = nullptr;
+  return result;
+}
+
+// Live view WebSocket events. New viewers need the whole frame and can ask for a frame rate with "rate:N".
+void handleMirrorEvent(AsyncWebSocket *socket, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
+  if (type == WS_EVT_CONNECT) {
+    mirror.requestKeyFrame();
+  } else if (type == WS_EVT_DATA) {
+    AwsFrameInfo *info = (AwsFrameInfo *)arg;
+    if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT && len > 5 && len < 10 && !strncmp((const char *)data,"rate:",5)) {
+      char value[5];
+      memcpy(value,data+5,len-5);
+      value[len-5] = '\0';
+      mirror.setRate(atoi(value));
+    }
+  }
+}
+
+// Send any changes to the display to the live view
+void updateMirror() {
+  if (!mirrorSocket.count() || !mirror.isDue()) return;
+  mirrorSocket.cleanupClients(MIRRORMAXCLIENTS);
+  if (!mirrorSocket.availableForWriteAll()) return;   // A viewer is still catching up
+  size_t len = mirror.encode(u8g2.getBufferPtr(),mirrorSocket.count());
+  if (len) mirrorSocket.binaryAll(mirror.data(),len);
+}
+
 /*
  * External data functions - weather, stationpicker, firmware updates
  */
@@ -2456,40 +2976,31 @@ void handleStationPicker(AsyncWebServerRequest *request)
 //
 void departureBoardLoop() {
 
-  if (millis() > nextDataUpdate && !fetchInProgress && lastUpdateResult != UPD_UNAUTHORISED && !isSleeping && wifiConnected) {
-    if (!firstLoad) showUpdateIcon(true);
-    // Initiate a background update on Core 0
-    fetchMode = FETCH_BOARD;
-    fetchInProgress = true;
-    xTaskNotifyGive(fetchTaskHandle);
-    if (firstLoad) {
-      waitForFirstLoad();
-      if (lastUpdateResult == UPD_NO_CHANGE || lastUpdateResult == UPD_SEC_CHANGE) lastUpdateResult = UPD_SUCCESS;
-    }
-  }
-
   if (fetchComplete && updateIconVisible) showUpdateIcon(false);
+  // The saved board is replaced in full by the first live data
+  if (fetchComplete && showingSnapshot && (lastUpdateResult == UPD_NO_CHANGE || lastUpdateResult == UPD_SEC_CHANGE)) lastUpdateResult = UPD_SUCCESS;
 
   if (fetchComplete && lastUpdateResult == UPD_SEC_CHANGE && !isScrollingService && !isSleeping) {
     fetchComplete = false;
     updateRailDepartures();
+    // Only the rows that have changed need repainting
     if (station.numServices) {
-      if (!station.service[0].via[0]) isShowingVia=false;
-      drawPrimaryService(isShowingVia);
-      u8g2.updateDisplayArea(0,1,32,3);
-      if (station.calling[0] && showFullCalling) {
-        for (int i=0;i<numMessages;i++) {
-          if (strncmp("Calling",line2[i],7)==0) {
-            // refresh the calling at times
-            sprintf(line2[i],"Calling at: %s",station.calling);
-            break;
-          }
-        }
+      if (!station.service[0].via.length) isShowingVia=false;
+      if (station.changes.service[0]) {
+        drawPrimaryService(isShowingVia);
+      }
+      // refresh the calling at times
+      if (station.changes.callingChanged && station.numCalling && callingMessage>=0 && showFullCalling) {
+        formatCallingLine();
+        if (currentMessage==callingMessage) messageStrip.clear();
       }
     }
-    if (noScrolling && station.numServices>1) {
+    if (noScrolling && station.numServices>1 && station.changes.service[1]) {
       drawServiceLine(1,LINE2);
     }
+    if (line3Service>0 && line3Service<station.numServices && station.changes.service[line3Service]) {
+      drawServiceLine(line3Service,LINE3);
+    }
   }
 
   if (fetchComplete && lastUpdateResult != UPD_SEC_CHANGE && !isScrollingService && !isSleeping) {
@@ -2507,7 +3018,7 @@ void departureBoardLoop() {
       } else if (lastUpdateResult == UPD_DATA_ERROR || lastUpdateResult == UPD_TIMEOUT || lastUpdateResult == UPD_HTTP_ERROR) {
         lastLoadFailure=millis();
         dataLoadFailure++;
-        if (noDataLoaded) showNoDataScreen();
+        if (noDataLoaded && !showingSnapshot) showNoDataScreen();
       } else if (lastUpdateResult == UPD_UNAUTHORISED) {
         showTokenErrorScreen();
         while (true) { delay(1);}
@@ -2517,7 +3028,7 @@ void departureBoardLoop() {
     }
   }
 
-  if (millis()>timer && numMessages && !isScrollingStops && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR && !noScrolling && !noDataLoaded) {
+  if (timeReached(timer) && numMessages && !isScrollingStops && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR && !noScrolling && !noDataLoaded) {
     // Need to start a new scrolling line 2
     prevMessage = currentMessage;
     prevScrollStopsLength = scrollStopsLength;
@@ -2525,22 +3036,23 @@ void departureBoardLoop() {
     if (currentMessage>=numMessages) currentMessage=0;
     scrollStopsXpos=0;
     scrollStopsYpos=10;
-    scrollStopsLength = getStringWidth(line2[currentMessage]);
+    stopsYmotion.start(10,0,scrollSpeedRail);
+    scrollStopsLength = getStringWidth(line2Text(currentMessage));
+    messageStrip.clear();
     isScrollingStops=true;
-    if (strncmp("Calling",line2[currentMessage],7)==0) isShowingCalling=true; else isShowingCalling=false;
+    isShowingCalling = (currentMessage==callingMessage);
   }
 
   // Check if there's a via destination
-  if (millis()>viaTimer) {
-    if (station.numServices && station.service[0].via[0] && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
+  if (timeReached(viaTimer)) {
+    if (station.numServices && station.service[0].via.length && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
       isShowingVia = !isShowingVia;
       drawPrimaryService(isShowingVia);
-      u8g2.updateDisplayArea(0,1,32,3);
       if (isShowingVia) viaTimer = millis()+3000; else viaTimer = millis()+4000;
     }
   }
 
-  if (millis()>serviceTimer && !isScrollingService && !isSleeping && !noDataLoaded && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
+  if (timeReached(serviceTimer) && !isScrollingService && !isSleeping && !noDataLoaded && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
     // Need to change to the next service if there is one
     if ((station.numServices <= 1 || (station.numServices==2 && noScrolling)) && !weatherMsg[0]) {
       // There's no other services and no weather so just so static attribution.
@@ -2556,32 +3068,41 @@ void departureBoardLoop() {
         if (weatherMsg[0] && line3Service>1) line3Service=0;
       }
       scrollServiceYpos=10;
+      serviceYmotion.start(10,0,scrollSpeedRail);
       isScrollingService = true;
     }
   }
 
-  if (isScrollingStops && millis()>timer && !isSleeping && !noScrolling) {
+  if (isScrollingStops && timeReached(timer) && !isSleeping && !noScrolling) {
     blankArea(0,LINE2,256,9);
     if (scrollStopsYpos) {
       // we're scrolling up the message initially
       u8g2.setClipWindow(0,LINE2,256,LINE2+9);
       // if the previous message didn't scroll then we need to scroll it up off the screen
-      if (prevScrollStopsLength && prevScrollStopsLength<256 && strncmp("Calling",line2[prevMessage],7)) centreText(line2[prevMessage],scrollStopsYpos+LINE2-12);
-      if (scrollStopsLength<256 && strncmp("Calling",line2[currentMessage],7)) centreText(line2[currentMessage],scrollStopsYpos+LINE2-2); // Centre text if it fits
-      else u8g2.drawStr(0,scrollStopsYpos+LINE2-2,line2[currentMessage]);
+      if (prevScrollStopsLength && prevScrollStopsLength<256 && prevMessage!=callingMessage) centreText(line2Text(prevMessage),scrollStopsYpos+LINE2-12);
+      if (scrollStopsLength<256 && currentMessage!=callingMessage) centreText(line2Text(currentMessage),scrollStopsYpos+LINE2-2); // Centre text if it fits
+      else u8g2.drawStr(0,scrollStopsYpos+LINE2-2,line2Text(currentMessage));
       u8g2.setMaxClipWindow();
-      scrollStopsYpos--;
-      if (scrollStopsYpos==0) timer=millis()+1500;
+      scrollStopsYpos = stopsYmotion.position();
+      if (scrollStopsYpos==0) {
+        timer=millis()+1500;
+        stopsXmotion.start(0,-scrollStopsLength-1,scrollSpeedRail,timer);
+      }
     } else {
       // we're scrolling left
-      if (scrollStopsLength<256 && strncmp("Calling",line2[currentMessage],7)) centreText(line2[currentMessage],LINE2-1); // Centre text if it fits
-      else u8g2.drawStr(scrollStopsXpos,LINE2-1,line2[currentMessage]);
+      if (scrollStopsLength<256 && currentMessage!=callingMessage) centreText(line2Text(currentMessage),LINE2-1); // Centre text if it fits
+      else {
+        // Copy from the pre-rendered message if possible
+        if (messageStrip.needsRender()) messageStrip.render(&u8g2,line2Text(currentMessage),scrollStopsLength,-1);
+        if (messageStrip.isReady()) messageStrip.draw(&u8g2,-scrollStopsXpos,LINE2,9);
+        else u8g2.drawStr(scrollStopsXpos,LINE2-1,line2Text(currentMessage));
+      }
       if (scrollStopsLength < 256) {
         // we don't need to scroll this message, it fits so just set a longer timer
         timer=millis()+6000;
         isScrollingStops=false;
       } else {
-        scrollStopsXpos--;
+        scrollStopsXpos = stopsXmotion.position();
         if (scrollStopsXpos < -scrollStopsLength) {
           isScrollingStops=false;
           timer=millis()+500;  // pause before next message
@@ -2590,7 +3111,7 @@ void departureBoardLoop() {
     }
   }
 
-  if (isScrollingService && millis()>serviceTimer && !isSleeping) {
+  if (isScrollingService && timeReached(serviceTimer) && !isSleeping) {
     blankArea(0,LINE3,256,9);
     if (scrollServiceYpos) {
       // we're scrolling the service into view
@@ -2599,7 +3120,7 @@ void departureBoardLoop() {
       if (prevService>0) drawServiceLine(prevService,scrollServiceYpos+LINE3-12);
       drawServiceLine(line3Service,scrollServiceYpos+LINE3-1);
       u8g2.setMaxClipWindow();
-      scrollServiceYpos--;
+      scrollServiceYpos = serviceYmotion.position();
       if (scrollServiceYpos==0) {
         serviceTimer=millis()+5000;
         isScrollingService=false;
@@ -2609,14 +3130,13 @@ void departureBoardLoop() {
 
   if (!isSleeping) {
     // Check if the clock should be updated
-    if (!firstLoad) drawCurrentTime();
+    if (!firstLoad && !showingSnapshot) drawCurrentTime();
 
     // To ensure a consistent refresh rate (for smooth text scrolling), we update the screen every 25ms (around 40fps)
-    // so we need to wait any additional ms not used by processing so far before sending the frame to the display controller
-    delayMs = frameTimeRail - (millis()-refreshTimer);
-    if (delayMs>0) delay(delayMs);
-    u8g2.updateDisplayArea(0,3,32,4);
-    refreshTimer=millis();
+    // so wait for the next frame deadline before sending the frame to the display controller
+    frameClock.waitForFrame(frameTimeRail);
+    // Send only the tiles that have been drawn on since the last frame
+    u8g2.flush();
   }
 }
 
@@ -2624,36 +3144,33 @@ void departureBoardLoop() {
 // Processing loop for London Underground Arrivals board
 //
 void undergroundArrivalsLoop() {
-  bool fullRefresh = false;
+  if (fetchComplete && updateIconVisible) showUpdateIcon(false);
+  // The saved board is replaced in full by the first live data
+  if (fetchComplete && showingSnapshot && (lastUpdateResult == UPD_NO_CHANGE || lastUpdateResult == UPD_SEC_CHANGE)) lastUpdateResult = UPD_SUCCESS;
 
-  if (millis()>nextDataUpdate && !fetchInProgress && !isSleeping && wifiConnected) {
-    if (!firstLoad) showUpdateIcon(true);
-    // Initiate a background update on Core 0
-    fetchMode = FETCH_BOARD;
-    fetchInProgress = true;
-    xTaskNotifyGive(fetchTaskHandle);
-    if (firstLoad) waitForFirstLoad();
-    if (lastUpdateResult == UPD_NO_CHANGE) lastUpdateResult = UPD_SUCCESS;
+  if (fetchComplete && lastUpdateResult == UPD_NO_CHANGE) {
+    fetchComplete = false;
+    lastDataLoadTime = millis();
+    noDataLoaded = false;
+    dataLoadSuccess++;
   }
 
-  if (fetchComplete && updateIconVisible) showUpdateIcon(false);
-
-  if (fetchComplete && lastUpdateResult == UPD_NO_CHANGE && !isScrollingPrimary && !isSleeping) {
+  if (fetchComplete && lastUpdateResult == UPD_SEC_CHANGE && !isScrollingPrimary && !isSleeping) {
     fetchComplete = false;
     updateArrivals();
-    // Draw the primary service line(s)
+    // Redraw the primary service line(s) that have changed
     if (station.numServices) {
-      drawUndergroundService(0,ULINE1,(showTubeCurrentLocation && isShowingVia && station.origin[0]));
-      if (station.numServices>1) drawUndergroundService(1,ULINE2);
+      bool showingLocation = (showTubeCurrentLocation && isShowingVia && station.origin.length);
+      if (station.changes.service[0] || (showingLocation && station.changes.detailsChanged)) drawUndergroundService(0,ULINE1,showingLocation);
+      if (station.numServices>1 && station.changes.service[1]) drawUndergroundService(1,ULINE2);
     } else {
       u8g2.setFont(Underground10);
       blankArea(0,ULINE1,256,ULINE3-ULINE1);
       centreText("There are no scheduled arrivals at this station.",ULINE1-1);
     }
-    fullRefresh = true;
   }
 
-  if (fetchComplete && lastUpdateResult != UPD_NO_CHANGE && (!isScrollingService || !showFullMsgs) && !isScrollingPrimary && !isSleeping) {
+  if (fetchComplete && lastUpdateResult != UPD_NO_CHANGE && lastUpdateResult != UPD_SEC_CHANGE && (!isScrollingService || !showFullMsgs) && !isScrollingPrimary && !isSleeping) {
     fetchComplete = false;
     isScrollingService = false;
     // Get the updated data
@@ -2663,7 +3180,7 @@ void undergroundArrivalsLoop() {
     } else if (lastUpdateResult == UPD_DATA_ERROR || lastUpdateResult == UPD_TIMEOUT || lastUpdateResult == UPD_HTTP_ERROR) {
       lastLoadFailure = millis();
       dataLoadFailure++;
-      if (noDataLoaded) showNoDataScreen(); else drawUndergroundBoard();
+      if (noDataLoaded && !showingSnapshot) showNoDataScreen(); else drawUndergroundBoard();
     } else if (lastUpdateResult == UPD_UNAUTHORISED) {
       showTokenErrorScreen();
       while (true) delay(10);
@@ -2673,17 +3190,16 @@ void undergroundArrivalsLoop() {
   }
 
   // Check if we're showing currentLocation
-  if (showTubeCurrentLocation && millis()>viaTimer) {
-    if (station.numServices && station.origin[0] && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
+  if (showTubeCurrentLocation && timeReached(viaTimer)) {
+    if (station.numServices && station.origin.length && !isSleeping && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
       isShowingVia = !isShowingVia;
       drawUndergroundService(0,ULINE1,isShowingVia);
-      u8g2.updateDisplayArea(0,1,32,3);
       if (isShowingVia) viaTimer = millis()+3000; else viaTimer = millis()+8000;
     }
   }
 
   // Scrolling the additional services
-  if (millis()>serviceTimer && !isScrollingService && !isSleeping && !noDataLoaded && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
+  if (timeReached(serviceTimer) && !isScrollingService && !isSleeping && !noDataLoaded && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
     if (station.numServices<=2 && numMessages==1 && attributionScrolled) {
       // There are no additional services to scroll in so static attribution.
       serviceTimer = millis() + 30000;
@@ -2693,6 +3209,7 @@ void undergroundArrivalsLoop() {
       prevService = line3Service;
       line3Service++;
       scrollServiceYpos=11;
+      serviceYmotion.start(11,0,scrollSpeedTube);
       scrollStopsXpos=0;
       isScrollingService = true;
       if (line3Service>=station.numServices) {
@@ -2710,13 +3227,14 @@ void undergroundArrivalsLoop() {
           }
         }
         scrollStopsLength = getStringWidth(line2[currentMessage]);
+        messageStrip.clear();
       } else {
         scrollStopsLength=SCREEN_WIDTH;
       }
     }
   }
 
-  if (isScrollingService && millis()>serviceTimer && !isSleeping) {
+  if (isScrollingService && timeReached(serviceTimer) && !isSleeping) {
     blankArea(0,ULINE3,256,10);
     if (scrollServiceYpos) {
       // we're scrolling up the message initially
@@ -2736,25 +3254,30 @@ void undergroundArrivalsLoop() {
         else u8g2.drawStr(0,scrollServiceYpos+ULINE3-2,line2[currentMessage]);
       }
       u8g2.setMaxClipWindow();
-      scrollServiceYpos--;
+      scrollServiceYpos = serviceYmotion.position();
       if (scrollServiceYpos==0) {
         if (line3Service<station.numServices) {
           serviceTimer=millis()+3500;
           isScrollingService=false;
         } else {
           serviceTimer=millis()+500;
+          stopsXmotion.start(0,-scrollStopsLength-1,scrollSpeedTube,serviceTimer);
         }
       }
     } else {
       // we're scrolling left
       if (scrollStopsLength<256) centreText(line2[currentMessage],ULINE3-1); // Centre text if it fits
-      else u8g2.drawStr(scrollStopsXpos,ULINE3-1,line2[currentMessage]);
+      else {
+        if (messageStrip.needsRender()) messageStrip.render(&u8g2,line2[currentMessage],scrollStopsLength,-1);
+        if (messageStrip.isReady()) messageStrip.draw(&u8g2,-scrollStopsXpos,ULINE3,10);
+        else u8g2.drawStr(scrollStopsXpos,ULINE3-1,line2[currentMessage]);
+      }
       if (scrollStopsLength < 256) {
         // we don't need to scroll this message, it fits so just set a longer timer
         serviceTimer=millis()+3000;
         isScrollingService=false;
       } else {
-        scrollStopsXpos--;
+        scrollStopsXpos = stopsXmotion.position();
         if (scrollStopsXpos < -scrollStopsLength) {
           isScrollingService=false;
           serviceTimer=millis()+500;  // pause before next message
@@ -2765,7 +3288,6 @@ void undergroundArrivalsLoop() {
 
   if (isScrollingPrimary && !isSleeping) {
     blankArea(0,ULINE1,256,ULINE3-ULINE1);
-    fullRefresh = true;
     // we're scrolling the primary service(s) into view
     u8g2.setClipWindow(0,ULINE1,256,ULINE1+10);
     if (station.numServices) drawUndergroundService(0,scrollPrimaryYpos+ULINE1-1);
@@ -2775,7 +3297,7 @@ void undergroundArrivalsLoop() {
       drawUndergroundService(1,scrollPrimaryYpos+ULINE2-1);
     }
     u8g2.setMaxClipWindow();
-    scrollPrimaryYpos--;
+    scrollPrimaryYpos = primaryYmotion.position();
     if (scrollPrimaryYpos==0) {
       isScrollingPrimary=false;
     }
@@ -2783,12 +3305,10 @@ void undergroundArrivalsLoop() {
 
   if (!isSleeping) {
     // Check if the clock should be updated
-    drawCurrentTimeUG();
+    if (!showingSnapshot) drawCurrentTimeUG();
 
-    delayMs = frameTimeTube - (millis()-refreshTimer);
-    if (delayMs>0) delay(delayMs);
-    if (fullRefresh) u8g2.updateDisplayArea(0,1,32,6); else u8g2.updateDisplayArea(0,5,32,2);
-    refreshTimer=millis();
+    frameClock.waitForFrame(frameTimeTube);
+    u8g2.flush();
   }
 }
 
@@ -2796,36 +3316,33 @@ void undergroundArrivalsLoop() {
 // Processing loop for Bus Departures board
 //
 void busDeparturesLoop() {
-  bool fullRefresh = false;
-
-  if (millis()>nextDataUpdate && !fetchInProgress && !isSleeping && wifiConnected) {
-    if (!firstLoad) showUpdateIcon(true);
-    // Initiate a background update on Core 0
-    fetchMode = FETCH_BOARD;
-    fetchInProgress = true;
-    xTaskNotifyGive(fetchTaskHandle);
-    if (firstLoad) waitForFirstLoad();
-    if (lastUpdateResult == UPD_NO_CHANGE) lastUpdateResult = UPD_SUCCESS;
-  }
-
   if (fetchComplete && updateIconVisible) showUpdateIcon(false);
+  // The saved board is replaced in full by the first live data
+  if (fetchComplete && showingSnapshot && (lastUpdateResult == UPD_NO_CHANGE || lastUpdateResult == UPD_SEC_CHANGE)) lastUpdateResult = UPD_SUCCESS;
 
   if (fetchComplete && lastUpdateResult == UPD_NO_CHANGE) {
+    fetchComplete = false;
+    lastDataLoadTime = millis();
+    noDataLoaded = false;
+    dataLoadSuccess++;
+  }
+
+  if (fetchComplete && lastUpdateResult == UPD_SEC_CHANGE) {
     fetchComplete=false;
+    int prevBusDestX = busDestX;
     updateBusDepartures();
-    // Draw the primary service line(s)
+    // Redraw the primary service line(s) that have changed (or all of them if the service number column has moved)
     if (station.numServices) {
-      drawBusService(0,ULINE1,busDestX);
-      if (station.numServices>1) drawBusService(1,ULINE2,busDestX);
+      if (station.changes.service[0] || busDestX!=prevBusDestX) drawBusService(0,ULINE1);
+      if (station.numServices>1 && (station.changes.service[1] || busDestX!=prevBusDestX)) drawBusService(1,ULINE2);
     } else {
       u8g2.setFont(NatRailSmall9);
       blankArea(0,ULINE1,256,ULINE3-ULINE1);
       centreText("There are no scheduled services at this stop.",ULINE1-1);
     }
-    fullRefresh = true;
   }
 
-  if (fetchComplete && lastUpdateResult != UPD_NO_CHANGE && !isScrollingService && !isScrollingPrimary && !isSleeping) {
+  if (fetchComplete && lastUpdateResult != UPD_NO_CHANGE && lastUpdateResult != UPD_SEC_CHANGE && !isScrollingService && !isScrollingPrimary && !isSleeping) {
     fetchComplete = false;
     if (lastUpdateResult == UPD_SUCCESS) {
       updateBusDepartures();
@@ -2833,7 +3350,7 @@ void busDeparturesLoop() {
     } else if (lastUpdateResult == UPD_DATA_ERROR || lastUpdateResult == UPD_TIMEOUT || lastUpdateResult == UPD_HTTP_ERROR) {
       lastLoadFailure = millis();
       dataLoadFailure++;
-      if (noDataLoaded) showNoDataScreen(); else drawBusDeparturesBoard();
+      if (noDataLoaded && !showingSnapshot) showNoDataScreen(); else drawBusDeparturesBoard();
     } else if (lastUpdateResult == UPD_UNAUTHORISED) {
       showTokenErrorScreen();
       while (true) delay(10);
@@ -2843,7 +3360,7 @@ void busDeparturesLoop() {
   }
 
   // Scrolling the additional services
-  if (millis()>serviceTimer && !isScrollingPrimary && !isScrollingService && !isSleeping && !noDataLoaded && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
+  if (timeReached(serviceTimer) && !isScrollingPrimary && !isScrollingService && !isSleeping && !noDataLoaded && lastUpdateResult!=UPD_UNAUTHORISED && lastUpdateResult!=UPD_DATA_ERROR) {
     // Need to change to the next service if there is one
     if (station.numServices<=2 && messages.numMessages==1) {
       // There are no additional services or weather to scroll in so static attribution.
@@ -2854,6 +3371,7 @@ void busDeparturesLoop() {
       prevService = line3Service;
       line3Service++;
       scrollServiceYpos=11;
+      serviceYmotion.start(11,0,scrollSpeedBus);
       isScrollingService = true;
       if (line3Service>=station.numServices) {
         // Showing the messages
@@ -2872,26 +3390,26 @@ void busDeparturesLoop() {
     }
   }
 
-  if (isScrollingService && millis()>serviceTimer && !isSleeping) {
+  if (isScrollingService && timeReached(serviceTimer) && !isSleeping) {
     if (scrollServiceYpos) {
       blankArea(0,ULINE3,256,10);
       // we're scrolling up the message
       u8g2.setClipWindow(0,ULINE3,256,ULINE3+10);
       // Was the previous display a service?
       if (prevService<station.numServices) {
-        drawBusService(prevService,scrollServiceYpos+ULINE3-13,busDestX);
+        drawBusService(prevService,scrollServiceYpos+ULINE3-13);
       } else {
         // Scrolling up the previous message
         centreText(line2[prevMessage],scrollServiceYpos+ULINE3-13);
       }
       // Is this entry a service?
       if (line3Service<station.numServices) {
-        drawBusService(line3Service,scrollServiceYpos+ULINE3-1,busDestX);
+        drawBusService(line3Service,scrollServiceYpos+ULINE3-1);
       } else {
         centreText(line2[currentMessage],scrollServiceYpos+ULINE3-2);
       }
       u8g2.setMaxClipWindow();
-      scrollServiceYpos--;
+      scrollServiceYpos = serviceYmotion.position();
       if (scrollServiceYpos==0) {
         serviceTimer = millis()+2800;
         if (station.numServices<=2) serviceTimer+=3000;
@@ -2901,25 +3419,24 @@ void busDeparturesLoop() {
 
   if (isScrollingPrimary && !isSleeping) {
     blankArea(0,ULINE1,256,ULINE3-ULINE1+10);
-    fullRefresh = true;
     // we're scrolling the primary service(s) into view
     u8g2.setClipWindow(0,ULINE1,256,ULINE1+10);
-    if (station.numServices) drawBusService(0,scrollPrimaryYpos+ULINE1-1,busDestX);
+    if (station.numServices) drawBusService(0,scrollPrimaryYpos+ULINE1-1);
     else centreText("There are no scheduled services at this stop.",scrollPrimaryYpos+ULINE1-1);
     if (station.numServices>1) {
       u8g2.setClipWindow(0,ULINE2,256,ULINE2+10);
-      drawBusService(1,scrollPrimaryYpos+ULINE2-1,busDestX);
+      drawBusService(1,scrollPrimaryYpos+ULINE2-1);
     }
     if (station.numServices>2) {
       u8g2.setClipWindow(0,ULINE3,256,ULINE3+10);
-      drawBusService(2,scrollPrimaryYpos+ULINE3-1,busDestX);
+      drawBusService(2,scrollPrimaryYpos+ULINE3-1);
     } else if (station.numServices<3 && messages.numMessages==1) {
       // scroll up the attribution once...
       u8g2.setClipWindow(0,ULINE3,256,ULINE3+10);
       centreText(btAttribution,scrollPrimaryYpos+ULINE3-1);
     }
     u8g2.setMaxClipWindow();
-    scrollPrimaryYpos--;
+    scrollPrimaryYpos = primaryYmotion.position();
     if (scrollPrimaryYpos==0) {
       isScrollingPrimary=false;
       serviceTimer = millis()+2800;
@@ -2928,12 +3445,10 @@ void busDeparturesLoop() {
 
   if (!isSleeping) {
     // just use the Tube clock for bus mode
-    if (drawCurrentTimeUG()) u8g2.setFont(NatRailSmall9);
+    if (!showingSnapshot && drawCurrentTimeUG()) u8g2.setFont(NatRailSmall9);
 
-    delayMs = frameTimeBus - (millis()-refreshTimer);
-    if (delayMs>0) delay(delayMs);
-    if (fullRefresh) u8g2.updateDisplayArea(0,1,32,6); else u8g2.updateDisplayArea(0,5,32,2);
-    refreshTimer=millis();
+    frameClock.waitForFrame(frameTimeBus);
+    u8g2.flush();
   }
 }
 
@@ -2946,41 +3461,66 @@ void fetchDeparturesTask(void *pvParameters) {
     // Perform the requested data update...
     fetchInProgress = true;
     switch (fetchMode) {
-      case FETCH_BOARD:
+      case FETCH_BOARD: {
+        TRACE_SPAN("fetch board","fetch");
+        HEAP_REGION(fetchBoardHeap);
         switch (boardMode) {
           case MODE_RAIL:
             if (useRDMclient) {
               lastUpdateResult = rdmRailData.fetchDepartures(&station,&messages,locationCode,rdmDeparturesApiKey,rdmServiceApiKey,MAXBOARDSERVICES,enableBus,callingCrsCode,locationCleanFilter,nrTimeOffset,(showLastSeen && !noScrolling),showServiceMsgs);
+              fetchStats.countResult(UPSTREAM_RDM,lastUpdateResult);
             } else {
               lastUpdateResult = darwinRailData.fetchDepartures(&station,&messages,locationCode,nrToken,MAXBOARDSERVICES,enableBus,callingCrsCode,locationCleanFilter,nrTimeOffset,(showLastSeen && !noScrolling),showServiceMsgs);
+              fetchStats.countResult(UPSTREAM_DARWIN,lastUpdateResult);
             }
-            nextDataUpdate = millis()+apiRefreshRate;
+            timers.schedule(TIMER_DATA,apiRefreshRate);
             break;
           case MODE_TUBE:
             lastUpdateResult = tfldata.fetchArrivals(&station,&messages,locationCode,lineId,lineDirection,(noScrolling || !showServiceMsgs),tflAppKey);
-            nextDataUpdate = millis() + UGDATAUPDATEINTERVAL; // default update freq
+            fetchStats.countResult(UPSTREAM_TFL,lastUpdateResult);
+            timers.schedule(TIMER_DATA,UGDATAUPDATEINTERVAL); // default update freq
             break;
           case MODE_BUS:
             lastUpdateResult = busdata.fetchDepartures(&station,locationCode,locationCleanFilter);
-            nextDataUpdate = millis() + BUSDATAUPDATEINTERVAL;
+            fetchStats.countResult(UPSTREAM_BUS,lastUpdateResult);
+            timers.schedule(TIMER_DATA,BUSDATAUPDATEINTERVAL);
             break;
         }
         fetchComplete = true;
         break;
+      }
 
-      case FETCH_WEATHER:
+      case FETCH_WEATHER: {
+        TRACE_SPAN("fetch weather","fetch");
+        HEAP_REGION(fetchWeatherHeap);
         // Update the weather forecast
         lastWeatherUpdateResult = currentWeather.updateWeather(openWeatherMapApiKey, locationLat, locationLon);
-        nextWeatherUpdate = millis() + WEATHERUPDATEINTERVAL; // update every 20 mins
+        fetchStats.countResult(UPSTREAM_WEATHER,lastWeatherUpdateResult);
+        timers.schedule(TIMER_WEATHER,WEATHERUPDATEINTERVAL); // update every 20 mins
         weatherFetchComplete = true;
         break;
+      }
 
-      case FETCH_RSS:
+      case FETCH_RSS: {
+        TRACE_SPAN("fetch rss","fetch");
+        HEAP_REGION(fetchRssHeap);
         // Update the RSS headlines
         lastRssUpdateResult=rss.loadFeed(rssURL);
-        nextRssUpdate = millis() + RSSUPDATEINTERVAL;
+        fetchStats.countResult(UPSTREAM_RSS,lastRssUpdateResult);
+        timers.schedule(TIMER_RSS,RSSUPDATEINTERVAL);
         rssFetchComplete = true;
         break;
+      }
+
+      case FETCH_RELEASE: {
+        TRACE_SPAN("fetch release","fetch");
+        HEAP_REGION(fetchReleaseHeap);
+        // Get the latest release details for the daily firmware update check
+        lastReleaseResult = ghUpdate.getLatestRelease();
+        fetchStats.countResult(UPSTREAM_GITHUB,lastReleaseResult);
+        releaseFetchComplete = true;
+        break;
+      }
     }
 
     // Signal to Core 1 that the fetch is complete
@@ -2988,6 +3528,149 @@ void fetchDeparturesTask(void *pvParameters) {
   }
 }
 
+/*
+ * Loop timers - the periodic work in loop(), each called by its timer when it's due
+ */
+
+// Read the current time (and reboot every 45 days at 3am)
+void clockTimer() {
+  if (!getLocalTime(&timeinfo)) {
+    timers.schedule(TIMER_CLOCK,0);   // Try again on the next loop
+    return;
+  }
+  timers.schedule(TIMER_CLOCK,CLOCKUPDATEINTERVAL);
+  sprintf(currentTime,"%02d:%02d:%02d",timeinfo.tm_hour,timeinfo.tm_min,timeinfo.tm_sec);
+  if (millis()>3888000000 && timeinfo.tm_hour==3) {
+    // Reboot every 45 days at 3am
+    saveSnapshot(true);
+    ESP.restart();
+  }
+}
+
+// Check for firmware updates daily if enabled (the timer is started again when the setting is turned on)
+void firmwareTimer() {
+  if (!dailyUpdateCheck) return;
+  if (fetchInProgress) {
+    timers.schedule(TIMER_FIRMWARE,TIMERRETRYINTERVAL);
+    return;
+  }
+  timers.schedule(TIMER_FIRMWARE,3300000 + random(600000)); // check again in 55 to 65 mins
+  if (timeinfo.tm_mday != prevUpdateCheckDay) {
+    // Fetch the release details on Core 0 so the display keeps animating
+    fetchMode = FETCH_RELEASE;
+    fetchInProgress = true;
+    xTaskNotifyGive(fetchTaskHandle);
+    prevUpdateCheckDay = timeinfo.tm_mday;
+  }
+}
+
+// WiFi status icon, and force a reconnect if we've been disconnected for more than 10 secs
+void wifiTimer() {
+  timers.schedule(TIMER_WIFI,WIFICHECKINTERVAL);
+  bool connected = (WiFi.status() == WL_CONNECTED);
+  if (!connected && wifiConnected) {
+    wifiConnected=false;
+    u8g2.setFont(NatRailSmall9);
+    u8g2.drawStr(0,56,"\x7F");  // No Wifi Icon
+    u8g2.updateDisplayArea(0,7,1,1);
+  } else if (connected && !wifiConnected) {
+    wifiConnected=true;
+    blankArea(0,57,5,7);
+    u8g2.updateDisplayArea(0,7,1,1);
+    updateMyUrl();  // in case our IP changed
+  }
+
+  if (!connected && millis()-lastWiFiReconnect >= WIFIRECONNECTINTERVAL) {
+    WiFi.disconnect();
+    delay(100);
+    WiFi.reconnect();
+    lastWiFiReconnect=millis();
+  }
+}
+
+// Start a background update of the board on Core 0. The fetch schedules the next one when it's finished.
+void dataTimer() {
+  if (fetchInProgress || isSleeping || !wifiConnected || (boardMode == MODE_RAIL && lastUpdateResult == UPD_UNAUTHORISED)) {
+    timers.schedule(TIMER_DATA,TIMERRETRYINTERVAL);
+    return;
+  }
+  bool wasFirstLoad = firstLoad;
+  if (!firstLoad) showUpdateIcon(true);
+  fetchMode = FETCH_BOARD;
+  fetchInProgress = true;
+  xTaskNotifyGive(fetchTaskHandle);
+  if (firstLoad) waitForFirstLoad();
+  // The first load is always drawn in full. Later results are handled by the board loops once the fetch
+  // completes (a secondary change only redraws the rows that changed).
+  if (wasFirstLoad && (lastUpdateResult == UPD_NO_CHANGE || lastUpdateResult == UPD_SEC_CHANGE)) lastUpdateResult = UPD_SUCCESS;
+}
+
+// Start a weather update on Core 0
+void weatherTimer() {
+  if (!weatherEnabled || !locationLat || !locationLon) return;   // Rescheduled when the settings change
+  if (fetchInProgress || isSleeping || !wifiConnected) {
+    timers.schedule(TIMER_WEATHER,TIMERRETRYINTERVAL);
+    return;
+  }
+  fetchMode = FETCH_WEATHER;
+  fetchInProgress = true;
+  xTaskNotifyGive(fetchTaskHandle);
+}
+
+// Start an RSS update on Core 0
+void rssTimer() {
+  if (!rssEnabled || boardMode == MODE_BUS) return;   // Rescheduled when the settings or mode change
+  if (fetchInProgress || isSleeping || !wifiConnected) {
+    timers.schedule(TIMER_RSS,TIMERRETRYINTERVAL);
+    return;
+  }
+  fetchMode = FETCH_RSS;
+  fetchInProgress = true;
+  xTaskNotifyGive(fetchTaskHandle);
+}
+
+// Move on to the next scheduler or carousel slot when it's time
+void schedulerTimer() {
+  if (!schedulerActive && !(carouselActive && numCarouselSlots>1)) {
+    timers.schedule(TIMER_SCHEDULER,SCHEDULERCHECKINTERVAL);
+    return;
+  }
+  if (isSleeping || fetchInProgress) {
+    timers.schedule(TIMER_SCHEDULER,TIMERRETRYINTERVAL);
+    return;
+  }
+  timers.schedule(TIMER_SCHEDULER,SCHEDULERCHECKINTERVAL);
+  int nowTime = getTimeInMinutes();
+  if ((activeSlotEventTime < nextSlotEventTime && nowTime >= nextSlotEventTime) || (activeSlotEventTime > nextSlotEventTime && nowTime < activeSlotEventTime && nowTime >= nextSlotEventTime)) {
+    if (carouselActive) currentCarouselSlot = (currentCarouselSlot + 1) % numCarouselSlots;
+    softResetBoard(MODE_LOADCONFIG);
+  }
+}
+
+// If the "screensaver" is active, change the screen every 8 seconds
+void screensaverTimer() {
+  if (!isSleeping) return;
+  drawSleepingScreen();
+  timers.schedule(TIMER_SCREENSAVER,SCREENSAVERINTERVAL);
+}
+
+void startLoopTimers() {
+  timers.attach(TIMER_CLOCK,clockTimer);
+  timers.attach(TIMER_FIRMWARE,firmwareTimer);
+  timers.attach(TIMER_WIFI,wifiTimer);
+  timers.attach(TIMER_DATA,dataTimer);
+  timers.attach(TIMER_WEATHER,weatherTimer);
+  timers.attach(TIMER_RSS,rssTimer);
+  timers.attach(TIMER_SCHEDULER,schedulerTimer);
+  timers.attach(TIMER_SCREENSAVER,screensaverTimer);
+  // The weather and RSS timers have already been set by the first updates in setup()
+  timers.schedule(TIMER_CLOCK,0);
+  timers.schedule(TIMER_FIRMWARE,0);
+  timers.schedule(TIMER_WIFI,0);
+  timers.schedule(TIMER_DATA,0);
+  timers.schedule(TIMER_SCHEDULER,0);
+}
+
 //
 // Setup code
 //
@@ -2995,7 +3678,9 @@ void setup(void) {
   // These are the default wsdl XML SOAP entry points. They can be overridden in the config.json file if necessary
   strlcpy(wsdlHost,"lite.realtime.nationalrail.co.uk",sizeof(wsdlHost));
   strlcpy(wsdlAPI,"/OpenLDBWS/wsdl.aspx?ver=2021-11-01",sizeof(wsdlAPI));
+  boardLock = xSemaphoreCreateMutex();
   u8g2.begin();                       // Start the OLED panel
+  metrics.begin(&u8g2);
   u8g2.setContrast(brightness);       // Initial brightness
   u8g2.setDrawColor(1);               // Only a monochrome display, so set the colour to "on"
   u8g2.setFontMode(1);                // Transparent fonts
@@ -3014,15 +3699,18 @@ void setup(void) {
   loadConfig(true);                           // Load the configuration settings from config.json
   u8g2.setContrast(brightness);               // Set the panel brightness to the user saved level
   if (flipScreen) u8g2.setFlipMode(1);
-  u8g2.clearBuffer();
-  u8g2.drawXBM(81,0,gadeclogo_width,gadeclogo_height,gadeclogo_bits);
-  centreText(notice.c_str(),48);
-  u8g2.sendBuffer();
-  delay(5000);
+  if (!isFSMounted || !showBoardSnapshot()) {
+    // No saved board to show, so show the splash screen
+    u8g2.clearBuffer();
+    u8g2.drawXBM(81,0,gadeclogo_width,gadeclogo_height,gadeclogo_bits);
+    centreText(notice.c_str(),48);
+    u8g2.sendBuffer();
+    delay(5000);
 
-  u8g2.clearBuffer();
-  drawStartupHeading();
-  u8g2.sendBuffer();
+    u8g2.clearBuffer();
+    drawStartupHeading();
+    u8g2.sendBuffer();
+  }
   progressBar("Connecting to Wi-Fi",20);
   WiFi.mode(WIFI_MODE_NULL);        // Reset the WiFi
   WiFi.setSleep(WIFI_PS_NONE);      // Turn off WiFi Powersaving
@@ -3056,19 +3744,22 @@ void setup(void) {
 
   wifiConnected=true;
   WiFi.setAutoReconnect(true);
-  u8g2.clearBuffer();                                             // Clear the display
-  drawStartupHeading();                                           // Draw the startup heading
-  char ipBuff[17];
-  WiFi.localIP().toString().toCharArray(ipBuff,sizeof(ipBuff));   // Get the IP address of the ESP32
-  centreText(ipBuff,53);                                          // Display the IP address
-  progressBar("Wi-Fi Connected",30);
-  u8g2.sendBuffer();                                              // Send to OLED panel
+  if (!showingSnapshot) {
+    u8g2.clearBuffer();                                             // Clear the display
+    drawStartupHeading();                                           // Draw the startup heading
+    char ipBuff[17];
+    WiFi.localIP().toString().toCharArray(ipBuff,sizeof(ipBuff));   // Get the IP address of the ESP32
+    centreText(ipBuff,53);                                          // Display the IP address
+    progressBar("Wi-Fi Connected",30);
+    u8g2.sendBuffer();                                              // Send to OLED panel
+  }
 
   // Configure the local webserver paths
   server.on("/", HTTP_GET, [](AsyncWebServerRequest *request){handleRoot(request);});
   server.on("/erasewifi", HTTP_GET, [](AsyncWebServerRequest *request){handleEraseWiFi(request);});
   server.on("/factoryreset", HTTP_GET, [](AsyncWebServerRequest *request){handleFactoryReset(request);});
   server.on("/info", HTTP_GET, [](AsyncWebServerRequest *request){handleInfo(request);});
+  server.on("/api/board", HTTP_GET, [](AsyncWebServerRequest *request){handleBoardApi(request);});
   server.on("/formatffs", HTTP_GET, [](AsyncWebServerRequest *request){handleFormatFFS(request);});
   server.on("/dir", HTTP_GET, [](AsyncWebServerRequest *request){handleFileList(request);});
   server.onNotFound([](AsyncWebServerRequest *request){handleNotFound(request);});
@@ -3080,100 +3771,66 @@ void setup(void) {
   server.on("/brightness", HTTP_GET, [](AsyncWebServerRequest *request){handleBrightness(request);});
   server.on("/ota", HTTP_GET, [](AsyncWebServerRequest *request){handleOtaUpdate(request);});
   server.on("/control", HTTP_GET, [](AsyncWebServerRequest *request){handleControl(request);});
+  server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request){handleMetrics(request);});
+  server.on("/trace", HTTP_GET, [](AsyncWebServerRequest *request){handleTrace(request);});
+  server.on("/heap", HTTP_GET, [](AsyncWebServerRequest *request){handleHeap(request);});
   server.on("/success", HTTP_GET, [](AsyncWebServerRequest *request){request->send(200,contentTypeHtml,successPage);});
 
   //
   // Save settings returned by the Web GUI
   //
   server.on("/savesettings", HTTP_POST, [](AsyncWebServerRequest *request) {
-    if (request->_tempObject) {
-      String* body = (String*)(request->_tempObject);
-      saveFile("/config.json", body->c_str());
-
-      delete body; // Clean up memory
-      request->_tempObject = nullptr;
-
+    int result = finishJsonBody(request);
+    if (result == UPD_SUCCESS) {
       if ((!railIsSet && !tubeIsSet && !busIsSet) || request->hasParam("reboot")) {
         // First time setup or base config change, we need a full reboot
+        config.invalidate();
         sendResponse(200,"Configuration saved. The Departures Board will now restart.",request);
         restartTimer.once(1, []() { ESP.restart(); });
       } else {
         sendResponse(200,"Configuration updated. The Departures Board will update shortly.",request);
-        softResetNeeded = true;
+        configChanged = true;
       }
-    } else {
+    } else if (result == UPD_NO_RESPONSE) {
       sendResponse(400,"Empty",request);
+    } else if (result == UPD_DATA_ERROR) {
+      sendResponse(400,"Invalid JSON format. No changes have been saved.",request);
+    } else {
+      sendResponse(500,"Failed to save the configuration to the file system (file system corrupt or full?)",request);
     }
   }, NULL, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
-    if (!index) {
-      // First chunk: Create a String object in RAM
-      request->_tempObject = new String("");
-    }
-
-    String* body = (String*)(request->_tempObject);
-    for (size_t i = 0; i < len; i++) {
-      body->concat((char)data[i]);
-    }
+    receiveJsonBody(request,"/config.json",data,len,index);
   });
 
   //
   // Save the API keys returned from the Web GUI
   //
   server.on("/savekeys", HTTP_POST, [](AsyncWebServerRequest *request) {
-    if (request->_tempObject) {
-      String* body = (String*)(request->_tempObject);
-
-      JsonDocument doc;
-      bool result = true;
+    int result = finishJsonBody(request);
+    if (result == UPD_SUCCESS) {
+      // Load/Update the API Keys in memory
+      loadApiKeys();
       String msg = "The API keys have been saved successfully.";
-      DeserializationError error = deserializeJson(doc, body->c_str());
-      if (!error) {
-        if (!saveFile("/apikeys.json", body->c_str())) {
-          msg = "Failed to save the API keys to the file system (file system corrupt or full?)";
-          result = false;
-        } else {
-          JsonObject settings = doc.as<JsonObject>();
-          String nrToken = settings["nrToken"].as<String>();
-          String rdmDepToken = settings["rdmDepKey"].as<String>();
-          if (!nrToken.length() && !rdmDepToken.length()) msg+="\n\nNote: Only Tube and Bus Departures will be available without either Rail Data or National Rail keys.";
-        }
-      } else {
-        msg = "Invalid JSON format. No changes have been saved.";
-        result = false;
-      }
-
-      delete body; // Clean up memory
-      request->_tempObject = nullptr;
-
-      if (result) {
-        // Load/Update the API Keys in memory
-        loadApiKeys();
-        // If all location codes are blank we're in the setup process. If not, the keys have been changed so just reboot.
-        if (!railIsSet && !tubeIsSet && !busIsSet) {
-          sendResponse(200,msg,request);
-          writeDefaultConfig();
-          showSetupCrsHelpScreen();
-        } else {
-          msg += "\n\nThe Departures Board will now restart.";
-          sendResponse(200,msg,request);
-          restartTimer.once(1, []() { ESP.restart(); });
-        }
+      if (!nrToken[0] && !rdmDeparturesApiKey.length()) msg+="\n\nNote: Only Tube and Bus Departures will be available without either Rail Data or National Rail keys.";
+      // If all location codes are blank we're in the setup process. If not, the keys have been changed so just reboot.
+      if (!railIsSet && !tubeIsSet && !busIsSet) {
+        sendResponse(200,msg,request);
+        writeDefaultConfig();
+        showSetupCrsHelpScreen();
       } else {
-        sendResponse(400,msg,request);
+        msg += "\n\nThe Departures Board will now restart.";
+        sendResponse(200,msg,request);
+        restartTimer.once(1, []() { ESP.restart(); });
       }
-    } else {
+    } else if (result == UPD_NO_RESPONSE) {
       sendResponse(400,"Empty",request);
+    } else if (result == UPD_DATA_ERROR) {
+      sendResponse(400,"Invalid JSON format. No changes have been saved.",request);
+    } else {
+      sendResponse(500,"Failed to save the API keys to the file system (file system corrupt or full?)",request);
     }
   }, NULL, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
-    if (!index) {
-      // First chunk: Create a String object in RAM
-      request->_tempObject = new String("");
-    }
-
-    String* body = (String*)(request->_tempObject);
-    for (size_t i = 0; i < len; i++) {
-      body->concat((char)data[i]);
-    }
+    receiveJsonBody(request,"/apikeys.json",data,len,index);
   });
 
   //
@@ -3259,12 +3916,19 @@ void setup(void) {
     }
   });
 
+  mirrorSocket.onEvent(handleMirrorEvent);
+  server.addHandler(&mirrorSocket);
+  boardEvents.onConnect([](AsyncEventSourceClient *client){feed.requestFull();});
+  server.addHandler(&boardEvents);
+
   server.begin();     // Start the local web server
 
   // Check for Firmware updates?
   if (firmwareUpdates) {
     progressBar("Checking for firmware updates",40);
-    if (ghUpdate.getLatestRelease()==UPD_SUCCESS) {
+    int result = ghUpdate.getLatestRelease();
+    fetchStats.countResult(UPSTREAM_GITHUB,result);
+    if (result==UPD_SUCCESS) {
       checkForFirmwareUpdate();
     } else {
       for (int i=15;i>=0;i--) {
@@ -3272,8 +3936,10 @@ void setup(void) {
         delay(1000);
       }
       u8g2.clearDisplay();
-      drawStartupHeading();
-      u8g2.sendBuffer();
+      if (!showBoardSnapshot()) {   // Put the saved board back if there is one
+        drawStartupHeading();
+        u8g2.sendBuffer();
+      }
     }
   }
   checkPostWebUpgrade();
@@ -3317,7 +3983,12 @@ void setup(void) {
   // Reload settings (clock has now been set)
   loadConfig();
 
-  station.numServices=0;
+  if (!showingSnapshot) {
+    xSemaphoreTake(boardLock,portMAX_DELAY);
+    station.numServices=0;
+    boardVersion++;
+    xSemaphoreGive(boardLock);
+  }
   if (rssEnabled && boardMode!=MODE_BUS) {
     progressBar("Loading RSS headlines feed",60);
     updateRssFeed();
@@ -3361,6 +4032,7 @@ void setup(void) {
       busdata.cleanFilter(locationFilter,locationCleanFilter,sizeof(locationFilter));
       startupProgressPercent=70;
   }
+  startLoopTimers();
 }
 
 
@@ -3377,80 +4049,49 @@ void loop(void) {
     }
   }
 
-  if (millis()-lastTimeUpdate >= 100) {
-    // Update the current time
-    if (getLocalTime(&timeinfo)) {
-      sprintf(currentTime,"%02d:%02d:%02d",timeinfo.tm_hour,timeinfo.tm_min,timeinfo.tm_sec);
-      lastTimeUpdate = millis();
-      if (millis()>3888000000 && timeinfo.tm_hour==3) ESP.restart(); // Reboot every 45 days at 3am
-    }
-  }
-
-  // Check for firmware updates daily if enabled
-  if (dailyUpdateCheck && !fetchInProgress && millis()>fwUpdateCheckTimer) {
-    fwUpdateCheckTimer = millis() + 3300000 + random(600000); // check again in 55 to 65 mins
-    if (timeinfo.tm_mday != prevUpdateCheckDay) {
-      if (ghUpdate.getLatestRelease()==UPD_SUCCESS) {
-        checkForFirmwareUpdate();
-      }
-      prevUpdateCheckDay = timeinfo.tm_mday;
+  if (releaseFetchComplete) {
+    releaseFetchComplete = false;
+    if (lastReleaseResult == UPD_SUCCESS) {
+      checkForFirmwareUpdate();
+      frameClock.restart();
     }
   }
 
   bool wasSleeping = isSleeping;
   isSleeping = isSnoozing();
-
-  if (isSleeping && millis()>timer) {       // If the "screensaver" is active, change the screen every 8 seconds
-    drawSleepingScreen();
-    timer=millis() + SCREENSAVERINTERVAL;
+  if (isSleeping && !wasSleeping) {
+    saveSnapshot(true);
+    timers.schedule(TIMER_SCREENSAVER,0);
   } else if (wasSleeping && !isSleeping) {
     // Exit sleep mode cleanly
     softResetBoard(MODE_LOADCONFIG);
   }
 
-  // WiFi Status icon
-  if (WiFi.status() != WL_CONNECTED && wifiConnected) {
-    wifiConnected=false;
-    u8g2.setFont(NatRailSmall9);
-    u8g2.drawStr(0,56,"\x7F");  // No Wifi Icon
-    u8g2.updateDisplayArea(0,7,1,1);
-  } else if (WiFi.status() == WL_CONNECTED && !wifiConnected) {
-    wifiConnected=true;
-    blankArea(0,57,5,7);
-    u8g2.updateDisplayArea(0,7,1,1);
-    updateMyUrl();  // in case our IP changed
-  }
+  // Anything periodic that's due (clock, WiFi, fetches, scheduler, screensaver)
+  timers.run();
 
-  // Force a manual reset if we've been disconnected for more than 10 secs
-  if (WiFi.status() != WL_CONNECTED && millis() > lastWiFiReconnect+10000) {
-    WiFi.disconnect();
-    delay(100);
-    WiFi.reconnect();
-    lastWiFiReconnect=millis();
-  }
-
-  switch (boardMode) {
-    case MODE_RAIL:
-      departureBoardLoop();
-      break;
+  {
+    HEAP_REGION(boardLoopHeap);
+    switch (boardMode) {
+      case MODE_RAIL:
+        departureBoardLoop();
+        break;
 
-    case MODE_TUBE:
-      undergroundArrivalsLoop();
-      break;
+      case MODE_TUBE:
+        undergroundArrivalsLoop();
+        break;
 
-    case MODE_BUS:
-      busDeparturesLoop();
-      break;
+      case MODE_BUS:
+        busDeparturesLoop();
+        break;
+    }
   }
 
-  if (manualUpdateCheck && !fetchInProgress) doManualOtaCheck();
+  updateMirror();
+  updateFeed();
+  heapProfile.sample();
 
-  if (rssEnabled && boardMode != MODE_BUS && millis() > nextRssUpdate && !fetchInProgress && !isSleeping && wifiConnected) {
-    // Start an RSS Update on Core 0
-    fetchMode = FETCH_RSS;
-    fetchInProgress = true;
-    xTaskNotifyGive(fetchTaskHandle);
-  }
+  if (manualUpdateCheck && !fetchInProgress) doManualOtaCheck();
 
   if (rssFetchComplete) {
     // Background fetch has completed
@@ -3458,13 +4099,6 @@ void loop(void) {
     if (lastRssUpdateResult == UPD_SUCCESS) buildRssMessage();
   }
 
-  if (weatherEnabled && millis()>nextWeatherUpdate && !fetchInProgress && locationLat && locationLon && !isSleeping && wifiConnected) {
-    // Start a weather update on Core 0
-    fetchMode = FETCH_WEATHER;
-    fetchInProgress = true;
-    xTaskNotifyGive(fetchTaskHandle);
-  }
-
   if (weatherFetchComplete) {
     weatherFetchComplete = false;
     if (lastWeatherUpdateResult == UPD_SUCCESS) {
@@ -3472,20 +4106,15 @@ void loop(void) {
     } else {
       weatherMsg[0] = '\0';
     }
+    layoutReady = false;  // The weather has its own row on the rail board
   }
 
-  if (softResetNeeded && !fetchInProgress) {
-    softResetNeeded=false;
-    softResetBoard(MODE_LOADCONFIG);
+  if (configChanged && !fetchInProgress) {
+    configChanged=false;
+    applyConfigChange();
   }
 
-  if ((schedulerActive || (carouselActive && numCarouselSlots>1)) && !isSleeping && !fetchInProgress && millis() > nextSchedulerCheck) {
-    int nowTime = getTimeInMinutes();
-    if ((activeSlotEventTime < nextSlotEventTime && nowTime >= nextSlotEventTime) || (activeSlotEventTime > nextSlotEventTime && nowTime < activeSlotEventTime && nowTime >= nextSlotEventTime)) {
-      if (carouselActive) currentCarouselSlot = (currentCarouselSlot + 1) % numCarouselSlots;
-      softResetBoard(MODE_LOADCONFIG);
-    }
-    nextSchedulerCheck = millis() + 10000;  // ten seconds
-  }
+  // Nothing is animated while the screen is sleeping, so wait for the next timer (checking for taps meanwhile)
+  if (isSleeping) delay(timers.idleTime(IDLEPOLLINTERVAL));
 
 }
\ No newline at end of file
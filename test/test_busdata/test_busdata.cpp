@@ -0,0 +1,101 @@
+/*
+ * Departures Board (c) 2025-2026 Gadec Software
+ *
+ * bustimes.org Client Library tests
+ *
+ * https://github.com/gadec-uk/departures-board
+ *
+ * This work is licensed under Creative Commons Attribution-NonCommercial-ShareAlike 4.0 International.
+ * To view a copy of this license, visit https://creativecommons.org/licenses/by-nc-sa/4.0/
+ *
+ * Run on the board with: pio test -e esp32dev -f test_busdata
+ */
+#include <Arduino.h>
+#include <unity.h>
+#include <busDataClient.h>
+
+static busTubeStation busStop;
+static rdStation board;
+static sharedBufferSpace sharedBuffer;
+static busDataClient client(&busStop,&board,&sharedBuffer);
+
+// Feeds one line of a bustimes.org departures page, returns true once the parser has finished
+static bool feed(const char *text, const char *filter = "") {
+    String line = text;
+    return client.parseLine(line,filter);
+}
+
+static void feedHeader() {
+    feed("<table>");
+    feed("<tr>");
+    feed("<th>Service</th>");
+    feed("<th>To</th>");
+    feed("<th>Scheduled</th>");
+    feed("<th>Expected</th>");
+    feed("</tr>");
+}
+
+// Feeds a complete four column service row, returns true if the parser finished on any line of it
+static bool feedRow(const char *service, const char *filter = "") {
+    char link[64];
+    sprintf(link,"<a href=\"/services/%s\">%s</a>",service,service);
+    const char *row[] = { "<tr>", "<td>", link, "</td>", "<td>", "Town Centre", "</td>",
+        "<td>", "12:00", "</td>", "<td>", "12:05", "</td>", "</tr>" };
+    bool complete = false;
+    for (const char *text : row) complete = feed(text,filter) || complete;
+    return complete;
+}
+
+void test_stops_at_max_services() {
+    client.startPage();
+    feedHeader();
+    for (int i=0;i<MAXBOARDSERVICES-1;i++) TEST_ASSERT_FALSE(feedRow("12"));
+    TEST_ASSERT_TRUE(feedRow("12"));
+    TEST_ASSERT_EQUAL(MAXBOARDSERVICES,client.servicesRead());
+
+    // Anything after the cap is ignored rather than written past the end of service[]
+    for (int i=0;i<5;i++) TEST_ASSERT_TRUE(feedRow("99"));
+    TEST_ASSERT_EQUAL(MAXBOARDSERVICES,client.servicesRead());
+    TEST_ASSERT_EQUAL_STRING("12",busStop.text.get(busStop.service[MAXBOARDSERVICES-1].lineName));
+}
+
+void test_filtered_rows_not_counted() {
+    client.startPage();
+    feedHeader();
+    for (int i=0;i<MAXBOARDSERVICES+5;i++) TEST_ASSERT_FALSE(feedRow("12","7"));
+    TEST_ASSERT_FALSE(feedRow("7","7"));
+    TEST_ASSERT_EQUAL(1,client.servicesRead());
+}
+
+void test_new_page_resets_cap() {
+    client.startPage();
+    feedHeader();
+    for (int i=0;i<MAXBOARDSERVICES+5;i++) feedRow("12");
+    TEST_ASSERT_EQUAL(MAXBOARDSERVICES,client.servicesRead());
+
+    client.startPage();
+    TEST_ASSERT_EQUAL(0,client.servicesRead());
+    feedHeader();
+    TEST_ASSERT_FALSE(feedRow("12"));
+    TEST_ASSERT_EQUAL(1,client.servicesRead());
+}
+
+void test_end_of_page() {
+    client.startPage();
+    feedHeader();
+    feedRow("12");
+    TEST_ASSERT_TRUE(feed("</body>"));
+    TEST_ASSERT_EQUAL(1,client.servicesRead());
+}
+
+void setup() {
+    delay(2000);    // Give the serial monitor time to connect
+    UNITY_BEGIN();
+    RUN_TEST(test_stops_at_max_services);
+    RUN_TEST(test_filtered_rows_not_counted);
+    RUN_TEST(test_new_page_resets_cap);
+    RUN_TEST(test_end_of_page);
+    UNITY_END();
+}
+
+void loop() {}
@@ -0,0 +1,75 @@
+// Live view of the display, loaded by index.htm when the Live View tab is first opened. The board sends the
+// 8x8 pixel tiles that have changed, XORed with what it sent before and run length encoded (see the
+// frameMirror library).
+window.liveView = (() => {
+  const live = {socket:null, frame:new Uint8Array(2048)};
+
+  function drawLiveFrame() {
+    const canvas = document.getElementById('liveCanvas');
+    const ctx = canvas.getContext('2d');
+    const image = ctx.createImageData(256,64);
+    for (let y=0;y<64;y++) {
+      for (let x=0;x<256;x++) {
+        if (live.frame[(y>>3)*256+x] & (1<<(y&7))) {
+          const p = (y*256+x)*4;
+          image.data[p] = 0xFF;
+          image.data[p+1] = 0xC0;
+        }
+      }
+    }
+    for (let p=3;p<image.data.length;p+=4) image.data[p] = 0xFF;
+    ctx.putImageData(image,0,0);
+  }
+
+  function applyLiveMessage(msg) {
+    if (msg.length < 33) return;
+    if (msg[0] === 0) live.frame.fill(0);
+    // Unpack the tile data
+    const data = [];
+    for (let i=33;i<msg.length;) {
+      const control = msg[i++];
+      if (control < 128) {
+        for (let n=0;n<=control;n++) data.push(msg[i++]);
+      } else {
+        for (let n=0;n<control-127;n++) data.push(msg[i]);
+        i++;
+      }
+    }
+    let pos = 0;
+    for (let tile=0;tile<256;tile++) {
+      if (!(msg[1+(tile>>3)] & (1<<(tile&7)))) continue;
+      const base = tile*8;
+      for (let i=0;i<8;i++) live.frame[base+i] ^= data[pos++];
+    }
+    drawLiveFrame();
+  }
+
+  function start() {
+    if (live.socket) return;
+    const status = document.getElementById('liveStatus');
+    status.textContent = 'Connecting...';
+    live.socket = new WebSocket('ws://' + location.host + '/mirror');
+    live.socket.binaryType = 'arraybuffer';
+    live.socket.onopen = () => {
+      status.textContent = 'Connected.';
+      live.socket.send('rate:' + document.getElementById('liveRate').value);
+    };
+    live.socket.onmessage = (event) => {
+      if (event.data instanceof ArrayBuffer) applyLiveMessage(new Uint8Array(event.data));
+    };
+    live.socket.onclose = () => {
+      status.textContent = 'Not connected.';
+      live.socket = null;
+    };
+  }
+
+  function stop() {
+    if (live.socket) live.socket.close();
+  }
+
+  document.getElementById('liveRate').addEventListener('change', (event) => {
+    if (live.socket && live.socket.readyState === WebSocket.OPEN) live.socket.send('rate:' + event.target.value);
+  });
+
+  return {start, stop};
+})();